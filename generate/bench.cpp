@@ -0,0 +1,947 @@
+/*
+    bench.cpp  -  Don Cross  -  https://github.com/cosinekitty/endgame
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include "chess.h"
+
+#ifdef ENDGAME_COUNT_ALLOCATIONS
+// Count every allocation, so the tests and benchmarks can check that
+// the generator's inner loop does not allocate memory.
+static std::atomic<uint64_t> NewCalls(0);
+
+// Kept out of line: once inlined into their callers, GCC sees malloc()
+// paired with operator delete, or operator new with free(), and reports a mismatch.
+#ifdef __GNUC__
+#define ENDGAME_NOINLINE __attribute__((noinline))
+#else
+#define ENDGAME_NOINLINE
+#endif
+
+ENDGAME_NOINLINE void *operator new(std::size_t size)
+{
+    NewCalls.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+ENDGAME_NOINLINE void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+ENDGAME_NOINLINE void operator delete(void *p) noexcept { std::free(p); }
+ENDGAME_NOINLINE void operator delete[](void *p) noexcept { std::free(p); }
+ENDGAME_NOINLINE void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+ENDGAME_NOINLINE void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+#endif
+
+namespace CosineKitty
+{
+    uint64_t AllocationCount()
+    {
+#ifdef ENDGAME_COUNT_ALLOCATIONS
+        return NewCalls.load(std::memory_order_relaxed);
+#else
+        return 0;
+#endif
+    }
+
+    template <typename BoardType>
+    static void SetupBoard(BoardType& board, const std::vector<Square>& pieces, const int *offset, bool whiteToMove)
+    {
+        board.Clear(whiteToMove);
+        for (std::size_t i = 0; i < pieces.size(); ++i)
+            board.SetSquare(offset[i], pieces[i]);
+    }
+
+    template <typename BoardType>
+    static double TimeBoard(const std::vector<Square>& pieces, const std::vector<int>& placements, bool work, long& checksum)
+    {
+        // Visit every placement with each side to move, doing the same board
+        // calls that ScoreWhite and ScoreBlack make. With work=false, only the
+        // board setup is timed, so the caller can subtract it out.
+        using namespace std::chrono;
+
+        BoardType board;
+        MoveList movelist;
+        const std::size_t n = pieces.size();
+        steady_clock::time_point start = steady_clock::now();
+        for (std::size_t p = 0; p < placements.size(); p += n)
+        {
+            for (int side = 0; side < 2; ++side)
+            {
+                SetupBoard(board, pieces, &placements[p], side == 0);
+                if (work && board.IsLegalPosition())
+                {
+                    board.GenMoves(movelist);
+                    checksum += movelist.length;
+                    if (board.IsCurrentPlayerInCheck())
+                        ++checksum;
+                }
+            }
+        }
+        duration<double> elapsed = steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    static bool SameMoves(const MoveList& a, const MoveList& b)
+    {
+        // The generator picks the first winning move, so the order matters too.
+        if (a.length != b.length)
+            return false;
+
+        for (int i = 0; i < a.length; ++i)
+            if (a.movelist[i].source != b.movelist[i].source || a.movelist[i].dest != b.movelist[i].dest)
+                return false;
+
+        return true;
+    }
+
+    int Endgame::BoardBenchmark() const
+    {
+        using namespace std;
+
+        // Collect the board offsets of every placement the generator visits.
+        vector<int> placements;
+        vector<size_t> indices;
+        vector<int> offset;
+        for (size_t index = 0; index < length; ++index)
+        {
+            if (UnrankPosition(index, offset))
+            {
+                placements.insert(placements.end(), offset.begin(), offset.end());
+                indices.push_back(index);
+            }
+        }
+
+        const size_t n = pieces.size();
+        const size_t count = placements.size() / n;
+        cout << "BoardBenchmark: " << count << " placements, each with both sides to move." << endl;
+
+        // Make sure both boards agree before timing them.
+        ChessBoard mailbox;
+        BitBoard bitboard;
+        MoveList mlist, blist;
+        for (size_t p = 0; p < placements.size(); p += n)
+        {
+            for (int side = 0; side < 2; ++side)
+            {
+                SetupBoard(mailbox, pieces, &placements[p], side == 0);
+                SetupBoard(bitboard, pieces, &placements[p], side == 0);
+                bool legal = mailbox.IsLegalPosition();
+                if (legal != bitboard.IsLegalPosition())
+                {
+                    cerr << "FAIL(BoardBenchmark): IsLegalPosition mismatch at " << PositionText(indices[p / n]) << endl;
+                    return 1;
+                }
+
+                if (legal)
+                {
+                    mailbox.GenMoves(mlist);
+                    bitboard.GenMoves(blist);
+                    if (!SameMoves(mlist, blist) || mailbox.IsCurrentPlayerInCheck() != bitboard.IsCurrentPlayerInCheck())
+                    {
+                        cerr << "FAIL(BoardBenchmark): move generation mismatch at " << PositionText(indices[p / n]) << endl;
+                        return 1;
+                    }
+
+                    mailbox.GenUnmoves(mlist);
+                    bitboard.GenUnmoves(blist);
+                    if (!SameMoves(mlist, blist))
+                    {
+                        cerr << "FAIL(BoardBenchmark): unmove generation mismatch at " << PositionText(indices[p / n]) << endl;
+                        return 1;
+                    }
+                }
+            }
+        }
+
+        long mailboxSum = 0, bitboardSum = 0;
+        double mailboxSetup = TimeBoard<ChessBoard>(pieces, placements, false, mailboxSum);
+        double mailboxTotal = TimeBoard<ChessBoard>(pieces, placements, true,  mailboxSum);
+        double bitboardSetup = TimeBoard<BitBoard>(pieces, placements, false, bitboardSum);
+        double bitboardTotal = TimeBoard<BitBoard>(pieces, placements, true,  bitboardSum);
+        if (mailboxSum != bitboardSum)
+        {
+            cerr << "FAIL(BoardBenchmark): checksum mismatch." << endl;
+            return 1;
+        }
+
+        double mailboxNs  = 1.0e+9 * (mailboxTotal  - mailboxSetup)  / (2 * count);
+        double bitboardNs = 1.0e+9 * (bitboardTotal - bitboardSetup) / (2 * count);
+        printf("ChessBoard: %8.1f ns/position\n", mailboxNs);
+        printf("BitBoard:   %8.1f ns/position\n", bitboardNs);
+        printf("Speedup:    %8.2f\n", mailboxNs / bitboardNs);
+        return 0;
+    }
+
+    template <typename Work>
+    static double TimePositions(ChessBoard& board, const std::vector<Square>& pieces, const std::vector<int>& placements, const std::vector<unsigned char>& turns, int rounds, Work work)
+    {
+        // Set up each position in turn and hand it to 'work'.
+        // Timing an empty 'work' gives the setup cost to subtract out.
+        using namespace std::chrono;
+
+        const std::size_t n = pieces.size();
+        steady_clock::time_point start = steady_clock::now();
+        for (int round = 0; round < rounds; ++round)
+        {
+            for (std::size_t p = 0; p < turns.size(); ++p)
+            {
+                SetupBoard(board, pieces, &placements[p * n], turns[p] != 0);
+                work();
+            }
+        }
+        duration<double> elapsed = steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    static void PrintRate(const char *name, double seconds, double calls)
+    {
+        printf("%-22s %8.1f ns/call  %8.2f M calls/s\n", name, 1.0e+9 * seconds / calls, 1.0e-6 * calls / seconds);
+    }
+
+    int Endgame::MoveBenchmark() const
+    {
+        using namespace std;
+        using namespace std::chrono;
+
+        // A fixed set of legal positions spread evenly through the table,
+        // so every run times the same work.
+        const size_t wanted = 1 << 16;
+        const size_t n = pieces.size();
+        const size_t step = max<size_t>(1, length / wanted);
+        vector<int> placements;
+        vector<unsigned char> turns;
+        vector<int> offset;
+        ChessBoard board;
+        for (size_t index = 0; index < length; index += step)
+        {
+            if (!UnrankPosition(index, offset))
+                continue;
+
+            for (int side = 0; side < 2; ++side)
+            {
+                SetupBoard(board, pieces, offset.data(), side == 0);
+                if (board.IsLegalPosition())
+                {
+                    placements.insert(placements.end(), offset.begin(), offset.end());
+                    turns.push_back(side == 0);
+                }
+            }
+        }
+
+        const size_t count = turns.size();
+        const int rounds = 20;
+        const double calls = static_cast<double>(count) * rounds;
+        MoveList movelist;
+        long checksum = 0;
+        long moves = 0;
+
+        double setup = TimePositions(board, pieces, placements, turns, rounds, [&]()
+        {
+            checksum += board.IsWhiteTurn();
+        });
+
+        double genmoves = TimePositions(board, pieces, placements, turns, rounds, [&]()
+        {
+            board.GenMoves(movelist);
+            moves += movelist.length;
+        });
+
+        double attacks = TimePositions(board, pieces, placements, turns, rounds, [&]()
+        {
+            for (int y = 2; y <= 9; ++y)
+                for (int x = 1; x <= 8; ++x)
+                    checksum += board.IsAttackedByWhite(10*y + x);
+        });
+
+        double pushpop = TimePositions(board, pieces, placements, turns, rounds, [&]()
+        {
+            board.GenMoves(movelist);
+            for (int i = 0; i < movelist.length; ++i)
+            {
+                board.PushMove(movelist.movelist[i]);
+                checksum += board.IsWhiteTurn();
+                board.PopMove();
+            }
+        });
+
+        steady_clock::time_point start = steady_clock::now();
+        for (int round = 0; round < rounds; ++round)
+            for (size_t p = 0; p < count; ++p)
+                checksum += TableIndex(&placements[p * n]).index;
+        duration<double> tableIndex = steady_clock::now() - start;
+
+        printf("MoveBenchmark(%s): %lu legal positions, %d rounds, %0.1f moves/position (checksum %ld).\n",
+            piecelist.c_str(), static_cast<unsigned long>(count), rounds, moves / calls, checksum);
+        PrintRate("GenMoves", genmoves - setup, calls);
+        PrintRate("IsAttackedByWhite", attacks - setup, 64 * calls);
+        PrintRate("PushMove+PopMove", pushpop - genmoves, static_cast<double>(moves));
+        PrintRate("TableIndex", tableIndex.count(), calls);
+        return 0;
+    }
+
+    int Endgame::LegalMoveBenchmark() const
+    {
+        using namespace std;
+
+        // Check GenMoves against the original generator, which makes each move
+        // to test it for self-check, in every legal position of the table.
+        // Time both on positions spread evenly through the table.
+        const size_t step = max<size_t>(1, length >> 18);
+        size_t checked = 0;
+        vector<int> placements;
+        vector<unsigned char> turns;
+        vector<int> offset;
+        ChessBoard board;
+        MoveList movelist, trial;
+        for (size_t index = 0; index < length; ++index)
+        {
+            if (!UnrankPosition(index, offset))
+                continue;
+
+            for (int side = 0; side < 2; ++side)
+            {
+                SetupBoard(board, pieces, offset.data(), side == 0);
+                if (!board.IsLegalPosition())
+                    continue;
+
+                board.GenMoves(movelist);
+                board.GenMovesByTrial(trial);
+                if (!SameMoves(movelist, trial))
+                {
+                    cerr << "FAIL(LegalMoveBenchmark): move generation mismatch at " << PositionText(index) << (side == 0 ? " (White to move)" : " (Black to move)") << endl;
+                    return 1;
+                }
+
+                ++checked;
+                if (index % step == 0)
+                {
+                    placements.insert(placements.end(), offset.begin(), offset.end());
+                    turns.push_back(side == 0);
+                }
+            }
+        }
+
+        const size_t count = turns.size();
+        const int rounds = 10;
+        const double calls = static_cast<double>(count) * rounds;
+        long checksum = 0;
+        double setup = TimePositions(board, pieces, placements, turns, rounds, [&]()
+        {
+            checksum += board.IsWhiteTurn();
+        });
+
+        double legal = TimePositions(board, pieces, placements, turns, rounds, [&]()
+        {
+            board.GenMoves(movelist);
+            checksum += movelist.length;
+        });
+
+        double bytrial = TimePositions(board, pieces, placements, turns, rounds, [&]()
+        {
+            board.GenMovesByTrial(trial);
+            checksum -= trial.length;
+        });
+
+        printf("LegalMoveBenchmark(%s): %lu legal positions agree; timed %lu of them (checksum %ld).\n",
+            piecelist.c_str(), static_cast<unsigned long>(checked), static_cast<unsigned long>(count), checksum);
+        PrintRate("GenMoves", legal - setup, calls);
+        PrintRate("GenMovesByTrial", bytrial - setup, calls);
+        printf("Speedup: %0.2f\n", (bytrial - setup) / (legal - setup));
+        return 0;
+    }
+
+    int Endgame::PassBenchmark()
+    {
+        using namespace std;
+        using namespace std::chrono;
+
+        // Time the first Black and White passes over every placement of the pieces,
+        // without the live bitmaps Generate() uses, in whichever build this is.
+        // Compare a default build against one with -DENDGAME_UNCHECKED.
+        if (numSlices > 0)
+            throw ChessException("PassBenchmark: tables with pawns are not supported.");
+
+        whiteTable.Allocate(length, Move());
+        blackTable.Allocate(length, Unscored);
+        vector<Worker> workers(1);
+        workers[0].offsetList.resize(pieces.size());
+
+        printf("PassBenchmark(%s): %s build, allocations %s\n", piecelist.c_str(), CheckedBuild ? "checked" : "unchecked", CountingAllocations ? "counted" : "not counted");
+        for (Side side : { Black, White })
+        {
+            uint64_t allocations = AllocationCount();
+            steady_clock::time_point start = steady_clock::now();
+            int nfound = SearchPass(workers, 1, side);
+            duration<double> elapsed = steady_clock::now() - start;
+            allocations = AllocationCount() - allocations;
+
+            const PassCounters& counters = workers[0].counters;
+            printf("%s pass: %lu positions, %d found, %0.3f seconds, %0.1f ns/position, %lu allocations\n",
+                (side == White) ? "White" : "Black",
+                static_cast<unsigned long>(counters.visited),
+                nfound,
+                elapsed.count(),
+                1.0e+9 * elapsed.count() / counters.visited,
+                static_cast<unsigned long>(allocations));
+            workers[0].counters = PassCounters();
+        }
+        return 0;
+    }
+
+    static double TimeGenerate(Endgame& db, bool generic)
+    {
+        // Generate the table on one thread, without the pass reports.
+        GenerateOptions options;
+        options.generic = generic;
+        std::cout.setstate(std::ios::failbit);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        bool finished = db.Generate(options);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout.clear();
+        if (!finished)
+            throw ChessException("GeneratorBenchmark: generation did not finish.");
+        return elapsed.count();
+    }
+
+    int Endgame::GeneratorBenchmark(Endgame& generic, Endgame& compiled)
+    {
+        // Build the same table with the board-based generator and with the one
+        // compiled for its piece list, and check that every entry agrees.
+        if (generic.piecelist != compiled.piecelist)
+            throw ChessException("GeneratorBenchmark: the tables must have the same piece list.");
+
+        if (compiled.pieces.size() > MaxCompiledPieces)
+            throw ChessException("GeneratorBenchmark: no generator is compiled for " + compiled.piecelist);
+
+        double genericSeconds = TimeGenerate(generic, true);
+        double compiledSeconds = TimeGenerate(compiled, false);
+
+        std::size_t mismatches = 0;
+        for (std::size_t index = 0; index < generic.length; ++index)
+        {
+            const Move& a = generic.whiteTable[index];
+            const Move& b = compiled.whiteTable[index];
+            if (a.source != b.source || a.dest != b.dest || a.score != b.score || generic.blackTable[index] != compiled.blackTable[index])
+                ++mismatches;
+        }
+
+        printf("GeneratorBenchmark(%s): board %0.3f seconds, compiled %0.3f seconds, speedup %0.2f\n",
+            generic.piecelist.c_str(),
+            genericSeconds,
+            compiledSeconds,
+            genericSeconds / compiledSeconds);
+
+        if (mismatches != 0)
+        {
+            printf("GeneratorBenchmark: FAIL - %lu table entries differ.\n", static_cast<unsigned long>(mismatches));
+            return 1;
+        }
+        return 0;
+    }
+
+    template <typename BoardType>
+    static uint64_t Perft(BoardType& board, int depth)
+    {
+        // Count the positions reached by every sequence of 'depth' legal moves.
+        if (depth == 0)
+            return 1;
+
+        MoveList movelist;
+        board.GenMoves(movelist);
+        uint64_t nodes = 0;
+        for (int i = 0; i < movelist.length; ++i)
+        {
+            board.PushMove(movelist.movelist[i]);
+            nodes += Perft(board, depth - 1);
+            board.PopMove();
+        }
+        return nodes;
+    }
+
+    int Endgame::PerftBenchmark(const char *fen, int maxDepth)
+    {
+        using namespace std;
+        using namespace std::chrono;
+
+        ChessBoard mailbox;
+        mailbox.LoadFen(fen);
+        if (!mailbox.IsLegalPosition())
+            throw ChessException("PerftBenchmark: illegal position");
+
+        // Copy the position into a BitBoard, Kings first so no piece lands on a King.
+        BitBoard bitboard;
+        bitboard.Clear(mailbox.IsWhiteTurn());
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            for (int y = 2; y <= 9; ++y)
+            {
+                for (int x = 1; x <= 8; ++x)
+                {
+                    Square s = mailbox.GetSquare(10*y + x);
+                    bool king = (s == WhiteKing || s == BlackKing);
+                    if (s != Empty && king == (pass == 0))
+                        bitboard.SetSquare(10*y + x, s);
+                }
+            }
+        }
+
+        printf("Perft(%s)\n", fen);
+        printf("depth %14s %20s %20s\n", "nodes", "ChessBoard nodes/s", "BitBoard nodes/s");
+        for (int depth = 1; depth <= maxDepth; ++depth)
+        {
+            steady_clock::time_point start = steady_clock::now();
+            uint64_t mailboxNodes = Perft(mailbox, depth);
+            duration<double> mailboxTime = steady_clock::now() - start;
+
+            start = steady_clock::now();
+            uint64_t bitboardNodes = Perft(bitboard, depth);
+            duration<double> bitboardTime = steady_clock::now() - start;
+
+            if (mailboxNodes != bitboardNodes)
+            {
+                cerr << "FAIL(PerftBenchmark): depth " << depth << ": ChessBoard found " << mailboxNodes << " nodes, BitBoard found " << bitboardNodes << endl;
+                return 1;
+            }
+
+            printf("%5d %14llu %20.0f %20.0f\n", depth,
+                static_cast<unsigned long long>(mailboxNodes),
+                mailboxNodes / mailboxTime.count(),
+                bitboardNodes / bitboardTime.count());
+        }
+        return 0;
+    }
+
+    static std::string MakeFen(const std::vector<Square>& pieces, const int *offset, bool whiteToMove)
+    {
+        char grid[120];
+        for (int i = 0; i < 120; ++i)
+            grid[i] = 0;
+        for (std::size_t i = 0; i < pieces.size(); ++i)
+            grid[offset[i]] = SquareChar(pieces[i]);
+
+        std::string fen;
+        for (int y = 9; y >= 2; --y)
+        {
+            int gap = 0;
+            for (int x = 1; x <= 8; ++x)
+            {
+                char c = grid[10*y + x];
+                if (c == 0)
+                {
+                    ++gap;
+                }
+                else
+                {
+                    if (gap > 0)
+                        fen.push_back(static_cast<char>('0' + gap));
+                    gap = 0;
+                    fen.push_back(c);
+                }
+            }
+            if (gap > 0)
+                fen.push_back(static_cast<char>('0' + gap));
+            if (y > 2)
+                fen.push_back('/');
+        }
+        fen += whiteToMove ? " w - - 0 1" : " b - - 0 1";
+        return fen;
+    }
+
+    static bool CheckProbe(const EndgameProbe& probe, ChessBoard& board, const ProbeResult& result)
+    {
+        // The best move must lead to a position one step closer to checkmate,
+        // or to a draw if Black is not lost.
+        if (result.move.Source() == 0)
+            return result.mateInMoves <= 0;
+
+        bool whiteMoved = board.IsWhiteTurn();
+        bool capture = (board.GetSquare(result.move.Dest()) != Empty);
+        bool promotion = (board.GetSquare(result.move.Source()) == WhitePawn && Rank(result.move.Dest()) == '8');
+        ProbeResult after;
+        board.PushMove(result.move);
+        bool found = probe.Probe(board, after);
+        board.PopMove();
+
+        // Only Black can capture, only White can promote, and either way
+        // the result belongs to another table this probe cannot see.
+        if (capture)
+            return !whiteMoved;
+        if (promotion)
+            return whiteMoved;
+
+        if (!found)
+            return false;
+
+        if (whiteMoved)
+            return after.mateInMoves == result.mateInMoves - 1;
+
+        return after.mateInMoves == result.mateInMoves;
+    }
+
+    static void RandomPositions(
+        const std::vector<Square>& pieces,
+        std::size_t count,
+        std::vector<int>& placements,
+        std::vector<unsigned char>& turns,
+        std::vector<std::string>& fens)
+    {
+        using namespace std;
+
+        // Make a repeatable set of random legal positions, each given
+        // as piece offsets and as a FEN string.
+        const size_t n = pieces.size();
+        placements.reserve(count * n);
+        turns.reserve(count);
+        fens.reserve(count);
+
+        ChessBoard board;
+        unsigned long long seed = 0x2545f4914f6cdd1dULL;
+        int offset[MaxEndgamePieces];
+        while (turns.size() < count)
+        {
+            bool distinct = true;
+            for (size_t i = 0; i < n; ++i)
+            {
+                seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+                int disp = static_cast<int>(seed >> 58);
+                offset[i] = 21 + 10*(disp / 8) + (disp % 8);
+                for (size_t k = 0; k < i; ++k)
+                    if (offset[k] == offset[i])
+                        distinct = false;
+
+                // Pawns never stand on the first or last rank.
+                if (pieces[i] == WhitePawn && (disp < 8 || disp >= 56))
+                    distinct = false;
+            }
+
+            if (!distinct)
+                continue;
+
+            bool whiteToMove = ((seed >> 40) & 1) != 0;
+            string fen = MakeFen(pieces, offset, whiteToMove);
+            board.LoadFen(fen.c_str());
+            if (!board.IsLegalPosition())
+                continue;
+
+            placements.insert(placements.end(), offset, offset + n);
+            turns.push_back(whiteToMove);
+            fens.push_back(fen);
+        }
+    }
+
+    int EndgameProbe::Benchmark() const
+    {
+        using namespace std;
+        using namespace std::chrono;
+
+        const size_t count = 1 << 20;
+        const size_t n = db.pieces.size();
+        vector<int> placements;
+        vector<unsigned char> turns;
+        vector<string> fens;
+        RandomPositions(db.pieces, count, placements, turns, fens);
+
+        // Make sure the probe agrees with itself before timing it.
+        ChessBoard board;
+        size_t wins = 0;
+        ProbeResult result;
+        for (size_t p = 0; p < count; ++p)
+        {
+            if (!ProbeFen(fens[p].c_str(), board, result) || !CheckProbe(*this, board, result))
+            {
+                cerr << "FAIL(EndgameProbe::Benchmark): inconsistent result for " << fens[p] << endl;
+                return 1;
+            }
+            if (result.mateInMoves >= 0)
+                ++wins;
+        }
+
+        long checksum = 0;
+        steady_clock::time_point start = steady_clock::now();
+        for (size_t p = 0; p < count; ++p)
+        {
+            Lookup(&placements[p * n], turns[p] != 0, result);
+            checksum += result.score;
+        }
+        duration<double> lookupTime = steady_clock::now() - start;
+
+        start = steady_clock::now();
+        for (size_t p = 0; p < count; ++p)
+        {
+            board.LoadFen(fens[p].c_str());
+            checksum += board.IsWhiteTurn();
+        }
+        duration<double> parseTime = steady_clock::now() - start;
+
+        start = steady_clock::now();
+        for (size_t p = 0; p < count; ++p)
+        {
+            ProbeFen(fens[p].c_str(), board, result);
+            checksum += result.score;
+        }
+        duration<double> fenTime = steady_clock::now() - start;
+
+        printf("EndgameProbe(%s): %lu random legal positions, %lu forced wins (checksum %ld).\n",
+            db.piecelist.c_str(), static_cast<unsigned long>(count), static_cast<unsigned long>(wins), checksum);
+        printf("Lookup (piece offsets):  %8.1f ns/probe\n", 1.0e+9 * lookupTime.count() / count);
+        printf("Probe (ChessBoard):      %8.1f ns/probe\n", 1.0e+9 * (fenTime.count() - parseTime.count()) / count);
+        printf("ProbeFen (parse+probe):  %8.1f ns/probe\n", 1.0e+9 * fenTime.count() / count);
+        return 0;
+    }
+
+    int EndgameBitbase::Benchmark(const EndgameProbe& full) const
+    {
+        using namespace std;
+        using namespace std::chrono;
+
+        const size_t count = 1 << 20;
+        const size_t n = db.pieces.size();
+        vector<int> placements;
+        vector<unsigned char> turns;
+        vector<string> fens;
+        RandomPositions(db.pieces, count, placements, turns, fens);
+
+        // Every answer must match the full table before timing either of them.
+        size_t wins = 0;
+        ProbeResult result;
+        for (size_t p = 0; p < count; ++p)
+        {
+            BitbaseEntry entry = Lookup(&placements[p * n], turns[p] != 0);
+            if (!full.Lookup(&placements[p * n], turns[p] != 0, result) || entry != ((result.mateInMoves >= 0) ? BitbaseWin : BitbaseDraw))
+            {
+                cerr << "FAIL(EndgameBitbase::Benchmark): bitbase disagrees with the full table for " << fens[p] << endl;
+                return 1;
+            }
+            if (entry == BitbaseWin)
+                ++wins;
+        }
+
+        // Time each lookup twice and keep the second, so both start with warm caches.
+        double bitbaseNs = 0.0, fullNs = 0.0;
+        long checksum = 0;
+        for (int round = 0; round < 2; ++round)
+        {
+            steady_clock::time_point start = steady_clock::now();
+            for (size_t p = 0; p < count; ++p)
+                checksum += Lookup(&placements[p * n], turns[p] != 0);
+            duration<double> bitbaseTime = steady_clock::now() - start;
+
+            start = steady_clock::now();
+            for (size_t p = 0; p < count; ++p)
+            {
+                full.Lookup(&placements[p * n], turns[p] != 0, result);
+                checksum += (result.mateInMoves >= 0);
+            }
+            duration<double> fullTime = steady_clock::now() - start;
+
+            bitbaseNs = 1.0e+9 * bitbaseTime.count() / count;
+            fullNs = 1.0e+9 * fullTime.count() / count;
+        }
+
+        const size_t bitbaseBytes = 2 * ((db.length + 3) / 4);
+        const size_t fullBytes = db.length * (sizeof(Move) + sizeof(short));
+        printf("EndgameBitbase(%s): %lu random legal positions agree with the full table, %lu forced wins (checksum %ld).\n",
+            db.piecelist.c_str(), static_cast<unsigned long>(count), static_cast<unsigned long>(wins), checksum);
+        printf("Bitbase tables: %10lu bytes, Lookup %8.1f ns/probe\n", static_cast<unsigned long>(bitbaseBytes), bitbaseNs);
+        printf("Full tables:    %10lu bytes, Lookup %8.1f ns/probe\n", static_cast<unsigned long>(fullBytes), fullNs);
+        printf("Speedup:        %10.2f\n", fullNs / bitbaseNs);
+        return 0;
+    }
+
+    int Endgame::CompressionBenchmark(std::string filename) const
+    {
+        using namespace std;
+        using namespace std::chrono;
+
+        // Write the loaded tables as a .egz file, then make sure every entry reads back the same.
+        SaveCompressed(filename);
+        CompressedTable table;
+        table.Open(filename, piecelist, length, DefaultCacheBlocks);
+        for (size_t index = 0; index < length; ++index)
+        {
+            Move w = table.WhiteEntry(index);
+            if (w.source != whiteTable[index].source || w.dest != whiteTable[index].dest || w.score != whiteTable[index].score || table.BlackEntry(index) != blackTable[index])
+            {
+                cerr << "FAIL(CompressionBenchmark): entry " << index << " does not match." << endl;
+                return 1;
+            }
+        }
+
+        const size_t rawBytes = length * (sizeof(Move) + sizeof(short));
+        printf("CompressionBenchmark(%s): %lu bytes of table entries stored in %lu bytes, ratio %0.2f : 1, %lu blocks.\n",
+            piecelist.c_str(),
+            static_cast<unsigned long>(rawBytes),
+            static_cast<unsigned long>(table.FileBytes()),
+            static_cast<double>(rawBytes) / table.FileBytes(),
+            static_cast<unsigned long>(table.NumBlocks()));
+
+        // Random entries from both tables: with every block cached, each read is a hit;
+        // with a single-block cache, nearly every read must decode a block.
+        const size_t count = 1 << 20;
+        vector<size_t> indices(count);
+        unsigned long long seed = 0x9e3779b97f4a7c15ULL;
+        for (size_t& index : indices)
+        {
+            seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+            index = static_cast<size_t>((seed >> 16) % (2 * length));
+        }
+
+        for (size_t cacheBlocks : { table.NumBlocks(), static_cast<size_t>(1) })
+        {
+            CompressedTable cached;
+            cached.Open(filename, piecelist, length, cacheBlocks);
+            long checksum = 0;
+            for (size_t index = 0; index < length; index += CompressedBlockEntries)
+                checksum += cached.WhiteEntry(index).score + cached.BlackEntry(index);
+
+            uint64_t hits = cached.Hits(), misses = cached.Misses();
+            steady_clock::time_point start = steady_clock::now();
+            for (size_t index : indices)
+                checksum += (index < length) ? cached.WhiteEntry(index).score : cached.BlackEntry(index - length);
+            duration<double> elapsed = steady_clock::now() - start;
+
+            hits = cached.Hits() - hits;
+            misses = cached.Misses() - misses;
+            printf("cache of %5lu blocks: %8.1f ns/read, %lu hits, %lu misses (checksum %ld)\n",
+                static_cast<unsigned long>(cacheBlocks),
+                1.0e+9 * elapsed.count() / count,
+                static_cast<unsigned long>(hits),
+                static_cast<unsigned long>(misses),
+                checksum);
+        }
+
+        return 0;
+    }
+
+    int Endgame::DistanceBenchmark(std::string filename) const
+    {
+        using namespace std;
+
+        // Write the loaded tables as a .egd file, then make sure every score reads back the same.
+        SaveDistances(filename);
+        DistanceTable table;
+        table.Open(filename, piecelist, length);
+        if (!table.VerifyChecksums())
+        {
+            cerr << "FAIL(DistanceBenchmark): checksums of the new file do not match." << endl;
+            return 1;
+        }
+
+        for (size_t index = 0; index < length; ++index)
+        {
+            if (table.WhiteScore(index) != max(whiteTable[index].score, Draw) || table.BlackScore(index) != max(blackTable[index], Draw))
+            {
+                cerr << "FAIL(DistanceBenchmark): entry " << index << " does not match." << endl;
+                return 1;
+            }
+        }
+
+        const size_t rawBytes = length * (sizeof(Move) + sizeof(short));
+        printf("DistanceBenchmark(%s): %lu bytes of table entries stored in %lu bytes, ratio %0.2f : 1.\n",
+            piecelist.c_str(),
+            static_cast<unsigned long>(rawBytes),
+            static_cast<unsigned long>(table.FileBytes()),
+            static_cast<double>(rawBytes) / table.FileBytes());
+
+        return 0;
+    }
+
+    static bool NextPlacement(std::vector<int>& disp, int *offset)
+    {
+        // Step through every way to put each piece on its own square, like an odometer.
+        const std::size_t n = disp.size();
+        for (;;)
+        {
+            std::size_t i = n;
+            while (i > 0 && ++disp[i-1] == 64)
+                disp[--i] = 0;
+
+            if (i == 0)
+                return false;
+
+            bool distinct = true;
+            for (std::size_t a = 0; a < n && distinct; ++a)
+                for (std::size_t b = 0; b < a && distinct; ++b)
+                    distinct = (disp[a] != disp[b]);
+
+            if (distinct)
+            {
+                for (std::size_t k = 0; k < n; ++k)
+                    offset[k] = 21 + 10*(disp[k] / 8) + (disp[k] % 8);
+                return true;
+            }
+        }
+    }
+
+    int Endgame::CanonicalBenchmark() const
+    {
+        using namespace std;
+        using namespace std::chrono;
+
+        // Canonicalize every placement of the pieces, including all the
+        // non-canonical ones, with both the King-pair lookup and the 8-way search.
+        const size_t n = pieces.size();
+        int offset[MaxEndgamePieces];
+        vector<int> disp(n, 0);
+        disp[n-1] = -1;
+        size_t count = 0;
+        while (NextPlacement(disp, offset))
+        {
+            Position fast = CanonicalPosition(offset);
+            Position slow = SearchCanonicalPosition(offset);
+            if (fast.index != slow.index || (fast.index < length && fast.symmetry != slow.symmetry))
+            {
+                cerr << "FAIL(CanonicalBenchmark): placement " << count << " gives index " << fast.index << " symmetry " << fast.symmetry
+                     << ", expected index " << slow.index << " symmetry " << slow.symmetry << endl;
+                return 1;
+            }
+            ++count;
+        }
+
+        double elapsed[3];
+        size_t checksum[3];
+        for (int method = 0; method < 3; ++method)
+        {
+            // method 0 only steps through the placements, so its time can be subtracted from the others.
+            checksum[method] = 0;
+            fill(disp.begin(), disp.end(), 0);
+            disp[n-1] = -1;
+            steady_clock::time_point start = steady_clock::now();
+            while (NextPlacement(disp, offset))
+            {
+                switch (method)
+                {
+                case 0:     checksum[0] += offset[n-1];                             break;
+                case 1:     checksum[1] += SearchCanonicalPosition(offset).index;   break;
+                default:    checksum[2] += CanonicalPosition(offset).index;         break;
+                }
+            }
+            duration<double> span = steady_clock::now() - start;
+            elapsed[method] = span.count();
+        }
+
+        if (checksum[1] != checksum[2])
+        {
+            cerr << "FAIL(CanonicalBenchmark): checksum mismatch." << endl;
+            return 1;
+        }
+
+        double searchNs = 1.0e+9 * (elapsed[1] - elapsed[0]) / count;
+        double lookupNs = 1.0e+9 * (elapsed[2] - elapsed[0]) / count;
+        printf("CanonicalBenchmark(%s): %lu placements agree.\n", piecelist.c_str(), static_cast<unsigned long>(count));
+        printf("8-way search:     %8.1f ns/placement\n", searchNs);
+        printf("King-pair lookup: %8.1f ns/placement\n", lookupNs);
+        printf("Speedup:          %8.2f\n", searchNs / lookupNs);
+        return 0;
+    }
+}
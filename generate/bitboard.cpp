@@ -0,0 +1,498 @@
+/*
+    bitboard.cpp  -  Don Cross  -  https://github.com/cosinekitty/endgame
+
+    An implementation of the ChessBoard interface that keeps a bitmask
+    for each kind of piece, so that attack detection is a handful of
+    table lookups instead of walking the mailbox.
+*/
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#include "chess.h"
+
+namespace CosineKitty
+{
+    // Directions in the same order ChessBoard uses them:
+    // North, NorthEast, East, SouthEast, South, SouthWest, West, NorthWest.
+    static const int NumDirections = 8;
+    static const int DirFile[NumDirections] = {  0, +1, +1, +1,  0, -1, -1, -1 };
+    static const int DirRank[NumDirections] = { +1, +1,  0, -1, -1, -1,  0, +1 };
+
+    // Knight jumps in the same order as KnightDir1..KnightDir8.
+    static const int JumpFile[8] = { +1, -1, +1, -1, +2, +2, -2, -2 };
+    static const int JumpRank[8] = { +2, +2, -2, -2, +1, -1, +1, -1 };
+
+    inline int BitIndex(int offset)
+    {
+        return 8*(offset/10 - 2) + (offset%10 - 1);
+    }
+
+    inline int BitOffset(int index)
+    {
+        return 21 + 10*(index/8) + (index%8);
+    }
+
+    inline Bitmask Bit(int index)
+    {
+        return 1ULL << index;
+    }
+
+    inline int HighestBit(Bitmask mask)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanReverse64(&index, mask);
+        return static_cast<int>(index);
+#else
+        return 63 - __builtin_clzll(mask);
+#endif
+    }
+
+    struct AttackTables
+    {
+        Bitmask kingMask[64];               // squares a King on each square attacks
+        Bitmask knightMask[64];             // squares a Knight on each square attacks
+        Bitmask whitePawnFrom[64];          // squares from which a White Pawn attacks each square
+        Bitmask blackPawnFrom[64];          // squares from which a Black Pawn attacks each square
+        Bitmask rayMask[NumDirections][64]; // all squares beyond each square in each direction
+        int     kingTarget[64][8];          // King destinations in ChessBoard order, -1 if off the board
+        int     knightTarget[64][8];        // Knight destinations in ChessBoard order, -1 if off the board
+        int     rayLength[NumDirections][64];
+        int     rayTarget[NumDirections][64][7];
+
+        AttackTables()
+        {
+            for (int index = 0; index < 64; ++index)
+            {
+                int file = index % 8;
+                int rank = index / 8;
+
+                kingMask[index] = knightMask[index] = whitePawnFrom[index] = blackPawnFrom[index] = 0;
+                for (int d = 0; d < NumDirections; ++d)
+                {
+                    kingTarget[index][d] = SquareAt(file + DirFile[d], rank + DirRank[d]);
+                    if (kingTarget[index][d] >= 0)
+                        kingMask[index] |= Bit(kingTarget[index][d]);
+
+                    knightTarget[index][d] = SquareAt(file + JumpFile[d], rank + JumpRank[d]);
+                    if (knightTarget[index][d] >= 0)
+                        knightMask[index] |= Bit(knightTarget[index][d]);
+
+                    rayMask[d][index] = 0;
+                    rayLength[d][index] = 0;
+                    for (int k = 1; SquareAt(file + k*DirFile[d], rank + k*DirRank[d]) >= 0; ++k)
+                    {
+                        int target = SquareAt(file + k*DirFile[d], rank + k*DirRank[d]);
+                        rayMask[d][index] |= Bit(target);
+                        rayTarget[d][index][rayLength[d][index]++] = target;
+                    }
+                }
+
+                for (int df = -1; df <= +1; df += 2)
+                {
+                    if (SquareAt(file + df, rank - 1) >= 0)
+                        whitePawnFrom[index] |= Bit(SquareAt(file + df, rank - 1));
+
+                    if (SquareAt(file + df, rank + 1) >= 0)
+                        blackPawnFrom[index] |= Bit(SquareAt(file + df, rank + 1));
+                }
+            }
+        }
+
+        static int SquareAt(int file, int rank)
+        {
+            return (file >= 0 && file < 8 && rank >= 0 && rank < 8) ? (8*rank + file) : -1;
+        }
+    };
+
+    static const AttackTables Tables;
+
+    inline bool IsPositiveDirection(int d)
+    {
+        // North, NorthEast, East, and NorthWest increase the bit number.
+        return d <= 2 || d == 7;
+    }
+
+    inline Bitmask RayAttacks(int d, int index, Bitmask occupied)
+    {
+        // Squares attacked along one direction, up to and including the first blocker.
+        Bitmask ray = Tables.rayMask[d][index];
+        Bitmask blockers = ray & occupied;
+        if (blockers)
+            ray ^= Tables.rayMask[d][IsPositiveDirection(d) ? LowestBit(blockers) : HighestBit(blockers)];
+        return ray;
+    }
+
+    void BitBoard::Clear(bool whiteToMove)
+    {
+        for (int index = 0; index < 64; ++index)
+            square[index] = Empty;
+
+        for (int s = 0; s <= BlackKing; ++s)
+            pieceMask[s] = 0;
+
+        whiteMask = blackMask = 0;
+        Place(wkindex = BitIndex(Offset('e', '1')), WhiteKing);
+        Place(bkindex = BitIndex(Offset('e', '8')), BlackKing);
+        isWhiteTurn = whiteToMove;
+        unmoveStack.Clear();
+    }
+
+    void BitBoard::Place(int index, Square value)
+    {
+        // Replace whatever is on the square, keeping all the masks consistent.
+        Bitmask bit = Bit(index);
+        Square old = square[index];
+        if (old != Empty)
+        {
+            pieceMask[old] &= ~bit;
+            whiteMask &= ~bit;
+            blackMask &= ~bit;
+        }
+
+        square[index] = value;
+        if (value != Empty)
+        {
+            pieceMask[value] |= bit;
+            if (SquareSide(value) == White)
+                whiteMask |= bit;
+            else
+                blackMask |= bit;
+        }
+    }
+
+    Square BitBoard::GetSquare(int offset) const
+    {
+        return square[BitIndex(ValidateOffset(offset))];
+    }
+
+    void BitBoard::SetSquare(int offset, Square value)
+    {
+        int index = BitIndex(ValidateOffset(offset));
+        if (CheckedBuild && SquareSide(value) == Invalid)
+            throw ChessException("SetSquare: invalid square value");
+
+        // There must be exactly one King of each color on the board.
+        // Putting a King on the other King's square swaps them, so the Kings can be placed in either order.
+        if (value == WhiteKing)
+        {
+            if (index == bkindex)
+                Place(bkindex = wkindex, BlackKing);
+            else
+                Place(wkindex, Empty);
+            wkindex = index;
+        }
+        else if (value == BlackKing)
+        {
+            if (index == wkindex)
+                Place(wkindex = bkindex, WhiteKing);
+            else
+                Place(bkindex, Empty);
+            bkindex = index;
+        }
+
+        Place(index, value);
+
+        if (CheckedBuild && square[wkindex] != WhiteKing)
+            throw ChessException("White King is missing");
+
+        if (CheckedBuild && square[bkindex] != BlackKing)
+            throw ChessException("Black King is missing");
+    }
+
+    void BitBoard::PushMove(Move move)
+    {
+        int source = BitIndex(move.Source());
+        int dest = BitIndex(move.Dest());
+        Square mover = square[source];
+        Square capture = square[dest];
+        if (CheckedBuild && SquareSide(mover) != (isWhiteTurn ? White : Black))
+            throw ChessException("PushMove: attempt to move the wrong side's piece");
+
+        if (mover == WhiteKing)
+            wkindex = dest;
+        else if (mover == BlackKing)
+            bkindex = dest;
+
+        unmoveStack.Push(Unmove(move, capture, mover));
+        bool promotion = (mover == WhitePawn || mover == BlackPawn) && (dest >= 56 || dest < 8);
+        Place(dest, promotion ? PromotedPiece(mover, move.Promotion()) : mover);
+        Place(source, Empty);
+        isWhiteTurn = !isWhiteTurn;
+    }
+
+    void BitBoard::PopMove()
+    {
+        isWhiteTurn = !isWhiteTurn;
+        const Unmove& unmove = unmoveStack.Pop();
+        int source = BitIndex(unmove.move.Source());
+        int dest = BitIndex(unmove.move.Dest());
+        Square mover = unmove.mover;
+        Place(source, mover);
+        Place(dest, unmove.capture);
+        if (mover == WhiteKing)
+            wkindex = source;
+        else if (mover == BlackKing)
+            bkindex = source;
+    }
+
+    bool BitBoard::IsAttacked(int index, bool byWhite, Bitmask occupied, Bitmask removed) const
+    {
+        // Is the square 'index' attacked by the given side, using 'occupied' for
+        // sliding piece blockers and ignoring any attacker on the 'removed' squares?
+        const int base = byWhite ? WhitePawn : BlackPawn;
+        const Bitmask keep = ~removed;
+
+        if (Tables.kingMask[index] & pieceMask[base + (WhiteKing - WhitePawn)] & keep)
+            return true;
+
+        if (Tables.knightMask[index] & pieceMask[base + (WhiteKnight - WhitePawn)] & keep)
+            return true;
+
+        if ((byWhite ? Tables.whitePawnFrom[index] : Tables.blackPawnFrom[index]) & pieceMask[base] & keep)
+            return true;
+
+        const Bitmask queens = pieceMask[base + (WhiteQueen - WhitePawn)];
+        const Bitmask straight = (pieceMask[base + (WhiteRook - WhitePawn)] | queens) & keep;
+        if (straight)
+            for (int d = 0; d < NumDirections; d += 2)
+                if (RayAttacks(d, index, occupied) & straight)
+                    return true;
+
+        const Bitmask diagonal = (pieceMask[base + (WhiteBishop - WhitePawn)] | queens) & keep;
+        if (diagonal)
+            for (int d = 1; d < NumDirections; d += 2)
+                if (RayAttacks(d, index, occupied) & diagonal)
+                    return true;
+
+        return false;
+    }
+
+    bool BitBoard::IsLegalPosition() const
+    {
+        // The player not having the turn must not be in check.
+        Bitmask occupied = whiteMask | blackMask;
+        return isWhiteTurn ? !IsAttacked(bkindex, true, occupied, 0) : !IsAttacked(wkindex, false, occupied, 0);
+    }
+
+    bool BitBoard::IsCurrentPlayerInCheck() const
+    {
+        Bitmask occupied = whiteMask | blackMask;
+        return isWhiteTurn ? IsAttacked(wkindex, false, occupied, 0) : IsAttacked(bkindex, true, occupied, 0);
+    }
+
+    void BitBoard::GenMoves(MoveList &movelist)
+    {
+        GenSideMoves(movelist, isWhiteTurn);
+    }
+
+    void BitBoard::GenUnmoves(MoveList &movelist)
+    {
+        // The player who just moved is the opposite of the player whose turn it is now.
+        GenSideUnmoves(movelist, !isWhiteTurn);
+    }
+
+    void BitBoard::TryMove(MoveList &movelist, bool white, int source, int dest) const
+    {
+        // Test legality without touching the board: the mover's King must not be
+        // attacked once the moving piece has left 'source' and any victim on 'dest' is gone.
+        Bitmask own = white ? whiteMask : blackMask;
+        if (own & Bit(dest))
+            return;
+
+        Bitmask occupied = ((whiteMask | blackMask) & ~Bit(source)) | Bit(dest);
+        int king = white ? wkindex : bkindex;
+        if (king == source)
+            king = dest;
+
+        if (!IsAttacked(king, !white, occupied, Bit(dest)))
+            movelist.Add(Move(BitOffset(source), BitOffset(dest)));
+    }
+
+    void BitBoard::TryPawnMove(MoveList &movelist, bool white, int source, int dest) const
+    {
+        // Add the Rook, Bishop, and Knight promotions after the Queen, as ChessBoard does.
+        int before = movelist.length;
+        TryMove(movelist, white, source, dest);
+        if (movelist.length > before && (dest >= 56 || dest < 8))
+            for (int kind = 1; kind < NumPromotions; ++kind)
+                movelist.Add(movelist.movelist[before].Promoted(kind));
+    }
+
+    void BitBoard::GenSideMoves(MoveList &movelist, bool white) const
+    {
+        // Visit squares in the same order as ChessBoard (a1, a2, ..., a8, b1, ...)
+        // and each piece's destinations in the same order, so both boards
+        // produce identical move lists.
+        movelist.length = 0;
+        const Bitmask own = white ? whiteMask : blackMask;
+        const Bitmask occupied = whiteMask | blackMask;
+        for (int file = 0; file < 8; ++file)
+        {
+            for (int rank = 0; rank < 8; ++rank)
+            {
+                int source = 8*rank + file;
+                if (!(own & Bit(source)))
+                    continue;
+
+                int first = 0, step = 1;
+                switch (square[source])
+                {
+                case WhiteKing:
+                case BlackKing:
+                    for (int d = 0; d < 8; ++d)
+                        if (Tables.kingTarget[source][d] >= 0)
+                            TryMove(movelist, white, source, Tables.kingTarget[source][d]);
+                    continue;
+
+                case WhiteKnight:
+                case BlackKnight:
+                    for (int d = 0; d < 8; ++d)
+                        if (Tables.knightTarget[source][d] >= 0)
+                            TryMove(movelist, white, source, Tables.knightTarget[source][d]);
+                    continue;
+
+                case WhiteQueen:
+                case BlackQueen:
+                    break;
+
+                case WhiteRook:
+                case BlackRook:
+                    step = 2;
+                    break;
+
+                case WhiteBishop:
+                case BlackBishop:
+                    first = 1;
+                    step = 2;
+                    break;
+
+                default:
+                {
+                    // Pawns: one or two squares ahead, then the capture toward the a-file, then toward the h-file.
+                    const int ahead = white ? 8 : -8;
+                    const Bitmask enemy = white ? blackMask : whiteMask;
+                    if (!(occupied & Bit(source + ahead)))
+                    {
+                        TryPawnMove(movelist, white, source, source + ahead);
+                        if (rank == (white ? 1 : 6) && !(occupied & Bit(source + 2*ahead)))
+                            TryPawnMove(movelist, white, source, source + 2*ahead);
+                    }
+                    if (file > 0 && (enemy & Bit(source + ahead - 1)))
+                        TryPawnMove(movelist, white, source, source + ahead - 1);
+                    if (file < 7 && (enemy & Bit(source + ahead + 1)))
+                        TryPawnMove(movelist, white, source, source + ahead + 1);
+                    continue;
+                }
+                }
+
+                for (int d = first; d < NumDirections; d += step)
+                {
+                    for (int k = 0; k < Tables.rayLength[d][source]; ++k)
+                    {
+                        int dest = Tables.rayTarget[d][source][k];
+                        TryMove(movelist, white, source, dest);
+                        if (occupied & Bit(dest))
+                            break;
+                    }
+                }
+            }
+        }
+    }
+
+    void BitBoard::TryUnmove(MoveList &movelist, bool white, int dest, int source)
+    {
+        // 'dest' is where the piece is now; 'source' is where it may have come from.
+        // The earlier position, with the mover to move, must not have the opponent in check.
+        // Only the opponent's King matters here, so the mover's King index can be left alone.
+        if (square[source] != Empty)
+            return;
+
+        Square mover = square[dest];
+        Place(source, mover);
+        Place(dest, Empty);
+        int king = white ? bkindex : wkindex;
+        bool legal = !IsAttacked(king, white, whiteMask | blackMask, 0);
+        Place(dest, mover);
+        Place(source, Empty);
+
+        if (legal)
+            movelist.Add(Move(BitOffset(source), BitOffset(dest)));
+    }
+
+    void BitBoard::GenSideUnmoves(MoveList &movelist, bool white)
+    {
+        // Find every quiet move by the given side that could have led to this position.
+        movelist.length = 0;
+        const Bitmask own = white ? whiteMask : blackMask;
+        for (int file = 0; file < 8; ++file)
+        {
+            for (int rank = 0; rank < 8; ++rank)
+            {
+                int dest = 8*rank + file;
+                if (!(own & Bit(dest)))
+                    continue;
+
+                int first = 0, step = 1;
+                switch (square[dest])
+                {
+                case WhiteKing:
+                case BlackKing:
+                    for (int d = 0; d < 8; ++d)
+                        if (Tables.kingTarget[dest][d] >= 0)
+                            TryUnmove(movelist, white, dest, Tables.kingTarget[dest][d]);
+                    continue;
+
+                case WhiteKnight:
+                case BlackKnight:
+                    for (int d = 0; d < 8; ++d)
+                        if (Tables.knightTarget[dest][d] >= 0)
+                            TryUnmove(movelist, white, dest, Tables.knightTarget[dest][d]);
+                    continue;
+
+                case WhiteQueen:
+                case BlackQueen:
+                    break;
+
+                case WhiteRook:
+                case BlackRook:
+                    step = 2;
+                    break;
+
+                case WhiteBishop:
+                case BlackBishop:
+                    first = 1;
+                    step = 2;
+                    break;
+
+                default:
+                {
+                    // Pawns only move forward, and never from their own first rank.
+                    // Promotions are not retracted: the piece they made belongs to another table.
+                    const int behind = white ? -8 : 8;
+                    const int advanced = white ? rank - 1 : 6 - rank;     // ranks beyond the starting rank
+                    if (advanced >= 1)
+                        TryUnmove(movelist, white, dest, dest + behind);
+                    if (advanced == 2 && square[dest + behind] == Empty)
+                        TryUnmove(movelist, white, dest, dest + 2*behind);
+                    continue;
+                }
+                }
+
+                // Sliding pieces move symmetrically, so a piece could have arrived
+                // from any empty square along the ray.
+                for (int d = first; d < NumDirections; d += step)
+                {
+                    for (int k = 0; k < Tables.rayLength[d][dest]; ++k)
+                    {
+                        int source = Tables.rayTarget[d][dest][k];
+                        if (square[source] != Empty)
+                            break;
+                        TryUnmove(movelist, white, dest, source);
+                    }
+                }
+            }
+        }
+    }
+}
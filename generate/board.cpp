@@ -1,3 +1,4 @@
+#include <cstring>
 #include "chess.h"
 
 namespace CosineKitty
@@ -11,12 +12,12 @@ namespace CosineKitty
         square[wkpos = Offset('e', '1')] = WhiteKing;
         square[bkpos = Offset('e', '8')] = BlackKing;
         isWhiteTurn = whiteToMove;
-        unmoveStack = std::stack<Unmove>();
+        unmoveStack.Clear();
     }
 
     Square ChessBoard::GetSquare(int offset) const
     {
-        if (offset < 0 || offset >= 120 || square[offset] == OffBoard)
+        if (CheckedBuild && (offset < 0 || offset >= 120 || square[offset] == OffBoard))
             throw ChessException("ChessBoard::GetSquare: invalid offset");
 
         return square[offset];
@@ -25,77 +26,371 @@ namespace CosineKitty
     void ChessBoard::SetSquare(int offset, Square value)
     {
         ValidateOffset(offset);
-        if (SquareSide(value) == Invalid)
+        if (CheckedBuild && SquareSide(value) == Invalid)
             throw ChessException("SetSquare: invalid square value");
 
+        // There must be exactly one King of each color on the board.
+        // Putting a King on the other King's square swaps them, so the Kings can be placed in either order.
         if (value == WhiteKing)
         {
-            // There must be exactly one White King on the board.
-            square[wkpos] = Empty;
+            if (offset == bkpos)
+                square[bkpos = wkpos] = BlackKing;
+            else
+                square[wkpos] = Empty;
             wkpos = offset;
         }
         else if (value == BlackKing)
         {
-            // There must be exactly one Black King on the board.
-            square[bkpos] = Empty;
+            if (offset == wkpos)
+                square[wkpos = bkpos] = WhiteKing;
+            else
+                square[bkpos] = Empty;
             bkpos = offset;
         }
 
         square[offset] = value;
 
-        if (square[wkpos] != WhiteKing)
+        if (CheckedBuild && square[wkpos] != WhiteKing)
             throw ChessException("White King is missing");
 
-        if (square[bkpos] != BlackKing)
+        if (CheckedBuild && square[bkpos] != BlackKing)
             throw ChessException("Black King is missing");
     }
 
+    void ChessBoard::LoadFen(const char *fen)
+    {
+        // Only the piece placement and side-to-move fields matter here.
+        // Castling rights, en passant, and move counters are ignored if present.
+        // This does not allocate memory, so it is cheap enough to call per query.
+        Square board[120];
+        for (int i = 0; i < 120; ++i)
+            board[i] = (square[i] == OffBoard) ? OffBoard : Empty;
+
+        int wk = -1, bk = -1;
+        int y = 9, x = 1;
+        const char *p = fen;
+        for (; *p != '\0' && *p != ' '; ++p)
+        {
+            if (*p == '/')
+            {
+                if (x != 9 || y == 2)
+                    throw ChessException("LoadFen: wrong number of squares in a row");
+                --y;
+                x = 1;
+            }
+            else if (*p >= '1' && *p <= '8')
+            {
+                x += *p - '0';
+                if (x > 9)
+                    throw ChessException("LoadFen: too many squares in a row");
+            }
+            else
+            {
+                Square piece;
+                switch (*p)
+                {
+                case 'P':   piece = WhitePawn;      break;
+                case 'N':   piece = WhiteKnight;    break;
+                case 'B':   piece = WhiteBishop;    break;
+                case 'R':   piece = WhiteRook;      break;
+                case 'Q':   piece = WhiteQueen;     break;
+                case 'K':   piece = WhiteKing;      break;
+                case 'p':   piece = BlackPawn;      break;
+                case 'n':   piece = BlackKnight;    break;
+                case 'b':   piece = BlackBishop;    break;
+                case 'r':   piece = BlackRook;      break;
+                case 'q':   piece = BlackQueen;     break;
+                case 'k':   piece = BlackKing;      break;
+                default:
+                    throw ChessException("LoadFen: invalid character in board");
+                }
+
+                if (x > 8)
+                    throw ChessException("LoadFen: too many squares in a row");
+
+                int offset = 10*y + x;
+                if (piece == WhiteKing)
+                {
+                    if (wk >= 0)
+                        throw ChessException("LoadFen: more than one White King");
+                    wk = offset;
+                }
+                else if (piece == BlackKing)
+                {
+                    if (bk >= 0)
+                        throw ChessException("LoadFen: more than one Black King");
+                    bk = offset;
+                }
+                board[offset] = piece;
+                ++x;
+            }
+        }
+
+        if (x != 9 || y != 2)
+            throw ChessException("LoadFen: board must have 8 complete rows");
+
+        if (wk < 0 || bk < 0)
+            throw ChessException("LoadFen: both Kings must be on the board");
+
+        bool whiteToMove;
+        while (*p == ' ')
+            ++p;
+        if (*p == 'w')
+            whiteToMove = true;
+        else if (*p == 'b')
+            whiteToMove = false;
+        else
+            throw ChessException("LoadFen: side to move must be 'w' or 'b'");
+
+        for (int i = 0; i < 120; ++i)
+            square[i] = board[i];
+        wkpos = wk;
+        bkpos = bk;
+        isWhiteTurn = whiteToMove;
+        unmoveStack.Clear();
+    }
+
     void ChessBoard::PushMove(Move move)
     {
-        Square mover = square[move.source];
-        Square capture = square[move.dest];
+        const int source = move.Source();
+        const int dest = move.Dest();
+        Square mover = square[source];
+        Square capture = square[dest];
         if (isWhiteTurn)
         {
-            if (SquareSide(mover) != White)
+            if (CheckedBuild && SquareSide(mover) != White)
                 throw ChessException("PushMove: attempt to move non-White piece");
             if (mover == WhiteKing)
-                wkpos = move.dest;
+                wkpos = dest;
         }
         else
         {
-            if (SquareSide(mover) != Black)
+            if (CheckedBuild && SquareSide(mover) != Black)
                 throw ChessException("PushMove: attempt to move non-Black piece");
             if (mover == BlackKing)
-                bkpos = move.dest;
+                bkpos = dest;
         }
-        unmoveStack.push(Unmove(move, capture));
-        square[move.dest] = mover;
-        square[move.source] = Empty;
+        unmoveStack.Push(Unmove(move, capture, mover));
+        square[dest] = mover;
+        if ((mover == WhitePawn || mover == BlackPawn) && (dest > 90 || dest < 30))
+            square[dest] = PromotedPiece(mover, move.Promotion());
+        square[source] = Empty;
         isWhiteTurn = !isWhiteTurn;
     }
 
     void ChessBoard::PopMove()
     {
-        if (unmoveStack.empty())
-            throw ChessException("PopMove: unmove stack is empty.");
-
         isWhiteTurn = !isWhiteTurn;
-        Unmove unmove = unmoveStack.top();
-        unmoveStack.pop();
-        square[unmove.move.source] = square[unmove.move.dest];
-        square[unmove.move.dest] = unmove.capture;
-        if (square[unmove.move.source] == WhiteKing)
-            wkpos = unmove.move.source;
-        else if (square[unmove.move.source] == BlackKing)
-            bkpos = unmove.move.source;
+        const Unmove& unmove = unmoveStack.Pop();
+        const int source = unmove.move.Source();
+        square[source] = unmove.mover;
+        square[unmove.move.Dest()] = unmove.capture;
+        if (unmove.mover == WhiteKing)
+            wkpos = source;
+        else if (unmove.mover == BlackKing)
+            bkpos = source;
     }
 
     void ChessBoard::GenMoves(MoveList &movelist)
     {
+        // Find the checks and pins once, so that each move can be judged without making it.
+        CheckInfo check;
+        FindChecks(check);
         if (isWhiteTurn)
-            GenWhiteMoves(movelist);
+            GenWhiteMoves(movelist, check);
         else
-            GenBlackMoves(movelist);
+            GenBlackMoves(movelist, check);
+    }
+
+    void ChessBoard::GenMovesByTrial(MoveList &movelist)
+    {
+        // The original generator, which makes each move to see whether it leaves the mover in check.
+        // It finds the same moves in the same order, and is kept as a reference for GenMoves.
+        CheckInfo check;
+        check.trial = true;
+        if (isWhiteTurn)
+            GenWhiteMoves(movelist, check);
+        else
+            GenBlackMoves(movelist, check);
+    }
+
+    void ChessBoard::FindChecks(CheckInfo& check) const
+    {
+        // Look out from the King of the side to move along every line.
+        // The first piece met on a line either gives check, if it is an enemy piece that moves
+        // along that line, or, if it is a friendly piece with such an enemy piece behind it, is pinned.
+        const bool white = isWhiteTurn;
+        const int king = white ? wkpos : bkpos;
+        const Side friendly = white ? White : Black;
+        const Square queen  = white ? BlackQueen  : WhiteQueen;
+        const Square rook   = white ? BlackRook   : WhiteRook;
+        const Square bishop = white ? BlackBishop : WhiteBishop;
+        const Square knight = white ? BlackKnight : WhiteKnight;
+        const Square pawn   = white ? BlackPawn   : WhitePawn;
+
+        check.trial = false;
+        check.checkers = 0;
+        check.checker = 0;
+        check.checkDir = 0;
+        check.npinned = 0;
+
+        static const int lineDirs[8] = { North, East, South, West, NorthEast, SouthEast, SouthWest, NorthWest };
+        for (int k = 0; k < 8; ++k)
+        {
+            const int dir = lineDirs[k];
+            const Square slider = (k < 4) ? rook : bishop;
+            int first = king + dir;
+            while (square[first] == Empty)
+                first += dir;
+
+            if (square[first] == slider || square[first] == queen)
+            {
+                AddChecker(check, first, dir);
+            }
+            else if (SquareSide(square[first]) == friendly)
+            {
+                int behind = first + dir;
+                while (square[behind] == Empty)
+                    behind += dir;
+
+                if (square[behind] == slider || square[behind] == queen)
+                {
+                    check.pinned[check.npinned] = first;
+                    check.pinner[check.npinned] = behind;
+                    check.pinDir[check.npinned] = dir;
+                    ++check.npinned;
+                }
+            }
+        }
+
+        static const int knightDirs[8] = { KnightDir1, KnightDir2, KnightDir3, KnightDir4, KnightDir5, KnightDir6, KnightDir7, KnightDir8 };
+        for (int dir : knightDirs)
+            if (square[king + dir] == knight)
+                AddChecker(check, king + dir, 0);
+
+        // A pawn attacks the King from one of the two squares diagonally in front of the King, from White's view.
+        const int pawnLeft  = white ? NorthWest : SouthWest;
+        const int pawnRight = white ? NorthEast : SouthEast;
+        if (square[king + pawnLeft] == pawn)
+            AddChecker(check, king + pawnLeft, 0);
+        if (square[king + pawnRight] == pawn)
+            AddChecker(check, king + pawnRight, 0);
+
+        // Mark every square the enemy attacks, so a King move needs only a lookup.
+        // Sliding attacks go through the King's own square, because the King
+        // cannot escape a check by stepping back along the line it comes from.
+        static const int kingDirs[8] = { North, NorthEast, East, SouthEast, South, SouthWest, West, NorthWest };
+        memset(check.attacked, 0, sizeof(check.attacked));
+        for (int y = 2; y <= 9; ++y)
+        {
+            for (int x = 1; x <= 8; ++x)
+            {
+                const int source = 10*y + x;
+                if (SquareSide(square[source]) == friendly || square[source] == Empty)
+                    continue;
+
+                int first = 0, step = 1;
+                switch (white ? static_cast<Square>(square[source] - (BlackPawn - WhitePawn)) : square[source])
+                {
+                case WhiteKing:
+                    for (int dir : kingDirs)
+                        check.attacked[source + dir] = true;
+                    continue;
+
+                case WhiteKnight:
+                    for (int dir : knightDirs)
+                        check.attacked[source + dir] = true;
+                    continue;
+
+                case WhitePawn:
+                    check.attacked[source + (white ? SouthWest : NorthWest)] = true;
+                    check.attacked[source + (white ? SouthEast : NorthEast)] = true;
+                    continue;
+
+                case WhiteQueen:
+                    break;
+
+                case WhiteRook:
+                    step = 2;
+                    break;
+
+                case WhiteBishop:
+                    first = 1;
+                    step = 2;
+                    break;
+
+                default:
+                    continue;
+                }
+
+                for (int k = first; k < 8; k += step)
+                {
+                    int dest = source + kingDirs[k];
+                    for (; square[dest] == Empty || dest == king; dest += kingDirs[k])
+                        check.attacked[dest] = true;
+                    check.attacked[dest] = true;
+                }
+            }
+        }
+    }
+
+    void ChessBoard::AddChecker(CheckInfo& check, int offset, int dir)
+    {
+        if (check.checkers++ == 0)
+        {
+            check.checker = offset;
+            check.checkDir = dir;
+        }
+    }
+
+    bool ChessBoard::IsBetween(int from, int dir, int to, int offset)
+    {
+        // Is 'offset' strictly between 'from' and 'to', which lie along 'dir' from each other?
+        if (dir != 0)
+            for (int s = from + dir; s != to; s += dir)
+                if (s == offset)
+                    return true;
+
+        return false;
+    }
+
+    bool ChessBoard::IsLegalMove(const CheckInfo& check, int source, int dest)
+    {
+        const bool white = (SquareSide(square[source]) == White);
+        if (check.trial)
+        {
+            // Try making the move and see if it places the mover's king in check.
+            PushMove(Move(source, dest));
+            bool self_check = white ? IsAttackedByBlack(wkpos) : IsAttackedByWhite(bkpos);
+            PopMove();
+            return !self_check;
+        }
+
+        const int king = white ? wkpos : bkpos;
+        if (source == king)
+            return !check.attacked[dest];
+
+        // Any other piece must capture or block a lone checker, and cannot leave the line it is pinned on.
+        if (check.checkers > 1)
+            return false;
+
+        if (check.checkers == 1 && dest != check.checker && !IsBetween(king, check.checkDir, check.checker, dest))
+            return false;
+
+        for (int i = 0; i < check.npinned; ++i)
+            if (check.pinned[i] == source)
+                return dest == check.pinner[i] || IsBetween(king, check.pinDir[i], check.pinner[i], dest);
+
+        return true;
+    }
+
+    void ChessBoard::GenUnmoves(MoveList &movelist)
+    {
+        // The player who just moved is the opposite of the player whose turn it is now.
+        if (isWhiteTurn)
+            GenBlackUnmoves(movelist);
+        else
+            GenWhiteUnmoves(movelist);
     }
 
     bool ChessBoard::IsCurrentPlayerInCheck() const
@@ -103,7 +398,7 @@ namespace CosineKitty
         return isWhiteTurn ? IsAttackedByBlack(wkpos) : IsAttackedByWhite(bkpos);
     }
 
-    void ChessBoard::GenWhiteMoves(MoveList &movelist)
+    void ChessBoard::GenWhiteMoves(MoveList &movelist, const CheckInfo& check)
     {
         movelist.length = 0;
         for (char file='a'; file <= 'h'; ++file)
@@ -114,54 +409,65 @@ namespace CosineKitty
                 switch (square[source])
                 {
                 case WhiteKing:
-                    TryWhiteMove(movelist, source, source + North);
-                    TryWhiteMove(movelist, source, source + NorthEast);
-                    TryWhiteMove(movelist, source, source + East);
-                    TryWhiteMove(movelist, source, source + SouthEast);
-                    TryWhiteMove(movelist, source, source + South);
-                    TryWhiteMove(movelist, source, source + SouthWest);
-                    TryWhiteMove(movelist, source, source + West);
-                    TryWhiteMove(movelist, source, source + NorthWest);
+                    TryWhiteMove(movelist, check, source, source + North);
+                    TryWhiteMove(movelist, check, source, source + NorthEast);
+                    TryWhiteMove(movelist, check, source, source + East);
+                    TryWhiteMove(movelist, check, source, source + SouthEast);
+                    TryWhiteMove(movelist, check, source, source + South);
+                    TryWhiteMove(movelist, check, source, source + SouthWest);
+                    TryWhiteMove(movelist, check, source, source + West);
+                    TryWhiteMove(movelist, check, source, source + NorthWest);
                     break;
 
                 case WhiteQueen:
-                    TryWhiteRay(movelist, source, North);
-                    TryWhiteRay(movelist, source, NorthEast);
-                    TryWhiteRay(movelist, source, East);
-                    TryWhiteRay(movelist, source, SouthEast);
-                    TryWhiteRay(movelist, source, South);
-                    TryWhiteRay(movelist, source, SouthWest);
-                    TryWhiteRay(movelist, source, West);
-                    TryWhiteRay(movelist, source, NorthWest);
+                    TryWhiteRay(movelist, check, source, North);
+                    TryWhiteRay(movelist, check, source, NorthEast);
+                    TryWhiteRay(movelist, check, source, East);
+                    TryWhiteRay(movelist, check, source, SouthEast);
+                    TryWhiteRay(movelist, check, source, South);
+                    TryWhiteRay(movelist, check, source, SouthWest);
+                    TryWhiteRay(movelist, check, source, West);
+                    TryWhiteRay(movelist, check, source, NorthWest);
                     break;
 
                 case WhiteRook:
-                    TryWhiteRay(movelist, source, North);
-                    TryWhiteRay(movelist, source, East);
-                    TryWhiteRay(movelist, source, South);
-                    TryWhiteRay(movelist, source, West);
+                    TryWhiteRay(movelist, check, source, North);
+                    TryWhiteRay(movelist, check, source, East);
+                    TryWhiteRay(movelist, check, source, South);
+                    TryWhiteRay(movelist, check, source, West);
                     break;
 
                 case WhiteBishop:
-                    TryWhiteRay(movelist, source, NorthEast);
-                    TryWhiteRay(movelist, source, SouthEast);
-                    TryWhiteRay(movelist, source, SouthWest);
-                    TryWhiteRay(movelist, source, NorthWest);
+                    TryWhiteRay(movelist, check, source, NorthEast);
+                    TryWhiteRay(movelist, check, source, SouthEast);
+                    TryWhiteRay(movelist, check, source, SouthWest);
+                    TryWhiteRay(movelist, check, source, NorthWest);
                     break;
 
                 case WhiteKnight:
-                    TryWhiteMove(movelist, source, source + KnightDir1);
-                    TryWhiteMove(movelist, source, source + KnightDir2);
-                    TryWhiteMove(movelist, source, source + KnightDir3);
-                    TryWhiteMove(movelist, source, source + KnightDir4);
-                    TryWhiteMove(movelist, source, source + KnightDir5);
-                    TryWhiteMove(movelist, source, source + KnightDir6);
-                    TryWhiteMove(movelist, source, source + KnightDir7);
-                    TryWhiteMove(movelist, source, source + KnightDir8);
+                    TryWhiteMove(movelist, check, source, source + KnightDir1);
+                    TryWhiteMove(movelist, check, source, source + KnightDir2);
+                    TryWhiteMove(movelist, check, source, source + KnightDir3);
+                    TryWhiteMove(movelist, check, source, source + KnightDir4);
+                    TryWhiteMove(movelist, check, source, source + KnightDir5);
+                    TryWhiteMove(movelist, check, source, source + KnightDir6);
+                    TryWhiteMove(movelist, check, source, source + KnightDir7);
+                    TryWhiteMove(movelist, check, source, source + KnightDir8);
                     break;
 
                 case WhitePawn:
-                    throw ChessException("Pawn movement not yet implemented.");
+                    // There is no en passant: Black never has a pawn that could have just moved two squares.
+                    if (square[source + North] == Empty)
+                    {
+                        TryPawnMove(movelist, check, source, source + North);
+                        if (rank == '2' && square[source + 2*North] == Empty)
+                            TryPawnMove(movelist, check, source, source + 2*North);
+                    }
+                    if (SquareSide(square[source + NorthWest]) == Black)
+                        TryPawnMove(movelist, check, source, source + NorthWest);
+                    if (SquareSide(square[source + NorthEast]) == Black)
+                        TryPawnMove(movelist, check, source, source + NorthEast);
+                    break;
 
                 default:
                     break;  // ignore anything but White's pieces.
@@ -170,7 +476,7 @@ namespace CosineKitty
         }
     }
 
-    void ChessBoard::GenBlackMoves(MoveList &movelist)
+    void ChessBoard::GenBlackMoves(MoveList &movelist, const CheckInfo& check)
     {
         movelist.length = 0;
         for (char file='a'; file <= 'h'; ++file)
@@ -181,54 +487,64 @@ namespace CosineKitty
                 switch (square[source])
                 {
                 case BlackKing:
-                    TryBlackMove(movelist, source, source + North);
-                    TryBlackMove(movelist, source, source + NorthEast);
-                    TryBlackMove(movelist, source, source + East);
-                    TryBlackMove(movelist, source, source + SouthEast);
-                    TryBlackMove(movelist, source, source + South);
-                    TryBlackMove(movelist, source, source + SouthWest);
-                    TryBlackMove(movelist, source, source + West);
-                    TryBlackMove(movelist, source, source + NorthWest);
+                    TryBlackMove(movelist, check, source, source + North);
+                    TryBlackMove(movelist, check, source, source + NorthEast);
+                    TryBlackMove(movelist, check, source, source + East);
+                    TryBlackMove(movelist, check, source, source + SouthEast);
+                    TryBlackMove(movelist, check, source, source + South);
+                    TryBlackMove(movelist, check, source, source + SouthWest);
+                    TryBlackMove(movelist, check, source, source + West);
+                    TryBlackMove(movelist, check, source, source + NorthWest);
                     break;
 
                 case BlackQueen:
-                    TryBlackRay(movelist, source, North);
-                    TryBlackRay(movelist, source, NorthEast);
-                    TryBlackRay(movelist, source, East);
-                    TryBlackRay(movelist, source, SouthEast);
-                    TryBlackRay(movelist, source, South);
-                    TryBlackRay(movelist, source, SouthWest);
-                    TryBlackRay(movelist, source, West);
-                    TryBlackRay(movelist, source, NorthWest);
+                    TryBlackRay(movelist, check, source, North);
+                    TryBlackRay(movelist, check, source, NorthEast);
+                    TryBlackRay(movelist, check, source, East);
+                    TryBlackRay(movelist, check, source, SouthEast);
+                    TryBlackRay(movelist, check, source, South);
+                    TryBlackRay(movelist, check, source, SouthWest);
+                    TryBlackRay(movelist, check, source, West);
+                    TryBlackRay(movelist, check, source, NorthWest);
                     break;
 
                 case BlackRook:
-                    TryBlackRay(movelist, source, North);
-                    TryBlackRay(movelist, source, East);
-                    TryBlackRay(movelist, source, South);
-                    TryBlackRay(movelist, source, West);
+                    TryBlackRay(movelist, check, source, North);
+                    TryBlackRay(movelist, check, source, East);
+                    TryBlackRay(movelist, check, source, South);
+                    TryBlackRay(movelist, check, source, West);
                     break;
 
                 case BlackBishop:
-                    TryBlackRay(movelist, source, NorthEast);
-                    TryBlackRay(movelist, source, SouthEast);
-                    TryBlackRay(movelist, source, SouthWest);
-                    TryBlackRay(movelist, source, NorthWest);
+                    TryBlackRay(movelist, check, source, NorthEast);
+                    TryBlackRay(movelist, check, source, SouthEast);
+                    TryBlackRay(movelist, check, source, SouthWest);
+                    TryBlackRay(movelist, check, source, NorthWest);
                     break;
 
                 case BlackKnight:
-                    TryBlackMove(movelist, source, source + KnightDir1);
-                    TryBlackMove(movelist, source, source + KnightDir2);
-                    TryBlackMove(movelist, source, source + KnightDir3);
-                    TryBlackMove(movelist, source, source + KnightDir4);
-                    TryBlackMove(movelist, source, source + KnightDir5);
-                    TryBlackMove(movelist, source, source + KnightDir6);
-                    TryBlackMove(movelist, source, source + KnightDir7);
-                    TryBlackMove(movelist, source, source + KnightDir8);
+                    TryBlackMove(movelist, check, source, source + KnightDir1);
+                    TryBlackMove(movelist, check, source, source + KnightDir2);
+                    TryBlackMove(movelist, check, source, source + KnightDir3);
+                    TryBlackMove(movelist, check, source, source + KnightDir4);
+                    TryBlackMove(movelist, check, source, source + KnightDir5);
+                    TryBlackMove(movelist, check, source, source + KnightDir6);
+                    TryBlackMove(movelist, check, source, source + KnightDir7);
+                    TryBlackMove(movelist, check, source, source + KnightDir8);
                     break;
 
                 case BlackPawn:
-                    throw ChessException("Pawn movement not yet implemented.");
+                    if (square[source + South] == Empty)
+                    {
+                        TryPawnMove(movelist, check, source, source + South);
+                        if (rank == '7' && square[source + 2*South] == Empty)
+                            TryPawnMove(movelist, check, source, source + 2*South);
+                    }
+                    if (SquareSide(square[source + SouthWest]) == White)
+                        TryPawnMove(movelist, check, source, source + SouthWest);
+                    if (SquareSide(square[source + SouthEast]) == White)
+                        TryPawnMove(movelist, check, source, source + SouthEast);
+                    break;
 
                 default:
                     break;  // ignore anything but Black's pieces.
@@ -237,64 +553,272 @@ namespace CosineKitty
         }
     }
 
-    void ChessBoard::TryWhiteMove(MoveList& movelist, int source, int dest)
+    void ChessBoard::GenWhiteUnmoves(MoveList &movelist)
+    {
+        // Find every quiet White move that could have led to this position.
+        // Captures are never retracted: Black has nothing left but its King.
+        movelist.length = 0;
+        for (char file='a'; file <= 'h'; ++file)
+        {
+            for (char rank='1'; rank <= '8'; ++rank)
+            {
+                int dest = Offset(file, rank);
+                switch (square[dest])
+                {
+                case WhiteKing:
+                    TryWhiteUnmove(movelist, dest, dest + North);
+                    TryWhiteUnmove(movelist, dest, dest + NorthEast);
+                    TryWhiteUnmove(movelist, dest, dest + East);
+                    TryWhiteUnmove(movelist, dest, dest + SouthEast);
+                    TryWhiteUnmove(movelist, dest, dest + South);
+                    TryWhiteUnmove(movelist, dest, dest + SouthWest);
+                    TryWhiteUnmove(movelist, dest, dest + West);
+                    TryWhiteUnmove(movelist, dest, dest + NorthWest);
+                    break;
+
+                case WhiteQueen:
+                    TryWhiteUnray(movelist, dest, North);
+                    TryWhiteUnray(movelist, dest, NorthEast);
+                    TryWhiteUnray(movelist, dest, East);
+                    TryWhiteUnray(movelist, dest, SouthEast);
+                    TryWhiteUnray(movelist, dest, South);
+                    TryWhiteUnray(movelist, dest, SouthWest);
+                    TryWhiteUnray(movelist, dest, West);
+                    TryWhiteUnray(movelist, dest, NorthWest);
+                    break;
+
+                case WhiteRook:
+                    TryWhiteUnray(movelist, dest, North);
+                    TryWhiteUnray(movelist, dest, East);
+                    TryWhiteUnray(movelist, dest, South);
+                    TryWhiteUnray(movelist, dest, West);
+                    break;
+
+                case WhiteBishop:
+                    TryWhiteUnray(movelist, dest, NorthEast);
+                    TryWhiteUnray(movelist, dest, SouthEast);
+                    TryWhiteUnray(movelist, dest, SouthWest);
+                    TryWhiteUnray(movelist, dest, NorthWest);
+                    break;
+
+                case WhiteKnight:
+                    TryWhiteUnmove(movelist, dest, dest + KnightDir1);
+                    TryWhiteUnmove(movelist, dest, dest + KnightDir2);
+                    TryWhiteUnmove(movelist, dest, dest + KnightDir3);
+                    TryWhiteUnmove(movelist, dest, dest + KnightDir4);
+                    TryWhiteUnmove(movelist, dest, dest + KnightDir5);
+                    TryWhiteUnmove(movelist, dest, dest + KnightDir6);
+                    TryWhiteUnmove(movelist, dest, dest + KnightDir7);
+                    TryWhiteUnmove(movelist, dest, dest + KnightDir8);
+                    break;
+
+                case WhitePawn:
+                    // Pawns only move forward, and never from the first rank.
+                    // Promotions are not retracted: the piece they made belongs to another table.
+                    if (rank >= '3')
+                        TryWhiteUnmove(movelist, dest, dest + South);
+                    if (rank == '4' && square[dest + South] == Empty)
+                        TryWhiteUnmove(movelist, dest, dest + 2*South);
+                    break;
+
+                default:
+                    break;  // ignore anything but White's pieces.
+                }
+            }
+        }
+    }
+
+    void ChessBoard::GenBlackUnmoves(MoveList &movelist)
+    {
+        // Find every quiet Black move that could have led to this position.
+        movelist.length = 0;
+        for (char file='a'; file <= 'h'; ++file)
+        {
+            for (char rank='1'; rank <= '8'; ++rank)
+            {
+                int dest = Offset(file, rank);
+                switch (square[dest])
+                {
+                case BlackKing:
+                    TryBlackUnmove(movelist, dest, dest + North);
+                    TryBlackUnmove(movelist, dest, dest + NorthEast);
+                    TryBlackUnmove(movelist, dest, dest + East);
+                    TryBlackUnmove(movelist, dest, dest + SouthEast);
+                    TryBlackUnmove(movelist, dest, dest + South);
+                    TryBlackUnmove(movelist, dest, dest + SouthWest);
+                    TryBlackUnmove(movelist, dest, dest + West);
+                    TryBlackUnmove(movelist, dest, dest + NorthWest);
+                    break;
+
+                case BlackQueen:
+                    TryBlackUnray(movelist, dest, North);
+                    TryBlackUnray(movelist, dest, NorthEast);
+                    TryBlackUnray(movelist, dest, East);
+                    TryBlackUnray(movelist, dest, SouthEast);
+                    TryBlackUnray(movelist, dest, South);
+                    TryBlackUnray(movelist, dest, SouthWest);
+                    TryBlackUnray(movelist, dest, West);
+                    TryBlackUnray(movelist, dest, NorthWest);
+                    break;
+
+                case BlackRook:
+                    TryBlackUnray(movelist, dest, North);
+                    TryBlackUnray(movelist, dest, East);
+                    TryBlackUnray(movelist, dest, South);
+                    TryBlackUnray(movelist, dest, West);
+                    break;
+
+                case BlackBishop:
+                    TryBlackUnray(movelist, dest, NorthEast);
+                    TryBlackUnray(movelist, dest, SouthEast);
+                    TryBlackUnray(movelist, dest, SouthWest);
+                    TryBlackUnray(movelist, dest, NorthWest);
+                    break;
+
+                case BlackKnight:
+                    TryBlackUnmove(movelist, dest, dest + KnightDir1);
+                    TryBlackUnmove(movelist, dest, dest + KnightDir2);
+                    TryBlackUnmove(movelist, dest, dest + KnightDir3);
+                    TryBlackUnmove(movelist, dest, dest + KnightDir4);
+                    TryBlackUnmove(movelist, dest, dest + KnightDir5);
+                    TryBlackUnmove(movelist, dest, dest + KnightDir6);
+                    TryBlackUnmove(movelist, dest, dest + KnightDir7);
+                    TryBlackUnmove(movelist, dest, dest + KnightDir8);
+                    break;
+
+                case BlackPawn:
+                    if (rank <= '6')
+                        TryBlackUnmove(movelist, dest, dest + North);
+                    if (rank == '5' && square[dest + North] == Empty)
+                        TryBlackUnmove(movelist, dest, dest + 2*North);
+                    break;
+
+                default:
+                    break;  // ignore anything but Black's pieces.
+                }
+            }
+        }
+    }
+
+    void ChessBoard::TryWhiteUnmove(MoveList& movelist, int dest, int source)
+    {
+        // 'dest' is where the White piece is now; 'source' is where it may have come from.
+        if (square[source] == Empty)
+        {
+            // Put the piece back where it came from, and confirm that White
+            // was not giving check with Black to move... which would mean
+            // it was really White's turn to move in the earlier position.
+            Square mover = square[dest];
+            square[source] = mover;
+            square[dest] = Empty;
+            if (mover == WhiteKing)
+                wkpos = source;
+
+            bool legal = !IsAttackedByWhite(bkpos);
+
+            square[dest] = mover;
+            square[source] = Empty;
+            if (mover == WhiteKing)
+                wkpos = dest;
+
+            if (legal)
+                movelist.Add(Move(source, dest));
+        }
+    }
+
+    void ChessBoard::TryBlackUnmove(MoveList& movelist, int dest, int source)
+    {
+        // 'dest' is where the Black piece is now; 'source' is where it may have come from.
+        if (square[source] == Empty)
+        {
+            Square mover = square[dest];
+            square[source] = mover;
+            square[dest] = Empty;
+            if (mover == BlackKing)
+                bkpos = source;
+
+            bool legal = !IsAttackedByBlack(wkpos);
+
+            square[dest] = mover;
+            square[source] = Empty;
+            if (mover == BlackKing)
+                bkpos = dest;
+
+            if (legal)
+                movelist.Add(Move(source, dest));
+        }
+    }
+
+    void ChessBoard::TryWhiteUnray(MoveList &movelist, int dest, int dir)
+    {
+        // Sliding pieces move symmetrically, so a piece could have arrived
+        // from any empty square along the ray.
+        for (int source = dest + dir; square[source] == Empty; source += dir)
+            TryWhiteUnmove(movelist, dest, source);
+    }
+
+    void ChessBoard::TryBlackUnray(MoveList &movelist, int dest, int dir)
+    {
+        for (int source = dest + dir; square[source] == Empty; source += dir)
+            TryBlackUnmove(movelist, dest, source);
+    }
+
+    void ChessBoard::TryWhiteMove(MoveList& movelist, const CheckInfo& check, int source, int dest)
     {
         Side mover = SquareSide(square[source]);
-        if (mover != White)
+        if (CheckedBuild && mover != White)
             throw ChessException("TryWhiteMove: Attempt to move non-White piece.");
 
         Side capture = SquareSide(square[dest]);
-        if (capture == Nobody || capture == Black)
-        {
-            // Determine whether the move is legal.
-            // Try making the move and see if it places the mover's king in check.
-            Move move(source, dest);
-            PushMove(move);
-            bool self_check = IsAttackedByBlack(wkpos);
-            PopMove();
-            if (!self_check)
-                movelist.Add(move);
-        }
+        if ((capture == Nobody || capture == Black) && IsLegalMove(check, source, dest))
+            movelist.Add(Move(source, dest));
     }
 
-    void ChessBoard::TryBlackMove(MoveList& movelist, int source, int dest)
+    void ChessBoard::TryBlackMove(MoveList& movelist, const CheckInfo& check, int source, int dest)
     {
         Side mover = SquareSide(square[source]);
-        if (mover != Black)
+        if (CheckedBuild && mover != Black)
             throw ChessException("TryBlackMove: Attempt to move non-Black piece.");
 
         Side capture = SquareSide(square[dest]);
-        if (capture == Nobody || capture == White)
-        {
-            // Determine whether the move is legal.
-            // Try making the move and see if it places the mover's king in check.
-            Move move(source, dest);
-            PushMove(move);
-            bool self_check = IsAttackedByWhite(bkpos);
-            PopMove();
-            if (!self_check)
-                movelist.Add(move);
-        }
+        if ((capture == Nobody || capture == White) && IsLegalMove(check, source, dest))
+            movelist.Add(Move(source, dest));
+    }
+
+    void ChessBoard::TryPawnMove(MoveList& movelist, const CheckInfo& check, int source, int dest)
+    {
+        // A pawn reaching the last rank adds one move for each piece it can become,
+        // with the Queen first. The new piece stands where the pawn would,
+        // so all four are legal if any one of them is.
+        int before = movelist.length;
+        if (isWhiteTurn)
+            TryWhiteMove(movelist, check, source, dest);
+        else
+            TryBlackMove(movelist, check, source, dest);
+
+        if (movelist.length > before && (dest > 90 || dest < 30))
+            for (int kind = 1; kind < NumPromotions; ++kind)
+                movelist.Add(movelist.movelist[before].Promoted(kind));
     }
 
-    void ChessBoard::TryWhiteRay(MoveList &movelist, int source, int dir)
+    void ChessBoard::TryWhiteRay(MoveList &movelist, const CheckInfo& check, int source, int dir)
     {
         int dest;
         for (dest = source + dir; square[dest] == Empty; dest += dir)
-            TryWhiteMove(movelist, source, dest);
+            TryWhiteMove(movelist, check, source, dest);
 
         if (SquareSide(square[dest]) == Black)
-            TryWhiteMove(movelist, source, dest);
+            TryWhiteMove(movelist, check, source, dest);
     }
 
-    void ChessBoard::TryBlackRay(MoveList &movelist, int source, int dir)
+    void ChessBoard::TryBlackRay(MoveList &movelist, const CheckInfo& check, int source, int dir)
     {
         int dest;
         for (dest = source + dir; square[dest] == Empty; dest += dir)
-            TryBlackMove(movelist, source, dest);
+            TryBlackMove(movelist, check, source, dest);
 
         if (SquareSide(square[dest]) == White)
-            TryBlackMove(movelist, source, dest);
+            TryBlackMove(movelist, check, source, dest);
     }
 
     bool ChessBoard::IsAttackedByWhite(int offset) const
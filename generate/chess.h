@@ -4,9 +4,18 @@
 #ifndef __COSINEKITTY_CHESS_H
 #define __COSINEKITTY_CHESS_H
 
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
 #include <string>
-#include <stack>
+#include <thread>
 #include <vector>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 namespace CosineKitty
 {
@@ -23,6 +32,24 @@ namespace CosineKitty
         const std::string& Message() const { return message; }
     };
 
+    // Compile with -DENDGAME_UNCHECKED to drop the defensive checks on the generator's hot path:
+    // board offsets and pieces, table indexes, the unmove stack and move lists, and the generator's own
+    // consistency checks. The default checked build throws ChessException when any of them fail.
+#ifdef ENDGAME_UNCHECKED
+    const bool CheckedBuild = false;
+#else
+    const bool CheckedBuild = true;
+#endif
+
+    // Compile with -DENDGAME_COUNT_ALLOCATIONS to replace the global operator new with one that
+    // counts its calls, so the unit tests and 'endgame bench pass' can check that a pass allocates
+    // no memory. The shipped build keeps the standard allocator.
+#ifdef ENDGAME_COUNT_ALLOCATIONS
+    const bool CountingAllocations = true;
+#else
+    const bool CountingAllocations = false;
+#endif
+
     inline int Offset(char file, char rank)
     {
         // file is a letter 'a'..'h'.
@@ -52,8 +79,11 @@ namespace CosineKitty
     inline unsigned char ValidateOffset(int offset)
     {
         // Call Rank, File for the side-effect of throwing an exception if offset is invalid.
-        Rank(offset);
-        File(offset);
+        if (CheckedBuild)
+        {
+            Rank(offset);
+            File(offset);
+        }
         return static_cast<unsigned char>(offset);
     }
 
@@ -197,28 +227,90 @@ namespace CosineKitty
             , score(_score)
             {}
 
+        // Board offsets never use the high bit, so a promotion keeps the new piece there:
+        // 0 = Queen (or not a promotion at all), 1 = Rook, 2 = Bishop, 3 = Knight.
+        int Source() const { return source & 0x7f; }
+        int Dest() const { return dest & 0x7f; }
+        int Promotion() const { return ((source & 0x80) >> 6) | ((dest & 0x80) >> 7); }
+
+        Move Promoted(int kind) const
+        {
+            Move move = *this;
+            move.source = static_cast<unsigned char>(Source() | ((kind & 2) << 6));
+            move.dest = static_cast<unsigned char>(Dest() | ((kind & 1) << 7));
+            return move;
+        }
+
         std::string Algebraic() const
         {
             std::string text;
-            text.push_back(File(source));
-            text.push_back(Rank(source));
-            text.push_back(File(dest));
-            text.push_back(Rank(dest));
+            text.push_back(File(Source()));
+            text.push_back(Rank(Source()));
+            text.push_back(File(Dest()));
+            text.push_back(Rank(Dest()));
+            if (Promotion() != 0)
+                text.push_back("qrbn"[Promotion()]);
             return text;
         }
     };
 
+    const int NumPromotions = 4;
+
+    inline Square PromotedPiece(Square pawn, int kind)
+    {
+        // The piece a pawn becomes for each Move::Promotion() kind.
+        static const Square white[NumPromotions] = { WhiteQueen, WhiteRook, WhiteBishop, WhiteKnight };
+        return (pawn == WhitePawn) ? white[kind] : static_cast<Square>(white[kind] + (BlackPawn - WhitePawn));
+    }
+
     struct Unmove       // information needed to undo a move on the ChessBoard
     {
         Move   move;
         Square capture;
+        Square mover;       // the piece that moved, which differs from the piece on 'dest' after a promotion
+
+        Unmove()
+            : capture(Empty)
+            , mover(Empty)
+            {}
 
-        Unmove(Move _move, Square _capture)
+        Unmove(Move _move, Square _capture, Square _mover)
             : move(_move)
             , capture(_capture)
+            , mover(_mover)
             {}
     };
 
+    const int MaxUnmoves = 64;      // the most moves a board can have pushed at once
+
+    class UnmoveStack   // a fixed-size stack, so that trying a move never allocates memory
+    {
+    private:
+        Unmove  unmove[MaxUnmoves];
+        int     depth;
+
+    public:
+        UnmoveStack()
+            : depth(0)
+            {}
+
+        void Clear() { depth = 0; }
+
+        void Push(const Unmove& u)
+        {
+            if (CheckedBuild && depth == MaxUnmoves)
+                throw ChessException("PushMove: unmove stack is full.");
+            unmove[depth++] = u;
+        }
+
+        const Unmove& Pop()
+        {
+            if (CheckedBuild && depth == 0)
+                throw ChessException("PopMove: unmove stack is empty.");
+            return unmove[--depth];
+        }
+    };
+
     const int MaxMoves = 255;       // The maximum number of moves possible in any chess position is less than this.
 
     struct MoveList
@@ -232,7 +324,7 @@ namespace CosineKitty
 
         void Add(Move move)
         {
-            if (length >= MaxMoves)
+            if (CheckedBuild && length >= MaxMoves)
                 throw ChessException("MoveList overflow");
 
             movelist[length++] = move;
@@ -246,33 +338,124 @@ namespace CosineKitty
         int     wkpos;          // White King's position (index into 'square')
         int     bkpos;          // Black King's position (index into 'square')
         bool    isWhiteTurn;    // is it White's turn to move?
-        std::stack<Unmove> unmoveStack;
+        UnmoveStack unmoveStack;
 
     public:
         ChessBoard() { Clear(true); }
         void Clear(bool whiteToMove);
         bool IsWhiteTurn() const { return isWhiteTurn; }
         void GenMoves(MoveList &movelist);      // Get list of all legal moves for current player.
+        void GenMovesByTrial(MoveList &movelist);   // The same moves, found by making each one and looking for check.
+        void GenUnmoves(MoveList &movelist);    // Get list of moves the other player could have just made to reach this position.
         void PushMove(Move move);
         void PopMove();
         Square GetSquare(int offset) const;
         void SetTurn(bool whiteToMove) { isWhiteTurn = whiteToMove; }
         void SetSquare(int offset, Square value);
+        void LoadFen(const char *fen);          // Replace the whole position; throws ChessException if the FEN is malformed.
         bool IsLegalPosition() const;
         bool IsCurrentPlayerInCheck() const;
-
-    private:
-        void GenWhiteMoves(MoveList &movelist);
-        void GenBlackMoves(MoveList &movelist);
-        void TryWhiteMove(MoveList &movelist, int source, int dest);
-        void TryBlackMove(MoveList &movelist, int source, int dest);
-        void TryWhiteRay(MoveList &movelist, int source, int dir);
-        void TryBlackRay(MoveList &movelist, int source, int dir);
         bool IsAttackedByWhite(int offset) const;
         bool IsAttackedByBlack(int offset) const;
+
+    private:
+        struct CheckInfo    // found once per GenMoves, for the King of the side to move
+        {
+            bool    trial;          // ignore the rest: make each move to see if it is legal
+            int     checkers;       // the number of pieces giving check
+            int     checker;        // the offset of the first one
+            int     checkDir;       // direction from the King toward it, or 0 for a Knight or pawn
+            int     npinned;
+            int     pinned[8];      // offsets of the pieces that cannot leave the line to their King
+            int     pinner[8];      // offset of the piece pinning each one
+            int     pinDir[8];      // direction from the King toward both
+            bool    attacked[120];  // squares the enemy attacks, as if the King were not there
+        };
+
+        void FindChecks(CheckInfo& check) const;
+        static void AddChecker(CheckInfo& check, int offset, int dir);
+        static bool IsBetween(int from, int dir, int to, int offset);
+        bool IsLegalMove(const CheckInfo& check, int source, int dest);
+        void GenWhiteMoves(MoveList &movelist, const CheckInfo& check);
+        void GenBlackMoves(MoveList &movelist, const CheckInfo& check);
+        void TryWhiteMove(MoveList &movelist, const CheckInfo& check, int source, int dest);
+        void TryBlackMove(MoveList &movelist, const CheckInfo& check, int source, int dest);
+        void TryWhiteRay(MoveList &movelist, const CheckInfo& check, int source, int dir);
+        void TryBlackRay(MoveList &movelist, const CheckInfo& check, int source, int dir);
+        void TryPawnMove(MoveList &movelist, const CheckInfo& check, int source, int dest);
+        void GenWhiteUnmoves(MoveList &movelist);
+        void GenBlackUnmoves(MoveList &movelist);
+        void TryWhiteUnmove(MoveList &movelist, int dest, int source);
+        void TryBlackUnmove(MoveList &movelist, int dest, int source);
+        void TryWhiteUnray(MoveList &movelist, int dest, int dir);
+        void TryBlackUnray(MoveList &movelist, int dest, int dir);
         bool IsAttackedRay(int source, int dir, Square piece1, Square piece2) const;
     };
 
+    typedef unsigned long long Bitmask;     // one bit per square: bit (8*rank + file), so a1 = bit 0 and h8 = bit 63.
+
+    inline int LowestBit(Bitmask mask)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(mask);
+#endif
+    }
+
+    inline int BitCount(Bitmask mask)
+    {
+#ifdef _MSC_VER
+        return static_cast<int>(__popcnt64(mask));
+#else
+        return __builtin_popcountll(mask);
+#endif
+    }
+
+    class BitBoard      // drop-in alternative to ChessBoard using precomputed attack masks
+    {
+    private:
+        Square  square[64];                 // piece on each square, indexed by bit number
+        Bitmask pieceMask[BlackKing + 1];   // squares occupied by each kind of piece
+        Bitmask whiteMask;                  // squares occupied by any White piece
+        Bitmask blackMask;                  // squares occupied by any Black piece
+        int     wkindex;                    // bit number of the White King
+        int     bkindex;                    // bit number of the Black King
+        bool    isWhiteTurn;
+        UnmoveStack unmoveStack;
+
+    public:
+        BitBoard() { Clear(true); }
+        void Clear(bool whiteToMove);
+        bool IsWhiteTurn() const { return isWhiteTurn; }
+        void GenMoves(MoveList &movelist);      // Same moves, in the same order, as ChessBoard::GenMoves.
+        void GenUnmoves(MoveList &movelist);
+        void PushMove(Move move);
+        void PopMove();
+        Square GetSquare(int offset) const;
+        void SetTurn(bool whiteToMove) { isWhiteTurn = whiteToMove; }
+        void SetSquare(int offset, Square value);
+        bool IsLegalPosition() const;
+        bool IsCurrentPlayerInCheck() const;
+
+    private:
+        void Place(int index, Square value);
+        void GenSideMoves(MoveList &movelist, bool white) const;
+        void GenSideUnmoves(MoveList &movelist, bool white);
+        void TryMove(MoveList &movelist, bool white, int source, int dest) const;
+        void TryPawnMove(MoveList &movelist, bool white, int source, int dest) const;
+        void TryUnmove(MoveList &movelist, bool white, int dest, int source);
+        bool IsAttacked(int index, bool byWhite, Bitmask occupied, Bitmask removed) const;
+    };
+
+#ifdef ENDGAME_BITBOARD
+    typedef BitBoard GeneratorBoard;
+#else
+    typedef ChessBoard GeneratorBoard;
+#endif
+
     struct Position
     {
         std::size_t index;
@@ -284,35 +467,632 @@ namespace CosineKitty
             {}
 
         Move RotateMove(Move raw) const;
+        Move UnrotateMove(Move canonical) const;
+    };
+
+    struct GenerateOptions
+    {
+        bool                        retrograde;     // after the first pass, visit only predecessors of newly resolved positions
+        int                         numThreads;     // number of worker threads sharing each pass
+        std::string                 checkpointFile; // if not empty, save progress here after each Black/White pair of passes
+        bool                        resume;         // continue from checkpointFile instead of starting over
+        const std::atomic<bool>    *stop;           // if not null, save a checkpoint and return early once this becomes true
+        bool                        diskTables;     // build the tables inside checkpointFile, mapped into memory, instead of in RAM
+        std::size_t                 memoryLimit;    // with diskTables, keep resident memory near this many bytes (0 = no limit)
+        std::string                 statsFile;      // if not empty, sample resident memory during passes and write the per-pass report here
+        bool                        generic;        // use the board-based generator even if one is compiled for this piece list
+        bool                        bitbase;        // also write the win/draw bitbase <piecelist>.egw
+        bool                        pruneBishops;   // with only bishops besides the Kings, skip positions where they all stand on one color
+
+        GenerateOptions()
+            : retrograde(false)
+            , numThreads(1)
+            , resume(false)
+            , stop(nullptr)
+            , diskTables(false)
+            , memoryLimit(0)
+            , generic(false)
+            , bitbase(false)
+            , pruneBishops(false)
+            {}
+    };
+
+    struct PassCounters     // the work done during one generator pass
+    {
+        uint64_t    visited;        // positions given to ScoreWhite or ScoreBlack
+        uint64_t    illegal;        // of those, rejected by IsLegalPosition
+        uint64_t    skipped;        // of those, already resolved in the table
+        uint64_t    genMoves;       // calls to GenMoves
+        uint64_t    moves;          // moves those calls generated
+        uint64_t    genUnmoves;     // calls to GenUnmoves, by retrograde passes
+        uint64_t    unmoves;        // unmoves those calls generated
+        uint64_t    tableIndex;     // calls to TableIndex, on this table or a capture or promotion table
+        std::size_t peakResident;   // most bytes in RAM at any sample taken during the pass
+
+        PassCounters()
+            : visited(0)
+            , illegal(0)
+            , skipped(0)
+            , genMoves(0)
+            , moves(0)
+            , genUnmoves(0)
+            , unmoves(0)
+            , tableIndex(0)
+            , peakResident(0)
+            {}
+
+        void Add(const PassCounters& other)
+        {
+            visited += other.visited;
+            illegal += other.illegal;
+            skipped += other.skipped;
+            genMoves += other.genMoves;
+            moves += other.moves;
+            genUnmoves += other.genUnmoves;
+            unmoves += other.unmoves;
+            tableIndex += other.tableIndex;
+            if (other.peakResident > peakResident)
+                peakResident = other.peakResident;
+        }
+    };
+
+    struct PassStats        // one pass of Generate(), as written by --stats
+    {
+        Side            side;
+        int             mateInMoves;
+        long            slice;          // with pawns, how many slices were finished before this one; otherwise -1
+        int             found;
+        double          seconds;
+        std::size_t     resident;       // bytes in RAM at the end of the pass
+        std::size_t     dead;           // slots in the pass's table or slice that hold no legal canonical position, so the pass never visits them
+        PassCounters    counters;
+    };
+
+    struct GenerateStats    // everything the most recent Generate() measured
+    {
+        std::string             method;         // "forward", "retrograde", or "slices"
+        int                     threads;
+        bool                    compiled;       // scored with a generator compiled for the piece list
+        bool                    finished;
+        double                  seconds;
+        std::size_t             peakResident;   // the process's peak resident memory, from the operating system
+        std::vector<PassStats>  passes;
+
+        GenerateStats()
+            : threads(0)
+            , compiled(false)
+            , finished(false)
+            , seconds(0.0)
+            , peakResident(0)
+            {}
+    };
+
+    struct Worker       // the state owned by one generator thread
+    {
+        GeneratorBoard              board;
+        std::vector<int>            offsetList;
+        int                         nfound;
+        std::size_t                 nvisited;
+        int                         sinceMemoryCheck;   // table lookups since this worker last measured resident memory
+        int                         duePass;            // earliest later pass that can score a position this worker had to put off, or 0
+        PassCounters                counters;           // work done in the current pass, collected by RecordPass
+
+        Worker()
+            : nfound(0)
+            , nvisited(0)
+            , sinceMemoryCheck(0)
+            , duePass(0)
+            {}
+    };
+
+    typedef std::vector<std::atomic<uint64_t>> AtomicBitmap;   // one bit per table index, which any thread may set
+
+    struct Worklist     // the unresolved positions for one side to move, grouped by King pair
+    {
+        std::vector<std::vector<uint64_t>>  slice;      // [pair] = bitmap of unresolved positions, by canonical index minus pair*pieceStride
+        std::vector<uint32_t>               count;      // [pair] = number of bits set in slice[pair]
+        std::vector<char>                   changed;    // [pair] = did this side's most recent pass resolve anything here?
+        std::vector<int>                    due;        // [pair] = earliest later pass that can score a Black position put off there, or 0
+
+        std::size_t Size() const
+        {
+            std::size_t total = 0;
+            for (uint32_t n : count)
+                total += n;
+            return total;
+        }
+    };
+
+    class MappedFile    // an entire file mapped into memory; writes stay private unless it was opened shared
+    {
+    private:
+        unsigned char  *data;
+        std::size_t     size;
+        bool            shared;     // writes go to the file, and pages may be dropped from memory at any time
+#ifdef _WIN32
+        void           *fileHandle;
+        void           *mapHandle;
+#else
+        int             fd;
+#endif
+
+    public:
+        MappedFile();
+        ~MappedFile();
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        void Open(const std::string& filename);
+        void OpenShared(const std::string& filename, std::size_t newSize);
+        void Sync();
+        void Release();
+        void Close();
+        void CloseTruncated(std::size_t newSize);
+        bool IsOpen() const { return data != nullptr; }
+        unsigned char *Data() const { return data; }
+        std::size_t Size() const { return size; }
+    };
+
+    std::size_t ResidentMemory();       // bytes of this process currently in RAM
+    std::size_t PeakResidentMemory();   // the most bytes this process has had in RAM at once
+    uint64_t AllocationCount();         // the number of times this process has called operator new, or 0 unless CountingAllocations
+
+    template <typename EntryType>
+    class EntryTable    // a table of entries, either owned in memory or living inside a MappedFile
+    {
+    private:
+        std::vector<EntryType>  owned;
+        EntryType              *entry;
+        std::size_t             length;
+
+    public:
+        EntryTable()
+            : entry(nullptr)
+            , length(0)
+            {}
+
+        EntryTable(const EntryTable&) = delete;
+        EntryTable& operator=(const EntryTable&) = delete;
+
+        void Allocate(std::size_t n, EntryType fill)
+        {
+            owned.assign(n, fill);
+            entry = owned.data();
+            length = n;
+        }
+
+        void Attach(EntryType *mapped, std::size_t n)
+        {
+            std::vector<EntryType>().swap(owned);
+            entry = mapped;
+            length = n;
+        }
+
+        void Own()
+        {
+            // Copy attached entries into memory owned by this table, so the mapping can be closed.
+            if (entry != owned.data())
+            {
+                std::vector<EntryType> copy(entry, entry + length);
+                owned.swap(copy);
+                entry = owned.data();
+            }
+        }
+
+        std::size_t size() const { return length; }
+        const EntryType *data() const { return entry; }
+
+        EntryType& at(std::size_t i)
+        {
+            if (CheckedBuild && i >= length)
+                throw ChessException("EntryTable: index out of range");
+            return entry[i];
+        }
+
+        const EntryType& at(std::size_t i) const
+        {
+            if (CheckedBuild && i >= length)
+                throw ChessException("EntryTable: index out of range");
+            return entry[i];
+        }
+
+        EntryType& operator[](std::size_t i) { return entry[i]; }
+        const EntryType& operator[](std::size_t i) const { return entry[i]; }
+    };
+
+    const uint32_t TableFileVersion = 1;
+    const uint32_t KingPairIndexScheme = 1;     // 462 King pairs, then 64 squares for each other piece
+    const uint32_t PawnSliceIndexScheme = 2;    // the pawns, left/right mirrored onto files a-d, then 64 squares for each other piece
+    const uint32_t SquarePairIndexScheme = 3;   // like KingPairIndexScheme, but the first two identical pieces share one of 2016 unordered square pairs
+
+    inline uint32_t IndexScheme(const std::string& piecelist)
+    {
+        if (piecelist.find('p') != std::string::npos)
+            return PawnSliceIndexScheme;
+
+        for (std::size_t i = 0; i < piecelist.size(); ++i)
+            if (piecelist.find(piecelist[i], i+1) != std::string::npos)
+                return SquarePairIndexScheme;
+
+        return KingPairIndexScheme;
+    }
+
+    struct TableFileHeader      // the first bytes of a binary .egb endgame table file
+    {
+        char        signature[8];       // "EGBTABLE"
+        uint32_t    version;            // TableFileVersion
+        uint32_t    byteOrder;          // 0x01020304 as stored by the machine that wrote the file
+        char        piecelist[8];       // non-King White pieces, padded with zero bytes
+        uint32_t    indexScheme;        // how positions are numbered, e.g. KingPairIndexScheme
+        uint32_t    whiteEntryBytes;    // sizeof(Move); 1 in a .egd file; 0 for 2-bit entries packed 4 to a byte in a .egw file
+        uint32_t    blackEntryBytes;    // sizeof(short); likewise
+        uint32_t    blockBytes;         // size of each checksummed block
+        uint64_t    length;             // number of slots in each table
+        uint64_t    whiteOffset;        // file offset of the White-to-move table
+        uint64_t    blackOffset;        // file offset of the Black-to-move table
+        uint64_t    checksumOffset;     // file offset of the CRC-32 of each block
+        uint32_t    numBlocks;          // number of blocks in both tables together
+        uint32_t    headerChecksum;     // CRC-32 of this header, calculated with this field set to 0
     };
 
+    uint32_t Crc32(const void *buffer, std::size_t nbytes, uint32_t crc = 0);
+
+    struct CheckpointRecord     // appended to a .egb file to make it a generator checkpoint
+    {
+        char        signature[8];       // "EGCHKPNT"
+        uint32_t    retrograde;         // 1 if written by a retrograde run, 0 by a forward run
+        uint32_t    diskTables;         // 1 if the tables were built in place, so the block checksums are not valid
+        uint32_t    blackPasses;        // number of Black passes completed
+        uint32_t    whitePasses;        // number of White passes completed
+        uint32_t    slices;             // number of pawn slices completed, in the order generation visits them
+        uint32_t    checksum;           // CRC-32 of this record, calculated with this field set to 0
+    };
+
+    const uint32_t CompressedBlockEntries = 4096;   // table entries in each independently compressed block
+
+    struct CompressedFileHeader     // the first bytes of a block-compressed .egz endgame table file
+    {
+        char        signature[8];       // "EGZTABLE"
+        uint32_t    version;            // TableFileVersion
+        uint32_t    byteOrder;          // 0x01020304 as stored by the machine that wrote the file
+        char        piecelist[8];       // non-King White pieces, padded with zero bytes
+        uint32_t    indexScheme;        // how positions are numbered, e.g. KingPairIndexScheme
+        uint32_t    whiteEntryBytes;    // sizeof(Move)
+        uint32_t    blackEntryBytes;    // sizeof(short)
+        uint32_t    blockEntries;       // CompressedBlockEntries
+        uint64_t    length;             // number of slots in each table
+        uint32_t    numWhiteBlocks;     // blocks holding the White-to-move table
+        uint32_t    numBlackBlocks;     // blocks holding the Black-to-move table, which follow the White blocks
+        uint64_t    indexOffset;        // file offset of numWhiteBlocks+numBlackBlocks+1 uint64_t block offsets
+        uint64_t    fileBytes;          // total size of the file
+        uint32_t    reserved;
+        uint32_t    headerChecksum;     // CRC-32 of this header, calculated with this field set to 0
+    };
+
+    class CompressedTable   // random access to a .egz file, decoding only the blocks that are used
+    {
+    private:
+        MappedFile              file;
+        const unsigned char    *base;
+        std::size_t             length;
+        std::size_t             numWhiteBlocks;
+        std::size_t             numBlocks;
+
+        // A bounded cache of decoded blocks, shared by all threads, evicting the least recently used.
+        // Every slot is allocated up front, so reading an entry never allocates memory.
+        mutable std::mutex                  mutex;
+        mutable std::vector<unsigned char>  slotData;   // cacheBlocks * CompressedBlockEntries * sizeof(Move) bytes
+        mutable std::vector<int>            slotBlock;  // the block held by each slot, or -1
+        mutable std::vector<int>            blockSlot;  // the slot holding each block, or -1
+        mutable std::vector<int>            newer;      // LRU list of slots, linked from oldest to newest
+        mutable std::vector<int>            older;
+        mutable int                         newest;
+        mutable int                         oldest;
+        mutable uint64_t                    hits;
+        mutable uint64_t                    misses;
+
+    public:
+        CompressedTable();
+        CompressedTable(const CompressedTable&) = delete;
+        CompressedTable& operator=(const CompressedTable&) = delete;
+
+        void Open(const std::string& filename, const std::string& piecelist, std::size_t length, std::size_t cacheBlocks);
+        bool IsOpen() const { return file.IsOpen(); }
+        std::size_t FileBytes() const { return file.Size(); }
+        std::size_t NumBlocks() const { return numBlocks; }
+        Move WhiteEntry(std::size_t index) const;
+        short BlackEntry(std::size_t index) const;
+        uint64_t Hits() const { return hits; }
+        uint64_t Misses() const { return misses; }
+
+        static bool IsCompressedFile(const std::string& filename);
+
+    private:
+        const unsigned char *Fetch(std::size_t block) const;
+    };
+
+    class DistanceTable     // a mapped .egd file: one byte per position for each side to move, with no moves
+    {
+    private:
+        MappedFile              file;
+        const unsigned char    *white;
+        const unsigned char    *black;
+        std::size_t             length;
+
+    public:
+        DistanceTable();
+        DistanceTable(const DistanceTable&) = delete;
+        DistanceTable& operator=(const DistanceTable&) = delete;
+
+        void Open(const std::string& filename, const std::string& piecelist, std::size_t length);
+        bool IsOpen() const { return file.IsOpen(); }
+        std::size_t FileBytes() const { return file.Size(); }
+        bool VerifyChecksums() const;
+
+        short WhiteScore(std::size_t index) const { return DecodeScore(white[CheckIndex(index)]); }
+        short BlackScore(std::size_t index) const { return DecodeScore(black[CheckIndex(index)]); }
+
+        // A byte holds the number of plies until checkmate plus 1, or 0 if there is no forced win.
+        static unsigned char EncodeScore(short score);
+        static short DecodeScore(unsigned char distance) { return (distance == 0) ? Draw : static_cast<short>(WhiteMates + 1 - distance); }
+        static bool IsDistanceFile(const std::string& filename);
+
+    private:
+        std::size_t CheckIndex(std::size_t index) const
+        {
+            if (CheckedBuild && index >= length)
+                throw ChessException("DistanceTable: index out of range");
+            return index;
+        }
+    };
+
+    enum BitbaseEntry       // the 2 bits stored for each position in a .egw file
+    {
+        BitbaseIllegal,     // not a legal position with this side to move, or not the canonical index of one
+        BitbaseDraw,        // White cannot force checkmate
+        BitbaseWin,         // White forces checkmate
+    };
+
+    class BitbaseTable      // a mapped .egw file: whether each position is a forced win, 4 positions to a byte
+    {
+    private:
+        MappedFile              file;
+        const unsigned char    *white;
+        const unsigned char    *black;
+        std::size_t             length;
+
+    public:
+        BitbaseTable();
+        BitbaseTable(const BitbaseTable&) = delete;
+        BitbaseTable& operator=(const BitbaseTable&) = delete;
+
+        void Open(const std::string& filename, const std::string& piecelist, std::size_t length);
+        bool IsOpen() const { return file.IsOpen(); }
+        std::size_t FileBytes() const { return file.Size(); }
+        bool VerifyChecksums() const;
+
+        BitbaseEntry WhiteEntry(std::size_t index) const { return Entry(white, CheckIndex(index)); }
+        BitbaseEntry BlackEntry(std::size_t index) const { return Entry(black, CheckIndex(index)); }
+
+        static BitbaseEntry Entry(const unsigned char *table, std::size_t index)
+        {
+            return static_cast<BitbaseEntry>((table[index >> 2] >> (2 * (index & 3))) & 3);
+        }
+
+    private:
+        std::size_t CheckIndex(std::size_t index) const
+        {
+            if (CheckedBuild && index >= length)
+                throw ChessException("BitbaseTable: index out of range");
+            return index;
+        }
+    };
+
+    const std::size_t MaxEndgamePieces = 5;     // including both Kings
+    const std::size_t MaxCompiledPieces = 4;    // the largest piece lists, Kings included, with a generator compiled for them
+
+    template <bool Deeper, Square... WhitePieces> struct CompiledGenerator;
+
     class Endgame
     {
+        friend class EndgameProbe;
+        friend class EndgameBitbase;
+        template <bool Deeper, Square... WhitePieces> friend struct CompiledGenerator;
+
+        // Scores the position at a table index for the given side; returns 1 if it was resolved.
+        typedef int (Endgame::*ScoreFunction)(Worker& worker, std::size_t index, Side side, int mateInMoves);
+
     private:
+        std::string         piecelist;
         std::vector<Square> pieces;
-        std::vector<int>    offsetList;
-        std::vector<Move>   whiteTable;
-        std::vector<short>  blackTable;
-        std::size_t         length;
+        EntryTable<Move>    whiteTable;
+        EntryTable<short>   blackTable;
+        MappedFile          mappedFile;
+        std::size_t         length;         // number of slots in each table
+        std::size_t         pieceStride;    // number of slots for each King pair: 64^(npieces-2), or 2016*64^(npieces-4) with a pair
+        std::size_t         pairFirst;      // the first of two identical pieces indexed as one unordered pair, or 0 if there are none
+        std::size_t         pairSecond;     // the second of them, always on the higher square at an index's own placement; or 0
+        std::size_t         classicLength;  // number of slots in the original 10*64^(npieces-1) layout
+        std::size_t         numSlices;      // with pawns, the number of ways to place them; 0 if there are no pawns
+        std::size_t         sliceStride;    // with pawns, the number of slots for each placement of them
+
+        // State of a Generate() run that may be interrupted and resumed.
+        const std::atomic<bool> *stopFlag;
+        std::string         checkpointFile;
+        std::thread         checkpointWriter;   // writes the most recent snapshot while the next pass runs
+        std::exception_ptr  checkpointError;
+        std::vector<Move>   checkpointWhite;
+        std::vector<short>  checkpointBlack;
+        bool                diskTables;         // the tables live in checkpointFile, which is mapped shared
+        std::size_t         memoryLimit;        // with diskTables, release mapped pages when resident memory goes over this
+        AtomicBitmap        deferred;           // retrograde: Black positions waiting for the pass that matches their score
+        std::vector<uint64_t> whiteLive;        // the canonical indices of legal positions with White to move, marked once per Generate()
+        std::vector<uint64_t> blackLive;        // the same with Black to move
+        bool                pruneBishops;       // leave positions with every bishop on one color out of the live bitmaps
+        bool                sampleMemory;       // measure resident memory during passes, for the --stats report
+        GenerateStats       stats;
+        ScoreFunction       scoreIndex;         // the generator compiled for this piece list, or null to use ScoreWhite/ScoreBlack on the board
+
+        // [piece] = the table for what is left after Black captures pieces[piece], or null if only the Kings are left.
+        std::vector<const Endgame *> captureTables;
+
+        // [piece][kind] = the table where the pawn pieces[piece] has become PromotedPiece(WhitePawn, kind).
+        std::vector<std::vector<const Endgame *>> promotionTables;
 
     public:
         Endgame(const char *piecelist);
+        ~Endgame();
+        Endgame(const Endgame&) = delete;
+        Endgame& operator=(const Endgame&) = delete;
         std::size_t GetTableSize() const { return length; }
-        void Generate();
-        void Save(std::string filename) const;
-        void WriteTypeScript(std::string filename, const char *piecelist) const;
+        std::size_t PieceCount() const { return pieces.size(); }
+        const std::string& PieceList() const { return piecelist; }
+        std::vector<std::string> SuccessorPieceLists() const;   // the other tables Generate() needs, for each distinct capture and promotion
+        void SetSuccessorTable(const Endgame *table);           // use a generated or loaded table for captures and promotions that reach it
+        bool Generate(const GenerateOptions& options);      // returns false if stopped early
+        void Save(std::string filename, int numThreads = 1) const;
+        void SaveBinary(std::string filename) const;
+        void FinishTableFile(std::string filename);         // turn the tables built by a diskTables run into a .egb file
+        void SaveCompressed(std::string filename) const;
+        void SaveDistances(std::string filename) const;     // a .egd file for DistanceTable
+        void SaveBitbase(std::string filename, int numThreads) const;   // a .egw file for BitbaseTable
+        void Load(std::string filename);
+        bool VerifyChecksums() const;
+        void WriteWebTables(std::string prefix, int numThreads = 1) const;     // writes <prefix>_0.bin .. <prefix>_9.bin for the web page
+        std::string StatsJson() const;          // the per-pass report of the most recent Generate(), as a JSON object
 
         static int UnitTest();
+        int BoardBenchmark() const;
+        int MoveBenchmark() const;
+        int LegalMoveBenchmark() const;
+        int PassBenchmark();
+        static int PerftBenchmark(const char *fen, int maxDepth);
+        static int GeneratorBenchmark(Endgame& generic, Endgame& compiled);
+        int CompressionBenchmark(std::string filename) const;
+        int DistanceBenchmark(std::string filename) const;
+        int CanonicalBenchmark() const;
+        void IndexReport() const;
 
     private:
-        void Search(ChessBoard& board, std::size_t npieces, int mateInMoves, int& nfound, Side side);
-        Position CalcPosition(int symmetry) const;
-        Position TableIndex() const;
-        int ScoreWhite(ChessBoard &board, int mateInMoves);
-        int ScoreBlack(ChessBoard &board);
-        void UpdateOffset(int oldOffset, int newOffset);
+        bool GenerateForward(std::vector<Worker>& workers, CheckpointRecord& progress);
+        bool GenerateRetrograde(std::vector<Worker>& workers, CheckpointRecord& progress);
+        bool GeneratePawnSlices(std::vector<Worker>& workers, CheckpointRecord& progress);
+        int SlicePass(std::vector<Worker>& workers, std::size_t base, std::vector<uint64_t>& unresolved, int mateInMoves, Side side, int& duePass);
+        bool StopRequested() const { return stopFlag != nullptr && *stopFlag; }
+        std::size_t FindResolved(Side side, int pass, std::vector<uint64_t>& resolved);
+        int DeepestResolvedMove();
+        void LoadCheckpoint(bool retrograde, CheckpointRecord& progress);
+        void StartCheckpoint(const CheckpointRecord& progress);
+        void FinishCheckpoint();
+        static void WriteTables(const std::string& filename, const std::string& piecelist, std::size_t length, const Move *white, const short *black, const CheckpointRecord *checkpoint);
+        void CreateTableFile(const std::string& filename);
+        void AttachTables(const std::string& filename);
+        void LimitMemory();
+        void CheckMemory(Worker& worker, int lookups);
+        void RecordPass(std::vector<Worker>& workers, Side side, int mateInMoves, long slice, std::size_t dead, int nfound, double seconds);
+        void MarkLive(std::vector<Worker>& workers);
+        int LivePass(std::vector<Worker>& workers, int mateInMoves, Side side);
+        int SearchPass(std::vector<Worker>& workers, int mateInMoves, Side side);
+        void BuildWorklists(std::vector<Worker>& workers, Worklist& white, Worklist& black);
+        int WorklistPass(std::vector<Worker>& workers, int mateInMoves, Side side, Worklist& work, const Worklist& other, std::size_t& visited);
+        void Search(Worker& worker, std::size_t npieces, int mateInMoves, Side side);
+        void CollectPredecessors(std::vector<Worker>& workers, const std::vector<uint64_t>& frontier, bool whiteToMove, AtomicBitmap& candidates);
+        std::size_t ResolveCandidates(std::vector<Worker>& workers, AtomicBitmap& candidates, int mateInMoves, Side side, std::vector<uint64_t>& resolved);
+        bool UnrankPosition(std::size_t index, std::vector<int>& offset) const;
+        Position ClassicPosition(const std::vector<int>& offset) const;  // the original layout's slot, and the symmetry that reaches it
+        bool SetupPosition(Worker& worker, std::size_t index, bool whiteToMove) const;
+        bool FindPieces(const ChessBoard& board, int *offset) const;   // the offsets of a board's pieces, in the order of 'pieces'
+        void BuildBitbase(std::vector<unsigned char>& white, std::vector<unsigned char>& black, int numThreads) const;
+        Position RankPosition(const int *offsetList, int symmetry) const;
+        Position RankPosition(const std::vector<int>& offsetList, int symmetry) const { return RankPosition(offsetList.data(), symmetry); }
+        Position CanonicalPosition(const int *offsetList) const;
+        Position SearchCanonicalPosition(const int *offsetList) const;
+        Position TableIndex(const int *offsetList) const;
+        Position TableIndex(const std::vector<int>& offsetList) const { return TableIndex(offsetList.data()); }
+        std::size_t AppendPieces(std::size_t index, const int *offsetList, int symmetry) const;
+        bool SameColorBishops(const std::vector<int>& offsetList) const;
+        int ScoreWhite(Worker& worker, int mateInMoves);
+        int ScoreBlack(Worker& worker, int mateInMoves);
+        int ScoreIndex(Worker& worker, std::size_t index, Side side, int mateInMoves);
+        template <typename Set> int ScoreCompiled(Worker& worker, std::size_t index, Side side, int mateInMoves);
+        template <typename Set> int ScoreWhiteCompiled(Worker& worker, int *disp, int mateInMoves);
+        template <typename Set> int ScoreBlackCompiled(Worker& worker, int *disp, int mateInMoves);
+        short CaptureScore(const int *offsetList, int dest) const;
+        short PromotionScore(const int *offsetList, Move move) const;
+        static void UpdateOffset(std::vector<int>& offsetList, int oldOffset, int newOffset);
         std::string PositionText(std::size_t index) const;
     };
+
+    struct ProbeResult      // what an endgame table says about one position
+    {
+        Move    move;           // best move for the side to move, on the real board; null if there is none
+        short   score;          // table score: WhiteMates minus the number of plies until mate, or Draw
+        int     mateInMoves;    // number of White moves until checkmate (0 = Black is mated), or -1 if no forced win
+
+        ProbeResult()
+            : score(Draw)
+            , mateInMoves(-1)
+            {}
+    };
+
+    const std::size_t DefaultCacheBlocks = 256;    // 4 MB of decoded blocks
+
+    class EndgameProbe      // read-only lookups into a mapped .egb, .egz or .egd table, safe to share between threads
+    {
+    private:
+        Endgame         db;
+        CompressedTable compressed;     // used instead of db's tables when the file is block-compressed
+        DistanceTable   distances;      // used instead of db's tables when the file holds only distances to mate
+
+        // With a distance table: [piece][kind] = the table where the pawn pieces[piece] has become PromotedPiece(WhitePawn, kind).
+        std::vector<std::vector<std::unique_ptr<EndgameProbe>>> promotions;
+
+    public:
+        EndgameProbe(const char *piecelist, std::string filename, std::size_t cacheBlocks = DefaultCacheBlocks);
+        const CompressedTable& Compressed() const { return compressed; }
+        const DistanceTable& Distances() const { return distances; }
+        const std::string& PieceList() const { return db.piecelist; }
+
+        // Each probe works only with its arguments and the mapped table, and never allocates memory.
+        // The only state shared between calls is the decoded-block cache of a compressed table.
+        // Return false if the position does not belong to this table or is not legal.
+        bool Lookup(const int *offset, bool whiteToMove, ProbeResult& result) const;
+        bool Probe(ChessBoard& board, ProbeResult& result) const;
+        bool ProbeFen(const char *fen, ChessBoard& board, ProbeResult& result) const;
+
+        // Answer one FEN per input line, writing one line per position in the same order.
+        // Returns the number of lines processed.
+        std::size_t ProbeStream(std::istream& input, std::ostream& output, int numThreads) const;
+
+        int Benchmark() const;
+
+    private:
+        Move WhiteEntry(std::size_t index) const;   // a null move with the score if the table holds only distances
+        short BlackEntry(std::size_t index) const;
+        void FormatResult(const char *fen, ChessBoard& board, std::string& output) const;
+        void OpenDistances(const std::string& filename);
+        void BestWhiteMove(ChessBoard& board, const int *offset, ProbeResult& result) const;
+        void BestBlackMove(ChessBoard& board, const int *offset, ProbeResult& result) const;
+    };
+
+    class EndgameBitbase    // read-only win/draw lookups into a mapped .egw bitbase, safe to share between threads
+    {
+    private:
+        Endgame         db;         // only for its piece list and canonicalization; its tables are never loaded
+        BitbaseTable    table;
+
+    public:
+        EndgameBitbase(const char *piecelist, std::string filename);
+        const BitbaseTable& Table() const { return table; }
+        const std::string& PieceList() const { return db.piecelist; }
+
+        // Like EndgameProbe::Lookup, these never allocate memory and keep no state.
+        // An illegal position, or one that does not belong to this table, is BitbaseIllegal.
+        BitbaseEntry Lookup(const int *offset, bool whiteToMove) const;
+        BitbaseEntry Probe(const ChessBoard& board) const;
+
+        int Benchmark(const EndgameProbe& full) const;
+    };
 }
 
 #endif /* __COSINEKITTY_CHESS_H */
@@ -2,24 +2,45 @@
     endgame.cpp  -  Don Cross  -  https://github.com/cosinekitty/endgame
 */
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <chrono>
 #include <cstdio>
+#include <cstring>
+#include <exception>
 #include <iostream>
+#include <thread>
+#include <type_traits>
 #include "chess.h"
 
 namespace CosineKitty
 {
-    Endgame::Endgame(const char *piecelist)
+    // The number of ways to place the two Kings without touching, after using eightfold symmetry.
+    static const int NumKingPairs = 462;
+
+    // The number of ways to place two identical pieces on different squares, in either order.
+    static const std::size_t NumSquarePairs = 64 * 63 / 2;
+
+    Endgame::Endgame(const char *_piecelist)
+        : piecelist(_piecelist)
+        , stopFlag(nullptr)
+        , diskTables(false)
+        , memoryLimit(0)
+        , pruneBishops(false)
+        , sampleMemory(false)
+        , scoreIndex(nullptr)
     {
         // There is always an implicit Black King [0] and White King [1].
         pieces.push_back(BlackKing);
         pieces.push_back(WhiteKing);
 
-        // The other pieces are all White pieces: Q, R, N, and/or B.
-        for (int i=0; piecelist[i]; ++i)
+        // The other pieces are all White pieces: Q, R, N, B, and/or P.
+        for (std::size_t i=0; i < piecelist.size(); ++i)
         {
-            // More than 4 total pieces uses more than 1 GB of memory!
-            if (pieces.size() == 4)
-                throw ChessException("Cannot have more than 4 pieces total in an endgame configuration.");
+            // More than 5 total pieces uses more than 45 GB of memory!
+            if (pieces.size() == MaxEndgamePieces)
+                throw ChessException("Cannot have more than 5 pieces total in an endgame configuration.");
 
             switch (piecelist[i])
             {
@@ -27,20 +48,183 @@ namespace CosineKitty
             case 'r':   pieces.push_back(WhiteRook);    break;
             case 'b':   pieces.push_back(WhiteBishop);  break;
             case 'n':   pieces.push_back(WhiteKnight);  break;
+            case 'p':   pieces.push_back(WhitePawn);    break;
             default:
-                throw ChessException("Illegal endgame piece: must be q, r, b, n.");
+                throw ChessException("Illegal endgame piece: must be q, r, b, n, p.");
             }
         }
 
-        offsetList.resize(pieces.size());
-
         // Calculate the table length based on the maximum possible index.
-        // Using eightfold symmetry, the Black King can be in only 10 possible distinct locations.
-        // The White King can be in any remaining square, but call it 64 to keep code simple.
-        length = 10;
+        // Using eightfold symmetry, the Black King can be in only 10 possible distinct locations,
+        // and the two Kings together in only 462 legal, distinct arrangements.
+        // Each remaining piece can be in any remaining square, but call it 64 to keep code simple.
+        pieceStride = 1;
         std::size_t npieces = pieces.size();
-        for (std::size_t i=1; i < npieces; ++i)
-            length *= 64;
+        for (std::size_t i=2; i < npieces; ++i)
+            pieceStride *= 64;
+
+        // The .egm and web outputs are still laid out using the original index,
+        // which gave the Black King 10 locations and every other piece 64.
+        classicLength = 10 * 64 * pieceStride;
+        numSlices = 0;
+
+        // Swapping two identical pieces gives the same position, so without pawns
+        // the first two of them are indexed together as an unordered pair of squares.
+        // That stores each position once instead of twice, in 2016 slots instead of 4096.
+        std::size_t npawns = std::count(pieces.begin(), pieces.end(), WhitePawn);
+        pairFirst = pairSecond = 0;
+        for (std::size_t i = 2; i < npieces && pairFirst == 0 && npawns == 0; ++i)
+        {
+            for (std::size_t k = i+1; k < npieces && pairFirst == 0; ++k)
+            {
+                if (pieces[k] == pieces[i])
+                {
+                    pairFirst = i;
+                    pairSecond = k;
+                    pieceStride = (pieceStride / (64 * 64)) * NumSquarePairs;
+                }
+            }
+        }
+
+        length = NumKingPairs * pieceStride;
+        sliceStride = pieceStride;
+
+        if (npawns > 0)
+        {
+            // Pawns leave only the left/right mirror, which keeps the first pawn on files a-d.
+            // Pawns never stand on the first or last rank, so the first pawn has 24 squares
+            // and any other pawn 48. The pawns come first in the index, so each placement
+            // of them, a slice, is one contiguous run of the table.
+            numSlices = 24;
+            for (std::size_t i = 1; i < npawns; ++i)
+                numSlices *= 48;
+
+            sliceStride = 1;
+            for (std::size_t i = npawns; i < npieces; ++i)
+                sliceStride *= 64;
+
+            length = classicLength = numSlices * sliceStride;
+        }
+
+        captureTables.assign(npieces, nullptr);
+        promotionTables.assign(npieces, std::vector<const Endgame *>(NumPromotions, nullptr));
+    }
+
+    static std::string PromotionPieceList(const std::string& piecelist, std::size_t i, int kind)
+    {
+        // The promoted piece keeps the pawn's place in the piece list.
+        std::string promoted = piecelist;
+        promoted[i] = "qrbn"[kind];
+        return promoted;
+    }
+
+    std::vector<std::string> Endgame::SuccessorPieceLists() const
+    {
+        // Black can only capture with its King, leaving the Kings and the other White pieces.
+        // A lone pair of Kings is always a draw, so it needs no table.
+        // A White pawn reaching the last rank leads into the table with the new piece in its place.
+        std::vector<std::string> list;
+        auto add = [&list](const std::string& other)
+        {
+            if (!other.empty() && std::find(list.begin(), list.end(), other) == list.end())
+                list.push_back(other);
+        };
+
+        for (std::size_t i = 0; i < piecelist.size(); ++i)
+            add(piecelist.substr(0, i) + piecelist.substr(i+1));
+
+        for (std::size_t i = 0; i < piecelist.size(); ++i)
+            if (pieces[i+2] == WhitePawn)
+                for (int kind = 0; kind < NumPromotions; ++kind)
+                    add(PromotionPieceList(piecelist, i, kind));
+
+        return list;
+    }
+
+    void Endgame::SetSuccessorTable(const Endgame *table)
+    {
+        // Identical pieces leave the same table behind, so one table can serve more than one capture or promotion.
+        bool used = false;
+        for (std::size_t i = 0; i < piecelist.size(); ++i)
+        {
+            if (table->piecelist == piecelist.substr(0, i) + piecelist.substr(i+1))
+            {
+                captureTables[i+2] = table;
+                used = true;
+            }
+
+            if (pieces[i+2] == WhitePawn)
+            {
+                for (int kind = 0; kind < NumPromotions; ++kind)
+                {
+                    if (table->piecelist == PromotionPieceList(piecelist, i, kind))
+                    {
+                        promotionTables[i+2][kind] = table;
+                        used = true;
+                    }
+                }
+            }
+        }
+
+        if (!used)
+            throw ChessException("SetSuccessorTable: " + table->piecelist + " is not reached by any capture or promotion in " + piecelist);
+
+        if (table->whiteTable.size() != table->length)
+            throw ChessException("SetSuccessorTable: the table for " + table->piecelist + " has not been generated or loaded.");
+    }
+
+    short Endgame::CaptureScore(const int *offsetList, int dest) const
+    {
+        // Black's King captures the White piece on 'dest'. Find the resulting position,
+        // now with White to move, in the smaller table. Return Draw if White cannot force mate there.
+        int rest[MaxEndgamePieces];
+        const Endgame *table = nullptr;
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < pieces.size(); ++i)
+        {
+            if (i >= 2 && offsetList[i] == dest)
+                table = captureTables[i];
+            else
+                rest[n++] = (i == 0) ? dest : offsetList[i];
+        }
+
+        if (table == nullptr)
+            return Draw;
+
+        short score = table->whiteTable[table->TableIndex(rest).index].score;
+        return (score > Draw) ? score : Draw;
+    }
+
+    short Endgame::PromotionScore(const int *offsetList, Move move) const
+    {
+        // White's pawn on the move's source square becomes a new piece on its destination.
+        // Find the resulting position, now with Black to move, in the table holding that piece.
+        int next[MaxEndgamePieces] = {};
+        const Endgame *table = nullptr;
+        for (std::size_t i = 0; i < pieces.size(); ++i)
+        {
+            if (offsetList[i] == move.Source())
+            {
+                table = promotionTables[i][move.Promotion()];
+                next[i] = move.Dest();
+            }
+            else
+            {
+                next[i] = offsetList[i];
+            }
+        }
+
+        if (CheckedBuild && table == nullptr)
+            throw ChessException("PromotionScore: no promoting pawn on the source square");
+
+        short score = table->blackTable[table->TableIndex(next).index];
+        return (score > Draw) ? score : Draw;
+    }
+
+    Endgame::~Endgame()
+    {
+        if (checkpointWriter.joinable())
+            checkpointWriter.join();
     }
 
     static const int FirstPieceOffsets[10] =
@@ -176,173 +360,2619 @@ namespace CosineKitty
             0,  8, 16, 24, 32, 40, 48, 56
         },
 
-        // 6 = rotate left
+        // 6 = rotate left
+        {
+            56, 48, 40, 32, 24, 16,  8,  0,
+            57, 49, 41, 33, 25, 17,  9,  1,
+            58, 50, 42, 34, 26, 18, 10,  2,
+            59, 51, 43, 35, 27, 19, 11,  3,
+            60, 52, 44, 36, 28, 20, 12,  4,
+            61, 53, 45, 37, 29, 21, 13,  5,
+            62, 54, 46, 38, 30, 22, 14,  6,
+            63, 55, 47, 39, 31, 23, 15,  7
+        },
+
+        // 7 = backslash
+        {
+            63, 55, 47, 39, 31, 23, 15,  7,
+            62, 54, 46, 38, 30, 22, 14,  6,
+            61, 53, 45, 37, 29, 21, 13,  5,
+            60, 52, 44, 36, 28, 20, 12,  4,
+            59, 51, 43, 35, 27, 19, 11,  3,
+            58, 50, 42, 34, 26, 18, 10,  2,
+            57, 49, 41, 33, 25, 17,  9,  1,
+            56, 48, 40, 32, 24, 16,  8,  0
+        },
+    };
+
+    struct KingPairTable
+    {
+        int pairIndex[10][64];      // [Black King FirstDisplacements][White King displacement] = pair number, or -1
+        int bkFirst[NumKingPairs];  // Black King FirstDisplacements value for each pair number
+        int wkDisp[NumKingPairs];   // White King displacement for each pair number
+        std::vector<int> successors[2][NumKingPairs];   // [0=White, 1=Black to move][pair] = pairs reachable in one move
+
+        struct KingSymmetry
+        {
+            short       pair;           // canonical King pair, or -1 if the Kings are touching
+            signed char symmetry;       // the first symmetry that maps the Kings onto 'pair'
+            signed char tieSymmetry;    // a second symmetry giving the same pair, or -1; happens only on the diagonal
+        };
+
+        KingSymmetry kingSymmetry[64][64];  // [Black King displacement][White King displacement]
+
+        KingPairTable()
+        {
+            // Number the legal King pairs in the same order as the original index.
+            // When the Black King is on the a1-h8 diagonal, the position can be reflected
+            // about that diagonal, so keep only White King squares on or below it.
+            // That matches the original choice of the smallest index among symmetries.
+            int count = 0;
+            for (int b = 0; b < 10; ++b)
+            {
+                int bd = Displacements[FirstPieceOffsets[b]];
+                int bx = bd % 8, by = bd / 8;
+                for (int w = 0; w < 64; ++w)
+                {
+                    int wx = w % 8, wy = w / 8;
+                    bool touching = (abs(wx - bx) <= 1) && (abs(wy - by) <= 1);
+                    bool reflected = (bx == by) && (wy > wx);
+                    if (touching || reflected || count == NumKingPairs)
+                    {
+                        pairIndex[b][w] = -1;
+                    }
+                    else
+                    {
+                        pairIndex[b][w] = count;
+                        bkFirst[count] = b;
+                        wkDisp[count] = w;
+                        ++count;
+                    }
+                }
+            }
+
+            // The Kings alone decide which symmetry makes a position canonical,
+            // except when both symmetries that keep the Black King in place give the same pair.
+            // Then the other pieces break the tie, exactly as the smallest index would.
+            for (int bd = 0; bd < 64; ++bd)
+            {
+                for (int wd = 0; wd < 64; ++wd)
+                {
+                    KingSymmetry& ks = kingSymmetry[bd][wd];
+                    ks.pair = -1;
+                    ks.symmetry = ks.tieSymmetry = -1;
+                    for (int s = 0; s < NumSymmetries; ++s)
+                    {
+                        int b = FirstDisplacements[PieceOffsets[SymmetryTable[s][bd]]];
+                        int p = (b >= 0) ? pairIndex[b][SymmetryTable[s][wd]] : -1;
+                        if (p < 0)
+                            continue;
+
+                        if (ks.pair < 0 || p < ks.pair)
+                        {
+                            ks.pair = static_cast<short>(p);
+                            ks.symmetry = static_cast<signed char>(s);
+                            ks.tieSymmetry = -1;
+                        }
+                        else if (p == ks.pair)
+                        {
+                            ks.tieSymmetry = static_cast<signed char>(s);
+                        }
+                    }
+                }
+            }
+
+            // Moving any piece but a King leaves the King pair alone.
+            // A King move can land in any pair next to it, once put back into canonical form.
+            static const int dx[8] = { -1, 0, 1, -1, 1, -1, 0, 1 };
+            static const int dy[8] = { -1, -1, -1, 0, 0, 1, 1, 1 };
+            for (int p = 0; p < NumKingPairs; ++p)
+            {
+                int bd = Displacements[FirstPieceOffsets[bkFirst[p]]];
+                int wd = wkDisp[p];
+                for (int side = 0; side < 2; ++side)
+                {
+                    std::vector<int>& list = successors[side][p];
+                    list.push_back(p);
+                    int kd = (side == 0) ? wd : bd;
+                    for (int dir = 0; dir < 8; ++dir)
+                    {
+                        int x = kd % 8 + dx[dir];
+                        int y = kd / 8 + dy[dir];
+                        if (x < 0 || x > 7 || y < 0 || y > 7)
+                            continue;
+
+                        int q = (side == 0) ? kingSymmetry[bd][8*y + x].pair : kingSymmetry[8*y + x][wd].pair;
+                        if (q >= 0 && std::find(list.begin(), list.end(), q) == list.end())
+                            list.push_back(q);
+                    }
+                }
+            }
+        }
+    };
+
+    static const KingPairTable KingPairs;
+
+    inline std::size_t SquarePair(int a, int b)
+    {
+        // Number an unordered pair of different squares (displacements):
+        // all the pairs whose higher square is below 'high' come first.
+        const int high = (a > b) ? a : b;
+        const int low = (a > b) ? b : a;
+        if (CheckedBuild && high == low)
+            throw ChessException("SquarePair: both pieces are on the same square");
+        return static_cast<std::size_t>(high * (high - 1) / 2 + low);
+    }
+
+    struct SquarePairTable
+    {
+        signed char low[NumSquarePairs];    // [pair number] = the lower displacement of the pair
+        signed char high[NumSquarePairs];   // [pair number] = the higher displacement
+
+        SquarePairTable()
+        {
+            for (int h = 1; h < 64; ++h)
+            {
+                for (int l = 0; l < h; ++l)
+                {
+                    low[SquarePair(l, h)] = static_cast<signed char>(l);
+                    high[SquarePair(l, h)] = static_cast<signed char>(h);
+                }
+            }
+        }
+    };
+
+    static const SquarePairTable SquarePairs;
+
+    // The compiled generators.
+    // The passes normally place the pieces on a GeneratorBoard and ask it for moves,
+    // which works for any piece list. For piece lists of up to MaxCompiledPieces,
+    // a generator is compiled for the exact pieces present: it works on piece displacements,
+    // the loops over the pieces unroll, the index arithmetic is fixed, and the cases for
+    // pieces that are not there disappear. White's moves are tried in the same order
+    // as ChessBoard::GenWhiteMoves, so the first winning move found, and therefore
+    // every table entry, is the same either way.
+
+    template <Square... WhitePieces>
+    struct PieceSet
+    {
+        static const std::size_t N = 2 + sizeof...(WhitePieces);
+
+        static constexpr Square Kind(std::size_t i)
+        {
+            const Square kind[N] = { BlackKing, WhiteKing, WhitePieces... };
+            return kind[i];
+        }
+
+        static constexpr std::size_t FirstPawn()    // N if there are no pawns
+        {
+            std::size_t i = 2;
+            while (i < N && Kind(i) != WhitePawn)
+                ++i;
+            return i;
+        }
+
+        typedef std::integral_constant<bool, (FirstPawn() < N)> HasPawns;
+
+        static constexpr std::size_t Pair(int which)   // Endgame::pairFirst (which = 0) or pairSecond (which = 1)
+        {
+            for (std::size_t i = 2; i < N && FirstPawn() == N; ++i)
+                for (std::size_t k = i+1; k < N; ++k)
+                    if (Kind(k) == Kind(i))
+                        return (which == 0) ? i : k;
+            return 0;
+        }
+    };
+
+    static const int KingDirs[8] = { North, NorthEast, East, SouthEast, South, SouthWest, West, NorthWest };
+    static const int KnightDirs[8] = { KnightDir1, KnightDir2, KnightDir3, KnightDir4, KnightDir5, KnightDir6, KnightDir7, KnightDir8 };
+
+    inline uint64_t SquareBit(int d)
+    {
+        return uint64_t(1) << d;
+    }
+
+    struct CompiledTables
+    {
+        signed char kingStep[64][8];    // [displacement][KingDirs index] = neighboring displacement, or -1 off the board
+        signed char knightStep[64][8];  // [displacement][KnightDirs index] = knight move displacement, or -1
+        uint64_t    king[64];           // squares a King attacks
+        uint64_t    knight[64];         // squares a Knight attacks
+        uint64_t    pawn[64];           // squares a White pawn attacks
+        uint64_t    between[64][64];    // squares strictly between two squares on the same line
+        signed char line[64][64];       // 1 = same rank or file, 2 = same diagonal, 0 = neither
+
+        CompiledTables()
+        {
+            memset(line, 0, sizeof(line));
+            memset(between, 0, sizeof(between));
+            for (int d = 0; d < 64; ++d)
+            {
+                king[d] = knight[d] = pawn[d] = 0;
+                for (int k = 0; k < 8; ++k)
+                {
+                    kingStep[d][k] = static_cast<signed char>(Displacements[PieceOffsets[d] + KingDirs[k]]);
+                    knightStep[d][k] = static_cast<signed char>(Displacements[PieceOffsets[d] + KnightDirs[k]]);
+                    if (kingStep[d][k] >= 0)
+                        king[d] |= SquareBit(kingStep[d][k]);
+                    if (knightStep[d][k] >= 0)
+                        knight[d] |= SquareBit(knightStep[d][k]);
+                }
+
+                for (int dir : { NorthWest, NorthEast })
+                    if (Displacements[PieceOffsets[d] + dir] >= 0)
+                        pawn[d] |= SquareBit(Displacements[PieceOffsets[d] + dir]);
+            }
+
+            // Follow each ray from every square. The even KingDirs are the orthogonal ones.
+            for (int d = 0; d < 64; ++d)
+            {
+                for (int k = 0; k < 8; ++k)
+                {
+                    uint64_t passed = 0;
+                    for (int t = kingStep[d][k]; t >= 0; t = kingStep[t][k])
+                    {
+                        line[d][t] = (k % 2 == 0) ? 1 : 2;
+                        between[d][t] = passed;
+                        passed |= SquareBit(t);
+                    }
+                }
+            }
+        }
+    };
+
+    static const CompiledTables Compiled;
+
+    template <typename Set>
+    static bool AttackedByWhite(int target, const int *disp, uint64_t occupied, std::size_t captured)
+    {
+        // Is the 'target' square attacked by any White piece except the one at index 'captured'?
+        // Sliding pieces are blocked by any square in 'occupied'.
+        const uint64_t bit = SquareBit(target);
+        for (std::size_t i = 1; i < Set::N; ++i)
+        {
+            if (i == captured)
+                continue;
+
+            const int d = disp[i];
+            switch (Set::Kind(i))
+            {
+            case WhiteKing:
+                if (Compiled.king[d] & bit)
+                    return true;
+                break;
+
+            case WhiteQueen:
+                if (Compiled.line[d][target] != 0 && (Compiled.between[d][target] & occupied) == 0)
+                    return true;
+                break;
+
+            case WhiteRook:
+                if (Compiled.line[d][target] == 1 && (Compiled.between[d][target] & occupied) == 0)
+                    return true;
+                break;
+
+            case WhiteBishop:
+                if (Compiled.line[d][target] == 2 && (Compiled.between[d][target] & occupied) == 0)
+                    return true;
+                break;
+
+            case WhiteKnight:
+                if (Compiled.knight[d] & bit)
+                    return true;
+                break;
+
+            case WhitePawn:
+                if (Compiled.pawn[d] & bit)
+                    return true;
+                break;
+
+            default:
+                break;
+            }
+        }
+        return false;
+    }
+
+    template <typename Set>
+    static bool CompiledUnrank(std::size_t index, int *disp, std::false_type)
+    {
+        // The same as Endgame::UnrankPosition, giving displacements instead of offsets.
+        for (std::size_t i = Set::N-1; i > 1; --i)
+        {
+            if (i == Set::Pair(1))
+                continue;
+
+            if (i == Set::Pair(0))
+            {
+                disp[i] = SquarePairs.low[index % NumSquarePairs];
+                disp[Set::Pair(1)] = SquarePairs.high[index % NumSquarePairs];
+                index /= NumSquarePairs;
+            }
+            else
+            {
+                disp[i] = index % 64;
+                index /= 64;
+            }
+        }
+
+        if (CheckedBuild && index >= NumKingPairs)
+            throw ChessException("CompiledUnrank: Invalid index residue");
+
+        disp[0] = Displacements[FirstPieceOffsets[KingPairs.bkFirst[index]]];
+        disp[1] = KingPairs.wkDisp[index];
+
+        for (std::size_t i = 2; i < Set::N; ++i)
+            for (std::size_t k = 0; k < i; ++k)
+                if (disp[i] == disp[k])
+                    return false;
+
+        return true;
+    }
+
+    template <typename Set>
+    static bool CompiledUnrank(std::size_t index, int *disp, std::true_type)
+    {
+        for (std::size_t i = Set::N; i-- > 0; )
+        {
+            if (Set::Kind(i) != WhitePawn)
+            {
+                disp[i] = index % 64;
+                index /= 64;
+            }
+        }
+
+        for (std::size_t i = Set::N; i-- > Set::FirstPawn()+1; )
+        {
+            if (Set::Kind(i) == WhitePawn)
+            {
+                disp[i] = 8 + index % 48;
+                index /= 48;
+            }
+        }
+
+        if (CheckedBuild && index >= 24)
+            throw ChessException("CompiledUnrank: Invalid index residue");
+
+        disp[Set::FirstPawn()] = 8*(1 + index/4) + (index % 4);
+
+        for (std::size_t i = 1; i < Set::N; ++i)
+            for (std::size_t k = 0; k < i; ++k)
+                if (disp[i] == disp[k])
+                    return false;
+
+        return true;
+    }
+
+    template <typename Set>
+    static std::size_t CompiledAppend(std::size_t index, const int *disp, int symmetry)
+    {
+        // The same as Endgame::AppendPieces, for displacements.
+        for (std::size_t i = 2; i < Set::N; ++i)
+        {
+            if (i == Set::Pair(0))
+                index = (NumSquarePairs * index) + SquarePair(SymmetryTable[symmetry][disp[i]], SymmetryTable[symmetry][disp[Set::Pair(1)]]);
+            else if (i != Set::Pair(1))
+                index = (64 * index) + SymmetryTable[symmetry][disp[i]];
+        }
+        return index;
+    }
+
+    template <typename Set>
+    static Position CompiledCanonical(const int *disp, std::size_t length, std::false_type)
+    {
+        // The same as Endgame::CanonicalPosition, for displacements.
+        const KingPairTable::KingSymmetry& ks = KingPairs.kingSymmetry[disp[0]][disp[1]];
+        if (ks.pair < 0)
+            return Position(length, 0);
+
+        std::size_t index = CompiledAppend<Set>(ks.pair, disp, ks.symmetry);
+        if (ks.tieSymmetry >= 0)
+        {
+            std::size_t tie = CompiledAppend<Set>(ks.pair, disp, ks.tieSymmetry);
+            if (tie < index)
+                return Position(tie, ks.tieSymmetry);
+        }
+
+        return Position(index, ks.symmetry);
+    }
+
+    template <typename Set>
+    static Position CompiledCanonical(const int *disp, std::size_t length, std::true_type)
+    {
+        const int symmetry = (disp[Set::FirstPawn()] % 8 > 3) ? 1 : 0;
+        std::size_t index = 0;
+        for (std::size_t i = 2; i < Set::N; ++i)
+        {
+            if (Set::Kind(i) == WhitePawn)
+            {
+                int d = SymmetryTable[symmetry][disp[i]];
+                if (d < 8 || d >= 56)
+                    return Position(length, symmetry);
+
+                index = (i == Set::FirstPawn()) ? (4*(d/8 - 1) + (d % 8)) : ((48 * index) + (d - 8));
+            }
+        }
+
+        for (std::size_t i = 0; i < Set::N; ++i)
+            if (Set::Kind(i) != WhitePawn)
+                index = (64 * index) + SymmetryTable[symmetry][disp[i]];
+
+        return Position(index, symmetry);
+    }
+
+    struct CompiledMove     // a legal White move found by a compiled generator
+    {
+        signed char piece;      // index of the piece that moves
+        signed char dest;       // displacement it moves to
+        signed char promotion;  // Move::Promotion() kind, or -1 if not a promotion
+    };
+
+    template <typename Set>
+    static int CompiledWhiteMoves(const int *disp, uint64_t occupied, CompiledMove *movelist)
+    {
+        // Generate White's legal moves in the order ChessBoard::GenWhiteMoves would:
+        // pieces from file a to h and rank 1 to 8 within a file, each in its own direction order.
+        // The position is legal, so no White piece attacks the Black King, and only the
+        // White King can move into check. Black has nothing else for White to capture.
+        std::size_t order[Set::N];
+        for (std::size_t i = 1; i < Set::N; ++i)
+        {
+            std::size_t k = i;
+            const int key = 8*(disp[i] % 8) + (disp[i] / 8);
+            for (; k > 1 && 8*(disp[order[k-1]] % 8) + (disp[order[k-1]] / 8) > key; --k)
+                order[k] = order[k-1];
+            order[k] = i;
+        }
+
+        static const int QueenDirs[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };     // indexes into KingDirs
+        static const int RookDirs[4] = { 0, 2, 4, 6 };
+        static const int BishopDirs[4] = { 1, 3, 5, 7 };
+        const uint64_t white = occupied & ~SquareBit(disp[0]);
+        int length = 0;
+        for (std::size_t k = 1; k < Set::N; ++k)
+        {
+            const std::size_t i = order[k];
+            const int d = disp[i];
+            const signed char piece = static_cast<signed char>(i);
+            const int *dirs = nullptr;
+            int ndirs = 0;
+            switch (Set::Kind(i))
+            {
+            case WhiteKing:
+                for (int dir = 0; dir < 8; ++dir)
+                {
+                    const int t = Compiled.kingStep[d][dir];
+                    if (t >= 0 && (white & SquareBit(t)) == 0 && (Compiled.king[disp[0]] & SquareBit(t)) == 0)
+                        movelist[length++] = CompiledMove { piece, static_cast<signed char>(t), -1 };
+                }
+                break;
+
+            case WhiteKnight:
+                for (int dir = 0; dir < 8; ++dir)
+                {
+                    const int t = Compiled.knightStep[d][dir];
+                    if (t >= 0 && (white & SquareBit(t)) == 0)
+                        movelist[length++] = CompiledMove { piece, static_cast<signed char>(t), -1 };
+                }
+                break;
+
+            case WhitePawn:
+                if ((occupied & SquareBit(d + 8)) == 0)
+                {
+                    if (d + 8 >= 56)
+                    {
+                        for (signed char kind = 0; kind < NumPromotions; ++kind)
+                            movelist[length++] = CompiledMove { piece, static_cast<signed char>(d + 8), kind };
+                    }
+                    else
+                    {
+                        movelist[length++] = CompiledMove { piece, static_cast<signed char>(d + 8), -1 };
+                        if (d < 16 && (occupied & SquareBit(d + 16)) == 0)
+                            movelist[length++] = CompiledMove { piece, static_cast<signed char>(d + 16), -1 };
+                    }
+                }
+                break;
+
+            case WhiteQueen:
+                dirs = QueenDirs;
+                ndirs = 8;
+                break;
+
+            case WhiteRook:
+                dirs = RookDirs;
+                ndirs = 4;
+                break;
+
+            case WhiteBishop:
+                dirs = BishopDirs;
+                ndirs = 4;
+                break;
+
+            default:
+                break;
+            }
+
+            for (int r = 0; r < ndirs; ++r)
+            {
+                const int dir = dirs[r];
+                for (int t = Compiled.kingStep[d][dir]; t >= 0 && (occupied & SquareBit(t)) == 0; t = Compiled.kingStep[t][dir])
+                    movelist[length++] = CompiledMove { piece, static_cast<signed char>(t), -1 };
+            }
+        }
+        return length;
+    }
+
+    template <typename Set>
+    int Endgame::ScoreWhiteCompiled(Worker& worker, int *disp, int mateInMoves)
+    {
+        // The same as ScoreWhite, for the compiled piece list.
+        PassCounters& counters = worker.counters;
+        ++counters.visited;
+        uint64_t occupied = 0;
+        for (std::size_t i = 0; i < Set::N; ++i)
+            occupied |= SquareBit(disp[i]);
+
+        if (AttackedByWhite<Set>(disp[0], disp, occupied, Set::N))
+        {
+            ++counters.illegal;
+            return 0;
+        }
+
+        Position pos = CompiledCanonical<Set>(disp, length, typename Set::HasPawns());
+        ++counters.tableIndex;
+        if (whiteTable.at(pos.index).score != Unscored)
+        {
+            ++counters.skipped;
+            return 0;
+        }
+
+        CompiledMove movelist[MaxMoves];
+        const int nmoves = CompiledWhiteMoves<Set>(disp, occupied, movelist);
+        CheckMemory(worker, 1 + nmoves);
+        ++counters.genMoves;
+        counters.moves += nmoves;
+        if (nmoves == 0)
+        {
+            // Only blocked pawns can leave White without a move.
+            whiteTable.at(pos.index) = Move(Draw);
+            return 1;
+        }
+
+        int requiredScore = (WhiteMates + 1) - 2*mateInMoves;
+        for (int i = 0; i < nmoves; ++i)
+        {
+            const CompiledMove& cm = movelist[i];
+            const int source = disp[cm.piece];
+            Move move(PieceOffsets[source], PieceOffsets[cm.dest]);
+            short score;
+            ++counters.tableIndex;
+            if (cm.promotion >= 0)
+            {
+                int offsetList[Set::N];
+                for (std::size_t k = 0; k < Set::N; ++k)
+                    offsetList[k] = PieceOffsets[disp[k]];
+                move = move.Promoted(cm.promotion);
+                score = PromotionScore(offsetList, move);
+            }
+            else
+            {
+                disp[cm.piece] = cm.dest;
+                Position next = CompiledCanonical<Set>(disp, length, typename Set::HasPawns());
+                disp[cm.piece] = source;
+                if (CheckedBuild && next.index >= length)
+                    throw ChessException("ScoreWhiteCompiled: index is out of range");
+                score = blackTable.at(next.index);
+            }
+            move.score = score - 1;     // penalize forced wins by one ply
+
+            if (move.score == requiredScore)
+            {
+                whiteTable.at(pos.index) = pos.RotateMove(move);
+                return 1;
+            }
+
+            if (move.score > Draw && move.score < requiredScore)
+            {
+                int due = ((WhiteMates + 1) - move.score) / 2;
+                if (worker.duePass == 0 || due < worker.duePass)
+                    worker.duePass = due;
+            }
+        }
+
+        return 0;
+    }
+
+    template <typename Set>
+    int Endgame::ScoreBlackCompiled(Worker& worker, int *disp, int mateInMoves)
+    {
+        // The same as ScoreBlack, for the compiled piece list.
+        PassCounters& counters = worker.counters;
+        ++counters.visited;
+        const int bk = disp[0];
+        if (Compiled.king[bk] & SquareBit(disp[1]))
+        {
+            ++counters.illegal;
+            return 0;   // the Kings are touching
+        }
+
+        Position pos = CompiledCanonical<Set>(disp, length, typename Set::HasPawns());
+        ++counters.tableIndex;
+        if (blackTable.at(pos.index) != Unscored)
+        {
+            ++counters.skipped;
+            return 0;
+        }
+
+        // The Black King's moves, in the order ChessBoard::GenBlackMoves tries them.
+        // The square it leaves no longer blocks White's sliding pieces,
+        // and a piece it captures no longer attacks anything.
+        uint64_t occupied = 0;
+        for (std::size_t i = 1; i < Set::N; ++i)
+            occupied |= SquareBit(disp[i]);
+
+        int dest[8];
+        std::size_t captured[8];
+        int nmoves = 0;
+        for (int dir = 0; dir < 8; ++dir)
+        {
+            const int t = Compiled.kingStep[bk][dir];
+            if (t < 0)
+                continue;
+
+            std::size_t capture = Set::N;
+            for (std::size_t i = 2; i < Set::N; ++i)
+                if (disp[i] == t)
+                    capture = i;
+
+            if (!AttackedByWhite<Set>(t, disp, occupied, capture))
+            {
+                dest[nmoves] = t;
+                captured[nmoves] = capture;
+                ++nmoves;
+            }
+        }
+
+        CheckMemory(worker, 1 + nmoves);
+        ++counters.genMoves;
+        counters.moves += nmoves;
+        if (nmoves == 0)
+        {
+            short score = AttackedByWhite<Set>(bk, disp, occupied, Set::N) ? WhiteMates : Draw;
+            blackTable.at(pos.index) = score;
+            return 1;
+        }
+
+        int unresolvedCount = 0;
+        short bestScore = PosInf;
+        for (int i = 0; i < nmoves; ++i)
+        {
+            short score;
+            if (captured[i] < Set::N)
+            {
+                int offsetList[Set::N];
+                for (std::size_t k = 0; k < Set::N; ++k)
+                    offsetList[k] = PieceOffsets[disp[k]];
+                score = CaptureScore(offsetList, PieceOffsets[dest[i]]);
+                if (Set::N > 3)
+                    ++counters.tableIndex;
+            }
+            else
+            {
+                ++counters.tableIndex;
+                disp[0] = dest[i];
+                Position next = CompiledCanonical<Set>(disp, length, typename Set::HasPawns());
+                disp[0] = bk;
+                if (CheckedBuild && next.index >= length)
+                    throw ChessException("ScoreBlackCompiled: index is out of range");
+                score = whiteTable.at(next.index).score;
+            }
+
+            if (score == Unscored)
+            {
+                ++unresolvedCount;
+            }
+            else if (score > Draw)
+            {
+                --score;
+                if (score < bestScore)
+                    bestScore = score;
+            }
+            else if (score == Draw)
+            {
+                blackTable.at(pos.index) = Draw;
+                return 1;
+            }
+            else if (CheckedBuild)
+            {
+                throw ChessException("ScoreBlackCompiled: Unexpected win for Black");
+            }
+        }
+
+        if (unresolvedCount > 0)
+            return 0;
+
+        if (bestScore < (WhiteMates + 2) - 2*mateInMoves)
+        {
+            int due = ((WhiteMates + 2) - bestScore) / 2;
+            if (worker.duePass == 0 || due < worker.duePass)
+                worker.duePass = due;
+            if (!deferred.empty())
+                deferred[pos.index / 64].fetch_or(uint64_t(1) << (pos.index % 64), std::memory_order_relaxed);
+            return 0;
+        }
+
+        if (CheckedBuild && (bestScore <= Draw || bestScore >= WhiteMates))
+            throw ChessException("ScoreBlackCompiled: impossible score");
+
+        blackTable.at(pos.index) = bestScore;
+        return 1;
+    }
+
+    template <typename Set>
+    int Endgame::ScoreCompiled(Worker& worker, std::size_t index, Side side, int mateInMoves)
+    {
+        int disp[Set::N];
+        if (!CompiledUnrank<Set>(index, disp, typename Set::HasPawns()))
+            return 0;
+
+        return (side == White) ? ScoreWhiteCompiled<Set>(worker, disp, mateInMoves) : ScoreBlackCompiled<Set>(worker, disp, mateInMoves);
+    }
+
+    template <bool Deeper, Square... WhitePieces>
+    struct CompiledGenerator
+    {
+        // Match the rest of the piece list, starting at pieces[next], one piece at a time,
+        // to find the instantiation compiled for the whole list.
+        static Endgame::ScoreFunction Find(const std::vector<Square>& pieces, std::size_t next)
+        {
+            if (next == pieces.size())
+                return &Endgame::ScoreCompiled<PieceSet<WhitePieces...>>;
+
+            const bool deeper = (3 + sizeof...(WhitePieces) < MaxCompiledPieces);
+            switch (pieces[next])
+            {
+            case WhiteQueen:    return CompiledGenerator<deeper, WhitePieces..., WhiteQueen>::Find(pieces, next+1);
+            case WhiteRook:     return CompiledGenerator<deeper, WhitePieces..., WhiteRook>::Find(pieces, next+1);
+            case WhiteBishop:   return CompiledGenerator<deeper, WhitePieces..., WhiteBishop>::Find(pieces, next+1);
+            case WhiteKnight:   return CompiledGenerator<deeper, WhitePieces..., WhiteKnight>::Find(pieces, next+1);
+            case WhitePawn:     return CompiledGenerator<deeper, WhitePieces..., WhitePawn>::Find(pieces, next+1);
+            default:            return nullptr;
+            }
+        }
+    };
+
+    template <Square... WhitePieces>
+    struct CompiledGenerator<false, WhitePieces...>
+    {
+        static Endgame::ScoreFunction Find(const std::vector<Square>& pieces, std::size_t next)
+        {
+            // No room for more pieces: the list is compiled only if it ends here.
+            return (next == pieces.size()) ? &Endgame::ScoreCompiled<PieceSet<WhitePieces...>> : nullptr;
+        }
+    };
+
+    int Endgame::UnitTest()
+    {
+        using namespace std;
+
+        int i, s;
+
+        // Confirm displacement/offset conversions.
+        for (i = 0; i < 10; ++i)
+        {
+            if (i != FirstDisplacements[FirstPieceOffsets[i]])
+            {
+                cerr << "FAIL: i=" << i << ", FirstPieceOffsets[i]=" << FirstPieceOffsets[i] << ", FirstDisplacements=" << FirstDisplacements[FirstPieceOffsets[i]] << endl;
+                return 1;
+            }
+        }
+
+        for (i = 0; i < 64; ++i)
+        {
+            if (i != Displacements[PieceOffsets[i]])
+            {
+                cerr << "FAIL: i=" << i << ", PieceOffsets[i]=" << PieceOffsets[i] << ", Displacements=" << Displacements[PieceOffsets[i]] << endl;
+                return 1;
+            }
+        }
+
+        for (s = 0; s < NumSymmetries; ++s)
+        {
+            // Confirm that there every value 0..63 is represented exactly once in each symmetry.
+            int count[64] = { 0 };
+            for (i = 0; i < 64; ++i)
+                ++count[SymmetryTable[s][i]];
+
+            for (i = 0; i < 64; ++i)
+            {
+                if (count[i] != 1)
+                {
+                    cerr << "FAIL: SymmetryTable[" << s << "] does not hold 0..63" << endl;
+                    return 1;
+                }
+            }
+
+            // Verify inverse symmetries.
+            for (i = 0; i < 64; ++i)
+            {
+                int k = SymmetryTable[s][i];
+                int r = SymmetryTable[InverseSymmetry[s]][k];
+                if (i != r)
+                {
+                    cerr << "FAIL: InverseSymmetry[" << s << "] is broken." << endl;
+                    return 1;
+                }
+            }
+        }
+
+        // Confirm the King pair numbering covers exactly the 462 legal pairs.
+        int npairs = 0;
+        for (i = 0; i < 10; ++i)
+            for (s = 0; s < 64; ++s)
+                if (KingPairs.pairIndex[i][s] >= 0)
+                    ++npairs;
+
+        if (npairs != NumKingPairs || KingPairs.pairIndex[9][63] != NumKingPairs-1)
+        {
+            cerr << "FAIL: KingPairTable holds " << npairs << " pairs." << endl;
+            return 1;
+        }
+
+        // Every index that holds a real placement must rank back to itself.
+        Endgame db("q");
+        vector<int> offset;
+        for (size_t index = 0; index < db.length; ++index)
+        {
+            if (db.UnrankPosition(index, offset))
+            {
+                Position pos = db.RankPosition(offset, 0);
+                if (pos.index != index)
+                {
+                    cerr << "FAIL: index " << index << " ranks back to " << pos.index << endl;
+                    return 1;
+                }
+            }
+        }
+
+        // The King-pair symmetry table must choose exactly what the 8-way search does,
+        // for every placement of the Kings and for a piece anywhere else.
+        int raw[3];
+        for (int b = 0; b < 64; ++b)
+        {
+            for (int w = 0; w < 64; ++w)
+            {
+                for (int q = 0; q < 64; ++q)
+                {
+                    if (b == w || b == q || w == q)
+                        continue;
+
+                    raw[0] = PieceOffsets[b];
+                    raw[1] = PieceOffsets[w];
+                    raw[2] = PieceOffsets[q];
+                    Position fast = db.CanonicalPosition(raw);
+                    Position slow = db.SearchCanonicalPosition(raw);
+                    if (fast.index != slow.index || fast.symmetry != slow.symmetry)
+                    {
+                        cerr << "FAIL: CanonicalPosition disagrees with the 8-way search for " << b << " " << w << " " << q << endl;
+                        return 1;
+                    }
+                }
+            }
+        }
+
+        // Two identical pieces are indexed as one unordered pair, wherever they are in the list,
+        // so swapping them must give the same index, with the same symmetry as the 8-way search.
+        for (const char *list : { "rr", "rnr" })
+        {
+            Endgame pair(list);
+            if (pair.pairFirst != 2 || pair.pairSecond != pair.pieces.size() - 1 || pair.length != NumKingPairs * NumSquarePairs * (strlen(list) == 2 ? 1 : 64))
+            {
+                cerr << "FAIL: " << list << " does not index its rooks as a pair" << endl;
+                return 1;
+            }
+
+            const size_t step = (strlen(list) == 2) ? 1 : 61;
+            for (size_t index = 0; index < pair.length; index += step)
+            {
+                if (!pair.UnrankPosition(index, offset))
+                    continue;
+
+                Position pos = pair.RankPosition(offset, 0);
+                Position before = pair.CanonicalPosition(offset.data());
+                swap(offset[pair.pairFirst], offset[pair.pairSecond]);
+                Position fast = pair.CanonicalPosition(offset.data());
+                Position slow = pair.SearchCanonicalPosition(offset.data());
+                if (pos.index != index || fast.index != before.index || fast.index != slow.index || fast.symmetry != slow.symmetry)
+                {
+                    cerr << "FAIL: " << list << " index " << index << " (" << pair.PositionText(index) << ") does not survive swapping its rooks" << endl;
+                    return 1;
+                }
+            }
+        }
+
+        // Round-trip a table through a binary file.
+        db.whiteTable.Allocate(db.length, Move());
+        db.blackTable.Allocate(db.length, Unscored);
+        for (size_t index = 0; index < db.length; ++index)
+        {
+            db.whiteTable[index] = Move(static_cast<short>(index % 1000));
+            db.blackTable[index] = static_cast<short>(-(index % 777));
+        }
+
+        const char *filename = "unittest.egb";
+        db.SaveBinary(filename);
+        Endgame loaded("q");
+        loaded.Load(filename);
+        for (size_t index = 0; index < db.length; ++index)
+        {
+            if (loaded.whiteTable[index].score != db.whiteTable[index].score || loaded.blackTable[index] != db.blackTable[index])
+            {
+                cerr << "FAIL: loaded table differs at index " << index << endl;
+                return 1;
+            }
+        }
+
+        if (!loaded.VerifyChecksums())
+        {
+            cerr << "FAIL: checksums of a freshly saved table do not match." << endl;
+            return 1;
+        }
+
+        // Changes made to a mapped table stay private, but the checksums must notice them.
+        loaded.blackTable[12345] ^= 1;
+        cerr << "(expecting a corrupt block...) ";
+        if (loaded.VerifyChecksums())
+        {
+            cerr << "FAIL: checksums did not detect a modified entry." << endl;
+            return 1;
+        }
+        cerr << "OK" << endl;
+        loaded.mappedFile.Close();
+        remove(filename);
+
+        // Build the same table inside a shared mapping, dropping its pages as often as possible,
+        // and check that the finished file holds the same entries and valid checksums.
+        {
+            Endgame disk("q");
+            disk.checkpointFile = "unittest.ckpt";
+            disk.diskTables = true;
+            disk.memoryLimit = 1;
+            disk.CreateTableFile(disk.checkpointFile);
+            for (size_t index = 0; index < disk.length; ++index)
+            {
+                disk.whiteTable[index] = db.whiteTable[index];
+                disk.blackTable[index] = db.blackTable[index];
+                if (index % 1000 == 0)
+                    disk.LimitMemory();
+            }
+
+            disk.FinishTableFile(filename);
+            for (size_t index = 0; index < db.length; ++index)
+            {
+                if (disk.whiteTable[index].score != db.whiteTable[index].score || disk.blackTable[index] != db.blackTable[index])
+                {
+                    cerr << "FAIL: disk-backed table differs at index " << index << endl;
+                    return 1;
+                }
+            }
+
+            if (!disk.VerifyChecksums())
+            {
+                cerr << "FAIL: checksums of a disk-backed table do not match." << endl;
+                return 1;
+            }
+        }
+        remove(filename);
+
+        // Round-trip the same table through a block-compressed file, with a cache too small to hold it.
+        filename = "unittest.egz";
+        db.SaveCompressed(filename);
+        {
+            CompressedTable compressed;
+            compressed.Open(filename, db.piecelist, db.length, 2);
+            for (size_t index = 0; index < db.length; ++index)
+            {
+                if (compressed.WhiteEntry(index).score != db.whiteTable[index].score || compressed.BlackEntry(index) != db.blackTable[index])
+                {
+                    cerr << "FAIL: compressed table differs at index " << index << endl;
+                    return 1;
+                }
+            }
+        }
+        remove(filename);
+
+        // A distance table keeps every forced win exactly, and turns everything else into a draw.
+        filename = "unittest.egd";
+        for (size_t index = 0; index < db.length; ++index)
+        {
+            db.whiteTable[index] = Move(static_cast<short>((index % 3) ? (WhiteMates - 1 - 2*(index % 127)) : Unscored));
+            db.blackTable[index] = static_cast<short>((index % 5) ? (WhiteMates - 2*(index % 128)) : Draw);
+        }
+        db.SaveDistances(filename);
+        {
+            DistanceTable distances;
+            distances.Open(filename, db.piecelist, db.length);
+            for (size_t index = 0; index < db.length; ++index)
+            {
+                if (distances.WhiteScore(index) != max(db.whiteTable[index].score, Draw) || distances.BlackScore(index) != db.blackTable[index])
+                {
+                    cerr << "FAIL: distance table differs at index " << index << endl;
+                    return 1;
+                }
+            }
+
+            if (!distances.VerifyChecksums())
+            {
+                cerr << "FAIL: checksums of a distance table do not match." << endl;
+                return 1;
+            }
+        }
+        remove(filename);
+
+        // A bitbase keeps only win or draw for each canonical, legal position.
+        filename = "unittest.egw";
+        db.SaveBitbase(filename, 2);
+        {
+            BitbaseTable bitbase;
+            bitbase.Open(filename, db.piecelist, db.length);
+            size_t live = 0;
+            for (size_t index = 0; index < db.length; ++index)
+            {
+                BitbaseEntry white = bitbase.WhiteEntry(index);
+                BitbaseEntry black = bitbase.BlackEntry(index);
+                if ((white != BitbaseIllegal && white != ((db.whiteTable[index].score > Draw) ? BitbaseWin : BitbaseDraw)) ||
+                    (black != BitbaseIllegal && black != ((db.blackTable[index] > Draw) ? BitbaseWin : BitbaseDraw)))
+                {
+                    cerr << "FAIL: bitbase differs at index " << index << endl;
+                    return 1;
+                }
+                if (white != BitbaseIllegal)
+                    ++live;
+            }
+
+            // White to move with Black in check is illegal; the same placement with Black to move is not.
+            int check[3] = { Offset('h','8'), Offset('a','1'), Offset('h','1') };
+            Position pos = db.TableIndex(check);
+            if (live == 0 || bitbase.WhiteEntry(pos.index) != BitbaseIllegal || bitbase.BlackEntry(pos.index) == BitbaseIllegal || !bitbase.VerifyChecksums())
+            {
+                cerr << "FAIL: bitbase does not mark the legal positions correctly." << endl;
+                return 1;
+            }
+        }
+        remove(filename);
+
+        // Captures in a larger table are scored from the table left behind.
+        Endgame qr("qr");
+        if (qr.SuccessorPieceLists() != vector<string>{"r", "q"})
+        {
+            cerr << "FAIL: wrong capture tables for qr" << endl;
+            return 1;
+        }
+        qr.SetSuccessorTable(&db);
+        vector<int> before { Offset('a','1'), Offset('a','3'), Offset('a','5'), Offset('b','1') };
+        int after[3] = { Offset('b','1'), Offset('a','3'), Offset('a','5') };
+        short expected = db.whiteTable[db.TableIndex(after).index].score;
+        if (qr.CaptureScore(before.data(), Offset('b','1')) != max(expected, static_cast<short>(Draw)))
+        {
+            cerr << "FAIL: capturing the rook in qr does not use the q table." << endl;
+            return 1;
+        }
+
+        // A pawn table also needs a table for each piece the pawn can become.
+        Endgame rp("rp");
+        if (rp.SuccessorPieceLists() != vector<string>{"p", "r", "rq", "rr", "rb", "rn"})
+        {
+            cerr << "FAIL: wrong successor tables for rp" << endl;
+            return 1;
+        }
+
+        // Every pawn index must rank back to itself, and its mirror image must find it too.
+        for (size_t index = 0; index < rp.length; ++index)
+        {
+            if (rp.UnrankPosition(index, offset))
+            {
+                Position pos = rp.RankPosition(offset, 0);
+                for (int& ofs : offset)
+                    ofs = PieceOffsets[SymmetryTable[1][Displacements[ofs]]];
+                if (pos.index != index || rp.TableIndex(offset).index != index)
+                {
+                    cerr << "FAIL: pawn index " << index << " ranks back to " << pos.index << endl;
+                    return 1;
+                }
+            }
+        }
+
+        // Searching every position, setting up each board and trying every move,
+        // must not allocate any memory in either build. Only a build with
+        // -DENDGAME_COUNT_ALLOCATIONS can see allocations; any other counts none.
+        Endgame kq("q");
+        kq.whiteTable.Allocate(kq.length, Move());
+        kq.blackTable.Allocate(kq.length, Unscored);
+        vector<Worker> workers(1);
+        workers[0].offsetList.resize(kq.pieces.size());
+        uint64_t allocations = AllocationCount();
+        int nfound = kq.SearchPass(workers, 1, Black) + kq.SearchPass(workers, 1, White);
+        allocations = AllocationCount() - allocations;
+        if (nfound == 0 || allocations != 0)
+        {
+            cerr << "FAIL: search pass made " << allocations << " allocations and found " << nfound << " positions" << endl;
+            return 1;
+        }
+
+        // The generator compiled for KQ-K must score every position the way the board does.
+        Endgame boardq("q");
+        Endgame compiledq("q");
+        compiledq.scoreIndex = CompiledGenerator<true>::Find(compiledq.pieces, 2);
+        if (compiledq.scoreIndex == nullptr)
+        {
+            cerr << "FAIL: no compiled generator for KQ-K" << endl;
+            return 1;
+        }
+
+        for (Endgame *db : { &boardq, &compiledq })
+        {
+            db->whiteTable.Allocate(db->length, Move());
+            db->blackTable.Allocate(db->length, Unscored);
+            for (int mateInMoves = 1; mateInMoves <= 4; ++mateInMoves)
+                for (Side side : { Black, White })
+                    for (size_t index = 0; index < db->length; ++index)
+                        db->ScoreIndex(workers[0], index, side, mateInMoves);
+        }
+
+        for (size_t index = 0; index < boardq.length; ++index)
+        {
+            const Move& a = boardq.whiteTable[index];
+            const Move& b = compiledq.whiteTable[index];
+            if (a.source != b.source || a.dest != b.dest || a.score != b.score || boardq.blackTable[index] != compiledq.blackTable[index])
+            {
+                cerr << "FAIL: compiled KQ-K generator disagrees at index " << index << endl;
+                return 1;
+            }
+        }
+
+        // Visiting only the live indices must score the same positions as searching every placement.
+        Endgame liveq("q");
+        liveq.whiteTable.Allocate(liveq.length, Move());
+        liveq.blackTable.Allocate(liveq.length, Unscored);
+        liveq.MarkLive(workers);
+        if (liveq.LivePass(workers, 1, Black) + liveq.LivePass(workers, 1, White) != nfound)
+        {
+            cerr << "FAIL: live pass found a different number of positions than the search pass" << endl;
+            return 1;
+        }
+
+        for (size_t index = 0; index < kq.length; ++index)
+        {
+            const Move& a = kq.whiteTable[index];
+            const Move& b = liveq.whiteTable[index];
+            if (a.source != b.source || a.dest != b.dest || a.score != b.score || kq.blackTable[index] != liveq.blackTable[index])
+            {
+                cerr << "FAIL: live pass disagrees with the search pass at index " << index << endl;
+                return 1;
+            }
+        }
+
+        // The web page looks up the original layout's canonical slot of a position, in either order
+        // of an identical pair. Every such slot where White wins must hold the mate and a move
+        // that leaves Black a ply closer to it, and every other slot must be empty.
+        Endgame r("r"), rr("rr");
+        GenerateOptions options;
+        r.Generate(options);
+        rr.SetSuccessorTable(&r);
+        rr.Generate(options);
+        rr.WriteWebTables("unittest_rr");
+
+        const size_t sliceLength = rr.classicLength / 10;
+        vector<unsigned char> web(2 * rr.classicLength);
+        for (int bk = 0; bk < 10; ++bk)
+        {
+            string name = "unittest_rr_" + to_string(bk) + ".bin";
+            FILE *infile = fopen(name.c_str(), "rb");
+            bool ok = (infile != NULL) && (fseek(infile, 8, SEEK_SET) == 0) && (fread(&web[2 * bk * sliceLength], 1, 2 * sliceLength, infile) == 2 * sliceLength);
+            if (infile != NULL)
+                fclose(infile);
+            remove(name.c_str());
+            if (!ok)
+            {
+                cerr << "FAIL: cannot read " << name << endl;
+                return 1;
+            }
+        }
+
+        offset.resize(rr.pieces.size());
+        size_t filled = 0;
+        for (size_t slot = 0; slot < rr.classicLength; ++slot)
+        {
+            size_t rest = slot;
+            for (size_t i = offset.size() - 1; i > 0; --i)
+            {
+                offset[i] = PieceOffsets[rest % 64];
+                rest /= 64;
+            }
+            offset[0] = FirstPieceOffsets[rest];
+
+            bool distinct = true;
+            for (size_t i = 1; i < offset.size(); ++i)
+                for (size_t k = 0; k < i; ++k)
+                    distinct = distinct && (offset[i] != offset[k]);
+
+            const unsigned char *entry = &web[2 * slot];
+            Position pos = distinct ? rr.CanonicalPosition(offset.data()) : Position(rr.length, 0);
+            short score = (pos.index < rr.length && rr.ClassicPosition(offset).index == slot) ? rr.whiteTable[pos.index].score : Draw;
+            if (score <= 0)
+            {
+                if (entry[0] != 0)
+                {
+                    cerr << "FAIL: web table slot " << slot << " is filled, but is not a canonical win" << endl;
+                    return 1;
+                }
+                continue;
+            }
+
+            vector<int> next = offset;
+            next[1 + (entry[1] >> 6)] = PieceOffsets[entry[1] & 63];
+            Position after = rr.CanonicalPosition(next.data());
+            if (entry[0] != ((WhiteMates + 1) - score) / 2 || after.index >= rr.length || rr.blackTable[after.index] != score + 1)
+            {
+                cerr << "FAIL: web table slot " << slot << " does not hold the mate in " << ((WhiteMates + 1) - score) / 2 << endl;
+                return 1;
+            }
+            ++filled;
+        }
+        cout << "Web table for rr: " << filled << " winning slots filled." << endl;
+
+        cout << "EndGame::UnitTest: PASS" << endl;
+        return 0;
+    }
+
+    class Stopwatch
+    {
+    private:
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        Stopwatch()
+            : start(std::chrono::steady_clock::now())
+            {}
+
+        double Seconds() const
+        {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            return elapsed.count();
+        }
+    };
+
+    static bool IsMarked(const std::vector<uint64_t>& bitmap, std::size_t index)
+    {
+        return ((bitmap[index / 64] >> (index % 64)) & 1) != 0;
+    }
+
+    static std::size_t CountDead(const std::vector<uint64_t>& live, std::size_t first, std::size_t count)
+    {
+        // The number of slots in [first, first+count) that are not marked live. Both ends are multiples of 64.
+        std::size_t alive = 0;
+        for (std::size_t w = first / 64; w < (first + count) / 64; ++w)
+            alive += BitCount(live[w]);
+        return count - alive;
+    }
+
+    static void ReportPass(const char *side, int mateInMoves, int nfound, const Stopwatch& timer)
+    {
+        char seconds[32];
+        snprintf(seconds, sizeof(seconds), "%0.3f", timer.Seconds());
+        std::cout << side << " Search(" << mateInMoves << "): found " << nfound << " in " << seconds << " seconds, resident " << (ResidentMemory() >> 20) << " MB" << std::endl;
+    }
+
+    void Endgame::RecordPass(std::vector<Worker>& workers, Side side, int mateInMoves, long slice, std::size_t dead, int nfound, double seconds)
+    {
+        // Add up what the workers counted during the pass, and start them over for the next one.
+        PassStats pass;
+        pass.side = side;
+        pass.mateInMoves = mateInMoves;
+        pass.slice = slice;
+        pass.dead = dead;
+        pass.found = nfound;
+        pass.seconds = seconds;
+        pass.resident = ResidentMemory();
+        for (Worker& worker : workers)
+        {
+            pass.counters.Add(worker.counters);
+            worker.counters = PassCounters();
+        }
+        if (pass.resident > pass.counters.peakResident)
+            pass.counters.peakResident = pass.resident;
+        stats.passes.push_back(pass);
+    }
+
+    template <typename Job>
+    static void RunWorkers(std::vector<Worker>& workers, Job job)
+    {
+        // Run 'job' once for each worker, each on its own thread.
+        // Returning from this function is the barrier between passes.
+        if (workers.size() == 1)
+        {
+            job(workers[0], 0);
+            return;
+        }
+
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> errors(workers.size());
+        for (std::size_t t = 0; t < workers.size(); ++t)
+        {
+            threads.push_back(std::thread([&job, &workers, &errors, t]()
+            {
+                try
+                {
+                    job(workers[t], t);
+                }
+                catch (...)
+                {
+                    errors[t] = std::current_exception();
+                }
+            }));
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        for (std::exception_ptr& error : errors)
+            if (error)
+                std::rethrow_exception(error);
+    }
+
+    const std::size_t OutputChunkEntries = 1 << 16;    // table indices formatted together by one thread
+
+    template <typename Format>
+    static void WriteChunks(FILE *outfile, const std::string& filename, std::size_t length, int numThreads, Format format)
+    {
+        // Format the table in chunks of consecutive indices, with the threads taking chunks in turn,
+        // then write the chunks to the file in order. Each round formats a few chunks per thread,
+        // and the buffers keep their capacity from round to round, so memory use stays bounded
+        // and nothing is allocated per entry.
+        const std::size_t roundChunks = 4 * static_cast<std::size_t>(numThreads);
+        std::vector<std::string> text(roundChunks);
+        std::vector<Worker> workers(numThreads);
+        for (std::size_t first = 0; first < length; first += roundChunks * OutputChunkEntries)
+        {
+            std::atomic<std::size_t> nextChunk(0);
+            RunWorkers(workers, [&text, &nextChunk, &format, roundChunks, first, length](Worker& worker, std::size_t)
+            {
+                for (std::size_t c; (c = nextChunk++) < roundChunks; )
+                {
+                    text[c].clear();
+                    const std::size_t start = first + c * OutputChunkEntries;
+                    if (start < length)
+                        format(worker, start, std::min(length, start + OutputChunkEntries), text[c]);
+                }
+            });
+
+            for (const std::string& chunk : text)
+                if (!chunk.empty() && fwrite(chunk.data(), 1, chunk.size(), outfile) != chunk.size())
+                    throw ChessException(std::string("Error writing to file: ") + filename);
+        }
+    }
+
+    static char *FormatNumber(char *p, std::size_t value, int width)
+    {
+        // Right-justify 'value' in at least 'width' characters, like printf's "%*lu".
+        char digits[24];
+        int n = 0;
+        do
+        {
+            digits[n++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+
+        while (width-- > n)
+            *p++ = ' ';
+        while (n > 0)
+            *p++ = digits[--n];
+        return p;
+    }
+
+    bool Endgame::Generate(const GenerateOptions& options)
+    {
+        using namespace std;
+
+        if (options.numThreads < 1)
+            throw ChessException("Generate: number of threads must be at least 1.");
+
+        if (options.resume && options.checkpointFile.empty())
+            throw ChessException("Generate: cannot resume without a checkpoint file.");
+
+        if (options.diskTables && options.checkpointFile.empty())
+            throw ChessException("Generate: building the tables on disk requires a checkpoint file.");
+
+        // Captures are scored from the smaller tables, so they must all be ready first.
+        // So are promotions, from the tables with the new piece in place of the pawn.
+        if (piecelist.size() > 1)
+            for (std::size_t i = 0; i < piecelist.size(); ++i)
+                if (captureTables[i+2] == nullptr)
+                    throw ChessException("Generate: " + piecelist + " needs the table for " + piecelist.substr(0, i) + piecelist.substr(i+1) + "; generate it first.");
+
+        for (std::size_t i = 0; i < piecelist.size(); ++i)
+            if (pieces[i+2] == WhitePawn)
+                for (int kind = 0; kind < NumPromotions; ++kind)
+                    if (promotionTables[i+2][kind] == nullptr)
+                        throw ChessException("Generate: " + piecelist + " needs the table for " + PromotionPieceList(piecelist, i, kind) + "; generate it first.");
+
+        Stopwatch timer;
+        stopFlag = options.stop;
+        checkpointFile = options.checkpointFile;
+        diskTables = options.diskTables;
+        memoryLimit = options.memoryLimit;
+        sampleMemory = !options.statsFile.empty();
+        scoreIndex = options.generic ? nullptr : CompiledGenerator<true>::Find(pieces, 2);
+
+        // Pawn tables are always solved a slice at a time, so --retrograde does not apply to them.
+        const bool retrograde = options.retrograde && numSlices == 0;
+        CheckpointRecord progress;
+        memset(&progress, 0, sizeof(progress));
+        progress.retrograde = retrograde ? 1 : 0;
+        stats = GenerateStats();
+        stats.method = (numSlices > 0) ? "slices" : retrograde ? "retrograde" : "forward";
+        stats.threads = options.numThreads;
+        stats.compiled = (scoreIndex != nullptr);
+
+        // Pruning is only exact when the bishops have no other help.
+        pruneBishops = options.pruneBishops && pieces.size() > 3 && std::count(pieces.begin(), pieces.end(), WhiteBishop) == static_cast<long>(pieces.size() - 2);
+        if (options.resume)
+        {
+            LoadCheckpoint(retrograde, progress);
+            if (numSlices > 0)
+                cout << "Resuming after " << progress.slices << " of " << numSlices << " pawn slices." << endl;
+            else
+                cout << "Resuming after " << progress.blackPasses << " Black and " << progress.whitePasses << " White passes." << endl;
+        }
+        else if (diskTables)
+        {
+            CreateTableFile(checkpointFile);
+        }
+        else
+        {
+            mappedFile.Close();
+            whiteTable.Allocate(length, Move());
+            blackTable.Allocate(length, Unscored);
+        }
+
+        vector<Worker> workers(options.numThreads);
+        for (Worker& worker : workers)
+            worker.offsetList.resize(pieces.size());
+
+        Stopwatch liveTimer;
+        MarkLive(workers);
+        size_t whiteDead = CountDead(whiteLive, 0, length);
+        size_t blackDead = CountDead(blackLive, 0, length);
+        char liveSeconds[32];
+        snprintf(liveSeconds, sizeof(liveSeconds), "%0.3f", liveTimer.Seconds());
+        cout << "Live: " << (length - whiteDead) << " White and " << (length - blackDead) << " Black positions of " << length << " slots in " << liveSeconds << " seconds" << endl;
+
+        bool finished =
+            (numSlices > 0) ? GeneratePawnSlices(workers, progress) :
+            retrograde ? GenerateRetrograde(workers, progress) :
+            GenerateForward(workers, progress);
+        AtomicBitmap().swap(deferred);
+        vector<uint64_t>().swap(whiteLive);
+        vector<uint64_t>().swap(blackLive);
+
+        if (!finished && !checkpointFile.empty())
+        {
+            // Save everything up to the last completed pass before giving up.
+            StartCheckpoint(progress);
+            if (numSlices > 0)
+                cout << "Generate: stopped after " << progress.slices << " of " << numSlices << " pawn slices; saving " << checkpointFile << endl;
+            else
+                cout << "Generate: stopped after " << progress.blackPasses << " Black and " << progress.whitePasses << " White passes; saving " << checkpointFile << endl;
+        }
+
+        FinishCheckpoint();
+        stopFlag = nullptr;
+        sampleMemory = false;
+        pruneBishops = false;
+        stats.finished = finished;
+        stats.seconds = timer.Seconds();
+        stats.peakResident = PeakResidentMemory();
+
+        char seconds[32];
+        snprintf(seconds, sizeof(seconds), "%0.3f", stats.seconds);
+        cout << "Generate: " << seconds << " seconds, peak resident memory " << (PeakResidentMemory() >> 20) << " MB" << endl;
+        return finished;
+    }
+
+    std::size_t Endgame::FindResolved(Side side, int pass, std::vector<uint64_t>& resolved)
+    {
+        // Mark the positions resolved by the given pass, by the score each pass assigns.
+        resolved.assign((length + 63) / 64, 0);
+        std::size_t count = 0;
+        const short score = (side == White) ? (WhiteMates + 1) - 2*pass : (WhiteMates + 2) - 2*pass;
+        for (std::size_t index = 0; index < length; ++index)
+        {
+            if ((side == White) ? (whiteTable[index].score == score) : (blackTable[index] == score))
+            {
+                resolved[index / 64] |= uint64_t(1) << (index % 64);
+                ++count;
+            }
+
+            if ((index + 1) % pieceStride == 0)
+                LimitMemory();
+        }
+        return count;
+    }
+
+    int Endgame::DeepestResolvedMove()
+    {
+        // Find the longest mate, in White moves, that either table already holds.
+        // After resuming, the passes up to this one may have been partly or completely
+        // done before the interruption, even if the checkpoint does not say so.
+        short lowest = WhiteMates + 1;
+        for (std::size_t index = 0; index < length; ++index)
+        {
+            short white = whiteTable[index].score;
+            short black = blackTable[index] - 1;    // a Black position is 1 ply further from mate than its White predecessor
+            if (white > Draw && white < lowest)
+                lowest = white;
+            if (black > Draw && black < lowest)
+                lowest = black;
+
+            if ((index + 1) % pieceStride == 0)
+                LimitMemory();
+        }
+        return ((WhiteMates + 1) - lowest) / 2;
+    }
+
+    static void ReportWorklist(const Worklist& work, std::size_t visited)
+    {
+        std::size_t pairs = 0;
+        for (uint32_t n : work.count)
+            if (n > 0)
+                ++pairs;
+
+        std::cout << "    worklist: visited " << visited << ", " << work.Size() << " unresolved in " << pairs << " King pairs" << std::endl;
+    }
+
+    bool Endgame::GenerateForward(std::vector<Worker>& workers, CheckpointRecord& progress)
+    {
+        // Instead of searching every placement on every pass, keep a list of the
+        // canonical positions still unresolved, and drop each one as soon as it is scored.
+        // A pass skips every King pair whose successors saw no change in the previous pass,
+        // because the scores there could not have changed either.
+        Stopwatch buildTimer;
+        Worklist white, black;
+        BuildWorklists(workers, white, black);
+        char seconds[32];
+        snprintf(seconds, sizeof(seconds), "%0.3f", buildTimer.Seconds());
+        std::cout << "Worklist: " << white.Size() << " White and " << black.Size() << " Black positions in " << seconds << " seconds" << std::endl;
+
+        // Checkmates, stalemates, and captures depend on nothing, so the first Black pass visits every King pair.
+        // After resuming, the positions resolved before the interruption are no longer in the worklists,
+        // so nothing records which pairs they changed; every pass up to the deepest one
+        // already in the tables must treat all pairs as changed, and cannot end generation early.
+        white.changed.assign(NumKingPairs, 1);
+        black.changed.assign(NumKingPairs, 1);
+        white.due.assign(NumKingPairs, 0);
+        black.due.assign(NumKingPairs, 0);
+        const int replayMoves = DeepestResolvedMove();
+        const std::size_t whiteDead = CountDead(whiteLive, 0, length);
+        const std::size_t blackDead = CountDead(blackLive, 0, length);
+
+        std::size_t visited;
+        for (;;)
+        {
+            Side side = (progress.blackPasses > progress.whitePasses) ? White : Black;
+            int mateInMoves = 1 + ((side == White) ? progress.whitePasses : progress.blackPasses);
+            Worklist& work  = (side == White) ? white : black;
+            Worklist& other = (side == White) ? black : white;
+
+            Stopwatch timer;
+            int nfound = WorklistPass(workers, mateInMoves, side, work, other, visited);
+            if (StopRequested())
+                return false;
+
+            ReportPass((side == White) ? "White" : "Black", mateInMoves, nfound, timer);
+            ReportWorklist(work, visited);
+            RecordPass(workers, side, mateInMoves, -1, (side == White) ? whiteDead : blackDead, nfound, timer.Seconds());
+            if (mateInMoves <= replayMoves)
+                work.changed.assign(NumKingPairs, 1);
+
+            if (side == Black)
+            {
+                ++progress.blackPasses;
+            }
+            else
+            {
+                ++progress.whitePasses;
+                if (nfound == 0 && mateInMoves > replayMoves && *std::max_element(black.due.begin(), black.due.end()) == 0)
+                    return true;
+
+                if (!checkpointFile.empty())
+                    StartCheckpoint(progress);
+            }
+        }
+    }
+
+    void Endgame::BuildWorklists(std::vector<Worker>& workers, Worklist& white, Worklist& black)
+    {
+        // List every live index that is still unresolved, separately for each side to move.
+        // Positions are only already resolved when resuming from a checkpoint.
+        // Each slice is a bitmap, so a worklist takes 2 bits per table entry no matter how full it is.
+        const std::size_t words = (pieceStride + 63) / 64;
+        white.slice.assign(NumKingPairs, std::vector<uint64_t>(words));
+        black.slice.assign(NumKingPairs, std::vector<uint64_t>(words));
+        white.count.assign(NumKingPairs, 0);
+        black.count.assign(NumKingPairs, 0);
+        std::atomic<int> nextPair(0);
+        RunWorkers(workers, [this, &white, &black, &nextPair](Worker&, std::size_t)
+        {
+            for (int p; (p = nextPair++) < NumKingPairs; )
+            {
+                const std::size_t base = p * pieceStride;
+                for (std::size_t residue = 0; residue < pieceStride; ++residue)
+                {
+                    const std::size_t index = base + residue;
+                    const uint64_t bit = uint64_t(1) << (residue % 64);
+                    if (IsMarked(whiteLive, index) && whiteTable[index].score == Unscored)
+                    {
+                        white.slice[p][residue / 64] |= bit;
+                        ++white.count[p];
+                    }
+
+                    if (IsMarked(blackLive, index) && blackTable[index] == Unscored)
+                    {
+                        black.slice[p][residue / 64] |= bit;
+                        ++black.count[p];
+                    }
+                }
+                LimitMemory();
+            }
+        });
+    }
+
+    int Endgame::WorklistPass(std::vector<Worker>& workers, int mateInMoves, Side side, Worklist& work, const Worklist& other, std::size_t& visited)
+    {
+        // Workers claim one King pair at a time. Every position in a pair has its
+        // canonical index in that pair, so each worker writes only its own entries,
+        // and compacts only its own slices. 'other' is only read during this pass.
+        const int successorSide = (side == White) ? 0 : 1;
+        std::atomic<int> nextPair(0);
+        RunWorkers(workers, [this, &work, &other, &nextPair, mateInMoves, side, successorSide](Worker& worker, std::size_t)
+        {
+            worker.nfound = 0;
+            worker.nvisited = 0;
+            for (int p; (p = nextPair++) < NumKingPairs && !StopRequested(); )
+            {
+                std::vector<uint64_t>& slice = work.slice[p];
+                work.changed[p] = 0;
+                if (work.count[p] == 0)
+                    continue;
+
+                // Black positions put off by ScoreBlack become due without any change around them.
+                bool dirty = (work.due[p] != 0 && work.due[p] <= mateInMoves);
+                for (int q : KingPairs.successors[successorSide][p])
+                    if (other.changed[q])
+                        dirty = true;
+
+                if (!dirty)
+                    continue;
+
+                // Visiting the bits in order keeps table access close to sequential.
+                const std::size_t base = p * pieceStride;
+                uint32_t found = 0;
+                worker.duePass = 0;
+                for (std::size_t w = 0; w < slice.size(); ++w)
+                {
+                    for (uint64_t bits = slice[w]; bits != 0; bits &= bits - 1)
+                    {
+                        const int b = LowestBit(bits);
+                        const std::size_t index = base + 64*w + b;
+                        bool resolved = ScoreIndex(worker, index, side, mateInMoves) != 0;
+
+                        if (resolved)
+                        {
+                            slice[w] &= ~(uint64_t(1) << b);
+                            ++found;
+                        }
+                    }
+                }
+
+                worker.nfound += found;
+                worker.nvisited += work.count[p];
+                work.due[p] = worker.duePass;
+                if (found > 0)
+                {
+                    work.changed[p] = 1;
+                    work.count[p] -= found;
+                }
+            }
+        });
+
+        int nfound = 0;
+        visited = 0;
+        for (const Worker& worker : workers)
+        {
+            nfound += worker.nfound;
+            visited += worker.nvisited;
+        }
+
+        return nfound;
+    }
+
+    void Endgame::MarkLive(std::vector<Worker>& workers)
+    {
+        // Whether the pieces overlap, whether the Kings touch or the side not to move is in check,
+        // and whether a placement is the canonical one for its index never change from pass to pass.
+        // Work them out once, so the passes only visit the indices marked here.
+        // Each worker takes a run of whole words at a time and reads neither table.
+        const std::size_t ChunkWords = 1024;
+        whiteLive.assign((length + 63) / 64, 0);
+        blackLive.assign((length + 63) / 64, 0);
+        std::atomic<std::size_t> nextChunk(0);
+        RunWorkers(workers, [this, &nextChunk, ChunkWords](Worker& worker, std::size_t)
+        {
+            for (std::size_t start; (start = ChunkWords * nextChunk++) < whiteLive.size(); )
+            {
+                std::size_t end = std::min(whiteLive.size(), start + ChunkWords);
+                for (std::size_t w = start; w < end; ++w)
+                {
+                    for (int b = 0; b < 64 && 64*w + b < length; ++b)
+                    {
+                        const std::size_t index = 64*w + b;
+                        if (!SetupPosition(worker, index, true) || TableIndex(worker.offsetList).index != index)
+                            continue;
+
+                        if (pruneBishops && SameColorBishops(worker.offsetList))
+                            continue;
+
+                        if (worker.board.IsLegalPosition())
+                            whiteLive[w] |= uint64_t(1) << b;
+
+                        worker.board.SetTurn(false);
+                        if (worker.board.IsLegalPosition())
+                            blackLive[w] |= uint64_t(1) << b;
+                    }
+                }
+            }
+        });
+    }
+
+    bool Endgame::SameColorBishops(const std::vector<int>& offsetList) const
+    {
+        // Bishops never leave the color of their squares, and with nothing else to help,
+        // bishops all on one color can never checkmate: the squares beside the Black King
+        // along a rank or file are all of the other color, and the White King cannot cover
+        // two of them without touching the Black King.
+        int colors = 0;
+        for (std::size_t i = 2; i < pieces.size(); ++i)
+            colors |= 1 << ((offsetList[i] / 10 + offsetList[i] % 10) & 1);
+        return colors != 3;
+    }
+
+    int Endgame::LivePass(std::vector<Worker>& workers, int mateInMoves, Side side)
+    {
+        // Score every live index for one side, in index order.
+        // Every entry a pass writes is for the side it scores, and it reads only the other side's table,
+        // so the order does not matter, and each worker writes only the entries of its own words.
+        const std::vector<uint64_t>& live = (side == White) ? whiteLive : blackLive;
+        const std::size_t ChunkWords = 1024;
+        std::atomic<std::size_t> nextChunk(0);
+        RunWorkers(workers, [this, &live, &nextChunk, mateInMoves, side, ChunkWords](Worker& worker, std::size_t)
+        {
+            worker.nfound = 0;
+            for (std::size_t start; (start = ChunkWords * nextChunk++) < live.size() && !StopRequested(); )
+            {
+                std::size_t end = std::min(live.size(), start + ChunkWords);
+                for (std::size_t w = start; w < end; ++w)
+                    for (uint64_t bits = live[w]; bits != 0; bits &= bits - 1)
+                        worker.nfound += ScoreIndex(worker, 64*w + LowestBit(bits), side, mateInMoves);
+                LimitMemory();
+            }
+        });
+
+        int nfound = 0;
+        for (const Worker& worker : workers)
+            nfound += worker.nfound;
+
+        return nfound;
+    }
+
+    int Endgame::SearchPass(std::vector<Worker>& workers, int mateInMoves, Side side)
+    {
+        // Each worker claims one Black King square at a time.
+        // Every placement in a slice has its canonical index in the same slice,
+        // because the Black King stays put under the symmetries that keep it
+        // inside the 10 FirstPieceOffsets squares. So no two workers ever write
+        // the same table entry, and no table entry read in a pass is written in that pass.
+        std::atomic<int> nextSlice(0);
+        RunWorkers(workers, [this, &nextSlice, mateInMoves, side](Worker& worker, std::size_t)
+        {
+            worker.nfound = 0;
+            worker.board.Clear(true);
+            for (int i; (i = nextSlice++) < 10 && !StopRequested(); )
+            {
+                // The Black King is special: exploit symmetry by keeping
+                // it in the 10 distinct board locations.
+                worker.offsetList[0] = FirstPieceOffsets[i];
+                worker.board.SetSquare(FirstPieceOffsets[i], pieces[0]);
+                Search(worker, 1, mateInMoves, side);
+                // No need to erase Black King because it is moved automatically.
+            }
+        });
+
+        int nfound = 0;
+        for (const Worker& worker : workers)
+            nfound += worker.nfound;
+
+        return nfound;
+    }
+
+    static bool AnyBitSet(const AtomicBitmap& bitmap)
+    {
+        for (const std::atomic<uint64_t>& word : bitmap)
+            if (word.load(std::memory_order_relaxed) != 0)
+                return true;
+        return false;
+    }
+
+    bool Endgame::GenerateRetrograde(std::vector<Worker>& workers, CheckpointRecord& progress)
+    {
+        using namespace std;
+
+        // Produces exactly the same tables as GenerateForward(), but after the first pass
+        // it only visits predecessors of the positions resolved by the previous pass.
+        // Every position resolved in the Black pass for mate-in-N has score (WhiteMates + 2) - 2*N,
+        // which is exactly what the White pass for mate-in-N is looking for.
+        // The tables are always evaluated at the canonical placement for each index,
+        // which is also the first placement Search() would visit, so ScoreWhite picks the same move.
+
+        // The frontier and the candidates are bitmaps over the whole table,
+        // so their size does not depend on how many positions each pass resolves.
+        vector<uint64_t> frontier;
+        AtomicBitmap candidates((length + 63) / 64);
+        size_t nfound = 0;
+        const size_t whiteDead = CountDead(whiteLive, 0, length);
+        const size_t blackDead = CountDead(blackLive, 0, length);
+
+        // A Black position whose best defense is a capture may have all of its moves scored
+        // long before the pass that matches its score. ScoreBlack marks it here, and every
+        // Black pass tries those positions again along with the predecessors of the frontier.
+        AtomicBitmap(candidates.size()).swap(deferred);
+
+        if (progress.blackPasses > 0)
+        {
+            // The positions put off before the interruption were not saved, so try every unresolved one.
+            std::atomic<int> nextPair(0);
+            RunWorkers(workers, [this, &nextPair](Worker&, std::size_t)
+            {
+                for (int p; (p = nextPair++) < NumKingPairs; )
+                {
+                    const std::size_t base = p * pieceStride;
+                    for (std::size_t index = base; index < base + pieceStride; ++index)
+                        if (IsMarked(blackLive, index) && blackTable[index] == Unscored)
+                            deferred[index / 64].fetch_or(uint64_t(1) << (index % 64), std::memory_order_relaxed);
+                    LimitMemory();
+                }
+            });
+        }
+        else
+        {
+            // Checkmates, stalemates, and captures have no resolved successors to start from,
+            // so the first Black pass must still visit every live position.
+            Stopwatch firstTimer;
+            int nfirst = LivePass(workers, 1, Black);
+            if (StopRequested())
+                return false;
+            ReportPass("Black", 1, nfirst, firstTimer);
+            RecordPass(workers, Black, 1, -1, blackDead, nfirst, firstTimer.Seconds());
+            progress.blackPasses = 1;
+        }
+
+        // The frontier is everything the most recent pass resolved. After resuming, the passes up to
+        // the deepest one already in the tables may have resolved some positions before the interruption,
+        // and those are not candidates when the pass runs again; so those frontiers are found from the
+        // table scores instead.
+        const int replayMoves = DeepestResolvedMove();
+        for (int run = 0; ; ++run)
+        {
+            Side last = (progress.blackPasses > progress.whitePasses) ? Black : White;
+            int lastMoves = (last == White) ? progress.whitePasses : progress.blackPasses;
+            if (run == 0 || lastMoves <= replayMoves)
+                nfound = FindResolved(last, lastMoves, frontier);
+
+            if (last == White && nfound == 0 && !AnyBitSet(deferred))
+                return true;
+
+            Side side = (last == White) ? Black : White;
+            int mateInMoves = 1 + ((side == White) ? progress.whitePasses : progress.blackPasses);
+            Stopwatch timer;
+            CollectPredecessors(workers, frontier, side == White, candidates);
+            if (side == Black)
+                for (size_t w = 0; w < deferred.size(); ++w)
+                    candidates[w].fetch_or(deferred[w].exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+            nfound = ResolveCandidates(workers, candidates, mateInMoves, side, frontier);
+            if (StopRequested())
+                return false;
+            ReportPass((side == White) ? "White" : "Black", mateInMoves, static_cast<int>(nfound), timer);
+            RecordPass(workers, side, mateInMoves, -1, (side == White) ? whiteDead : blackDead, static_cast<int>(nfound), timer.Seconds());
+
+            if (side == White)
+            {
+                ++progress.whitePasses;
+            }
+            else
+            {
+                ++progress.blackPasses;
+                if (!checkpointFile.empty())
+                    StartCheckpoint(progress);
+            }
+        }
+    }
+
+    void Endgame::CollectPredecessors(
+        std::vector<Worker>& workers,
+        const std::vector<uint64_t>& frontier,
+        bool whiteToMove,
+        AtomicBitmap& candidates)
+    {
+        // Mark the canonical indices of all unresolved positions, with the given side to move,
+        // that can reach any of the positions in 'frontier' in a single move.
+        // This pass only reads the tables, so the frontier can be split any way we like.
+        // Marking a bitmap removes duplicates for free.
+        const std::size_t ChunkWords = 1024;
+        std::atomic<std::size_t> nextChunk(0);
+        RunWorkers(workers, [this, &frontier, &candidates, &nextChunk, whiteToMove, ChunkWords](Worker& worker, std::size_t)
         {
-            56, 48, 40, 32, 24, 16,  8,  0,
-            57, 49, 41, 33, 25, 17,  9,  1,
-            58, 50, 42, 34, 26, 18, 10,  2,
-            59, 51, 43, 35, 27, 19, 11,  3,
-            60, 52, 44, 36, 28, 20, 12,  4,
-            61, 53, 45, 37, 29, 21, 13,  5,
-            62, 54, 46, 38, 30, 22, 14,  6,
-            63, 55, 47, 39, 31, 23, 15,  7
-        },
+            MoveList unmoves;
+            for (std::size_t start; (start = ChunkWords * nextChunk++) < frontier.size() && !StopRequested(); )
+            {
+                std::size_t end = std::min(frontier.size(), start + ChunkWords);
+                for (std::size_t w = start; w < end; ++w)
+                {
+                    for (uint64_t bits = frontier[w]; bits != 0; bits &= bits - 1)
+                    {
+                        if (!SetupPosition(worker, 64*w + LowestBit(bits), !whiteToMove))
+                            throw ChessException("CollectPredecessors: invalid frontier index");
+
+                        worker.board.GenUnmoves(unmoves);
+                        CheckMemory(worker, unmoves.length);
+                        ++worker.counters.genUnmoves;
+                        worker.counters.unmoves += unmoves.length;
+                        worker.counters.tableIndex += unmoves.length;
+                        for (int i=0; i < unmoves.length; ++i)
+                        {
+                            const Move& unmove = unmoves.movelist[i];
+                            UpdateOffset(worker.offsetList, unmove.dest, unmove.source);
+                            Position prev = TableIndex(worker.offsetList);
+                            UpdateOffset(worker.offsetList, unmove.source, unmove.dest);
+
+                            bool unresolved = whiteToMove ?
+                                (whiteTable.at(prev.index).score == Unscored) :
+                                (blackTable.at(prev.index) == Unscored);
+
+                            // Taking back a move can leave the side not to move in check, which no pass needs to visit.
+                            if (unresolved && IsMarked(whiteToMove ? whiteLive : blackLive, prev.index))
+                                candidates[prev.index / 64].fetch_or(uint64_t(1) << (prev.index % 64), std::memory_order_relaxed);
+                        }
+                    }
+                }
+            }
+        });
+    }
 
-        // 7 = backslash
+    std::size_t Endgame::ResolveCandidates(
+        std::vector<Worker>& workers,
+        AtomicBitmap& candidates,
+        int mateInMoves,
+        Side side,
+        std::vector<uint64_t>& resolved)
+    {
+        // Score each candidate at its canonical placement, clearing the bitmap for the next pass.
+        // Workers claim runs of words in index order, so table access stays close to sequential,
+        // and each worker writes only the table entries and the words of 'resolved' for its own candidates.
+        const std::size_t ChunkWords = 1024;
+        std::atomic<std::size_t> nextChunk(0);
+        RunWorkers(workers, [this, &candidates, &resolved, &nextChunk, mateInMoves, side, ChunkWords](Worker& worker, std::size_t)
         {
-            63, 55, 47, 39, 31, 23, 15,  7,
-            62, 54, 46, 38, 30, 22, 14,  6,
-            61, 53, 45, 37, 29, 21, 13,  5,
-            60, 52, 44, 36, 28, 20, 12,  4,
-            59, 51, 43, 35, 27, 19, 11,  3,
-            58, 50, 42, 34, 26, 18, 10,  2,
-            57, 49, 41, 33, 25, 17,  9,  1,
-            56, 48, 40, 32, 24, 16,  8,  0
-        },
-    };
+            worker.nfound = 0;
+            for (std::size_t start; (start = ChunkWords * nextChunk++) < candidates.size() && !StopRequested(); )
+            {
+                std::size_t end = std::min(candidates.size(), start + ChunkWords);
+                for (std::size_t w = start; w < end; ++w)
+                {
+                    uint64_t found = 0;
+                    for (uint64_t bits = candidates[w].exchange(0, std::memory_order_relaxed); bits != 0; bits &= bits - 1)
+                    {
+                        const int b = LowestBit(bits);
+                        const std::size_t index = 64*w + b;
+                        bool scored = ScoreIndex(worker, index, side, mateInMoves) != 0;
+
+                        if (scored)
+                        {
+                            found |= uint64_t(1) << b;
+                            ++worker.nfound;
+                        }
+                    }
+                    resolved[w] = found;
+                }
+            }
+        });
 
-    int Endgame::UnitTest()
+        std::size_t nfound = 0;
+        for (const Worker& worker : workers)
+            nfound += worker.nfound;
+        return nfound;
+    }
+
+    static void ReportSlice(std::size_t done, std::size_t total, const std::string& pawns, int passes, std::size_t nfound, const Stopwatch& timer)
     {
-        using namespace std;
+        char seconds[32];
+        snprintf(seconds, sizeof(seconds), "%0.3f", timer.Seconds());
+        std::cout << "Slice " << done << "/" << total << " (pawns " << pawns << "): " << passes << " passes, found " << nfound
+                  << " in " << seconds << " seconds, resident " << (ResidentMemory() >> 20) << " MB" << std::endl;
+    }
 
-        int i, s;
+    bool Endgame::GeneratePawnSlices(std::vector<Worker>& workers, CheckpointRecord& progress)
+    {
+        // Pawns only move forward, and Black's King can only take them, so every move
+        // out of a slice lands in a slice with the pawns further up the board, or in another table.
+        // Solving the slices with the most advanced pawns first means each slice only looks up
+        // finished ones, so it can be solved on its own, from mate-in-1 up, like a small table.
+        // Only the current slice and the ones its pawn moves reach are touched,
+        // so with diskTables the rest of the file can stay out of memory.
+        using namespace std;
 
-        // Confirm displacement/offset conversions.
-        for (i = 0; i < 10; ++i)
+        vector<size_t> order(numSlices);
+        vector<int> advance(numSlices, 0);
+        vector<string> pawnText(numSlices);
+        vector<int> offset;
+        for (size_t slice = 0; slice < numSlices; ++slice)
         {
-            if (i != FirstDisplacements[FirstPieceOffsets[i]])
+            order[slice] = slice;
+            UnrankPosition(slice * sliceStride, offset);
+            for (size_t i = 2; i < pieces.size(); ++i)
             {
-                cerr << "FAIL: i=" << i << ", FirstPieceOffsets[i]=" << FirstPieceOffsets[i] << ", FirstDisplacements=" << FirstDisplacements[FirstPieceOffsets[i]] << endl;
-                return 1;
+                if (pieces[i] == WhitePawn)
+                {
+                    advance[slice] += Rank(offset[i]) - '1';
+                    if (!pawnText[slice].empty())
+                        pawnText[slice].push_back(',');
+                    pawnText[slice].push_back(File(offset[i]));
+                    pawnText[slice].push_back(Rank(offset[i]));
+                }
             }
         }
+        stable_sort(order.begin(), order.end(), [&advance](size_t a, size_t b) { return advance[a] > advance[b]; });
 
-        for (i = 0; i < 64; ++i)
+        // A slice that was not finished before an interruption may be partly solved; start it over.
+        for (size_t k = progress.slices; k < numSlices; ++k)
         {
-            if (i != Displacements[PieceOffsets[i]])
+            const size_t base = order[k] * sliceStride;
+            fill(&whiteTable[base], &whiteTable[base] + sliceStride, Move());
+            fill(&blackTable[base], &blackTable[base] + sliceStride, Unscored);
+            LimitMemory();
+        }
+
+        vector<uint64_t> white(sliceStride / 64), black(sliceStride / 64);
+        for (size_t k = progress.slices; k < numSlices; ++k)
+        {
+            Stopwatch timer;
+            const size_t base = order[k] * sliceStride;
+
+            // Start from the live positions in this slice, separately for each side to move.
+            copy(whiteLive.begin() + base/64, whiteLive.begin() + (base + sliceStride)/64, white.begin());
+            copy(blackLive.begin() + base/64, blackLive.begin() + (base + sliceStride)/64, black.begin());
+            const size_t whiteDead = CountDead(whiteLive, base, sliceStride);
+            const size_t blackDead = CountDead(blackLive, base, sliceStride);
+
+            // Like GenerateForward, stop after a White pass that finds nothing,
+            // unless a move into another slice or table has a longer mate waiting.
+            int passes = 0;
+            size_t nfound = 0;
+            for (int blackDue = 0, whiteDue = 0, found = 1; found > 0 || blackDue > 0 || whiteDue > 0; )
             {
-                cerr << "FAIL: i=" << i << ", PieceOffsets[i]=" << PieceOffsets[i] << ", Displacements=" << Displacements[PieceOffsets[i]] << endl;
-                return 1;
+                ++passes;
+                Stopwatch blackTimer;
+                int nblack = SlicePass(workers, base, black, passes, Black, blackDue);
+                RecordPass(workers, Black, passes, static_cast<long>(k), blackDead, nblack, blackTimer.Seconds());
+                Stopwatch whiteTimer;
+                found = SlicePass(workers, base, white, passes, White, whiteDue);
+                RecordPass(workers, White, passes, static_cast<long>(k), whiteDead, found, whiteTimer.Seconds());
+                nfound += nblack + found;
+                if (StopRequested())
+                    return false;
             }
+
+            ++progress.slices;
+            ReportSlice(k + 1, numSlices, pawnText[order[k]], passes, nfound, timer);
+            if (!checkpointFile.empty())
+                StartCheckpoint(progress);
         }
 
-        for (s = 0; s < NumSymmetries; ++s)
+        return true;
+    }
+
+    int Endgame::SlicePass(std::vector<Worker>& workers, std::size_t base, std::vector<uint64_t>& unresolved, int mateInMoves, Side side, int& duePass)
+    {
+        // Score the unresolved positions of one side in one slice, dropping each one that gets a score.
+        // Workers claim runs of words, so each one writes only its own table entries and bitmap words.
+        const std::size_t ChunkWords = 1024;
+        std::atomic<std::size_t> nextChunk(0);
+        RunWorkers(workers, [this, &unresolved, &nextChunk, base, mateInMoves, side, ChunkWords](Worker& worker, std::size_t)
         {
-            // Confirm that there every value 0..63 is represented exactly once in each symmetry.
-            int count[64] = { 0 };
-            for (i = 0; i < 64; ++i)
-                ++count[SymmetryTable[s][i]];
+            worker.nfound = 0;
+            worker.duePass = 0;
+            for (std::size_t start; (start = ChunkWords * nextChunk++) < unresolved.size() && !StopRequested(); )
+            {
+                std::size_t end = std::min(unresolved.size(), start + ChunkWords);
+                for (std::size_t w = start; w < end; ++w)
+                {
+                    for (uint64_t bits = unresolved[w]; bits != 0; bits &= bits - 1)
+                    {
+                        const int b = LowestBit(bits);
+                        const std::size_t index = base + 64*w + b;
+                        bool scored = ScoreIndex(worker, index, side, mateInMoves) != 0;
+
+                        if (scored)
+                        {
+                            unresolved[w] &= ~(uint64_t(1) << b);
+                            ++worker.nfound;
+                        }
+                    }
+                }
+            }
+        });
 
-            for (i = 0; i < 64; ++i)
+        int nfound = 0;
+        duePass = 0;
+        for (const Worker& worker : workers)
+        {
+            nfound += worker.nfound;
+            if (worker.duePass != 0 && (duePass == 0 || worker.duePass < duePass))
+                duePass = worker.duePass;
+        }
+        return nfound;
+    }
+
+    bool Endgame::UnrankPosition(std::size_t index, std::vector<int>& offset) const
+    {
+        // Convert a table index back to the board offsets of each piece.
+        // Returns false if any two pieces would occupy the same square.
+        const std::size_t n = pieces.size();
+        offset.resize(n);
+        if (numSlices > 0)
+        {
+            // The pieces other than pawns, Kings included, are the least significant digits.
+            for (std::size_t i = n; i-- > 0; )
             {
-                if (count[i] != 1)
+                if (pieces[i] != WhitePawn)
                 {
-                    cerr << "FAIL: SymmetryTable[" << s << "] does not hold 0..63" << endl;
-                    return 1;
+                    offset[i] = PieceOffsets[index % 64];
+                    index /= 64;
                 }
             }
 
-            // Verify inverse symmetries.
-            for (i = 0; i < 64; ++i)
+            // The first pawn is on files a-d of ranks 2-7; the others anywhere on ranks 2-7.
+            std::size_t first = 2;
+            while (pieces[first] != WhitePawn)
+                ++first;
+
+            for (std::size_t i = n; i-- > first+1; )
             {
-                int k = SymmetryTable[s][i];
-                int r = SymmetryTable[InverseSymmetry[s]][k];
-                if (i != r)
+                if (pieces[i] == WhitePawn)
                 {
-                    cerr << "FAIL: InverseSymmetry[" << s << "] is broken." << endl;
-                    return 1;
+                    offset[i] = PieceOffsets[8 + index % 48];
+                    index /= 48;
                 }
             }
+
+            if (index >= 24)
+                throw ChessException("UnrankPosition: Invalid index residue");
+
+            offset[first] = PieceOffsets[8*(1 + index/4) + (index % 4)];
+
+            for (std::size_t i = 1; i < n; ++i)
+                for (std::size_t k = 0; k < i; ++k)
+                    if (offset[i] == offset[k])
+                        return false;
+
+            return true;
         }
 
-        cout << "EndGame::UnitTest: PASS" << endl;
-        return 0;
+        for (std::size_t i = n-1; i > 1; --i)
+        {
+            if (i == pairSecond)
+                continue;
+
+            if (i == pairFirst)
+            {
+                offset[i] = PieceOffsets[SquarePairs.low[index % NumSquarePairs]];
+                offset[pairSecond] = PieceOffsets[SquarePairs.high[index % NumSquarePairs]];
+                index /= NumSquarePairs;
+            }
+            else
+            {
+                offset[i] = PieceOffsets[index % 64];
+                index /= 64;
+            }
+        }
+
+        if (index >= NumKingPairs)
+            throw ChessException("UnrankPosition: Invalid index residue");
+
+        offset[0] = FirstPieceOffsets[KingPairs.bkFirst[index]];
+        offset[1] = PieceOffsets[KingPairs.wkDisp[index]];
+
+        for (std::size_t i = 2; i < n; ++i)
+            for (std::size_t k = 0; k < i; ++k)
+                if (offset[i] == offset[k])
+                    return false;
+
+        return true;
+    }
+
+    Position Endgame::ClassicPosition(const std::vector<int>& offset) const
+    {
+        // The canonical slot of this placement in the original 10*64^(n-1) layout:
+        // the smallest index over all 8 symmetries, as that layout's TableIndex chose it.
+        // That is not always the orientation of 'offset', because the King-pair and square-pair
+        // indexes break ties between Kings on the a1-h8 diagonal differently.
+        // Pawn tables never had that layout, so they keep their own index.
+        if (numSlices > 0)
+            return Position(TableIndex(offset).index, 0);
+
+        Position best(classicLength, 0);
+        for (int symmetry = 0; symmetry < NumSymmetries; ++symmetry)
+        {
+            int bkFirst = FirstDisplacements[PieceOffsets[SymmetryTable[symmetry][Displacements[offset[0]]]]];
+            if (bkFirst < 0)
+                continue;
+
+            std::size_t index = bkFirst;
+            for (std::size_t i = 1; i < offset.size(); ++i)
+                index = (64 * index) + SymmetryTable[symmetry][Displacements[offset[i]]];
+
+            if (index < best.index)
+                best = Position(index, symmetry);
+        }
+        return best;
     }
 
-    void Endgame::Generate()
+    void Endgame::IndexReport() const
     {
         using namespace std;
 
-        whiteTable = vector<Move>(length);
-        blackTable = vector<short>(length, Unscored);
-        ChessBoard board;
+        if (numSlices > 0)
+            throw ChessException("IndexReport: tables with pawns do not have the King-pair layout.");
+
+        // Count how many slots of each table layout hold a distinct, legal position,
+        // and how many are wasted on impossible or duplicate placements.
+        struct Tally
+        {
+            size_t slots = 0, overlap = 0, touching = 0, duplicate = 0, live = 0;
+
+            void Count(const Endgame& db, const vector<int>& offset, size_t self)
+            {
+                ++slots;
+                for (size_t i = 1; i < offset.size(); ++i)
+                {
+                    for (size_t k = 0; k < i; ++k)
+                    {
+                        if (offset[i] == offset[k])
+                        {
+                            ++overlap;
+                            return;
+                        }
+                    }
+                }
+
+                if (abs(File(offset[0]) - File(offset[1])) <= 1 && abs(Rank(offset[0]) - Rank(offset[1])) <= 1)
+                    ++touching;
+                else if (db.TableIndex(offset).index != self)
+                    ++duplicate;
+                else
+                    ++live;
+            }
+        };
+
+        const size_t entryBytes = sizeof(Move) + sizeof(short);
+        const size_t n = pieces.size();
+        vector<int> offset(n);
+
+        Tally classic;
+        for (size_t c = 0; c < classicLength; ++c)
+        {
+            size_t residue = c;
+            for (size_t i = n-1; i > 0; --i)
+            {
+                offset[i] = PieceOffsets[residue % 64];
+                residue /= 64;
+            }
+            offset[0] = FirstPieceOffsets[residue];
+
+            // A classic slot is live if its canonical position maps back to this same slot.
+            // With an identical pair, only the order that puts the first piece on the lower square counts;
+            // the other order is a duplicate.
+            size_t self = length;
+            if (pairFirst == 0 || offset[pairFirst] < offset[pairSecond])
+            {
+                Position pos = RankPosition(offset, 0);
+                if (pos.index < length)
+                    self = pos.index;
+            }
+            classic.Count(*this, offset, self);
+        }
+
+        Tally pairs;
+        for (size_t index = 0; index < length; ++index)
+        {
+            UnrankPosition(index, offset);
+            pairs.Count(*this, offset, index);
+        }
+
+        const Tally *tally[2] = { &classic, &pairs };
+        const char *layout = (pairFirst == 0) ? "462*64^(n-2)" : (n == 4) ? "462*2016" : "462*2016*64";
+        printf("%-22s %14s %14s\n", "", "10*64^(n-1)", layout);
+        printf("%-22s", "slots");
+        for (const Tally *t : tally) printf(" %14lu", static_cast<unsigned long>(t->slots));
+        printf("\n%-22s", "overlapping pieces");
+        for (const Tally *t : tally) printf(" %14lu", static_cast<unsigned long>(t->overlap));
+        printf("\n%-22s", "touching Kings");
+        for (const Tally *t : tally) printf(" %14lu", static_cast<unsigned long>(t->touching));
+        printf("\n%-22s", "symmetric duplicates");
+        for (const Tally *t : tally) printf(" %14lu", static_cast<unsigned long>(t->duplicate));
+        printf("\n%-22s", "distinct positions");
+        for (const Tally *t : tally) printf(" %14lu", static_cast<unsigned long>(t->live));
+        printf("\n%-22s", "wasted");
+        for (const Tally *t : tally) printf(" %13.1f%%", 100.0 * (t->slots - t->live) / t->slots);
+        printf("\n%-22s", "table memory (MB)");
+        for (const Tally *t : tally) printf(" %14.1f", (t->slots * entryBytes) / 1.0e+6);
+        printf("\n");
+    }
 
-        int nfound = 1;
-        for (int mateInMoves = 1; nfound > 0; ++mateInMoves)
+    bool Endgame::SetupPosition(Worker& worker, std::size_t index, bool whiteToMove) const
+    {
+        // Place the pieces for the given table index on the worker's board, and remember their offsets.
+        if (!UnrankPosition(index, worker.offsetList))
+            return false;
+
+        worker.board.Clear(whiteToMove);
+        for (std::size_t i = 0; i < pieces.size(); ++i)
+            worker.board.SetSquare(worker.offsetList[i], pieces[i]);
+
+        return true;
+    }
+
+
+    bool Endgame::FindPieces(const ChessBoard& board, int *offset) const
+    {
+        // Match every piece on the board with a piece in this table,
+        // in the same order as Endgame::pieces. Identical pieces may be
+        // matched in either order: the index of a pair does not depend on it,
+        // and the table holds both placements of any other identical pieces.
+        const std::size_t n = pieces.size();
+        for (std::size_t i = 0; i < n; ++i)
+            offset[i] = 0;
+
+        std::size_t found = 0;
+        for (int y = 2; y <= 9; ++y)
         {
-            nfound = 0;
-            Search(board, 0, mateInMoves, nfound, Black);
-            cout << "Black Search(" << mateInMoves << "): found " << nfound << endl;
+            for (int x = 1; x <= 8; ++x)
+            {
+                int ofs = 10*y + x;
+                Square s = board.GetSquare(ofs);
+                if (s == Empty)
+                    continue;
 
-            nfound = 0;
-            Search(board, 0, mateInMoves, nfound, White);
-            cout << "White Search(" << mateInMoves << "): found " << nfound << endl;
+                std::size_t i = 0;
+                while (i < n && (pieces[i] != s || offset[i] != 0))
+                    ++i;
+
+                if (i == n)
+                    return false;   // this piece is not part of the table, or there are too many of them
+
+                offset[i] = ofs;
+                ++found;
+            }
         }
+
+        return found == n;
+    }
+
+
+    void Endgame::BuildBitbase(std::vector<unsigned char>& white, std::vector<unsigned char>& black, int numThreads) const
+    {
+        // Pack the outcome of every index into 2 bits for each side to move.
+        // Indices that are not the canonical index of a legal position are marked illegal,
+        // so a lookup never needs a board. Each worker takes a run of whole bytes at a time.
+        const std::size_t chunk = 4096;
+        white.assign((length + 3) / 4, 0);
+        black.assign((length + 3) / 4, 0);
+        std::vector<Worker> workers(numThreads);
+        for (Worker& worker : workers)
+            worker.offsetList.resize(pieces.size());
+
+        std::atomic<std::size_t> nextChunk(0);
+        RunWorkers(workers, [this, &white, &black, &nextChunk, chunk](Worker& worker, std::size_t)
+        {
+            for (std::size_t start; (start = chunk * nextChunk++) < length; )
+            {
+                const std::size_t end = std::min(length, start + chunk);
+                for (std::size_t index = start; index < end; ++index)
+                {
+                    if (!SetupPosition(worker, index, true) || TableIndex(worker.offsetList).index != index)
+                        continue;
+
+                    const int shift = 2 * (index & 3);
+                    if (worker.board.IsLegalPosition())
+                        white[index >> 2] |= ((whiteTable[index].score > Draw) ? BitbaseWin : BitbaseDraw) << shift;
+
+                    worker.board.SetTurn(false);
+                    if (worker.board.IsLegalPosition())
+                        black[index >> 2] |= ((blackTable[index] > Draw) ? BitbaseWin : BitbaseDraw) << shift;
+                }
+            }
+        });
+    }
+
+
+    int Endgame::ScoreIndex(Worker& worker, std::size_t index, Side side, int mateInMoves)
+    {
+        // Score the position at a table index with the compiled generator, if there is one.
+        if (scoreIndex != nullptr)
+            return (this->*scoreIndex)(worker, index, side, mateInMoves);
+
+        if (side == White)
+            return SetupPosition(worker, index, true) && ScoreWhite(worker, mateInMoves);
+
+        return SetupPosition(worker, index, false) && ScoreBlack(worker, mateInMoves);
     }
 
 
-    Position Endgame::CalcPosition(int symmetry) const
+    Position Endgame::RankPosition(const int *offsetList, int symmetry) const
     {
         if (symmetry < 0 || symmetry >= NumSymmetries)
-            throw ChessException("CalcPosition: symmetry is out of bounds.");
+            throw ChessException("RankPosition: symmetry is out of bounds.");
+
+        if (numSlices > 0)
+        {
+            // Pawns allow only the identity and the left/right mirror,
+            // and the first pawn must land on files a-d.
+            if (symmetry > 1)
+                return Position(length, symmetry);
+
+            std::size_t index = 0;
+            bool first = true;
+            for (std::size_t i = 2; i < pieces.size(); ++i)
+            {
+                if (pieces[i] == WhitePawn)
+                {
+                    int d = SymmetryTable[symmetry][Displacements[offsetList[i]]];
+                    if (d < 8 || d >= 56)
+                        return Position(length, symmetry);      // a pawn cannot stand on the first or last rank
+
+                    if (first)
+                    {
+                        if (d % 8 > 3)
+                            return Position(length, symmetry);
+                        index = 4*(d/8 - 1) + (d % 8);
+                        first = false;
+                    }
+                    else
+                    {
+                        index = (48 * index) + (d - 8);
+                    }
+                }
+            }
+
+            for (std::size_t i = 0; i < pieces.size(); ++i)
+                if (pieces[i] != WhitePawn)
+                    index = (64 * index) + SymmetryTable[symmetry][Displacements[offsetList[i]]];
+
+            return Position(index, symmetry);
+        }
 
         int bkDisplacement = SymmetryTable[symmetry][Displacements[offsetList[0]]];
         int bkOffset = PieceOffsets[bkDisplacement];
 
         // A position has a valid index only if the Black King is inside
-        // one of the 10 squares indicated by FirstDisplacements.
+        // one of the 10 squares indicated by FirstDisplacements,
+        // and the White King is in a matching square in KingPairs.
         int bkFirst = FirstDisplacements[bkOffset];
         if (bkFirst < 0)
             return Position(length, symmetry);      // return an invalid index to signal caller to ignore this symmetry
 
-        if (bkFirst > 9)
-            throw ChessException("Internal error in CalcPosition");
+        if (CheckedBuild && bkFirst > 9)
+            throw ChessException("Internal error in RankPosition");
 
-        std::size_t index = bkFirst;
-        for (std::size_t i = 1; i < offsetList.size(); ++i)
-            index = (64 * index) + SymmetryTable[symmetry][Displacements[offsetList[i]]];
+        int pair = KingPairs.pairIndex[bkFirst][SymmetryTable[symmetry][Displacements[offsetList[1]]]];
+        if (pair < 0)
+            return Position(length, symmetry);
 
-        return Position(index, symmetry);
+        return Position(AppendPieces(pair, offsetList, symmetry), symmetry);
+    }
+
+
+    std::size_t Endgame::AppendPieces(std::size_t index, const int *offsetList, int symmetry) const
+    {
+        // Follow a King pair with the squares of the other pieces, as seen through 'symmetry':
+        // 64 for each piece, except that an identical pair shares one of NumSquarePairs.
+        for (std::size_t i = 2; i < pieces.size(); ++i)
+        {
+            if (i == pairFirst)
+                index = (NumSquarePairs * index) + SquarePair(SymmetryTable[symmetry][Displacements[offsetList[i]]], SymmetryTable[symmetry][Displacements[offsetList[pairSecond]]]);
+            else if (i != pairSecond)
+                index = (64 * index) + SymmetryTable[symmetry][Displacements[offsetList[i]]];
+        }
+        return index;
+    }
+
+
+    Position Endgame::CanonicalPosition(const int *offsetList) const
+    {
+        // The canonical representation of a position is the symmetry with the smallest index.
+        // The King pair is the most significant part of the index, so a table lookup on the
+        // two Kings finds that symmetry, and only diagonal ties need the other pieces.
+        // Returns an index of 'length' if the Kings are touching.
+        // With pawns, the file of the first pawn alone decides whether to mirror the board.
+        if (numSlices > 0)
+        {
+            for (std::size_t i = 2; i < pieces.size(); ++i)
+                if (pieces[i] == WhitePawn)
+                    return RankPosition(offsetList, (File(offsetList[i]) > 'd') ? 1 : 0);
+        }
+
+        const KingPairTable::KingSymmetry& ks = KingPairs.kingSymmetry[Displacements[offsetList[0]]][Displacements[offsetList[1]]];
+        if (ks.pair < 0)
+            return Position(length, 0);
+
+        std::size_t index = AppendPieces(ks.pair, offsetList, ks.symmetry);
+        if (ks.tieSymmetry >= 0)
+        {
+            std::size_t tie = AppendPieces(ks.pair, offsetList, ks.tieSymmetry);
+            if (tie < index)
+                return Position(tie, ks.tieSymmetry);
+        }
+
+        return Position(index, ks.symmetry);
     }
 
 
-    Position Endgame::TableIndex() const
+    Position Endgame::SearchCanonicalPosition(const int *offsetList) const
     {
-        // Iterate through all symmetries and pick the one with the smallest index.
-        // That will be the canonical representation of the position.
+        // The original definition of CanonicalPosition, kept as a reference:
+        // iterate through all symmetries and pick the one with the smallest index.
+        // King pairs are numbered in the same order as the original index,
+        // so this picks the same symmetry the original index did.
 
-        Position best = CalcPosition(0);
+        Position best = RankPosition(offsetList, 0);
         for (int s=1; s < NumSymmetries; ++s)
         {
-            Position pos = CalcPosition(s);
+            Position pos = RankPosition(offsetList, s);
             if (pos.index < best.index)
                 best = pos;
         }
 
-        if (best.index >= length)
+        return best;
+    }
+
+
+    Position Endgame::TableIndex(const int *offsetList) const
+    {
+        Position best = CanonicalPosition(offsetList);
+        if (CheckedBuild && best.index >= length)
             throw ChessException("TableIndex: index is out of range");
 
         return best;
     }
 
 
-    void Endgame::Search(ChessBoard& board, std::size_t npieces, int mateInMoves, int& nfound, Side side)
+    void Endgame::Search(Worker& worker, std::size_t npieces, int mateInMoves, Side side)
     {
         using namespace std;
 
-        if (npieces == 0)
-        {
-            // The Black King is special: exploit symmetry by keeping
-            // it in the 10 distinct board locations.
-            for (size_t i=0; i < 10; ++i)
-            {
-                offsetList[npieces] = FirstPieceOffsets[i];
-                board.SetSquare(FirstPieceOffsets[i], pieces[npieces]);
-                Search(board, 1, mateInMoves, nfound, side);
-                // No need to erase Black King because it is moved automatically.
-            }
-        }
-        else if (npieces == 1)
+        GeneratorBoard& board = worker.board;
+        vector<int>& offsetList = worker.offsetList;
+
+        if (npieces == 1)
         {
             // Try putting the White King in 63 remaining different locations.
             for (size_t i=0; i < 64; ++i)
@@ -352,7 +2982,7 @@ namespace CosineKitty
                     offsetList[npieces] = PieceOffsets[i];
                     board.SetSquare(PieceOffsets[i], pieces[npieces]);
                     if (board.IsLegalPosition())        // prune positions where kings are touching
-                        Search(board, npieces+1, mateInMoves, nfound, side);
+                        Search(worker, npieces+1, mateInMoves, side);
                     // No need to erase White King because it is moved automatically.
                 }
             }
@@ -365,7 +2995,7 @@ namespace CosineKitty
                 {
                     offsetList[npieces] = PieceOffsets[i];
                     board.SetSquare(PieceOffsets[i], pieces[npieces]);
-                    Search(board, npieces+1, mateInMoves, nfound, side);
+                    Search(worker, npieces+1, mateInMoves, side);
                     board.SetSquare(PieceOffsets[i], Empty);    // must erase non-King pieces
                 }
             }
@@ -376,39 +3006,58 @@ namespace CosineKitty
             switch (side)
             {
             case Black:
-                nfound += ScoreBlack(board);
+                worker.nfound += ScoreBlack(worker, mateInMoves);
                 break;
 
             case White:
-                nfound += ScoreWhite(board, mateInMoves);
+                worker.nfound += ScoreWhite(worker, mateInMoves);
                 break;
 
             default:
-                throw ChessException("Search: invalid side");
+                if (CheckedBuild)
+                    throw ChessException("Search: invalid side");
+                break;
             }
         }
     }
 
-    int Endgame::ScoreWhite(ChessBoard& board, int mateInMoves)
+    int Endgame::ScoreWhite(Worker& worker, int mateInMoves)
     {
+        GeneratorBoard& board = worker.board;
+        PassCounters& counters = worker.counters;
+        ++counters.visited;
         board.SetTurn(true);    // make it be White's turn to move
         if (!board.IsLegalPosition())
+        {
+            ++counters.illegal;
             return 0;   // this position cannot be reached in a real chess game
+        }
 
         // Calculate the symmetric table index for this chess position.
-        Position pos = TableIndex();
+        Position pos = TableIndex(worker.offsetList);
+        ++counters.tableIndex;
 
         // If the position has already been resolved, don't do any redundant work.
         if (whiteTable.at(pos.index).score != Unscored)
+        {
+            ++counters.skipped;
             return 0;
+        }
 
         // Generate legal moves for White.
         MoveList movelist;
         board.GenMoves(movelist);
+        CheckMemory(worker, 1 + movelist.length);
+        ++counters.genMoves;
+        counters.moves += movelist.length;
         if (movelist.length == 0)
         {
-            // The game is over. This should never happen! White should always have a move.
-            throw ChessException("ScoreWhite: no legal moves for White");
+            // Black's lone King can never give check, so White is stalemated.
+            // Only blocked pawns can leave White without a move.
+            if (CheckedBuild && board.IsCurrentPlayerInCheck())
+                throw ChessException("ScoreWhite: White is checkmated");
+            whiteTable.at(pos.index) = Move(Draw);
+            return 1;
         }
 
         // Try every legal move and see if any are forced wins at the expected win horizon.
@@ -416,10 +3065,21 @@ namespace CosineKitty
         for (int i=0; i < movelist.length; ++i)
         {
             Move move = movelist.movelist[i];
-            UpdateOffset(move.source, move.dest);
-            Position next = TableIndex();
-            move.score = blackTable.at(next.index) - 1;     // penalize forced wins by one ply
-            UpdateOffset(move.dest, move.source);
+            short score;
+            ++counters.tableIndex;
+            if (board.GetSquare(move.Source()) == WhitePawn && move.Dest() > 90)    // reaching the 8th rank
+            {
+                // The table for the promoted piece already knows the outcome.
+                score = PromotionScore(worker.offsetList.data(), move);
+            }
+            else
+            {
+                UpdateOffset(worker.offsetList, move.source, move.dest);
+                Position next = TableIndex(worker.offsetList);
+                score = blackTable.at(next.index);
+                UpdateOffset(worker.offsetList, move.dest, move.source);
+            }
+            move.score = score - 1;     // penalize forced wins by one ply
 
             if (move.score == requiredScore)
             {
@@ -427,27 +3087,49 @@ namespace CosineKitty
                 whiteTable.at(pos.index) = pos.RotateMove(move);
                 return 1;
             }
+
+            // A promotion, or a pawn move into a finished slice, can be a mate
+            // longer than this pass is looking for. Remember which pass will take it.
+            if (move.score > Draw && move.score < requiredScore)
+            {
+                int due = ((WhiteMates + 1) - move.score) / 2;
+                if (worker.duePass == 0 || due < worker.duePass)
+                    worker.duePass = due;
+            }
         }
 
         return 0;   // no forced mate found at this horizon
     }
 
-    int Endgame::ScoreBlack(ChessBoard& board)
+    int Endgame::ScoreBlack(Worker& worker, int mateInMoves)
     {
+        GeneratorBoard& board = worker.board;
+        PassCounters& counters = worker.counters;
+        ++counters.visited;
         board.SetTurn(false);   // make it be Black's turn to move
         if (!board.IsLegalPosition())
+        {
+            ++counters.illegal;
             return 0;   // this position cannot be reached in a real chess game
+        }
 
         // Calculate the symmetric table index for this chess position.
-        Position pos = TableIndex();
+        Position pos = TableIndex(worker.offsetList);
+        ++counters.tableIndex;
 
         // If the position has already been resolved, don't do any redundant work.
         if (blackTable.at(pos.index) != Unscored)
+        {
+            ++counters.skipped;
             return 0;
+        }
 
         // Generate legal moves for White.
         MoveList movelist;
         board.GenMoves(movelist);
+        CheckMemory(worker, 1 + movelist.length);
+        ++counters.genMoves;
+        counters.moves += movelist.length;
         if (movelist.length == 0)
         {
             // The game is over: Black has either been stalemated or checkmated.
@@ -469,17 +3151,23 @@ namespace CosineKitty
         for (int i=0; i < movelist.length; ++i)
         {
             Move move = movelist.movelist[i];
-            Square capture = board.GetSquare(move.dest);
-            if (capture != Empty)
+            short score;
+            if (board.GetSquare(move.dest) != Empty)
             {
-                // Assume any capture of a White piece results in a draw.
-                blackTable.at(pos.index) = Draw;
-                return 1;
+                // The smaller table already knows the outcome after a capture.
+                // With only the Kings left, there is no table to look in.
+                score = CaptureScore(worker.offsetList.data(), move.dest);
+                if (pieces.size() > 3)
+                    ++counters.tableIndex;
+            }
+            else
+            {
+                ++counters.tableIndex;
+                UpdateOffset(worker.offsetList, move.source, move.dest);
+                Position next = TableIndex(worker.offsetList);
+                score = whiteTable.at(next.index).score;
+                UpdateOffset(worker.offsetList, move.dest, move.source);
             }
-            UpdateOffset(move.source, move.dest);
-            Position next = TableIndex();
-            short score = whiteTable.at(next.index).score;
-            UpdateOffset(move.dest, move.source);
 
             if (score == Unscored)
             {
@@ -497,7 +3185,7 @@ namespace CosineKitty
                 blackTable.at(pos.index) = Draw;
                 return 1;
             }
-            else
+            else if (CheckedBuild)
             {
                 throw ChessException("ScoreBlack: Unexpected win for Black");
             }
@@ -506,21 +3194,30 @@ namespace CosineKitty
         if (unresolvedCount > 0)
             return 0;   // cannot evaluate this position yet
 
-        if (bestScore > Draw && bestScore < WhiteMates)
+        // A capture can lead to a longer mate than this pass is looking for.
+        // Wait for the pass that matches the score, so every pass still resolves
+        // only positions with its own score, as the White passes expect.
+        if (bestScore < (WhiteMates + 2) - 2*mateInMoves)
         {
-            blackTable.at(pos.index) = bestScore;
-            return 1;
+            int due = ((WhiteMates + 2) - bestScore) / 2;
+            if (worker.duePass == 0 || due < worker.duePass)
+                worker.duePass = due;
+            if (!deferred.empty())
+                deferred[pos.index / 64].fetch_or(uint64_t(1) << (pos.index % 64), std::memory_order_relaxed);
+            return 0;
         }
 
-        throw ChessException("ScoreBlack: impossible score");
+        if (CheckedBuild && (bestScore <= Draw || bestScore >= WhiteMates))
+            throw ChessException("ScoreBlack: impossible score");
+
+        blackTable.at(pos.index) = bestScore;
+        return 1;
     }
 
 
-    void Endgame::UpdateOffset(int oldOffset, int newOffset)
+    void Endgame::UpdateOffset(std::vector<int>& offsetList, int oldOffset, int newOffset)
     {
-        ValidateOffset(oldOffset);
-        ValidateOffset(newOffset);
-
+        // The offsets come from moves the board generated, so they are already known to be valid.
         // Figure out which piece is being moved, and update its offset.
         for (int& ofs : offsetList)
         {
@@ -532,92 +3229,215 @@ namespace CosineKitty
         }
 
         // If we didn't find a matching offset, something is wrong!
-        throw ChessException("UpdateOffset: could not find piece at old offset");
+        if (CheckedBuild)
+            throw ChessException("UpdateOffset: could not find piece at old offset");
     }
 
 
-    void Endgame::WriteTypeScript(std::string filename, const char *piecelist) const
+    void Endgame::WriteWebTables(std::string prefix, int numThreads) const
     {
-        FILE *outfile = fopen(filename.c_str(), "wt");
-        if (outfile == NULL)
-            throw ChessException(std::string("Cannot open output file: ") + filename);
-
-        fprintf(outfile, "module Endgame_%s {\n", piecelist);
-        fprintf(outfile, "'use strict';\n");
-        fprintf(outfile, "export function GetTable() { return table; }\n");
-        fprintf(outfile, "const table = [\n");
+        // The web page fetches one file for each of the 10 Black King squares in the original layout,
+        // and only when a position needs it. Each file has an 8-byte header ("EGWB", version,
+        // piece count, Black King slot, 0) and then 2 bytes for every slot of its slice:
+        // the number of moves to mate (0 if White cannot force mate), and the index of the
+        // White piece to move (1 = King) in the high 2 bits with its target square (0..63) below.
+        // The move is in the same orientation as the slot, so the piece's own square gives its source.
+        // Each slot is the canonical one of the original layout, so the move is turned to match it.
+        // All 10 files are filled in one buffer, by threads taking chunks of table indices in turn,
+        // since every index has its own slot.
+        const std::size_t sliceLength = classicLength / 10;
+        const std::size_t sliceBytes = 8 + 2*sliceLength;
+        std::vector<unsigned char> data(10 * sliceBytes, 0);
+        for (int bk = 0; bk < 10; ++bk)
+        {
+            unsigned char *header = &data[bk * sliceBytes];
+            memcpy(header, "EGWB", 4);
+            header[4] = 1;
+            header[5] = static_cast<unsigned char>(pieces.size());
+            header[6] = static_cast<unsigned char>(bk);
+        }
 
-        int col = 0;
-        for (std::size_t i=0; i < length; ++i)
+        std::vector<Worker> workers(numThreads);
+        std::atomic<std::size_t> nextChunk(0);
+        RunWorkers(workers, [this, &data, &nextChunk, sliceLength, sliceBytes](Worker& worker, std::size_t)
         {
-            Move m = whiteTable[i];
-            if (m.score > 0)
-            {
-                int mateIn = ((WhiteMates + 1) - m.score) / 2;
-                col += fprintf(outfile, "'%s%d'", m.Algebraic().c_str(), mateIn);
-            }
-            if (i + 1 < length)
+            for (std::size_t start; (start = OutputChunkEntries * nextChunk++) < length; )
             {
-                col += fprintf(outfile, ",");
-                if (col > 120)
+                const std::size_t end = std::min(length, start + OutputChunkEntries);
+                for (std::size_t i = start; i < end; ++i)
                 {
-                    col = 0;
-                    fprintf(outfile, "\n");
+                    Move m = whiteTable[i];
+                    if (m.score > 0)
+                    {
+                        int mateIn = ((WhiteMates + 1) - m.score) / 2;
+                        if (mateIn > 255)
+                            throw ChessException("WriteWebTables: mate is too long for one byte.");
+
+                        UnrankPosition(i, worker.offsetList);
+                        std::size_t k = 1;
+                        while (worker.offsetList.at(k) != m.Source())
+                            ++k;
+
+                        // The original layout has a slot for both orders of an identical pair.
+                        for (int order = 0; order < ((pairFirst != 0) ? 2 : 1); ++order)
+                        {
+                            if (order == 1)
+                            {
+                                std::swap(worker.offsetList[pairFirst], worker.offsetList[pairSecond]);
+                                k = (k == pairFirst) ? pairSecond : (k == pairSecond) ? pairFirst : k;
+                            }
+
+                            Position slot = ClassicPosition(worker.offsetList);
+                            unsigned char *entry = &data[(slot.index / sliceLength) * sliceBytes + 8 + 2*(slot.index % sliceLength)];
+                            entry[0] = static_cast<unsigned char>(mateIn);
+                            entry[1] = static_cast<unsigned char>(((k - 1) << 6) | SymmetryTable[slot.symmetry][Displacements[m.Dest()]]);
+                        }
+                    }
                 }
             }
-        }
+        });
 
-        fprintf(outfile, "];\n");
-        fprintf(outfile, "}\n");
-        fclose(outfile);
+        for (int bk = 0; bk < 10; ++bk)
+        {
+            std::string filename = prefix + "_" + std::to_string(bk) + ".bin";
+            FILE *outfile = fopen(filename.c_str(), "wb");
+            if (outfile == NULL)
+                throw ChessException(std::string("Cannot open output file: ") + filename);
+
+            bool ok = (fwrite(&data[bk * sliceBytes], 1, sliceBytes, outfile) == sliceBytes);
+            ok = (fclose(outfile) == 0) && ok;
+            if (!ok)
+                throw ChessException(std::string("Error writing to file: ") + filename);
+        }
     }
 
 
-    void Endgame::Save(std::string filename) const
+    void Endgame::Save(std::string filename, int numThreads) const
     {
+        // One line for each position where White forces mate, in table order:
+        // the index in the original layout, the number of moves to mate, White's move, and the pieces,
+        // with the move and the pieces turned to that index's orientation.
         FILE *outfile = fopen(filename.c_str(), "wt");
         if (outfile == NULL)
             throw ChessException(std::string("Cannot open output file: ") + filename);
 
-        fprintf(outfile, "%lu\n", static_cast<unsigned long>(length));
-        for (std::size_t i=0; i < length; ++i)
+        try
         {
-            Move m = whiteTable[i];
-            if (m.score > 0)
+            fprintf(outfile, "%lu\n", static_cast<unsigned long>(classicLength));
+            WriteChunks(outfile, filename, length, numThreads, [this](Worker& worker, std::size_t start, std::size_t end, std::string& text)
             {
-                int mateIn = ((WhiteMates + 1) - m.score) / 2;
-                fprintf(outfile, "%9lu %2d %s %s\n",
-                    static_cast<unsigned long>(i),
-                    mateIn,
-                    m.Algebraic().c_str(),
-                    PositionText(i).c_str());
-            }
+                char line[64];
+                for (std::size_t i = start; i < end; ++i)
+                {
+                    if (whiteTable[i].score > 0)
+                    {
+                        UnrankPosition(i, worker.offsetList);
+                        Position slot = ClassicPosition(worker.offsetList);
+                        Move m = slot.RotateMove(whiteTable[i]);
+                        int mateIn = ((WhiteMates + 1) - m.score) / 2;
+                        char *p = FormatNumber(line, slot.index, 9);
+                        *p++ = ' ';
+                        p = FormatNumber(p, mateIn, 2);
+                        *p++ = ' ';
+                        *p++ = File(m.Source());
+                        *p++ = Rank(m.Source());
+                        *p++ = File(m.Dest());
+                        *p++ = Rank(m.Dest());
+                        if (m.Promotion() != 0)
+                            *p++ = "qrbn"[m.Promotion()];
+
+                        for (std::size_t k = 0; k < pieces.size(); ++k)
+                        {
+                            *p++ = (k > 0) ? ',' : ' ';
+                            int square = PieceOffsets[SymmetryTable[slot.symmetry][Displacements[worker.offsetList[k]]]];
+                            *p++ = SquareChar(pieces[k]);
+                            *p++ = File(square);
+                            *p++ = Rank(square);
+                        }
+                        *p++ = '\n';
+                        text.append(line, p - line);
+                    }
+                }
+            });
+        }
+        catch (const ChessException&)
+        {
+            fclose(outfile);
+            throw;
         }
 
-        fclose(outfile);
+        if (fclose(outfile))
+            throw ChessException(std::string("Error closing file: ") + filename);
     }
 
-    std::string Endgame::PositionText(std::size_t index) const
+    std::string Endgame::StatsJson() const
     {
+        // One line per pass, so the report is easy to read and to grep as well as to parse.
         using namespace std;
 
-        int i;
-        vector<int> offset(pieces.size());
-
-        const int n = static_cast<int>(pieces.size());
-        for (i = n-1; i > 0; --i)
+        char text[512];
+        snprintf(text, sizeof(text),
+            "{\n"
+            "  \"piecelist\": \"%s\",\n"
+            "  \"tableSize\": %lu,\n"
+            "  \"method\": \"%s\",\n"
+            "  \"threads\": %d,\n"
+            "  \"compiled\": %s,\n"
+            "  \"finished\": %s,\n"
+            "  \"seconds\": %0.3f,\n"
+            "  \"peakResidentBytes\": %lu,\n"
+            "  \"passes\": [",
+            piecelist.c_str(),
+            static_cast<unsigned long>(length),
+            stats.method.c_str(),
+            stats.threads,
+            stats.compiled ? "true" : "false",
+            stats.finished ? "true" : "false",
+            stats.seconds,
+            static_cast<unsigned long>(stats.peakResident));
+
+        string json = text;
+        for (size_t i = 0; i < stats.passes.size(); ++i)
         {
-            offset[i] = PieceOffsets[index % 64];
-            index /= 64;
+            const PassStats& pass = stats.passes[i];
+            const PassCounters& c = pass.counters;
+            snprintf(text, sizeof(text),
+                "%s\n    {\"side\": \"%s\", \"mateInMoves\": %d, \"slice\": %ld, \"found\": %d, \"seconds\": %0.6f, "
+                "\"deadSlotsSkipped\": %lu, \"visited\": %llu, \"illegal\": %llu, \"alreadyResolved\": %llu, \"genMovesCalls\": %llu, \"movesGenerated\": %llu, "
+                "\"genUnmovesCalls\": %llu, \"unmovesGenerated\": %llu, \"tableIndexCalls\": %llu, "
+                "\"residentBytes\": %lu, \"peakResidentBytes\": %lu}",
+                (i == 0) ? "" : ",",
+                (pass.side == White) ? "white" : "black",
+                pass.mateInMoves,
+                pass.slice,
+                pass.found,
+                pass.seconds,
+                static_cast<unsigned long>(pass.dead),
+                static_cast<unsigned long long>(c.visited),
+                static_cast<unsigned long long>(c.illegal),
+                static_cast<unsigned long long>(c.skipped),
+                static_cast<unsigned long long>(c.genMoves),
+                static_cast<unsigned long long>(c.moves),
+                static_cast<unsigned long long>(c.genUnmoves),
+                static_cast<unsigned long long>(c.unmoves),
+                static_cast<unsigned long long>(c.tableIndex),
+                static_cast<unsigned long>(pass.resident),
+                static_cast<unsigned long>(c.peakResident));
+            json += text;
         }
+        json += "\n  ]\n}";
+        return json;
+    }
 
-        if (index > 9)
-            throw ChessException("PositionText: Invalid index residue");
+    std::string Endgame::PositionText(std::size_t index) const
+    {
+        using namespace std;
 
-        offset[0] = FirstPieceOffsets[index];
+        vector<int> offset;
+        UnrankPosition(index, offset);
 
         string text;
-        for (i = 0; i < n; ++i)
+        for (size_t i = 0; i < pieces.size(); ++i)
         {
             if (i > 0)
                 text.push_back(',');
@@ -631,10 +3451,16 @@ namespace CosineKitty
 
     Move Position::RotateMove(Move move) const
     {
-        ValidateOffset(move.source);
-        ValidateOffset(move.dest);
-        int source = PieceOffsets[SymmetryTable[symmetry][Displacements[move.source]]];
-        int dest   = PieceOffsets[SymmetryTable[symmetry][Displacements[move.dest]]];
-        return Move(source, dest, move.score);
+        ValidateOffset(move.Source());
+        ValidateOffset(move.Dest());
+        int source = PieceOffsets[SymmetryTable[symmetry][Displacements[move.Source()]]];
+        int dest   = PieceOffsets[SymmetryTable[symmetry][Displacements[move.Dest()]]];
+        return Move(source, dest, move.score).Promoted(move.Promotion());
+    }
+
+    Move Position::UnrotateMove(Move move) const
+    {
+        // Convert a move stored in the table back to the orientation of the original position.
+        return Position(index, InverseSymmetry[symmetry]).RotateMove(move);
     }
 }
@@ -2,12 +2,28 @@
     main.cpp  -  Don Cross  -  https://github.com/cosinekitty/endgame
 */
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <thread>
 #include "chess.h"
 
 namespace CosineKitty
 {
+    static std::atomic<bool> StopSignal(false);
+
+    extern "C" void OnStopSignal(int)
+    {
+        StopSignal = true;
+    }
+
     int PrintUsage()
     {
         std::cerr <<
@@ -16,8 +32,102 @@ namespace CosineKitty
             "endgame test\n" <<
             "    Performs unit tests of the chess engine.\n" <<
             "\n" <<
-            "endgame generate <piecelist>\n" <<
+            "endgame generate [--retrograde] [--threads N] [--memory MB] [--stats FILE] [--generic] [--bitbase] [--prune-bishops] [--load | --resume] <piecelist>\n" <<
             "    Generate endgame database for the specified non-King White pieces.\n" <<
+            "    Writes <piecelist>.egb (binary), <piecelist>.egm (text), and web tables ../web/endgame_<piecelist>_*.bin.\n" <<
+            "    Tables with 3 non-King pieces are built in a memory-mapped file and written only as .egb.\n" <<
+            "    Captures and promotions are scored from the .egb files of the tables they lead to,\n" <<
+            "    which must already exist. Tables with pawns are solved one placement of the pawns\n" <<
+            "    at a time, most advanced first, ignore --retrograde, and write no web tables.\n" <<
+            "    --retrograde  After the first pass, visit only predecessors of newly resolved positions.\n" <<
+            "    --threads N   Split each pass across N worker threads.\n" <<
+            "    --load        Map the existing <piecelist>.egb instead of regenerating it.\n" <<
+            "    --resume      Continue from <piecelist>.ckpt, which is saved after every full move\n" <<
+            "                  and when the generator is stopped with SIGTERM or Ctrl+C.\n" <<
+            "    --memory MB   Build the tables in a memory-mapped file and keep resident memory near MB megabytes.\n" <<
+            "    --stats FILE  Write a JSON report of each pass to FILE: dead slots skipped, positions visited,\n" <<
+            "                  illegal and already resolved positions, GenMoves and TableIndex calls, time, and memory.\n" <<
+            "    --generic     Use the board-based move generator even when one is compiled for the\n" <<
+            "                  piece list (every list of up to 2 non-King pieces has one).\n" <<
+            "    --bitbase     Also write <piecelist>.egw, which holds only whether each position\n" <<
+            "                  is a forced win, in 2 bits per position; see EndgameBitbase.\n" <<
+            "    --prune-bishops  When the only other pieces are bishops, never search positions with\n" <<
+            "                  them all on one color; they cannot mate, so they stay draws.\n" <<
+            "\n" <<
+            "endgame generate-all [--retrograde] [--threads N] [--memory MB] [--stats FILE] [--generic] [--bitbase] [--prune-bishops] <piecelist> ...\n" <<
+            "    Generate each listed table and every table its captures and promotions lead to,\n" <<
+            "    smallest first, mapping each finished table read-only for the larger ones.\n" <<
+            "    With --stats, FILE holds a JSON list with the report for each table generated.\n" <<
+            "\n" <<
+            "endgame verify <piecelist>\n" <<
+            "    Map <piecelist>.egb and check the checksum of every block.\n" <<
+            "\n" <<
+            "endgame probe [--threads N] <piecelist>\n" <<
+            "    Read one FEN per line from standard input and write the answer from <piecelist>.egb\n" <<
+            "    for each line to standard output, in the same order:\n" <<
+            "        <move> mate <n>    White forces checkmate in n moves; <move> is the best move\n" <<
+            "        <move> draw        no forced win ('-' if there is no move to report)\n" <<
+            "        unknown            the position does not belong to this table, or is illegal\n" <<
+            "        invalid <reason>   the line is not a FEN\n" <<
+            "    Throughput is reported on standard error at the end.\n" <<
+            "    --threads N   Number of worker threads (default: one per core).\n" <<
+            "    --compressed  Read <piecelist>.egz instead of <piecelist>.egb.\n" <<
+            "    --cache N     Keep up to N decoded blocks of a compressed table in memory.\n" <<
+            "    --distances   Read <piecelist>.egd instead of <piecelist>.egb.\n" <<
+            "                  With pawns, promotions are scored from the .egd (or else .egb) file\n" <<
+            "                  of each table a promotion leads to.\n" <<
+            "\n" <<
+            "endgame compress <piecelist>\n" <<
+            "    Write <piecelist>.egz, a block-compressed copy of <piecelist>.egb that\n" <<
+            "    'endgame probe' can also read, then report the compression ratio and\n" <<
+            "    the time to read an entry with and without a cached block.\n" <<
+            "\n" <<
+            "endgame distances <piecelist>\n" <<
+            "    Write <piecelist>.egd, which keeps only one byte per position for each side: the\n" <<
+            "    distance to checkmate. 'endgame probe --distances' finds White's best move with\n" <<
+            "    a 1-ply search. Checks every entry against <piecelist>.egb, then benchmarks probes.\n" <<
+            "\n" <<
+            "endgame index <piecelist>\n" <<
+            "    Report how much of the table is wasted by each index layout.\n" <<
+            "\n" <<
+            "endgame bench board <piecelist>\n" <<
+            "    Verify that ChessBoard and BitBoard generate identical moves for every\n" <<
+            "    position in the endgame table, then compare their speed.\n" <<
+            "\n" <<
+            "endgame bench pass <piecelist>\n" <<
+            "    Time the first Black and White passes over every placement of the pieces and\n" <<
+            "    count their memory allocations. Build with -DENDGAME_UNCHECKED to compare the\n" <<
+            "    build without the hot path's defensive checks. Allocations are counted only in\n" <<
+            "    a build with -DENDGAME_COUNT_ALLOCATIONS, as ./run builds endgame_test.\n" <<
+            "\n" <<
+            "endgame bench generators <piecelist>\n" <<
+            "    Generate the table with the board-based generator and with the one compiled\n" <<
+            "    for the piece list, check that the tables are identical, and compare the times.\n" <<
+            "\n" <<
+            "endgame bench legal <piecelist>\n" <<
+            "    Check that GenMoves, which finds checks and pins once per position, gives the\n" <<
+            "    same moves as making each move and testing for check, in every legal position\n" <<
+            "    of the table; then compare their speed.\n" <<
+            "\n" <<
+            "endgame bench moves <piecelist>\n" <<
+            "    Time GenMoves, IsAttackedByWhite, PushMove/PopMove and TableIndex over a\n" <<
+            "    fixed set of positions from the table, in nanoseconds per call.\n" <<
+            "\n" <<
+            "endgame bench perft <depth> <fen>\n" <<
+            "    Count the positions reached by all legal move sequences from <fen>, for each\n" <<
+            "    depth up to <depth>, with both boards, and report nodes per second.\n" <<
+            "\n" <<
+            "endgame bench canon <piecelist>\n" <<
+            "    Canonicalize every placement of the pieces with the King-pair symmetry table\n" <<
+            "    and with the original search of all 8 symmetries; check they agree and compare speed.\n" <<
+            "\n" <<
+            "endgame bench probe <piecelist>\n" <<
+            "    Check EndgameProbe against itself on random positions from <piecelist>.egb,\n" <<
+            "    then measure the time for a single probe in nanoseconds.\n" <<
+            "\n" <<
+            "endgame bench bitbase <piecelist>\n" <<
+            "    Write the win/draw bitbase <piecelist>.egw from <piecelist>.egb, check it against\n" <<
+            "    the full table on random positions, and compare their lookup times.\n" <<
             "\n";
 
         return 1;
@@ -47,7 +157,8 @@ namespace CosineKitty
         return 0;
     }
 
-    int VerifyCheckmate(ChessBoard &board)
+    template <typename BoardType>
+    int VerifyCheckmate(BoardType &board)
     {
         using namespace std;
 
@@ -68,7 +179,7 @@ namespace CosineKitty
         return 0;
     }
 
-    int VerifyMoveList(ChessBoard &board, const char *text)
+    int CheckMoveList(const MoveList &movelist, const char *text)
     {
         using namespace std;
 
@@ -84,18 +195,15 @@ namespace CosineKitty
 
             if (text[5*n+4] != ' ')
             {
-                cerr << "VerifyMoveList: invalid text '" << text << "'" << endl;
+                cerr << "CheckMoveList: invalid text '" << text << "'" << endl;
                 return 1;
             }
         }
 
-        MoveList movelist;
-        board.GenMoves(movelist);
-
         // Confirm that the two move lists contain the same moves, ignoring order.
         if (expected.length != movelist.length)
         {
-            cerr << "VerifyMoveList: expected " << expected.length << " moves, found " << movelist.length << endl;
+            cerr << "CheckMoveList: expected " << expected.length << " moves, found " << movelist.length << endl;
             return 1;
         }
 
@@ -114,7 +222,7 @@ namespace CosineKitty
             }
             if (!found)
             {
-                cerr << "VerifyMoveList: Expected " << e.Algebraic() << " in move list, but is missing." << endl;
+                cerr << "CheckMoveList: Expected " << e.Algebraic() << " in move list, but is missing." << endl;
                 return 1;
             }
         }
@@ -122,11 +230,28 @@ namespace CosineKitty
         return 0;
     }
 
-    int Test_Moves()
+    template <typename BoardType>
+    int VerifyMoveList(BoardType &board, const char *text)
+    {
+        MoveList movelist;
+        board.GenMoves(movelist);
+        return CheckMoveList(movelist, text);
+    }
+
+    template <typename BoardType>
+    int VerifyUnmoveList(BoardType &board, const char *text)
+    {
+        MoveList movelist;
+        board.GenUnmoves(movelist);
+        return CheckMoveList(movelist, text);
+    }
+
+    template <typename BoardType>
+    int Test_Moves(const char *name)
     {
         using namespace std;
 
-        ChessBoard board;
+        BoardType board;
         if (VerifyMoveList(board, "e1d1 e1d2 e1e2 e1f2 e1f1")) return 1;
         board.SetSquare(Offset('c', '2'), WhiteKnight);
         if (VerifyMoveList(board, "e1d1 e1d2 e1e2 e1f2 e1f1 c2a1 c2a3 c2b4 c2d4 c2e3")) return 1;
@@ -140,31 +265,520 @@ namespace CosineKitty
         board.SetSquare(Offset('c', '1'), WhiteKing);
         if (VerifyCheckmate(board)) return 1;
 
-        cout << "Test_Moves: PASS" << endl;
+        // A pawn may advance two squares from its starting rank.
+        board.Clear(true);
+        board.SetSquare(Offset('a', '2'), WhitePawn);
+        if (VerifyMoveList(board, "e1d1 e1d2 e1e2 e1f2 e1f1 a2a3 a2a4")) return 1;
+
+        // On the last rank it becomes a Queen, Rook, Bishop, or Knight, and the pawn comes back on PopMove.
+        board.SetSquare(Offset('a', '2'), Empty);
+        board.SetSquare(Offset('a', '7'), WhitePawn);
+        MoveList movelist;
+        board.GenMoves(movelist);
+        int kinds = 0;
+        for (int i = 0; i < movelist.length; ++i)
+        {
+            Move move = movelist.movelist[i];
+            if (move.Dest() == Offset('a', '8'))
+            {
+                board.PushMove(move);
+                bool promoted = (board.GetSquare(move.Dest()) == PromotedPiece(WhitePawn, move.Promotion()));
+                board.PopMove();
+                if (!promoted || move.Promotion() != kinds++ || board.GetSquare(Offset('a', '7')) != WhitePawn)
+                {
+                    cerr << "FAIL(Test_Moves): wrong promotion " << move.Algebraic() << endl;
+                    return 1;
+                }
+            }
+        }
+
+        if (kinds != NumPromotions)
+        {
+            cerr << "FAIL(Test_Moves): found " << kinds << " promotions." << endl;
+            return 1;
+        }
+
+        cout << "Test_Moves(" << name << "): PASS" << endl;
+        return 0;
+    }
+
+    template <typename BoardType>
+    int Test_Unmoves(const char *name)
+    {
+        using namespace std;
+
+        // With Black to move, list the White moves that could have led here.
+        BoardType board;
+        board.Clear(false);
+        if (VerifyUnmoveList(board, "d1e1 d2e1 e2e1 f2e1 f1e1")) return 1;
+
+        // The rook checking from a8 must have just arrived along the a-file.
+        // Any other retraction would leave Black in check with White to move.
+        board.SetSquare(Offset('a', '8'), WhiteRook);
+        if (VerifyUnmoveList(board, "a1a8 a2a8 a3a8 a4a8 a5a8 a6a8 a7a8")) return 1;
+
+        // With White to move, list the Black King's retractions.
+        board.SetSquare(Offset('a', '8'), Empty);
+        board.SetTurn(true);
+        if (VerifyUnmoveList(board, "d8e8 d7e8 e7e8 f7e8 f8e8")) return 1;
+
+        // A pawn on the fourth rank may have come from either of the two squares behind it.
+        board.Clear(false);
+        board.SetSquare(Offset('c', '4'), WhitePawn);
+        if (VerifyUnmoveList(board, "d1e1 d2e1 e2e1 f2e1 f1e1 c3c4 c2c4")) return 1;
+
+        cout << "Test_Unmoves(" << name << "): PASS" << endl;
+        return 0;
+    }
+
+    int CompareLegalMoves(ChessBoard& board, int depth)
+    {
+        // Both generators must find the same moves, in the same order, everywhere in the tree.
+        MoveList movelist, trial;
+        board.GenMoves(movelist);
+        board.GenMovesByTrial(trial);
+        if (movelist.length != trial.length)
+            return 1;
+
+        for (int i = 0; i < movelist.length; ++i)
+            if (movelist.movelist[i].source != trial.movelist[i].source || movelist.movelist[i].dest != trial.movelist[i].dest)
+                return 1;
+
+        if (depth > 1)
+        {
+            for (int i = 0; i < movelist.length; ++i)
+            {
+                board.PushMove(movelist.movelist[i]);
+                int result = CompareLegalMoves(board, depth - 1);
+                board.PopMove();
+                if (result)
+                    return 1;
+            }
+        }
+        return 0;
+    }
+
+    int Test_LegalMoves()
+    {
+        using namespace std;
+
+        // A rook pinned against its King may only move along the pin.
+        ChessBoard board;
+        board.LoadFen("4r2k/8/8/8/8/8/4R3/4K3 w - - 0 1");
+        if (VerifyMoveList(board, "e1d1 e1d2 e1f2 e1f1 e2e3 e2e4 e2e5 e2e6 e2e7 e2e8")) return 1;
+
+        // In double check, only the King can move.
+        board.LoadFen("4k3/8/8/8/1b6/3n4/8/R3K3 w - - 0 1");
+        if (VerifyMoveList(board, "e1d1 e1e2 e1f1")) return 1;
+
+        const char *fens[] =
+        {
+            "8/8/3k4/8/1b6/8/3P4/4K3 w - - 0 1",        // pawn pinned by a bishop
+            "4k3/4r3/8/8/8/8/8/4RK2 b - - 0 1",         // Black rook pinned on the file
+            "8/8/8/8/1N6/3p4/4K3/7k w - - 0 1",         // check from a pawn
+            "3r4/4P3/8/8/8/8/k7/4K3 w - - 0 1",         // promotions, with and without capture
+            "r3k2r/pp1q1ppp/2n2n2/1B1pp3/3P4/2N1PN2/PPQ2PPP/R3K2R b - - 0 1",
+        };
+
+        for (const char *fen : fens)
+        {
+            board.LoadFen(fen);
+            if (CompareLegalMoves(board, 3))
+            {
+                cerr << "FAIL(Test_LegalMoves): GenMoves and GenMovesByTrial disagree after " << fen << endl;
+                return 1;
+            }
+        }
+
+        cout << "Test_LegalMoves: PASS" << endl;
+        return 0;
+    }
+
+    int Test_Fen()
+    {
+        using namespace std;
+
+        ChessBoard board;
+        board.LoadFen("8/8/8/3k4/8/8/1Q6/6K1 b - - 0 1");
+        if (board.IsWhiteTurn() || board.GetSquare(Offset('d','5')) != BlackKing || board.GetSquare(Offset('b','2')) != WhiteQueen || board.GetSquare(Offset('g','1')) != WhiteKing)
+        {
+            cerr << "FAIL(Test_Fen): board does not match the FEN." << endl;
+            return 1;
+        }
+
+        const char *bad[] = { "8/8/8/3k4/8/8/1Q6/6K1", "8/8/8/3k4/8/8/1Q6/6K2 w", "8/8/8/3k4/8/8/1Q6 w", "8/8/8/8/8/8/1Q6/6K1 w" };
+        for (const char *fen : bad)
+        {
+            try
+            {
+                board.LoadFen(fen);
+                cerr << "FAIL(Test_Fen): accepted malformed FEN " << fen << endl;
+                return 1;
+            }
+            catch (const ChessException&)
+            {
+            }
+        }
+
+        cout << "Test_Fen: PASS" << endl;
         return 0;
     }
 
+    int Test_ProbePromotion()
+    {
+        using namespace std;
+
+        // A distance table stores no moves, so a probe must score each promotion from the table
+        // of the new piece. Here b8=Q stalemates, but b8=R mates in 2.
+        Endgame q("q"), r("r"), b("b"), n("n"), p("p");
+        GenerateOptions options;
+        for (Endgame *table : { &q, &r, &b, &n })
+        {
+            table->Generate(options);
+            table->SaveBinary("unittest_" + table->PieceList() + ".egb");
+            p.SetSuccessorTable(table);
+        }
+        p.Generate(options);
+        p.SaveDistances("unittest_p.egd");
+
+        int rc = 0;
+        {
+            EndgameProbe probe("p", "unittest_p.egd");
+            ChessBoard board;
+            ProbeResult result;
+            if (!probe.ProbeFen("8/1P6/8/8/8/8/5K2/7k w - - 0 1", board, result) || result.move.Algebraic() != "b7b8r" || result.mateInMoves != 2)
+            {
+                cerr << "FAIL(Test_ProbePromotion): expected b7b8r mate 2, found " << result.move.Algebraic() << " mate " << result.mateInMoves << endl;
+                rc = 1;
+            }
+        }
+
+        remove("unittest_p.egd");
+        for (const char *name : { "q", "r", "b", "n" })
+            remove(("unittest_" + string(name) + ".egb").c_str());
+
+        if (rc == 0)
+            cout << "Test_ProbePromotion: PASS" << endl;
+        return rc;
+    }
+
     int UnitTest()
     {
         using namespace std;
 
         if (Test_Coordinates()) return 1;
-        if (Test_Moves()) return 1;
+        if (Test_Moves<ChessBoard>("ChessBoard")) return 1;
+        if (Test_Moves<BitBoard>("BitBoard")) return 1;
+        if (Test_Unmoves<ChessBoard>("ChessBoard")) return 1;
+        if (Test_Unmoves<BitBoard>("BitBoard")) return 1;
+        if (Test_Fen()) return 1;
+        if (Test_LegalMoves()) return 1;
         if (Endgame::UnitTest()) return 1;
+        if (Test_ProbePromotion()) return 1;
         cout << "UnitTest: PASS" << endl;
         return 0;
     }
 
-    int GenerateDatabase(const char *piecelist)
+    typedef std::map<std::string, std::unique_ptr<Endgame>> TableMap;  // tables mapped read-only, by piece list
+
+    void LoadSuccessorTables(Endgame& db, TableMap& tables)
+    {
+        // Map the .egb file of each table that a capture or promotion leads to, unless it is already mapped.
+        for (const std::string& name : db.SuccessorPieceLists())
+        {
+            std::unique_ptr<Endgame>& table = tables[name];
+            if (!table)
+            {
+                table.reset(new Endgame(name.c_str()));
+                table->Load(name + ".egb");
+            }
+            db.SetSuccessorTable(table.get());
+        }
+    }
+
+    bool ParseGenerateOption(int argc, const char *argv[], int& i, GenerateOptions& options, bool& usage)
+    {
+        // Handle the options shared by 'generate' and 'generate-all'.
+        // Returns false if argv[i] is not one of them.
+        if (!strcmp(argv[i], "--retrograde"))
+        {
+            options.retrograde = true;
+        }
+        else if (!strcmp(argv[i], "--threads") && i+2 < argc)
+        {
+            options.numThreads = atoi(argv[++i]);
+            if (options.numThreads < 1)
+                usage = true;
+        }
+        else if (!strcmp(argv[i], "--memory") && i+2 < argc)
+        {
+            int megabytes = atoi(argv[++i]);
+            if (megabytes < 1)
+                usage = true;
+            options.diskTables = true;
+            options.memoryLimit = static_cast<size_t>(megabytes) << 20;
+        }
+        else if (!strcmp(argv[i], "--stats") && i+2 < argc)
+        {
+            options.statsFile = argv[++i];
+        }
+        else if (!strcmp(argv[i], "--generic"))
+        {
+            options.generic = true;
+        }
+        else if (!strcmp(argv[i], "--bitbase"))
+        {
+            options.bitbase = true;
+        }
+        else if (!strcmp(argv[i], "--prune-bishops"))
+        {
+            options.pruneBishops = true;
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    void WriteStats(const std::string& filename, const std::vector<std::string>& reports, bool list)
+    {
+        // 'generate' writes one table's report; 'generate-all' writes a list of them.
+        FILE *outfile = fopen(filename.c_str(), "wt");
+        if (outfile == NULL)
+            throw ChessException(std::string("Cannot open output file: ") + filename);
+
+        if (list)
+            fprintf(outfile, "[\n");
+        for (std::size_t i = 0; i < reports.size(); ++i)
+            fprintf(outfile, "%s%s", (i == 0) ? "" : ",\n", reports[i].c_str());
+        if (list)
+            fprintf(outfile, "\n]");
+        fprintf(outfile, "\n");
+        fclose(outfile);
+    }
+
+    int GenerateTable(const char *piecelist, GenerateOptions options, bool load, TableMap& tables, std::vector<std::string>& reports)
     {
         using namespace std;
 
+        options.checkpointFile = string(piecelist) + ".ckpt";
+        options.stop = &StopSignal;
+
         // Create an EndgameConfig object from the piecelist string.
         Endgame db(piecelist);
         cout << "GenerateDatabase(" << piecelist << "): table size = " << db.GetTableSize() << endl;
-        db.Generate();
-        db.Save(string(piecelist) + ".egm");
-        db.WriteTypeScript(string("../web/endgame_") + piecelist + ".ts", piecelist);
+
+        // A 5-piece table needs about 700 MB even with 462 King pairs,
+        // and its text form would be several gigabytes.
+        const bool large = (db.PieceCount() == MaxEndgamePieces);
+        if (large)
+            options.diskTables = true;
+
+        if (load)
+        {
+            db.Load(string(piecelist) + ".egb");
+        }
+        else
+        {
+            LoadSuccessorTables(db, tables);
+
+            // Let the passes stop cleanly and save a checkpoint instead of dying mid-write.
+            signal(SIGTERM, OnStopSignal);
+            signal(SIGINT, OnStopSignal);
+            bool finished = db.Generate(options);
+            signal(SIGTERM, SIG_DFL);
+            signal(SIGINT, SIG_DFL);
+            if (!options.statsFile.empty())
+                reports.push_back(db.StatsJson());
+            if (!finished)
+            {
+                cout << "GenerateDatabase(" << piecelist << "): stopped; run again with --resume to continue." << endl;
+                return 1;
+            }
+            if (options.diskTables)
+            {
+                db.FinishTableFile(string(piecelist) + ".egb");
+            }
+            else
+            {
+                db.SaveBinary(string(piecelist) + ".egb");
+                remove(options.checkpointFile.c_str());
+            }
+        }
+
+        if (options.bitbase)
+            db.SaveBitbase(string(piecelist) + ".egw", options.numThreads);
+
+        if (large)
+            return 0;
+
+        db.Save(string(piecelist) + ".egm", options.numThreads);
+
+        // The web page only knows the original layout, which tables without pawns convert back to.
+        if (IndexScheme(piecelist) != PawnSliceIndexScheme)
+            db.WriteWebTables(string("../web/endgame_") + piecelist, options.numThreads);
+        return 0;
+    }
+
+    int GenerateDatabase(int argc, const char *argv[])
+    {
+        // argv[0] = "generate", followed by options, followed by the piece list.
+        GenerateOptions options;
+        bool load = false;
+        bool usage = false;
+        int i;
+        for (i = 1; i+1 < argc && !usage; ++i)
+        {
+            if (!strcmp(argv[i], "--load"))
+                load = true;
+            else if (!strcmp(argv[i], "--resume"))
+                options.resume = true;
+            else if (!ParseGenerateOption(argc, argv, i, options, usage))
+                return PrintUsage();
+        }
+
+        if (usage || i+1 != argc || (load && options.resume))
+            return PrintUsage();
+
+        TableMap tables;
+        std::vector<std::string> reports;
+        int result = GenerateTable(argv[i], options, load, tables, reports);
+        if (!reports.empty())
+            WriteStats(options.statsFile, reports, false);
+        return result;
+    }
+
+    int GenerateAll(int argc, const char *argv[])
+    {
+        using namespace std;
+
+        // argv[0] = "generate-all", followed by options, followed by one or more piece lists.
+        GenerateOptions options;
+        bool usage = false;
+        int i;
+        for (i = 1; i < argc && argv[i][0] == '-' && !usage; ++i)
+            if (!ParseGenerateOption(argc, argv, i, options, usage))
+                return PrintUsage();
+
+        if (usage || i == argc)
+            return PrintUsage();
+
+        // Collect every table the requested ones depend on through captures and promotions.
+        vector<string> order;
+        for (; i < argc; ++i)
+            order.push_back(argv[i]);
+
+        for (size_t k = 0; k < order.size(); ++k)
+            for (const string& name : Endgame(order[k].c_str()).SuccessorPieceLists())
+                if (find(order.begin(), order.end(), name) == order.end())
+                    order.push_back(name);
+
+        // A capture always leaves fewer pieces, and a promotion leaves one pawn fewer,
+        // so generating the smallest tables first, and then those with the fewest pawns,
+        // means every table finds the ones it needs already on disk.
+        auto pawns = [](const string& name) { return count(name.begin(), name.end(), 'p'); };
+        stable_sort(order.begin(), order.end(), [&pawns](const string& a, const string& b)
+        {
+            return (a.size() != b.size()) ? (a.size() < b.size()) : (pawns(a) < pawns(b));
+        });
+
+        // Each table is mapped once, the first time a larger table needs it,
+        // and is then shared read-only by every later generation.
+        TableMap tables;
+        vector<string> reports;
+        int result = 0;
+        for (const string& name : order)
+            if ((result = GenerateTable(name.c_str(), options, false, tables, reports)) != 0)
+                break;
+
+        if (!options.statsFile.empty())
+            WriteStats(options.statsFile, reports, true);
+        return result;
+    }
+
+    int VerifyDatabase(const char *piecelist)
+    {
+        using namespace std;
+
+        Endgame db(piecelist);
+        db.Load(string(piecelist) + ".egb");
+        if (!db.VerifyChecksums())
+            return 1;
+
+        cout << "VerifyDatabase(" << piecelist << "): PASS" << endl;
+        return 0;
+    }
+
+    int ProbeDatabase(int argc, const char *argv[])
+    {
+        using namespace std;
+        using namespace std::chrono;
+
+        // argv[0] = "probe", followed by options, followed by the piece list.
+        int numThreads = static_cast<int>(thread::hardware_concurrency());
+        if (numThreads < 1)
+            numThreads = 1;
+
+        bool compressed = false;
+        bool distances = false;
+        long cacheBlocks = static_cast<long>(DefaultCacheBlocks);
+        int i;
+        for (i = 1; i+1 < argc; ++i)
+        {
+            if (!strcmp(argv[i], "--threads") && i+2 < argc)
+            {
+                numThreads = atoi(argv[++i]);
+                if (numThreads < 1)
+                    return PrintUsage();
+            }
+            else if (!strcmp(argv[i], "--compressed"))
+            {
+                compressed = true;
+            }
+            else if (!strcmp(argv[i], "--distances"))
+            {
+                distances = true;
+            }
+            else if (!strcmp(argv[i], "--cache") && i+2 < argc)
+            {
+                cacheBlocks = atol(argv[++i]);
+                if (cacheBlocks < 1)
+                    return PrintUsage();
+            }
+            else
+            {
+                return PrintUsage();
+            }
+        }
+
+        if (i+1 != argc || (compressed && distances))
+            return PrintUsage();
+
+        const char *piecelist = argv[i];
+        EndgameProbe probe(piecelist, string(piecelist) + (compressed ? ".egz" : distances ? ".egd" : ".egb"), static_cast<size_t>(cacheBlocks));
+
+        // Reading and writing go through large blocks, not per-line syncing with C stdio.
+        ios::sync_with_stdio(false);
+        cin.tie(nullptr);
+
+        steady_clock::time_point start = steady_clock::now();
+        size_t count = probe.ProbeStream(cin, cout, numThreads);
+        duration<double> elapsed = steady_clock::now() - start;
+        fprintf(stderr, "ProbeDatabase(%s): %lu positions in %0.3f seconds = %0.0f positions/second with %d threads.\n",
+            piecelist,
+            static_cast<unsigned long>(count),
+            elapsed.count(),
+            (elapsed.count() > 0.0) ? (count / elapsed.count()) : 0.0,
+            numThreads);
+
+        if (compressed)
+        {
+            fprintf(stderr, "ProbeDatabase(%s): block cache had %lu hits and %lu misses.\n",
+                piecelist,
+                static_cast<unsigned long>(probe.Compressed().Hits()),
+                static_cast<unsigned long>(probe.Compressed().Misses()));
+        }
         return 0;
     }
 }
@@ -179,8 +793,90 @@ int main(int argc, const char *argv[])
         if (argc == 2 && !strcmp(argv[1], "test"))
             return UnitTest();
 
-        if (argc == 3 && !strcmp(argv[1], "generate"))
-            return GenerateDatabase(argv[2]);
+        if (argc >= 3 && !strcmp(argv[1], "generate"))
+            return GenerateDatabase(argc-1, argv+1);
+
+        if (argc >= 3 && !strcmp(argv[1], "generate-all"))
+            return GenerateAll(argc-1, argv+1);
+
+        if (argc >= 3 && !strcmp(argv[1], "probe"))
+            return ProbeDatabase(argc-1, argv+1);
+
+        if (argc == 3 && !strcmp(argv[1], "verify"))
+            return VerifyDatabase(argv[2]);
+
+        if (argc == 3 && !strcmp(argv[1], "compress"))
+        {
+            Endgame db(argv[2]);
+            db.Load(string(argv[2]) + ".egb");
+            return db.CompressionBenchmark(string(argv[2]) + ".egz");
+        }
+
+        if (argc == 3 && !strcmp(argv[1], "distances"))
+        {
+            Endgame db(argv[2]);
+            db.Load(string(argv[2]) + ".egb");
+            int rc = db.DistanceBenchmark(string(argv[2]) + ".egd");
+            if (rc != 0)
+                return rc;
+            return EndgameProbe(argv[2], string(argv[2]) + ".egd").Benchmark();
+        }
+
+        if (argc == 3 && !strcmp(argv[1], "index"))
+        {
+            Endgame(argv[2]).IndexReport();
+            return 0;
+        }
+
+        if (argc == 4 && !strcmp(argv[1], "bench") && !strcmp(argv[2], "board"))
+            return Endgame(argv[3]).BoardBenchmark();
+
+        if (argc == 4 && !strcmp(argv[1], "bench") && !strcmp(argv[2], "pass"))
+        {
+            Endgame db(argv[3]);
+            TableMap tables;
+            LoadSuccessorTables(db, tables);
+            return db.PassBenchmark();
+        }
+
+        if (argc == 4 && !strcmp(argv[1], "bench") && !strcmp(argv[2], "generators"))
+        {
+            Endgame generic(argv[3]);
+            Endgame compiled(argv[3]);
+            TableMap tables;
+            LoadSuccessorTables(generic, tables);
+            LoadSuccessorTables(compiled, tables);
+            return Endgame::GeneratorBenchmark(generic, compiled);
+        }
+
+        if (argc == 4 && !strcmp(argv[1], "bench") && !strcmp(argv[2], "legal"))
+            return Endgame(argv[3]).LegalMoveBenchmark();
+
+        if (argc == 4 && !strcmp(argv[1], "bench") && !strcmp(argv[2], "moves"))
+            return Endgame(argv[3]).MoveBenchmark();
+
+        if (argc == 5 && !strcmp(argv[1], "bench") && !strcmp(argv[2], "perft"))
+        {
+            int depth = atoi(argv[3]);
+            if (depth < 1 || depth > MaxUnmoves)
+                return PrintUsage();
+            return Endgame::PerftBenchmark(argv[4], depth);
+        }
+
+        if (argc == 4 && !strcmp(argv[1], "bench") && !strcmp(argv[2], "canon"))
+            return Endgame(argv[3]).CanonicalBenchmark();
+
+        if (argc == 4 && !strcmp(argv[1], "bench") && !strcmp(argv[2], "probe"))
+            return EndgameProbe(argv[3], string(argv[3]) + ".egb").Benchmark();
+
+        if (argc == 4 && !strcmp(argv[1], "bench") && !strcmp(argv[2], "bitbase"))
+        {
+            Endgame db(argv[3]);
+            db.Load(string(argv[3]) + ".egb");
+            db.SaveBitbase(string(argv[3]) + ".egw", max(1, static_cast<int>(thread::hardware_concurrency())));
+            EndgameProbe full(argv[3], string(argv[3]) + ".egb");
+            return EndgameBitbase(argv[3], string(argv[3]) + ".egw").Benchmark(full);
+        }
 
         return PrintUsage();
     }
@@ -0,0 +1,473 @@
+/*
+    probe.cpp  -  Don Cross  -  https://github.com/cosinekitty/endgame
+
+    Answers "what is the best move here?" straight from a mapped .egb table,
+    or from a .egd table that stores only the distance to mate, by finding
+    the move that leads one step closer to it.
+    EndgameProbe keeps no state between calls: every probe works on
+    fixed-size arrays on the stack, so one probe object can be shared
+    by any number of threads.
+*/
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <istream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include "chess.h"
+
+namespace CosineKitty
+{
+    EndgameProbe::EndgameProbe(const char *piecelist, std::string filename, std::size_t cacheBlocks)
+        : db(piecelist)
+    {
+        if (CompressedTable::IsCompressedFile(filename))
+            compressed.Open(filename, db.piecelist, db.length, cacheBlocks);
+        else if (DistanceTable::IsDistanceFile(filename))
+            OpenDistances(filename);
+        else
+            db.Load(filename);
+    }
+
+    void EndgameProbe::OpenDistances(const std::string& filename)
+    {
+        // A distance table stores no moves, so BestWhiteMove scores each promotion by looking up
+        // the position it leads to in the table for the new piece. That table's file is named
+        // like this one, with the promoted piece list: a .egd file if there is one, otherwise the .egb.
+        distances.Open(filename, db.piecelist, db.length);
+        if (db.numSlices == 0)
+            return;
+
+        const std::string suffix = db.piecelist + ".egd";
+        if (filename.size() < suffix.size() || filename.compare(filename.size() - suffix.size(), suffix.size(), suffix) != 0)
+            throw ChessException("EndgameProbe: cannot find the promotion tables for " + filename + ", which is not named <prefix>" + suffix);
+
+        const std::string prefix = filename.substr(0, filename.size() - suffix.size());
+        promotions.resize(db.pieces.size());
+        for (std::size_t i = 2; i < db.pieces.size(); ++i)
+        {
+            if (db.pieces[i] != WhitePawn)
+                continue;
+
+            promotions[i].resize(NumPromotions);
+            for (int kind = 0; kind < NumPromotions; ++kind)
+            {
+                std::string promoted = db.piecelist;
+                promoted[i-2] = "qrbn"[kind];
+                std::string name = prefix + promoted + ".egd";
+                if (!DistanceTable::IsDistanceFile(name))
+                    name = prefix + promoted + ".egb";
+                promotions[i][kind].reset(new EndgameProbe(promoted.c_str(), name));
+            }
+        }
+    }
+
+    Move EndgameProbe::WhiteEntry(std::size_t index) const
+    {
+        if (distances.IsOpen())
+            return Move(distances.WhiteScore(index));
+
+        return compressed.IsOpen() ? compressed.WhiteEntry(index) : db.whiteTable[index];
+    }
+
+    short EndgameProbe::BlackEntry(std::size_t index) const
+    {
+        if (distances.IsOpen())
+            return distances.BlackScore(index);
+
+        return compressed.IsOpen() ? compressed.BlackEntry(index) : db.blackTable[index];
+    }
+
+    bool EndgameProbe::Lookup(const int *offset, bool whiteToMove, ProbeResult& result) const
+    {
+        Position pos = db.CanonicalPosition(offset);
+        if (pos.index >= db.length)
+            return false;   // the Kings are touching
+
+        result = ProbeResult();
+        if (whiteToMove)
+        {
+            // A distance table has no move to report; Probe finds one.
+            Move entry = WhiteEntry(pos.index);
+            if (entry.score > Draw)
+            {
+                if (entry.Source() != 0)
+                    result.move = pos.UnrotateMove(entry);
+                result.score = entry.score;
+                result.mateInMoves = (WhiteMates + 1 - entry.score) / 2;
+            }
+        }
+        else
+        {
+            // The Black table holds only scores. Probe finds Black's best move.
+            short score = BlackEntry(pos.index);
+            if (score > Draw)
+            {
+                result.score = score;
+                result.mateInMoves = (WhiteMates - score) / 2;
+            }
+        }
+
+        // Positions the generator left unscored can never be forced wins, so report them as draws.
+        return true;
+    }
+
+    void EndgameProbe::BestWhiteMove(ChessBoard& board, const int *offset, ProbeResult& result) const
+    {
+        // Without a stored move, take the first one that leaves Black one ply closer to checkmate.
+        // A promotion is looked up in the table for the piece the pawn becomes,
+        // because a queen is not always best: it can give stalemate where a rook mates.
+        MoveList movelist;
+        board.GenMoves(movelist);
+
+        const std::size_t n = db.pieces.size();
+        const short target = result.score + 1;
+        int next[MaxEndgamePieces];
+        for (int i = 0; i < movelist.length; ++i)
+        {
+            Move move = movelist.movelist[i];
+            std::size_t moved = 0;
+            for (std::size_t k = 0; k < n; ++k)
+            {
+                next[k] = offset[k];
+                if (offset[k] == move.Source())
+                {
+                    next[k] = move.Dest();
+                    moved = k;
+                }
+            }
+
+            short score;
+            if (db.pieces[moved] == WhitePawn && Rank(move.Dest()) == '8')
+            {
+                ProbeResult promoted;
+                if (!promotions.at(moved).at(move.Promotion())->Lookup(next, false, promoted))
+                    continue;
+                score = promoted.score;
+            }
+            else
+            {
+                score = BlackEntry(db.CanonicalPosition(next).index);
+            }
+
+            if (score == target)
+            {
+                result.move = move;
+                return;
+            }
+        }
+    }
+
+    void EndgameProbe::BestBlackMove(ChessBoard& board, const int *offset, ProbeResult& result) const
+    {
+        // Pick the move the generator would have made for Black:
+        // any move that draws, otherwise the one that postpones checkmate the longest.
+        // The table score already says how good that move is, so take the first move that matches it.
+        // Captures are scored from smaller tables that are not mapped here, so a capture
+        // is the answer only when no other move matches; if there are several, report the first.
+        MoveList movelist;
+        board.GenMoves(movelist);
+
+        const std::size_t n = db.pieces.size();
+        const short target = (result.score > Draw) ? (result.score + 1) : Draw;
+        int next[MaxEndgamePieces];
+        int capture = -1;
+        for (int i = 0; i < movelist.length; ++i)
+        {
+            Move move = movelist.movelist[i];
+            if (board.GetSquare(move.dest) != Empty)
+            {
+                if (capture < 0)
+                    capture = i;
+                continue;
+            }
+
+            for (std::size_t k = 0; k < n; ++k)
+                next[k] = (offset[k] == move.source) ? move.dest : offset[k];
+
+            Position pos = db.CanonicalPosition(next);
+            short score = WhiteEntry(pos.index).score;
+            if (score < Draw)
+                score = Draw;
+
+            if (score == target)
+            {
+                result.move = move;
+                return;
+            }
+        }
+
+        if (capture >= 0)
+            result.move = movelist.movelist[capture];
+    }
+
+    bool EndgameProbe::Probe(ChessBoard& board, ProbeResult& result) const
+    {
+        int offset[MaxEndgamePieces];
+        if (!db.FindPieces(board, offset) || !board.IsLegalPosition())
+            return false;
+
+        bool whiteToMove = board.IsWhiteTurn();
+        if (!Lookup(offset, whiteToMove, result))
+            return false;
+
+        if (!whiteToMove)
+            BestBlackMove(board, offset, result);
+        else if (result.score > Draw && result.move.Source() == 0)
+            BestWhiteMove(board, offset, result);
+
+        return true;
+    }
+
+    bool EndgameProbe::ProbeFen(const char *fen, ChessBoard& board, ProbeResult& result) const
+    {
+        board.LoadFen(fen);
+        return Probe(board, result);
+    }
+
+    struct ProbeBatch       // a run of consecutive input lines and their formatted answers
+    {
+        std::size_t                 sequence;
+        std::size_t                 count;      // number of valid entries in 'lines'
+        std::vector<std::string>    lines;      // strings are reused from batch to batch to keep their capacity
+        std::string                 output;
+    };
+
+    class BatchQueue
+    {
+    private:
+        std::mutex                  mutex;
+        std::condition_variable     ready;
+        std::deque<ProbeBatch *>    queue;
+        bool                        closed;
+
+    public:
+        BatchQueue()
+            : closed(false)
+            {}
+
+        void Push(ProbeBatch *batch)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                queue.push_back(batch);
+            }
+            ready.notify_one();
+        }
+
+        ProbeBatch *Pop()
+        {
+            // Wait for a batch. Returns nullptr once the queue is closed and empty.
+            std::unique_lock<std::mutex> lock(mutex);
+            ready.wait(lock, [this]{ return closed || !queue.empty(); });
+            if (queue.empty())
+                return nullptr;
+            ProbeBatch *batch = queue.front();
+            queue.pop_front();
+            return batch;
+        }
+
+        void Close()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                closed = true;
+            }
+            ready.notify_all();
+        }
+    };
+
+    void EndgameProbe::FormatResult(const char *fen, ChessBoard& board, std::string& output) const
+    {
+        // One output line per input line:
+        //     <move> mate <n>     White forces checkmate in n moves
+        //     - mate 0            Black is already checkmated
+        //     <move> draw         no forced win; <move> is '-' if Black is stalemated or White's move is unknown
+        //     unknown             the pieces on the board do not match this table, or the position is illegal
+        //     invalid <reason>    the line is not a FEN this program can read
+        char text[32];
+        ProbeResult result;
+        try
+        {
+            if (!ProbeFen(fen, board, result))
+            {
+                output += "unknown\n";
+                return;
+            }
+        }
+        catch (const ChessException& ex)
+        {
+            output += "invalid ";
+            output += ex.Message();
+            output += '\n';
+            return;
+        }
+
+        if (result.move.Source() == 0)
+        {
+            output += '-';
+        }
+        else
+        {
+            const int source = result.move.Source();
+            const int dest = result.move.Dest();
+            text[0] = File(source);
+            text[1] = Rank(source);
+            text[2] = File(dest);
+            text[3] = Rank(dest);
+            text[4] = "qrbn"[result.move.Promotion()];
+            bool promotion = (board.GetSquare(source) == WhitePawn && Rank(dest) == '8');
+            output.append(text, promotion ? 5 : 4);
+        }
+
+        if (result.mateInMoves >= 0)
+        {
+            snprintf(text, sizeof(text), " mate %d\n", result.mateInMoves);
+            output += text;
+        }
+        else
+        {
+            output += " draw\n";
+        }
+    }
+
+    std::size_t EndgameProbe::ProbeStream(std::istream& input, std::ostream& output, int numThreads) const
+    {
+        // A three-stage pipeline: this thread reads batches of lines,
+        // 'numThreads' workers parse, canonicalize, look up and format them,
+        // and a writer thread puts the answers back in input order.
+        // A fixed pool of batches is recycled, so memory use stays bounded
+        // no matter how long the input is.
+        using namespace std;
+
+        if (numThreads < 1)
+            throw ChessException("ProbeStream: number of threads must be at least 1.");
+
+        const size_t BatchLines = 4096;
+        vector<ProbeBatch> pool(4 * numThreads);
+        BatchQueue freeQueue, workQueue, doneQueue;
+        for (ProbeBatch& batch : pool)
+        {
+            batch.lines.resize(BatchLines);
+            freeQueue.Push(&batch);
+        }
+
+        vector<exception_ptr> errors(numThreads + 1);
+        vector<thread> workers;
+        for (int t = 0; t < numThreads; ++t)
+        {
+            workers.push_back(thread([this, &workQueue, &doneQueue, &errors, t]()
+            {
+                // Every batch must reach the writer, even after a failure,
+                // or the writer would wait forever for the missing sequence number.
+                ChessBoard board;
+                while (ProbeBatch *batch = workQueue.Pop())
+                {
+                    try
+                    {
+                        batch->output.clear();
+                        for (size_t i = 0; i < batch->count; ++i)
+                            FormatResult(batch->lines[i].c_str(), board, batch->output);
+                    }
+                    catch (...)
+                    {
+                        errors[t] = current_exception();
+                    }
+                    doneQueue.Push(batch);
+                }
+            }));
+        }
+
+        thread writer([&output, &doneQueue, &freeQueue, &errors, numThreads]()
+        {
+            try
+            {
+                map<size_t, ProbeBatch *> pending;
+                size_t next = 0;
+                while (ProbeBatch *batch = doneQueue.Pop())
+                {
+                    pending[batch->sequence] = batch;
+                    for (auto it = pending.find(next); it != pending.end(); it = pending.find(++next))
+                    {
+                        output.write(it->second->output.data(), it->second->output.size());
+                        freeQueue.Push(it->second);
+                        pending.erase(it);
+                    }
+                }
+                output.flush();
+            }
+            catch (...)
+            {
+                errors[numThreads] = current_exception();
+            }
+            freeQueue.Close();
+        });
+
+        size_t total = 0;
+        size_t sequence = 0;
+        bool more = true;
+        while (more)
+        {
+            ProbeBatch *batch = freeQueue.Pop();
+            if (batch == nullptr)
+                break;      // the writer failed
+
+            batch->sequence = sequence++;
+            batch->count = 0;
+            while (batch->count < BatchLines)
+            {
+                string& line = batch->lines[batch->count];
+                if (!getline(input, line))
+                {
+                    more = false;
+                    break;
+                }
+                if (!line.empty() && line.back() == '\r')
+                    line.pop_back();
+                ++batch->count;
+            }
+            total += batch->count;
+            workQueue.Push(batch);
+        }
+
+        workQueue.Close();
+        for (thread& worker : workers)
+            worker.join();
+        doneQueue.Close();
+        writer.join();
+
+        for (exception_ptr& error : errors)
+            if (error)
+                rethrow_exception(error);
+
+        return total;
+    }
+
+    EndgameBitbase::EndgameBitbase(const char *piecelist, std::string filename)
+        : db(piecelist)
+    {
+        table.Open(filename, db.piecelist, db.length);
+    }
+
+    BitbaseEntry EndgameBitbase::Lookup(const int *offset, bool whiteToMove) const
+    {
+        Position pos = db.CanonicalPosition(offset);
+        if (pos.index >= db.length)
+            return BitbaseIllegal;     // the Kings are touching
+
+        return whiteToMove ? table.WhiteEntry(pos.index) : table.BlackEntry(pos.index);
+    }
+
+    BitbaseEntry EndgameBitbase::Probe(const ChessBoard& board) const
+    {
+        int offset[MaxEndgamePieces];
+        if (!db.FindPieces(board, offset))
+            return BitbaseIllegal;
+
+        return Lookup(offset, board.IsWhiteTurn());
+    }
+}
@@ -0,0 +1,1302 @@
+/*
+    tablefile.cpp  -  Don Cross  -  https://github.com/cosinekitty/endgame
+
+    Binary endgame table files (.egb) that can be mapped into memory
+    and used directly, with no parsing step.
+
+    File layout:
+        TableFileHeader
+        zero padding up to the next multiple of TableFileAlignment
+        White-to-move table: 'length' Move entries
+        zero padding up to the next multiple of TableFileAlignment
+        Black-to-move table: 'length' short entries
+        zero padding up to the next multiple of TableFileAlignment
+        'numBlocks' uint32_t CRC-32 values: first the White table's blocks, then the Black table's.
+        A generator checkpoint also has a CheckpointRecord at the very end.
+
+    Distance table files (.egd) have the same layout with a different signature,
+    but each entry is a single byte: the number of plies until checkmate plus 1,
+    or 0 if there is no forced win. The moves are found again when probing.
+    Bitbase files (.egw) are laid out the same way too, with 2-bit BitbaseEntry
+    values packed 4 to a byte, the first index in the lowest bits.
+
+    Block-compressed table files (.egz) hold the same two tables, cut into
+    blocks of CompressedBlockEntries entries that can each be decoded alone.
+
+    File layout:
+        CompressedFileHeader
+        numWhiteBlocks+numBlackBlocks+1 uint64_t file offsets: block b occupies [offset[b], offset[b+1]).
+        The compressed blocks, White table first.
+
+    Each block starts with a palette: a uint16_t count of the distinct entries
+    in the block, followed by those entries. Then comes the palette number of
+    each entry in the block, packed into the fewest bits that can hold them all.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include "chess.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CosineKitty
+{
+    static const char TableFileSignature[8] = { 'E', 'G', 'B', 'T', 'A', 'B', 'L', 'E' };
+    static const char CompressedFileSignature[8] = { 'E', 'G', 'Z', 'T', 'A', 'B', 'L', 'E' };
+    static const char DistanceFileSignature[8] = { 'E', 'G', 'D', 'T', 'A', 'B', 'L', 'E' };
+    static const char BitbaseFileSignature[8] = { 'E', 'G', 'W', 'T', 'A', 'B', 'L', 'E' };
+    static const uint32_t ByteOrderMark = 0x01020304;
+    static const uint64_t TableFileAlignment = 4096;     // keep each table page-aligned in the file
+    static const uint32_t ChecksumBlockBytes = 1 << 20;
+
+    static_assert(sizeof(TableFileHeader) == 80, "TableFileHeader must not contain padding.");
+    static_assert(sizeof(CompressedFileHeader) == 80, "CompressedFileHeader must not contain padding.");
+    static_assert(sizeof(Move) == 4, "Move entries must be 4 bytes to match the file format.");
+
+    struct CrcTable
+    {
+        uint32_t entry[256];
+
+        CrcTable()
+        {
+            // The standard reflected CRC-32 polynomial, as used by zip and PNG.
+            for (uint32_t n = 0; n < 256; ++n)
+            {
+                uint32_t c = n;
+                for (int k = 0; k < 8; ++k)
+                    c = (c & 1) ? (0xedb88320 ^ (c >> 1)) : (c >> 1);
+                entry[n] = c;
+            }
+        }
+    };
+
+    static const CrcTable CrcEntries;
+
+    uint32_t Crc32(const void *buffer, std::size_t nbytes, uint32_t crc)
+    {
+        const unsigned char *p = static_cast<const unsigned char *>(buffer);
+        crc = ~crc;
+        for (std::size_t i = 0; i < nbytes; ++i)
+            crc = CrcEntries.entry[(crc ^ p[i]) & 0xff] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    static uint64_t AlignUp(uint64_t offset)
+    {
+        return (offset + TableFileAlignment - 1) & ~(TableFileAlignment - 1);
+    }
+
+    static uint64_t TableBytes(uint64_t length, uint32_t entryBytes)
+    {
+        // An entry width of 0 means 2-bit entries, 4 to a byte.
+        return (entryBytes == 0) ? (length + 3) / 4 : length * entryBytes;
+    }
+
+    static uint64_t NumBlocks(uint64_t nbytes)
+    {
+        return (nbytes + ChecksumBlockBytes - 1) / ChecksumBlockBytes;
+    }
+
+    static void AppendBlockChecksums(const void *buffer, uint64_t nbytes, std::vector<uint32_t>& checksums)
+    {
+        const unsigned char *p = static_cast<const unsigned char *>(buffer);
+        for (uint64_t start = 0; start < nbytes; start += ChecksumBlockBytes)
+        {
+            uint64_t count = std::min<uint64_t>(ChecksumBlockBytes, nbytes - start);
+            checksums.push_back(Crc32(p + start, static_cast<std::size_t>(count)));
+        }
+    }
+
+    static void WriteBytes(FILE *outfile, const void *buffer, uint64_t nbytes, const std::string& filename)
+    {
+        if (nbytes > 0 && fwrite(buffer, 1, static_cast<std::size_t>(nbytes), outfile) != nbytes)
+            throw ChessException(std::string("Error writing to file: ") + filename);
+    }
+
+    static void WritePadding(FILE *outfile, uint64_t& position, const std::string& filename)
+    {
+        static const char zeros[TableFileAlignment] = { 0 };
+        uint64_t aligned = AlignUp(position);
+        WriteBytes(outfile, zeros, aligned - position, filename);
+        position = aligned;
+    }
+
+    static void FillHeader(
+        TableFileHeader& header,
+        const char *signature,
+        const std::string& piecelist,
+        std::size_t length,
+        uint32_t whiteEntryBytes,
+        uint32_t blackEntryBytes)
+    {
+        if (piecelist.size() >= sizeof(TableFileHeader::piecelist))
+            throw ChessException("WriteTables: piece list is too long.");
+
+        const uint64_t whiteBytes = TableBytes(length, whiteEntryBytes);
+        const uint64_t blackBytes = TableBytes(length, blackEntryBytes);
+
+        memset(&header, 0, sizeof(header));
+        memcpy(header.signature, signature, sizeof(header.signature));
+        header.version = TableFileVersion;
+        header.byteOrder = ByteOrderMark;
+        memcpy(header.piecelist, piecelist.c_str(), piecelist.size());
+        header.indexScheme = IndexScheme(piecelist);
+        header.whiteEntryBytes = whiteEntryBytes;
+        header.blackEntryBytes = blackEntryBytes;
+        header.blockBytes = ChecksumBlockBytes;
+        header.length = length;
+        header.whiteOffset = AlignUp(sizeof(header));
+        header.blackOffset = AlignUp(header.whiteOffset + whiteBytes);
+        header.checksumOffset = AlignUp(header.blackOffset + blackBytes);
+        header.numBlocks = static_cast<uint32_t>(NumBlocks(whiteBytes) + NumBlocks(blackBytes));
+        header.headerChecksum = Crc32(&header, sizeof(header));
+    }
+
+    static void WriteTableFile(
+        const std::string& filename,
+        const TableFileHeader& header,
+        const void *whiteTable,
+        const void *blackTable,
+        const CheckpointRecord *checkpoint)
+    {
+        using namespace std;
+
+        const uint64_t whiteBytes = TableBytes(header.length, header.whiteEntryBytes);
+        const uint64_t blackBytes = TableBytes(header.length, header.blackEntryBytes);
+
+        vector<uint32_t> checksums;
+        AppendBlockChecksums(whiteTable, whiteBytes, checksums);
+        AppendBlockChecksums(blackTable, blackBytes, checksums);
+
+        FILE *outfile = fopen(filename.c_str(), "wb");
+        if (outfile == NULL)
+            throw ChessException(string("Cannot open output file: ") + filename);
+
+        try
+        {
+            uint64_t position = sizeof(header);
+            WriteBytes(outfile, &header, sizeof(header), filename);
+            WritePadding(outfile, position, filename);
+            WriteBytes(outfile, whiteTable, whiteBytes, filename);
+            position += whiteBytes;
+            WritePadding(outfile, position, filename);
+            WriteBytes(outfile, blackTable, blackBytes, filename);
+            position += blackBytes;
+            WritePadding(outfile, position, filename);
+            WriteBytes(outfile, checksums.data(), checksums.size() * sizeof(uint32_t), filename);
+            if (checkpoint != nullptr)
+                WriteBytes(outfile, checkpoint, sizeof(CheckpointRecord), filename);
+        }
+        catch (const ChessException&)
+        {
+            fclose(outfile);
+            throw;
+        }
+
+        if (fclose(outfile))
+            throw ChessException(string("Error closing file: ") + filename);
+    }
+
+    static void CheckHeader(
+        TableFileHeader& header,
+        const unsigned char *base,
+        uint64_t fileSize,
+        const char *signature,
+        const std::string& piecelist,
+        std::size_t length,
+        uint32_t whiteEntryBytes,
+        uint32_t blackEntryBytes)
+    {
+        // Copy the header of a mapped table file and make sure the tables it describes fit inside the file.
+        if (fileSize < sizeof(TableFileHeader))
+            throw ChessException("file is too small");
+
+        memcpy(&header, base, sizeof(header));
+        if (memcmp(header.signature, signature, sizeof(header.signature)))
+            throw ChessException("not an endgame table file");
+
+        if (header.byteOrder != ByteOrderMark)
+            throw ChessException("file was written with a different byte order");
+
+        if (header.version != TableFileVersion)
+            throw ChessException("unsupported file version");
+
+        uint32_t expected = header.headerChecksum;
+        header.headerChecksum = 0;
+        if (Crc32(&header, sizeof(header)) != expected)
+            throw ChessException("header checksum mismatch");
+        header.headerChecksum = expected;
+
+        if (strncmp(header.piecelist, piecelist.c_str(), sizeof(header.piecelist)) || piecelist.size() >= sizeof(header.piecelist))
+            throw ChessException("file holds a different piece list");
+
+        if (header.indexScheme != IndexScheme(piecelist) || header.length != length)
+            throw ChessException("file uses a different index scheme");
+
+        if (header.whiteEntryBytes != whiteEntryBytes || header.blackEntryBytes != blackEntryBytes)
+            throw ChessException("file has a different entry width");
+
+        const uint64_t whiteBytes = TableBytes(length, whiteEntryBytes);
+        const uint64_t blackBytes = TableBytes(length, blackEntryBytes);
+        if (header.whiteOffset % TableFileAlignment || header.blackOffset % TableFileAlignment ||
+            header.whiteOffset + whiteBytes > fileSize ||
+            header.blackOffset + blackBytes > fileSize ||
+            header.checksumOffset + header.numBlocks * sizeof(uint32_t) > fileSize ||
+            header.blockBytes != ChecksumBlockBytes ||
+            header.numBlocks != NumBlocks(whiteBytes) + NumBlocks(blackBytes))
+            throw ChessException("file layout is corrupt");
+    }
+
+    static bool VerifyBlocks(const unsigned char *base, const void *whiteTable, const void *blackTable)
+    {
+        // Recalculate the checksum of every block of a table file's tables and compare with the stored ones.
+        TableFileHeader header;
+        memcpy(&header, base, sizeof(header));
+
+        std::vector<uint32_t> checksums;
+        AppendBlockChecksums(whiteTable, TableBytes(header.length, header.whiteEntryBytes), checksums);
+        AppendBlockChecksums(blackTable, TableBytes(header.length, header.blackEntryBytes), checksums);
+
+        const unsigned char *stored = base + header.checksumOffset;
+        for (std::size_t b = 0; b < checksums.size(); ++b)
+        {
+            uint32_t crc;
+            memcpy(&crc, stored + b*sizeof(uint32_t), sizeof(crc));
+            if (crc != checksums[b])
+            {
+                std::cerr << "VerifyChecksums: block " << b << " is corrupt." << std::endl;
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void Endgame::SaveBinary(std::string filename) const
+    {
+        WriteTables(filename, piecelist, length, whiteTable.data(), blackTable.data(), nullptr);
+    }
+
+    void Endgame::WriteTables(
+        const std::string& filename,
+        const std::string& piecelist,
+        std::size_t length,
+        const Move *whiteTable,
+        const short *blackTable,
+        const CheckpointRecord *checkpoint)
+    {
+        TableFileHeader header;
+        FillHeader(header, TableFileSignature, piecelist, length, sizeof(Move), sizeof(short));
+        WriteTableFile(filename, header, whiteTable, blackTable, checkpoint);
+    }
+
+    void Endgame::SaveDistances(std::string filename) const
+    {
+        std::vector<unsigned char> white(length);
+        std::vector<unsigned char> black(length);
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            white[i] = DistanceTable::EncodeScore(whiteTable[i].score);
+            black[i] = DistanceTable::EncodeScore(blackTable[i]);
+        }
+
+        TableFileHeader header;
+        FillHeader(header, DistanceFileSignature, piecelist, length, 1, 1);
+        WriteTableFile(filename, header, white.data(), black.data(), nullptr);
+    }
+
+    void Endgame::SaveBitbase(std::string filename, int numThreads) const
+    {
+        std::vector<unsigned char> white, black;
+        BuildBitbase(white, black, numThreads);
+
+        TableFileHeader header;
+        FillHeader(header, BitbaseFileSignature, piecelist, length, 0, 0);
+        WriteTableFile(filename, header, white.data(), black.data(), nullptr);
+    }
+
+    void Endgame::Load(std::string filename)
+    {
+        using namespace std;
+
+        // Map the file and point the tables directly at its contents.
+        // Only the header is checked here; call VerifyChecksums to check the table data too.
+        mappedFile.Open(filename);
+        AttachTables(filename);
+    }
+
+    void Endgame::AttachTables(const std::string& filename)
+    {
+        using namespace std;
+
+        try
+        {
+            TableFileHeader header;
+            CheckHeader(header, mappedFile.Data(), mappedFile.Size(), TableFileSignature, piecelist, length, sizeof(Move), sizeof(short));
+            whiteTable.Attach(reinterpret_cast<Move *>(mappedFile.Data() + header.whiteOffset), length);
+            blackTable.Attach(reinterpret_cast<short *>(mappedFile.Data() + header.blackOffset), length);
+        }
+        catch (const ChessException& ex)
+        {
+            mappedFile.Close();
+            throw ChessException(string("Load(") + filename + "): " + ex.Message());
+        }
+    }
+
+    bool Endgame::VerifyChecksums() const
+    {
+        // Recalculate the checksum of every block in a loaded file and compare.
+        if (!mappedFile.IsOpen())
+            throw ChessException("VerifyChecksums: no file has been loaded.");
+
+        return VerifyBlocks(mappedFile.Data(), whiteTable.data(), blackTable.data());
+    }
+
+    static const char CheckpointSignature[8] = { 'E', 'G', 'C', 'H', 'K', 'P', 'N', 'T' };
+
+    static CheckpointRecord SealCheckpoint(const CheckpointRecord& progress, bool diskTables)
+    {
+        CheckpointRecord record = progress;
+        memcpy(record.signature, CheckpointSignature, sizeof(record.signature));
+        record.diskTables = diskTables ? 1 : 0;
+        record.checksum = 0;
+        record.checksum = Crc32(&record, sizeof(record));
+        return record;
+    }
+
+    static void ReplaceFile(const std::string& source, const std::string& target)
+    {
+        if (rename(source.c_str(), target.c_str()))
+        {
+            // Windows will not rename over an existing file.
+            remove(target.c_str());
+            if (rename(source.c_str(), target.c_str()))
+                throw ChessException(std::string("Cannot rename ") + source + " to " + target);
+        }
+    }
+
+    void Endgame::CreateTableFile(const std::string& filename)
+    {
+        // Lay out a .egb file with room for a checkpoint record at the end,
+        // and build the tables right inside it. The file is mapped shared,
+        // so the operating system can write pages back and drop them from RAM.
+        TableFileHeader header;
+        FillHeader(header, TableFileSignature, piecelist, length, sizeof(Move), sizeof(short));
+        const uint64_t recordOffset = header.checksumOffset + header.numBlocks * sizeof(uint32_t);
+
+        mappedFile.OpenShared(filename, static_cast<std::size_t>(recordOffset + sizeof(CheckpointRecord)));
+        memcpy(mappedFile.Data(), &header, sizeof(header));
+        whiteTable.Attach(reinterpret_cast<Move *>(mappedFile.Data() + header.whiteOffset), length);
+        blackTable.Attach(reinterpret_cast<short *>(mappedFile.Data() + header.blackOffset), length);
+
+        // Fill the tables a King pair at a time, so the limit holds from the start.
+        for (std::size_t start = 0; start < length; start += pieceStride)
+        {
+            std::fill(&whiteTable[start], &whiteTable[start] + pieceStride, Move());
+            std::fill(&blackTable[start], &blackTable[start] + pieceStride, Unscored);
+            LimitMemory();
+        }
+
+        CheckpointRecord progress;
+        memset(&progress, 0, sizeof(progress));
+        CheckpointRecord record = SealCheckpoint(progress, true);
+        memcpy(mappedFile.Data() + recordOffset, &record, sizeof(record));
+    }
+
+    void Endgame::LimitMemory()
+    {
+        // Dropping pages of a shared mapping loses nothing: dirty pages are
+        // written back to the file, and the next touch reads them back in.
+        // The passes read entries all over the tables, so rather than tracking
+        // which pages are still useful, drop them all when the total gets too big.
+        if (diskTables && memoryLimit > 0 && ResidentMemory() > memoryLimit)
+            mappedFile.Release();
+    }
+
+    void Endgame::CheckMemory(Worker& worker, int lookups)
+    {
+        // Called before a worker reads 'lookups' table entries. Each read of a page that is
+        // not resident can bring in its neighbors too (64 KB on Linux), so check often enough
+        // that a worker cannot get far past the limit, but not so often that measuring shows up.
+        // The same samples give the peak resident memory of each pass for the --stats report.
+        const int CheckInterval = 1024;
+        if ((memoryLimit > 0 || sampleMemory) && (worker.sinceMemoryCheck += lookups) >= CheckInterval)
+        {
+            worker.sinceMemoryCheck = 0;
+            if (sampleMemory)
+                worker.counters.peakResident = std::max(worker.counters.peakResident, ResidentMemory());
+            LimitMemory();
+        }
+    }
+
+    void Endgame::StartCheckpoint(const CheckpointRecord& progress)
+    {
+        // Take a snapshot of the tables, then write it on another thread while the next pass runs.
+        // The file is written under a temporary name and renamed, so a crash mid-write
+        // leaves the previous checkpoint intact.
+        FinishCheckpoint();
+
+        CheckpointRecord record = SealCheckpoint(progress, diskTables);
+        if (diskTables)
+        {
+            // The tables are already in the file. Flush them, then the record that says
+            // how far they got. Entries written by later passes are final too, so a
+            // table that is ahead of its record is still a valid checkpoint.
+            checkpointWriter = std::thread([this, record]()
+            {
+                try
+                {
+                    mappedFile.Sync();
+                    memcpy(mappedFile.Data() + mappedFile.Size() - sizeof(record), &record, sizeof(record));
+                    mappedFile.Sync();
+                }
+                catch (...)
+                {
+                    checkpointError = std::current_exception();
+                }
+            });
+            return;
+        }
+
+        checkpointWhite.assign(whiteTable.data(), whiteTable.data() + length);
+        checkpointBlack.assign(blackTable.data(), blackTable.data() + length);
+
+        checkpointWriter = std::thread([this, record]()
+        {
+            try
+            {
+                std::string temp = checkpointFile + ".tmp";
+                WriteTables(temp, piecelist, length, checkpointWhite.data(), checkpointBlack.data(), &record);
+                ReplaceFile(temp, checkpointFile);
+            }
+            catch (...)
+            {
+                checkpointError = std::current_exception();
+            }
+        });
+    }
+
+    void Endgame::FinishCheckpoint()
+    {
+        // Wait for any checkpoint still being written, and report its failure.
+        if (checkpointWriter.joinable())
+            checkpointWriter.join();
+
+        if (checkpointError)
+        {
+            std::exception_ptr error = checkpointError;
+            checkpointError = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    void Endgame::LoadCheckpoint(bool retrograde, CheckpointRecord& progress)
+    {
+        using namespace std;
+
+        if (diskTables)
+            mappedFile.OpenShared(checkpointFile, 0);
+        else
+            mappedFile.Open(checkpointFile);
+        AttachTables(checkpointFile);
+
+        try
+        {
+            if (mappedFile.Size() < sizeof(CheckpointRecord))
+                throw ChessException("file is too small");
+
+            CheckpointRecord record;
+            memcpy(&record, mappedFile.Data() + mappedFile.Size() - sizeof(record), sizeof(record));
+            uint32_t expected = record.checksum;
+            record.checksum = 0;
+            if (memcmp(record.signature, CheckpointSignature, sizeof(record.signature)) || Crc32(&record, sizeof(record)) != expected)
+                throw ChessException("not a checkpoint file");
+
+            if (record.retrograde != (retrograde ? 1u : 0u))
+                throw ChessException(record.retrograde ? "checkpoint was written by a --retrograde run" : "checkpoint was not written by a --retrograde run");
+
+            if (record.blackPasses < record.whitePasses || record.blackPasses > record.whitePasses + 1 || record.slices > numSlices)
+                throw ChessException("checkpoint pass counts are inconsistent");
+
+            if (!record.diskTables && !VerifyChecksums())
+                throw ChessException("checkpoint tables are corrupt");
+
+            progress = record;
+        }
+        catch (const ChessException& ex)
+        {
+            mappedFile.Close();
+            throw ChessException(string("LoadCheckpoint(") + checkpointFile + "): " + ex.Message());
+        }
+
+        if (diskTables)
+        {
+            // Generation is about to change the tables in place, so the checksums go stale now.
+            CheckpointRecord record = SealCheckpoint(progress, true);
+            memcpy(mappedFile.Data() + mappedFile.Size() - sizeof(record), &record, sizeof(record));
+        }
+        else
+        {
+            // Generation writes to the tables, so they must not stay in the mapped file.
+            whiteTable.Own();
+            blackTable.Own();
+            mappedFile.Close();
+        }
+    }
+
+    void Endgame::FinishTableFile(std::string filename)
+    {
+        // Fill in the block checksums of the tables built in place,
+        // cut off the checkpoint record, and move the file to its final name.
+        // The result is byte-for-byte what SaveBinary would have written.
+        if (!diskTables || !mappedFile.IsOpen())
+            throw ChessException("FinishTableFile: the tables were not built in a file.");
+
+        FinishCheckpoint();
+
+        TableFileHeader header;
+        memcpy(&header, mappedFile.Data(), sizeof(header));
+        const uint64_t whiteBytes = length * sizeof(Move);
+        const uint64_t blackBytes = length * sizeof(short);
+
+        std::vector<uint32_t> checksums;
+        for (uint64_t start = 0; start < whiteBytes; start += 64 * ChecksumBlockBytes)
+        {
+            AppendBlockChecksums(mappedFile.Data() + header.whiteOffset + start, std::min<uint64_t>(64 * ChecksumBlockBytes, whiteBytes - start), checksums);
+            LimitMemory();
+        }
+        for (uint64_t start = 0; start < blackBytes; start += 64 * ChecksumBlockBytes)
+        {
+            AppendBlockChecksums(mappedFile.Data() + header.blackOffset + start, std::min<uint64_t>(64 * ChecksumBlockBytes, blackBytes - start), checksums);
+            LimitMemory();
+        }
+
+        if (checksums.size() != header.numBlocks)
+            throw ChessException("FinishTableFile: wrong number of checksum blocks.");
+
+        memcpy(mappedFile.Data() + header.checksumOffset, checksums.data(), checksums.size() * sizeof(uint32_t));
+        mappedFile.Sync();
+        mappedFile.CloseTruncated(static_cast<std::size_t>(header.checksumOffset + checksums.size() * sizeof(uint32_t)));
+        diskTables = false;
+
+        ReplaceFile(checkpointFile, filename);
+        Load(filename);
+    }
+
+    static int PaletteBits(std::size_t paletteSize)
+    {
+        int bits = 0;
+        while ((std::size_t(1) << bits) < paletteSize)
+            ++bits;
+        return bits;
+    }
+
+    static void EncodeBlock(const unsigned char *entry, std::size_t count, std::size_t width, std::vector<unsigned char>& out)
+    {
+        // Collect the distinct entries in this block, in order of first appearance.
+        std::vector<uint64_t> palette;
+        std::vector<uint16_t> code(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            uint64_t value = 0;
+            memcpy(&value, entry + i*width, width);
+            std::size_t k = std::find(palette.begin(), palette.end(), value) - palette.begin();
+            if (k == palette.size())
+                palette.push_back(value);
+            code[i] = static_cast<uint16_t>(k);
+        }
+
+        uint16_t paletteSize = static_cast<uint16_t>(palette.size());
+        const unsigned char *p = reinterpret_cast<const unsigned char *>(&paletteSize);
+        out.insert(out.end(), p, p + sizeof(paletteSize));
+        for (uint64_t value : palette)
+        {
+            p = reinterpret_cast<const unsigned char *>(&value);
+            out.insert(out.end(), p, p + width);
+        }
+
+        // Pack each entry's palette number into the fewest bits that can hold them all.
+        const int bits = PaletteBits(palette.size());
+        uint32_t buffer = 0;
+        int nbits = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            buffer |= static_cast<uint32_t>(code[i]) << nbits;
+            for (nbits += bits; nbits >= 8; nbits -= 8)
+            {
+                out.push_back(static_cast<unsigned char>(buffer));
+                buffer >>= 8;
+            }
+        }
+        if (nbits > 0)
+            out.push_back(static_cast<unsigned char>(buffer));
+    }
+
+    template <std::size_t width>
+    static void UnpackBlock(const unsigned char *palette, uint16_t paletteSize, const unsigned char *in, std::size_t count, unsigned char *out)
+    {
+        // A separate copy for each entry width lets the compiler turn memcpy into a single load and store.
+        const int bits = PaletteBits(paletteSize);
+        const uint32_t mask = (1u << bits) - 1;
+        uint32_t buffer = 0;
+        int nbits = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            while (nbits < bits)
+            {
+                buffer |= static_cast<uint32_t>(*in++) << nbits;
+                nbits += 8;
+            }
+            uint32_t k = buffer & mask;
+            buffer >>= bits;
+            nbits -= bits;
+            if (k >= paletteSize)
+                throw ChessException("DecodeBlock: palette number out of range");
+            memcpy(out + i*width, palette + k*width, width);
+        }
+    }
+
+    static void DecodeBlock(const unsigned char *in, const unsigned char *end, std::size_t width, std::size_t count, unsigned char *out)
+    {
+        uint16_t paletteSize;
+        if (end - in < static_cast<std::ptrdiff_t>(sizeof(paletteSize)))
+            throw ChessException("DecodeBlock: block is truncated");
+        memcpy(&paletteSize, in, sizeof(paletteSize));
+        in += sizeof(paletteSize);
+
+        const std::size_t packedBytes = (count * PaletteBits(paletteSize) + 7) / 8;
+        if (paletteSize == 0 || paletteSize > CompressedBlockEntries ||
+            static_cast<std::size_t>(end - in) != paletteSize*width + packedBytes)
+            throw ChessException("DecodeBlock: block has the wrong size");
+
+        switch (width)
+        {
+        case sizeof(Move):  UnpackBlock<sizeof(Move)>(in, paletteSize, in + paletteSize*width, count, out);     break;
+        case sizeof(short): UnpackBlock<sizeof(short)>(in, paletteSize, in + paletteSize*width, count, out);    break;
+        default:
+            throw ChessException("DecodeBlock: unsupported entry width");
+        }
+    }
+
+    static std::size_t NumCompressedBlocks(std::size_t length)
+    {
+        return (length + CompressedBlockEntries - 1) / CompressedBlockEntries;
+    }
+
+    void Endgame::SaveCompressed(std::string filename) const
+    {
+        using namespace std;
+
+        if (piecelist.size() >= sizeof(CompressedFileHeader::piecelist))
+            throw ChessException("SaveCompressed: piece list is too long.");
+
+        const size_t nblocks = NumCompressedBlocks(length);
+        vector<uint64_t> offset;
+        vector<unsigned char> data;
+        const uint64_t dataOffset = sizeof(CompressedFileHeader) + (2*nblocks + 1) * sizeof(uint64_t);
+        for (int side = 0; side < 2; ++side)
+        {
+            const size_t width = (side == 0) ? sizeof(Move) : sizeof(short);
+            const unsigned char *table = (side == 0) ?
+                reinterpret_cast<const unsigned char *>(whiteTable.data()) :
+                reinterpret_cast<const unsigned char *>(blackTable.data());
+
+            for (size_t b = 0; b < nblocks; ++b)
+            {
+                size_t first = b * CompressedBlockEntries;
+                size_t count = min<size_t>(CompressedBlockEntries, length - first);
+                offset.push_back(dataOffset + data.size());
+                EncodeBlock(table + first*width, count, width, data);
+            }
+        }
+        offset.push_back(dataOffset + data.size());
+
+        CompressedFileHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.signature, CompressedFileSignature, sizeof(header.signature));
+        header.version = TableFileVersion;
+        header.byteOrder = ByteOrderMark;
+        memcpy(header.piecelist, piecelist.c_str(), piecelist.size());
+        header.indexScheme = IndexScheme(piecelist);
+        header.whiteEntryBytes = sizeof(Move);
+        header.blackEntryBytes = sizeof(short);
+        header.blockEntries = CompressedBlockEntries;
+        header.length = length;
+        header.numWhiteBlocks = static_cast<uint32_t>(nblocks);
+        header.numBlackBlocks = static_cast<uint32_t>(nblocks);
+        header.indexOffset = sizeof(header);
+        header.fileBytes = offset.back();
+        header.headerChecksum = Crc32(&header, sizeof(header));
+
+        FILE *outfile = fopen(filename.c_str(), "wb");
+        if (outfile == NULL)
+            throw ChessException(string("Cannot open output file: ") + filename);
+
+        try
+        {
+            WriteBytes(outfile, &header, sizeof(header), filename);
+            WriteBytes(outfile, offset.data(), offset.size() * sizeof(uint64_t), filename);
+            WriteBytes(outfile, data.data(), data.size(), filename);
+        }
+        catch (const ChessException&)
+        {
+            fclose(outfile);
+            throw;
+        }
+
+        if (fclose(outfile))
+            throw ChessException(string("Error closing file: ") + filename);
+    }
+
+    CompressedTable::CompressedTable()
+        : base(nullptr)
+        , length(0)
+        , numWhiteBlocks(0)
+        , numBlocks(0)
+        , newest(-1)
+        , oldest(-1)
+        , hits(0)
+        , misses(0)
+        {}
+
+    bool CompressedTable::IsCompressedFile(const std::string& filename)
+    {
+        char signature[sizeof(CompressedFileSignature)];
+        FILE *infile = fopen(filename.c_str(), "rb");
+        if (infile == NULL)
+            return false;
+        bool match = (fread(signature, 1, sizeof(signature), infile) == sizeof(signature)) &&
+            !memcmp(signature, CompressedFileSignature, sizeof(signature));
+        fclose(infile);
+        return match;
+    }
+
+    void CompressedTable::Open(const std::string& filename, const std::string& piecelist, std::size_t _length, std::size_t cacheBlocks)
+    {
+        using namespace std;
+
+        if (cacheBlocks < 1)
+            throw ChessException("CompressedTable: the cache must hold at least one block.");
+
+        file.Open(filename);
+        try
+        {
+            const uint64_t fileSize = file.Size();
+            if (fileSize < sizeof(CompressedFileHeader))
+                throw ChessException("file is too small");
+
+            CompressedFileHeader header;
+            memcpy(&header, file.Data(), sizeof(header));
+            if (memcmp(header.signature, CompressedFileSignature, sizeof(header.signature)))
+                throw ChessException("not a compressed endgame table file");
+
+            if (header.byteOrder != ByteOrderMark)
+                throw ChessException("file was written with a different byte order");
+
+            if (header.version != TableFileVersion)
+                throw ChessException("unsupported file version");
+
+            uint32_t expected = header.headerChecksum;
+            header.headerChecksum = 0;
+            if (Crc32(&header, sizeof(header)) != expected)
+                throw ChessException("header checksum mismatch");
+
+            if (strncmp(header.piecelist, piecelist.c_str(), sizeof(header.piecelist)) || piecelist.size() >= sizeof(header.piecelist))
+                throw ChessException("file holds a different piece list");
+
+            if (header.indexScheme != IndexScheme(piecelist) || header.length != _length)
+                throw ChessException("file uses a different index scheme");
+
+            if (header.whiteEntryBytes != sizeof(Move) || header.blackEntryBytes != sizeof(short) || header.blockEntries != CompressedBlockEntries)
+                throw ChessException("file has a different entry or block size");
+
+            const size_t nblocks = NumCompressedBlocks(_length);
+            if (header.numWhiteBlocks != nblocks || header.numBlackBlocks != nblocks ||
+                header.fileBytes != fileSize ||
+                header.indexOffset % sizeof(uint64_t) ||
+                header.indexOffset + (2*nblocks + 1) * sizeof(uint64_t) > fileSize)
+                throw ChessException("file layout is corrupt");
+
+            // Check the block index once here, so Fetch can trust it.
+            const uint64_t *offset = reinterpret_cast<const uint64_t *>(file.Data() + header.indexOffset);
+            const uint64_t dataOffset = header.indexOffset + (2*nblocks + 1) * sizeof(uint64_t);
+            if (offset[0] != dataOffset || offset[2*nblocks] != fileSize)
+                throw ChessException("block index is corrupt");
+            for (size_t b = 0; b < 2*nblocks; ++b)
+                if (offset[b+1] < offset[b])
+                    throw ChessException("block index is corrupt");
+
+            base = file.Data();
+            length = _length;
+            numWhiteBlocks = nblocks;
+            numBlocks = 2 * nblocks;
+        }
+        catch (const ChessException& ex)
+        {
+            file.Close();
+            throw ChessException(string("CompressedTable(") + filename + "): " + ex.Message());
+        }
+
+        cacheBlocks = min(cacheBlocks, numBlocks);
+        slotData.assign(cacheBlocks * CompressedBlockEntries * sizeof(Move), 0);
+        slotBlock.assign(cacheBlocks, -1);
+        blockSlot.assign(numBlocks, -1);
+        newer.resize(cacheBlocks);
+        older.resize(cacheBlocks);
+        for (size_t slot = 0; slot < cacheBlocks; ++slot)
+        {
+            older[slot] = static_cast<int>(slot) - 1;
+            newer[slot] = (slot+1 < cacheBlocks) ? static_cast<int>(slot+1) : -1;
+        }
+        oldest = 0;
+        newest = static_cast<int>(cacheBlocks) - 1;
+        hits = misses = 0;
+    }
+
+    const unsigned char *CompressedTable::Fetch(std::size_t block) const
+    {
+        // The caller must hold 'mutex'.
+        int slot = blockSlot[block];
+        if (slot >= 0)
+        {
+            ++hits;
+        }
+        else
+        {
+            // Reuse the least recently used slot.
+            ++misses;
+            slot = oldest;
+            if (slotBlock[slot] >= 0)
+                blockSlot[slotBlock[slot]] = -1;
+
+            const uint64_t *offset = reinterpret_cast<const uint64_t *>(base + sizeof(CompressedFileHeader));
+            bool white = (block < numWhiteBlocks);
+            std::size_t first = (white ? block : block - numWhiteBlocks) * CompressedBlockEntries;
+            std::size_t count = std::min<std::size_t>(CompressedBlockEntries, length - first);
+            slotBlock[slot] = -1;
+            DecodeBlock(base + offset[block], base + offset[block+1], white ? sizeof(Move) : sizeof(short), count, &slotData[slot * CompressedBlockEntries * sizeof(Move)]);
+            slotBlock[slot] = static_cast<int>(block);
+            blockSlot[block] = slot;
+        }
+
+        // Move the slot to the newest end of the list.
+        if (slot != newest)
+        {
+            if (older[slot] >= 0)
+                newer[older[slot]] = newer[slot];
+            else
+                oldest = newer[slot];
+            older[newer[slot]] = older[slot];
+
+            older[slot] = newest;
+            newer[slot] = -1;
+            newer[newest] = slot;
+            newest = slot;
+        }
+
+        return &slotData[slot * CompressedBlockEntries * sizeof(Move)];
+    }
+
+    Move CompressedTable::WhiteEntry(std::size_t index) const
+    {
+        if (index >= length)
+            throw ChessException("CompressedTable: index out of range");
+
+        Move entry;
+        std::lock_guard<std::mutex> lock(mutex);
+        memcpy(&entry, Fetch(index / CompressedBlockEntries) + (index % CompressedBlockEntries) * sizeof(Move), sizeof(Move));
+        return entry;
+    }
+
+    short CompressedTable::BlackEntry(std::size_t index) const
+    {
+        if (index >= length)
+            throw ChessException("CompressedTable: index out of range");
+
+        short entry;
+        std::lock_guard<std::mutex> lock(mutex);
+        memcpy(&entry, Fetch(numWhiteBlocks + index / CompressedBlockEntries) + (index % CompressedBlockEntries) * sizeof(short), sizeof(short));
+        return entry;
+    }
+
+    DistanceTable::DistanceTable()
+        : white(nullptr)
+        , black(nullptr)
+        , length(0)
+        {}
+
+    unsigned char DistanceTable::EncodeScore(short score)
+    {
+        if (score <= Draw)
+            return 0;
+
+        int distance = WhiteMates + 1 - score;
+        if (distance > 255)
+            throw ChessException("DistanceTable: mate is too far away to store in one byte.");
+        return static_cast<unsigned char>(distance);
+    }
+
+    bool DistanceTable::IsDistanceFile(const std::string& filename)
+    {
+        char signature[sizeof(DistanceFileSignature)];
+        FILE *infile = fopen(filename.c_str(), "rb");
+        if (infile == NULL)
+            return false;
+        bool match = (fread(signature, 1, sizeof(signature), infile) == sizeof(signature)) &&
+            !memcmp(signature, DistanceFileSignature, sizeof(signature));
+        fclose(infile);
+        return match;
+    }
+
+    void DistanceTable::Open(const std::string& filename, const std::string& piecelist, std::size_t _length)
+    {
+        file.Open(filename);
+        try
+        {
+            TableFileHeader header;
+            CheckHeader(header, file.Data(), file.Size(), DistanceFileSignature, piecelist, _length, 1, 1);
+            white = file.Data() + header.whiteOffset;
+            black = file.Data() + header.blackOffset;
+            length = _length;
+        }
+        catch (const ChessException& ex)
+        {
+            file.Close();
+            throw ChessException(std::string("DistanceTable(") + filename + "): " + ex.Message());
+        }
+    }
+
+    bool DistanceTable::VerifyChecksums() const
+    {
+        if (!file.IsOpen())
+            throw ChessException("VerifyChecksums: no file has been loaded.");
+
+        return VerifyBlocks(file.Data(), white, black);
+    }
+
+    BitbaseTable::BitbaseTable()
+        : white(nullptr)
+        , black(nullptr)
+        , length(0)
+        {}
+
+    void BitbaseTable::Open(const std::string& filename, const std::string& piecelist, std::size_t _length)
+    {
+        file.Open(filename);
+        try
+        {
+            TableFileHeader header;
+            CheckHeader(header, file.Data(), file.Size(), BitbaseFileSignature, piecelist, _length, 0, 0);
+            white = file.Data() + header.whiteOffset;
+            black = file.Data() + header.blackOffset;
+            length = _length;
+        }
+        catch (const ChessException& ex)
+        {
+            file.Close();
+            throw ChessException(std::string("BitbaseTable(") + filename + "): " + ex.Message());
+        }
+    }
+
+    bool BitbaseTable::VerifyChecksums() const
+    {
+        if (!file.IsOpen())
+            throw ChessException("VerifyChecksums: no file has been loaded.");
+
+        return VerifyBlocks(file.Data(), white, black);
+    }
+
+#ifdef _WIN32
+    MappedFile::MappedFile()
+        : data(nullptr)
+        , size(0)
+        , shared(false)
+        , fileHandle(INVALID_HANDLE_VALUE)
+        , mapHandle(NULL)
+        {}
+
+    void MappedFile::Open(const std::string& filename)
+    {
+        Close();
+        fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+            throw ChessException(std::string("Cannot open file: ") + filename);
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+        {
+            Close();
+            throw ChessException(std::string("Cannot map empty file: ") + filename);
+        }
+
+        mapHandle = CreateFileMappingA(fileHandle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+        if (mapHandle != NULL)
+            data = static_cast<unsigned char *>(MapViewOfFile(mapHandle, FILE_MAP_COPY, 0, 0, 0));
+
+        if (data == nullptr)
+        {
+            Close();
+            throw ChessException(std::string("Cannot map file: ") + filename);
+        }
+
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+    }
+
+    void MappedFile::OpenShared(const std::string& filename, std::size_t newSize)
+    {
+        // Map a file for reading and writing, with changes going straight to the file.
+        // If 'newSize' is not zero, the file is created or replaced with that many zero bytes.
+        Close();
+        fileHandle = CreateFileA(filename.c_str(), GENERIC_READ | GENERIC_WRITE, 0, NULL, newSize ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+            throw ChessException(std::string("Cannot open file: ") + filename);
+
+        LARGE_INTEGER fileSize;
+        fileSize.QuadPart = static_cast<LONGLONG>(newSize);
+        if ((newSize == 0 && !GetFileSizeEx(fileHandle, &fileSize)) || fileSize.QuadPart == 0)
+        {
+            Close();
+            throw ChessException(std::string("Cannot map empty file: ") + filename);
+        }
+
+        // Creating the mapping also extends the file to the requested size.
+        mapHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READWRITE, fileSize.HighPart, fileSize.LowPart, NULL);
+        if (mapHandle != NULL)
+            data = static_cast<unsigned char *>(MapViewOfFile(mapHandle, FILE_MAP_WRITE, 0, 0, 0));
+
+        if (data == nullptr)
+        {
+            Close();
+            throw ChessException(std::string("Cannot map file: ") + filename);
+        }
+
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+        shared = true;
+    }
+
+    void MappedFile::Sync()
+    {
+        if (shared && (!FlushViewOfFile(data, 0) || !FlushFileBuffers(fileHandle)))
+            throw ChessException("Cannot write mapped file to disk.");
+    }
+
+    void MappedFile::Release()
+    {
+        // Unlocking pages that were never locked takes them out of the working set.
+        if (shared)
+            VirtualUnlock(data, size);
+    }
+
+    void MappedFile::Close()
+    {
+        if (data != nullptr)
+            UnmapViewOfFile(data);
+
+        if (mapHandle != NULL)
+            CloseHandle(mapHandle);
+
+        if (fileHandle != INVALID_HANDLE_VALUE)
+            CloseHandle(fileHandle);
+
+        data = nullptr;
+        size = 0;
+        shared = false;
+        mapHandle = NULL;
+        fileHandle = INVALID_HANDLE_VALUE;
+    }
+
+    void MappedFile::CloseTruncated(std::size_t newSize)
+    {
+        // Unmap a shared file, then cut it down to 'newSize' bytes.
+        if (data != nullptr)
+            UnmapViewOfFile(data);
+        data = nullptr;
+
+        if (mapHandle != NULL)
+            CloseHandle(mapHandle);
+        mapHandle = NULL;
+
+        LARGE_INTEGER position;
+        position.QuadPart = static_cast<LONGLONG>(newSize);
+        bool ok = SetFilePointerEx(fileHandle, position, NULL, FILE_BEGIN) && SetEndOfFile(fileHandle);
+        Close();
+        if (!ok)
+            throw ChessException("Cannot truncate mapped file.");
+    }
+
+    std::size_t ResidentMemory()
+    {
+        PROCESS_MEMORY_COUNTERS counters;
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return 0;
+        return counters.WorkingSetSize;
+    }
+
+    std::size_t PeakResidentMemory()
+    {
+        PROCESS_MEMORY_COUNTERS counters;
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return 0;
+        return counters.PeakWorkingSetSize;
+    }
+#else
+    MappedFile::MappedFile()
+        : data(nullptr)
+        , size(0)
+        , shared(false)
+        , fd(-1)
+        {}
+
+    void MappedFile::Open(const std::string& filename)
+    {
+        Close();
+        fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw ChessException(std::string("Cannot open file: ") + filename);
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size == 0)
+        {
+            Close();
+            throw ChessException(std::string("Cannot map empty file: ") + filename);
+        }
+
+        // A private mapping lets the caller scribble on the tables without changing the file.
+        void *address = mmap(nullptr, info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED)
+        {
+            Close();
+            throw ChessException(std::string("Cannot map file: ") + filename);
+        }
+
+        data = static_cast<unsigned char *>(address);
+        size = static_cast<std::size_t>(info.st_size);
+    }
+
+    void MappedFile::OpenShared(const std::string& filename, std::size_t newSize)
+    {
+        // Map a file for reading and writing, with changes going straight to the file.
+        // If 'newSize' is not zero, the file is created or replaced with that many zero bytes.
+        Close();
+        fd = newSize ? open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644) : open(filename.c_str(), O_RDWR);
+        if (fd < 0)
+            throw ChessException(std::string("Cannot open file: ") + filename);
+
+        struct stat info;
+        if (newSize != 0)
+        {
+            if (ftruncate(fd, static_cast<off_t>(newSize)) != 0)
+            {
+                Close();
+                throw ChessException(std::string("Cannot resize file: ") + filename);
+            }
+            info.st_size = static_cast<off_t>(newSize);
+        }
+        else if (fstat(fd, &info) != 0 || info.st_size == 0)
+        {
+            Close();
+            throw ChessException(std::string("Cannot map empty file: ") + filename);
+        }
+
+        void *address = mmap(nullptr, info.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED)
+        {
+            Close();
+            throw ChessException(std::string("Cannot map file: ") + filename);
+        }
+
+        data = static_cast<unsigned char *>(address);
+        size = static_cast<std::size_t>(info.st_size);
+        shared = true;
+    }
+
+    void MappedFile::Sync()
+    {
+        if (shared && msync(data, size, MS_SYNC) != 0)
+            throw ChessException("Cannot write mapped file to disk.");
+    }
+
+    void MappedFile::Release()
+    {
+        // Only safe for shared mappings: it would throw away the changes to a private one.
+        if (shared)
+            madvise(data, size, MADV_DONTNEED);
+    }
+
+    void MappedFile::Close()
+    {
+        if (data != nullptr)
+            munmap(data, size);
+
+        if (fd >= 0)
+            close(fd);
+
+        data = nullptr;
+        size = 0;
+        shared = false;
+        fd = -1;
+    }
+
+    void MappedFile::CloseTruncated(std::size_t newSize)
+    {
+        // Unmap a shared file, then cut it down to 'newSize' bytes.
+        if (data != nullptr)
+            munmap(data, size);
+        data = nullptr;
+
+        bool ok = (fd >= 0) && ftruncate(fd, static_cast<off_t>(newSize)) == 0;
+        Close();
+        if (!ok)
+            throw ChessException("Cannot truncate mapped file.");
+    }
+
+    std::size_t ResidentMemory()
+    {
+        // The second number in /proc/self/statm is the resident page count.
+        // The generator asks often, so keep the file open and reread it from the start.
+        // Where that file does not exist, report 0 so that no limit is enforced.
+        static const int statm = open("/proc/self/statm", O_RDONLY);
+        static const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        if (statm < 0)
+            return 0;
+
+        char text[128];
+        ssize_t nbytes = pread(statm, text, sizeof(text) - 1, 0);
+        if (nbytes <= 0)
+            return 0;
+        text[nbytes] = '\0';
+
+        unsigned long total = 0, resident = 0;
+        return (sscanf(text, "%lu %lu", &total, &resident) == 2) ? resident * pageSize : 0;
+    }
+
+    std::size_t PeakResidentMemory()
+    {
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return 0;
+#ifdef __APPLE__
+        return static_cast<std::size_t>(usage.ru_maxrss);           // bytes
+#else
+        return static_cast<std::size_t>(usage.ru_maxrss) * 1024;    // kilobytes
+#endif
+    }
+#endif
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+}
@@ -1,1875 +0,0 @@
-var Endgame_q;
-(function (Endgame_q) {
-    'use strict';
-    function GetTable() { return table; }
-    Endgame_q.GetTable = GetTable;
-    var table = [
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , 'd1a41', 'e1a51', 'f1a61', 'g1a71', 'h1a81', , , 'c2b11', 'd2b21', 'e2b21', 'f2b21', 'g2b21', 'h2b21', , 'b3b21', , 'd3b11', 'e3a31',
-        'f3a31', 'g3a31', 'h3a31', , 'b4b21', 'c4a41', , 'e4b11', 'f4a41', 'g4a41', 'h4a41', , 'b5b21', 'c5a31', 'd5a51', , 'f5b11', 'g5a51', 'h5a51',
-        ,
-        'b6b21', 'c6a41', 'd6a31', 'e6a61', , 'g6b11', 'h6a61', , 'b7b21', 'c7a51', 'd7a41', 'e7a31', 'f7a71', , 'h7b11', , 'b8b21', 'c8a61', 'd8a51',
-        'e8a41', 'f8a31', 'g8a81', , , , , , 'd1c22', 'd1c22', 'd1c22', 'd1c22', , , 'c2c34', 'd1c22', 'd1c22', 'd1c22', 'd1c22', 'd1c23', , 'b3b43', ,
-        'd1c22', 'd1c22', 'd1c22', 'd1c13', 'd1c13', , 'd1c12', 'c4b43', , 'd1c12', 'd1c12', 'd1c12', 'd1c12', , 'd1c12', 'd1c22', 'd5b53', , 'd1c22',
-        'd1c22', 'd1c22', , 'd1c12', 'd1c12', 'd1c22', 'e6b63', , 'd1c22', 'd1c22', , 'd1c12', 'd1c22', 'd1c12', 'd1c22', 'f7b73', , 'd1c22', , 'd1c12',
-        'd1c22', 'd1c22', 'd1c12', 'd1c22', 'g8b83', , , , , , , 'e1d14', 'e1d24', 'e1d24', , , 'c2d24', 'd2e24', 'e1d14', 'e1d14', 'e1d14', 'e1d14', ,
-        'b3b44', , 'd3e24', 'e1d14', 'e1d14', 'e1d14', 'e1d14', , 'e1d13', 'c4e24', , 'e1d14', 'e1d14', 'e1d14', 'e1d14', , 'e1d13', 'c5f24', 'd5g24',
-        ,
-        'e1d14', 'e1d24', 'e1d24', , 'e1d13', 'c6g24', 'd6d24', 'e1d24', , 'e1d14', 'e1d24', , 'e1d13', 'c7b64', 'd7d24', 'e1d14', 'e1d24', , 'e1d14',
-        ,
-        'e1d13', 'c8b74', 'd8d24', 'e1d24', 'e1d14', 'e1d24', , , , , , , , 'f1e25', 'f1e25', , , 'c2d25', 'f1e14', 'f1e14', 'f1e14', 'f1e14', 'f1e15',
-        ,
-        'b3b45', , 'd3d25', 'e3d25', 'f1e15', 'f1e15', 'f1e15', , 'f1e14', 'c4b45', , 'e4b45', 'f1e25', 'f1e25', 'f1e25', , 'f1e14', 'c5b45', 'd5d25',
-        ,
-        'f1e15', 'f1e15', 'f1e15', , 'f1e14', 'c6b55', 'd6d25', 'e6b65', , 'f1e25', 'f1e25', , 'f1e14', 'c7b65', 'd7d25', 'e7b45', 'f1e15', , 'f1e25',
-        ,
-        'f1e14', 'c8b75', 'd8d25', 'e8b55', 'f1e25', 'f1e15', , , , , , , , , 'h1g26', , , 'c2d26', 'g1f15', 'g1f25', 'f2g26', 'g1f16', 'g1f16', , 'b3b46',
-        ,
-        'd3e26', 'e3f26', 'f3g26', 'g3g26', 'h3g26', , 'g1f15', 'c4e26', , 'e4g26', 'f4f26', 'g1f16', 'g1f16', , 'g1f15', 'c5f26', 'd5g26', , 'f5f26',
-        'g5g26', 'h5e26', , 'g1f15', 'c6g26', 'd6d26', 'e6e26', , 'g6g26', 'h6d26', , 'g1f15', 'c7b66', 'd7d26', 'e7e26', 'f7f26', , 'h7b76', , 'g1f15',
-        'c8b76', 'd8d26', 'e8e26', 'f8f26', 'g8g26', , , , , , , , , , , , 'c2d27', 'h1g16', 'h1g16', 'h1g16', 'h1g16', 'h1g17', , 'b3b47', , 'd3e27', 'e3f27',
-        'f3f27', 'g3f27', 'h3a37', , 'h1g16', 'c4e27', , 'e4e27', 'f4f27', 'g4e27', 'h1g17', , 'h1g16', 'c5f27', 'd5d27', , 'f5f27', 'g5d27', 'h5e27',
-        ,
-        'h1g16', 'c6b57', 'd6d27', 'e6e27', , 'g6b67', 'h6d27', , 'h1g16', 'c7b67', 'd7d27', 'e7e27', 'f7f27', , 'h7b77', , 'h1g16', 'c8b77', 'd8d27',
-        'e8e27', 'f8f27', 'g8b87', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'd2a51', 'e2a61', 'f2a71', 'g2a81', 'c2c32', , 'b3b21', , 'd3a31', 'e3a31', 'f3a31', 'g3a31',
-        'h3a31', , 'b4b21', 'c4a41', , 'e4a41', 'f4a41', 'g4a41', 'h4a41', , 'b5b21', 'c5a31', 'd5a51', , 'f5a51', 'g5a51', 'h5a51', , 'b6b21', 'c6a41',
-        'd6a31', 'e6a61', , 'g6a61', 'h6a61', , 'b7b21', 'c7a51', 'd7a41', 'e7a31', 'f7a71', , 'h7a71', , 'b8b21', 'c8a61', 'd8a51', 'e8a41', 'f8a31',
-        'g8a81', , , , , , , , , , , , 'c2c34', , 'd2c22', 'd2c22', 'd2c22', 'd2c32', , 'b3b43', , 'd2c22', 'd2c22', 'd2c22', 'd2c13', 'd2c13', , 'd2c12', 'c4b43',
-        ,
-        'd2c12', 'd2c12', 'd2c12', 'd2c12', , 'd2c12', 'd2c22', 'd2c33', , 'd2c22', 'd2c22', 'd2c22', , 'd2c12', 'd2c12', 'd2c22', 'd2c33', , 'd2c22',
-        'd2c22', , 'd2c12', 'd2c22', 'd2c12', 'd2c22', 'd2c33', , 'd2c22', , 'd2c12', 'd2c22', 'd2c22', 'd2c12', 'd2c22', 'd2c33', , , , , , , , , , , , 'c2d24',
-        'e2d33', , 'e2d33', 'e2d33', 'e2d33', , 'b3b44', , 'd3d24', 'e2d14', 'e2d14', 'e2d14', 'e2d14', , 'e2d13', 'c4b44', , 'e2d14', 'e2d14', 'e2d14',
-        'e2d14', , 'e2d13', 'c5b44', 'd5d24', , 'e2d14', 'e2d24', 'e2d24', , 'e2d13', 'c6b54', 'd6d24', 'e2d24', , 'e2d14', 'e2d24', , 'e2d13', 'c7b64',
-        'd7d24', 'e2d14', 'e2d24', , 'e2d14', , 'e2d13', 'c8b74', 'd8d24', 'e2d24', 'e2d14', 'e2d24', , , , , , , , , , , , 'c2d25', 'f2e14', 'f2e14', , 'f2e14',
-        'f2e34', , 'b3b45', , 'd3e25', 'e3e25', 'f2e15', 'f2e15', 'f2e15', , 'f2e14', 'c4e25', , 'e4e25', 'f2e25', 'f2e25', 'f2e25', , 'f2e14', 'c5b45',
-        'd5d25', , 'f2e15', 'f2e15', 'f2e15', , 'f2e14', 'c6b55', 'd6d25', 'e6e25', , 'f2e25', 'f2e25', , 'f2e14', 'c7b65', 'd7d25', 'e7e25', 'f2e15',
-        ,
-        'f2e25', , 'f2e14', 'c8b75', 'd8d25', 'e8e25', 'f2e25', 'f2e15', , , , , , , , , , , , 'c2d26', 'g2f15', 'g2f25', 'g2f35', , 'g2f35', , 'b3b46', , 'd3e26',
-        'e3f26', 'f3f26', 'g3f26', 'g2f17', , 'g2f15', 'c4e26', , 'e4e26', 'f4f26', 'g2f16', 'g2f16', , 'g2f15', 'c5f26', 'd5d26', , 'f5f26', 'g5d26',
-        'h5e26', , 'g2f15', 'c6b56', 'd6d26', 'e6e26', , 'g6b66', 'h6d26', , 'g2f15', 'c7b66', 'd7d26', 'e7e26', 'f7f26', , 'h7b76', , 'g2f15', 'c8b76',
-        'd8d26', 'e8e26', 'f8f26', 'g8b86', , , , , , , , , , , , 'c2d27', 'h2g16', 'h2g16', 'h2g16', 'h2g16', , , 'b3b47', , 'd3e27', 'e3f27', 'f3g27', 'g3g27',
-        'h3g27', , 'h2g16', 'c4e27', , 'e4g27', 'f4f27', 'g4g27', 'h2g17', , 'h2g16', 'c5f27', 'd5g27', , 'f5f27', 'g5g27', 'h5e27', , 'h2g16', 'c6g27',
-        'd6d27', 'e6e27', , 'g6g27', 'h6d27', , 'h2g16', 'c7b67', 'd7d27', 'e7e27', 'f7f27', , 'h7b77', , 'h2g16', 'c8b77', 'd8d27', 'e8e27', 'f8f27',
-        'g8g27', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , 'c2b21', 'd2b21', 'e2b21', 'f2b21', 'g2b21', 'h2b21', , , , 'c3c22', 'c3c22', 'c3c22', 'c3b32', 'c3b32', , , , 'c3c22',
-        'c3c22', 'c3c22', 'c3c22', 'c3c22', , , , , 'c3c22', 'c3c22', 'c3c22', 'c3c22', , , , , , 'c3c22', 'c3c22', 'c3c22', , , , , , , 'c3c22', 'c3c22', , ,
-        ,
-        , , , , 'c3c22', , , , , , , , , , , 'c2d23', 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c32', , 'b3b43', , , 'd3c22', 'd3c22', 'd3c23', 'd3c23', , 'd3c22',
-        'c4b43', , 'd3c22', 'd3c22', 'd3c22', 'd3c22', , 'd3c22', 'd3c22', 'd3c33', , 'd3c22', 'd3c22', 'd3c22', , 'd3c22', 'd3c22', 'd3c22', 'd3c33',
-        ,
-        'd3c22', 'd3c22', , 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c33', , 'd3c22', , 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c33', , , , , ,
-        ,
-        , , , , , 'c2d24', 'e3d33', 'e3d33', 'e3d33', 'e3d33', 'e3d33', , 'b3b44', , 'd3e24', , 'e3d24', 'e3d24', 'e3d24', , 'e3d23', 'c4e24', , 'e3d24',
-        'e3d24', 'e3d24', 'e3d24', , 'e3d23', 'c5b44', 'd5g24', , 'e3d24', 'e3d24', 'e3d24', , 'e3d23', 'c6g24', 'd6h24', 'e3d24', , 'e3d24', 'e3d24',
-        ,
-        'e3d23', 'c7h24', 'd7d24', 'e3d24', 'e3d24', , 'e3d24', , 'e3d23', 'c8b74', 'd8d24', 'e3d24', 'e3d24', 'e3d24', , , , , , , , , , , , 'c2d25', 'f3e24',
-        'f3e34', 'f3e34', 'f3e34', 'f3e34', , 'b3b45', , 'd3e25', 'e3f25', , 'f3e25', 'f3e25', , 'f3e24', 'c4e25', , 'e4e25', 'f3e25', 'f3e25', 'f3e25',
-        ,
-        'f3e24', 'c5f25', 'd5d25', , 'f3e25', 'f3e25', 'f3e25', , 'f3e24', 'c6b55', 'd6h25', 'e6e25', , 'f3e25', 'f3e25', , 'f3e24', 'c7h25', 'd7d25',
-        'e7e25', 'f3e25', , 'f3e25', , 'f3e24', 'c8b75', 'd8d25', 'e8e25', 'f3e25', 'f3e25', , , , , , , , , , , , 'c2d26', 'g3f25', 'g3f25', 'g3f35', 'g3f35',
-        'g3f35', , 'b3b46', , 'd3e26', 'e3f26', 'f3g26', , 'h3h26', , 'g3f25', 'c4e26', , 'e4g26', 'f4f26', 'g3f26', 'g3f26', , 'g3f25', 'c5f26', 'd5g26',
-        ,
-        'f5f26', 'g5d26', 'h5h26', , 'g3f25', 'c6g26', 'd6d26', 'e6e26', , 'g6b66', 'h6h26', , 'g3f25', 'c7b66', 'd7d26', 'e7e26', 'f7f26', , 'h7h26',
-        ,
-        'g3f25', 'c8b76', 'd8d26', 'e8e26', 'f8f26', 'g8b86', , , , , , , , , , , , 'c2d27', 'h3g26', 'h3g26', 'h3g26', 'h3g36', 'h3g36', , 'b3b47', , 'd3e27',
-        'e3f27', 'f3g27', 'g3h27', , , 'h3g26', 'c4e27', , 'e4g27', 'f4h27', 'g4g27', 'h3g27', , 'h3g26', 'c5f27', 'd5g27', , 'f5f27', 'g5g27', 'h5e27',
-        ,
-        'h3g26', 'c6g27', 'd6h27', 'e6e27', , 'g6g27', 'h6d27', , 'h3g26', 'c7h27', 'd7d27', 'e7e27', 'f7f27', , 'h7b77', , 'h3g26', 'c8b77', 'd8d27',
-        'e8e27', 'f8f27', 'g8g27', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'c2d23', 'd4c32',
-        'd4c32', 'd4c32', 'd4c32', 'd4c32', , , , 'd3e23', 'd4c33', 'd4c33', 'd4c33', 'd4c33', , , , , 'd4c33', 'd4c33', 'd4c33', 'd4c33', , , , , 'd4c33',
-        'd4c33', 'd4c33', 'd4c33', , , , , , 'd4c33', 'd4c33', 'd4c33', , , , , , , 'd4c33', 'd4c33', , , , , , , , 'd4c33', , , , , , , , , , , 'c2d24', 'e4d33', 'e4d33',
-        'e4d33', 'e4d33', 'e4d33', , 'b3b44', , 'd3e24', 'e3f24', 'e4d34', 'e4d34', 'h3h24', , 'e4d33', 'c4e24', , , 'e4d34', 'e4d34', 'e4d34', , 'e4d33',
-        'c5f24', 'd5d24', , 'e4d34', 'e4d34', 'e4d34', , 'e4d33', 'c6b54', 'd6h24', 'e4d34', , 'e4d34', 'e4d34', , 'e4d33', 'c7h24', 'd7d24', 'e4d34',
-        'e4d34', , 'e4d34', , 'e4d33', 'c8b74', 'd8d24', 'e4d34', 'e4d34', 'e4d34', , , , , , , , , , , , 'c2d25', 'f4e34', 'f4e34', 'f4e34', 'f4e34', 'f4e34',
-        ,
-        'b3b45', , 'd3e25', 'e3f25', 'f3g25', 'f4e35', 'f4e35', , 'f4e34', 'c4e25', , 'e4g25', , 'f4e35', 'f4e35', , 'f4e34', 'c5f25', 'd5g25', , 'f4e35',
-        'f4e35', 'f4e35', , 'f4e34', 'c6g25', 'd6d25', 'e6e25', , 'f4e35', 'f4e35', , 'f4e34', 'c7b65', 'd7d25', 'e7e25', 'f4e35', , 'f4e35', , 'f4e34',
-        'c8b75', 'd8d25', 'e8e25', 'f4e35', 'f4e35', , , , , , , , , , , , 'c2d26', 'g4f35', 'g4f35', 'g4f35', 'g4f35', 'g4f35', , 'b3b46', , 'd3e26', 'e3f26',
-        'f3g26', 'g3h26', 'h3h26', , 'g4f35', 'c4e26', , 'e4g26', 'f4h26', , 'g4f36', , 'g4f35', 'c5f26', 'd5g26', , 'f5f26', 'g5d26', 'h5h26', , 'g4f35',
-        'c6g26', 'd6h26', 'e6e26', , 'g6b66', 'h6h26', , 'g4f35', 'c7h26', 'd7d26', 'e7e26', 'f7f26', , 'h7h26', , 'g4f35', 'c8b76', 'd8d26', 'e8e26',
-        'f8f26', 'g8b86', , , , , , , , , , , , 'c2d27', 'h4g36', 'h4g36', 'h4g36', 'h4g36', 'h4g36', , 'b3b47', , 'd3e27', 'e3f27', 'f3g27', 'g3h27', 'h3h27',
-        ,
-        'h4g36', 'c4e27', , 'e4g27', 'f4h27', 'g4g27', , , 'h4g36', 'c5f27', 'd5g27', , 'f5f27', 'g5g27', 'h5e27', , 'h4g36', 'c6g27', 'd6h27', 'e6e27',
-        ,
-        'g6g27', 'h6d27', , 'h4g36', 'c7h27', 'd7d27', 'e7e27', 'f7f27', , 'h7b77', , 'h4g36', 'c8b77', 'd8d27', 'e8e27', 'f8f27', 'g8g27', , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , 'c2d24', 'e5d43', 'e5d43', 'e5d43', 'e5d43', 'e5d43', , , , 'd3e24', 'e3f24', 'f3g24', 'g3h24', 'h3h24', , , , , 'e4g24',
-        'f4h24', 'g4g24', 'h4h24', , , , , , 'f5f24', 'g5g24', 'h5h24', , , , , , 'f6f24', 'g6g24', 'h6h24', , , , , , , 'g7g24', 'h7h24', , , , , , , , 'h8h24', , ,
-        ,
-        , , , , , , , 'c2d25', 'f5e44', 'f5e44', 'f5e44', 'f5e44', 'f5e44', , 'b3b45', , 'd3e25', 'e3f25', 'f3g25', 'f5e45', 'h3h25', , 'f5e44', 'c4e25',
-        ,
-        'e4g25', 'f4h25', 'g4g25', 'h4h25', , 'f5e44', 'c5f25', 'd5g25', , , 'f5e45', 'f5e45', , 'f5e44', 'c6g25', 'd6h25', 'e6e25', , 'f5e45', 'f5e45',
-        ,
-        'f5e44', 'c7h25', 'd7d25', 'e7e25', 'f5e45', , 'f5e45', , 'f5e44', 'c8b75', 'd8d25', 'e8e25', 'f5e45', 'f5e45', , , , , , , , , , , , 'c2d26', 'g5f45',
-        'g5f45', 'g5f45', 'g5f45', 'g5f45', , 'b3b46', , 'd3e26', 'e3f26', 'f3g26', 'g3h26', 'h3h26', , 'g5f45', 'c4e26', , 'e4g26', 'f4h26', 'g4g26',
-        'g5f56', , 'g5f45', 'c5f26', 'd5g26', , 'f5f26', , 'h5h26', , 'g5f45', 'c6g26', 'd6h26', 'e6e26', , 'g6b66', 'h6h26', , 'g5f45', 'c7h26', 'd7d26',
-        'e7e26', 'f7f26', , 'h7h26', , 'g5f45', 'c8b76', 'd8d26', 'e8e26', 'f8f26', 'g8b86', , , , , , , , , , , , 'c2d27', 'h5g46', 'h5g46', 'h5g46', 'h5g46',
-        'h5g46', , 'b3b47', , 'd3e27', 'e3f27', 'f3g27', 'g3h27', 'h3h27', , 'h5g46', 'c4e27', , 'e4g27', 'f4h27', 'g4g27', 'h4h27', , 'h5g46', 'c5f27',
-        'd5g27', , 'f5f27', 'g5g27', , , 'h5g46', 'c6g27', 'd6h27', 'e6e27', , 'g6g27', 'h6d27', , 'h5g46', 'c7h27', 'd7d27', 'e7e27', 'f7f27', , 'h7b77',
-        ,
-        'h5g46', 'c8b77', 'd8d27', 'e8e27', 'f8f27', 'g8g27', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , 'c2d25', 'f6e54', 'f6e54', 'f6e54', 'f6e54', 'f6e54', , , , 'd3e25', 'e3f25', 'f3g25', 'g3h25', 'h3h25', , , , , 'e4g25', 'f4h25',
-        'g4g25', 'h4h25', , , , , , 'f5f25', 'g5g25', 'h5h25', , , , , , , 'f6e55', 'h6h25', , , , , , , 'g7g25', 'f6e55', , , , , , , , 'h8h25', , , , , , , , , , , 'c2d26',
-        'g6f55', 'g6f55', 'g6f55', 'g6f55', 'g6f55', , 'b3b46', , 'd3e26', 'e3f26', 'f3g26', 'g3h26', 'h3h26', , 'g6f55', 'c4e26', , 'e4g26', 'f4h26',
-        'g4g26', 'g6f56', , 'g6f55', 'c5f26', 'd5g26', , 'f5f26', 'g5g26', 'h5h26', , 'g6f55', 'c6g26', 'd6h26', 'e6e26', , , 'h6h26', , 'g6f55', 'c7h26',
-        'd7d26', 'e7e26', 'f7f26', , 'h7h26', , 'g6f55', 'c8b76', 'd8d26', 'e8e26', 'f8f26', 'g8b86', , , , , , , , , , , , 'c2d27', 'h6g56', 'h6g56', 'h6g56',
-        'h6g56', 'h6g56', , 'b3b47', , 'd3e27', 'e3f27', 'f3g27', 'g3h27', 'h3h27', , 'h6g56', 'c4e27', , 'e4g27', 'f4h27', 'g4g27', 'h4h27', , 'h6g56',
-        'c5f27', 'd5g27', , 'f5f27', 'g5g27', 'h5h27', , 'h6g56', 'c6g27', 'd6h27', 'e6e27', , 'g6g27', , , 'h6g56', 'c7h27', 'd7d27', 'e7e27', 'f7f27',
-        ,
-        'h7b77', , 'h6g56', 'c8b77', 'd8d27', 'e8e27', 'f8f27', 'g8g27', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'c2d26', 'g7f65', 'g7f65', 'g7f65',
-        'g7f65', 'g7f65', , , , 'd3e26', 'e3f26', 'f3g26', 'g3h26', 'h3h26', , , , , 'e4g26', 'f4h26', 'g4g26', 'h4h26', , , , , , 'f5f26', 'g5g26', 'h5h26',
-        ,
-        , , , , , 'g6g26', 'h6h26', , , , , , , , 'h7h26', , , , , , , , 'h8h26', , , , , , , , , , , 'c2d27', 'h7g66', 'h7g66', 'h7g66', 'h7g66', 'h7g66', , 'b3b47', , 'd3e27',
-        'e3f27', 'f3g27', 'g3h27', 'h3h27', , 'h7g66', 'c4e27', , 'e4g27', 'f4h27', 'g4g27', 'h4h27', , 'h7g66', 'c5f27', 'd5g27', , 'f5f27', 'g5g27',
-        'h5h27', , 'h7g66', 'c6g27', 'd6h27', 'e6e27', , 'g6g27', 'h6h27', , 'h7g66', 'c7h27', 'd7d27', 'e7e27', 'f7f27', , , , 'h7g66', 'c8b77', 'd8d27',
-        'e8e27', 'f8f27', 'g8g27', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'c2d27',
-        'h8g76', 'h8g76', 'h8g76', 'h8g76', 'h8g76', , , , 'd3e27', 'e3f27', 'f3g27', 'g3h27', 'h3h27', , , , , 'e4g27', 'f4h27', 'g4g27', 'h4h27', , ,
-        ,
-        , , 'f5f27', 'g5g27', 'h5h27', , , , , , , 'g6g27', 'h6h27', , , , , , , , 'h7h27', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , 'e1e23', 'f1f23', 'g1g23', 'h1g23', , , , 'd2e23', 'e2e53', 'f2g23', 'g2f23', 'h2g23', 'a3b43', , 'c3e53', , 'e3e53',
-        'f3g23', 'g3g23', 'h3g23', 'a4b53', , 'c4e23', 'd4e53', , 'f4f23', 'g4g23', 'h4f23', 'a5b63', , 'c5e53', 'd5e53', 'd1d23', , 'g5g23', 'h5e23',
-        'a6b73', , 'c6g23', 'd6e53', 'e6e53', 'f6f23', , 'h6d23', 'a7b83', , 'c7e53', 'd7d23', 'e7e53', 'f7f23', 'g7g23', , 'a8b83', , 'c8b73', 'd8d23',
-        'e8e53', 'f8f23', 'g8g23', 'h8e53', , , , , , 'e1d14', 'e1d24', 'e1d24', , , , 'e1d13', 'e1d13', 'e1d13', 'e1d13', 'e1d14', 'e1e24', , 'e1d14',
-        ,
-        'e1d14', 'e1d14', 'e1d14', 'e1d14', 'e1d14', , 'e1d14', 'e1d14', , 'e1d14', 'e1d14', 'e1d14', 'e1d14', , 'e1d14', 'e1d14', 'e1d13', , 'e1d24',
-        'e1d24', 'e1d14', , 'e1d24', 'e1d14', 'e1d24', 'e1d14', , 'e1d24', 'e1d24', , 'e1d24', 'e1d14', 'e1d14', 'e1d24', 'e1d14', , 'e1d24', , 'e1d24',
-        'e1d14', 'e1d24', 'e1d14', 'e1d24', 'e1d14', , , , , , , 'g1g25', 'h1g25', , , , 'f1e24', 'e2f25', 'f1e15', 'f1e15', 'f1e15', 'f1e24', , 'c3d25',
-        ,
-        'e3f25', 'f3g25', 'g3g25', 'h3g25', 'a4b45', , 'c4e25', 'd4f25', , 'f1e25', 'f1e25', 'f1e25', 'a5b45', , 'c5f25', 'd5g25', 'e5e25', , 'g5g25',
-        'h5e25', 'a6e25', , 'c6g25', 'd6d25', 'e6e25', 'f6f25', , 'h6d25', 'a7f25', , 'f1e25', 'd7d25', 'e7e25', 'f7f25', 'g7g25', , 'a8g25', , 'f1e25',
-        'd8d25', 'e8e25', 'f1e25', 'g8g25', 'f1e16', , , , , , , , 'g1f17', , , , 'g1f15', 'g1f15', 'g1f15', 'g1f15', 'g1f16', 'a3a46', , 'c3d26', , 'e3e26',
-        'f3e26', 'g1f17', 'g1f17', 'a4b46', , 'c4e26', 'd4d26', , 'f4d26', 'g1f16', 'g1f16', 'a5b46', , 'c5b46', 'd5d26', 'e5e26', , 'g5d26', 'h5e26',
-        'a6e26', , 'c6a46', 'd6d26', 'e6e26', 'f6f87', , 'h6d26', 'a7a46', , 'g1f16', 'd7d26', 'e7e26', 'f7f87', 'g1f17', , 'a8a46', , 'c8f87', 'd8d26',
-        'e8e26', 'f8b46', 'g1f17', 'g1f17', , , , , , , , , , , , 'h1g16', 'h1g16', 'h1g26', 'g2f27', 'h1g17', 'h1g26', , 'c3d27', , 'e3f27', 'f3g27', 'g3g27',
-        'h3g27', 'h1g16', , 'c4e27', 'd4f27', , 'f4f27', 'g4g27', 'h1g17', 'a5b47', , 'c5f27', 'd5g27', 'e5e27', , 'g5g27', 'h5e27', 'a6e27', , 'c6g27',
-        'd6d27', 'e6e27', 'f6f27', , 'h6d27', 'a7f27', , 'c7e78', 'd7d27', 'e7e27', 'f7f27', 'g7g27', , 'a8g27', , 'c8e88', 'd8d27', 'e8e27', 'f8f27',
-        'g8g27', 'h1g18', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'd2c32', 'd2c32', 'd2c32',
-        'd2c32', 'a3b43', , 'c3e53', , 'd2c33', 'd2c33', 'd2c33', 'd2c33', 'd2c32', , 'c4b43', 'd2c33', , 'd2c33', 'd2c33', 'd2c33', 'd2c32', , 'c5e53',
-        'd2c33', 'd2d33', , 'd2c33', 'd2c33', 'd2c32', , 'c6b53', 'd2c33', 'd2c33', 'd2c33', , 'd2c33', 'd2c32', , 'c7e53', 'd2c33', 'd2c33', 'd2c33',
-        'd2c33', , 'd2c32', , 'c8b73', 'd2c33', 'd2c33', 'd2c33', 'd2c33', 'd2c33', , , , , , , , , , , , 'e2d13', , 'e2d13', 'e2d13', 'e2d33', 'a3b44', , 'c3d24',
-        ,
-        'e2d14', 'e2d14', 'e2d14', 'e2d14', 'a4b54', , 'c4b44', 'd4d24', , 'e2d14', 'e2d14', 'e2d14', 'a5b64', , 'c5b44', 'd5d24', 'e2d13', , 'e2d24',
-        'e2d24', 'a6b74', , 'c6b54', 'd6d24', 'e2d24', 'e2d14', , 'e2d24', 'a7b84', , 'c7b64', 'd7d24', 'e2d14', 'e2d24', 'e2d14', , 'a8b84', , 'c8b74',
-        'd8d24', 'e2d24', 'e2d14', 'e2d24', 'e2d14', , , , , , , , , , , , 'f2e24', 'f2e34', , 'f2e34', 'f2e34', 'f2e24', , 'c3d25', , 'e3e25', 'f3e25', 'f2e16',
-        'f2e16', 'f2e34', , 'c4e25', 'd4d25', , 'f2e25', 'f2e25', 'f2e25', 'a5b45', , 'c5b45', 'd5d25', 'e5e25', , 'g5d25', 'h5e25', 'a6e25', , 'f2e15',
-        'd6d25', 'e6e25', 'f2e16', , 'h6d25', 'a7b86', , 'f2e25', 'd7d25', 'e7e25', 'f2e16', 'f2e16', , 'a8b86', , 'f2e25', 'd8d25', 'e8e25', 'f2e25',
-        'f2e16', 'f2e16', , , , , , , , , , , , 'g2f15', 'g2f15', 'g2f15', , 'g2f35', 'a3a46', , 'c3d26', , 'e3f26', 'f3f26', 'g3f26', 'h3a36', 'a4b56', , 'c4e26',
-        'd4f26', , 'f4f26', 'g2f16', 'g2f16', 'a5b66', , 'c5f26', 'd5d26', 'e5e26', , 'g5d26', 'h5e26', 'a6b76', , 'c6b56', 'd6d26', 'e6e26', 'f6f26',
-        ,
-        'h6d26', 'a7b86', , 'c7b66', 'd7d26', 'e7e26', 'f7f26', 'g7b76', , 'a8b86', , 'c8b76', 'd8d26', 'e8e26', 'f8f26', 'g8b86', 'h8b86', , , , , ,
-        ,
-        , , , , , 'h2g16', 'h2g16', 'h2g26', 'h2g36', , 'h2g26', , 'c3d27', , 'e3f27', 'f3g27', 'g3g27', 'h3g27', 'h2g16', , 'c4e27', 'd4f27', , 'f4f27',
-        'g4g27', 'h2g17', 'a5b47', , 'c5f27', 'd5g27', 'e5e27', , 'g5g27', 'h5e27', 'a6e27', , 'c6g27', 'd6d27', 'e6e27', 'f6f27', , 'h6d27', 'a7f27',
-        ,
-        'c7e78', 'd7d27', 'e7e27', 'f7f27', 'g7g27', , 'a8g27', , 'c8e88', 'd8d27', 'e8e27', 'f8f27', 'g8g27', 'h2g18', , , , , , , , , , , , 'd2d11', 'e2d11',
-        'f2b21', 'g2b21', 'h2b21', , , 'c3b21', , 'a3b32', 'f3d11', 'a3b32', 'h3c82', 'a4d11', , 'a3b32', 'd4d11', , 'a3b32', 'g4d11', 'a3b32', 'a3b32',
-        ,
-        'a3b32', 'd5d11', 'e5b21', , 'a3b32', 'h5d11', 'a6c82', , 'a3b32', 'd6d11', 'a3b32', 'f6b21', , 'a3b32', 'a7c72', , 'a3b32', 'd7d11', 'a3b32',
-        'f7c42', 'g7b21', , 'a8c82', , 'a3b32', 'd8d11', 'a3b32', 'f8c52', 'g8c42', 'h8b21', , , , , , , , , , , , 'd2e11', 'e2f11', 'f2g11', 'g2h11', 'h2h11',
-        'a3b21', , 'c3e11', , 'e3g11', 'f3h11', 'g3g11', 'h3h11', 'a4a52', 'b4e11', 'c4f11', 'd4g11', , 'f4f11', 'g4g11', 'h4h11', 'a5e11', 'b5f11',
-        'c5g11', 'd5h11', 'e5e11', , 'g5g11', 'h5h11', 'a6f11', 'b6g11', 'c6h11', 'd6d11', 'e6e11', 'f6f11', , 'h6h11', 'a7g11', 'b7h11', 'b3a32',
-        'd7d11', 'e7e11', 'f7f11', 'g7g11', , 'a8h11', 'b8c82', 'b3a32', 'd8d11', 'e8e11', 'f8f11', 'g8g11', 'h8h11', , , , , , , , , , , , 'd2b21', 'e2b21',
-        'f2b21', 'g2b21', 'h2b21', 'a3b21', , , , 'c3b32', 'f3g22', 'c3b32', 'h3h22', 'a4a52', , 'c3b32', 'd4f22', , 'c3b32', 'g4g22', 'c3b32', 'a5a62',
-        ,
-        'c3b32', 'd5g22', 'c3b32', , 'c3b32', 'h5h22', 'a6a72', , 'c3b32', 'd6h22', 'c3b32', 'f6f22', , 'c3b32', 'a7a82', , 'c3b32', 'd7d22', 'c3b32',
-        'f7f22', 'g7g22', , 'a8b72', , 'c3b32', 'd8d22', 'c3b32', 'f8f22', 'g8g22', 'h8h22', , , , , , , , , , , , 'd3c32', 'd3c32', 'd3c32', 'd3c32', 'd3c32',
-        'a3b43', , 'c3e53', , 'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c32', , 'c4b43', 'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c32', , 'c5e53',
-        'd3c33', 'd3d23', 'd3c33', 'd3c33', 'd3c33', 'd3c32', , 'c6g23', 'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c32', , 'c7e53', 'd3c33',
-        'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c32', , 'c8b73', 'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c33', , , , , , , , , , , , 'e3d33', 'e3d33', 'e3d33',
-        'e3d33', 'e3d33', 'a3a44', , 'c3d24', , , 'e3d24', 'e3d24', 'e3d24', 'a4b54', , 'c4e24', 'd4d24', , 'e3d24', 'e3d24', 'e3d24', 'a5b64', , 'c5b44',
-        'd5g24', 'e3d23', , 'e3d24', 'e3d24', 'a6b74', , 'c6g24', 'd6h24', 'e3d24', 'e3d24', , 'e3d24', 'a7b84', , 'c7h24', 'd7d24', 'e3d24', 'e3d24',
-        'e3d24', , 'a8b84', , 'c8b74', 'd8d24', 'e3d24', 'e3d24', 'e3d24', 'e3d24', , , , , , , , , , , , 'f3e24', 'f3e34', 'f3e34', 'f3e34', 'f3e34', 'f3e24',
-        ,
-        'c3d25', , 'e3f25', , 'g3h25', 'h3h25', 'f3e34', , 'c4e25', 'd4f25', , 'f3e25', 'f3e25', 'f3e25', 'a5b45', , 'c5f25', 'd5d25', 'e5h25', , 'g5g25',
-        'h5h25', 'a6e25', , 'f3e25', 'd6h25', 'e6e25', 'f3e26', , 'h6h25', 'a7f25', , 'c7h25', 'd7d25', 'e7e25', 'f3e26', 'g7g25', , 'a8b86', , 'f3e25',
-        'd8d25', 'e8e25', 'f3e25', 'g8g25', 'h8h25', , , , , , , , , , , , 'g3f25', 'g3f25', 'g3f35', 'g3f35', 'g3f35', 'a3a46', , 'c3d26', , 'e3f26', 'f3g26',
-        ,
-        'h3h26', 'a4b56', , 'c4e26', 'd4f26', , 'f4f26', 'g3f26', 'g3f26', 'a5b66', , 'c5f26', 'd5g26', 'e5e26', , 'g5d26', 'h5h26', 'a6b76', , 'c6g26',
-        'd6d26', 'e6e26', 'f6f26', , 'h6h26', 'a7b86', , 'c7b66', 'd7d26', 'e7e26', 'f7f26', 'g7b76', , 'a8b86', , 'c8b76', 'd8d26', 'e8e26', 'f8f26',
-        'g8b86', 'h8h26', , , , , , , , , , , , 'h3g26', 'h3g26', 'h3g26', 'h3g36', 'h3g36', 'h3g26', , 'c3d27', , 'e3f27', 'f3g27', 'g3h27', , 'h3g26', , 'c4e27',
-        'd4f27', , 'f4h27', 'g4g27', 'h3g27', 'a5b47', , 'c5f27', 'd5g27', 'e5h27', , 'g5g27', 'h5e27', 'a6e27', , 'c6g27', 'd6h27', 'e6e27', 'f6f27',
-        ,
-        'h6d27', 'a7f27', , 'c7h27', 'd7d27', 'e7e27', 'f7f27', 'g7g27', , 'a8g27', , 'c8e88', 'd8d27', 'e8e27', 'f8f27', 'g8g27', 'h3g28', , , , , ,
-        ,
-        , , , , , 'a4b32', 'a4b32', 'a4b32', 'a4b32', 'a4b32', 'a3c54', , 'c3d23', , 'a4b32', 'a4b33', 'a4b32', 'a4b33', , , 'a4b32', 'a4b33', , 'a4b32',
-        'a4b33', 'a4b32', 'a4b32', , 'a4b32', 'a4b33', 'a4b32', , 'a4b32', 'a4b33', 'a4b33', , 'a4b32', 'a4b33', 'a4b32', 'a4b33', , 'a4b32', 'a4b33',
-        ,
-        'a4b32', 'a4b33', 'a4b32', 'a4b33', 'a4b33', , 'a4b33', , 'a4b32', 'a4b33', 'a4b32', 'a4b33', 'a4b33', 'a4b33', , , , , , , , , , , , 'b4c32', 'b4c32',
-        'b4c32', 'b4c32', 'b4c32', 'a3a44', , 'c3d23', , 'b4b32', 'b4c33', 'b4b32', 'b4c33', 'b4c32', , 'b4b32', 'b4c33', , 'b4b32', 'b4c33', 'b4b32',
-        'b4c32', 'b4c32', 'b4b32', 'b4c33', 'b4b32', , 'b4b32', 'b4c33', 'b4c32', 'b4c32', 'b4b32', 'b4c33', 'b4b32', 'b4c33', , 'b4b32', 'b4c32',
-        'b4c32', 'b4b32', 'b4c33', 'b4b32', 'b4c33', 'b4c33', , 'b4c32', 'b4c33', 'b4b32', 'b4c33', 'b4b32', 'b4c33', 'b4c33', 'b4c33', , , , , , , , ,
-        ,
-        , , 'c4c32', 'c4c32', 'c4c32', 'c4c32', 'c4c32', 'a3a44', , 'c3d23', , 'c4b32', 'c4c33', 'c4b32', 'c4c33', 'c4c32', , , 'c4c33', , 'c4b32', 'c4c33',
-        'c4b32', 'c4c32', , 'c4b32', 'c4c33', 'c4b32', , 'c4b32', 'c4c33', 'c4c32', , 'c4b32', 'c4c33', 'c4b32', 'c4c33', , 'c4b32', 'c4c32', , 'c4b32',
-        'c4c33', 'c4b32', 'c4c33', 'c4c33', , 'c4c32', , 'c4b32', 'c4c33', 'c4b32', 'c4c33', 'c4c33', 'c4c33', , , , , , , , , , , , 'd4c32', 'd4c32', 'd4c32',
-        'd4c32', 'd4c32', 'a3a44', , 'c3d23', , 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c32', , 'c4e23', , , 'd4c33', 'd4c33', 'd4c33', 'd4c32', , 'd4c33',
-        'd4c33', 'd4d33', , 'd4c33', 'd4c33', 'd4c32', , 'c6g23', 'd4c33', 'd4c33', 'd4c33', , 'd4c33', 'd4c32', , 'c7h23', 'd4c33', 'd4c33', 'd4c33',
-        'd4c33', , 'd4c32', , 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c33', , , , , , , , , , , , 'e4d33', 'e4d33', 'e4d33', 'e4d33', 'e4d33', 'a3a44',
-        ,
-        'c3d24', , 'e3f24', 'e4d34', 'e4d34', 'h3h24', 'a4b44', , 'c4e24', 'd4f24', , 'e4d34', 'e4d34', 'e4d34', 'a5b44', , 'c5f24', 'd5d24', 'e4d33',
-        'e4d34', 'e4d34', 'e4d34', 'a6e24', , 'c6a44', 'd6h24', 'e4d34', 'e4d34', 'e4d34', 'e4d34', 'a7f24', , 'c7h24', 'd7d24', 'e4d34', 'e4d34',
-        'e4d34', 'e4d34', 'a8a44', , 'e4d34', 'd8d24', 'e4d34', 'e4d34', 'e4d34', 'e4d34', , , , , , , , , , , , 'f4e34', 'f4e34', 'f4e34', 'f4e34', 'f4e34',
-        'f4e34', , 'c3d25', , 'e3f25', 'f3g25', 'g3h25', 'h3h25', 'f4e34', , 'c4e25', 'd4f25', , , 'f4e35', 'f4e35', 'a5b45', , 'c5f25', 'd5g25', 'e5e25',
-        ,
-        'g5g25', 'h5h25', 'a6e25', , 'c6g25', 'd6d25', 'e6e25', 'f4e36', , 'h6h25', 'a7f25', , 'f4e35', 'd7d25', 'e7e25', 'f4e36', 'g7g25', , 'a8g25',
-        ,
-        'f4e35', 'd8d25', 'e8e25', 'f4e35', 'g8g25', 'h8h25', , , , , , , , , , , , 'g4f35', 'g4f35', 'g4f35', 'g4f35', 'g4f35', 'a3a46', , 'c3d26', , 'e3f26',
-        'f3g26', 'g3h26', 'h3h26', 'a4b56', , 'c4e26', 'd4f26', , 'f4h26', , 'g4f36', 'a5b66', , 'c5f26', 'd5g26', 'e5h26', , 'g5d26', 'h5h26', 'a6b76',
-        ,
-        'c6g26', 'd6h26', 'e6e26', 'f6f26', , 'h6h26', 'a7b86', , 'c7h26', 'd7d26', 'e7e26', 'f7f26', 'g7b76', , 'a8b86', , 'c8b76', 'd8d26', 'e8e26',
-        'f8f26', 'g8b86', 'h8h26', , , , , , , , , , , , 'h4g36', 'h4g36', 'h4g36', 'h4g36', 'h4g36', 'h4g36', , 'c3d27', , 'e3f27', 'f3g27', 'g3h27', 'h3h27',
-        'h4g36', , 'c4e27', 'd4f27', , 'f4h27', 'g4g27', , 'a5b47', , 'c5f27', 'd5g27', 'e5h27', , 'g5g27', 'h5e27', 'a6e27', , 'c6g27', 'd6h27', 'e6e27',
-        'f6f27', , 'h6d27', 'a7f27', , 'c7h27', 'd7d27', 'e7e27', 'f7f27', 'g7g27', , 'a8g27', , 'c8e88', 'd8d27', 'e8e27', 'f8f27', 'g8g27', 'h4g38',
-        ,
-        , , , , , , , , , , 'a5b43', 'a5b43', 'a5b43', 'a5b43', 'a5b43', 'a3c55', , 'a5b44', , 'a5b44', 'a5b44', 'g3f24', 'a5b45', 'a5b44', , 'a5b44', 'a5b44',
-        ,
-        'f4f24', 'a5b44', 'h4f24', , , 'a5b44', 'd5d24', 'a5b44', , 'g5d24', 'a5b44', 'a5b44', , 'a5b44', 'd6d24', 'a5b44', 'f6f24', , 'h6d24', 'a7f24',
-        ,
-        'a5b44', 'd7d24', 'a5b44', 'f7f24', 'a5b45', , 'a5b45', , 'a5b44', 'd8d24', 'a5b44', 'f8f24', 'a5b45', 'a5b45', , , , , , , , , , , , 'b5c43', 'b5c43',
-        'b5c43', 'b5c43', 'b5c43', 'b5c44', , 'b5c44', , 'b5c44', 'b5c44', 'b5c44', 'b5c44', 'b5c44', , 'b5b44', 'b5c44', , 'b5c44', 'b5c44', 'b5c44',
-        'a5d24', , 'b5c44', 'b5c44', 'b5c44', , 'b5c44', 'b5c44', 'b5b44', 'b5c44', 'b5c44', 'b5c44', 'b5c44', 'b5c44', , 'b5c44', 'a7f24', 'b5c44',
-        'b5c44', 'd7d24', 'b5c44', 'b5c44', 'b5c44', , 'a8g24', 'b5c44', 'b5b44', 'd8d24', 'b5c44', 'b5c44', 'b5c44', 'b5c44', , , , , , , , , , , , 'c5d43',
-        'c5d43', 'c5d43', 'c5d43', 'c5d43', 'c5d44', , 'c3d24', , 'c5c44', 'c5c44', 'c5c44', 'c5c44', 'c5d44', , 'c4e24', 'c5c44', , 'c5c44', 'c5c44',
-        'c5c44', 'a5d24', , , 'c5c44', 'c5c44', , 'c5c44', 'c5c44', 'a6e24', , 'c5c44', 'c5c44', 'c5c44', 'c5c44', , 'c5c44', 'c5c44', , 'c5c44', 'd7d24',
-        'c5c44', 'c5c44', 'c5c44', , 'a8g24', , 'c5b44', 'd8d24', 'c5c44', 'c5c44', 'c5c44', 'c5c44', , , , , , , , , , , , 'd5d43', 'd5d43', 'd5d43', 'd5d43',
-        'd5d43', 'd5d44', , 'c3d24', , 'd5c44', 'd5c44', 'd5c44', 'd5c44', 'd5e44', , 'c4e24', 'd4f24', , 'd5c44', 'd5c44', 'd5c44', 'a5d24', , 'c5f24',
-        ,
-        'd5c44', , 'd5c44', 'd5c44', 'a6e24', , 'd5c44', 'd5c44', 'd5c44', 'd5c44', , 'd5c44', 'a7f24', , 'c7h24', 'd5d45', 'd5c44', 'd5c44', 'd5c44',
-        ,
-        'd5c44', , 'c8f85', 'd5d45', 'd5c44', 'd5c44', 'd5c44', 'd5c44', , , , , , , , , , , , 'e5d43', 'e5d43', 'e5d43', 'e5d43', 'e5d43', 'e5d44', , 'c3d24',
-        ,
-        'e3f24', 'f3g24', 'g3h24', 'h3h24', 'e5e44', , 'c4e24', 'd4f24', , 'f4h24', 'g4g24', 'h4h24', 'a5d24', , 'c5f24', 'd5g24', , , 'g5g24', 'h5h24',
-        'a6e24', , 'c6g24', 'd6d24', 'e5d45', 'f6f24', , 'h6h24', 'a7f24', , 'c7h75', 'd7d24', 'e5e45', 'f7f24', 'g7g24', , 'a8g24', , 'c8c45', 'd8d24',
-        'e5d45', 'f8f24', 'g8g24', 'h8h24', , , , , , , , , , , , 'f5e44', 'f5e44', 'f5e44', 'f5e44', 'f5e44', 'a3b45', , 'c3d25', , 'e3f25', 'f3g25', 'g3h25',
-        'h3h25', 'f5e44', , 'c4e25', 'd4f25', , 'f4h25', 'g4g25', 'h4h25', 'a5b45', , 'c5f25', 'd5g25', 'e5h25', , 'g5g25', 'h5h25', 'a6e25', , 'c6g25',
-        'd6h25', 'e6e25', 'f5e46', 'f5e55', 'h6h25', 'a7f25', , 'c7h25', 'd7d25', 'e7e25', 'f5e46', 'g7g25', 'f5e55', 'a8g25', , 'f5e45', 'd8d25',
-        'e8e25', 'f5e45', 'g8g25', 'h8h25', , , , , , , , , , , , 'g5f45', 'g5f45', 'g5f45', 'g5f45', 'g5f45', 'a3a46', , 'c3d26', , 'e3f26', 'f3g26', 'g3h26',
-        'h3h26', 'a4b46', , 'c4e26', 'd4f26', , 'f4h26', 'g4g26', 'h4h26', 'a5b46', , 'c5f26', 'd5g26', 'e5h26', , , 'h5h26', 'a6e26', , 'c6g26', 'd6h26',
-        'e6e26', 'f6f26', , 'h6h26', 'a7f26', , 'c7h26', 'd7d26', 'e7e26', 'f7f26', 'g5f47', , 'a8g26', , 'c8f87', 'd8d26', 'e8e26', 'f8f26', 'g5f47',
-        'h8h26', , , , , , , , , , , , 'h5g46', 'h5g46', 'h5g46', 'h5g46', 'h5g46', 'h5g46', , 'c3d27', , 'e3f27', 'f3g27', 'g3h27', 'h3h27', 'h5g46', , 'c4e27',
-        'd4f27', , 'f4h27', 'g4g27', 'h4h27', 'a5b47', , 'c5f27', 'd5g27', 'e5h27', , 'g5g27', , 'a6e27', , 'c6g27', 'd6h27', 'e6e27', 'f6f27', , 'h6d27',
-        'a7f27', , 'c7h27', 'd7d27', 'e7e27', 'f7f27', 'g7g27', , 'a8g27', , 'c8e88', 'd8d27', 'e8e27', 'f8f27', 'g8g27', 'h5g48', , , , , , , , , , , , 'a6b54',
-        'a6b54', 'a6b54', 'a6b54', 'a6b54', 'a3d66', , 'a6b55', , 'a6b55', 'a6b55', 'a6b55', 'h3g25', 'a4c46', , 'a6b55', 'a6b55', , 'a6b55', 'g4g25',
-        'a6b55', 'a5d25', , 'a6b55', 'a6b55', 'e5e25', , 'a6b55', 'h5e25', , , 'a6b55', 'a6b55', 'e6e25', 'a6b55', , 'a6b55', 'a6b55', , 'a6b55', 'd7d25',
-        'e7e25', 'a6b55', 'g7g25', , 'a8g25', , 'a6b55', 'd8d25', 'e8e25', 'a6b55', 'g8g25', 'a6b56', , , , , , , , , , , , 'b6c54', 'b6c54', 'b6c54', 'b6c54',
-        'b6c54', 'a3d66', , 'b6c55', , 'b6c55', 'b6c55', 'b6c55', 'h3h25', 'b6c55', , 'b6c55', 'b6c55', , 'b6c55', 'g4g25', 'b6c55', 'a5d25', , 'b6b55',
-        'b6c55', 'e5h25', , 'b6c55', 'h5h25', 'a6e25', , 'b6b55', 'b6c55', 'e6e25', 'b6c55', , 'b6c55', 'b6c55', 'b6c55', 'b6b55', 'd7d25', 'e7e25',
-        'b6c55', 'g7g25', , 'a8g25', 'b6c55', 'b6b55', 'd8d25', 'e8e25', 'b6c55', 'g8g25', 'h8h25', , , , , , , , , , , , 'c6d54', 'c6d54', 'c6d54', 'c6d54',
-        'c6d54', 'a3a46', , 'c3d25', , 'c6d55', 'c6d55', 'c6d55', 'h3h25', 'c6d55', , 'c4e25', 'c6d55', , 'c6d55', 'g4g25', 'c6d55', 'a5d25', , 'c5f25',
-        'c6c55', 'e5h25', , 'c6d55', 'h5h25', 'a6e25', , , 'c6d55', 'e6e25', 'c6d55', , 'c6d55', 'a7f25', , 'c6d55', 'd7d25', 'e7e25', 'c6d55', 'g7g25',
-        ,
-        'a8a46', , 'c6b55', 'd8d25', 'e8e25', 'c6d55', 'g8g25', 'h8h25', , , , , , , , , , , , 'd6e54', 'd6e54', 'd6e54', 'd6e54', 'd6e54', 'a3a46', , 'c3d25',
-        ,
-        'd6d55', 'd6d55', 'd6d55', 'h3h25', 'd6e55', , 'c4e25', 'd4f25', , 'd6d55', 'g4g25', 'd6d55', 'a5d25', , 'c5f25', 'd5g25', 'e5h25', , 'd6d55',
-        'h5h25', 'a6e25', , 'c6g25', , 'e6e25', 'd6d55', , 'd6d55', 'a7f25', , 'd6d55', 'd6d56', 'e7e25', 'd6d55', 'g7g25', , 'a8g25', , 'c8c46', 'd6e56',
-        'e8e25', 'd6d55', 'g8g25', 'h8h25', , , , , , , , , , , , 'e6e54', 'e6e54', 'e6e54', 'e6e54', 'e6e54', 'a3b36', , 'c3d25', , 'e3f25', 'e6d55', 'e6d55',
-        'h3h25', 'e6e55', , 'c4e25', 'd4f25', , 'e6d55', 'g4g25', 'e6d55', 'a5d25', , 'c5f25', 'd5g25', 'e5h25', , 'e6d55', 'h5h25', 'a6e25', , 'c6g25',
-        'd6h25', , 'e6d55', , 'e6d55', 'a7f25', , 'c7h25', 'd7d25', 'e6e56', 'e6d55', 'g7g25', , 'a8g25', , 'c8c46', 'd8d25', 'e6e56', 'e6d55', 'g8g25',
-        'h8h25', , , , , , , , , , , , 'f6e54', 'f6e54', 'f6e54', 'f6e54', 'f6e54', 'a3b36', , 'c3d25', , 'e3f25', 'f3g25', 'g3h25', 'h3h25', 'f6e55', , 'c4e25',
-        'd4f25', , 'f4h25', 'g4g25', 'h4h25', 'a5d25', , 'c5f25', 'd5g25', 'e5h25', , 'g5g25', 'h5h25', 'a6e25', , 'c6g25', 'd6h25', 'e6e25', , , 'h6h25',
-        'a7f25', , 'c7h25', 'd7d25', 'e7e25', 'f6e56', 'g7g25', , 'a8g25', , 'c8c46', 'd8d25', 'e8e25', 'f6e56', 'g8g25', 'h8h25', , , , , , , , , , , , 'g6f55',
-        'g6f55', 'g6f55', 'g6f55', 'g6f55', 'g6f56', , 'c3d26', , 'e3f26', 'f3g26', 'g3h26', 'h3h26', 'g6g56', , 'c4e26', 'd4f26', , 'f4h26', 'g4g26',
-        'h4h26', 'a5d26', , 'c5f26', 'd5g26', 'e5h26', , 'g5g26', 'h5h26', 'a6e26', , 'c6g26', 'd6h26', 'e6e26', 'f6f26', , 'h6h26', 'a7f26', , 'c7h26',
-        'd7d26', 'e7e26', 'f7f26', 'g6f57', 'h7h26', 'a8g26', , 'c8c67', 'd8d26', 'e8e26', 'f8f26', 'g6f57', 'h8h26', , , , , , , , , , , , 'h6g56', 'h6g56',
-        'h6g56', 'h6g56', 'h6g56', 'a3b47', , 'c3d27', , 'e3f27', 'f3g27', 'g3h27', 'h3h27', 'h6g56', , 'c4e27', 'd4f27', , 'f4h27', 'g4g27', 'h4h27',
-        'a5b47', , 'c5f27', 'd5g27', 'e5h27', , 'g5g27', 'h5h27', 'a6e27', , 'c6g27', 'd6h27', 'e6e27', 'f6f27', , , 'a7f27', , 'c7h27', 'd7d27', 'e7e27',
-        'f7f27', 'g7g27', , 'a8g27', , 'c8f88', 'd8d27', 'e8e27', 'f8f27', 'g8g27', 'h6g58', , , , , , , , , , , , 'a7b65', 'a7b65', 'a7b65', 'a7b65', 'a7b65',
-        'a3c57', , 'a7b66', , 'a7b66', 'a7b66', 'g3h26', 'h3h26', 'a4c67', , 'a7b66', 'a7b66', , 'f4h26', 'g4g26', 'h4h26', 'a5d26', , 'c5f26', 'a7b66',
-        'e5h26', , 'g5g26', 'h5h26', 'a6e26', , 'c6g26', 'a7b66', 'e6e26', 'f6f26', , 'h6h26', , , 'c7h26', 'd7d26', 'e7e26', 'f7f26', 'g7g26', , 'a8g26',
-        ,
-        'a7b67', 'd8d26', 'e8e26', 'f8f26', 'g8g26', 'h8h26', , , , , , , , , , , , 'b7c65', 'b7c65', 'b7c65', 'b7c65', 'b7c65', 'a3c57', , 'b7c66', , 'b7c66',
-        'b7c66', 'g3h26', 'h3h26', 'b7c66', , 'b7c66', 'b7c66', , 'f4h26', 'g4g26', 'h4h26', 'a5d26', , 'c5f26', 'b7c66', 'e5h26', , 'g5g26', 'h5h26',
-        'a6e26', , 'c6g26', 'b7c66', 'e6e26', 'f6f26', , 'h6h26', 'a7f26', , 'c7h26', 'd7d26', 'e7e26', 'f7f26', 'g7g26', , 'b7c67', 'b8h26', 'b7c67',
-        'd8d26', 'e8e26', 'f8f26', 'g8g26', 'h8h26', , , , , , , , , , , , 'c7d65', 'c7d65', 'c7d65', 'c7d65', 'c7d65', 'a3c57', , 'c3d26', , 'c7d66', 'c7d66',
-        'g3h26', 'h3h26', 'c7d66', , 'c4e26', 'c7d66', , 'f4h26', 'g4g26', 'h4h26', 'a5d26', , 'c5f26', 'c7d66', 'e5h26', , 'g5g26', 'h5h26', 'a6e26',
-        ,
-        'c6g26', 'c7c66', 'e6e26', 'f6f26', , 'h6h26', 'a7f26', , , 'd7d26', 'e7e26', 'f7f26', 'g7g26', , 'a8g26', , 'c7d67', 'd8d26', 'e8e26', 'f8f26',
-        'g8g26', 'h8h26', , , , , , , , , , , , 'd7e65', 'd7e65', 'd7e65', 'd7e65', 'd7e65', 'a3c57', , 'c3d26', , 'd7e66', 'd7e66', 'g3h26', 'h3h26', 'd7d66',
-        ,
-        'c4e26', 'd4f26', , 'f4h26', 'g4g26', 'h4h26', 'a5d26', , 'c5f26', 'd5g26', 'e5h26', , 'g5g26', 'h5h26', 'a6e26', , 'c6g26', 'd6h26', 'e6e26',
-        'f6f26', , 'h6h26', 'a7f26', , 'c7h26', , 'e7e26', 'f7f26', 'g7g26', , 'a8g26', , 'c8c77', 'd7e67', 'e8e26', 'f8f26', 'g8g26', 'h8h26', , , , ,
-        ,
-        , , , , , , 'e7f65', 'e7f65', 'e7f65', 'e7f65', 'e7f65', 'a3c57', , 'c3d26', , 'e3f26', 'e7e66', 'g3h26', 'h3h26', 'e7d66', , 'c4e26', 'd4f26',
-        ,
-        'f4h26', 'g4g26', 'h4h26', 'a5d26', , 'c5f26', 'd5g26', 'e5h26', , 'g5g26', 'h5h26', 'a6e26', , 'c6g26', 'd6h26', 'e6e26', 'f6f26', , 'h6h26',
-        'a7f26', , 'c7h26', 'd7d26', , 'f7f26', 'g7g26', , 'a8g26', , 'c8c77', 'd8d26', 'e7e67', 'f8f26', 'g8g26', 'h8h26', , , , , , , , , , , , 'f7f65', 'f7f65',
-        'f7f65', 'f7f65', 'f7f65', 'a3c57', , 'c3d26', , 'e3f26', 'f3g26', 'g3h26', 'h3h26', 'a4c67', , 'c4e26', 'd4f26', , 'f4h26', 'g4g26', 'h4h26',
-        'a5d26', , 'c5f26', 'd5g26', 'e5h26', , 'g5g26', 'h5h26', 'a6e26', , 'c6g26', 'd6h26', 'e6e26', 'f6f26', , 'h6h26', 'a7f26', , 'c7h26', 'd7d26',
-        'e7e26', , 'g7g26', , 'a8g26', , 'c8c77', 'd8d26', 'e8e26', 'f7e67', 'g8g26', 'h8h26', , , , , , , , , , , , 'g7f65', 'g7f65', 'g7f65', 'g7f65', 'g7f65',
-        'a3b37', , 'c3d26', , 'e3f26', 'f3g26', 'g3h26', 'h3h26', 'a4c47', , 'c4e26', 'd4f26', , 'f4h26', 'g4g26', 'h4h26', 'a5d26', , 'c5f26', 'd5g26',
-        'e5h26', , 'g5g26', 'h5h26', 'a6e26', , 'c6g26', 'd6h26', 'e6e26', 'f6f26', , 'h6h26', 'a7f26', , 'c7h26', 'd7d26', 'e7e26', 'f7f26', , , 'a8g26',
-        ,
-        'c8c47', 'd8d26', 'e8e26', 'f8f26', 'g8c47', 'h8h26', , , , , , , , , , , , 'h7g66', 'h7g66', 'h7g66', 'h7g66', 'h7g66', 'h7g67', , 'c3d27', , 'e3f27',
-        'f3g27', 'g3h27', 'h3h27', 'h7g67', , 'c4e27', 'd4f27', , 'f4h27', 'g4g27', 'h4h27', 'a5d27', , 'c5f27', 'd5g27', 'e5h27', , 'g5g27', 'h5h27',
-        'a6e27', , 'c6g27', 'd6h27', 'e6e27', 'f6f27', , 'h6h27', 'a7f27', , 'c7h27', 'd7d27', 'e7e27', 'f7f27', 'g7g27', , 'a8g27', , 'c8c78', 'd8d27',
-        'e8e27', 'f8f27', 'g8g27', 'h7g68', , , , , , , , , , , , 'a8b76', 'a8b76', 'a8b76', 'a8b76', 'a8b76', 'a3a48', , 'a8b77', , 'a8b77', 'a8b77', 'g3h27',
-        'h3h27', 'a4c48', , 'a8b77', 'a8b77', , 'f4h27', 'g4g27', 'h4h27', 'a5d27', , 'a8b77', 'a8b77', 'e5h27', , 'g5g27', 'h5h27', 'a6e27', , 'a8b77',
-        'a8b77', 'e6e27', 'f6f27', , 'h6h27', 'a7f27', , 'c7h27', 'd7d27', 'e7e27', 'f7f27', 'g7g27', , , , 'a8b78', 'd8d27', 'e8e27', 'f8f27', 'g8g27',
-        'h8h27', , , , , , , , , , , , 'b8c76', 'b8c76', 'b8c76', 'b8c76', 'b8c76', 'a3a48', , 'b8c77', , 'b8c77', 'b8c77', 'g3h27', 'h3h27', 'a4c48', , 'b8c77',
-        'b8c77', , 'f4h27', 'g4g27', 'h4h27', 'a5d27', , 'b8c77', 'b8c77', 'e5h27', , 'g5g27', 'h5h27', 'a6e27', , 'b8c77', 'b8c77', 'e6e27', 'f6f27',
-        ,
-        'h6h27', 'a7f27', , 'c7h27', 'd7d27', 'e7e27', 'f7f27', 'g7g27', , 'a8g27', , 'b8b78', 'd8d27', 'e8e27', 'f8f27', 'g8g27', 'h8h27', , , , , ,
-        ,
-        , , , , , 'c8d76', 'c8d76', 'c8d76', 'c8d76', 'c8d76', 'a3a48', , 'c3d27', , 'c8d77', 'c8d77', 'g3h27', 'h3h27', 'a4c48', , 'c4e27', 'c8d77',
-        ,
-        'f4h27', 'g4g27', 'h4h27', 'a5d27', , 'c5f27', 'c8d77', 'e5h27', , 'g5g27', 'h5h27', 'a6e27', , 'c6g27', 'c8d77', 'e6e27', 'f6f27', , 'h6h27',
-        'a7f27', , 'c7h27', 'd7d27', 'e7e27', 'f7f27', 'g7g27', , 'a8g27', , , 'd8d27', 'e8e27', 'f8f27', 'g8g27', 'h8h27', , , , , , , , , , , , 'd8e76', 'd8e76',
-        'd8e76', 'd8e76', 'd8e76', 'a3a48', , 'c3d27', , 'd8e77', 'd8e77', 'g3h27', 'h3h27', 'a4c48', , 'c4e27', 'd4f27', , 'f4h27', 'g4g27', 'h4h27',
-        'a5d27', , 'c5f27', 'd5g27', 'e5h27', , 'g5g27', 'h5h27', 'a6e27', , 'c6g27', 'd6h27', 'e6e27', 'f6f27', , 'h6h27', 'a7f27', , 'c7h27', 'd7d27',
-        'e7e27', 'f7f27', 'g7g27', , 'a8g27', , 'c8c48', , 'e8e27', 'f8f27', 'g8g27', 'h8h27', , , , , , , , , , , , 'e8f76', 'e8f76', 'e8f76', 'e8f76', 'e8f76',
-        'a3a48', , 'c3d27', , 'e3f27', 'e8f77', 'g3h27', 'h3h27', 'a4c48', , 'c4e27', 'd4f27', , 'f4h27', 'g4g27', 'h4h27', 'a5d27', , 'c5f27', 'd5g27',
-        'e5h27', , 'g5g27', 'h5h27', 'a6e27', , 'c6g27', 'd6h27', 'e6e27', 'f6f27', , 'h6h27', 'a7f27', , 'c7h27', 'd7d27', 'e7e27', 'f7f27', 'g7g27',
-        ,
-        'a8g27', , 'c8c48', 'd8d27', , 'f8f27', 'g8g27', 'h8h27', , , , , , , , , , , , 'f8g76', 'f8g76', 'f8g76', 'f8g76', 'f8g76', 'a3b38', , 'c3d27', , 'e3f27',
-        'f3g27', 'g3h27', 'h3h27', 'a4c48', , 'c4e27', 'd4f27', , 'f4h27', 'g4g27', 'h4h27', 'a5d27', , 'c5f27', 'd5g27', 'e5h27', , 'g5g27', 'h5h27',
-        'a6e27', , 'c6g27', 'd6h27', 'e6e27', 'f6f27', , 'h6h27', 'a7f27', , 'c7h27', 'd7d27', 'e7e27', 'f7f27', 'g7g27', , 'a8g27', , 'c8c48', 'd8d27',
-        'e8e27', , 'g8g27', 'h8h27', , , , , , , , , , , , 'g8g76', 'g8g76', 'g8g76', 'g8g76', 'g8g76', 'a3b38', , 'c3d27', , 'e3f27', 'f3g27', 'g3h27', 'h3h27',
-        'a4c48', , 'c4e27', 'd4f27', , 'f4h27', 'g4g27', 'h4h27', 'a5d27', , 'c5f27', 'd5g27', 'e5h27', , 'g5g27', 'h5h27', 'a6e27', , 'c6g27', 'd6h27',
-        'e6e27', 'f6f27', , 'h6h27', 'a7f27', , 'c7h27', 'd7d27', 'e7e27', 'f7f27', 'g7g27', , 'a8g27', , 'c8c48', 'd8d27', 'e8e27', 'f8f27', , 'h8h27',
-        ,
-        , , , , , , , , , , 'h8g76', 'h8g76', 'h8g76', 'h8g76', 'h8g76', 'a3b38', , 'c3d27', , 'e3f27', 'f3g27', 'g3h27', 'h3h27', 'a4c48', , 'c4e27', 'd4f27',
-        ,
-        'f4h27', 'g4g27', 'h4h27', 'a5d27', , 'c5f27', 'd5g27', 'e5h27', , 'g5g27', 'h5h27', 'a6e27', , 'c6g27', 'd6h27', 'e6e27', 'f6f27', , 'h6h27',
-        'a7f27', , 'c7h27', 'd7d27', 'e7e27', 'f7f27', 'g7g27', , 'a8g27', , 'c8c48', 'd8d27', 'e8e27', 'f8f27', 'g8g27', , , , , , , , , , 'a2g24', , , , 'e2g24',
-        'a1a23', 'a1a24', 'h2g24', , 'b3b25', , 'd3d44', , 'f3g24', 'g3g24', 'h3g24', 'a4d44', 'b4d44', , 'a1a24', 'e4g24', , 'g4g24', 'h4d44', 'a5a25',
-        'b5b25', , 'a1a24', 'e5d44', 'f5f25', , 'h5h25', 'a6a25', 'b6d44', , 'a1a24', 'e6e45', 'f6d44', 'g6g24', , 'a7d44', 'b7g24', , 'a1a24', 'e7e45',
-        'f7f25', 'g7g24', 'h7h25', 'a8g24', 'b8h25', , 'a1a24', 'e8e45', 'f8f25', 'g8g24', 'h8d44', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'f1f24', 'g1g24', 'h1g24', 'a2d24', , , , 'e2f24', 'f2g24', 'g2f24', 'h2g24', , 'b3b44', , 'd3e24',
-        ,
-        'f3g24', 'g3g24', 'h3g24', 'a4b44', 'b4d24', , 'd4f24', 'e4g24', , 'g4g24', 'h4f24', 'a5b44', 'b5d34', , 'd5g24', 'e5e24', 'f5f24', , 'h5e24',
-        'a6d34', 'b6f24', , 'd6d34', 'e6e24', 'f6f24', 'g6g24', , 'a7f24', 'b7g24', , 'd7d34', 'e7e24', 'f7f24', 'g7g24', 'h7d34', 'a8g24', 'b8b44',
-        ,
-        'd8d34', 'e8e24', 'f8f24', 'g8g24', 'h8h25', , , , , , , 'f1e16', 'f1e16', 'f1f24', , , , 'e2a24', 'f1e14', 'f1e14', 'h2a24', , 'b3a24', , 'f1e14',
-        ,
-        'f1e16', 'f1e16', 'f1e16', 'a4a24', 'f1e14', , 'd4b45', 'e4b45', , 'f1e25', 'f1e25', 'a5a24', 'f1e24', , 'd5a24', 'e5f46', 'f1e15', , 'f1e16',
-        'a6a24', 'f1e24', , 'd6b45', 'e6a24', 'f1e16', 'f1e25', , 'a7a24', 'f1e24', , 'd7g46', 'e7b45', 'f7a24', 'f1e16', 'f1e25', 'a8a24', 'f1e24',
-        ,
-        'd8h46', 'e8e46', 'f1e25', 'g8a24', 'f1e16', , , , , , , , 'h1g26', 'g1g24', , , , 'e2a24', 'f2a24', 'g2a24', 'h2a24', , 'b3a24', , 'd3e26', , 'f3g26',
-        'g3g26', 'h3g26', 'a4a24', 'g1f15', , 'd4f26', 'e4g26', , 'g1f16', 'g1f16', 'a5a24', 'b5e26', , 'd5a24', 'e5e26', 'f5f26', , 'h5e26', 'a6a24',
-        'b6f26', , 'd6b46', 'e6a24', 'f6f26', 'g6g26', , 'a7a24', 'b7g26', , 'd7b56', 'e7e26', 'f7a24', 'g7g26', 'g1f17', 'a8a24', 'b8b56', , 'd8f87',
-        'e8e26', 'f8f26', 'g8a24', 'g1f17', , , , , , , , , 'h1g14', , , , 'e2a25', 'f2a25', 'g2a25', 'h2a25', , 'b3a25', , 'd3e27', , 'f3f27', 'g3f27', 'h3b37',
-        'a4a25', 'h1h26', , 'd4b46', 'e4b46', , 'g4b46', 'h4b46', 'a5a25', 'b5b46', , 'd5a25', 'e5e27', 'f5f27', , 'h5e27', 'a6a25', 'b6b46', , 'd6b46',
-        'e6a25', 'f6f27', 'g6g48', , 'a7a25', 'b7b46', , 'd7e88', 'e7b46', 'f7a25', 'g7g48', 'h1g18', 'a8a25', 'b8b46', , 'd8e88', 'e8e27', 'f8b46',
-        'g8a25', 'h1g18', , , , , , , , , , , , , 'a2a32', 'a2a33', 'a2b33', 'a2b33', , 'b3d54', , 'd3d44', , 'f3f23', 'g3f23', 'h3g24', 'a4d74', 'b4d64', , 'a2b32',
-        'a2b34', , 'a2b34', 'h4f23', 'a5d84', 'b5d74', , 'a2b32', 'a2b34', 'f5f23', , 'h5d54', 'a6d64', 'b6f23', , 'a2b32', 'a2b34', 'f6f23', 'a2b34',
-        ,
-        'a7f23', 'a2b34', , 'a2b32', 'a2b34', 'f7f23', 'g7g24', 'h7d74', 'a2b34', 'b8d84', , 'a2b32', 'a2b34', 'f8f23', 'g8g24', 'h8d44', , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'e2e32', , , , , 'e2d33', 'e2d33', 'e2d33', , 'b3b44', , 'd3d24',
-        ,
-        'e2d34', 'e2d34', 'h3d34', 'a4b54', 'e2d32', , 'd4d34', 'e2d34', , 'e2d34', 'e2d34', 'a5b64', 'e2d32', , 'd5d34', 'e2d34', 'e2d34', , 'e2d34',
-        'a6b74', 'e2d32', , 'd6d34', 'e2d34', 'e2d34', 'e2d34', , 'a7b84', 'e2d32', , 'd7d34', 'e2d34', 'e2d34', 'e2d34', 'e2d34', 'a8b84', 'e2d32',
-        ,
-        'd8d34', 'e2d34', 'e2d34', 'e2d34', 'e2d34', , , , , , , , , 'f2e32', , , , 'e2a24', , 'f2e14', 'f2e34', , 'b3a24', , 'd3b34', , 'f3b34', 'g3b34', 'h3b34',
-        'a4b34', 'b4b34', , 'd4b45', 'e4e25', , 'f2e25', 'f2e25', 'a5a24', 'b5b34', , 'd5b34', 'e5e25', 'f2e15', , 'h5e25', 'a6a24', 'b6b34', , 'd6b45',
-        'e6b34', 'f2e16', 'f2e25', , 'a7a24', 'b7b34', , 'd7e86', 'e7e25', 'f7b34', 'f2e16', 'f2e25', 'a8a24', 'b8b34', , 'd8e86', 'e8e25', 'f2e25',
-        'g8b34', 'f2e16', , , , , , , , , 'g2f33', , , , 'e2a24', 'f2a24', , 'g2f35', , 'b3a24', , 'd3b35', , 'f3b35', 'g3b35', 'h3b35', 'a4a24', 'g2f34', , 'd4f26',
-        'e4e26', , 'g2f16', 'g2f16', 'a5a24', 'b5b35', , 'd5a24', 'e5e26', 'f5f26', , 'h5e26', 'a6a24', 'b6b35', , 'd6b46', 'e6a24', 'f6f26', 'g6b66',
-        ,
-        'a7a24', 'b7b35', , 'd7b56', 'e7e26', 'f7a24', 'g2f17', 'g2f17', 'a8a24', 'b8b35', , 'd8b66', 'e8e26', 'f8f26', 'g8a24', 'g2f17', , , , , , ,
-        ,
-        , 'h2g14', , , , 'e2a25', 'f2a25', 'g2a25', , , 'b3a25', , 'd3b36', , 'f3b36', 'g3b36', 'h3b36', 'a4a25', 'b4b36', , 'd4b46', 'e4b46', , 'g4b46',
-        'h4b46', 'a5a25', 'b5b46', , 'd5a25', 'e5e27', 'f5f27', , 'h5e27', 'a6a25', 'b6b46', , 'd6b46', 'e6a25', 'f6f27', 'g6g27', , 'a7a25', 'b7b46',
-        ,
-        'd7e88', 'e7b46', 'f7a25', 'g7g27', 'h2g18', 'a8a25', 'b8b46', , 'd8e88', 'e8e27', 'f8b46', 'g8a25', 'h2g18', , , , , , , , , 'a2e22', , , , 'a3b32',
-        'f2e22', 'g2e22', 'h2e22', , 'b3d54', , 'd3e22', , 'f3e22', 'g3f23', 'h3h24', 'a4d74', 'b4d64', , 'a3b32', 'e4e22', , 'g4e22', 'h4f23', 'a5d84',
-        'b5e22', , 'a3b32', 'e5e22', 'f5f23', , 'h5e22', 'a6e22', 'b6f23', , 'a3b32', 'e6e22', 'f6f23', 'a3b34', , 'a7f23', 'a3b34', , 'a3b32', 'e7e22',
-        'f7f23', 'g7g24', 'h7h24', 'a3b34', 'b8d84', , 'a3b32', 'e8e22', 'f8f23', 'g8g24', 'h8h24', , , , , , , , , 'a2c21', , , , 'e2e11', 'f2e11', 'g2c21',
-        'h2c21', , , , 'd3c21', , 'f3e22', 'g3e11', 'h3d72', 'a4d72', 'b4e11', , 'd4d52', 'e4e11', , 'g4e22', 'h4e11', 'a5e11', 'b3c32', , 'd5d62', 'e5e11',
-        'f5c21', , 'h5e22', 'a6d62', 'b6d82', , 'd6d72', 'e6e11', 'f6d42', 'g6c21', , 'a7d72', 'b7d72', , 'd7d82', 'e7e11', 'f7d52', 'g7d42', 'h7c21',
-        'a8d82', 'b8d82', , 'd8d72', 'e8e11', 'f8d62', 'g8d52', 'h8d42', , , , , , , , , 'a2c21', , , , 'e2f11', 'f2g11', 'g2h11', 'h2h11', , 'b3c21', , 'd3f11',
-        ,
-        'f3h11', 'g3g11', 'h3h11', 'a4c21', 'b4b52', 'c4f11', 'd4g11', 'e4h11', , 'g4g11', 'h4h11', 'a5a11', 'b5f11', 'c5g11', 'd5h11', 'e5e11',
-        'f5f11', , 'h5h11', 'a6f11', 'b6g11', 'c6h11', 'c3b32', 'e6e11', 'f6f11', 'g6g11', , 'a7g11', 'b7h11', 'c7h22', 'c3b32', 'e7e11', 'f7f11',
-        'g7g11', 'h7h11', 'a8h11', 'b8h22', 'c8f52', 'c3b32', 'e8e11', 'f8f11', 'g8g11', 'h8h11', , , , , , , , , 'a2c21', , , , 'e2c21', 'f2c21', 'g2c21',
-        'h2c21', , 'b3c21', , , , 'f3b72', 'g3b82', 'd3c33', 'a4c21', 'b4b52', , 'd4a11', 'e4b42', , 'g4b42', 'h4b42', 'a5a11', 'b5b62', , 'd5a22', 'e5a11',
-        'd3c32', , 'h5b52', 'a6a11', 'b6b72', , 'd6b42', 'e6a22', 'f6a11', 'g6b62', , 'a7a11', 'b7b82', , 'd7b52', 'e7b42', 'f7a22', 'g7a11', 'h7b72',
-        'a8a11', 'b8b72', , 'd8b62', 'e8b52', 'f8b42', 'g8a22', 'h8a11', , , , , , , , , 'e3d32', , , , 'e2a22', 'f2a22', 'g2a22', 'h2a22', , 'b3a22', , 'd3e24',
-        ,
-        'e3d34', 'e3d34', 'h3h24', 'a4a22', 'e3d32', , 'd4d34', 'e3d34', 'e3d34', 'e3d34', 'e3d34', 'a5a22', 'e3d32', , 'd5a22', 'e3d34', 'e3d34',
-        'e3d34', 'e3d34', 'a6a22', 'e3d32', , 'd6h24', 'e6a22', 'e3d34', 'e3d34', 'e3d34', 'a7a22', 'e3d32', , 'd7d34', 'e3d34', 'f7a22', 'e3d34',
-        'e3d34', 'a8a22', 'e3d32', , 'd8d34', 'e3d34', 'e3d34', 'g8a22', 'e3d34', , , , , , , , , 'f3e32', , , , 'e2a23', 'f2a23', 'g2a23', 'h2a23', , 'b3a23',
-        ,
-        'd3b34', , , 'g3h25', 'h3h25', 'a4a23', 'b4b34', , 'd4b44', 'e4b44', , 'g4b44', 'h4b44', 'a5a23', 'b5b44', , 'd5a23', 'e5h25', 'f3e25', , 'h5h25',
-        'a6a23', 'b6b44', , 'd6b44', 'e6a23', 'f3e26', 'f3e25', , 'a7a23', 'b7b44', , 'd7e86', 'e7b44', 'f7a23', 'g7g25', 'f3e25', 'a8a23', 'b8b44',
-        ,
-        'd8e86', 'e8e25', 'f8b44', 'g8a23', 'h8h25', , , , , , , , , 'g3f33', , , , 'e2a24', 'f2a24', 'g2a24', 'h2a24', , 'b3a24', , 'd3b35', , 'f3b35', , 'h3h26',
-        'a4a24', 'g3f34', , 'd4f26', 'e4g26', , 'g3f26', 'g3f26', 'a5a24', 'b5b35', , 'd5a24', 'e5e26', 'f5f26', , 'h5h26', 'a6a24', 'b6b35', , 'd6b46',
-        'e6a24', 'f6f26', 'g6b66', , 'a7a24', 'b7b35', , 'd7b56', 'e7e26', 'f7a24', 'g7b76', 'h7h26', 'a8a24', 'b8b35', , 'd8b66', 'e8e26', 'f8f26',
-        'g8a24', 'h8h26', , , , , , , , , 'h3g24', , , , 'e2a25', 'f2a25', 'g2a25', 'h2a25', , 'b3a25', , 'd3b36', , 'f3b36', 'g3b36', , 'a4a25', 'b4b36', , 'd4b46',
-        'e4b46', , 'g4b46', 'h4b46', 'a5a25', 'b5b46', , 'd5a25', 'e5h27', 'f5f27', , 'h5e27', 'a6a25', 'b6b46', , 'd6b46', 'e6a25', 'f6f27', 'g6g27',
-        ,
-        'a7a25', 'b7b46', , 'd7e88', 'e7b46', 'f7a25', 'g7g27', 'h3g28', 'a8a25', 'b8b46', , 'd8e88', 'e8e27', 'f8b46', 'g8a25', 'h3g28', , , , , , ,
-        ,
-        , 'a2e23', , , , 'a4b32', 'a4b43', 'a4b33', 'a4b33', , 'b3d34', , 'd3e23', , 'f3f23', 'g3f23', 'h3g24', , 'b4d44', , 'a4b32', 'e4e23', , 'g4e23',
-        'h4f23', 'a4b35', 'b5e23', , 'a4b32', 'e5e23', 'f5f23', , 'h5e23', 'a6e23', 'b6f23', , 'a4b32', 'e6e23', 'f6f23', 'a4b34', , 'a7f23', 'a4b34',
-        ,
-        'a4b32', 'e7e23', 'f7f23', 'g7g24', 'h7d34', 'a4b34', 'b8d85', , 'a4b32', 'e8e23', 'f8f23', 'g8g24', 'h8d44', , , , , , , , , 'b4c32', , , , 'b4c32',
-        'b4c32', 'b4c32', 'b4c32', , 'b3d34', , 'd3e23', , 'b4c33', 'b4c33', 'b4c33', 'b4c33', , , 'b4b32', 'b4c33', , 'b4c33', 'b4c33', 'b4c33', 'b4c32',
-        ,
-        'b4b32', 'b4c33', 'b4c32', , 'b4c33', 'a6e23', 'b4c33', , 'b4b32', 'b4c33', 'b4c33', 'b4c33', , 'a7f23', 'b4c33', , 'b4b32', 'b4c33', 'b4c33',
-        'b4c33', 'b4c33', 'b4c33', 'b4c33', , 'b4b32', 'b4c33', 'b4c33', 'b4c33', 'b4c33', , , , , , , , , 'c4d32', , , , 'c4c32', 'c4c32', 'c4c32', 'c4c32',
-        ,
-        'b3a23', , 'd3e23', , 'c4c33', 'c4c33', 'c4c33', 'a4a23', 'c4d32', , 'c4b32', 'c4c33', , 'c4c33', 'c4c33', 'a5a23', 'c4d32', 'c4c33', 'c4b32',
-        'c4c33', 'c4c32', , 'c4c33', 'a6a23', 'c4d32', 'c4c33', 'c4b32', 'c4c33', 'c4c33', 'c4c33', , 'a7f23', 'c4d32', 'c4c33', 'c4b32', 'c4c33',
-        'c4c33', 'c4c33', 'c4c33', 'a8g23', 'c4d32', 'c4c33', 'c4b32', 'c4c33', 'c4c33', 'c4c33', 'c4c33', , , , , , , , , 'd4e32', , , , 'd4c32', 'd4c32',
-        'd4c32', 'd4c32', , 'b3a23', , 'd3e23', , 'd4c33', 'd4c33', 'd4c33', 'a4a23', 'd4d32', , , 'd4c33', , 'd4c33', 'd4c33', 'a5a23', 'd4d32', , 'd4c33',
-        'd4c33', 'd4c32', , 'd4c33', 'a6e23', 'd4d32', , 'd4c33', 'd4c33', 'd4c33', 'd4c33', , 'a7a23', 'd4d32', , 'd4c33', 'd4c33', 'd4c33', 'd4c33',
-        'd4c33', 'a8g23', 'd4d32', , 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c33', , , , , , , , , 'e4e32', , , , 'e2a23', 'e4d33', 'e4d33', 'e4d33', , 'b3a23',
-        ,
-        'd3e24', , 'e4d34', 'e4d34', 'h3h24', 'a4a23', 'e4d32', , 'd4f24', , , 'e4d34', 'e4d34', 'a5a23', 'e4d32', , 'd5a23', 'e4d34', 'e4d34', , 'e4d34',
-        'a6a23', 'e4d32', , 'd6h24', 'e6a23', 'e4d34', 'e4d34', , 'a7a23', 'e4d32', , 'e4d34', 'e4d34', 'f7a23', 'e4d34', 'e4d34', 'a8a23', 'e4d32',
-        ,
-        'e4d34', 'e4d34', 'e4d34', 'g8a23', 'e4d34', , , , , , , , , 'f4e32', , , , 'e2a24', 'f2a24', 'f4e34', 'f4e34', , 'b3b44', , 'f4e34', , 'f3g25', 'g3h25',
-        'h3h25', 'a4b44', 'f4f34', , 'd4b44', 'e4b44', , 'f4e35', 'f4e35', 'a5b44', 'b5b44', , 'd5a24', 'e5e25', 'f4e35', 'g5g25', 'h5h25', 'a6a24',
-        'b6b44', , 'd6b44', 'e6a24', 'f4e36', 'f4e35', 'h6h25', 'a7a24', 'b7b44', , 'd7e76', 'e7b44', 'f7a24', 'g7g25', 'f4e35', 'a8a24', 'b8b44',
-        ,
-        'd8f86', 'e8e25', 'f8b44', 'g8a24', 'h8h25', , , , , , , , , 'g4f33', , , , 'e2a24', 'f2a24', 'g2a24', 'h2a24', , 'b3a24', , 'd3b35', , 'f3b35', 'g3b35',
-        'h3b35', 'a4a24', 'g4f34', , 'd4f26', 'e4g26', , , 'g4f36', 'a5a24', 'b5b35', , 'd5a24', 'e5h26', 'f5f26', , 'h5h26', 'a6a24', 'b6b35', , 'd6h26',
-        'e6a24', 'f6f26', 'g6b66', , 'a7a24', 'b7b35', , 'd7b56', 'e7e26', 'f7a24', 'g4f37', 'h7h26', 'a8a24', 'b8b35', , 'd8b66', 'e8e26', 'f8f26',
-        'g8a24', 'h8h26', , , , , , , , , 'h4g34', , , , 'e2a25', 'f2a25', 'g2a25', 'h2a25', , 'b3a25', , 'd3b36', , 'f3b36', 'g3b36', 'h3b36', 'a4a25', 'b4b36',
-        ,
-        'd4b46', 'e4b46', , 'g4b46', , 'a5a25', 'b5b46', , 'd5a25', 'e5h27', 'f5f27', , 'h5e27', 'a6a25', 'b6b46', , 'd6b46', 'e6a25', 'f6f27', 'g6g27',
-        ,
-        'a7a25', 'b7b46', , 'd7e88', 'e7b46', 'f7a25', 'g7g27', 'h4g38', 'a8a25', 'b8b46', , 'd8e88', 'e8e27', 'f8b46', 'g8a25', 'h4g38', , , , , , ,
-        ,
-        , 'a2e24', , , , 'a5b43', 'a5b43', 'a5b54', 'a5b44', , 'b3d35', , 'a5b44', , 'f3g24', 'g3g24', 'h3g24', 'a4d45', 'a5a45', , 'a5b44', 'a5b44',
-        ,
-        'g4g24', 'h4f24', , 'b5e24', , 'd5g24', 'e5e24', 'f5f24', , 'h5e24', 'a6e24', 'b6f24', , 'a5b55', 'e6e24', 'f6f24', 'g6g24', , 'a7f24', 'b7g24',
-        ,
-        'a5b55', 'e7e24', 'f7f24', 'g7g24', 'a5b45', 'a8g24', 'b8h25', , 'a5b55', 'e8e24', 'f8f24', 'g8g24', 'h8h25', , , , , , , , , 'b5c43', , , , 'b5c43',
-        'b5c43', 'b5c43', 'b5c43', , 'b3d55', , 'b5c44', , 'b5c44', 'b5c44', 'h3g24', 'a4d45', 'b4d65', , 'b5c44', 'b5c44', , 'g4g24', 'b5c44', 'b5c44',
-        ,
-        , 'b5c44', 'e5e24', 'b5c44', , 'h5e24', 'a6d65', 'b5c44', , 'b5c44', 'e6e24', 'b5c44', 'g6g24', , 'a7f24', 'b7g24', , 'b5c55', 'e7e24', 'b5c44',
-        'g7g24', 'b5c45', 'a8g24', 'b5c45', , 'b5c55', 'e8e24', 'b5c44', 'g8g24', 'b5c45', , , , , , , , , 'c5d43', , , , 'c5d43', 'c5d43', 'c5d43', 'c5d43',
-        ,
-        'b3a24', , 'c5c44', , 'c5c44', 'c5c44', 'h3h24', 'a4a24', 'c5d44', , 'c5c44', 'c5c44', , 'g4g24', 'c5c44', 'a5a24', 'b5e24', , 'c5c44', 'e5h24',
-        'c5c44', , 'h5h24', 'a6e24', 'c5c44', 'c6g24', 'c5c44', 'e6e24', 'c5c44', 'g6g24', , 'a7a24', 'b7g24', 'c7h24', 'c5d45', 'e7e24', 'c5c44',
-        'g7g24', 'h7h24', 'a8g24', 'b8h24', 'c5d45', 'c5d45', 'e8e24', 'c5c44', 'g8g24', 'h8h24', , , , , , , , , 'd5e43', , , , 'd5d43', 'd5d43', 'd5d43',
-        'd5d43', , 'b3a24', , 'd3e24', , 'd5c44', 'd5c44', 'h3h24', 'a4a24', 'd5e44', , 'd4f24', 'd5c44', , 'g4g24', 'd5c44', 'a5a24', 'b5e24', , , 'e5h24',
-        'd5c44', , 'h5h24', 'a6e24', 'b6f24', , 'd5c44', 'e6e24', 'd5c44', 'g6g24', , 'a7f24', 'b7c75', , 'd5d45', 'e7e24', 'd5c44', 'g7g24', 'h7h24',
-        'a8a24', 'b8h24', , 'd5d45', 'e8e24', 'd5c44', 'g8g24', 'h8h24', , , , , , , , , 'e5e43', , , , 'e5d43', 'e5d43', 'e5d43', 'e5d43', , 'b3a24', , 'd3e24',
-        ,
-        'f3g24', 'g3h24', 'h3h24', 'a4a24', 'e5f44', , 'd4f24', 'e4g24', , 'g4g24', 'h4h24', 'a5a24', 'b5e24', , 'd5g24', , 'f5f24', , 'h5h24', 'a6e24',
-        'b6f24', , 'd6g65', 'e6a24', 'f6f24', 'g6g24', , 'a7f24', 'b7g24', , 'd7d35', 'e5e45', 'f7f24', 'g7g24', 'h7h24', 'a8g24', 'b8b45', , 'd8d35',
-        'e5d45', 'f8f24', 'g8g24', 'h8h24', , , , , , , , , 'f5e43', , , , 'e2a24', 'f2a24', 'f5e44', 'f5e44', , 'b3a24', , 'd3e25', , 'f3g25', 'g3h25', 'h3h25',
-        'a4a24', 'f5f44', , 'd4f25', 'e4g25', , 'g4g25', 'h4h25', 'a5a24', 'b5e25', , 'd5a24', 'e5h25', , , 'h5h25', 'a6a24', 'b6f25', , 'd6h25', 'e6a24',
-        'f5e46', 'f5e55', , 'a7a24', 'b7g25', , 'd7d46', 'e7e25', 'f7a24', 'g7g25', 'h7h25', 'a8a24', 'b8h25', , 'd8d46', 'e8e25', 'f5e45', 'g8a24',
-        'h8h25', , , , , , , , , 'g5g44', , , , 'e2a24', 'f2a24', 'g2a24', 'h2a24', , 'b3a24', , 'd3e26', , 'f3g26', 'g3h26', 'h3h26', 'a4a24', 'g5f44', , 'd4f26',
-        'e4g26', , 'g4g26', 'h4h26', 'a5a24', 'b5e26', , 'd5a24', 'e5h26', 'f5f26', , 'h5h26', 'a6a24', 'b6f26', , 'd6h26', 'e6a24', 'f6f26', 'g5f47',
-        'h6h26', 'a7a24', 'b7g26', , 'g5f46', 'e7e26', 'f7a24', 'g5f47', 'h7h26', 'a8a24', 'b8h26', , 'd8f87', 'e8e26', 'f8f26', 'g8a24', 'h8h26',
-        ,
-        , , , , , , , 'h5g44', , , , 'e2a25', 'f2a25', 'g2a25', 'h2a25', , 'b3a25', , 'd3e27', , 'f3g27', 'g3h27', 'h3h27', 'a4a25', 'h5h46', , 'd4b46', 'e4b46',
-        ,
-        'g4b46', 'h4b46', 'a5a25', 'b5b46', , 'd5a25', 'e5h27', 'f5f27', , , 'a6a25', 'b6b46', , 'd6b46', 'e6a25', 'f6f27', 'g6g27', , 'a7a25', 'b7b46',
-        ,
-        'd7e88', 'e7b46', 'f7a25', 'g7g27', 'h5g48', 'a8a25', 'b8b46', , 'd8e88', 'e8e27', 'f8b46', 'g8a25', 'h5g48', , , , , , , , , 'a2e25', , , , 'a6b54',
-        'a6b54', 'a6b54', 'a6b65', , 'a6b56', , 'a6b55', , 'a6b55', 'g3h25', 'h3h25', 'a4d46', 'a6b56', , 'a6b55', 'a6b55', , 'g4g25', 'h4h25', 'a5d56',
-        'b5e25', , 'a6b55', 'e5h25', 'f5f25', , 'h5h25', , 'b6f25', , 'a6b55', 'e6e25', 'f6f25', 'g6g25', , 'a7f25', 'b7g25', , 'a6b55', 'e7e25', 'f7f25',
-        'g7g25', 'h7h25', 'a8g25', 'b8h25', , 'a6b55', 'e8e25', 'f8f25', 'g8g25', 'h8h25', , , , , , , , , 'b6c54', , , , 'b6c54', 'b6c54', 'b6c54', 'b6c54',
-        ,
-        'b3d56', , 'b6c55', , 'b6c55', 'g3h25', 'h3h25', 'a4d46', 'b4d66', , 'b6c55', 'b6c55', , 'g4g25', 'h4h25', 'a5d56', 'b5e25', , 'b6c55', 'e5h25',
-        'f5f25', , 'h5h25', 'a6e25', , , 'b6c55', 'e6e25', 'f6f25', 'b6c55', , 'a7a26', 'b7g25', , 'b6c55', 'e7e25', 'f7f25', 'g7g25', 'h7h25', 'a8g25',
-        'b8h25', , 'b6c55', 'e8e25', 'f8f25', 'g8g25', 'h8h25', , , , , , , , , 'c6d54', , , , 'c6d54', 'c6d54', 'c6d54', 'c6d54', , 'b3a25', , 'c6d55', , 'c6d55',
-        'g3h25', 'h3h25', 'a4a25', 'c6d55', , 'c6d55', 'c6d55', , 'g4g25', 'h4h25', 'a5a25', 'b5e25', , 'c6c55', 'e5h25', 'f5f25', , 'h5h25', 'a6e25',
-        'b6f25', , 'c6c55', 'e6e25', 'f6f25', 'c6d55', , 'a7f25', 'c6d56', 'c6d55', 'c6c55', 'e7e25', 'f7f25', 'g7g25', 'h7h25', 'a8a25', 'b8h25',
-        'c6d56', 'c6c55', 'e8e25', 'f8f25', 'g8g25', 'h8h25', , , , , , , , , 'd6e54', , , , 'd6e54', 'd6e54', 'd6e54', 'd6e54', , 'b3a25', , 'd3e25', , 'd6d55',
-        'g3h25', 'h3h25', 'a4a25', 'd6e55', , 'd4f25', 'd6e55', , 'g4g25', 'h4h25', 'a5a25', 'b5e25', , 'd5g25', 'e5h25', 'f5f25', , 'h5h25', 'a6e25',
-        'b6f25', , , 'e6e25', 'f6f25', 'd6e55', , 'a7f25', 'b7g25', , 'd6c55', 'e7e25', 'f7f25', 'g7g25', 'h7h25', 'a8g25', 'd6e56', , 'd6c55', 'e8e25',
-        'f8f25', 'g8g25', 'h8h25', , , , , , , , , 'e6f54', , , , 'e6e54', 'e6e54', 'e6e54', 'e6e54', , 'b3a25', , 'd3e25', , 'e6d55', 'g3h25', 'h3h25', 'a4a25',
-        'e6f55', , 'd4f25', 'e4g25', , 'g4g25', 'h4h25', 'a5a25', 'b5e25', , 'd5g25', 'e5h25', 'f5f25', , 'h5h25', 'a6e25', 'b6f25', , 'd6h25', , 'f6f25',
-        'e6e55', , 'a7f25', 'b7g25', , 'd7d46', 'e6e56', 'f7f25', 'g7g25', 'h7h25', 'a8g25', 'b8h25', , 'd8d46', 'e6e56', 'f8f25', 'g8g25', 'h8h25',
-        ,
-        , , , , , , , 'f6g54', , , , 'f6e54', 'f6e54', 'f6e54', 'f6e54', , 'b3a25', , 'd3e25', , 'f3g25', 'g3h25', 'h3h25', 'a4a25', 'f6f55', , 'd4f25', 'e4g25',
-        ,
-        'g4g25', 'h4h25', 'a5a25', 'b5e25', , 'd5g25', 'e5h25', 'f5f25', , 'h5h25', 'a6e25', 'b6f25', , 'd6h25', 'e6e25', , 'f6e55', , 'a7f25', 'b7g25',
-        ,
-        'd7d36', 'e7e25', 'f7a25', 'g7g25', 'h7h25', 'a8g25', 'b8h25', , 'd8d36', 'e8e25', 'f6e56', 'g8g25', 'h8h25', , , , , , , , , 'g6g54', , , , 'e2a25',
-        'f2a25', 'g2a25', 'g6f55', , 'b3a25', , 'd3e26', , 'f3g26', 'g3h26', 'h3h26', 'a4a25', 'g6f55', , 'd4f26', 'e4g26', , 'g4g26', 'h4h26', 'a5a25',
-        'b5e26', , 'd5a25', 'e5h26', 'f5f26', , 'h5h26', 'a6a25', 'b6f26', , 'd6h26', 'e6a25', 'f6f26', , , 'a7a25', 'b7g26', , 'd7d47', 'e7e26', 'f7a25',
-        'g6f57', 'h7h26', 'a8a25', 'b8h26', , 'd8d47', 'e8e26', 'f8f26', 'g8a25', 'h8h26', , , , , , , , , 'h6g54', , , , 'e2a26', 'f2a26', 'g2a26', 'h2a26',
-        ,
-        'b3a26', , 'd3e27', , 'f3g27', 'g3h27', 'h3h27', 'a4a26', 'h6h56', , 'd4f27', 'e4g27', , 'g4g27', 'h4h27', 'a5a26', 'b5e27', , 'd5a26', 'e5h27',
-        'f5f27', , 'h5h27', 'a6a26', 'b6f27', , 'd6h27', 'e6a26', 'f6f27', 'g6g27', , 'a7a26', 'b7g27', , 'd7e78', 'e7e27', 'f7a26', 'g7g27', 'h6g58',
-        'a8a26', 'b8h27', , 'd8f88', 'e8e27', 'f8f27', 'g8a26', 'h6g58', , , , , , , , , 'a2e26', , , , 'a7b65', 'a7b65', 'a7b65', 'a7b65', , 'a7b67', , 'a7b66',
-        ,
-        'a7b66', 'g3h26', 'h3h26', 'a4d77', 'a7b67', , 'a7b66', 'e4g26', , 'g4g26', 'h4h26', 'a5d87', 'b5e26', , 'a7b66', 'e5h26', 'f5f26', , 'h5h26',
-        'a6e26', 'b6f26', , 'a7b66', 'e6e26', 'f6f26', 'g6g26', , , 'b7g26', , 'a7b77', 'e7e26', 'f7f26', 'g7g26', 'h7h26', 'a8g26', 'b8h26', , 'a7b77',
-        'e8e26', 'f8f26', 'g8g26', 'h8h26', , , , , , , , , 'b7c65', , , , 'b7c65', 'b7c65', 'b7c65', 'b7c65', , 'b3a26', , 'b7c66', , 'b7c66', 'g3h26', 'h3h26',
-        'a4a26', 'b4d67', , 'b7c66', 'e4g26', , 'g4g26', 'h4h26', 'a5a26', 'b5e26', , 'b7c66', 'e5h26', 'f5f26', , 'h5h26', 'a6e26', 'b6f26', , 'b7c66',
-        'e6e26', 'f6f26', 'g6g26', , 'a7f26', , , 'b7c77', 'e7e26', 'f7f26', 'g7g26', 'h7h26', 'a8a26', 'b8h26', , 'b7c77', 'e8e26', 'f8f26', 'g8g26',
-        'h8h26', , , , , , , , , 'c7d65', , , , 'c7d65', 'c7d65', 'c7d65', 'c7d65', , 'b3a26', , 'c7d66', , 'c7d66', 'g3h26', 'h3h26', 'a4a26', 'b4d67', , 'c7d66',
-        'e4g26', , 'g4g26', 'h4h26', 'a5a26', 'b5e26', , 'c7d66', 'e5h26', 'f5f26', , 'h5h26', 'a6e26', 'b6f26', , 'c7c66', 'e6e26', 'f6f26', 'g6g26',
-        ,
-        'a7f26', 'b7g26', , 'c7c67', 'e7e26', 'f7f26', 'g7g26', 'h7h26', 'a8g26', 'b8d87', 'c8d87', 'c7c67', 'e8e26', 'f8f26', 'g8g26', 'h8h26',
-        ,
-        , , , , , , , 'd7e65', , , , 'd7e65', 'd7e65', 'd7e65', 'd7e65', , 'b3a26', , 'd3e26', , 'd7e66', 'g3h26', 'h3h26', 'a4a26', 'b4d67', , 'd4f26', 'e4g26',
-        ,
-        'g4g26', 'h4h26', 'a5a26', 'b5e26', , 'd5g26', 'e5h26', 'f5f26', , 'h5h26', 'a6e26', 'b6f26', , 'd6h26', 'e6e26', 'f6f26', 'g6g26', , 'a7f26',
-        'b7g26', , , 'e7e26', 'f7f26', 'g7g26', 'h7h26', 'a8g26', 'b8h26', , 'd7e67', 'e8e26', 'f8f26', 'g8g26', 'h8h26', , , , , , , , , 'e7f65', , , , 'e7f65',
-        'e7f65', 'e7f65', 'e7f65', , 'b3a26', , 'd3e26', , 'e7e66', 'g3h26', 'h3h26', 'a4a26', 'b4d47', , 'd4f26', 'e4g26', , 'g4g26', 'h4h26', 'a5a26',
-        'b5e26', , 'd5g26', 'e5h26', 'f5f26', , 'h5h26', 'a6e26', 'b6f26', , 'd6h26', 'e6e26', 'f6f26', 'g6g26', , 'a7f26', 'b7g26', , 'd7d57', , 'f7f26',
-        'g7g26', 'h7h26', 'a8g26', 'b8h26', , 'd8d57', 'e7e67', 'f8f26', 'g8g26', 'h8h26', , , , , , , , , 'f7g65', , , , 'f7f65', 'f7f65', 'f7f65', 'f7f65',
-        ,
-        'b3a26', , 'd3e26', , 'f3g26', 'g3h26', 'h3h26', 'a4a26', 'b4d47', , 'd4f26', 'e4g26', , 'g4g26', 'h4h26', 'a5a26', 'b5e26', , 'd5g26', 'e5h26',
-        'f5f26', , 'h5h26', 'a6e26', 'b6f26', , 'd6h26', 'e6e26', 'f6f26', 'g6g26', , 'a7f26', 'b7g26', , 'd7d47', 'e7e26', , 'g7g26', 'h7h26', 'a8g26',
-        'b8h26', , 'd8d47', 'e8e26', 'f7e67', 'g8g26', 'h8h26', , , , , , , , , 'g7g65', , , , 'g7f65', 'g7f65', 'g7f65', 'g7f65', , 'b3a26', , 'd3e26', , 'f3g26',
-        'g3h26', 'h3h26', 'a4a26', 'b4c37', , 'd4f26', 'e4g26', , 'g4g26', 'h4h26', 'a5a26', 'b5e26', , 'd5g26', 'e5h26', 'f5f26', , 'h5h26', 'a6e26',
-        'b6f26', , 'd6h26', 'e6e26', 'f6f26', 'g6g26', , 'a7f26', 'b7g26', , 'd7d37', 'e7e26', 'f7f26', , 'h7h26', 'a8g26', 'b8h26', , 'd8d37', 'e8e26',
-        'f8f26', 'g8a26', 'h8h26', , , , , , , , , 'h7g65', , , , 'e2a26', 'f2a26', 'g2a26', 'h2a26', , 'b3a26', , 'd3e27', , 'f3g27', 'g3h27', 'h3h27', 'a4a26',
-        'b4b37', , 'd4f27', 'e4g27', , 'g4g27', 'h4h27', 'a5a26', 'b5e27', , 'd5a26', 'e5h27', 'f5f27', , 'h5h27', 'a6a26', 'b6f27', , 'd6h27', 'e6a26',
-        'f6f27', 'g6g27', , 'a7a26', 'b7g27', , 'd7d48', 'e7e27', 'f7a26', 'g7g27', , 'a8a26', 'b8h27', , 'd8d48', 'e8e27', 'f8f27', 'g8a26', 'h7g68',
-        ,
-        , , , , , , , 'a8b76', , , , 'a8b76', 'a8b76', 'a8b76', 'a8b76', , 'b3a27', , 'a8b77', , 'a8b77', 'g3h27', 'h3h27', 'a4a27', 'a8b78', , 'a8b77', 'e4g27',
-        ,
-        'g4g27', 'h4h27', 'a5a27', 'b5e27', , 'a8b77', 'e5h27', 'f5f27', , 'h5h27', 'a6e27', 'b6f27', , 'a8b77', 'e6e27', 'f6f27', 'g6g27', , 'a7f27',
-        'b7g27', , 'a8b77', 'e7e27', 'f7f27', 'g7g27', 'h7h27', , 'b8h27', , 'a8b77', 'e8e27', 'f8f27', 'g8g27', 'h8h27', , , , , , , , , 'b8c76', , , , 'b8c76',
-        'b8c76', 'b8c76', 'b8c76', , 'b3a27', , 'b8c77', , 'b8c77', 'g3h27', 'h3h27', 'a4a27', 'b4d68', , 'b8c77', 'e4g27', , 'g4g27', 'h4h27', 'a5a27',
-        'b5e27', , 'b8c77', 'e5h27', 'f5f27', , 'h5h27', 'a6e27', 'b6f27', , 'b8c77', 'e6e27', 'f6f27', 'g6g27', , 'a7f27', 'b7g27', , 'b8c77', 'e7e27',
-        'f7f27', 'g7g27', 'h7h27', 'a8g27', , , 'b8c77', 'e8e27', 'f8f27', 'g8g27', 'h8h27', , , , , , , , , 'c8d76', , , , 'c8d76', 'c8d76', 'c8d76', 'c8d76',
-        ,
-        'b3a27', , 'c8d77', , 'c8d77', 'g3h27', 'h3h27', 'a4a27', 'b4d68', , 'c8d77', 'e4g27', , 'g4g27', 'h4h27', 'a5a27', 'b5e27', , 'c8d77', 'e5h27',
-        'f5f27', , 'h5h27', 'a6e27', 'b6f27', , 'c8d77', 'e6e27', 'f6f27', 'g6g27', , 'a7f27', 'b7g27', , 'c8c77', 'e7e27', 'f7f27', 'g7g27', 'h7h27',
-        'a8g27', 'b8h27', , 'c8c77', 'e8e27', 'f8f27', 'g8g27', 'h8h27', , , , , , , , , 'd8e76', , , , 'd8e76', 'd8e76', 'd8e76', 'd8e76', , 'b3a27', , 'd3e27',
-        ,
-        'd8e77', 'g3h27', 'h3h27', 'a4a27', 'b4d68', , 'd4f27', 'e4g27', , 'g4g27', 'h4h27', 'a5a27', 'b5e27', , 'd5g27', 'e5h27', 'f5f27', , 'h5h27',
-        'a6e27', 'b6f27', , 'd6h27', 'e6e27', 'f6f27', 'g6g27', , 'a7f27', 'b7g27', , 'd8c77', 'e7e27', 'f7f27', 'g7g27', 'h7h27', 'a8g27', 'b8h27',
-        ,
-        , 'e8e27', 'f8f27', 'g8g27', 'h8h27', , , , , , , , , 'e8f76', , , , 'e8f76', 'e8f76', 'e8f76', 'e8f76', , 'b3a27', , 'd3e27', , 'e8f77', 'g3h27', 'h3h27',
-        'a4a27', 'b4d68', , 'd4f27', 'e4g27', , 'g4g27', 'h4h27', 'a5a27', 'b5e27', , 'd5g27', 'e5h27', 'f5f27', , 'h5h27', 'a6e27', 'b6f27', , 'd6h27',
-        'e6e27', 'f6f27', 'g6g27', , 'a7f27', 'b7g27', , 'd7d68', 'e7e27', 'f7f27', 'g7g27', 'h7h27', 'a8g27', 'b8h27', , 'd8d68', , 'f8f27', 'g8g27',
-        'h8h27', , , , , , , , , 'f8g76', , , , 'f8g76', 'f8g76', 'f8g76', 'f8g76', , 'b3a27', , 'd3e27', , 'f3g27', 'g3h27', 'h3h27', 'a4a27', 'b4d48', , 'd4f27',
-        'e4g27', , 'g4g27', 'h4h27', 'a5a27', 'b5e27', , 'd5g27', 'e5h27', 'f5f27', , 'h5h27', 'a6e27', 'b6f27', , 'd6h27', 'e6e27', 'f6f27', 'g6g27',
-        ,
-        'a7f27', 'b7g27', , 'd7d58', 'e7e27', 'f7f27', 'g7g27', 'h7h27', 'a8g27', 'b8h27', , 'd8d58', 'e8e27', , 'g8g27', 'h8h27', , , , , , , , , 'g8h76',
-        ,
-        , , 'g8g76', 'g8g76', 'g8g76', 'g8g76', , 'b3a27', , 'd3e27', , 'f3g27', 'g3h27', 'h3h27', 'a4a27', 'b4d48', , 'd4f27', 'e4g27', , 'g4g27', 'h4h27',
-        'a5a27', 'b5e27', , 'd5g27', 'e5h27', 'f5f27', , 'h5h27', 'a6e27', 'b6f27', , 'd6h27', 'e6e27', 'f6f27', 'g6g27', , 'a7f27', 'b7g27', , 'd7d48',
-        'e7e27', 'f7f27', 'g7g27', 'h7h27', 'a8g27', 'b8h27', , 'd8d48', 'e8e27', 'f8f27', , 'h8h27', , , , , , , , , 'h8h76', , , , 'h8g76', 'h8g76', 'h8g76',
-        'h8g76', , 'b3a27', , 'd3e27', , 'f3g27', 'g3h27', 'h3h27', 'a4a27', 'b4c38', , 'd4f27', 'e4g27', , 'g4g27', 'h4h27', 'a5a27', 'b5e27', , 'd5g27',
-        'e5h27', 'f5f27', , 'h5h27', 'a6e27', 'b6f27', , 'd6h27', 'e6e27', 'f6f27', 'g6g27', , 'a7f27', 'b7g27', , 'd7d38', 'e7e27', 'f7f27', 'g7g27',
-        'h7h27', 'a8g27', 'b8h27', , 'd8d38', 'e8e27', 'f8f27', 'g8g27', , , , , , , , , , 'a2f24', 'b2f24', , , , 'a1a24', 'a1b23', 'a1b24', 'a3b25', , 'c3b25',
-        ,
-        'a1a24', , 'g3f24', 'h3h25', , 'b4e45', 'c4e45', , 'a1b24', 'f4f24', , 'h4f24', 'a5a25', 'b5b25', 'c5f24', , 'a1b24', 'f5f24', 'g5g25', , 'a6a25',
-        'b6f24', 'c6e45', , 'a1b24', 'f6f24', 'g6g25', 'h6h25', 'a7f24', 'b7e45', 'c7h25', , 'a1b24', 'f7f24', 'g7g25', 'h7h25', 'a8e45', 'b8h25',
-        'a1b26', , 'a1b24', 'f8f24', 'g8g25', 'h8h25', 'a1a25', , , , , , , , 'a2h24', 'b2h24', , , , 'b1a14', 'b1b23', 'b1b24', 'a3b25', , 'c3c25', , 'b1a24',
-        ,
-        'g3h24', 'h3h24', , 'b4e44', 'c4e44', , 'b1b24', 'f4h24', , 'h4h24', 'a5a25', 'b5b25', 'c5c25', , 'b1b24', 'f5e44', 'g5g25', , 'a6a25', 'b6b25',
-        'c6e44', , 'b1b24', 'f6f45', 'g6e44', 'h6h24', 'a7a25', 'b7e44', 'c7h24', , 'b1b24', 'f7f45', 'g7g25', 'h7h24', 'a8e44', 'b8h24', 'c8c25',
-        ,
-        'b1b24', 'f8f45', 'g8g25', 'h8h24', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'g1g25', 'h1h25',
-        'f1f23', 'f1g24', , , , 'f1g25', 'f1g15', 'f1g15', 'a3b45', , 'c3c44', , 'e3f25', , 'g3h25', 'h3h25', , 'b4c44', 'f1f24', , 'e4c44', 'f4c44', ,
-        'h4c44', 'a5b45', 'b5c44', 'c5c44', , 'e5h25', 'f5f25', 'g5g25', , 'a6c44', 'b6f25', 'c6c44', , 'e6c44', 'f6f25', 'g6g25', 'h6h25', 'a7f25',
-        'b7g25', 'c7c44', , 'e7e25', 'f7c44', 'g7g25', 'h7h25', 'a8g25', 'b8h25', 'c8c44', , 'e8e25', 'f8f25', 'g8c44', 'h8h25', , , , , , , , 'h1h25',
-        'g1f23', 'g1g24', , , , 'f2b24', 'g2b24', 'h2b24', 'a3b24', , 'c3b24', , 'e3f25', , 'g3h25', 'h3h25', , 'b4b24', 'g1f14', , 'e4g25', 'f4h25', ,
-        'h4h25', 'a5a25', 'b5b24', 'g1f24', , 'e5b24', 'f5f25', 'g5g25', , 'a6c45', 'b6b24', 'g1f24', , 'e6c45', 'f6b24', 'g6g25', 'h6h25', 'a7f25',
-        'b7b24', 'g1f24', , 'e7c56', 'f7f25', 'g7b24', 'h7h25', 'a8g25', 'b8b24', 'g1f24', , 'e8c66', 'f8f25', 'g8g25', 'h8b24', , , , , , , , , 'a2b24',
-        'h1h24', , , , 'f2b24', 'g2b24', 'h2b24', 'a3b24', , 'c3b24', , 'e3f26', , 'g3h26', 'h3h26', , 'b4b24', 'c4a25', , 'e4g26', 'f4h26', , 'h4h26',
-        'a5a25', 'b5b24', 'c5f26', , 'e5b24', 'f5f26', 'g5g26', , 'a6a25', 'b6b24', 'c6g26', , 'e6a25', 'f6b24', 'g6g26', 'h6h26', 'a7a25', 'b7b24',
-        'c7h26', , 'e7c56', 'f7a25', 'g7b24', 'h7h26', 'a8a25', 'b8b24', 'c8c56', , 'e8e47', 'f8f26', 'g8a25', 'h8b24', , , , , , , , , , 'a2b34', , , , 'a2b32',
-        'a2b33', 'a2b34', 'a3e34', , 'c3e34', , 'a2a34', , 'g3g24', 'h3g24', , 'b4e45', 'a2b35', , 'a2a34', 'f4f24', , 'h4f24', 'a2b36', 'b5b25', 'c5e34',
-        ,
-        'a2b34', 'f5f24', 'g5g24', , 'a2b36', 'b6e34', 'c6g24', , 'a2b34', 'f6f24', 'g6g24', 'h6e34', 'a7e34', 'b7g24', 'c7h25', , 'a2b34', 'f7f24',
-        'g7g24', 'h7h25', 'a8g24', 'b8h25', 'a2b36', , 'a2b34', 'f8f24', 'g8g24', 'h8h25', , , , , , , , , 'b2c33', , , , , 'b2b32', 'b2b33', 'b2c33', 'a3e74',
-        ,
-        'c3e54', , 'b2a24', , 'g3g23', 'h3g23', , 'b4e74', 'c4e64', , 'b2c32', 'b2c34', , 'b2c34', 'a5e54', 'b5e84', 'c5e74', , 'b2c32', 'b2c34', 'g5g23',
-        ,
-        'a6e64', 'b6e64', 'c6g23', , 'b2c32', 'b2c34', 'g6g23', 'b2c34', 'a7e74', 'b7g23', 'b2c34', , 'b2c32', 'b2c34', 'g7g23', 'h7h24', 'a8g23',
-        'b2c34', 'c8e84', , 'b2c32', 'b2c34', 'g8g23', 'h8h24', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , 'f2f33', 'f2f32', , , , , 'f2e33', 'f2e33', 'a3a23', , 'c3c44', , 'e3c54', , 'g3c74', 'h3c84', , 'b4c54', 'f2e32', , 'e4c44', 'f4c44', ,
-        'h4c44', 'a5a23', 'b5c64', 'f2e32', , 'e5c54', 'f5c54', 'g5c54', , 'a6a23', 'b6c74', 'f2e32', , 'e6a23', 'f6c64', 'g6c64', 'h6c64', 'a7a23',
-        'b7c84', 'f2e32', , 'e7c54', 'f7a23', 'g7c74', 'h7c74', 'a8a23', 'b8c84', 'f2e32', , 'e8c64', 'f8c54', 'g8a23', 'h8c84', , , , , , , , , 'g2f23',
-        'g2f32', , , , 'f2b24', , 'g2f34', 'a3c34', , 'c3b24', , 'e3c34', , 'g3c34', 'h3c34', , 'b4c34', 'c4c34', , 'e4c45', 'f4f25', , 'h4f25', 'a5c34',
-        'b5b24', 'c5c34', , 'e5c34', 'f5f25', 'g2f26', , 'a6a24', 'b6b24', 'c6c34', , 'e6a24', 'f6c34', 'g2f36', 'h6f46', 'a7a24', 'b7b24', 'c7c34',
-        ,
-        'e7c56', 'f7a24', 'g7c34', 'g2f36', 'a8a24', 'b8b24', 'c8c34', , 'e8c66', 'f8f25', 'g8a24', 'h8c34', , , , , , , , , 'a2b24', 'h2g33', , , , 'f2b24',
-        'g2b24', , 'a3b24', , 'c3b24', , 'e3c35', , 'g3c35', 'h3c35', , 'b4b24', 'h2g34', , 'e4g26', 'f4f26', , 'h4f26', 'a5c35', 'b5b24', 'c5c35', , 'e5b24',
-        'f5f26', 'g5g26', , 'a6a25', 'b6b24', 'c6c35', , 'e6a25', 'f6b24', 'g6g26', 'h6c66', 'a7a25', 'b7b24', 'c7c35', , 'e7c56', 'f7a25', 'g7b24',
-        'h7e47', 'a8a25', 'b8b24', 'c8c35', , 'e8c66', 'f8f26', 'g8a25', 'h8b24', , , , , , , , , 'a2f23', 'b2f23', , , , 'a3b32', 'a3b43', 'h2f23', , , 'c3e34',
-        ,
-        'e3f23', , 'g3f23', 'h3g24', , 'b4e44', 'c4e44', , 'a3a44', 'f4f23', , 'h4f23', 'a3b46', 'b5b25', 'c5f23', , 'a3b34', 'f5f23', 'g5g24', , 'a3b36',
-        'b6f23', 'c6e44', , 'a3b34', 'f6f23', 'g6g24', 'h6e34', 'a7f23', 'b7e44', 'c7h25', , 'a3b34', 'f7f23', 'g7g24', 'h7e44', 'a8e44', 'b8h25',
-        'a3b36', , 'a3b34', 'f8f23', 'g8g24', 'h8h25', , , , , , , , , 'a2f22', 'b2f22', , , , 'b3c32', 'g2f22', 'h2f22', 'a3e74', , 'c3e54', , 'e3f22', , 'g3f22',
-        'h3g23', 'a4e84', 'b4e74', 'c4e64', , 'b3c32', 'f4f22', , 'h4f22', 'a5e54', 'b5e84', 'c5f22', , 'b3c32', 'f5f22', 'g5g23', , 'a6e64', 'b6f22',
-        'c6g23', , 'b3c32', 'f6f22', 'g6g23', 'b3c34', 'a7f22', 'b7g23', 'b3c34', , 'b3c32', 'f7f22', 'g7g23', 'h7h24', 'a8g23', 'b3c34', 'c8e84',
-        ,
-        'b3c32', 'f8f22', 'g8g23', 'h8h24', , , , , , , , , 'a2d21', 'b2d21', , , , 'f2f11', 'g2f11', 'h2d21', 'a3e72', , , , 'e3d21', , 'g3f22', 'h3f11', ,
-        'b4e72', 'c4f11', , 'e4e52', 'f4f11', , 'h4f22', 'a5e52', 'b5f11', 'c3d32', , 'c3d32', 'f5f11', 'g5d21', , 'a6f11', 'b6e62', 'c6e82', , 'e6e72',
-        'f6f11', 'g6e42', 'h6d21', 'a7e72', 'b7e72', 'c7e72', , 'e7e82', 'f7f11', 'c3d32', 'h7e42', 'a8e82', 'b8e82', 'c8e82', , 'e8e72', 'f8f11',
-        'g8e62', 'h8e52', , , , , , , , , 'a2d21', 'b2d21', , , , 'f2g11', 'g2h11', 'h2h11', 'a3a11', , 'c3d21', , 'e3g11', , 'g3g11', 'h3h11', , 'b4d21', 'c4c52',
-        'd4g11', 'e4h11', 'f4f11', , 'h4h11', 'a5d21', 'b5b11', 'c5g11', 'd5h11', 'e5a11', 'f5f11', 'g5g11', , 'a6a11', 'b6g11', 'c6h11', 'd6e52',
-        'd3c32', 'f6f11', 'g6g11', 'h6h11', 'a7g11', 'b7h11', 'c7g72', 'd7g72', 'd3c32', 'f7f11', 'g7g11', 'h7h11', 'a8h11', 'b8b11', 'c8c52', 'd8g52',
-        'd3c32', 'f8f11', 'g8g11', 'h8h11', , , , , , , , , 'a2d21', 'b2d21', , , , 'f2d21', 'g2d21', 'h2d21', 'a3c52', , 'c3d21', , , , 'g3c72', 'h3c82', , 'b4d21',
-        'c4c52', , 'e4b11', 'f4c42', , 'h4c42', 'a5d21', 'b5b11', 'c5c62', , 'e3d32', 'f5b11', 'e3d32', , 'a6c82', 'b6b11', 'c6c72', , 'e6c42', 'f6b22',
-        'g6b11', 'h6c62', 'a7c72', 'b7b11', 'c7c82', , 'e7c52', 'f7c42', 'e3d32', 'h7b11', 'a8c82', 'b8b11', 'c8c72', , 'e8c62', 'f8c52', 'g8c42',
-        'h8b22', , , , , , , , , 'a2b22', 'f3e32', , , , 'f2b22', 'g2b22', 'h2b22', 'a3b22', , 'c3b22', , 'e3f24', , 'g3h24', 'h3h24', , 'b4b22', 'f3e32', , 'e4e24',
-        'f4h24', 'g4g24', 'h4h24', 'a5a23', 'b5b22', 'f3e32', , 'e5b22', 'f5c54', 'g5g24', 'h5h24', 'a6a23', 'b6b22', 'f3e32', , 'e6a23', 'f6b22',
-        'g6g24', 'h6h24', 'a7a23', 'b7b22', 'f3e32', , 'e7e24', 'f7a23', 'g7b22', 'h7h24', 'a8a23', 'b8b22', 'f3e32', , 'e8e24', 'f8c54', 'g8a23',
-        'h8b22', , , , , , , , , 'a2b23', 'g3f32', , , , 'f2b23', 'g2b23', 'h2b23', 'a3b23', , 'c3b23', , 'e3c34', , , 'h3h25', , 'b4b23', 'c4c34', , 'e4c44',
-        'f4c44', , 'h4c44', 'a5c34', 'b5b23', 'c5c44', , 'e5b23', 'f5f25', 'g3f26', , 'a6c44', 'b6b23', 'c6c44', , 'e6c44', 'f6b23', 'g3f36', 'h6h25',
-        'a7a24', 'b7b23', 'c7c44', , 'e7c56', 'f7c44', 'g7b23', 'h7h25', 'a8a24', 'b8b23', 'c8c44', , 'e8c66', 'f8f25', 'g8c44', 'h8b23', , , , , , , ,
-        ,
-        'a2b24', 'h3g33', , , , 'f2b24', 'g2b24', 'h2b24', 'a3b24', , 'c3b24', , 'e3c35', , 'g3c35', , , 'b4b24', 'h3g34', , 'e4g26', 'f4h26', , 'h4f26',
-        'a5c35', 'b5b24', 'c5c35', , 'e5b24', 'f5f26', 'g5g26', , 'a6a25', 'b6b24', 'c6c35', , 'e6a25', 'f6b24', 'g6g26', 'h6c66', 'a7a25', 'b7b24',
-        'c7c35', , 'e7c56', 'f7a25', 'g7b24', 'h7c76', 'a8a25', 'b8b24', 'c8c35', , 'e8c66', 'f8f26', 'g8a25', 'h8b24', , , , , , , , , 'a2f24', 'a4b34',
-        ,
-        , , 'a4b32', 'a4b43', 'a4b54', 'a3e35', , 'c3e35', , 'a4b44', , 'g3g24', 'h3g24', , 'b4e44', 'c4e44', , 'a4b44', 'f4f24', , 'h4f24', 'a4b46',
-        'b5b25', 'c5f24', , 'a4b34', 'f5f24', 'g5g24', , 'a4b36', 'b6f24', 'c6e44', , 'a4b34', 'f6f24', 'g6g24', 'h6h25', 'a7f24', 'b7e44', 'c7h25',
-        ,
-        'a4b34', 'f7f24', 'g7g24', 'h7e44', 'a8e44', 'b8h25', 'a4b36', , 'a4b34', 'f8f24', 'g8g24', 'h8h25', , , , , , , , , 'a2f23', 'b2f23', , , , 'b4c32',
-        'b4c43', 'b4c33', 'a3e34', , 'c3e34', , 'e3f23', , 'g3g23', 'h3g23', , , 'c4e44', , 'b4c32', 'f4f23', , 'h4f23', 'a5e55', 'b4c35', 'c5f23', , 'b4c32',
-        'f5f23', 'g5g23', , 'a6e65', 'b6f23', 'c6g23', , 'b4c32', 'f6f23', 'g6g23', 'b4c34', 'a7f23', 'b7g23', 'b4c34', , 'b4c32', 'f7f23', 'g7g23',
-        'h7h24', 'a8g23', 'b4c34', 'c8e85', , 'b4c32', 'f8f23', 'g8g23', 'h8h24', , , , , , , , , 'c4d32', 'c4d32', , , , 'c4d32', 'c4d32', 'c4d32', 'c4d33',
-        ,
-        'c3e34', , 'e3f23', , 'c4d33', 'h3g23', , 'c4d33', , , 'c4c32', 'c4d33', , 'c4d33', 'c4d32', 'c4d33', 'c4d32', , 'c4d32', 'c4d33', 'c4d32', ,
-        'c4d33', 'b6f23', 'c4d33', , 'c4c32', 'c4d33', 'c4d33', 'c4d33', 'c4d32', 'b7g23', 'c4d33', , 'c4c32', 'c4d33', 'c4d32', 'c4d33', 'a8g23',
-        'c4d33', 'c4d33', , 'c4c32', 'c4d33', 'c4d33', 'c4d33', , , , , , , , , 'd4d32', 'd4e32', , , , 'd4d32', 'd4d32', 'd4d32', 'a3b23', , 'c3b23', , 'e3f23',
-        ,
-        'd4d33', 'h3h23', , 'b4b23', 'd4e32', , 'd4c32', 'd4d33', , 'd4d33', 'd4d32', 'b5b23', 'd4e32', 'd4d33', 'd4d32', 'd4d33', 'd4d32', , 'a6a23',
-        'b6b23', 'd4e32', 'd4d33', 'd4c32', 'd4d33', 'd4d33', 'd4d33', 'd4d32', 'b7g23', 'd4e32', 'd4d33', 'd4c32', 'd4d33', 'd4d32', 'd4d33', 'a8g23',
-        'b8h23', 'd4e32', 'd4d33', 'd4c32', 'd4d33', 'd4d33', 'd4d33', , , , , , , , , 'e4d32', 'e4f32', , , , 'e4d32', 'e4d32', 'e4d32', 'a3b23', , 'c3b23',
-        ,
-        'e3f24', , 'e4d33', 'e4d34', , 'b4b23', 'e4e32', , , 'e4d33', , 'e4d33', 'e4d32', 'b5b23', 'e4e32', , 'e4d32', 'e4d33', 'e4d32', , 'a6a23', 'b6b23',
-        'e4e32', , 'e4d33', 'e4d33', 'e4d33', 'e4d33', 'e4d32', 'b7b23', 'e4e32', , 'e4d33', 'e4d33', 'e4d32', 'e4d33', 'a8a23', 'b8b23', 'e4e32',
-        ,
-        'e4d33', 'e4d33', 'e4d33', 'e4d33', , , , , , , , , 'a2b23', 'f4f32', , , , 'f2b23', 'f4e33', 'f4e33', 'a3b23', , 'c3b23', , 'e3c34', , 'g3c34', 'h3c34',
-        ,
-        'b4b23', 'f4e32', , 'e4c44', , , 'f4e35', 'a5a23', 'b5b23', 'f4e32', , 'e5b23', 'f4e35', 'g5g25', , 'a6a23', 'b6b23', 'f4e32', , 'e6a23', 'f6b23',
-        'f4e35', 'h6h25', 'a7a23', 'b7b23', 'f4e32', , 'e7e45', 'f7a23', 'g7b23', 'f4e35', 'a8a23', 'b8b23', 'f4e32', , 'e8e45', 'f4e35', 'g8a23',
-        'h8b23', , , , , , , , , 'g4f33', 'g4f32', , , , 'f2b24', 'g2b24', 'g4f34', 'a3b24', , 'c3c44', , 'e3f25', , 'g3h25', 'h3h25', , 'b4c44', 'c4a24', , 'e4c44',
-        'f4c44', , 'h4h25', 'a5a24', 'b5c44', 'c5c44', , 'e5b24', 'f5f25', 'g4f36', 'h5h25', 'a6c44', 'b6b24', 'c6c44', , 'e6c44', 'f6b24', 'g4f36',
-        'h6h25', 'a7a24', 'b7b24', 'c7c44', , 'e7c56', 'f7c44', 'g7b24', 'h7h25', 'a8a24', 'b8b24', 'c8c44', , 'e8c66', 'f8f25', 'g8c44', 'h8b24',
-        ,
-        , , , , , , , 'a2b24', 'h4g33', , , , 'f2b24', 'g2b24', 'h2b24', 'a3b24', , 'c3b24', , 'e3c35', , 'g3c35', 'h3c35', , 'b4b24', 'h4g34', , 'e4g26', 'f4h26',
-        ,
-        , 'a5c35', 'b5b24', 'c5c35', , 'e5b24', 'f5f26', 'g5g26', , 'a6a25', 'b6b24', 'c6c35', , 'e6a25', 'f6b24', 'g6g26', 'h6c66', 'a7a25', 'b7b24',
-        'c7c35', , 'e7c56', 'f7a25', 'g7b24', 'h7e47', 'a8a25', 'b8b24', 'c8c35', , 'e8c66', 'f8f26', 'g8a25', 'h8b24', , , , , , , , , 'a2f24', 'b2f24',
-        ,
-        , , 'a5b43', 'a5b43', 'a5b54', 'a3e35', , 'c3e35', , 'a5b44', , 'g3f24', 'h3h25', , 'b4e45', 'a5b45', , 'a5b44', 'f4f24', , 'h4f24', , 'b5b25',
-        'c5f24', , 'a5b45', 'f5f24', 'g5g25', , 'a6e66', 'b6f24', 'c6e45', , 'a5b45', 'f6f24', 'g6g25', 'h6h25', 'a7f24', 'b7e45', 'c7h25', , 'a5b45',
-        'f7f24', 'g7g25', 'h7h25', 'a8e45', 'b8h25', 'c8e86', , 'a5b45', 'f8f24', 'g8g25', 'h8h25', , , , , , , , , 'a2f24', 'b2f24', , , , 'b5c43', 'b5c43',
-        'b5c54', 'a3e35', , 'c3e35', , 'b5c44', , 'g3h24', 'h3h24', , 'b4e45', 'b5b45', , 'b5c44', 'b5c44', , 'h4h24', 'a5a25', , 'c5f24', , 'e5h24', 'f5f24',
-        'g5g24', , 'a6a25', 'b6f24', 'c6g24', , 'b5c45', 'f6f24', 'g6g24', 'h6h24', 'a7f24', 'b7g24', 'c7h24', , 'b5c45', 'f7f24', 'g7g24', 'h7h24',
-        'a8g24', 'b8h24', 'b5c46', , 'b5c45', 'f8f24', 'g8g24', 'h8h24', , , , , , , , , 'c5d43', 'c5d43', , , , 'c5d43', 'c5d43', 'c5d43', 'a3e35', , 'c3e35',
-        ,
-        'c5c44', , 'g3h24', 'h3h24', , 'b4e45', 'c5d44', , 'c5d44', 'c5c44', , 'h4h24', 'a5a25', 'b5b25', , , 'e5h24', 'f5f24', 'g5g24', , 'c5d44', 'b6b25',
-        'c5d44', , 'c5d44', 'f6f24', 'c5d44', 'h6h24', 'a7a25', 'b7g24', 'c7h24', , 'c5d45', 'f7f24', 'g7g24', 'h7h24', 'a8g24', 'b8h24', 'c5d45',
-        ,
-        'c5d45', 'f8f24', 'c5d44', 'h8h24', , , , , , , , , 'd5e43', 'd5e43', , , , 'd5d43', 'd5d43', 'd5d43', 'a3b24', , 'c3b24', , 'd5c44', , 'g3h24', 'h3h24',
-        ,
-        'b4b24', 'c4a24', , 'd5d44', 'd5c44', , 'h4h24', 'a5a24', 'b5b24', 'c5f24', , 'e5h24', 'f5f24', 'g5g24', , 'a6a24', 'b6f24', 'd5d44', 'd6h24',
-        'd5d44', 'f6f24', 'd5d44', 'h6h24', 'a7f24', 'b7b24', 'c7h24', 'd5d45', 'd5e45', 'f7f24', 'g7g24', 'h7h24', 'a8a24', 'b8h24', 'c8c45', 'd5d45',
-        'd5d45', 'f8f24', 'd5d44', 'h8h24', , , , , , , , , 'e5f43', 'e5f43', , , , 'e5d43', 'e5d43', 'e5d43', 'a3b24', , 'c3b24', , 'e3f24', , 'g3h24', 'h3h24',
-        ,
-        'b4b24', 'c4a24', , 'e4g24', 'f4h24', , 'h4h24', 'a5a24', 'b5b24', 'c5f24', , , 'f5f24', 'g5g24', , 'a6a24', 'b6f24', 'c6g24', , 'e5d44', 'f6f24',
-        'e5d44', 'h6h24', 'a7f24', 'b7g24', 'c7c45', , 'e5e45', 'f7f24', 'g7g24', 'h7h24', 'a8g24', 'b8b24', 'c8c45', , 'e5d45', 'f8f24', 'e5d44',
-        'h8h24', , , , , , , , , 'f5f43', 'f5f43', , , , 'f2b24', 'f5e44', 'f5e44', 'a3b24', , 'c3b24', , 'e3f25', , 'g3h25', 'h3h25', , 'b4b24', 'c4a24', , 'e4g25',
-        'f4h25', , 'h4h25', 'a5a24', 'b5b24', 'c5f25', , 'e5b24', , 'g5g25', , 'a6a24', 'b6b24', 'c6g25', , 'e6a24', 'f6b24', 'g6g25', 'h6h25', 'a7a24',
-        'b7b24', 'c7h25', , 'f5e45', 'f7a24', 'g7b24', 'h7h25', 'a8a24', 'b8b24', 'c8c45', , 'e8e36', 'f5e45', 'g8a24', 'h8b24', , , , , , , , , 'g5f43',
-        'g5f43', , , , 'f2b24', 'g2b24', 'h2b24', 'a3b24', , 'c3b24', , 'e3f25', , 'g3h25', 'h3h25', , 'b4b24', 'g5g44', , 'e4g25', 'f4h25', , 'h4h25',
-        'a5c35', 'b5b24', 'c5f25', , 'e5b24', 'f5f25', , , 'a6c45', 'b6b24', 'c6g25', , 'e6c45', 'f6b24', 'g5f47', 'h6h25', 'a7f25', 'b7b24', 'c7h25',
-        ,
-        'e7c56', 'f7f25', 'g7b24', 'h7h25', 'a8g25', 'b8b24', 'c8c45', , 'e8f87', 'f8f25', 'g8c45', 'h8b24', , , , , , , , , 'a2b24', 'h5h44', , , , 'f2b24',
-        'g2b24', 'h2b24', 'a3b24', , 'c3b24', , 'e3f26', , 'g3h26', 'h3h26', , 'b4b24', 'h5g44', , 'e4g26', 'f4h26', , 'h4h26', 'a5a25', 'b5b24', 'c5f26',
-        ,
-        'e5b24', 'f5f26', 'g5g26', , 'a6a25', 'b6b24', 'c6g26', , 'e6a25', 'f6b24', 'g6g26', 'h6c67', 'a7a25', 'b7b24', 'c7h26', , 'e7c56', 'f7a25',
-        'g7b24', 'h7e47', 'a8a25', 'b8b24', 'c8c56', , 'e8e47', 'f8f26', 'g8a25', 'h8b24', , , , , , , , , 'a2f25', 'a6b55', , , , 'a6b54', 'a6b54', 'a6b54',
-        'a3e36', , 'c3e36', , 'a6b55', , 'g3g25', 'h3g25', , 'b4e46', 'a6b56', , 'a6b55', 'a6b55', , 'h4f25', 'a5a26', 'b5b26', 'c5f25', , 'a6b56', 'f5f25',
-        'g5g25', , , 'b6f25', 'c6g25', , 'a6b56', 'f6f25', 'g6g25', 'h6h26', 'a7f25', 'b7g25', 'c7h26', , 'a6b56', 'f7f25', 'g7g25', 'h7h26', 'a8g25',
-        'b8h26', 'a6b57', , 'a6b56', 'f8f25', 'g8g25', 'h8h26', , , , , , , , , 'a2f25', 'b2f25', , , , 'b6c54', 'b6c54', 'b6c54', 'a3e36', , 'c3e36', , 'b6c55',
-        ,
-        'g3h25', 'h3h25', , 'b4e46', 'b6c56', , 'b6c55', 'b6c55', , 'h4h25', 'a5a26', 'b5b26', 'c5f25', , 'e5h25', 'f5f25', 'g5g25', , 'a6a26', , 'c6g25',
-        ,
-        'b6c56', 'f6f25', 'g6g25', 'h6h25', 'a7a26', 'b7g25', 'c7h25', , 'b6c56', 'f7f25', 'g7g25', 'h7h25', 'a8g25', 'b8h25', 'b6c57', , 'b6c56',
-        'f8f25', 'g8g25', 'h8h25', , , , , , , , , 'c6d54', 'c6d54', , , , 'c6d54', 'c6d54', 'c6d54', 'a3b25', , 'c3b25', , 'c6d55', , 'g3h25', 'h3h25', , 'b4b25',
-        'c4a25', , 'c6d55', 'c6d55', , 'h4h25', 'a5a25', 'b5b25', 'c5f25', , 'e5h25', 'f5f25', 'g5g25', , 'a6a25', 'b6f25', , , 'e6a25', 'f6f25', 'g6g25',
-        'c6d55', 'a7f25', 'b7b25', 'c7h25', , 'c6d56', 'f7f25', 'g7g25', 'h7h25', 'a8a25', 'b8h25', 'c6d56', , 'c6d56', 'f8f25', 'g8g25', 'h8h25',
-        ,
-        , , , , , , , 'd6e54', 'd6e54', , , , 'd6e54', 'd6e54', 'd6e54', 'a3b25', , 'c3b25', , 'd6d55', , 'g3h25', 'h3h25', , 'b4b25', 'c4a25', , 'd6e55', 'd6d55',
-        ,
-        'h4h25', 'a5a25', 'b5b25', 'c5f25', , 'e5h25', 'f5f25', 'g5g25', , 'a6a25', 'b6f25', 'c6g25', , 'e6a25', 'f6f25', 'g6g25', 'd6d55', 'a7f25',
-        'b7g25', 'c7c36', 'd6d56', 'd6e56', 'f7f25', 'g7g25', 'h7h25', 'a8g25', 'b8b25', 'c8c36', 'd6e56', 'd6e56', 'f8f25', 'g8g25', 'h8h25', ,
-        ,
-        , , , , , , 'e6f54', 'e6f54', , , , 'e6e54', 'e6e54', 'e6e54', 'a3b25', , 'c3b25', , 'e3f25', , 'g3h25', 'h3h25', , 'b4b25', 'c4a25', , 'e4g25', 'e6d55',
-        ,
-        'h4h25', 'a5a25', 'b5b25', 'c5f25', , 'e5h25', 'f5f25', 'g5g25', , 'a6a25', 'b6f25', 'c6g25', , , 'f6f25', 'g6g25', 'e6d55', 'a7f25', 'b7g25',
-        'c7h25', , 'e6e56', 'f7f25', 'g7g25', 'h7h25', 'a8g25', 'b8h25', 'c8c36', , 'e6e56', 'f8f25', 'g8g25', 'h8h25', , , , , , , , , 'f6f54', 'f6g54',
-        ,
-        , , 'f6e54', 'f6e54', 'f6e54', 'a3b25', , 'c3b25', , 'e3f25', , 'g3h25', 'h3h25', , 'b4b25', 'c4a25', , 'e4g25', 'f4h25', , 'h4h25', 'a5a25',
-        'b5b25', 'c5f25', , 'e5h25', 'f5f25', 'g5g25', , 'a6a25', 'b6f25', 'c6g25', , 'e6a25', , 'g6g25', 'h6h25', 'a7f25', 'b7g25', 'c7h25', , 'f6e56',
-        'f7a25', 'g7g25', 'h7h25', 'a8g25', 'b8h25', 'c8c36', , 'f6e56', 'f6e56', 'g8g25', 'h8h25', , , , , , , , , 'g6f54', 'g6h54', , , , 'f2b25', 'g2b25',
-        'g6g55', 'a3b25', , 'c3b25', , 'e3f26', , 'g3h26', 'h3h26', , 'b4b25', 'c4a25', , 'e4g26', 'f4h26', , 'h4h26', 'a5a25', 'b5b25', 'c5f26', , 'e5b25',
-        'f5f26', 'g5g26', , 'a6a25', 'b6b25', 'c6g26', , 'e6a25', 'f6b25', , 'h6h26', 'a7a25', 'b7b25', 'c7h26', , 'e7c57', 'f7a25', 'g7b25', 'h7h26',
-        'a8a25', 'b8b25', 'c8c36', , 'e8b57', 'f8f26', 'g8a25', 'h8b25', , , , , , , , , 'a2b25', 'h6h54', , , , 'f2b25', 'g2b25', 'h2b25', 'a3b25', , 'c3b25',
-        ,
-        'e3c36', , 'g3c36', 'h3c36', , 'b4b25', 'c4a25', , 'e4g27', 'f4h27', , 'h4h27', 'a5a25', 'b5b25', 'c5c36', , 'e5b25', 'f5f27', 'g5g27', , 'a6a25',
-        'b6b25', 'c6c36', , 'e6a25', 'f6b25', 'g6g27', , 'a7a25', 'b7b25', 'c7c36', , 'e7c57', 'f7a25', 'g7b25', 'h6g58', 'a8a25', 'b8b25', 'c8c36',
-        ,
-        'e8f88', 'f8f27', 'g8a25', 'h8b25', , , , , , , , , 'a2f26', 'a7b76', , , , 'a7b65', 'a7b65', 'a7b65', 'a3e37', , 'a7b67', , 'a7b66', , 'g3h26', 'h3h26',
-        ,
-        'b4b27', 'c4a27', , 'a7b66', 'f4h26', , 'h4h26', 'a5a27', 'b5b27', 'c5f26', , 'e5h26', 'f5f26', 'g5g26', , 'a6a27', 'b6f26', 'c6g26', , 'a7b67',
-        'f6f26', 'g6g26', 'h6h26', , 'b7g26', 'c7h26', , 'a7b67', 'f7f26', 'g7g26', 'h7h26', 'a8g26', 'b8h26', 'a7b68', , 'a7b67', 'f8f26', 'g8g26',
-        'h8h26', , , , , , , , , 'b7c65', 'b7c65', , , , 'b7c65', 'b7c65', 'b7c65', 'a3b26', , 'c3b26', , 'b7c66', , 'g3h26', 'h3h26', , 'b4b26', 'c4a26', , 'b7c66',
-        'f4h26', , 'h4h26', 'a5a26', 'b5b26', 'c5f26', , 'e5h26', 'f5f26', 'g5g26', , 'a6a26', 'b6f26', 'c6g26', , 'e6a26', 'f6f26', 'g6g26', 'h6h26',
-        'a7f26', , 'c7h26', , 'b7c67', 'f7f26', 'g7g26', 'h7h26', 'a8a26', 'b8h26', 'b7c68', , 'b7c67', 'f8f26', 'g8g26', 'h8h26', , , , , , , , , 'c7d65',
-        'c7d65', , , , 'c7d65', 'c7d65', 'c7d65', 'a3b26', , 'c3b26', , 'c7d66', , 'g3h26', 'h3h26', , 'b4b26', 'c4a26', , 'c7d66', 'f4h26', , 'h4h26',
-        'a5a26', 'b5b26', 'c5f26', , 'e5h26', 'f5f26', 'g5g26', , 'a6a26', 'b6f26', 'c6g26', , 'e6a26', 'f6f26', 'g6g26', 'h6h26', 'a7f26', 'b7g26',
-        ,
-        , 'c7d67', 'f7f26', 'g7g26', 'h7h26', 'a8g26', 'b8b26', 'c7d78', , 'c7d67', 'f8f26', 'g8g26', 'h8h26', , , , , , , , , 'd7e65', 'd7e65', , , , 'd7e65',
-        'd7e65', 'd7e65', 'a3b26', , 'c3b26', , 'd7e66', , 'g3h26', 'h3h26', , 'b4b26', 'c4a26', , 'd7d66', 'f4h26', , 'h4h26', 'a5a26', 'b5b26', 'c5f26',
-        ,
-        'e5h26', 'f5f26', 'g5g26', , 'a6a26', 'b6f26', 'c6g26', , 'e6a26', 'f6f26', 'g6g26', 'h6h26', 'a7f26', 'b7g26', 'c7h26', , 'd7d67', 'f7f26',
-        'g7g26', 'h7h26', 'a8g26', 'b8h26', 'c8c37', 'd7e67', 'd7d67', 'f8f26', 'g8g26', 'h8h26', , , , , , , , , 'e7f65', 'e7f65', , , , 'e7f65', 'e7f65',
-        'e7f65', 'a3b26', , 'c3b26', , 'e3f26', , 'g3h26', 'h3h26', , 'b4b26', 'c4a26', , 'e4g26', 'f4h26', , 'h4h26', 'a5a26', 'b5b26', 'c5f26', , 'e5h26',
-        'f5f26', 'g5g26', , 'a6a26', 'b6f26', 'c6g26', , 'e6a26', 'f6f26', 'g6g26', 'h6h26', 'a7f26', 'b7g26', 'c7h26', , , 'f7f26', 'g7g26', 'h7h26',
-        'a8g26', 'b8h26', 'c8c37', , 'e7d67', 'f8f26', 'g8g26', 'h8h26', , , , , , , , , 'f7g65', 'f7g65', , , , 'f7f65', 'f7f65', 'f7f65', 'a3b26', , 'c3b26',
-        ,
-        'e3f26', , 'g3h26', 'h3h26', , 'b4b26', 'c4a26', , 'e4g26', 'f4h26', , 'h4h26', 'a5a26', 'b5b26', 'c5f26', , 'e5h26', 'f5f26', 'g5g26', , 'a6a26',
-        'b6f26', 'c6g26', , 'e6a26', 'f6f26', 'g6g26', 'h6h26', 'a7f26', 'b7g26', 'c7h26', , 'e7e37', , 'g7g26', 'h7h26', 'a8g26', 'b8h26', 'c8c37',
-        ,
-        'e8e37', 'f7g68', 'g8g26', 'h8h26', , , , , , , , , 'g7h65', 'g7h65', , , , 'g7f65', 'g7f65', 'g7f65', 'a3b26', , 'c3b26', , 'e3f26', , 'g3h26', 'h3h26',
-        ,
-        'b4b26', 'c4a26', , 'e4g26', 'f4h26', , 'h4h26', 'a5a26', 'b5b26', 'c5f26', , 'e5h26', 'f5f26', 'g5g26', , 'a6a26', 'b6f26', 'c6g26', , 'e6a26',
-        'f6f26', 'g6g26', 'h6h26', 'a7f26', 'b7g26', 'c7h26', , 'e7e48', 'f7f26', , 'h7h26', 'a8g26', 'b8h26', 'c8c37', , 'e8e48', 'f8f26', 'g8a26',
-        'h8h26', , , , , , , , , 'h7h65', 'h7h65', , , , 'f2b26', 'g2b26', 'h2b26', 'a3b26', , 'c3b26', , 'e3f27', , 'g3h27', 'h3h27', , 'b4b26', 'c4a26', , 'e4g27',
-        'f4h27', , 'h4h27', 'a5a26', 'b5b26', 'c5f27', , 'e5b26', 'f5f27', 'g5g27', , 'a6a26', 'b6b26', 'c6g27', , 'e6a26', 'f6b26', 'g6g27', 'h6h27',
-        'a7a26', 'b7b26', 'c7h27', , 'e7e38', 'f7a26', 'g7b26', , 'a8a26', 'b8b26', 'c8c37', , 'e8e38', 'f8f27', 'g8a26', 'h8b26', , , , , , , , , 'a8b76',
-        'a8b76', , , , 'a8b76', 'a8b76', 'a8b76', 'a3b27', , 'c3b27', , 'a8b77', , 'g3h27', 'h3h27', , 'b4b27', 'c4a27', , 'e4g27', 'f4h27', , 'h4h27',
-        'a5a27', 'b5b27', 'c5f27', , 'e5h27', 'f5f27', 'g5g27', , 'a6a27', 'b6f27', 'c6g27', , 'e6a27', 'f6f27', 'g6g27', 'h6h27', 'a7f27', 'b7g27',
-        'c7h27', , 'a8b78', 'f7f27', 'g7g27', 'h7h27', , 'b8h27', 'a8b79', , 'a8b78', 'f8f27', 'g8g27', 'h8h27', , , , , , , , , 'b8c76', 'b8c76', , , , 'b8c76',
-        'b8c76', 'b8c76', 'a3b27', , 'b8c77', , 'b8c77', , 'g3h27', 'h3h27', , 'b4b27', 'c4a27', , 'e4g27', 'f4h27', , 'h4h27', 'a5a27', 'b5b27', 'c5f27',
-        ,
-        'e5h27', 'f5f27', 'g5g27', , 'a6a27', 'b6f27', 'c6g27', , 'e6a27', 'f6f27', 'g6g27', 'h6h27', 'a7f27', 'b7g27', 'c7h27', , 'b8c78', 'f7f27',
-        'g7g27', 'h7h27', 'a8g27', , 'c8c38', , 'b8c78', 'f8f27', 'g8g27', 'h8h27', , , , , , , , , 'c8d76', 'c8d76', , , , 'c8d76', 'c8d76', 'c8d76', 'a3b27',
-        ,
-        'c3b27', , 'c8d77', , 'g3h27', 'h3h27', , 'b4b27', 'c4a27', , 'e4g27', 'f4h27', , 'h4h27', 'a5a27', 'b5b27', 'c5f27', , 'e5h27', 'f5f27', 'g5g27',
-        ,
-        'a6a27', 'b6f27', 'c6g27', , 'e6a27', 'f6f27', 'g6g27', 'h6h27', 'a7f27', 'b7g27', 'c7h27', , 'c8d78', 'f7f27', 'g7g27', 'h7h27', 'a8g27',
-        'b8h27', , , 'c8d78', 'f8f27', 'g8g27', 'h8h27', , , , , , , , , 'd8e76', 'd8e76', , , , 'd8e76', 'd8e76', 'd8e76', 'a3b27', , 'c3b27', , 'd8e77', , 'g3h27',
-        'h3h27', , 'b4b27', 'c4a27', , 'e4g27', 'f4h27', , 'h4h27', 'a5a27', 'b5b27', 'c5f27', , 'e5h27', 'f5f27', 'g5g27', , 'a6a27', 'b6f27', 'c6g27',
-        ,
-        'e6a27', 'f6f27', 'g6g27', 'h6h27', 'a7f27', 'b7g27', 'c7h27', , 'd8d78', 'f7f27', 'g7g27', 'h7h27', 'a8g27', 'b8h27', 'c8c38', , 'd8e78',
-        'f8f27', 'g8g27', 'h8h27', , , , , , , , , 'e8f76', 'e8f76', , , , 'e8f76', 'e8f76', 'e8f76', 'a3b27', , 'c3b27', , 'e3f27', , 'g3h27', 'h3h27', , 'b4b27',
-        'c4a27', , 'e4g27', 'f4h27', , 'h4h27', 'a5a27', 'b5b27', 'c5f27', , 'e5h27', 'f5f27', 'g5g27', , 'a6a27', 'b6f27', 'c6g27', , 'e6a27', 'f6f27',
-        'g6g27', 'h6h27', 'a7f27', 'b7g27', 'c7h27', , 'e7e48', 'f7f27', 'g7g27', 'h7h27', 'a8g27', 'b8h27', 'c8c38', , , 'f8f27', 'g8g27', 'h8h27',
-        ,
-        , , , , , , , 'f8g76', 'f8g76', , , , 'f8g76', 'f8g76', 'f8g76', 'a3b27', , 'c3b27', , 'e3f27', , 'g3h27', 'h3h27', , 'b4b27', 'c4a27', , 'e4g27', 'f4h27',
-        ,
-        'h4h27', 'a5a27', 'b5b27', 'c5f27', , 'e5h27', 'f5f27', 'g5g27', , 'a6a27', 'b6f27', 'c6g27', , 'e6a27', 'f6f27', 'g6g27', 'h6h27', 'a7f27',
-        'b7g27', 'c7h27', , 'e7e38', 'f7f27', 'g7g27', 'h7h27', 'a8g27', 'b8h27', 'c8c38', , 'e8e38', , 'g8g27', 'h8h27', , , , , , , , , 'g8h76', 'g8h76',
-        ,
-        , , 'g8g76', 'g8g76', 'g8g76', 'a3b27', , 'c3b27', , 'e3f27', , 'g3h27', 'h3h27', , 'b4b27', 'c4a27', , 'e4g27', 'f4h27', , 'h4h27', 'a5a27',
-        'b5b27', 'c5f27', , 'e5h27', 'f5f27', 'g5g27', , 'a6a27', 'b6f27', 'c6g27', , 'e6a27', 'f6f27', 'g6g27', 'h6h27', 'a7f27', 'b7g27', 'c7h27',
-        ,
-        'e7e38', 'f7f27', 'g7g27', 'h7h27', 'a8g27', 'b8h27', 'c8c38', , 'e8e38', 'f8f27', , 'h8h27', , , , , , , , , 'h8h76', 'h8h76', , , , 'h8g76', 'h8g76',
-        'h8g76', 'a3b27', , 'c3b27', , 'e3f27', , 'g3h27', 'h3h27', , 'b4b27', 'c4a27', , 'e4g27', 'f4h27', , 'h4h27', 'a5a27', 'b5b27', 'c5f27', , 'e5h27',
-        'f5f27', 'g5g27', , 'a6a27', 'b6f27', 'c6g27', , 'e6a27', 'f6f27', 'g6g27', 'h6h27', 'a7f27', 'b7g27', 'c7h27', , 'e7e39', 'f7f27', 'g7g27',
-        'h7h27', 'a8g27', 'b8h27', 'c8c38', , 'e8e39', 'f8f27', 'g8g27', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , 'e1b43', 'f1d33', 'g1g34', 'h1h34', , , , , , , , , , , , 'd1d23', 'e3d33', 'f3d33', 'g3d33', 'h3d33', 'a4b43', , 'c4d33', , 'e4d33',
-        'f4b43', 'g4b43', 'h4b43', 'a5b43', , 'c5b43', 'd5d33', , 'f5d33', 'd1d24', 'd1d24', 'a6d33', , 'c6f34', 'd6d33', 'd1d24', , 'g6d33', 'h6h34',
-        'a7d44', , 'c7g34', 'd7d33', 'e7b43', 'd1d24', , 'h7d33', 'a8f34', , 'c8h34', 'd8d33', 'd1d24', 'f8b43', 'd1d24', , , , , 'e1d24', , 'e1d24', 'e1d25',
-        'e1d25', , , , , , , , , , , , 'e1d13', 'e1d14', 'e1d14', 'e1d14', 'e1d14', 'e1d23', , 'e1d14', , 'e1e25', 'e1e25', 'e1d25', 'e1d25', 'e1d24', , 'e1d24',
-        'e1d24', , 'e1d24', 'e1d24', 'e1d24', 'e1d24', , 'e1d24', 'd6d35', 'e1d24', , 'e1d25', 'e1d25', 'a7c55', , 'c7c55', 'e1d24', 'e1d25', 'e1d24',
-        ,
-        'e1d25', 'a8a45', , 'c8c55', 'd8d35', 'e1d24', 'e1d25', 'e1d24', , , , , 'd1d36', 'e1b45', , 'f1e26', 'f1e26', , , , , , , , , , , , 'f1e15', 'e3e46',
-        'f1f26', 'f1e16', 'f1e16', 'a4b45', , 'c4b45', , 'e4b45', 'f1e25', 'g4b45', 'h4b45', 'a5b45', , 'c5b45', 'd5e46', , 'f1e26', 'f1e26', 'f1e26',
-        'a6c66', , 'f1e25', 'd6b45', 'e6e46', , 'f1e26', 'f1e26', 'a7c56', , 'f1e25', 'd7d46', 'e7b45', 'f1e26', , 'f1e26', 'a8c66', , 'c8c66', 'd8d46',
-        'e8e46', 'f8b45', 'f1e26', , , , , 'd1d37', 'e1b46', 'f1f47', , 'g1f17', , , , , , , , , , , , 'g1f16', 'g1f16', 'g1f26', 'g1f17', 'g1f17', 'g1f25', ,
-        'c4b46', , 'e4b46', 'f4b46', 'g4b46', 'h4b46', 'a5b46', , 'c5b46', 'd5e47', , 'f5f47', 'g1f27', 'g1f27', 'a6c67', , 'g1f16', 'd6b46', 'e6e47',
-        ,
-        'g1f17', 'g1f27', 'a7c77', , 'c7f47', 'd7d47', 'e7b46', 'f7f47', , 'g1f17', 'a8c67', , 'c8c77', 'd8d47', 'e8e47', 'f8b46', 'g1f27', , , , , 'd1a47',
-        'e1b47', 'f1f38', 'g1g38', , , , , , , , , , , , , 'h1g17', 'e3e48', 'f3f48', 'g3f38', 'h1g18', 'a4b47', , 'c4b47', , 'e4b47', 'f4b47', 'g4b47', 'h4b47',
-        'a5b47', , 'c5b47', 'd5e48', , 'f5f48', 'g5g38', 'h1g18', 'a6a47', , 'c6a47', 'd6b47', 'e6e48', , 'g6g38', 'h1g18', 'a7a47', , 'h1g17', 'd7a47',
-        'e7b47', 'f7f48', , 'h1g18', 'a8a47', , 'c8c68', 'd8d48', 'e8a47', 'f8b47', 'g8g38', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , 'd1a43', 'd2d34', 'f1d33', 'g1b63', 'h1b73', , , , , 'e2d33', 'f2b63', 'g2b73', 'h2b83', , , , 'd2d13', 'e3d33',
-        'f3d33', 'g3d33', 'h3d33', 'a4b53', , 'c4d33', , 'e4d33', 'f4b43', 'g4b43', 'h4b43', 'a5b63', , 'c5b43', 'd5d33', , 'f5d33', 'g5b53', 'h5b53',
-        'a6b73', , 'c6b53', 'd6d33', 'e6b63', , 'g6d33', 'h6b63', 'a7b83', , 'c7b63', 'd7d33', 'e7b43', 'f7b73', , 'h7d33', 'a8b83', , 'c8b73', 'd8d33',
-        'e8b53', 'f8b43', 'g8b83', , , , , 'e2d24', 'e1b44', 'e2d24', 'e2d34', 'e2d34', , , , , , 'e2d34', 'e2d34', 'e2d34', , , , 'e2d13', 'e2d14', 'e2d14',
-        'e2d14', 'e2d14', 'e2d23', , 'c4b44', , 'e2d34', 'e2d34', 'g4b44', 'h4b44', 'a5b44', , 'c5b44', 'e2d24', , 'e2d24', 'e2d24', 'e2d24', 'e2d24',
-        ,
-        'e2d24', 'd6b44', 'e2d24', , 'e2d34', 'e2d34', 'e2d34', , 'e2d34', 'e2d24', 'e2d34', 'e2d24', , 'e2d34', 'e2d34', , 'e2d34', 'e2d34', 'e2d24',
-        'e2d34', 'e2d24', , , , , 'd1a45', 'e1b45', 'f1d36', 'f2e26', 'f2e26', , , , , , , 'f2e26', 'f2e26', , , , 'f2e15', 'e3e46', 'f2e16', 'f2e16', 'f2e16',
-        'a4b45', , 'c4b45', , 'e4b45', 'f2e25', 'g4b45', 'h4b45', 'a5b45', , 'c5b45', 'd5e46', , 'f2e26', 'f2e26', 'f2e26', 'a6a45', , 'c6a45', 'd6b45',
-        'e6e46', , 'f2e26', 'f2e26', 'a7a45', , 'f2e25', 'd7a45', 'e7b45', 'f2e26', , 'f2e26', 'a8a45', , 'c8c66', 'd8d46', 'e8a45', 'f8b45', 'f2e26',
-        ,
-        , , , 'd1d37', 'e1b46', 'f1f47', 'g1d17', 'g2f17', , , , , , , , 'g2f27', , , , 'g2f16', 'g2f16', 'g2f26', 'g2f17', 'g2f17', 'g2f25', , 'c4b46', , 'e4b46',
-        'f4b46', 'g4b46', 'h4b46', 'a5b46', , 'c5b46', 'd5e47', , 'f5f47', 'g2f27', 'g2f27', 'a6b77', , 'g2f16', 'd6b46', 'e6e47', , 'g2f17', 'g2f27',
-        'a7b87', , 'c7f47', 'd7d47', 'e7b46', 'f7f47', , 'g2f17', 'a8b87', , 'c8c77', 'd8d47', 'e8e47', 'f8b46', 'g2f27', , , , , 'd1a47', 'e1b47', 'f1f38',
-        'g1g38', 'h1f38', , , , , , , , , , , , 'h2g17', 'e3e48', 'f3f48', 'g3f38', 'h2g18', 'a4b47', , 'c4b47', , 'e4b47', 'f4b47', 'g4b47', 'h4b47', 'a5b47',
-        ,
-        'c5b47', 'd5e48', , 'f5f48', 'g5g38', 'h2g18', 'a6a47', , 'c6a47', 'd6b47', 'e6e48', , 'g6g38', 'h2g18', 'a7a47', , 'h2g17', 'd7a47', 'e7b47',
-        'f7f48', , 'h2g18', 'a8a47', , 'c8c68', 'd8d48', 'e8a47', 'f8b47', 'g8g38', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , 'd1a43', 'e1b43', 'd3d24', 'g1b63', 'h1b73', , , , , , , , , , , , , 'e3b63', 'f3b73', 'g3b83', 'd3d24', 'a4b53', , 'c4b43',
-        ,
-        'e4b43', 'f4b43', 'g4b43', 'h4b43', 'a5b63', , 'c5b43', 'd5b53', , 'f5b53', 'g5b53', 'h5b53', 'a6b73', , 'c6b53', 'd6b43', 'e6b63', , 'g6b63',
-        'h6b63', 'a7b83', , 'c7b63', 'd7b53', 'e7b43', 'f7b73', , 'h7b73', 'a8b83', , 'c8b73', 'd8b63', 'e8b53', 'f8b43', 'g8b83', , , , , 'e3d24', 'e1b44',
-        'e3d24', 'e3d34', 'e3d34', , , , , , , , , , , , 'e3d23', , 'e3d24', 'e3d24', 'e3d24', 'e3d23', , 'c4b44', , 'e3d34', 'e3d34', 'g4b44', 'h4b44', 'a5b44',
-        ,
-        'c5b44', 'e3d24', , 'e3d24', 'e3d24', 'e3d24', 'e3d24', , 'e3d24', 'd6b44', 'e3d24', , 'e3d34', 'e3d34', 'e3d34', , 'e3d34', 'e3d24', 'e3d34',
-        'e3d24', , 'e3d34', 'e3d34', , 'e3d34', 'e3d34', 'e3d24', 'e3d34', 'e3d24', , , , , 'd1a45', 'e1b45', 'f1d36', 'f3e26', 'f3e26', , , , , , , , , , , ,
-        'f3e25', 'e3e46', , 'f3f46', 'f3e26', 'a4b45', , 'c4b45', , 'e4b45', 'f3e25', 'g4b45', 'h4b45', 'a5b45', , 'c5b45', 'd5e46', , 'f3e26', 'f3e26',
-        'f3e26', 'a6a45', , 'c6a45', 'd6b45', 'e6e46', , 'f3e26', 'f3e26', 'a7a45', , 'f3e25', 'd7a45', 'e7b45', 'f3e26', , 'f3e26', 'a8a45', , 'c8c66',
-        'd8d46', 'e8a45', 'f8b45', 'f3e26', , , , , 'd1d37', 'e1b46', 'f1f47', 'g1d17', 'g3f27', , , , , , , , , , , , 'g3f26', 'g3f26', 'g3f26', , 'g3f27', 'g3f25',
-        ,
-        'c4b46', , 'e4b46', 'f4b46', 'g4b46', 'h4b46', 'a5b46', , 'c5b46', 'd5e47', , 'f5f47', 'g3f27', 'g3f27', 'a6b77', , 'g3f26', 'd6b46', 'e6e47',
-        ,
-        'g3f27', 'g3f27', 'a7b87', , 'c7f47', 'd7d47', 'e7b46', 'f7f47', , 'g3f27', 'a8b87', , 'c8c77', 'd8d47', 'e8e47', 'f8b46', 'g3f27', , , , , 'd1a47',
-        'e1b47', 'f1f38', 'g1g38', 'h1f38', , , , , , , , , , , , 'h3g27', 'e3e48', 'f3f48', 'g3f38', , 'a4b47', , 'c4b47', , 'e4b47', 'f4b47', 'g4b47', 'h4b47',
-        'a5b47', , 'c5b47', 'd5e48', , 'f5f48', 'g5g38', 'h3g28', 'a6a47', , 'c6a47', 'd6b47', 'e6e48', , 'g6g38', 'h3g28', 'a7a47', , 'h3g27', 'd7a47',
-        'e7b47', 'f7f48', , 'h3g28', 'a8a47', , 'c8c68', 'd8d48', 'e8a47', 'f8b47', 'g8g38', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , 'd4c43', 'd4d34', 'd4d34', 'd4d34', 'd4d34', , , , , , , , , , , , 'd3e44', 'd4d34', 'd4d34', 'd4d34', 'd4c44', , ,
-        ,
-        , 'd4d34', 'd4d34', 'd4c44', 'd4c44', , , , , 'd4d34', 'd4d34', 'd4d34', 'd4d34', , , , , , 'd4d34', 'd4d34', 'd4d34', , , , , , , 'd4d34', 'd4d34',
-        ,
-        , , , , , , 'd4d34', , , , 'e4d34', 'e1b44', 'e4d34', 'e4d34', 'e4d34', , , , , , , , , , , , 'e4d44', 'e4d34', 'e4d34', 'e4d34', 'e4d35', 'e4d33', , 'c4b44',
-        ,
-        , 'e4d34', 'e4d35', 'e4d35', 'a5b44', , 'c5b44', 'e4d34', , 'e4d34', 'e4d34', 'e4d34', 'e4d34', , 'e4d34', 'd6b44', 'e4d34', , 'e4d34', 'e4d34',
-        'e4d34', , 'e4d34', 'e4d34', 'e4d34', 'e4d34', , 'e4d34', 'e4d34', , 'e4d34', 'e4d34', 'e4d34', 'e4d34', 'e4d34', , , , , 'd1a45', 'e1b45', 'f1f36',
-        'f4e36', 'f4e36', , , , , , , , , , , , 'f4e35', 'e3e46', 'f3g36', 'f4f56', 'f4e36', 'a4b45', , 'c4b45', , 'e4b45', , 'f4e36', 'f4e36', 'a5b45', , 'c5b45',
-        'd5e46', , 'f4e36', 'f4e36', 'f4e36', 'a6a45', , 'c6a45', 'd6b45', 'e6e46', , 'f4e36', 'f4e36', 'a7a45', , 'f4e35', 'd7a45', 'e7b45', 'f4e36',
-        ,
-        'f4e36', 'a8a45', , 'c8c66', 'd8d46', 'e8a45', 'f8b45', 'f4e36', , , , , 'd1d37', 'e1b46', 'f1f47', 'g1d17', 'g4f37', , , , , , , , , , , , 'g4f36',
-        'g4f36', 'g4f46', 'g4f46', 'g4f47', 'g4f35', , 'c4b46', , 'e4b46', 'f4b46', , 'g4f37', 'a5b46', , 'c5b46', 'd5e47', , 'f5f47', 'g4f37', 'g4f37',
-        'a6b77', , 'g4f36', 'd6b46', 'e6e47', , 'g4f37', 'g4f37', 'a7b87', , 'c7f47', 'd7d47', 'e7b46', 'f7f47', , 'g4f37', 'a8b87', , 'c8c77', 'd8d47',
-        'e8e47', 'f8b46', 'g4f37', , , , , 'd1a47', 'e1b47', 'f1f38', 'g1g38', 'h1f38', , , , , , , , , , , , 'h4g37', 'e3e48', 'f3f48', 'g3f38', 'h3g38', 'a4b47',
-        ,
-        'c4b47', , 'e4b47', 'f4b47', 'g4b47', , 'a5b47', , 'c5b47', 'd5e48', , 'f5f48', 'g5g38', 'h4g38', 'a6a47', , 'c6a47', 'd6b47', 'e6e48', , 'g6g38',
-        'h4g38', 'a7a47', , 'h4g37', 'd7a47', 'e7b47', 'f7f48', , 'h4g38', 'a8a47', , 'c8c68', 'd8d48', 'e8a47', 'f8b47', 'g8g38', , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , 'e5d44', 'e1d25', 'e5d45', 'e5d45', 'e5d45', , , , , , , , , , , , 'e5d44', 'e3d25', 'e5d45', 'e5d45', 'e5d45', , , , , 'e5d44', 'e5d45', 'g4c45',
-        'e5d45', , , , , , 'e5d44', 'e5d45', 'e5d45', , , , , , 'e5d45', 'e5d44', 'e5d45', , , , , , , 'e5d45', 'e5d44', , , , , , , , 'e5d45', , , , 'd1d36', 'e1b45',
-        'f1f36', 'f5e46', 'h1f36', , , , , , , , , , , , 'f5e45', 'e3f36', 'f3g36', 'f5f46', 'f5e46', 'a4b45', , 'c4b45', , 'e4b45', 'f4b45', 'g4b45', 'h4b45',
-        'a5b45', , 'c5b45', 'd5f36', , , 'f5e46', 'f5e46', 'a6c66', , 'f5e45', 'd6b45', 'e6e36', , 'f5e46', 'f5e46', 'a7c56', , 'f5e45', 'd7d46', 'e7b45',
-        'f7c46', , 'f5f47', 'a8c66', , 'c8c66', 'd8d46', 'e8e36', 'f8b45', 'g8g36', , , , , 'd1d37', 'e1b46', 'f1d37', 'g1d47', 'g5f47', , , , , , , , , , , ,
-        'g5f46', 'g5f46', 'g5f46', 'g5f46', 'g5f47', 'g5f45', , 'c4b46', , 'e4b46', 'f4b46', 'g4b46', 'h4b46', 'a5b46', , 'c5b46', 'd5e47', , 'f5e47',
-        ,
-        'g5f47', 'a6c67', , 'g5f46', 'd6b46', 'e6e47', , 'g5f47', 'g5f47', 'a7c77', , 'c7c67', 'd7d47', 'e7b46', 'f7c47', , 'g5f47', 'a8c67', , 'c8c77',
-        'd8d47', 'e8e47', 'f8b46', 'g5f47', , , , , 'd1a47', 'e1b47', 'f1f38', 'g1g38', 'h1f38', , , , , , , , , , , , 'h5g47', 'e3e48', 'f3f48', 'g3f38', 'h3g38',
-        'a4b47', , 'c4b47', , 'e4b47', 'f4b47', 'g4b47', 'h4b47', 'a5b47', , 'c5b47', 'd5e48', , 'f5f48', 'g5g38', , 'a6a47', , 'c6a47', 'd6b47', 'e6e48',
-        ,
-        'g6g38', 'h5g48', 'a7a47', , 'h5g47', 'd7a47', 'e7b47', 'f7f48', , 'h5g48', 'a8a47', , 'c8c68', 'd8d48', 'e8a47', 'f8b47', 'g8g38', , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'd1d36', 'f6e56', 'f1d36', 'f6f57', 'f6e57', , , , ,
-        ,
-        , , , , , , 'f6e55', 'e3d36', 'f3d36', 'f6f56', 'f6e56', , , , , 'e4d36', 'f4c46', 'g4c46', 'h4c46', , , , , , 'f5d36', 'f6f57', 'f6f57', , , , , , , 'g6d36',
-        'f6f57', , , , , , , 'f6f57', 'h7d36', , , , , , , , 'f6f57', , , , 'd1d37', 'e1b47', 'f1d37', 'g1d47', 'h1c67', , , , , , , , , , , , 'g6f56', 'g6f56', 'g6f56',
-        'g6f56', 'g6f57', 'g6f56', , 'g6f56', , 'e4d37', 'f4d47', 'g4d47', 'g6f57', 'a5c77', , 'g6f56', 'd5d47', , 'f5d37', 'g5c57', 'g6f57', 'a6c67',
-        ,
-        'g6f56', 'd6d47', 'e6c47', , , 'g6f57', 'a7c77', , 'c7c67', 'd7d47', 'e7c57', 'f7c47', , 'h7c77', 'a8c67', , 'c8c77', 'd8d47', 'e8c67', 'f8c57',
-        'g6f57', , , , , 'd1d38', 'e1b47', 'f1f38', 'g1g38', 'h1f38', , , , , , , , , , , , 'h6g57', 'e3e48', 'f3g38', 'g3f38', 'h3g38', 'a4b47', , 'c4b47', ,
-        'e4b47', 'f4b47', 'g4b47', 'h4b47', 'a5b47', , 'c5b47', 'd5e48', , 'f5f38', 'g5g38', 'h5f38', 'a6c68', , 'h6g57', 'd6b47', 'e6e48', , 'g6g38',
-        ,
-        'a7c58', , 'h6g57', 'd7d48', 'e7b47', 'f7f38', , 'h6g58', 'a8c68', , 'c8c68', 'd8d48', 'e8e48', 'f8b47', 'g8g38', , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , 'd1d37', 'e1e38', 'f1d37', 'g1g38', 'g7f68', , , , , , , , , , , , 'g7f66', 'e3d37', 'f3d37', 'g3d37', 'g7f67', , , , , 'e4d37', 'f4c47', 'g4c47',
-        'h4c47', , , , , , 'f5d37', 'g5g38', 'g7g68', , , , , , , 'g6d37', 'g7f68', , , , , , , , 'h7d37', , , , , , , , 'g7g68', , , , 'd1d38', 'e1e38', 'f1f38', 'g1g38',
-        'h1f38', , , , , , , , , , , , 'h7g67', 'e3f38', 'f3g38', 'g3f38', 'h3g38', 'h7g67', , 'h7g67', , 'e4f38', 'f4g38', 'g4g38', 'h4g38', 'a5c58', , 'h7g67',
-        'd5f38', , 'f5f38', 'g5g38', 'h5f38', 'a6c68', , 'h7g67', 'd6g38', 'e6e38', , 'g6g38', 'h6e38', 'a7c58', , 'h7g67', 'd7d48', 'e7e38', 'f7f38',
-        ,
-        , 'a8c68', , 'c8c68', 'd8d48', 'e8e38', 'f8f38', 'g8g38', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , 'd1d38', 'e1e39', 'f1d38', 'g1g39', 'h1h39', , , , , , , , , , , , 'h8g77', 'e3d38', 'f3d38', 'g3d38', 'h3d38', , , , , 'e4d38',
-        'f4c48', 'g4c48', 'h4c48', , , , , , 'f5d38', 'g5g39', 'h5h39', , , , , , , 'g6d38', 'h6h39', , , , , , , , 'h7d38', , , , , , , , , , , , , 'e1e35', 'f1f36', 'g1e35',
-        'h1d55', , , , , , , , , 'a3e35', , , , 'a1a25', 'a1a25', 'g3e35', 'h3e35', , 'b4d45', , 'a1a23', , 'a1a25', 'g4d45', 'h4d45', 'a5d55', 'b5d55', , 'a1a25',
-        'e5e35', , 'g5e35', 'h5d55', 'a6d66', 'b6d45', , 'a1a25', 'e6e35', 'f6d45', , 'h6e35', 'a7d45', 'b7d55', , 'a1a25', 'e7e35', 'f7d55', 'g7d45',
-        ,
-        'a8d55', 'b8d66', , 'a1a25', 'e8e35', 'f8f46', 'g8d55', 'h8d45', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , 'a1a35', , , , , 'f1f35', 'g1g35', 'h1h35', , , , , , , , , 'a3b45', , , , 'e1e25', 'e1e25', 'e1e25', 'e1e25', , 'e1e23', , 'd4d55', , 'e1e25',
-        'e1e25', 'e1e25', 'a5d55', 'b5d55', , 'd5f35', 'e5g35', , 'g5g35', 'h5h35', 'a6c45', 'b6d45', , 'd6g35', 'e6h35', 'e1e25', , 'h6h35', 'a7d45',
-        'b7d55', , 'd7h35', 'e7e35', 'f7f35', 'g7g35', , 'a8d55', 'b8g35', , 'd8d55', 'e8e35', 'f8f35', 'g8g35', 'h8h35', 'a1a36', , , , 'e1b45', , 'f1e26',
-        'f1e26', , , , , , , , , 'a3b45', , , , 'f1e15', 'f1e15', 'f1e15', 'f1e15', , 'f1e23', , 'd4b45', , 'f1e25', 'f1e25', 'f1e25', 'a5b45', 'b5b45', , 'f1e15',
-        'e5e46', , 'f1e26', 'f1e26', 'f1e25', 'b6b45', , 'd6b45', 'e6e46', 'f1e25', , 'f1e26', 'f1e25', 'b7b45', , 'd7d46', 'e7b45', 'f1e26', 'f1e26',
-        ,
-        'a8e46', 'b8b45', , 'd8d46', 'e8e46', 'f8b45', 'f1e26', 'f1e26', 'a1a37', , , , 'e1b46', 'f1f37', , 'g1f17', , , , , , , , , 'a3b46', , , , 'e3e47',
-        'f3f47', 'g1f17', 'g1f17', , 'g1g25', , 'd4b46', , 'f4b46', 'g4b46', 'h4b46', 'a5b46', 'g1f25', , 'd5e47', 'e5f47', , 'g1f27', 'g1f27', 'a6c67',
-        'b6b46', , 'd6b46', 'e6g47', 'f6h47', , 'g1f27', 'a7c57', 'b7b46', , 'd7g47', 'e7b46', 'f7f47', 'g1f17', , 'a8c67', 'b8b46', , 'd8h47', 'e8e47',
-        'f8b46', 'g1f27', 'g1f17', 'a1a37', , , , 'e1b47', 'f1b57', 'g1d48', , , , , , , , , , 'a3b47', , , , 'e3a37', 'f3a37', 'g3a37', 'h3a37', , 'h1g25', ,
-        'd4b47', , 'f4b47', 'g4b47', 'h1g17', 'a5b57', 'b5b47', , 'd5b57', 'e5b57', , 'g5b57', 'h5b57', 'a6b57', 'b6b57', , 'd6b47', 'e6e48', 'f6f48',
-        ,
-        'h1g18', 'a7a37', 'b7b57', , 'd7b57', 'e7b47', 'f7f48', 'g7d48', , 'a8a37', 'b8b57', , 'd8d48', 'e8b57', 'f8b47', 'g8c48', 'h1g18', 'a1d43',
-        ,
-        , , 'e1e25', 'f1f35', 'g1d43', 'h1f35', , , , , , , , , 'a3d65', , , , 'e3d43', 'a2a35', 'g3f35', 'h3f35', , 'b4d43', , 'a2a33', , 'f4d43', 'g4d43',
-        'h4d43', 'a5d85', 'b5d75', , 'd5d43', 'e5d43', , 'g5f45', 'h5f35', 'a6d65', 'b6d43', , 'd6d43', 'e6e45', 'f6d43', , 'h6f45', 'a7d43', 'b7d75',
-        ,
-        'd7d43', 'e7e45', 'f7f45', 'g7d43', , 'a8d85', 'b8d85', , 'd8d43', 'e8e45', 'f8f45', 'g8d55', 'h8d43', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a25', , , , 'e1b43', 'f1f35', 'g1g35', 'h1h35', , , , , , 'f2f35', 'g2g35', 'h2h35', 'a3b43',
-        ,
-        , , 'e2e15', 'e2e15', 'e2e15', 'e2e15', , 'e2e33', , 'd4b43', , 'f4b43', 'g4b43', 'h4b43', 'a5b43', 'b5b43', , 'd5e45', 'e5f65', , 'g5h45', 'h5h45',
-        'a6a75', 'b6b43', , 'd6b43', 'e6f65', 'e2e35', , 'h6h45', 'a7c75', 'b7b43', , 'd7g45', 'e7b43', 'f7f65', 'g7g45', , 'a8c65', 'b8b43', , 'd8f65',
-        'e8e45', 'f8b43', 'g8g45', 'h8h45', 'f2e35', , , , 'e1b45', 'f1b55', 'f2e26', 'f2e26', , , , , , , 'f2e26', 'f2e26', 'a3b45', , , , 'f2e15', 'f2e15',
-        'f2e15', 'f2e15', , 'f2e23', , 'd4b45', , 'f2e25', 'f2e25', 'f2e25', 'a5b55', 'b5b45', , 'd5b55', 'e5b55', , 'g5b55', 'h5b55', 'a6b55', 'b6b55',
-        ,
-        'd6b45', 'e6e46', 'f2e25', , 'f2e26', 'f2e25', 'b7b55', , 'd7b55', 'e7b45', 'f2e26', 'f2e26', , 'a8c66', 'b8b55', , 'd8d46', 'e8b55', 'f8b45',
-        'f2e26', 'f2e26', 'a1a37', , , , 'e1b45', 'f1f37', 'g1e37', 'g2f17', , , , , , , , 'g2f27', 'a3b45', , , , 'e3e47', 'f3f47', 'g2f17', 'g2f17', , 'g2g35',
-        ,
-        'd4b45', , 'f4b45', 'g4b45', 'h4b45', 'a5b45', 'b5b45', , 'd5e47', 'e5f47', , 'g2f27', 'g2f27', 'a6b77', 'b6b45', , 'd6b45', 'e6g47', 'f6h47',
-        ,
-        'g2f27', 'a7b87', 'b7b45', , 'd7g47', 'e7b45', 'f7f47', 'g2f17', , 'a8b87', 'b8b45', , 'd8h47', 'e8e47', 'f8b45', 'g2f27', 'g2f17', 'a1a37',
-        ,
-        , , 'e1b47', 'f1b57', 'g1d48', 'h1e48', , , , , , , , , 'a3b47', , , , 'e3a37', 'f3a37', 'g3a37', 'h3a37', , 'h2g25', , 'd4b47', , 'f4b47', 'g4b47',
-        'h2g17', 'a5b57', 'b5b47', , 'd5b57', 'e5b57', , 'g5b57', 'h5b57', 'a6b57', 'b6b57', , 'd6b47', 'e6e48', 'f6f48', , 'h2g18', 'a7a37', 'b7b57',
-        ,
-        'd7b57', 'e7b47', 'f7f48', 'g7d48', , 'a8a37', 'b8b57', , 'd8d48', 'e8b57', 'f8b47', 'g8c48', 'h2g18', 'a1d43', , , , 'e1e34', 'f1f35', 'g1d43',
-        'h1f35', , , , , , , , , , , , , 'e3d43', 'f3e34', 'g3e34', 'h3e34', , 'b4d43', , 'a3a23', , 'f4d43', 'g4d43', 'h4d43', 'a5d85', 'b5d75', , 'd5d43', 'e5d43',
-        ,
-        'g5e34', 'h5f35', 'a6d65', 'b6d43', , 'd6d43', 'e6e34', 'f6d43', , 'h6e34', 'a7d43', 'b7d75', , 'd7d43', 'e7e34', 'f7f45', 'g7d43', , 'a8d85',
-        'b8d85', , 'd8d43', 'e8e34', 'f8f45', 'g8d55', 'h8d43', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'e3d44',
-        ,
-        , , 'e1b43', 'e3d45', 'e3d45', 'e3d45', , , , , , , , , 'a3b43', , , , , 'e3e45', 'e3e45', 'e3e25', , 'e3e23', , 'd4b43', , 'f4b43', 'g4b43', 'h4b43',
-        'a5b43', 'b5b43', , 'd5e45', 'e3d45', , 'e3d45', 'e3d45', 'a6a75', 'b6b43', , 'd6b43', 'e3d45', 'e3e45', , 'e3d45', 'a7b85', 'b7b43', , 'd7g45',
-        'e7b43', 'e3d45', 'e3d45', , 'a8b85', 'b8b43', , 'd8f65', 'e3d45', 'f8b43', 'e3d45', 'e3d45', 'a1a35', , , , 'e1b45', 'f1b55', 'f3e26', 'f3e26',
-        ,
-        , , , , , , , 'a3b45', , , , 'e3a35', , 'f3e25', 'f3e25', , 'f3e23', , 'd4b45', , 'f3e25', 'f3e25', 'f3e25', 'a5b55', 'b5b45', , 'd5b55', 'e5b55', ,
-        'g5b55', 'h5b55', 'a6b55', 'b6b55', , 'd6b45', 'e6e46', 'f3e25', , 'f3e26', 'a7a35', 'b7b55', , 'd7b55', 'e7b45', 'f3e26', 'f3e26', , 'a8a35',
-        'b8b55', , 'd8d46', 'e8b55', 'f8b45', 'f3e26', 'f3e26', 'a1a37', , , , 'e1b45', 'f1f37', 'g1e37', 'g3f27', , , , , , , , , 'a3b45', , , , 'e3e47', 'f3f47',
-        ,
-        'g3f27', , 'g3g45', , 'd4b45', , 'f4b45', 'g4b45', 'h4b45', 'a5b45', 'b5b45', , 'd5e47', 'e5f47', , 'g3f27', 'g3f27', 'a6b77', 'b6b45', , 'd6b45',
-        'e6g47', 'f6h47', , 'g3f27', 'a7b87', 'b7b45', , 'd7g47', 'e7b45', 'f7f47', 'g3f27', , 'a8b87', 'b8b45', , 'd8h47', 'e8e47', 'f8b45', 'g3f27',
-        'g3f27', 'a1a37', , , , 'e1b47', 'f1b57', 'g1d48', 'h1e48', , , , , , , , , 'a3b47', , , , 'e3a37', 'f3a37', 'g3a37', , , 'h3g25', , 'd4b47', , 'f4b47',
-        'g4b47', 'h3g27', 'a5b57', 'b5b47', , 'd5b57', 'e5b57', , 'g5b57', 'h5b57', 'a6b57', 'b6b57', , 'd6b47', 'e6e48', 'f6f48', , 'h3g28', 'a7a37',
-        'b7b57', , 'd7b57', 'e7b47', 'f7f48', 'g7d48', , 'a8a37', 'b8b57', , 'd8d48', 'e8b57', 'f8b47', 'g8c48', 'h3g28', 'a1d44', , , , 'e1e25', 'f1f35',
-        'g1d44', 'h1f35', , , , , , , , , 'a3e35', , , , 'a4b44', 'a4b55', 'g3f35', 'h3f35', , 'b4d44', , 'a4a33', , 'f4d44', 'g4d44', 'h4d44', 'a5d55', 'b5d55',
-        ,
-        'a4b44', 'e5d44', , 'g5f45', 'h5f35', 'a6e25', 'b6d44', , 'a4b44', 'e6e45', 'f6d44', , 'h6f45', 'a7d44', 'b7d55', , 'a4b44', 'e7e45', 'f7f45',
-        'g7d44', , 'a8d55', 'b8f45', , 'a4b44', 'e8e45', 'f8f45', 'g8d55', 'h8d44', 'a1d44', , , , 'e1e23', 'f1e23', 'b4c44', 'h1e44', , , , , , , , , 'a3e34',
-        ,
-        , , 'e3e23', 'f3e23', 'b4c44', 'h3e34', , , , 'b4a33', , 'b4c44', 'g4e23', 'b4c44', 'a5d84', 'b5e23', , 'b4c44', 'e5e23', , 'b4c44', 'h5e23',
-        'a6e23', 'b4c44', , 'b4c44', 'e6e23', 'b4c44', , 'b4c44', 'a7d74', 'b7d74', , 'b4c44', 'e7e23', 'b4c44', 'g7d44', , 'a8d84', 'b8d84', , 'b4c44',
-        'e8e23', 'b4c44', 'g8d54', 'h8d44', 'a1a23', , , , 'e1e23', 'f1f23', 'g1g23', 'h1h23', , , , , , , , , 'a3a23', , , , 'e3f23', 'f3g23', 'g3h23', 'h3h23',
-        ,
-        'b4b64', , 'd4f23', , 'f4h23', 'g4g23', 'h4h23', 'a5a23', 'b5b64', 'c5f23', 'd5g23', 'e5h23', , 'g5g23', 'h5h23', 'a6a23', 'b6f23', 'c6g23',
-        'd6h23', 'e6e23', 'f6f23', , 'h6h23', 'a7f23', 'b7g23', 'c7h23', 'c4b44', 'e7e23', 'f7f23', 'g7g23', , 'a8g23', 'b8h23', 'c8d84', 'c4b44',
-        'e8e23', 'f8f23', 'g8g23', 'h8h23', 'a1a23', , , , 'd4c44', 'd4c44', 'd4c44', 'h1a14', , , , , , , , , 'a3a23', , , , 'd4c44', 'd4c44', 'd4c44', 'h3c34',
-        ,
-        'd4e33', , , , 'd4c44', 'd4e35', 'd4c44', 'a5a23', 'b5b64', , 'd5a23', 'e5b54', , 'd4c44', 'h5b54', 'a6a23', 'b6b74', , 'd4c44', 'e6a23', 'd4c44',
-        ,
-        'd4c44', 'a7a23', 'b7b84', , 'd4c44', 'e7b44', 'f7a23', 'g7b74', , 'a8a23', 'b8b74', , 'd4c44', 'e8b54', 'd4c44', 'g8a23', 'h8b84', 'e4d44',
-        ,
-        , , 'e1b44', 'e4d45', 'e4d45', 'e4d45', , , , , , , , , 'a3b44', , , , 'e3f35', 'e4d45', 'e4d45', 'e4d45', , 'e4e33', , 'd4b44', , 'e4e35', 'e4e35',
-        'e4e35', 'a5b44', 'b5b44', , 'd5d45', 'e4d45', 'e4d45', 'e4d45', 'e4d45', 'a6c65', 'b6b44', , 'd6b44', 'e4d45', 'e4e35', 'e4d45', 'e4d45',
-        'a7c75', 'b7b44', , 'd7d45', 'e7b44', 'e4d45', 'e4d45', 'e4d45', 'a8c65', 'b8b44', , 'd8f65', 'e4d45', 'f8b44', 'e4d45', 'e4d45', 'f4e35',
-        ,
-        , , 'e1b45', 'f1b55', 'f4e36', 'f4e36', , , , , , , , , 'a3b45', , , , 'f4e45', 'f4e45', 'f4e45', 'f4e36', , 'f4e33', , 'd4b45', , , 'f4e35', 'f4e35',
-        'a5b55', 'b5b45', , 'd5b55', 'e5b55', , 'g5b55', 'h5b55', 'a6b55', 'b6b55', , 'd6b45', 'e6e46', 'f4e35', , 'f4e36', 'f4e35', 'b7b55', , 'd7b55',
-        'e7b45', 'f4e36', 'f4e36', , 'a8c66', 'b8b55', , 'd8d46', 'e8b55', 'f8b45', 'f4e36', 'f4e36', 'a1a37', , , , 'e1b45', 'f1f37', 'g1g37', 'g4f37',
-        ,
-        , , , , , , , 'a3b45', , , , 'e3e47', 'f3f47', 'g3f37', 'g4f47', , 'g4g35', , 'd4b45', , 'f4b45', , 'g4g37', 'a5b45', 'b5b45', , 'd5e47', 'e5f47', ,
-        'g4f37', 'g4f37', 'a6b77', 'b6b45', , 'd6b45', 'e6e47', 'f6f47', , 'g4f37', 'a7b87', 'b7b45', , 'd7d47', 'e7b45', 'f7f47', 'g4f37', , 'a8b87',
-        'b8b45', , 'd8d47', 'e8e47', 'f8b45', 'g4f37', 'g4f37', 'a1a37', , , , 'e1b47', 'f1b57', 'g1d48', 'h1e48', , , , , , , , , 'a3b47', , , , 'e3a37', 'f3a37',
-        'g3a37', 'h3a37', , 'h4g35', , 'd4b47', , 'f4b47', 'g4b47', , 'a5b57', 'b5b47', , 'd5b57', 'e5b57', , 'g5b57', 'h5b57', 'a6b57', 'b6b57', , 'd6b47',
-        'e6e48', 'f6f48', , 'h4g38', 'a7a37', 'b7b57', , 'd7b57', 'e7b47', 'f7f48', 'g7d48', , 'a8a37', 'b8b57', , 'd8d48', 'e8b57', 'f8b47', 'g8c48',
-        'h4g38', 'a1d46', , , , 'e1e35', 'a5b56', 'g1e35', 'h1f36', , , , , , , , , 'a3e35', , , , 'a5b44', 'a5b55', 'g3e35', 'h3e35', , 'b4d66', , 'a5b44', ,
-        'a5b45', 'a5b56', 'a5b46', , 'a5b46', , 'a5b44', 'a5b45', , 'g5e35', 'a5b46', 'a6d66', 'b6e35', , 'a5b44', 'e6e35', 'a5b46', , 'h6e35', 'a7e35',
-        'b7d76', , 'a5b44', 'e7e35', 'a5b46', 'a5b46', , 'a8d86', 'a5b46', , 'a5b44', 'e8e35', 'a5b46', 'a5b46', 'a5b46', 'a1d45', , , , 'b5c44', 'b5c44',
-        'b5c44', 'b5c45', , , , , , , , , 'a3d65', , , , 'b5c44', 'b5c44', 'b5c44', 'b5c45', , 'b5c44', , 'b5c44', , 'b5c44', 'b5c45', 'b5c44', 'b5c44', , , 'b5c44',
-        'b5c45', , 'b5c44', 'b5c45', 'a6d65', 'b5c44', , 'b5c44', 'b5c45', 'b5c44', , 'b5c44', 'b5c44', 'b5c45', , 'b5c44', 'b5c45', 'b5c44', 'b5c45',
-        ,
-        'a8d55', 'b5c45', , 'b5c44', 'b5c45', 'b5c44', 'b5c45', 'b5c45', 'c5d44', , , , 'c5c44', 'c5c44', 'c5c44', 'c5d45', , , , , , , , , 'a3e35', , , , 'c5c44',
-        'c5c44', 'c5c44', 'c5d45', , 'c5d44', , 'c5c44', , 'c5c44', 'c5d45', 'c5c44', 'c5c44', 'c5d44', , 'c5c44', 'c5d45', , 'c5c44', 'c5d45', 'a6d65',
-        'c5d44', 'c5d45', 'c5c44', 'c5d45', 'c5c44', , 'c5c44', 'c5c44', 'c5d44', 'c5d45', 'c5c44', 'c5d45', 'c5c44', 'c5d45', , 'a8d55', 'c5d44',
-        'c5d45', 'c5c44', 'c5d45', 'c5c44', 'c5d45', 'c5d45', 'd5d44', , , , 'd5c44', 'd5c44', 'd5c44', 'd5d45', , , , , , , , , 'a3e35', , , , 'd5c44', 'd5c44',
-        'd5c44', 'd5d45', , 'd5e44', , 'd5c44', , 'd5c44', 'd5d45', 'd5c44', 'd5c44', 'd5d44', , , 'd5d45', , 'd5c44', 'd5d45', 'a6c45', 'd5d44', , 'd5c44',
-        'd5d45', 'd5c44', , 'd5c44', 'd5c44', 'd5d44', , 'd5c44', 'd5d45', 'd5c44', 'd5d45', , 'd5d45', 'd5d44', , 'd5c44', 'd5d45', 'd5c44', 'd5d45',
-        'd5d45', 'e5d44', , , , 'e5e45', 'e5d45', 'e5d45', 'e5d45', , , , , , , , , 'e5e45', , , , 'e5e45', 'e5e45', 'e5e45', 'e5d45', , 'e5e44', , 'd4c45', ,
-        'e5d45', 'e5d45', 'e5d45', 'e5e45', 'e5d44', , 'd5c45', , , 'e5d45', 'e5d45', 'a6c45', 'e5d44', , 'e5d45', 'e5d45', 'e5e45', , 'e5d45', 'e5d45',
-        'e5d44', , 'd7h36', 'e5d45', 'e5d45', 'e5d45', , 'e5d45', 'e5d44', , 'e5d45', 'e5d45', 'e5d45', 'e5d45', 'e5d45', 'f5e45', , , , 'f5e45', 'f1c46',
-        'f5e46', 'f5f47', , , , , , , , , 'f5e45', , , , 'f5e45', 'f5e45', 'f5e45', 'f5e46', , 'f5e44', , 'f5e45', , 'f4d46', 'f5e46', 'f5e46', 'f5e45', 'f5f45',
-        ,
-        'd5d46', 'e5d46', , 'f5e46', 'f5e46', 'a6b56', 'b6c56', , 'd6d46', 'e6c46', 'f5e45', 'f5e46', 'f5e46', 'a7c56', 'b7b56', , 'd7d46', 'e7c56',
-        'f7c46', 'f5e46', 'f5f47', 'a8a46', 'b8b56', , 'd8d46', 'e8b56', 'f5e46', 'g8c46', 'f5e46', 'a1a37', , , , 'e1b46', 'f1f37', 'g1g37', 'g5f47',
-        ,
-        , , , , , , , 'a3b46', , , , 'e3e47', 'f3g37', 'g3f37', 'g5f47', , 'g5g45', , 'd4b46', , 'f4b46', 'g4b46', 'h4b46', 'a5b46', 'g5f45', , 'd5e47', 'e5g37',
-        ,
-        , 'g5f47', 'a6c67', 'b6b46', , 'd6b46', 'e6e47', 'f6f37', , 'g5f47', 'a7c57', 'b7b46', , 'd7d47', 'e7b46', 'f7f37', 'g7d47', , 'a8c67', 'b8b46',
-        ,
-        'd8d47', 'e8e47', 'f8b46', 'g5f47', 'h8d47', 'a1a37', , , , 'e1b47', 'f1b57', 'g1d48', 'h1e48', , , , , , , , , 'a3b47', , , , 'e3a37', 'f3a37', 'g3a37',
-        'h3a37', , 'h5g45', , 'd4b47', , 'f4b47', 'g4b47', 'h4b47', 'a5b57', 'b5b47', , 'd5b57', 'e5b57', , 'g5b57', , 'a6b57', 'b6b57', , 'd6b47', 'e6e48',
-        'f6f48', , 'h5g48', 'a7a37', 'b7b57', , 'd7b57', 'e7b47', 'f7f48', 'g7d48', , 'a8a37', 'b8b57', , 'd8d48', 'e8b57', 'f8b47', 'g8c48', 'h8d48',
-        'a1d46', , , , 'a6b66', 'a6b56', 'g1e36', 'h1f36', , , , , , , , , 'a3d66', , , , 'a6b55', 'a6b55', 'a6b66', 'a6b56', , 'b4d66', , 'a6b55', , 'a6b56',
-        'a6b56', 'h4d46', 'a5d86', 'b5d76', , 'a6b55', 'a6b56', , 'g5e36', 'h5f36', , 'b6d86', , 'a6b55', 'e6e36', 'f6f36', , 'h6e36', 'a7d76', 'b7d76',
-        ,
-        'a6b66', 'e7e36', 'f7f36', 'g7d46', , 'a8d86', 'b8d86', , 'a6b66', 'e8e36', 'f8f36', 'g8d56', 'h8d46', 'a1d46', , , , 'b6c66', 'b6c56', 'b6c56',
-        'b6c56', , , , , , , , , 'a3d66', , , , 'b6c55', 'b6c55', 'b6c66', 'b6c56', , 'b4d66', , 'b6c55', , 'b6c56', 'b6c56', 'b6c56', 'a5d56', 'b5d76', , 'b6c55',
-        'b6c56', , 'g5g36', 'b6c56', 'a6e26', , , 'b6c55', 'b6c56', 'b6c56', , 'h6e36', 'a7d76', 'b6c56', , 'b6c66', 'b6c56', 'b6c56', 'g7g36', , 'a8d86',
-        'b8d86', , 'b6c66', 'b6c56', 'b6c56', 'g8g36', 'h8d46', 'a1d46', , , , 'c6d66', 'c6d56', 'c6d56', 'c6d56', , , , , , , , , 'a3d66', , , , 'c6d55', 'c6d55',
-        'c6d66', 'c6d56', , 'b4d66', , 'c6d55', , 'c6d56', 'c6d56', 'c6d56', 'a5d86', 'b5d56', , 'c6c55', 'c6d56', , 'g5g36', 'c6d56', 'a6e26', 'b6d86',
-        ,
-        'c6c55', 'c6d56', 'c6d56', , 'h6e36', 'a7d76', 'b7d76', 'c7d86', 'c6c56', 'c6d56', 'c6d56', 'c6d56', , 'a8d86', 'b8d86', 'c8d86', 'c6c56',
-        'c6d56', 'c6d56', 'g8g36', 'c6d56', 'a1d46', , , , 'd6e66', 'd6d56', 'd6d56', 'd6d56', , , , , , , , , 'a3e36', , , , 'd6d55', 'd6d55', 'd6e66', 'd6e56',
-        ,
-        'b4d46', , 'd6d55', , 'd6d56', 'd6d56', 'd6d56', 'a5d56', 'b5d56', , 'd6c55', 'd6d56', , 'g5g36', 'd6d56', 'a6e26', 'b6d46', , , 'd6d56', 'd6d56',
-        ,
-        'h6e36', 'a7d46', 'b7d56', , 'd6c56', 'd6d56', 'd6d56', 'd6d56', , 'a8d56', 'b8e87', , 'd6c56', 'd6d56', 'd6d56', 'g8g36', 'd6d56', 'a1d46',
-        ,
-        , , 'e1e26', 'e6d56', 'e6d56', 'e6d56', , , , , , , , , 'a3e36', , , , 'e6d55', 'e6d55', 'e6e56', 'e6e56', , 'b4d46', , 'e6d55', , 'e6d56', 'e6d56',
-        'e6d56', 'a5e16', 'b5e26', , 'd5f36', 'e5g36', , 'g5g36', 'e6d56', 'a6e26', 'b6d46', , 'd6g36', , 'e6d56', , 'h6e36', 'a7d46', 'b7f36', , 'd7d46',
-        'e6d56', 'e6d56', 'e6d56', , 'a8f36', 'b8g36', , 'd8d46', 'e6d56', 'e6d56', 'g8g36', 'e6d56', 'a1a37', , , , 'f6e56', 'f1f37', 'f6f57', 'f6e57',
-        ,
-        , , , , , , , 'f6f56', , , , 'f6e56', 'f6e56', 'f6e56', 'f6e56', , 'f6g56', , 'f6f56', , 'f4g37', 'f6f57', 'f6f57', 'a5b57', 'f6f56', , 'd5f37', 'e5g37',
-        ,
-        'f6e57', 'f6e57', 'a6b57', 'b6c57', , 'd6g37', 'e6h37', , , 'f6e57', 'a7c57', 'b7d57', , 'd7h37', 'e7e37', 'f6e57', 'f6e57', , 'a8d57', 'b8g37',
-        ,
-        'd8d57', 'e8e37', 'f6f57', 'f6e57', 'f6e57', 'a1a37', , , , 'e1e37', 'f1f37', 'g1g37', 'h1f37', , , , , , , , , 'g6f56', , , , 'e3f37', 'f3g37', 'g3f37',
-        'g6f57', , 'g6g56', , 'g6f56', , 'f4g37', 'g4g37', 'g6f57', 'a5b57', 'g6f56', , 'd5f37', 'e5g37', , 'g5g37', 'h5f37', 'a6b57', 'b6c57', , 'd6g37',
-        'e6e37', 'f6f37', , 'h6e37', 'a7c57', 'b7f37', , 'd7d47', 'e7e37', 'f7f37', 'g7d47', 'g6g58', 'a8f37', 'b8g37', , 'd8d47', 'e8e37', 'f8f37',
-        'g8c47', 'h8d47', 'a1a38', , , , 'e1b47', 'f1c48', 'g1d48', 'h1e48', , , , , , , , , 'a3b47', , , , 'h6g57', 'h6g57', 'h6g57', 'h3a38', , 'h6g56', , 'd4b47',
-        ,
-        'f4b47', 'g4b47', 'h4b47', 'a5b47', 'b5b47', , 'd5e48', 'e5e48', , 'g5c58', 'h5c58', 'a6c68', 'b6b47', , 'd6b47', 'e6e48', 'f6d48', , , 'a7c58',
-        'b7b47', , 'd7d48', 'e7b47', 'f7c48', 'g7d48', , 'a8c68', 'b8b47', , 'd8d48', 'e8e48', 'f8b47', 'g8c48', 'h8d48', 'a1d47', , , , 'a7b66', 'a7b67',
-        'g1e37', 'h1f37', , , , , , , , , 'a3d67', , , , 'a7b66', 'a7b66', 'a7b66', 'a7b67', , 'b4d67', , 'a7b66', , 'a7b67', 'a7b67', 'a7b67', 'a5d57', 'b5d57',
-        ,
-        'a7b66', 'a7b67', , 'a7b67', 'h5f37', 'a6d67', 'b6d67', , 'a7b66', 'a7b67', 'f6f37', , 'h6e37', , 'b7d57', , 'a7b66', 'a7b67', 'f7f37', 'g7d47',
-        ,
-        'a8d57', 'b8d67', , 'a7b66', 'a7b67', 'f8f37', 'g8d57', 'h8d47', 'a1d47', , , , 'b7c66', 'b7c67', 'b7c67', 'b7c67', , , , , , , , , 'a3d67', , , , 'b7c66',
-        'b7c66', 'b7c66', 'b7c67', , 'b4d67', , 'b7c66', , 'b7c67', 'b7c67', 'b7c67', 'a5d57', 'b5d57', , 'b7c66', 'b7c67', , 'b7c67', 'b7c67', 'a6d67',
-        'b6d67', , 'b7c66', 'b7c67', 'b7c67', , 'b7c67', 'a7d47', , , 'b7c66', 'b7c67', 'b7c67', 'g7d47', , 'a8d88', 'b8d67', , 'b7c66', 'b7c67', 'b7c67',
-        'g8d57', 'h8d47', 'a1d47', , , , 'c7d66', 'c7d67', 'c7d67', 'c7d67', , , , , , , , , 'a3d67', , , , 'c7d66', 'c7d66', 'c7d66', 'c7d67', , 'b4d67', , 'c7d66',
-        ,
-        'c7d67', 'c7d67', 'c7d67', 'a5d57', 'b5d57', , 'c7d66', 'c7d67', , 'c7d67', 'c7d67', 'a6d67', 'b6d67', , 'c7c66', 'c7d67', 'c7d67', , 'c7d67',
-        'a7d47', 'b7d57', , 'c7c66', 'c7d67', 'c7d67', 'g7d47', , 'a8d57', 'b8d88', 'c7d68', 'c7c66', 'c7d67', 'c7d67', 'g8d57', 'h8d47', 'a1d47',
-        ,
-        , , 'd7e66', 'd7e67', 'd7e67', 'd7e67', , , , , , , , , 'a3d67', , , , 'd7e66', 'd7e66', 'd7e66', 'd7e67', , 'b4d67', , 'd7e66', , 'd7e67', 'd7e67',
-        'd7e67', 'a5d57', 'b5d57', , 'd7d66', 'd7e67', , 'd7e67', 'd7e67', 'a6d67', 'b6d67', , 'd7c66', 'd7d67', 'd7d67', , 'd7e67', 'a7d47', 'b7d57',
-        ,
-        , 'd7e67', 'd7d67', 'g7d47', , 'a8d57', 'b8d67', , 'd7c66', 'd7e67', 'd7d67', 'g8d57', 'h8d47', 'a1d47', , , , 'e7e66', 'e7e67', 'e7e67', 'e7e67',
-        ,
-        , , , , , , , 'a3e37', , , , 'e7e66', 'e7e66', 'e7e66', 'e7f67', , 'b4d47', , 'e7e66', , 'e7e67', 'e7e67', 'e7e67', 'a5d57', 'b5d57', , 'e7d66', 'e5e37',
-        ,
-        'e7e67', 'e7e67', 'a6e27', 'b6d47', , 'd6d57', 'e6e37', 'e7d67', , 'e7e67', 'a7d47', 'b7d57', , 'd7d57', , 'e7d67', 'g7d47', , 'a8d57', 'b8d88',
-        ,
-        'd8d57', 'e7e67', 'e7d67', 'g8d57', 'h8d47', 'a1d47', , , , 'f7e66', 'f1f37', 'f7e67', 'f7e67', , , , , , , , , 'a3e37', , , , 'f7e66', 'f7e66', 'f7e66',
-        'f7f67', , 'b4d47', , 'f7e66', , 'f4f37', 'f7e67', 'f7e67', 'f7f67', 'b5e27', , 'd5f37', 'e5e37', , 'f7e67', 'f7e67', 'a6e27', 'b6d47', , 'd6d47',
-        'e6e37', 'f6f37', , 'f7e67', 'a7d47', 'b7f37', , 'd7d47', 'e7e37', , 'g7d47', , 'a8f37', 'b8d88', , 'd8d47', 'e8e37', 'f7g68', 'f7f68', 'h8d47',
-        'a1a38', , , , 'e1e38', 'f1f38', 'g1g38', 'g7f68', , , , , , , , , 'g7g67', , , , 'g7g67', 'g7g67', 'g7g67', 'g7f67', , 'g7h67', , 'g7g67', , 'f4g38',
-        'g4h38', 'g7g68', 'g7f67', 'g7g67', , 'g7f67', 'e5g38', , 'g5g38', 'g7g68', 'a6c48', 'b6c58', , 'd6g38', 'e6h38', 'f6f38', , 'g7f68', 'a7c58',
-        'b7f38', , 'd7h38', 'e7e38', 'f7f38', , , 'a8f38', 'b8g38', , 'd8d48', 'e8e38', 'f8f38', 'g7f68', 'g7f68', 'a1a38', , , , 'e1b48', 'f1c48', 'g1d48',
-        'h1h39', , , , , , , , , 'h7g67', , , , 'h7g67', 'h7g67', 'h7g67', 'h3a38', , 'h7h67', , 'h7g67', , 'f4d48', 'g4d48', 'h4d48', 'a5c58', 'h7g67', , 'd5d48',
-        'e5d48', , 'g5c58', 'h5c58', 'a6c48', 'b6c58', , 'd6d48', 'e6c48', 'f6d48', , 'h6h59', 'a7c58', 'b7b48', , 'd7d48', 'e7c58', 'f7c48', 'g7d48',
-        ,
-        'a8a48', 'b8b48', , 'd8d48', 'e8a48', 'f8c58', 'g8c48', 'h8d48', 'a1d48', , , , 'a8b88', 'a8b78', 'a8b78', 'a8b78', , , , , , , , , 'a3d68', , , , 'a8b77',
-        'a8b77', 'a8b88', 'a8b78', , 'a8b78', , 'a8b77', , 'a8b78', 'a8b78', 'a8b78', 'a5d88', 'b5d78', , 'a8b77', 'a8b78', , 'g5g38', 'a8b78', 'a6d68',
-        'b6d88', , 'a8b77', 'a8b78', 'a8b78', , 'h6e38', 'a7d78', 'b7d78', , 'a8b88', 'a8b78', 'a8b78', 'g7g38', , , 'b8d88', , 'a8b88', 'a8b78', 'a8b78',
-        'g8g38', 'h8d48', 'a1d48', , , , 'b8c88', 'b8c78', 'b8c78', 'b8c78', , , , , , , , , 'a3d68', , , , 'b8c77', 'b8c77', 'b8c88', 'b8c78', , 'b4d68', , 'b8c77',
-        ,
-        'b8c78', 'b8c78', 'b8c78', 'a5d88', 'b5d78', , 'b8c77', 'b8c78', , 'g5g38', 'b8c78', 'a6d68', 'b6d88', , 'b8c77', 'b8c78', 'b8c78', , 'h6e38',
-        'a7d78', 'b7d78', , 'b8c88', 'b8c78', 'b8c78', 'g7g38', , 'a8d58', , , 'b8c88', 'b8c78', 'b8c78', 'g8g38', 'h8d48', 'a1d48', , , , 'c8d88', 'c8d78',
-        'c8d78', 'c8d78', , , , , , , , , 'a3d68', , , , 'c8d77', 'c8d77', 'c8d88', 'c8d78', , 'b4d68', , 'c8d77', , 'c8d78', 'c8d78', 'c8d78', 'a5d88', 'b5d78',
-        ,
-        'c8d77', 'c8d78', , 'c8d78', 'c8d78', 'a6d68', 'b6d88', , 'c8d77', 'c8d78', 'c8d78', , 'h6e38', 'a7d78', 'b7d78', , 'c8d88', 'c8d78', 'c8d78',
-        'g7g38', , 'a8d58', 'b8d68', , 'c8d78', 'c8d78', 'c8d78', 'g8g38', 'h8d48', 'a1d48', , , , 'd8e88', 'd8e78', 'd8e78', 'd8e78', , , , , , , , , 'a3d68',
-        ,
-        , , 'd8e77', 'd8e77', 'd8e88', 'd8e78', , 'b4d68', , 'd8e77', , 'd8e78', 'd8e78', 'd8e78', 'a5d58', 'b5d78', , 'd8e77', 'd8e78', , 'd8e78', 'd8e78',
-        'a6d68', 'b6d68', , 'd8d77', 'd8e78', 'd8e78', , 'h6e38', 'a7d78', 'b7d78', , 'd7d68', 'd8d78', 'd8e78', 'g7g38', , 'a8d58', 'b8d68', , , 'd8e78',
-        'd8e78', 'g8g38', 'h8d48', 'a1d48', , , , 'e1e28', 'e8f78', 'e8f78', 'e8e78', , , , , , , , , 'a3d68', , , , 'e8f77', 'e8f77', 'e8f88', 'e8f78', , 'b4d68',
-        ,
-        'e8f77', , 'e8f78', 'e8f78', 'e8f78', 'a5d58', 'b5d58', , 'e8e77', 'e5g38', , 'e8f78', 'e8f78', 'a6d68', 'b6d68', , 'e8d77', 'e6e38', 'e8e78',
-        ,
-        'h6e38', 'a7d48', 'b7d58', , 'd7d68', 'e7e38', 'e8e78', 'g7g38', , 'a8d58', 'b8d68', , 'd8d68', , 'e8e78', 'g8g38', 'h8d48', 'a1d48', , , , 'e1e28',
-        'f1f38', 'f8f78', 'f8e78', , , , , , , , , 'a3e38', , , , 'f8f77', 'f8f77', 'f8g88', 'f8g78', , 'b4d48', , 'f8f77', , 'f4g38', 'f8f78', 'f8f78', 'a5d58',
-        'b5d58', , 'f8e77', 'e5g38', , 'f8f78', 'f8f78', 'a6e28', 'b6d48', , 'd6g38', 'e6e38', 'f6f38', , 'h6e38', 'a7d48', 'b7d58', , 'd7d58', 'e7e38',
-        'f7f38', 'g7g38', , 'a8d58', 'b8g38', , 'd8d58', 'e8e38', , 'g8g38', 'h8d48', 'a1d48', , , , 'e1e38', 'f1f38', 'g1g38', 'h1f38', , , , , , , , , 'a3e38',
-        ,
-        , , 'g8f77', 'g8f77', 'g3f38', 'g8g78', , 'b4d48', , 'g8f77', , 'f4g38', 'g4g38', 'g8f78', 'g8f78', 'b5c69', , 'd5f38', 'e5g38', , 'g5g38', 'g8f78',
-        'a6c69', 'b6d48', , 'd6g38', 'e6e38', 'f6f38', , 'h6e38', 'a7d48', 'b7f38', , 'd7d48', 'e7e38', 'f7f38', 'g7g38', , 'a8f38', 'b8g38', , 'd8d48',
-        'e8e38', 'f8f38', , 'h8d48', 'a1a39', , , , 'e1e39', 'f1f39', 'g1g39', 'h1h39', , , , , , , , , 'h8h78', , , , 'h8g78', 'h8g78', 'h8g78', 'h8g78', , 'h8h78',
-        ,
-        'h8h78', , 'f4g39', 'g4h39', 'h4h39', 'a5c59', 'b5c59', , 'd5f39', 'e5g39', , 'g5g39', 'h5h39', 'a6c49', 'b6c59', , 'd6g39', 'e6h39', 'f6f39',
-        ,
-        'h6h39', 'a7c59', 'b7d59', , 'd7h39', 'e7e39', 'f7f39', 'g7g39', , 'a8d59', 'b8g39', , 'd8d59', 'e8e39', 'f8f39', 'g8g39', , , 'b1e45', , , ,
-        'f1f36', 'a1b27', 'h1e45', , , , , , , , , 'a3f36', 'b3f36', , , , 'a1b25', 'a1b25', 'a1b26', 'a4e45', , 'c4e45', , 'a1b23', , 'a1b25', 'h4e45', , 'b5e56',
-        'a1b26', , 'a1a25', 'f5e45', , 'h5f36', 'a6e67', 'b6e67', 'c6e45', , 'e6e45', 'f6f46', 'g6e45', , 'a7e77', 'b7e45', 'c7e56', , 'e7e45', 'f7f46',
-        'g7e56', 'h7e45', 'a8e45', 'b8e56', 'a1b27', , 'e8e45', 'f8f46', 'a1a27', 'h8e56', 'a1d46', , , , , 'f1f35', 'g1g36', 'h1f35', , , , , , , , , 'a3f35',
-        'b3f35', , , , 'b1b25', 'b1b25', 'h3f35', 'a4e45', , 'c4e45', , 'b1b23', , 'b1b25', 'h4f45', , 'b5e56', 'b1b26', , 'b1b25', 'f5f45', , 'h5f35',
-        'a6h66', 'b6h66', 'c6e45', , 'e6e45', 'f6f45', 'g6e45', , 'a7d46', 'b7e45', 'c7f45', , 'e7e45', 'f7f45', 'g7h66', 'h7e45', 'a8e45', 'b8f45',
-        'c8g46', , 'e8e45', 'f8f45', 'g8g56', 'h8h66', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a36', 'b1b35',
-        ,
-        , , , 'g1d46', 'h1e46', , , , , , , , , 'a3b35', 'b3c45', , , , 'f3b35', 'g3b35', 'h3b35', 'a4c45', , 'f1f23', , 'e4c45', , 'g4c45', 'h4c45', , 'b5c45',
-        'c5c45', , 'e5e46', 'f5e46', , 'f1f27', 'a6c45', 'b6b35', 'c6c45', , 'e6c45', 'f6d46', 'g6e46', , 'a7d46', 'b7b35', 'c7c45', , 'e7e46', 'f7c45',
-        'g7d46', 'h7e46', 'a8e46', 'b8b35', 'c8c45', , 'e8e46', 'f8b46', 'g8c45', 'h8d46', 'g1f26', 'b1b36', , , , 'f1c45', , 'g1f17', , , , , , , , , 'a3b46',
-        'b3c45', , , , 'f3b36', 'g1f26', 'g1f26', 'a4c45', , 'g1f23', , 'e4c45', , 'g4c45', 'h4c45', , 'b5c45', 'c5c45', , 'e5f47', 'f5g47', , 'g1f27',
-        'a6c45', 'b6b46', 'c6c45', , 'e6c45', 'f6h47', 'g1f17', , 'a7c77', 'b7b46', 'c7c45', , 'e7b46', 'f7c45', 'g1f27', 'g1f27', 'a8c87', 'b8b46',
-        'c8c45', , 'e8e47', 'f8b46', 'g8c45', 'g1f27', 'a1a47', 'b1b36', , , , 'f1c46', 'g1c57', , , , , , , , , , 'a3b36', 'b3c46', , , , 'f3b36', 'g3b36', 'h3b36',
-        'a4c46', , 'h1h25', , 'e4c46', , 'g4c46', 'h4c46', , 'b5c46', 'h1g25', , 'e5c57', 'f5c57', , 'h5c57', 'a6c46', 'b6b36', 'c6c46', , 'e6c46', 'f6h48',
-        'g6g48', , 'a7c57', 'b7b36', 'c7c46', , 'e7c57', 'f7c46', 'g7g48', 'h1g18', 'a8a47', 'b8b36', 'c8c46', , 'e8a47', 'f8c57', 'g8c46', 'h1g18',
-        'a1e55', 'b1e45', , , , 'f1f36', 'a2b36', 'h1e45', , , , , , , , , 'a3f36', 'b3f36', , , , 'a2b34', 'a2b35', 'a2b36', 'a4e45', , 'c4e45', , 'a2b33', ,
-        'a2b35', 'h4e45', , 'b5e55', 'c5e55', , 'a2a35', 'f5e45', , 'h5e55', 'a6e67', 'b6e67', 'c6e45', , 'a2b35', 'f6e55', 'g6e45', , 'a7e77', 'b7e45',
-        'c7e55', , 'a2b35', 'f7f46', 'g7e55', 'h7e45', 'a8e45', 'b8e55', 'a2b37', , 'a2b35', 'f8f46', 'g8g36', 'h8e55', 'a1c16', 'b1e43', , , , 'f1f25',
-        'g1g35', 'h1e43', 'a2e66', , , , , , , , 'a3f35', 'b3f35', , , , 'f3e43', 'b2b35', 'h3g35', 'a4e43', , 'c4e43', , 'b2b33', , 'g4e43', 'h4e43', , 'b5e55',
-        'c5e55', , 'e5e43', 'f5e43', , 'h5g45', 'a6e66', 'b6f25', 'c6e43', , 'e6e43', 'f6f45', 'g6e43', , 'a7f25', 'b7e43', 'c7e55', , 'e7e43', 'f7f45',
-        'g7g45', 'h7e43', 'a8e43', 'b8e55', 'c8g45', , 'e8e43', 'f8f45', 'g8g45', 'h8e55', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , 'a1a45', 'b1b25', , , , 'f1c43', 'g1g36', 'h1h36', , , , , , , 'g2g36', 'h2h36', 'a3a45', 'b3c43', , , , 'f3b35', 'g3b35',
-        'h3b35', 'a4c43', , 'f2f33', , 'e4c43', , 'g4c43', 'h4c43', , 'b5c43', 'c5c43', , 'e5b25', 'f5c55', , 'h5c55', 'a6c43', 'b6c55', 'c6c43', , 'e6c43',
-        'f6b25', 'g6g46', , 'a7c55', 'b7b45', 'c7c43', , 'e7c55', 'f7c43', 'g7b25', 'h7h46', 'a8a45', 'b8b45', 'c8c43', , 'e8a45', 'f8c55', 'g8c43',
-        'h8b25', 'a1a36', 'b1b36', , , , 'f1c45', 'g1c55', 'g2f17', , , , , , , , 'g2f27', 'a3c55', 'g2f34', , , , 'f3b36', 'g2f26', 'g2f26', 'a4c45', , 'g2f23',
-        ,
-        'e4c45', , 'g4c45', 'h4c45', , 'b5c55', 'c5c45', , 'e5c55', 'f5c55', , 'h5c55', 'a6c45', 'b6c55', 'c6c55', , 'e6c45', 'f6h47', 'g2f17', , 'a7c55',
-        'b7b46', 'c7c55', , 'e7c55', 'f7c45', 'g2f27', 'g2f27', 'a8a36', 'b8b46', 'c8c55', , 'e8e47', 'f8c55', 'g8c45', 'g2f27', 'a1a47', 'b1b36',
-        ,
-        , , 'f1c45', 'g1c57', 'h1c67', , , , , , , , , 'a3b36', 'b3c45', , , , 'f3b36', 'g3b36', 'h3b36', 'a4c45', , 'h2h35', , 'e4c45', , 'g4c45', 'h4c45',
-        ,
-        'b5c45', 'c5c45', , 'e5c57', 'f5c57', , 'h5c57', 'a6c45', 'b6b36', 'c6c45', , 'e6c45', 'f6c67', 'g6c67', , 'a7c77', 'b7b36', 'c7c45', , 'e7c57',
-        'f7c45', 'g7c77', 'h7c77', 'a8c87', 'b8b36', 'c8c45', , 'e8c67', 'f8c57', 'g8c45', 'h8c87', 'a1e55', 'b1e45', , , , 'f1f35', 'a3b36', 'h1f35',
-        ,
-        , , , , , , , , 'b3f35', , , , 'a3b34', 'a3b45', 'h3f35', 'a4e45', , 'c4e45', , 'a3b33', , 'a3b35', 'h4e45', , 'b5e55', 'c5e55', , 'a3a45', 'f5f35',
-        ,
-        'h5f35', 'a6e67', 'b6e67', 'c6e45', , 'a3b35', 'f6f35', 'g6e45', , 'a7e77', 'b7e45', 'c7e55', , 'a3b35', 'f7f35', 'g7e55', 'h7e45', 'a8e45',
-        'b8e55', 'a3b47', , 'a3b35', 'f8f35', 'g8g36', 'h8e55', 'a1e55', 'b1e43', , , , 'f1f34', 'g1g35', 'h1e43', , , , , , , , , 'a3e75', , , , , 'f3e43', 'g3f34',
-        'h3f34', 'a4e43', , 'c4e43', , 'b3b23', , 'g4e43', 'h4e43', , 'b5e85', 'c5e75', , 'e5e43', 'f5e43', , 'h5f34', 'a6e65', 'b6e65', 'c6e43', , 'e6e43',
-        'f6f34', 'g6e43', , 'a7e75', 'b7e43', 'c7e75', , 'e7e43', 'f7f34', 'g7g45', 'h7e43', 'a8e43', 'b8e85', 'c8e85', , 'e8e43', 'f8f34', 'g8g45',
-        'h8e55', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a45', 'b1b34', , , , 'f1c43', 'g1c55', 'h1h46',
-        ,
-        , , , , , , , 'a3b34', 'b3c43', , , , , 'g3c75', 'h3c85', 'a4c43', , 'f3f23', , 'e4c43', , 'g4c43', 'h4c43', , 'b5c43', 'c5c43', , 'e5b25', 'f5c55',
-        ,
-        'h5c55', 'a6c43', 'b6b34', 'c6c43', , 'e6c43', 'f6b25', 'g6c65', , 'a7c75', 'b7b34', 'c7c43', , 'e7c55', 'f7c43', 'g7b25', 'h7c75', 'a8c85',
-        'b8b34', 'c8c43', , 'e8c65', 'f8c55', 'g8c43', 'h8b25', 'a1a36', 'b1b35', , , , 'f1c45', 'g1c55', 'g3f27', , , , , , , , , 'a3c55', 'g3f34', , , , 'f3b35',
-        ,
-        'g3f26', 'a4c45', , 'g3f23', , 'e4c45', , 'g4c45', 'h4c45', , 'b5c55', 'c5c45', , 'e5c55', 'f5c55', , 'h5c55', 'a6c45', 'b6c55', 'c6c55', , 'e6c45',
-        'f6h47', 'g3f27', , 'a7c55', 'b7b35', 'c7c55', , 'e7c55', 'f7c45', 'g3f27', 'g3f27', 'a8a36', 'b8b35', 'c8c55', , 'e8e47', 'f8c55', 'g8c45',
-        'g3f27', 'a1a47', 'b1b36', , , , 'f1c45', 'g1c57', 'h1c67', , , , , , , , , 'a3b36', 'b3c45', , , , 'f3b36', 'g3b36', , 'a4c45', , 'h3h45', , 'e4c45',
-        ,
-        'g4c45', 'h4c45', , 'b5c45', 'c5c45', , 'e5c57', 'f5c57', , 'h5c57', 'a6c45', 'b6b36', 'c6c45', , 'e6c45', 'f6c67', 'g6c67', , 'a7c77', 'b7b36',
-        'c7c45', , 'e7c57', 'f7c45', 'g7c77', 'h7c77', 'a8c87', 'b8b36', 'c8c45', , 'e8c67', 'f8c57', 'g8c45', 'h8c87', 'a1e55', 'b1e45', , , , 'f1f36',
-        'a4b36', 'h1e45', , , , , , , , , 'a3f36', 'b3f36', , , , 'a4b34', 'a4b45', 'a4b46', , , 'c4e45', , 'a4b33', , 'a4b35', 'h4e45', , 'b5e55', 'c5e55', ,
-        'a4b45', 'f5e45', , 'h5e55', 'a6e67', 'b6e67', 'c6e45', , 'a4b35', 'f6e55', 'g6e45', , 'a7e77', 'b7e45', 'c7e55', , 'a4b35', 'f7f46', 'g7e55',
-        'h7e45', 'a8e45', 'b8e55', 'a4b57', , 'a4b35', 'f8f46', 'g8g36', 'h8e55', 'a1e55', 'b1e44', , , , 'f1f35', 'g1g35', 'h1e44', , , , , , , , , 'a3f35',
-        'b3f35', , , , 'b4c44', 'b4c55', 'h3g35', 'a4e86', , 'c4e44', , 'b4b33', , 'g4e44', 'h4e44', 'a5e55', 'b5e55', 'c5e55', , 'b4c44', 'f5e44', , 'h5f35',
-        'a6e66', 'b6e66', 'c6e44', , 'b4c44', 'f6f45', 'g6e44', , 'a7e76', 'b7e44', 'c7e55', , 'b4c44', 'f7f45', 'g7g35', 'h7e44', 'a8e44', 'b8e55',
-        'b4c46', , 'b4c44', 'f8f45', 'g8g35', 'h8e55', 'a1e54', 'b1e44', , , , 'f1f23', 'g1f23', 'h1f34', , , , , , , , , 'a3e74', 'b3f34', , , , 'f3f23', 'g3f23',
-        'h3f34', 'a4e84', , , , 'c4b33', , 'g4f34', 'h4f23', , 'b5e84', 'c5f23', , 'e5e64', 'f5f23', , 'h5f34', 'a6e64', 'b6f23', 'c4d44', , 'c4d44', 'f6f23',
-        'c4d44', , 'a7f23', 'b7e74', 'c7e74', , 'e7e84', 'f7f23', 'g7e54', 'h7e44', 'a8e84', 'b8e84', 'c8e84', , 'e8e74', 'f8f23', 'c4d44', 'h8e54',
-        'a1a23', 'b1b23', , , , 'f1f23', 'g1g23', 'h1h23', , , , , , , , , 'a3b23', 'b3b23', , , , 'f3g23', 'g3h23', 'h3h23', 'a4a23', , 'c4a23', , 'e4g23', ,
-        'g4g23', 'h4h23', , 'b5b23', 'c5c64', 'd5g23', 'e5h23', 'f5f23', , 'h5h23', 'a6a23', 'b6b23', 'c6g23', 'd6h23', 'e6a23', 'f6f23', 'g6g23',
-        ,
-        'a7a23', 'b7g23', 'c7h23', 'd7e64', 'd4c44', 'f7f23', 'g7g23', 'h7h23', 'a8g23', 'b8h23', 'c8g84', 'd8g84', 'd4c44', 'f8f23', 'g8g23',
-        'h8h23', 'a1b23', 'b1b23', , , , 'f1c44', 'g1c54', 'e4d45', , , , , , , , , 'a3b23', 'b3b23', , , , 'f3b34', 'g3b34', 'h3b34', 'a4c64', , 'e4f33', , ,
-        ,
-        'g4c84', 'e4d45', , 'b5b23', 'c5c64', , 'e5b23', 'f5c54', , 'h5c54', 'a6c84', 'b6b23', 'c6c74', , 'e4d44', 'f6b23', 'e4d44', , 'a7c74', 'b7b23',
-        'c7c84', , 'e7c54', 'f7c44', 'g7b23', 'h7c74', 'a8c84', 'b8b23', 'c8c74', , 'e8c64', 'f8c54', 'e4d44', 'h8b23', 'f4e45', 'b1b35', , , , 'f1c44',
-        'g1c55', 'h1a16', , , , , , , , , 'a3b45', 'b3c44', , , , 'f3b35', 'g3b35', 'h3b35', 'a4c44', , 'f4f33', , 'e4c44', , 'f4f36', 'f4f36', , 'b5c44', 'c5c44',
-        ,
-        'e5c55', 'f5c55', 'g5c55', 'h5c55', 'a6c44', 'b6c55', 'c6c44', , 'e6c44', 'f4e46', 'f4e46', 'f4e46', 'a7c55', 'b7b45', 'c7c44', , 'e7c55',
-        'f7c44', 'f4e46', 'h7e46', 'a8c86', 'b8b45', 'c8c44', , 'e8e56', 'f8c55', 'g8c44', 'f4e46', 'a1a36', 'b1b36', , , , 'f1c45', 'g1c55', 'g4f37',
-        ,
-        , , , , , , , 'a3c55', 'g4f34', , , , 'f3b36', 'g3b36', 'h3b36', 'a4c45', , 'g4f33', , 'e4c45', , , 'g4f36', , 'b5c55', 'c5c45', , 'e5c55', 'f5c55',
-        ,
-        'h5c55', 'a6c45', 'b6c55', 'c6c55', , 'e6c45', 'f6f57', 'g4f37', , 'a7c55', 'b7b46', 'c7c55', , 'e7c55', 'f7c45', 'g4f37', 'g4f37', 'a8a36',
-        'b8b46', 'c8c55', , 'e8e47', 'f8c55', 'g8c45', 'g4f37', 'a1a47', 'b1b36', , , , 'f1c45', 'g1c57', 'h1c67', , , , , , , , , 'a3b36', 'b3c45', , , , 'f3b36',
-        'g3b36', 'h3b36', 'a4c45', , 'h4h35', , 'e4c45', , 'g4c45', , , 'b5c45', 'c5c45', , 'e5c57', 'f5c57', , 'h5c57', 'a6c45', 'b6b36', 'c6c45', , 'e6c45',
-        'f6c67', 'g6c67', , 'a7c77', 'b7b36', 'c7c45', , 'e7c57', 'f7c45', 'g7c77', 'h7c77', 'a8c87', 'b8b36', 'c8c45', , 'e8c67', 'f8c57', 'g8c45',
-        'h8c87', 'a1e56', 'b1e45', , , , 'f1f36', 'a5b57', 'h1e45', , , , , , , , , 'a3f36', 'b3f36', , , , 'a5b55', 'a5b45', 'a5b46', 'a4e45', , 'c4e45', , 'a5b44',
-        ,
-        'g4e45', 'h4e45', , 'b5e56', 'a5b46', , 'a5b45', 'f5e45', , 'h5f36', 'a6e67', 'b6e67', 'c6e45', , 'e6e45', 'f6f46', 'g6e45', , 'a7e77', 'b7e45',
-        'c7e56', , 'e7e45', 'f7f46', 'g7e56', 'h7e45', 'a8e45', 'b8e56', 'a5b57', , 'e8e45', 'f8f46', 'a5b57', 'h8e56', 'a1e56', 'b1e45', , , , 'f1f35',
-        'b5c46', 'h1f35', , , , , , , , , 'a3f35', 'b3f35', , , , 'b5c44', 'b5c55', 'h3f35', 'a4e45', , 'c4e45', , 'b5c44', , 'b5c45', 'h4e45', , , 'b5c46', ,
-        'b5c44', 'b5c45', , 'h5f35', 'a6c87', 'b5c47', 'c6e45', , 'b5c44', 'f6f35', 'g6e45', , 'a7d77', 'b7e45', 'c7e56', , 'b5c44', 'f7f35', 'b5c46',
-        'h7e45', 'a8e45', 'b8e56', 'b5c46', , 'b5c44', 'f8f35', 'b5c46', 'h8e56', 'a1e56', 'b1e45', , , , 'c5d45', 'c5d45', 'c5d45', , , , , , , , , 'a3f35',
-        'b3f35', , , , 'c5c44', 'c5d55', 'c5d45', 'a4e45', , 'c5d44', , 'c5d44', , 'c5c45', 'c5d45', , 'c5d45', , , 'c5c44', 'c5d45', , 'c5d45', 'c5d44',
-        'c5d45', 'c5d44', , 'c5d44', 'c5d45', 'c5d44', , 'c5d45', 'b7e45', 'c5d45', , 'c5c44', 'c5d45', 'c5d45', 'c5d45', 'c5d44', 'b8g35', 'c5d45',
-        ,
-        'c5c44', 'c5d45', 'c5d44', 'c5d45', 'a1d45', 'd5d45', , , , 'd5d45', 'd5d45', 'd5d45', , , , , , , , , 'a3f35', 'd5e44', , , , 'd5c44', 'd5d45', 'd5d45',
-        'a4d45', , 'd5e44', , 'd5d44', , 'd5c45', 'd5d45', , 'd5e45', 'd5e44', , 'd5c44', 'd5d45', , 'd5d45', 'd5d44', 'b6d45', 'd5e44', 'd5d45', 'd5d44',
-        'd5d45', 'd5d44', , 'a7d45', 'd5d45', 'd5e44', 'd5d45', 'd5c44', 'd5d45', 'd5d45', 'd5d45', 'd5d44', 'b8g35', 'd5e44', 'd5d45', 'd5c44',
-        'd5d45', 'd5d44', 'd5d45', 'e5e45', 'e5d45', , , , 'e5d45', 'e5d45', 'e5d45', , , , , , , , , 'e5e45', 'e5e44', , , , 'e5d45', 'e5d45', 'e5d45', 'e5e45',
-        ,
-        'e5f44', , 'e5d44', , 'e5e46', 'e5d45', , 'e5e45', 'e5e44', , , 'e5d45', , 'e5d45', 'e5d44', 'e5d45', 'e5e44', , 'e5d44', 'e5d45', 'e5d44', ,
-        'e5d45', 'e5d45', 'e5e44', , 'e5d45', 'e5d45', 'e5d45', 'e5d45', 'e5d44', 'e5d45', 'e5e44', , 'e5d45', 'e5d45', 'e5d44', 'e5d45', 'f5e45',
-        'b1b36', , , , 'f1f36', 'f5e46', 'h1f36', , , , , , , , , 'f5e45', 'f5e44', , , , 'f3g36', 'f5f46', 'f5e46', 'f5e45', , 'f5f44', , 'e4f36', , 'f5e46',
-        'f5e46', , 'f5e45', 'f5e44', , 'e5g36', , , 'f5e46', 'a6c46', 'b6c56', 'f5e44', , 'e6c46', 'f5e46', 'f5e46', , 'a7c56', 'b7f36', 'f5e44', , 'e7c56',
-        'f7c46', 'f5e46', 'f5f47', 'a8f36', 'b8g36', 'f5e44', , 'e8a46', 'f5e46', 'g8g36', 'f5e46', 'g5f46', 'b1b36', , , , 'f1c46', 'g1c56', 'g5f47',
-        ,
-        , , , , , , , 'a3b46', 'g5f45', , , , 'f3b36', 'g3b36', 'h3b36', 'a4b46', , 'g5f44', , 'e4c46', , 'g4c46', 'h4c46', , 'b5c56', 'g5g45', , 'e5c56', 'f5c56',
-        ,
-        'g5f47', 'a6c46', 'b6c56', 'c6c56', , 'e6c46', 'f6d47', 'g5f47', 'g5f47', 'a7c56', 'b7b46', 'c7c56', , 'e7c56', 'f7c46', 'g7d47', 'g5f47',
-        'a8c87', 'b8b46', 'c8c56', , 'e8e47', 'f8c56', 'g8c46', 'h8d47', 'a1a47', 'b1b36', , , , 'f1c46', 'g1c57', 'h1c67', , , , , , , , , 'a3b36', 'b3c46',
-        ,
-        , , 'f3b36', 'g3b36', 'h3b36', 'a4c46', , 'h5h45', , 'e4c46', , 'g4c46', 'h4c46', , 'b5c46', 'h5g45', , 'e5c57', 'f5c57', , , 'a6c46', 'b6b36',
-        'c6c46', , 'e6c46', 'f6c67', 'g6c67', , 'a7c77', 'b7b36', 'c7c46', , 'e7c57', 'f7c46', 'g7c77', 'h7c77', 'a8c87', 'b8b36', 'c8c46', , 'e8c67',
-        'f8c57', 'g8c46', 'h8c87', 'a1e57', 'a6b57', , , , 'f1f36', 'a6b57', 'h1f36', , , , , , , , , 'a3f36', 'b3f36', , , , 'a6b55', 'a6b56', 'h3f36', 'a4e47',
-        ,
-        'a6b57', , 'a6b55', , 'a6b56', 'a6b67', , 'a6a57', 'a6b57', , 'a6b56', 'a6b56', , 'h5f36', , 'a6b58', 'c6f36', , 'a6b67', 'f6f36', 'a6b57', ,
-        'a6b58', 'b7f36', 'c7e57', , 'a6b67', 'f7f36', 'a6b57', 'a6b57', 'a8f36', 'b8e57', 'a6b57', , 'a6b67', 'f8f36', 'a6b57', 'h8e57', 'a1a37',
-        'b1b37', , , , 'f1f36', 'b6c67', 'h1f36', , , , , , , , , 'a3f36', 'b3f36', , , , 'b6c55', 'b6c55', 'b6c56', 'a4e87', , 'b6c57', , 'b6c55', , 'b6c56',
-        'b6c56', , 'b5e87', 'b6b57', , 'b6c56', 'b6c56', , 'h5f36', 'a6a37', , 'c6f36', , 'b6c56', 'f6f36', 'b6c57', , 'a7e77', 'b7f36', 'c7e77', , 'b6c56',
-        'f7f36', 'b6c57', 'b6c57', 'a8f36', 'b8e87', 'b6c57', , 'b6c56', 'f8f36', 'b6c57', 'b6c57', 'a1a37', 'b1b37', , , , 'f1f36', 'c6d56', 'h1f36',
-        ,
-        , , , , , , , 'a3f36', 'b3f36', , , , 'c6d55', 'c6d55', 'c6d56', 'a4e47', , 'c4e67', , 'c6c55', , 'c6d56', 'c6d56', , 'b5e57', 'c6d56', , 'c6d56', 'c6d56',
-        ,
-        'h5f36', 'a6f17', 'c6d56', , , 'c6d56', 'f6f36', 'c6d67', , 'c6d56', 'b7e77', 'c6d57', , 'c6d56', 'f7f36', 'c6d57', 'c6d67', 'a8e87', 'b8e87',
-        'c6d57', , 'c6d56', 'f8f36', 'c6d57', 'c6d57', 'a1a37', 'b1b36', , , , 'f1f36', 'd6d56', 'h1f36', , , , , , , , , 'a3b36', 'b3f36', , , , 'd6d55', 'd6d55',
-        'd6e56', 'a4b36', , 'c4b36', , 'd6c55', , 'd6d56', 'd6d56', , 'b5b36', 'd6e56', , 'd6d56', 'd6d56', , 'h5f36', 'a6b57', 'b6b36', 'c6f36', , 'd6d56',
-        'f6f36', 'd6e67', , 'd6d56', 'b7f36', 'c7e77', 'd6e67', 'd6d56', 'f7f36', 'd6e57', 'd6e67', 'a8f36', 'b8b36', 'c8e87', 'd6e67', 'd6d56',
-        'f8f36', 'g8b36', 'd6e57', 'a1d46', 'b1b36', , , , 'f1f36', 'e6d56', 'h1f36', , , , , , , , , 'a3b36', 'b3f36', , , , 'e6d55', 'e6d55', 'e6e56', 'a4d46',
-        ,
-        'c4d46', , 'e4f36', , 'e6d56', 'e6d56', , 'b5b36', 'c5d46', , 'e5d46', 'e6d56', , 'h5f36', 'a6c87', 'b6d46', 'c6f36', , , 'f6f36', 'e6e57', ,
-        'a7d46', 'b7f36', 'c7c87', , 'e6d56', 'f7f36', 'g7d46', 'e6e57', 'a8f36', 'b8b36', 'c8d87', , 'e6d56', 'f8f36', 'e6e57', 'h8d46', 'a1a37',
-        'b1b36', , , , 'f1f37', 'f6f57', 'f6e57', , , , , , , , , 'a3b36', 'f6g66', , , , 'f3b36', 'f6f56', 'f6e56', 'a4b36', , 'c4b36', , 'e4f37', , 'f6f57',
-        'f6f57', , 'b5b36', 'f6g56', , 'e5g37', 'f5h37', , 'f6e57', 'a6c87', 'b6b36', 'c6c77', , 'e6b36', , 'f6e57', , 'a7c77', 'b7b36', 'c7c87', , 'e7e47',
-        'f7b36', 'f6e57', 'f6e57', 'a8c87', 'b8b36', 'c8h37', , 'e8e47', 'f6f57', 'g8b36', 'f6e57', 'a1a37', 'b1b36', , , , 'f1c47', 'g1d47', 'g6g58',
-        ,
-        , , , , , , , 'a3b36', 'g6h56', , , , 'f3b36', 'g3b36', 'h3b36', 'a4b36', , 'c4b36', , 'e4d47', , 'g4d47', 'g6f57', , 'b5b36', 'g6g56', , 'e5d47', 'f5c57',
-        ,
-        'h5c57', 'a6b57', 'b6b36', 'c6c57', , 'e6b36', 'f6d47', , , 'a7c57', 'b7b36', 'c7c57', , 'e7c57', 'f7b36', 'g7d47', 'g6g58', 'a8a47', 'b8b36',
-        'c8c57', , 'e8b57', 'f8c57', 'g8b36', 'h8d47', 'a1a38', 'b1b37', , , , 'f1c47', 'g1c57', 'h1f38', , , , , , , , , 'a3b47', 'h6h56', , , , 'f3b37', 'g3b37',
-        'h3b37', 'a4b47', , 'h6h56', , 'e4c47', , 'g4c47', 'h4c47', , 'b5c57', 'h6g56', , 'e5c57', 'f5c57', , 'h5c57', 'a6c47', 'b6c57', 'c6c57', , 'e6c47',
-        'f6f38', 'g6g38', , 'a7c57', 'b7b47', 'c7c57', , 'e7c57', 'f7c47', 'g7g38', 'h6g58', 'a8c88', 'b8b47', 'c8c57', , 'e8e48', 'f8c57', 'g8c47',
-        'h8d48', 'a1e58', 'a7b68', , , , 'f1f37', 'g1g37', 'h1f37', , , , , , , , , 'a3f37', 'a7b67', , , , 'a7b66', 'a7b77', 'a7b67', 'a4e88', , 'a7b68', , 'a7b77',
-        ,
-        'a7b67', 'a7b67', , 'a7b68', 'a7b68', , 'a7b67', 'a7b67', , 'h5f37', 'a6e68', 'b6e68', 'c6f37', , 'a7b67', 'f6f37', 'g6g37', , , 'b7f37', 'c7g37',
-        ,
-        'a7b67', 'f7f37', 'g7g37', 'a7b68', 'a8f37', 'b8g37', 'a7b68', , 'a7b67', 'f8f37', 'g8g37', 'a7b68', 'a1a38', 'b1e47', , , , 'b7c67', 'b7c67',
-        'h1f37', , , , , , , , , 'a3f37', 'b3f37', , , , 'b7c66', 'b7c77', 'b7c67', 'a4e47', , 'c4e47', , 'b7c77', , 'b7c67', 'b7c67', , 'b5e88', 'b7c68', , 'b7c67',
-        'b7c67', , 'b7c67', 'a6e68', 'b6e68', 'c6e47', , 'b7c67', 'f6f37', 'g6g37', , 'a7d48', , 'c7g37', , 'b7c67', 'f7f37', 'g7g37', 'h7e47', 'a8e88',
-        'b8g37', 'b7c68', , 'b7c67', 'f8f37', 'g8g37', 'b7c68', 'a1a38', 'b1e47', , , , 'c7d67', 'c7d67', 'c7d67', , , , , , , , , 'a3f37', 'c7d66', , , , 'c7d66',
-        'c7d77', 'c7d67', 'a4e47', , 'c4e47', , 'c7d77', , 'c7d67', 'c7d67', , 'c7d67', 'c7d67', , 'c7d67', 'c7d67', , 'c7d67', 'c7d67', 'b6e68', 'c6e47',
-        ,
-        'c7d67', 'c7d67', 'c7d67', , 'a7d48', 'b7e47', , , 'c7d67', 'f7f37', 'g7g37', 'c7d67', 'a8e47', 'b8e88', 'c7d68', , 'c7d67', 'f8f37', 'g8g37',
-        'c7d68', 'd7e67', 'b1e47', , , , 'd7e67', 'd7e67', 'd7d67', , , , , , , , , 'a3f37', 'd7e66', , , , 'd7e66', 'd7e77', 'd7e67', 'a4e47', , 'c4e47', , 'd7e67',
-        ,
-        'd7e67', 'd7e67', , 'd7e67', 'd7e67', , 'd7e67', 'd7e67', , 'd7e67', 'd7e67', 'b6d88', 'c6e47', , 'd7d67', 'd7d67', 'd7e67', , 'a7b68', 'b7e47',
-        'c7g37', , 'd7d67', 'f7f37', 'g7g37', 'd7e67', 'a8e47', 'b8g37', 'd7e67', 'd7e67', 'd7d67', 'f8f37', 'g8g37', 'd7e68', 'e7e67', 'e7e67',
-        ,
-        , , 'e7e67', 'e7e67', 'e7d67', , , , , , , , , 'a3f37', 'e7f66', , , , 'e7e66', 'e7f77', 'e7f67', 'e7f67', , 'e7f67', , 'e4f37', , 'e7e67', 'e7e67',
-        ,
-        'e7f67', 'e7f67', , 'e5g37', 'e7e67', , 'e7e67', 'e7e67', 'b6d88', 'c6f37', , 'e7d67', 'e7d67', 'e7e67', , 'a7d78', 'b7f37', 'c7g37', , , 'f7f37',
-        'g7g37', 'e7e67', 'a8f37', 'b8g37', 'e7f67', , 'e7d67', 'f8f37', 'g8g37', 'e7f68', 'f7e67', 'f7e67', , , , 'f1f37', 'f7e67', 'h1f37', , , , , ,
-        ,
-        , , 'a3f37', 'f7g66', , , , 'f7e66', 'f7f67', 'f7f67', 'f7g67', , 'f7g67', , 'e4f37', , 'f7e67', 'f7e67', , 'f7g67', 'f7g67', , 'e5g37', 'f5f37',
-        ,
-        'f7e67', 'f7e67', 'b6d88', 'c6f37', , 'e6g48', 'f6f37', 'f7e67', , 'a7d78', 'b7f37', 'c7g37', , 'e7g58', , 'g7g37', 'f7e67', 'a8f37', 'b8g37',
-        'f7f67', , 'e8e58', 'f7g68', 'g8g37', 'f7f68', 'a1a38', 'b1b38', , , , 'f1f38', 'g1g38', 'g7f68', , , , , , , , , 'g7g67', 'g7g66', , , , 'g7f67', 'g7f67',
-        'g7f67', 'g7g67', , 'g7h67', , 'g7f67', , 'g4h38', 'g7g68', , 'g7g67', 'g7h67', , 'e5g38', 'f5h38', , 'g7g68', 'a6c48', 'b6c58', 'g7f67', , 'e6h38',
-        'f6f38', 'g6g38', , 'a7c58', 'b7f38', 'g7f67', , 'e7c58', 'f7f38', , 'g7f68', 'a8f38', 'b8g38', 'g7f67', , 'e8a48', 'f8f38', 'g7f68', 'g7f68',
-        'a1a38', 'b1b38', , , , 'f1f38', 'g1g38', 'h1f38', , , , , , , , , 'h7g67', 'h7g66', , , , 'f3g38', 'g3f38', 'h3g38', 'h7g67', , 'h7h67', , 'e4f38', ,
-        'g4g38', 'h4g38', , 'h7g67', 'h7h67', , 'e5g38', 'f5f38', , 'h5f38', 'a6c48', 'b6c58', 'c6f38', , 'e6c48', 'f6f38', 'g6g38', , 'a7c58', 'b7f38',
-        'c7g38', , 'e7c58', 'f7f38', 'g7g38', , 'a8f38', 'b8g38', 'c8c58', , 'e8a48', 'f8f38', 'g8g38', 'h8d48', 'a1a39', 'a8b89', , , , 'f1f38', 'a8b89',
-        'h1f38', , , , , , , , , 'a3f38', 'a8b88', , , , 'a8b77', 'a8b77', 'a8b78', 'a4e89', , 'a8b89', , 'a8b77', , 'a8b78', 'a8b78', , 'a8b89', 'a8b79', , 'a8b78',
-        'a8b78', , 'h5f38', 'a6e69', 'a8b79', 'c6f38', , 'a8b78', 'f6f38', 'a8b79', , 'a7e79', 'b7f38', 'a8b79', , 'a8b78', 'f7f38', 'a8b79', 'a8b79',
-        ,
-        'a8b79', 'a8b79', , 'a8b78', 'f8f38', 'a8b79', 'a8b79', 'a1a39', 'b1b38', , , , 'b8c78', 'b8c78', 'b8c78', , , , , , , , , 'a3b38', 'b3f38', , , , 'b8c77',
-        'b8c77', 'b8c78', 'a4b38', , 'b8c78', , 'b8c77', , 'b8c78', 'b8c78', , 'b5b38', 'b8c89', , 'b8c78', 'b8c78', , 'b8c78', 'a6e69', 'b6b38', 'c6f38',
-        ,
-        'b8c78', 'f6f38', 'b8c79', , 'a7e79', 'b7f38', 'b8c89', , 'b8c78', 'f7f38', 'b8c79', 'b8c79', 'a8f38', , 'b8c79', , 'b8c78', 'f8f38', 'g8b38',
-        'b8c79', 'c8d78', 'b1b38', , , , 'c8d78', 'c8d78', 'c8d78', , , , , , , , , 'a3b38', 'b3f38', , , , 'c8d77', 'c8d77', 'c8d78', 'a4b38', , 'c4b38', , 'c8d77',
-        ,
-        'c8d78', 'c8d78', , 'b5b38', 'c8d78', , 'c8d78', 'c8d78', , 'c8d78', 'a6c69', 'b6b38', 'c6f38', , 'c8d78', 'c8d78', 'c8d79', , 'c8d78', 'b7f38',
-        'c7d89', , 'c8d78', 'f7f38', 'c8d79', 'c8d79', 'a8f38', 'b8b38', , , 'c8d78', 'f8f38', 'g8b38', 'c8d79', 'a1d48', 'b1b38', , , , 'd8e78', 'd8e78',
-        'd8e78', , , , , , , , , 'a3b38', 'b3f38', , , , 'd8e77', 'd8e77', 'd8e78', 'a4d48', , 'c4d48', , 'd8d77', , 'd8e78', 'd8e78', , 'b5b38', 'c5d48', , 'd8e78',
-        'd8e78', , 'd8e78', 'a6c89', 'b6d48', 'c6f38', , 'd8e78', 'd8e78', 'd8e79', , 'a7d48', 'b7f38', 'c7c89', , 'd8d78', 'f7f38', 'g7d48', 'd8e79',
-        'a8f38', 'b8b38', 'c8d79', , 'd8e78', 'f8f38', 'g8b38', 'h8d48', 'a1d48', 'b1b38', , , , 'e8f78', 'e8f78', 'e8e78', , , , , , , , , 'a3b38', 'b3f38',
-        ,
-        , , 'e8f77', 'e8f77', 'e8f78', 'a4d48', , 'c4d48', , 'e8d77', , 'e8f78', 'e8f78', , 'b5b38', 'c5d48', , 'e5d48', 'e8e78', , 'e8f78', 'a6c89',
-        'b6d48', 'c6f38', , 'e6b38', 'e8e78', 'e8f79', , 'a7d48', 'b7f38', 'c7c89', , 'e8d78', 'f7f38', 'g7d48', 'e8f79', 'a8f38', 'b8b38', 'c8d89',
-        ,
-        , 'f8f38', 'g8b38', 'h8d48', 'a1d48', 'b1b38', , , , 'f1f38', 'f8f78', 'f8e78', , , , , , , , , 'a3b38', 'b3f38', , , , 'f8f77', 'f8f77', 'f8g78', 'a4d48',
-        ,
-        'c4d48', , 'e4f38', , 'f8f78', 'f8f78', , 'b5b38', 'c5d48', , 'e5d48', 'f5f38', , 'f8f78', 'a6c89', 'b6d48', 'c6f38', , 'e6b38', 'f6f38', 'f8g79',
-        ,
-        'a7d48', 'b7f38', 'c7c89', , 'e7e89', 'f7f38', 'g7d48', 'f8g79', 'a8f38', 'b8b38', 'c8d89', , 'f8e78', , 'g8b38', 'h8d48', 'a1d48', 'b1b38',
-        ,
-        , , 'f1f38', 'g1d48', 'h1f38', , , , , , , , , 'a3b38', 'b3f38', , , , 'g8f77', 'g8f77', 'g8g78', 'a4d48', , 'c4d48', , 'e4f38', , 'g4f38', 'g8f78',
-        ,
-        'b5b38', 'c5d48', , 'e5d48', 'f5f38', , 'g8f78', 'a6c89', 'b6d48', 'c6f38', , 'e6b38', 'f6f38', 'g6h59', , 'a7d48', 'b7f38', 'c7c89', , 'e7g59',
-        'f7f38', 'g7d48', 'g8g79', 'a8f38', 'b8b38', 'c8d89', , 'e8h59', 'f8f38', , 'h8d48', 'a1a39', 'b1b38', , , , 'f1f39', 'g1g39', 'h1h39', , , , ,
-        ,
-        , , , 'a3b38', 'h8h78', , , , 'f3b38', 'g3b38', 'h3b38', 'a4b38', , 'c4b38', , 'e4f39', , 'g4h39', 'h4h39', , 'b5b38', 'h8h78', , 'e5g39', 'f5h39',
-        ,
-        'h5h39', 'a6c89', 'b6b38', 'c6c79', , 'e6b38', 'f6f39', 'g6g39', , 'a7c79', 'b7b38', 'c7c89', , 'e7e49', 'f7b38', 'g7g39', 'h7h39', 'a8c89',
-        'b8b38', 'c8h39', , 'e8e49', 'f8f39', 'g8b38', , , 'b1e46', , 'a1a26', , 'f1f46', 'g1g46', 'h1e46', , , , , 'e2e46', 'f2f46', 'g2g46', 'h2f46',
-        ,
-        , , , , , , , , , , , 'a1a24', 'a1a25', 'a1a26', 'a1b16', , , , , , 'f5g46', 'g5g46', 'h5g46', , , , , , , 'g6g46', 'h6f46', , , , , , , , 'h7e46', , , , , , , , , , , ,
-        'd1d54', , 'f1f45', 'g1g46', 'h1e44', 'a2d54', , , , 'e2e44', 'f2f45', 'g2e44', 'h2f45', , , , , , , , , 'a4e44', , , , 'b1c14', 'f4e44', 'g4e44', 'h4e44',
-        ,
-        'b5d54', , 'b1c14', , 'f5e44', 'g5d54', 'h5d54', 'a6d65', 'b6d65', , 'd6d54', 'e6e44', , 'g6e44', 'h6f45', 'a7d76', 'b7d54', , 'd7d54', 'e7e44',
-        'f7d54', , 'h7e44', 'a8d54', 'b8d65', , 'd8d54', 'e8e44', 'f8f45', 'g8d54', , , 'b1e44', , 'd1d54', , 'f1f45', 'g1g46', 'h1e44', 'a2d54', , , ,
-        'e2e44', 'f2f45', 'g2e44', 'h2f45', , , , , , , , , 'a4e44', , , , 'c1b14', 'f4e44', 'g4e44', 'h4e44', , 'b5d54', , 'c1d14', , 'f5e44', 'g5d54', 'h5d54',
-        'a6d65', 'b6d65', , 'd6d54', 'e6e44', , 'g6e44', 'h6f45', 'a7d76', 'b7d54', , 'd7d54', 'e7e44', 'f7d54', , 'h7e44', 'a8d54', 'b8d65', , 'd8d54',
-        'e8e44', 'f8f45', 'g8d54', , , 'b1e45', , , , 'f1f46', 'g1g46', 'h1d54', 'a2d54', , , , 'e2e45', 'f2f46', 'g2d54', 'h2d65', , , , , , , , , 'd1e24', ,
-        ,
-        , 'd1c14', 'd1e25', 'd1e25', 'd1e25', , 'b5d54', , 'd1c14', , 'f5d54', 'g5d54', 'h5d54', 'a6d65', 'b6d65', , 'd6d54', 'e6d54', , 'g6e45', 'h6d65',
-        'a7d76', 'b7d54', , 'd7d54', 'e7e45', 'f7d54', , 'h7e45', 'a8d54', 'b8d65', , 'd8d54', 'e8e45', 'f8d65', 'g8d54', , , 'b1e46', , 'd1d56', , 'f1f47',
-        'g1g37', 'h1e46', 'a2a46', , , , 'e2e46', 'f2f47', 'g2e46', 'h2e56', , , , , , , , , 'e1e24', , , , 'e1e25', 'e1e25', 'e1e25', 'e1e25', , 'b5d56', , 'e1d14',
-        ,
-        'f5e46', 'g5e56', 'h5e56', 'a6d66', 'b6d66', , 'e1d15', 'e1e26', , 'g6e46', 'h6d66', 'a7a46', 'b7d56', , 'd7d66', 'e7e56', 'f7d56', , 'h7e46',
-        'a8d56', 'b8d66', , 'd8d66', 'e8e56', 'f8d66', 'g8d56', , , 'b1e46', , 'd1a46', , , 'g1g47', 'h1e46', 'a2a46', , , , 'e2e46', 'f2f47', 'g2e46',
-        'f1e17', , , , , , , , , 'f1e24', , , , 'f1e25', 'f1e25', 'f1e25', 'f1e25', , 'b5a46', , 'd5e46', , 'f5e46', 'f1f27', 'f1f27', 'a6a46', 'b6d67', , 'f1e16',
-        'e6e46', , 'g6e46', 'f1e17', 'a7a46', 'b7e46', , 'd7a46', 'e7e46', 'f1e27', , 'h7e46', 'a8e46', 'b8d67', , 'd8h47', 'e8e46', 'f1e17', 'f1e27',
-        ,
-        , 'b1b57', , 'd1a46', , 'f1f47', , 'h1h47', 'a2a46', , , , 'e2e47', 'f2f47', 'g2g47', 'h2h47', , , , , , , , , 'g1g26', , , , 'e4a46', 'f4a46', 'g4a46',
-        'h4a46', , 'b5a46', , 'd5e47', , 'f5g47', 'g1f27', 'g1f27', 'a6a46', 'b6c57', , 'd6f47', 'e6g47', , 'g6g47', 'h6h47', 'a7a46', 'b7e47', , 'd7a46',
-        'e7h47', 'f7f47', , 'h7h47', 'a8a46', 'b8f47', , 'd8h47', 'e8a46', 'f8f47', 'g8g47', , , 'b1b58', , 'd1a48', , 'f1f48', 'g1c58', , 'a2a48', , ,
-        ,
-        'e2e48', 'f2f48', 'g2e48', 'h2f48', , , , , , , , , 'h1g16', , , , 'h1g17', 'h1g17', 'h1g17', 'h1g17', , 'h1g26', , 'd5e48', , 'f5f48', 'g5f48', 'h1g18',
-        'a6c68', 'b6c68', , 'd6f48', 'e6e48', , 'g6e48', 'h1g28', 'a7c58', 'b7c68', , 'd7c68', 'e7e48', 'f7f48', , 'h7e48', 'a8c68', 'b8f48', , 'h1g18',
-        'e8e48', 'f8f48', 'g8g69', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b1e45', , 'd1a44', , 'f1f45', 'g1g45', 'h1h45', 'a2a44', , , , , 'f2f45', 'g2g45', 'h2h45', , , ,
-        ,
-        , , , , 'e2e34', , , , 'e4a44', 'f4a44', 'g4a44', 'h4a44', , 'b5a44', , 'e2d14', , 'f5g45', 'g5h45', 'h5h45', 'a6a44', 'b6c55', , 'd6f45', 'e6g45',
-        ,
-        'g6g45', 'h6h45', 'a7a44', 'b7e45', , 'd7a44', 'e7h45', 'f7f45', , 'h7h45', 'a8a44', 'b8f45', , 'd8h45', 'e8a44', 'f8f45', 'g8g45', , , 'b1b56',
-        ,
-        'd1a46', , 'f1b56', 'f2f37', 'f2e36', 'a2a46', , , , 'e2e46', , 'f2e36', 'h2f46', , , , , , , , , 'f2e24', , , , 'f2e25', 'f2e25', 'f2e25', 'f2e25',
-        ,
-        'f2e34', , 'd5e46', , 'f2e36', 'f2e36', 'f2e36', 'a6b56', 'b6c56', , 'd6f46', 'e6e46', , 'f2e36', 'f2e36', 'a7c56', 'b7e46', , 'd7b56', 'e7e46',
-        'f2e36', , 'h7e46', 'a8e46', 'b8f46', , 'f2e36', 'e8e46', 'f8f46', 'f2e36', , , 'b1b56', , 'd1a46', , 'f1b56', 'g1c57', 'h1h47', 'a2a46', , , ,
-        'e2b56', 'f2f47', , 'h2h47', , , , , , , , , 'a4b56', , , , 'e4a46', 'f4a46', 'g4a46', 'h4a46', , 'b5a46', , 'd5b56', , 'f5b56', 'g5b56', 'h5b56', 'a6b56',
-        'b6b56', , 'd6f47', 'e6g47', , 'g2f37', 'g2f37', 'a7a46', 'b7b56', , 'd7b56', 'e7h47', 'f7f47', , 'h7h47', 'a8a46', 'b8b56', , 'd8h47', 'e8b56',
-        'f8f47', 'g8g47', , , 'b1b58', , 'd1a48', , 'f1f48', 'g1c58', 'h1e48', 'a2a48', , , , 'e2e48', 'f2f48', 'g2e48', , , , , , , , , , 'h2g16', , , , 'h2g17',
-        'h2g17', 'h2g17', 'h2g17', , 'h2g26', , 'd5e48', , 'f5f48', 'g5f48', 'h2g18', 'a6c68', 'b6c68', , 'd6f48', 'e6e48', , 'g6e48', 'h2g28', 'a7c58',
-        'b7c68', , 'd7c68', 'e7e48', 'f7f48', , 'h7e48', 'a8c68', 'b8f48', , 'h2g18', 'e8e48', 'f8f48', 'h2g38', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b1b54', , 'd1a44',
-        ,
-        'f1b54', 'g1g45', 'h1h45', 'a2a44', , , , 'e2b54', 'f2f45', 'g2g45', 'h2h45', , , , , , 'f3f45', 'g3g45', 'h3h45', 'a4b54', , , , 'e4a44', 'f4a44',
-        'g4a44', 'h4a44', , 'b5a44', , 'd5b54', , 'f5b54', 'g5b54', 'h5b54', 'a6b54', 'b6b54', , 'd6f45', 'e6g45', , 'g6g45', 'h6h45', 'a7a44', 'b7b54',
-        ,
-        'd7b54', 'e7h45', 'f7f45', , 'h7h45', 'a8a44', 'b8b54', , 'd8h45', 'e8b54', 'f8f45', 'g8g45', , , 'b1b56', , 'd1a46', , 'f1b56', 'f3e46', 'f3e36',
-        'a2a46', , , , 'e2e46', 'f2c56', 'f3e36', 'h2f46', , , , , , , 'g3f46', 'f3e27', 'f3e24', , , , 'f3e25', 'f3e25', 'f3e25', 'f3e25', , 'f3e34', , 'd5e46',
-        ,
-        'f3e36', 'f3e36', 'f3e36', 'a6c66', 'b6c66', , 'd6f46', 'e6e46', , 'f3e36', 'f3e36', 'a7c56', 'b7c66', , 'd7c66', 'e7e46', 'f3e36', , 'h7e46',
-        'a8c66', 'b8f46', , 'f3e36', 'e8e46', 'f8f46', 'f3e36', , , 'b1b56', , 'd1a46', , 'f1b56', 'g1c57', 'g3f47', 'a2a46', , , , 'e2b56', 'f2f47', 'g2e47',
-        'h2h47', , , , , , , , 'h3h47', 'a4b56', , , , 'e4a46', 'f4a46', 'g4a46', 'h4a46', , 'b5a46', , 'd5b56', , 'f5b56', 'g5b56', 'h5b56', 'a6b56', 'b6b56',
-        ,
-        'd6f47', 'e6g47', , 'g3f37', 'g3f37', 'a7a46', 'b7b56', , 'd7b56', 'e7h47', 'f7f47', , 'h7h47', 'a8a46', 'b8b56', , 'd8h47', 'e8b56', 'f8f47',
-        'g8g47', , , 'b1b58', , 'd1a48', , 'f1f48', 'g1c58', 'h1e48', 'a2a48', , , , 'e2e48', 'f2f48', 'g2e48', 'h2f48', , , , , , , , , 'h3g26', , , , 'h3g27',
-        'h3g27', 'h3g27', 'h3g27', , 'h3g26', , 'd5e48', , 'f5f48', 'g5f48', 'h3g28', 'a6b68', 'b6c68', , 'd6f48', 'e6e48', , 'g6e48', 'h3g28', 'a7b68',
-        'b7c68', , 'd7c68', 'e7e48', 'f7f48', , 'h7e48', 'a8c68', 'b8f48', , 'd8b68', 'e8e48', 'f8f48', 'h3g38', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b1b55', , 'd1d35',
-        ,
-        'f1d35', 'g1d45', 'e4e36', 'a2a45', , , , 'e2d35', 'f2d45', 'e4e36', 'h2h56', , , , , , , , , 'e4e34', , , , , 'e4e35', 'e4e35', 'e4e35', , 'e4e34',
-        ,
-        'd5d45', , 'f5c55', 'g5c55', 'h5c55', 'a6c65', 'b6c65', , 'd6d45', 'e6c65', , 'g6c65', 'h6c65', 'a7c55', 'b7c65', , 'd7d45', 'e7c55', 'e4e36',
-        ,
-        'e4d56', 'a8c65', 'b8b55', , 'd8d45', 'e8c65', 'f8c55', 'e4e36', , , 'b1b56', , 'd1a46', , 'f1b56', 'f4e46', 'f4e36', 'a2a46', , , , 'e2e46',
-        'f2c56', 'f4e36', 'f4e37', , , , , , , , , 'f4e34', , , , 'f4e35', , 'f4e35', 'f4e35', , 'f4e34', , 'd5e46', , 'f4e36', 'f4e36', 'f4e36', 'a6c66', 'b6c66',
-        ,
-        'd6c56', 'e6e46', , 'f4e36', 'f4e36', 'a7c56', 'b7c66', , 'd7c66', 'e7e46', 'f4e36', , 'h7e46', 'a8c66', 'b8b56', , 'f4e36', 'e8e46', 'f8c56',
-        'f4e36', , , 'b1b56', , 'd1a46', , 'f1b56', 'g1c57', 'g4f47', 'a2a46', , , , 'e2b56', 'f2f47', 'g2e47', 'h2f47', , , , , , , , , 'a4b56', , , , 'e4a46',
-        'f4a46', , 'g4g37', , 'b5a46', , 'd5b56', , 'f5b56', 'g5b56', 'h5b56', 'a6b56', 'b6b56', , 'd6f47', 'e6e47', , 'g4f37', 'g4f37', 'a7a46', 'b7b56',
-        ,
-        'd7b56', 'e7e47', 'f7f47', , 'h7e47', 'a8a46', 'b8b56', , 'g4f37', 'e8b56', 'f8f47', 'g4g58', , , 'b1b58', , 'd1a48', , 'f1f48', 'g1c58', 'h1e48',
-        'a2a48', , , , 'e2e48', 'f2f48', 'g2e48', 'h2f48', , , , , , , , , 'h4g36', , , , 'h4g37', 'h4g37', 'h4g37', , , 'h4g36', , 'd5e48', , 'f5f48', 'g5f48',
-        'h4g38', 'a6b68', 'b6c68', , 'd6f48', 'e6e48', , 'g6e48', 'h4g38', 'a7b68', 'b7c68', , 'd7c68', 'e7e48', 'f7f48', , 'h7e48', 'a8c68', 'b8f48',
-        ,
-        'd8b68', 'e8e48', 'f8f48', 'h4g38', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b1b56', , 'e5d55', , 'e5e46', 'e5e46', 'e5d56', , , , , 'e5d55', 'e5e46', 'e5d56', 'h2e26',
-        ,
-        , , , , , , , , , , , 'e4e36', 'e5d56', 'e5d56', 'e5d56', , , , , , 'e5e46', 'e5e46', 'e5e46', , , , , , 'e5e46', 'e5e46', 'e5e46', , , , , , , 'e5e46', 'e5d56',
-        ,
-        , , , , , , 'e5e46', , 'b1b56', , 'd1a46', , 'f1b56', 'f5e46', 'f5f47', 'a2a46', , , , 'e2b56', 'f2c56', 'f5f47', 'f5e47', , , , , , , , , 'f5e45', , , , 'e4a46',
-        'f4a46', 'g4a46', 'h4a46', , 'f5e45', , 'd5c56', , , 'f5e46', 'f5e46', 'a6b56', 'b6c56', , 'd6c56', 'f5e46', , 'f5e46', 'f5e46', 'a7c56', 'b7b56',
-        ,
-        'd7b56', 'e7c56', 'f5e46', , 'f5e47', 'a8a46', 'b8b56', , 'f5e46', 'e8b56', 'f8c56', 'f5e46', , , 'b1b57', , 'd1a47', , 'f1b57', 'g1c57', 'g5f47',
-        'a2a47', , , , 'e2e47', 'f2c57', 'g2e47', 'g5f48', , , , , , , , , 'g5g46', , , , 'g5f46', 'f4e47', 'g4e47', 'g5f57', , 'g5g46', , 'd5e47', , 'f5e47',
-        ,
-        'g5f47', 'a6c67', 'b6c67', , 'd6c57', 'e6e47', , 'g5f47', 'g5f47', 'a7c57', 'b7c67', , 'd7c67', 'e7e47', 'f7g88', , 'h7e47', 'a8c67', 'b8b57',
-        ,
-        'g5f47', 'e8e47', 'f8c57', 'g5f48', , , 'b1b58', , 'd1a48', , 'f1f48', 'g1c58', 'h1e48', 'a2a48', , , , 'e2e48', 'f2f48', 'g2e48', 'h2f48', ,
-        ,
-        , , , , , , 'h5g46', , , , 'h5g47', 'h5g47', 'g4f48', 'h4f48', , 'h5g46', , 'd5e48', , 'f5f48', 'g5f48', , 'a6b68', 'b6c68', , 'd6f48', 'e6e48', , 'g6e48',
-        'h5g48', 'a7b68', 'b7c68', , 'd7c68', 'e7e48', 'f7f48', , 'h7e48', 'a8c68', 'b8f48', , 'd8b68', 'e8e48', 'f8f48', 'h5g58', , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b1d17', , 'f6e56', , 'f6e56', 'f6f57', 'f6e57', , , , , 'f6e56', 'f2e37',
-        'f6e57', 'f6f58', , , , , , , , , , , , , 'f6e56', 'f4e37', 'f6f57', 'f6f57', , , , , , 'f5c57', 'f6e57', 'f6e57', , , , , , , 'f6e57', 'f6e57', , , , , , , 'f6e57',
-        'f6e57', , , , , , , , 'f6e57', , 'b1b58', , 'd1a47', , 'f1f48', 'g1c57', 'g6g58', 'a2a47', , , , 'e2e38', 'f2c57', 'g2g48', 'g6f58', , , , , , , , , 'g6f56',
-        ,
-        , , 'e4a47', 'f4a47', 'g4a47', 'g6f57', , 'g6f56', , 'd5c57', , 'f5c57', 'g5c57', 'h5c57', 'a6a47', 'b6c57', , 'd6c57', 'e6e78', , , 'g6g58',
-        'a7c57', 'b7c88', , 'd7a47', 'e7c57', 'f7f48', , 'g6f58', 'a8a47', 'b8c88', , 'g6f57', 'e8a47', 'f8c57', 'g6g58', , , 'b1b58', , 'd1a48', , 'f1b58',
-        'g1c58', 'h1e48', 'a2a48', , , , 'e2e48', 'f2c58', 'g2e48', 'h2h49', , , , , , , , , 'h6g57', , , , 'h6g57', 'f4e48', 'g4e48', 'h4e48', , 'h6g57', , 'd5e48',
-        ,
-        'f5e48', 'g5c58', 'h5c58', 'a6c68', 'b6c68', , 'd6c58', 'e6e48', , 'g6e48', , 'a7c58', 'b7c68', , 'd7c68', 'e7e48', 'h6g58', , 'h7e48', 'a8c68',
-        'b8b58', , 'h6g58', 'e8e48', 'f8c58', 'h6g58', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b1e48', , 'g7f67', , 'f1d18', 'g1d18', 'g7f68', , , , , 'e2e38', 'f2e38',
-        'g2e48', 'g7f68', , , , , , , , , , , , , 'e4e38', 'f4e38', 'g4d18', 'g7g68', , , , , , 'f5e48', 'g5e38', 'g7f68', , , , , , , 'g6e48', 'g7f68', , , , , , , , 'g7f68',
-        ,
-        , , , , , , 'g7f68', , 'b1b59', , 'd1a48', , 'h7g68', 'g1c58', 'h1h49', 'a2a48', , , , 'h7g68', 'f2c58', 'g2g49', 'h2h49', , , , , , , , , 'h7g67', , , , 'e4a48',
-        'f4a48', 'g4a48', 'h4a48', , 'b5c58', , 'd5c58', , 'f5c58', 'g5c58', 'h5c58', 'a6a48', 'b6c58', , 'd6c58', 'e6e79', , 'g6g49', 'h6h49', 'a7c58',
-        'b7c89', , 'd7a48', 'e7c58', 'f7f89', , , 'a8a48', 'b8c89', , 'h7g68', 'e8a48', 'f8c58', 'g8g49', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b1d19', , 'h8g78', , 'f1d19', 'g1d19', 'h1d19', , , , , 'e2e39', 'f2e39', 'h8g79', 'h8g79',
-        ,
-        , , , , , , , , , , , 'h8g78', 'f4e39', 'g4d19', 'h4a49', , , , , , 'f5c59', 'g5e39', 'h5d19', , , , , , , 'h8g79', 'h6e39', , , , , , , , 'h8g79', , , , , , , , , , , 'c1f46',
-        ,
-        'e1e56', , 'g1g47', 'h1h47', 'a2a47', 'b2e56', , , , 'f2f46', 'g2g47', 'h2f46', , , , , , , , , 'a4f46', 'b4f46', , , , 'a1b24', 'a1b25', 'a1b26', 'a5e56',
-        ,
-        'c5e56', , 'a1b25', , 'g5f46', 'h5e56', , 'b6e67', 'c6e67', , 'a1a26', 'f6f46', , 'h6f46', 'a7e77', 'b7e77', 'c7e56', , 'e7e56', 'f7f46', 'g7e56',
-        ,
-        'a8a47', 'b8e56', 'c8e67', , 'e8e56', 'f8f46', 'g8g47', 'h8e56', 'a1e56', , 'c1f45', , 'e1e56', , 'g1g46', 'h1h46', 'a2e66', 'b2e56', , , , 'f2f45',
-        'g2g46', 'h2f45', , , , , , , , , 'a4f45', 'b4f45', , , , 'b1b24', 'b1b25', 'h4f45', 'a5e56', , 'c5e56', , 'b1b25', , 'g5f45', 'h5h46', , 'b6e66', 'c6e66',
-        ,
-        'b1b26', 'f6f45', , 'h6f45', 'a7e77', 'b7e77', 'c7f45', , 'e7h46', 'f7f45', 'g7g46', , 'a8a47', 'b8f45', 'c8e66', , 'e8e66', 'f8f45', 'g8g46',
-        'h8h46', 'a1e55', , , , 'e1e55', , 'g1g45', 'h1h46', 'a2e66', 'b2e55', , , , 'f2f45', 'g2g45', 'h2f45', , , , , , , , , 'a4f45', 'b4f45', , , , 'c1b24',
-        'c1b25', 'h4g45', 'a5e55', , 'c5e55', , 'c1d15', , 'g5g45', 'h5g45', , 'b6e66', 'c6e66', , 'e6g45', 'f6f45', , 'h6f45', 'a7e77', 'b7e77', 'c7e55',
-        ,
-        'e7e55', 'f7f45', 'g7g45', , 'a8d57', 'b8e55', 'c8g45', , 'e8e55', 'f8f45', 'g8g45', 'h8e55', 'a1e55', , 'c1f46', , 'e1e55', , 'g1g46', 'h1h46',
-        'a2d56', 'b2e55', , , , 'f2f46', 'g2g46', 'h2e55', , , , , , , , , 'a4f46', 'b4f46', , , , 'd1c15', 'd1c15', 'd1c16', 'a5e55', , 'c5e55', , 'd1c15', ,
-        'g5e55', 'h5e55', , 'b6e66', 'c6e66', , 'e6e55', 'f6e55', , 'h6h46', 'a7d77', 'b7d56', 'c7e55', , 'e7e55', 'f7f46', 'g7e55', , 'a8d56', 'b8e55',
-        'c8e66', , 'e8e55', 'f8f46', 'g8g46', 'h8e55', 'a1e56', , 'c1c56', , , , 'g1c56', 'h1d56', 'a2d56', 'b2b46', , , , 'f2f46', 'g2d56', 'h2f46', ,
-        ,
-        , , , , , , 'e1f25', 'e1f24', , , , 'e1f26', 'e1f26', 'e1f26', 'a5c56', , 'c5d66', , 'e1d15', , 'g5f46', 'h5e56', , 'b6d66', 'c6d66', , 'e1d16', 'f6f46',
-        ,
-        'h6f46', 'a7c56', 'b7d56', 'c7d66', , 'e7e56', 'f7f46', 'g7e56', , 'a8d56', 'b8d66', 'c8c56', , 'e8e56', 'f8f46', 'g8d56', 'h8e56', 'a1a46',
-        ,
-        'c1c56', , 'e1h46', , 'g1g46', 'h1h46', 'a2a46', 'b2b46', , , , 'f2f46', 'g2g46', 'h2h46', , , , , , , , , 'f1f25', 'f1f24', , , , 'f1f26', 'f1f26',
-        'f1f26', 'a5c56', , 'c5b46', , 'e5f46', , 'g5h46', 'h5h46', , 'b6c56', 'c6c56', , 'e6g46', 'f6h46', , 'h6h46', 'a7c56', 'b7b46', 'c7f46', , 'e7h46',
-        'f7f46', 'g7g46', , 'a8a46', 'b8f46', 'c8g46', , 'e8a46', 'f8f46', 'g8g46', 'h8h46', 'a1a47', , 'c1c56', , 'e1b46', , , 'h1h47', 'a2a47', 'b2b46',
-        ,
-        , , 'f2c56', 'g2g47', 'h2h47', , , , , , , , , 'g1f25', 'g1f24', , , , 'f4b46', 'g1f16', 'g1f16', 'a5c56', , 'c5b46', , 'e5c56', , 'g5c56', 'h5c56',
-        ,
-        'b6c56', 'c6c56', , 'e6g47', 'f6h47', , 'h6h47', 'a7c56', 'b7b46', 'c7c56', , 'e7c56', 'f7f47', 'g7g47', , 'a8a47', 'b8b46', 'c8c56', , 'e8b57',
-        'f8c56', 'g8g47', 'h8h47', 'a1a47', , 'c1c57', , 'e1b46', , 'g1c57', , 'a2a47', 'b2b46', , , , 'f2c57', 'g2g48', 'h2h48', , , , , , , , , 'a4b46', 'h1h26',
-        ,
-        , , 'f4b46', 'g4b46', 'h4b46', 'a5b46', , 'c5b46', , 'e5c57', , 'g5c57', 'h5c57', , 'b6b46', 'c6c57', , 'e6g48', 'f6h48', , 'h1g28', 'a7c57',
-        'b7b46', 'c7c57', , 'e7b46', 'f7f48', 'g7g48', , 'a8a47', 'b8b46', 'c8c57', , 'e8a47', 'f8b46', 'g8g48', 'h8h48', 'a1e56', , 'c1f46', , 'a2b36',
-        ,
-        'g1g47', 'h1h47', , 'b2e56', , , , 'f2f46', 'a2b37', 'h2f46', , , , , , , , , 'a4f46', 'b4f46', , , , 'a2b34', 'a2b35', 'a2b36', 'a5e56', , 'c5e56',
-        ,
-        'a2b34', , 'a2b36', 'h5e56', , 'b6e66', 'c6e66', , 'a2a36', 'f6f46', , 'h6f46', 'a7e77', 'b7e77', 'c7e56', , 'a2b36', 'f7f46', 'g7e56', , 'a8a47',
-        'b8e56', 'c8e66', , 'a2b36', 'f8f46', 'g8e66', 'h8e56', 'a1a47', , 'c1f44', , 'e1e55', , 'g1g45', 'h1h46', 'a2e66', , , , , 'f2f44', 'g2g45', 'h2f44',
-        ,
-        , , , , , , , 'a4f44', 'b4f44', , , , 'b2b34', 'g4f44', 'h4f44', 'a5e55', , 'c5e55', , 'b2b34', , 'g5f44', 'h5g45', , 'b6e66', 'c6e66', , 'e6g45', 'f6f44',
-        ,
-        'h6f44', 'a7e77', 'b7e77', 'c7f44', , 'e7e55', 'f7f44', 'g7g45', , 'a8e87', 'b8f44', 'c8g45', , 'e8e55', 'f8f44', 'g8g45', 'h8e55', , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a45', , 'c1c56', , 'e1b44', , 'g1g46', 'h1h46', 'a2a45', 'b2b44',
-        ,
-        , , , 'g2g46', 'h2h46', , , , , , , , , 'a4b44', 'f2f34', , , , 'f4b44', 'g4b44', 'h4b44', 'a5b44', , 'c5b44', , 'e5f46', , 'g5h46', 'h5h46', , 'b6b44',
-        'c6a45', , 'e6g46', 'f6h46', , 'h6h46', 'a7a45', 'b7b44', 'c7f46', , 'e7b44', 'f7f46', 'g7g46', , 'a8a45', 'b8b44', 'c8g46', , 'e8a45', 'f8b44',
-        'g8g46', 'h8h46', 'a1a47', , 'c1c56', , 'e1b46', , 'g1c56', 'h1h47', 'a2a47', 'b2b46', , , , 'f2c56', , 'h2h47', , , , , , , , , 'g2f25', 'g2f24', , ,
-        ,
-        'f4b46', 'g2f16', 'g2f16', 'a5c56', , 'g2f34', , 'e5c56', , 'g5c56', 'h5c56', , 'b6c56', 'c6c56', , 'e6g47', 'f6h47', , 'g2f37', 'a7c56', 'b7b46',
-        'c7c56', , 'e7c56', 'f7f47', 'g7g47', , 'a8c67', 'b8b46', 'c8c56', , 'e8c67', 'f8c56', 'g8g47', 'h8h47', 'a1a47', , 'c1c56', , 'e1b46', , 'g1c56',
-        'h1c68', 'a2a47', 'b2b46', , , , 'f2c56', 'g2g48', , , , , , , , , , 'a4b46', 'b4c56', , , , 'f4b46', 'g4b46', 'h4b46', 'a5c56', , 'c5b46', , 'e5c56',
-        ,
-        'g5c56', 'h5c56', , 'b6c56', 'c6c56', , 'e6g48', 'f6h48', , 'h2g28', 'a7c56', 'b7b46', 'c7c56', , 'e7c56', 'f7f48', 'g7g48', , 'a8a47', 'b8b46',
-        'c8c56', , 'e8a47', 'f8c56', 'g8g48', 'h8h48', 'a1e56', , 'c1f46', , 'a3b36', , 'g1g47', 'h1h47', 'a2e66', 'b2e56', , , , 'f2f46', 'a3b47', 'h2f46',
-        ,
-        , , , , , , , 'a4f46', 'b4f46', , , , 'a3b34', 'a3b45', 'a3b46', 'a5e56', , 'c5e56', , 'a3b34', , 'a3b46', 'h5e56', , 'b6e66', 'c6e66', , 'a3a46', 'f6f46',
-        ,
-        'h6f46', 'a7e77', 'b7e77', 'c7e56', , 'a3b36', 'f7f46', 'g7e56', , 'a8a47', 'b8e56', 'c8e66', , 'a3b36', 'f8f46', 'g8e66', 'h8e56', 'a1e54',
-        ,
-        'c1f44', , 'e1e54', , 'g1g45', 'h1h46', 'a2a47', 'b2e54', , , , 'f2f44', 'g2g45', 'h2f44', 'a3e76', , , , , , , , 'a4f44', 'b4f44', , , , 'b3b24', 'g4f44',
-        'h4f44', 'a5e54', , 'c5e54', , 'e5f44', , 'g5f44', 'h5e54', , 'b6e66', 'c6e86', , 'e6e54', 'f6f44', , 'h6f44', 'a7e76', 'b7e76', 'c7e54', , 'e7e54',
-        'f7f44', 'g7e54', , 'a8e86', 'b8e54', 'c8g45', , 'e8e54', 'f8f44', 'g8g45', 'h8e54', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , 'a1a45', , 'c1c54', , 'e1b44', , 'g1c54', 'h1h46', 'a2a45', 'b2b44', , , , 'f2c54', 'g2g46', 'h2h46', , , , , , , 'g3g46',
-        'h3h46', 'a4b44', 'b4c54', , , , 'f4b44', 'g4b44', 'h4b44', 'a5c54', , 'c5b44', , 'e5c54', , 'g5c54', 'h5c54', , 'b6c54', 'c6c54', , 'e6g46', 'f6h46',
-        ,
-        'h6h46', 'a7c54', 'b7b44', 'c7c54', , 'e7c54', 'f7f46', 'g7g46', , 'a8a45', 'b8b44', 'c8c54', , 'e8a45', 'f8c54', 'g8g46', 'h8h46', 'a1a47',
-        ,
-        'c1c56', , 'e1b46', , 'g1c56', 'g3f47', 'a2a47', 'b2b46', , , , 'f2c56', 'g2c67', 'h2h47', , , , , , , , 'h3h47', 'g3f25', 'g3f24', , , , 'f4b46', 'g3f26',
-        'g3f26', 'a5c56', , 'g3f34', , 'e5c56', , 'g5c56', 'h5c56', , 'b6c56', 'c6c56', , 'e6g47', 'f6h47', , 'g3f37', 'a7c56', 'b7b46', 'c7c56', , 'e7c56',
-        'f7f47', 'g7g47', , 'a8c67', 'b8b46', 'c8c56', , 'e8c67', 'f8c56', 'g8g47', 'h8h47', 'a1a47', , 'c1c56', , 'e1b46', , 'g1c56', 'h1c68', 'a2a47',
-        'b2b46', , , , 'f2c56', 'g2g48', 'h2f48', , , , , , , , , 'a4b46', 'b4c56', , , , 'f4b46', 'g4b46', 'h4b46', 'a5c56', , 'c5b46', , 'e5c56', , 'g5c56',
-        'h5c56', , 'b6c56', 'c6c56', , 'e6g48', 'f6h48', , 'h3g28', 'a7c56', 'b7b46', 'c7c56', , 'e7c56', 'f7f48', 'g7g48', , 'a8a47', 'b8b46', 'c8c56',
-        ,
-        'e8a47', 'f8c56', 'g8g48', 'h8h48', 'a1e56', , 'c1f46', , 'a4b36', , 'a4b57', 'h1h47', 'a2e66', 'b2e56', , , , 'f2f46', 'a4b57', 'h2f46', , ,
-        ,
-        , , , , , , 'b4f46', , , , 'a4b34', 'a4b45', 'a4b46', 'a5e56', , 'c5e56', , 'a4b34', , 'a4b46', 'h5e56', , 'b6e66', 'c6e66', , 'a4b46', 'f6f46', , 'h6f46',
-        'a7e77', 'b7e77', 'c7e56', , 'a4b36', 'f7f46', 'g7e56', , 'a4b38', 'b8e56', 'c8e66', , 'a4b36', 'f8f46', 'g8e66', 'h8e56', 'a1e55', , 'c1f45',
-        ,
-        'b4c55', , 'g1g45', 'h1h46', 'a2e66', 'b2e55', , , , 'f2f45', 'g2g45', 'h2f45', , , , , , , , , 'a4e87', , , , , 'b4b34', 'b4b35', 'h4g45', 'a5e55',
-        ,
-        'c5e55', , 'b4b34', , 'g5g45', 'h5g45', , 'b6e66', 'c6e66', , 'e6g45', 'f6f45', , 'h6f45', 'a7e77', 'b7f36', 'c7e55', , 'e7e55', 'f7f45', 'g7g45',
-        ,
-        'a8f36', 'b8e55', 'c8g45', , 'e8e55', 'f8f45', 'g8g45', 'h8e55', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , 'a1a45', , 'c1c55', , 'e1b45', , 'g1c55', 'h1e46', 'a2a45', 'b2b45', , , , 'f2c55', 'g2e46', 'f4e57', , , , , , , , , 'a4b45', 'f4f34', , , ,
-        ,
-        'f4f36', 'f4f36', 'a5c55', , 'f4f34', , 'e5c55', , 'g5c55', 'h5c55', , 'b6c55', 'c6c55', , 'e6e46', 'f6c66', , 'h6c66', 'a7c55', 'b7b45', 'c7c55',
-        ,
-        'e7c55', 'f7b36', 'f4e57', , 'a8a45', 'b8b45', 'c8c55', , 'e8a45', 'f8c55', 'g8b36', 'f4e57', 'a1a47', , 'c1c56', , 'e1b46', , 'g1c56', 'g4f47',
-        'a2a47', 'b2b46', , , , 'f2c56', 'g2c67', 'h2f47', , , , , , , , , 'g4f35', 'g4f34', , , , 'f4b46', , 'g4f36', 'a5c56', , 'g4f34', , 'e5c56', , 'g5c56',
-        'h5c56', , 'b6c56', 'c6c56', , 'e6c67', 'f6f47', , 'g4f37', 'a7c56', 'b7b46', 'c7c56', , 'e7c56', 'f7f47', 'g4f38', , 'a8c67', 'b8b46', 'c8c56',
-        ,
-        'e8c67', 'f8c56', 'g4g38', 'g4f38', 'a1a47', , 'c1c56', , 'e1b46', , 'g1c56', 'h1c18', 'a2a47', 'b2b46', , , , 'f2c56', 'g2g48', 'h2f48', , ,
-        ,
-        , , , , , 'a4b46', 'b4c56', , , , 'f4b46', 'g4b46', , 'a5c56', , 'c5b46', , 'e5c56', , 'g5c56', 'h5c56', , 'b6c56', 'c6c56', , 'e6g48', 'f6f48', , 'h4g38',
-        'a7c56', 'b7b46', 'c7c56', , 'e7c56', 'f7f48', 'g7g48', , 'a8a47', 'b8b46', 'c8c56', , 'e8a47', 'f8c56', 'g8g48', 'h8c88', 'a1e56', , 'c1f46',
-        ,
-        'e1e56', , 'a5b57', 'h1h47', 'a2a47', 'b2e56', , , , 'f2f46', 'a5b57', 'h2f46', , , , , , , , , 'a4f46', 'b4f46', , , , 'a5b45', 'a5b45', 'a5b46', ,
-        ,
-        'c5e56', , 'a5b45', , 'a5b46', 'h5e56', , 'b6e67', 'c6e67', , 'a5b46', 'f6f46', , 'h6f46', 'a7e77', 'b7e77', 'c7e56', , 'e7e56', 'f7f46', 'g7e56',
-        ,
-        'a8f37', 'b8e56', 'a5b57', , 'e8e56', 'f8f46', 'a5b57', 'h8e56', 'a1e56', , 'c1f46', , 'b5c55', , 'g1g46', 'b5c57', 'a2a47', 'b2e56', , , , 'f2f46',
-        'g2g46', 'h2f46', , , , , , , , , 'a4f46', 'b4f46', , , , 'b5b45', 'b5b45', 'b5c56', 'a5b47', , 'c5e56', , 'b5b45', , 'b5c56', 'h5g46', 'a6c87', 'b6e67',
-        'c6c87', , 'b5c56', 'f6f56', , 'h6f46', 'a7d77', 'b7c87', 'c7e56', , 'b5c56', 'f7f56', 'g7g46', , 'a8c87', 'b8e56', 'c8f56', , 'b5c56', 'f8f56',
-        'g8g46', 'h8e56', 'a1e15', , 'c1e15', , 'c5d55', , 'g1e15', 'h1e15', 'a2e66', 'b2e56', , , , 'f2f35', 'g2f35', 'h2h46', , , , , , , , , 'a4e86', 'b4e15',
-        ,
-        , , 'c5b45', 'c5b45', 'h4e15', 'a5e15', , , , 'c5b45', , 'c5d56', 'h5f35', , 'b6e66', 'c6f35', , 'e6e15', 'f6f35', , 'c5d56', 'a7e76', 'b7f35',
-        'c7e76', , 'e7e15', 'f7f35', 'g7g56', , 'a8f35', 'b8e86', 'c8e86', , 'e8e15', 'f8f35', 'g8g56', 'h8h46', 'a1d45', , 'c1e15', , 'd5c55', , 'g1e15',
-        'h1e15', 'a2a36', 'b2d45', , , , 'f2f35', 'g2f35', 'h2h36', , , , , , , , , 'a4d45', 'b4d45', , , , 'f4f35', 'g4f35', 'h4e15', 'a5e15', , 'c5d45', , 'e5e15',
-        ,
-        'd5c56', 'h5f35', , 'b6d45', 'c6e86', 'd6e76', 'e6e15', 'f6f35', , 'h6h46', 'a7d45', 'b7e76', 'c7e76', 'd7e86', 'e7e15', 'f7f35', 'g7d45',
-        ,
-        'a8e86', 'b8e86', 'c8e86', 'd8e86', 'e8e15', 'f8f35', 'g8g56', 'h8d45', 'a1a46', , 'c1c56', , 'e5d55', , 'e5d56', 'h1d16', 'a2a46', 'b2b36',
-        ,
-        , , 'e5d56', 'g2c66', 'e5d57', , , , , , , , , 'e5f45', 'e5f45', , , , 'e5d56', 'e5d56', 'e5d56', 'a5c76', , 'e5f45', , , , 'e5d56', 'h5d16', , 'b6c76',
-        'c6c76', , 'e5d56', 'f6c66', , 'e5d56', 'a7c76', 'b7c86', 'c7c86', , 'e5d56', 'f7b36', 'g7c76', , 'a8c86', 'b8c86', 'c8c76', , 'e5d56', 'f8c56',
-        'g8b36', 'h8c86', 'a1a46', , 'c1c56', , 'e1b46', , 'g1c56', 'f5f47', 'a2a46', 'b2b46', , , , 'f2c56', 'f5f47', 'f5e57', , , , , , , , , 'f5f45', 'f5f45',
-        ,
-        , , 'f4b46', 'g4b46', 'h4b46', 'a5c56', , 'f5f45', , 'e5c56', , 'f5f47', 'f5f47', , 'b6c56', 'c6c56', , 'e6e77', 'f5f47', 'f5f47', 'f5f47', 'a7c56',
-        'b7b46', 'c7c56', , 'e7c56', 'f5e57', 'f5e57', 'f5e57', 'a8a46', 'b8b46', 'c8c56', , 'e8a46', 'f8c56', 'f5e57', 'f5e57', 'a1a47', , 'c1c56',
-        ,
-        'e1b46', , 'g1c56', 'g5f47', 'a2a47', 'b2b46', , , , 'f2c56', 'g2c67', 'g5f48', , , , , , , , , 'g5f45', 'g5f45', , , , 'f4b46', 'g4b46', 'h4b46', 'a5c56',
-        ,
-        'g5f45', , 'e5c56', , , 'g5f47', , 'b6c56', 'c6c56', , 'e6b37', 'f6c67', , 'g5f47', 'a7c56', 'b7b46', 'c7c56', , 'e7c56', 'f7b37', 'g5f48', ,
-        'a8c67', 'b8b46', 'c8c56', , 'e8c67', 'f8c56', 'g8b37', 'g5f48', 'a1a47', , 'c1c56', , 'e1b46', , 'g1c56', 'h1c68', 'a2a47', 'b2b46', , , , 'f2c56',
-        'g2c68', 'h2f48', , , , , , , , , 'a4b46', 'b4c56', , , , 'f4b46', 'g4b46', 'h4b46', 'a5c56', , 'c5b46', , 'e5c56', , 'g5c56', , , 'b6c56', 'c6c56', ,
-        'e6b38', 'f6f48', , 'h5g48', 'a7c56', 'b7b46', 'c7c56', , 'e7c56', 'f7f48', 'g7g89', , 'a8a47', 'b8b46', 'c8c56', , 'e8a47', 'f8c56', 'g8b38',
-        'h5g49', 'a1e57', , 'c1f47', , 'a6a77', , 'a6b57', 'h1e17', 'a2a48', 'b2e57', , , , 'f2f47', 'a6b57', 'h2f47', , , , , , , , , 'a4f47', 'a6b57', , , ,
-        'a6b56', 'a6b56', 'a6b67', 'a5e57', , 'c5e57', , 'a6b56', , 'a6b57', 'a6b57', , 'a6b58', 'a6b58', , 'a6b67', 'a6b57', , 'h6f47', 'a7e78', 'b7e78',
-        'c7e57', , 'a6b67', 'f7f57', 'a6b57', , 'a8e88', 'b8e57', 'a6b57', , 'a6b67', 'f8f57', 'a6b57', 'h8e57', 'a1e57', , 'c1f47', , 'b6c55', , 'b6c57',
-        'b6c57', 'a2e67', 'b2e57', , , , 'b6c57', 'b6c57', 'b6c57', , , , , , , , , 'a4e87', 'b4e77', , , , 'b6c56', 'b6c56', 'b6c56', 'a5e57', , 'c5e77', , 'b6c56',
-        ,
-        'b6c56', 'b6c57', , , 'c6e87', , 'b6c56', 'b6c57', , 'b6c57', 'a7e77', 'b7e77', 'c7e77', , 'b6c56', 'f7f57', 'b6c57', , 'a8e87', 'b8e87', 'b6c57',
-        ,
-        'b6c56', 'f8f57', 'b6c57', 'b6c57', 'a1e57', , 'c6d56', , 'c6d55', , 'c6d56', 'h1f36', 'a2e67', 'b2e57', , , , 'c6d56', 'g2f36', 'c6d57', , ,
-        ,
-        , , , , , 'a4f47', 'b4e77', , , , 'c6d56', 'c6d56', 'c6d56', 'a5e57', , 'c6d56', , 'c6d56', , 'c6d56', 'h5f36', , 'c6d56', , , 'c6d56', 'f6f36', , 'c6d56',
-        'c6d56', 'b7e77', 'c6d57', , 'c6d56', 'f7f36', 'c6d57', , 'a8e87', 'b8e87', 'c6d57', , 'c6d56', 'f8f36', 'c6d57', 'c6d57', 'a1a47', , 'd6e56',
-        ,
-        'd6d55', , 'd6d56', 'h1f36', 'a2a47', 'b2b47', , , , 'd6d56', 'g2f36', 'd6e57', , , , , , , , , 'd6e56', 'd6e56', , , , 'd6d56', 'd6d56', 'd6d56', 'd6e56',
-        ,
-        'd6e56', , 'd6d56', , 'd6d56', 'h5f36', , 'd6d56', 'c6f36', , 'd6d56', 'f6f36', , 'd6d56', 'd6d56', 'b7f36', 'd6e56', 'd6e67', 'd6d56', 'f7f36',
-        'd6e57', , 'a8f36', 'b8e87', 'd6e56', 'd6e67', 'd6d56', 'f8f36', 'd6e57', 'd6e57', 'a1d16', , 'c1d16', , 'e6d55', , 'e6d56', 'h1d16', 'a2a47',
-        'b2b37', , , , 'e6d56', 'e6e57', 'e6e57', , , , , , , , , 'a4d16', 'e6f56', , , , 'e6d56', 'e6d56', 'e6d56', 'e6e56', , 'e6f56', , 'e6d56', , 'e6d56',
-        'h5d16', , 'e6d56', 'e6e56', , , 'e6e57', , 'e6d56', 'e6d56', 'b7d77', 'e6e56', , 'e6d56', 'e6e57', 'e6e57', , 'a8d87', 'b8d87', 'e6e56', , 'e6d56',
-        'e6f57', 'e6e57', 'e6e57', 'a1a47', , 'f6e56', , 'e1d17', , 'f6f57', 'f6e57', 'a2a47', 'b2b47', , , , 'f2c57', 'f6e57', 'f6e57', , , , , , , , , 'f6f56',
-        'f6g56', , , , 'f4b47', 'f6f57', 'f6f57', 'f6e56', , 'f6g56', , 'e5c57', , 'f6e57', 'f6e57', , 'b6c57', 'f6e56', , 'f6e57', , , 'f6e57', 'a7c57',
-        'b7b47', 'f6e56', , 'e7c57', 'f6e57', 'f6e57', , 'a8a47', 'b8b47', 'f6e56', , 'e8a47', 'f6f57', 'f6e57', 'f6e57', 'a1a47', , 'c1c57', , 'e1b47',
-        ,
-        'g1c57', 'g6g58', 'a2a47', 'b2b47', , , , 'f2c57', 'g2g48', 'g6f58', , , , , , , , , 'g6f56', 'g6h56', , , , 'f4b47', 'g4b47', 'g6f57', 'a5c57', , 'g6h56',
-        ,
-        'e5c57', , 'g5c57', 'h5c57', , 'b6c57', 'c6c57', , 'e6e78', 'f6h48', , 'g6g58', 'a7c57', 'b7b47', 'c7c57', , 'e7c57', 'f7f48', 'g6f58', 'g6f58',
-        'a8a47', 'b8b47', 'c8c57', , 'e8a47', 'f8c57', 'g6f58', 'g6f58', 'a1a48', , 'c1c57', , 'e1b47', , 'g1c57', 'h1c68', 'a2a48', 'b2b47', , , , 'f2c57',
-        'g2c68', 'h2h39', , , , , , , , , 'a4b47', 'h6h56', , , , 'f4b47', 'g4b47', 'h4b47', 'a5c57', , 'h6h56', , 'e5c57', , 'g5c57', 'h5c57', , 'b6c57', 'c6c57',
-        ,
-        'e6c68', 'f6c68', , , 'a7c57', 'b7b47', 'c7c57', , 'e7c57', 'f7f89', 'g7g89', , 'a8c68', 'b8b47', 'c8c57', , 'e8c68', 'f8c57', 'g8g69', 'h6g59',
-        'a1e17', , 'c1e17', , 'a7b77', , 'g1e17', 'h1e17', 'a2e68', 'b2e58', , , , 'f2e17', 'a7b68', 'a7b68', , , , , , , , , 'a4e88', 'b4e17', , , , 'a7b67',
-        'a7b67', 'a7b67', 'a5e17', , 'c5e78', , 'a7b67', , 'a7b68', 'a7b68', , 'b6e68', 'c6e88', , 'a7b67', 'a7b68', , 'a7b68', , 'b7e78', 'c7e78', , 'a7b67',
-        'a7b68', 'a7b68', , 'a8e88', 'b8e88', 'a7b68', , 'a7b67', 'a7b68', 'a7b68', 'h8h48', 'a1e17', , 'c1e17', , 'b7c77', , 'g1e17', 'h1e17', 'a2a38',
-        'b2b38', , , , 'f2f37', 'g2f37', 'b7c68', , , , , , , , , 'a4e88', 'b4e17', , , , 'b7c67', 'b7c67', 'b7c67', 'a5e17', , 'b7c68', , 'b7c67', , 'b7c68',
-        'h5f37', , 'b6e68', 'c6f37', , 'b7c67', 'f6f37', , 'b7c68', 'a7f28', , 'b7c68', , 'b7c67', 'f7f37', 'b7c68', , 'a8e88', 'b7c68', 'b7c68', , 'b7c67',
-        'f8f37', 'b7c68', 'b7c68', 'a1e17', , 'c1e17', , 'c7d77', , 'c7d67', 'c7d67', 'a2a38', 'b2b38', , , , 'c7d77', 'g2f37', 'c7d68', , , , , , , , , 'c7d67',
-        'b4e17', , , , 'c7d67', 'c7d67', 'c7d67', 'a5e17', , 'c5e78', , 'c7d67', , 'c7d78', 'c7d67', , 'b6e68', 'c6f37', , 'c7d67', 'f6f37', , 'c7d78',
-        'a7f28', 'b7f37', , , 'c7d67', 'f7f37', 'c7d68', , 'a8f37', 'b8e88', 'c7d78', , 'c7d67', 'f8f37', 'c7d68', 'c7d68', 'a1e17', , 'c1e17', , 'd7e77',
-        ,
-        'd7e67', 'd7d67', 'a2f27', 'b2f27', , , , 'd7e67', 'g2f27', 'h2f27', , , , , , , , , 'd7e67', 'b4e17', , , , 'd7e67', 'd7e67', 'd7e67', 'a5e17', , 'c5f27',
-        ,
-        'd7e67', , 'd7e67', 'd7e67', , 'b6f27', 'c6f37', , 'd7d67', 'f6f37', , 'd7e78', 'a7f27', 'b7f37', 'c7c88', , 'd7d67', 'f7f37', 'd7e68', , 'a8f37',
-        'b8c88', 'c8d88', 'd7e67', 'd7d67', 'f8f37', 'd7e68', 'd7e68', 'a1e17', , 'c1e17', , 'e7e67', , 'e7e67', 'e7d67', 'a2a38', 'e7e67', , , , 'e7e67',
-        'g2f37', 'e7e68', , , , , , , , , 'e7f67', 'b4e17', , , , 'e7e67', 'e7e67', 'e7e67', 'a5e17', , 'e7f67', , 'e5e17', , 'e7e67', 'e7e67', , 'b6c78', 'c6f37',
-        ,
-        'e6e17', 'f6f37', , 'e7f78', 'a7c78', 'b7f37', 'c7c88', , , 'f7f37', 'e7f68', , 'a8f37', 'b8c88', 'c8d88', , 'e7d67', 'f8f37', 'e7f68', 'e7f68',
-        'f7e67', , 'f7e67', , 'f7e67', , 'f7e67', 'f7f68', 'a2a38', 'f7e67', , , , 'f7e67', 'f7f68', 'f7e68', , , , , , , , , 'f7g67', 'f7g67', , , , 'f7e67',
-        'f7e67', 'f7e67', 'f7e67', , 'f7g67', , 'f7e67', , 'f7e67', 'f7e67', , 'b6c78', 'c6c78', , 'e6h68', 'f6h68', , 'f7f68', 'a7c78', 'b7c88', 'c7c88',
-        ,
-        'e7g58', , 'f7f68', , 'a8c88', 'b8c88', 'c8d88', , 'e8e58', 'f7f68', 'f7f68', 'f7f68', 'a1a48', , 'c1c58', , 'e1d18', , 'g1d18', 'g7f68', 'a2a48',
-        'b2b38', , , , 'f2c58', 'g2c68', 'h2c78', , , , , , , , , 'g7g67', 'g7h67', , , , 'f4c18', 'g4d18', 'g7g68', 'a5c78', , 'g7h67', , 'e5c58', , 'g5c18',
-        'g7f68', , 'b6c78', 'c6c78', , 'e6b38', 'f6c68', , 'g7f68', 'a7c78', 'b7c88', 'c7c88', , 'e7c58', 'f7b38', , , 'a8c88', 'b8c88', 'c8c78', , 'e8c68',
-        'f8c58', 'g7f68', 'g7f68', 'a1a48', , 'c1c58', , 'e1b48', , 'g1c58', 'h1h49', 'a2a48', 'b2b48', , , , 'f2c58', 'g2g49', 'h2h49', , , , , , , , , 'h7g67',
-        'h7h67', , , , 'f4b48', 'g4b48', 'h4b48', 'a5c58', , 'h7h67', , 'e5c58', , 'g5c58', 'h5c58', , 'b6c58', 'c6c58', , 'e6e79', 'f6f89', , 'h6h49',
-        'a7c58', 'b7b48', 'c7c58', , 'e7c58', 'f7f89', 'g7g49', , 'a8a48', 'b8b48', 'c8c58', , 'e8a48', 'f8c58', 'g8g49', 'h7g69', 'a1e59', , 'a8b89',
-        ,
-        'a8b77', , 'a8b89', 'h1f38', 'a2e69', 'a8b79', , , , 'a8b78', 'g2f38', 'a8b79', , , , , , , , , 'a4e89', 'a8b89', , , , 'a8b78', 'a8b78', 'a8b78', 'a5e59',
-        ,
-        'a8b79', , 'a8b78', , 'a8b79', 'h5f38', , 'a8b79', 'c6f38', , 'a8b78', 'f6f38', , 'a8b79', 'a7e79', 'b7f38', 'a8b79', , 'a8b78', 'f7f38', 'a8b79',
-        ,
-        , 'a8b79', 'a8b79', , 'a8b78', 'f8f38', 'a8b79', 'a8b79', 'a1a39', , 'b8c78', , 'b8c77', , 'b8c78', 'b8c78', 'a2a39', 'b2b39', , , , 'b8c78',
-        'b8c78', 'b8c89', , , , , , , , , 'b8c78', 'b8c78', , , , 'b8c78', 'b8c78', 'b8c78', 'b8c78', , 'b8c89', , 'b8c78', , 'b8c89', 'b8c78', , 'b6e69', 'c6f38',
-        ,
-        'b8c78', 'f6f38', , 'b8c79', 'a7e79', 'b7f38', 'b8b79', , 'b8c78', 'f7f38', 'b8c79', , 'a8f38', , 'b8c79', , 'b8c78', 'f8f38', 'b8c79', 'b8c79',
-        'c8d78', , 'c8d78', , 'c8d77', , 'c8d78', 'c8d78', 'a2a39', 'c8d78', , , , 'c8d77', 'c8d78', 'c8d89', , , , , , , , , 'c8d78', 'c8d78', , , , 'c8d78',
-        'c8d78', 'c8d78', 'c8d78', , 'c8d78', , 'c8d78', , 'c8d78', 'c8d78', , 'b6d89', 'c6f38', , 'c8d78', 'c8d78', , 'c8d78', 'a7e79', 'b7f38', 'c8d78',
-        ,
-        'c8d78', 'f7f38', 'c8d89', , 'a8f38', 'b8d69', , , 'c8d78', 'f8f38', 'c8d79', 'c8d89', 'a1d18', , 'c1d18', , 'd8e77', , 'd8e78', 'd8e78', 'd8e78',
-        'd8e78', , , , 'd8d77', 'd8e78', 'd8e78', , , , , , , , , 'a4d18', 'd8e78', , , , 'd8e78', 'd8e78', 'd8e78', 'd8e78', , 'd8e78', , 'd8e78', , 'd8e78',
-        'd8e78', , 'b6c69', 'c6f38', , 'd8e78', 'd8e78', , 'd8e78', 'a7d79', 'b7f38', 'd8e78', , 'd8d78', 'f7f38', 'd8e79', , 'a8f38', 'b8d69', 'd8e78',
-        ,
-        'd8e78', 'f8f38', 'd8e79', 'd8e79', 'a1d18', , 'c1d18', , 'e8e77', , 'e8f78', 'e8e78', 'e8e78', 'e8f78', , , , 'e8d77', 'e8e78', 'e8e78', , ,
-        ,
-        , , , , , 'a4d18', 'e8f78', , , , 'e8f78', 'e8f78', 'e8f78', 'e8f78', , 'e8f78', , 'e8f78', , 'e8f78', 'e8f78', , 'b6d89', 'c6f38', , 'e8e78', 'e8e78',
-        ,
-        'e8f78', 'a7d79', 'b7f38', 'e8f78', , 'e8d78', 'f7f38', 'e8f79', , 'a8f38', 'b8d89', 'e8f78', , , 'f8f38', 'e8f79', 'e8f79', 'a1d18', , 'c1d18',
-        ,
-        'f8e77', , 'f8f78', 'f8e78', 'f8e78', 'f8f78', , , , 'f2f38', 'f8e78', 'f8e78', , , , , , , , , 'a4d18', 'f8g78', , , , 'f4f38', 'f8f78', 'f8f78', 'f8f78',
-        ,
-        'f8g78', , 'f8f78', , 'f8f78', 'f8f78', , 'b6d89', 'c6f38', , 'f8e78', 'f6f38', , 'f8f78', 'a7d79', 'b7f38', 'f8g78', , 'e7e89', 'f7f38', 'f8f79',
-        ,
-        'a8f38', 'b8d89', 'f8g78', , 'f8e78', , 'f8g79', 'f8g79', 'a1d18', , 'c1d18', , 'e1d18', , 'g1d18', 'h1d18', 'a2a39', 'g8f78', , , , 'g8f78',
-        'g2g39', 'g8g79', , , , , , , , , 'a4d18', 'g8h78', , , , 'g8f78', 'g4d18', 'g8f78', 'g8f78', , 'g8h78', , 'g8f78', , 'g8f78', 'g8f78', , 'b6d89', 'g8g78',
-        ,
-        'e6g49', 'f6g59', , 'g8f78', 'a7d79', 'b7d79', 'g8g78', , 'e7g59', 'f7h59', 'g7g59', , 'a8d89', 'b8d89', 'g8g78', , 'e8h59', 'f8f49', , 'g8g79',
-        'a1a49', , 'h8g78', , 'e1d19', , 'g1d19', 'h1d19', 'a2a49', 'b2b39', , , , 'f2c59', 'h8g79', 'h8g79', , , , , , , , , 'h8h78', 'h8h78', , , , 'f4b49',
-        'g4d19', 'h4b49', 'a5c59', , 'h8h78', , 'e5c59', , 'g5c59', 'h5d19', , 'b6c59', 'h8g78', , 'e6b39', 'h8g79', , 'h8g79', 'a7c59', 'b7b49', 'h8g78',
-        ,
-        'e7c59', 'f7b39', 'g7g810', , 'a8a49', 'b8b49', 'h8g78', , 'e8a49', 'f8c59', 'g8b39', , , 'b1f57', 'c1g58', , 'e1e67', 'f1f57', , 'h1h58', ,
-        ,
-        'c2f57', , 'e2e67', , 'g2g58', 'h2h58', , , , , , 'f3f57', 'g3g58', 'h3f57', , , , , , , , , , , , , , 'a1b26', 'a1b26', 'a1b27', , , , , , , 'g6f57', 'h6e67',
-        ,
-        , , , , , , 'h7f57', , , , , , , , , , , 'c1g57', , 'e1e67', 'f1f57', , 'h1h57', 'a2e67', , 'c2f57', , 'e2e67', , 'g2g57', 'h2h57', 'a3a58', 'b3e67', , , ,
-        'f3f57', 'g3g57', 'h3h57', , , , , , , , , 'a5f57', 'b1c27', , , , 'b1c25', 'b1b26', 'b1b27', 'a6e67', , 'c6e67', , 'b1c25', , 'g6h57', 'h6h57', , 'b1c28',
-        'b1c28', , 'b1b26', 'f7h57', , 'h7h57', 'a8e88', 'b1c28', 'c8e67', , 'b1b27', 'f8f57', 'g8g57', , , 'b1f57', , , 'e1e67', 'f1f57', , 'h1h57', 'a2e67',
-        ,
-        'c2f57', , 'e2e67', , 'g2g57', 'h2h57', 'a3d67', 'b3e67', , , , 'f3f57', 'g3g57', 'h3h57', , , , , , , , , 'a5f57', 'b5f57', , , , 'c1c25', 'c1c26',
-        'c1c27', 'a6d67', , 'c1d27', , 'c1c25', , 'g6h57', 'h6h57', , 'c1d27', 'c7d67', , 'c1c26', 'c1d27', , 'h7h57', 'a8e88', 'b8d67', 'c8e67', , 'c1c27',
-        'f8f57', 'g8g57', , , 'b1b57', 'c1g57', , 'e1e67', 'f1f57', , 'h1h57', 'a2e67', , 'c2f57', , 'e2e67', , 'g2g57', 'h2h57', 'a3d67', 'b3b57', , ,
-        ,
-        'f3f57', 'g3g57', 'h3h57', , , , , , , , , 'a5b57', 'b5f57', , , , 'd1c25', 'd1d26', 'd1d27', 'a6d67', , 'c6d67', , 'd1d25', , 'g6h57', 'h6h57', , 'b7b57',
-        'c7d67', , 'd1d26', 'd1d27', , 'h7h57', 'a8d88', 'b8d67', 'c8e67', , 'd1d27', 'f8f57', 'g8g57', , , 'b1b57', 'c1c68', , , 'f1f57', , 'h1h58', 'a2e67',
-        ,
-        'c2f57', , 'e2e67', , 'g2g58', 'h2d66', 'a3d66', 'b3b57', , , , 'f3f57', 'g3d66', 'h3f57', , , , , , , , , 'e1f26', 'e1f26', , , , 'e1d26', 'e1d26',
-        'e1e27', 'a6d66', , 'c6d66', , 'e1d25', , 'g6d66', 'h6d66', , 'b7b57', 'c7d66', , 'e1d26', 'e1d27', , 'h7f57', 'a8d88', 'b8d66', 'c8e67', , 'e1e27',
-        'f8d66', 'g8e67', , , 'b1b57', 'c1c68', , 'e1e67', , , 'h1h58', 'a2e67', , 'c2c68', , 'e2e67', , 'g2g58', 'h2d67', 'a3d67', 'b3b57', , , , 'f1e28',
-        'g3d67', 'h3e67', , , , , , , , , 'f1f26', 'f1f26', , , , 'f1f27', 'f1f27', 'f1f27', 'a6d67', , 'c6d67', , 'f1e26', , 'g6e67', 'h6e67', , 'b7b57', 'c7d67',
-        ,
-        'e7e67', 'f7e67', , 'f1f28', 'a8d88', 'b8d67', 'c8e67', , 'e8e67', 'f8d67', 'g8e67', , , 'b1b57', 'c1c68', , 'e1e68', 'f1b57', , 'h1h58', 'a2a58',
-        ,
-        'c2c68', , 'e2b57', , 'g2g58', 'h2h58', 'a3a58', 'b3b57', , , , 'f3f58', 'g3g58', 'g1f28', , , , , , , , , 'g1f26', 'g1f26', , , , 'f5b57', 'g1f27',
-        'g1f27', 'a6b57', , 'c6b57', , 'g1f17', , 'g1f28', 'g1f28', , 'b7b57', 'c7d88', , 'e7g58', 'f7h58', , 'g1f28', 'a8d88', 'b8b57', 'c8d88', , 'e8b57',
-        'f8f58', 'g1f28', , , 'b1b57', 'c1c68', , 'e1a58', 'f1b57', , , 'a2a58', , 'c2c68', , 'e2b57', , 'g2c68', 'h1g29', 'a3a58', 'b3b57', , , , 'f3c68',
-        'g3g59', 'h1g19', , , , , , , , , 'a5b57', 'h1h27', , , , 'f5b57', 'g5b57', 'h5b57', 'a6b57', , 'c6b57', , 'e6c68', , 'g6c68', 'h6c68', , 'b7b57', 'c7c68',
-        ,
-        'e7g59', 'f7h59', , 'h1g19', 'a8c68', 'b8b57', 'c8c68', , 'e8b57', 'f8f59', 'g8g59', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , 'a1a58', 'b1f56', 'c1g56', , 'e1e66', 'f1f56', , 'h1h57', , , 'c2f56', , 'e2e66', , 'g2g56', 'h2h57', , , , , , 'f3f56', 'g3g56',
-        'h3f56', , , , , , , , , , , , , , 'b2b35', 'b2b36', 'h5g56', , , , , , , 'g6g56', 'h6g56', , , , , , , , 'h7f56', , , , , , , , , , 'b1b57', 'c1g56', , 'e1e65', 'f1f55',
-        ,
-        'h1h57', 'a2e65', , , , 'e2e65', , 'g2g56', 'h2h57', 'a3e76', 'b3e65', , , , 'f3f55', 'g3g56', 'h3f55', , , , , , , , , 'a5f55', 'b5f55', , , , 'c2b35',
-        'g5f55', 'h5f55', 'a6e65', , 'c6e65', , 'c2d25', , 'g6f55', 'h6e65', , 'b7e76', 'c7e76', , 'e7e65', 'f7f55', , 'h7f55', 'a8e87', 'b8e87', 'c8e65',
-        ,
-        'e8e65', 'f8f55', 'g8e65', , , 'b1f56', 'c1c67', 'd1h57', 'e1e65', 'f1f56', , 'h1h57', 'a2e65', , 'c2f56', , 'e2e65', , 'g2g56', 'h2d66', 'a3d66',
-        'b3e65', , , , 'f3f56', 'g3g56', 'h3e65', , , , , , , , , 'a5f56', 'b5f56', , , , 'd2c25', 'd2c26', 'h5g56', 'a6e65', , 'c6e65', , 'd2c25', , 'g6e65',
-        'h6e65', , 'b7e76', 'c7e76', , 'e7e65', 'f7e65', , 'h7f56', 'a8d87', 'b8d66', 'c8e65', , 'e8e65', 'f8f56', 'g8e65', , , 'b1b57', 'c1c67', , 'e1a57',
-        'f1f57', , 'h1h57', 'a2e66', , 'c2c67', , , , 'g2g57', 'h2d66', 'a3d66', 'b3e66', , , , 'f3f57', 'g3d66', 'h3e66', , , , , , , , , 'e2f36', 'e2f35', ,
-        ,
-        , 'e2d26', 'e2d26', 'e2f37', 'a6d66', , 'c6d76', , 'e2d25', , 'g6e66', 'h6e66', , 'b7d76', 'c7d76', , 'e2d26', 'f7e66', , 'h7d76', 'a8d87', 'b8d66',
-        'c8d76', , 'e8e66', 'f8d66', 'g8e66', , , 'b1b56', 'c1c67', , 'e1a56', 'f1b56', 'g1g57', 'h1h57', 'a2a56', , 'c2c67', , 'e2b56', , 'g2g57', 'h2h57',
-        'a3a56', 'b3b56', , , , 'f3f57', 'g3g57', 'h3h57', , , , , , , , , 'a5b56', 'f2f35', , , , 'f5b56', 'g5b56', 'h5b56', 'a6b56', , 'c6b56', , 'f2e26', ,
-        'g6h57', 'h6h57', , 'b7b56', 'c7a56', , 'e7g57', 'f7h57', , 'h7h57', 'a8a56', 'b8b56', 'c8d87', , 'e8b56', 'f8f57', 'g8g57', , , 'b1b57', 'c1c67',
-        ,
-        'e1e68', 'f1b57', , 'g2f38', 'a2a58', , 'c2c67', , 'e2b57', , , 'g2f38', 'a3a58', 'b3b57', , , , 'f3c67', 'g2f38', 'g2f28', , , , , , , , , 'g2f26',
-        'g2f35', , , , 'f5b57', 'g2f27', 'g2f27', 'a6c67', , 'g2f36', , 'e6c67', , 'g6c67', 'h6c67', , 'b7c67', 'c7c67', , 'e7g58', 'f7h58', , 'g2f28',
-        'a8c67', 'b8b57', 'c8c67', , 'e8c67', 'f8f58', 'g2f28', , , 'b1b57', 'c1c68', , 'e1a58', 'f1b57', , 'h1c68', 'a2a58', , 'c2c68', , 'e2b57', , 'g2c68',
-        ,
-        'a3a58', 'b3b57', , , , 'f3c68', 'g3g59', 'h2g19', , , , , , , , , 'a5b57', 'h2h37', , , , 'f5b57', 'g5b57', 'h5b57', 'a6b57', , 'c6b57', , 'e6c68',
-        ,
-        'g6c68', 'h6c68', , 'b7b57', 'c7c68', , 'e7e89', 'f7h59', , 'h2g19', 'a8c68', 'b8b57', 'c8c68', , 'e8b57', 'f8f59', 'g8g59', , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b1b55', 'c1c66', , 'e1a56', 'f1b55', , 'h1h57', 'a2a56', , 'c2c66',
-        ,
-        'e2b55', , 'g2g57', 'h2h57', 'a3a56', 'b3b55', , , , , 'g3g57', 'h3h57', , , , , , , , , 'a5b55', 'f3f45', , , , 'f5b55', 'g5b55', 'h5b55', 'a6b55',
-        ,
-        'c6b55', , 'e6c66', , 'g6c66', 'h6c66', , 'b7b55', 'c7c66', , 'e7g57', 'f3f47', , 'h7h57', 'a8c66', 'b8b55', 'c8c66', , 'e8b55', 'f8f57', 'f3f47',
-        ,
-        , 'b1b57', 'c1c67', , 'g3f47', 'f1b57', , 'h1c67', 'g3f47', , 'c2c67', , 'e2b57', , 'g2c67', 'g3f38', 'g3f47', 'b3b57', , , , 'f3c67', , 'g3f28',
-        ,
-        , , , , , , , 'g3f26', 'g3f35', , , , 'f5b57', 'g3f27', 'g3f27', 'a6c67', , 'g3f36', , 'e6c67', , 'g6c67', 'h6c67', , 'b7c67', 'c7c67', , 'e7e88', 'g3f47',
-        ,
-        'g3f28', 'a8c67', 'b8b57', 'c8c67', , 'e8c67', 'f8f58', 'g3f47', , , 'b1b57', 'c1c68', , 'e1b48', 'f1b57', , 'h1c68', 'a2a58', , 'c2c68', , 'e2b57',
-        ,
-        'g2c68', 'h2e29', 'a3a58', 'b3b57', , , , 'f3c68', 'g3g59', , , , , , , , , , 'a5b57', 'h3h47', , , , 'f5b57', 'g5b57', 'h5b57', 'a6b57', , 'c6b57',
-        ,
-        'e6c68', , 'g6c68', 'h6c68', , 'b7b57', 'c7c68', , 'e7b48', 'f7f89', , 'h3g29', 'a8c68', 'b8b57', 'c8c68', , 'e8b57', 'f8b48', 'g8g69', , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b1b55', 'c1c66', , 'e1b46', 'f1b55', , 'h1c66', 'a2a56',
-        ,
-        'c2c66', , 'e2b55', , 'g2c66', 'h2h57', 'a3a56', 'b3b55', , , , 'f3c66', 'f4f57', 'f4f57', , , , , , , 'f4f57', 'f4f57', 'a5b55', 'f4f35', , , , 'f5b55',
-        'g5b55', 'h5b55', 'a6b55', , 'c6b55', , 'e6c66', , 'g6c66', 'h6c66', , 'b7b55', 'c7c66', , 'e7b46', 'f7g87', , 'h7h57', 'a8c66', 'b8b55', 'c8c66',
-        ,
-        'e8b55', 'f8b46', 'g8g57', , , 'b1b47', 'c1c67', , 'e1b47', 'f1b57', , 'h1c67', 'g4f47', , 'c2c67', , 'e2b57', , 'g2c67', 'g4f38', 'a3b47', 'b3b47',
-        ,
-        , , 'f3c67', 'g4f57', 'g4f57', , , , , , , , 'g4f57', 'g4f36', 'g4f35', , , , 'f5b57', 'g4f37', 'g4f37', 'a6c67', , 'g4f36', , 'e6c67', , 'g6c67', 'h6c67',
-        ,
-        'b7c67', 'c7c67', , 'e7b47', 'g4f47', , 'g4f38', 'a8c67', 'b8b57', 'c8c67', , 'e8c67', 'f8b47', 'g4f47', , , 'b1b57', 'c1c67', , 'e1b48', 'f1b57',
-        ,
-        'h1c67', 'a2a48', , 'c2c67', , 'e2b57', , 'g2c67', 'h2h39', 'a3a48', 'b3b57', , , , 'f3c67', 'g3b38', 'h3b38', , , , , , , , , 'a5b57', 'b5c67', , ,
-        ,
-        'f5b57', 'g5b57', 'h5b57', 'a6c67', , 'c6b57', , 'e6c67', , 'g6c67', 'h6c67', , 'b7c67', 'c7c67', , 'e7b48', 'f7b38', , 'h4g39', 'a8c67', 'b8b57',
-        'c8c67', , 'e8c67', 'f8b48', 'g8b38', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b1b46',
-        'c1c27', , 'e1b46', 'f1f37', , 'h1h37', 'a2a46', , 'c2a46', , 'e2e47', , 'g2g37', 'h2h37', 'a3a46', 'b3b46', , , , 'f3f47', 'f5f67', 'f5f67', ,
-        ,
-        , , , , , , 'a5b46', 'f5f45', , , , , 'f5f47', 'f5f47', 'a6a46', , 'c6a46', , 'e6e77', , 'g6g47', 'f5e67', , 'b7b46', 'c7c87', , 'e7b46', 'f5f47', ,
-        'h7h47', 'a8a46', 'b8b46', 'c8d87', , 'e8a46', 'f8b46', 'f5f47', , , 'b1b46', 'c1c67', , 'e1b46', 'f1b57', , 'h1c67', 'g5f47', , 'c2c67', , 'e2b57',
-        ,
-        'g2c67', 'g5f48', 'a3b46', 'b3b46', , , , 'f3c67', 'g5f57', 'g5f57', , , , , , , , , 'a5b46', 'g5f45', , , , 'f5b57', , 'g5f47', 'a6c67', , 'g5f46',
-        ,
-        'e6c67', , 'g6c67', 'h6c67', , 'b7b46', 'c7c67', , 'e7b46', 'g5f47', , 'g5f48', 'a8c67', 'b8b46', 'c8c67', , 'e8c67', 'f8b46', 'g5f47', , , 'b1b57',
-        'c1c28', , 'e1c18', 'f1b57', , 'h1c18', 'a2a48', , 'c2c68', , 'e2b57', , 'g2c28', 'h2c28', 'a3a48', 'b3b57', , , , 'f3b38', 'g3b38', 'h3b38', ,
-        ,
-        , , , , , , 'a5b57', 'h5h47', , , , 'f5b57', 'g5b57', , 'a6b57', , 'c6b57', , 'e6b38', , 'g6c28', 'h6c18', , 'b7b57', 'c7c88', , 'e7b48', 'f7b38', ,
-        'h7c28', 'a8c88', 'b8b57', 'c8c78', , 'e8b57', 'f8b48', 'g8b38', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , 'b1b37', 'c1c27', , 'e1g37', 'f1f37', , 'h1h37', , , 'c2c67', , 'e2f37', , 'g2g37', 'h2h37', , , , , , 'f3g37', 'f6f57', 'f6f57',
-        ,
-        , , , , , , , , , , , , 'f5h37', 'f6e67', 'f6e67', , , , , , , 'g6g37', 'f6e67', , , , , , , 'g7g37', 'h7h37', , , , , , , , 'h8h37', , 'b1b47', 'g6f57', , 'e1b47',
-        'g6f57', , 'g6f58', 'g6f57', , 'g6f57', , 'g6f57', , 'g2g48', 'g6f58', 'a3b47', 'b3b47', , , , 'g6f57', 'g6f57', 'g6f57', , , , , , , , , 'a5b47', 'b5b47',
-        ,
-        , , 'f5g48', 'g5h48', 'g6g58', 'g6f57', , 'g6g57', , 'e6e78', , , 'g6f58', , 'b7b47', 'g6f57', , 'e7b47', 'f7f48', , 'g6f58', 'a8c88', 'b8b47',
-        'g6f57', , 'g6f57', 'f8b47', 'g6f58', , , 'b1b38', 'c1c68', , 'e1b48', 'f1b58', , 'h1c68', 'a2a48', , 'c2c68', , 'e2b58', , 'g2c68', 'h2h39', 'a3a48',
-        'b3b48', , , , 'f3b38', 'g3b38', 'h3b38', , , , , , , , , 'a5b58', 'h6h57', , , , 'f5b58', 'g5b58', 'h5b58', 'a6c68', , 'h6g57', , 'e6b38', , 'g6c68',
-        ,
-        , 'b7c68', 'c7c68', , 'e7b48', 'f7b38', , 'h6g59', 'a8c68', 'b8b58', 'c8c68', , 'e8c68', 'f8b48', 'g8b38', , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b1b38',
-        'g7f67', , 'e1d18', 'f1d18', , 'g7f68', , , 'g7f67', , 'e2d18', , 'g2d28', 'h2d28', , , , , , 'g7f67', 'g7f67', 'g7f67', , , , , , , , , , , , , , 'f5c28', 'g5d28',
-        'g7f68', , , , , , , 'g6c28', 'g7f68', , , , , , , , 'g7f68', , , , , , , , 'g7f68', , 'b1b48', 'h7g68', , 'e1b48', 'f1f39', , 'h1h39', 'a2a48', , 'c2a48', ,
-        'e2e79', , 'g2g39', 'h2h39', 'a3a48', 'b3b48', , , , 'f3f49', 'g3g49', 'h3h49', , , , , , , , , 'a5b48', 'b5b48', , , , 'f5f89', 'g5h49', 'h5h49', 'a6a48',
-        ,
-        'c6a48', , 'e6e79', , 'g6g49', 'h6h49', , 'b7b48', 'h7g68', , 'e7b48', 'f7f89', , , 'a8a48', 'b8b48', 'h7g68', , 'e8a48', 'f8b48', 'g8g49', ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b1b39', 'c1c29', , 'e1g39', 'f1f39', , 'h1h39',
-        ,
-        , 'h8g78', , 'e2f39', , 'g2g39', 'h2h39', , , , , , 'f3g39', 'g3h39', 'h3g39', , , , , , , , , , , , , , 'f5h39', 'g5g39', 'h5h39', , , , , , , 'g6g39', 'h6h39',
-        ,
-        , , , , , , 'h7h39', , , , , , , ,
-    ];
-})(Endgame_q || (Endgame_q = {}));
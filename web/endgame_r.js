@@ -1,2028 +0,0 @@
-var Endgame_r;
-(function (Endgame_r) {
-    'use strict';
-    function GetTable() { return table; }
-    Endgame_r.GetTable = GetTable;
-    var table = [
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , 'c1c23', 'c1c23', 'c1c23', 'c1c23', 'c1c23', , 'b2b33', 'c2c33', 'c1c23', 'c1c23', 'c1c23', 'c1c23', 'c1c23', , 'b3a31', 'c3a31',
-        'd3a31', 'e3a31', 'f3a31', 'g3a31', 'h3a31', , 'b4a41', 'c4a41', 'd4a41', 'e4a41', 'f4a41', 'g4a41', 'h4a41', , 'b5a51', 'c5a51', 'd5a51',
-        'e5a51', 'f5a51', 'g5a51', 'h5a51', , 'b6a61', 'c6a61', 'd6a61', 'e6a61', 'f6a61', 'g6a61', 'h6a61', , 'b7a71', 'c7a71', 'd7a71', 'e7a71',
-        'f7a71', 'g7a71', 'h7a71', , 'b8a81', 'c8a81', 'd8a81', 'e8a81', 'f8a81', 'g8a81', 'h8a81', , , , , 'd1c13', 'd1c13', 'd1c13', 'd1c13', , 'b2b33',
-        'c2d25', 'd1c23', 'd1c23', 'd1c23', 'd1c23', 'd1c23', , 'd1d23', 'c3b33', 'd1c13', 'd1c13', 'd1c13', 'd1c13', 'd1c13', , 'd1c22', 'd1c22',
-        'd1c22', 'd1c22', 'd1c22', 'd1c22', 'd1c22', , 'd1c22', 'd1c22', 'd1c22', 'd1c22', 'd1c22', 'd1c22', 'd1c22', , 'd1c22', 'd1c22', 'd1c22',
-        'd1c22', 'd1c22', 'd1c22', 'd1c22', , 'd1c22', 'd1c22', 'd1c22', 'd1c22', 'd1c22', 'd1c22', 'd1c22', , 'd1c22', 'd1c22', 'd1c22', 'd1c22',
-        'd1c22', 'd1c22', 'd1c22', , , , , , 'e1d25', 'e1d25', 'e1d25', , 'b2c25', 'c2d25', 'd2e25', 'e1d15', 'e1d15', 'e1d15', 'e1d15', , 'e1d13', 'c3c25',
-        'd3d25', 'e1d15', 'e1d15', 'e1d15', 'e1d15', , 'e1d14', 'c4c25', 'd4d25', 'e1d25', 'e1d25', 'e1d25', 'e1d25', , 'e1d24', 'c5c25', 'd5d25',
-        'e1d25', 'e1d25', 'e1d25', 'e1d25', , 'e1d24', 'c6c25', 'd6d25', 'e1d25', 'e1d25', 'e1d25', 'e1d25', , 'e1d24', 'c7c25', 'd7d25', 'e1d25',
-        'e1d25', 'e1d25', 'e1d25', , 'e1d24', 'c8c25', 'd8d25', 'e1d25', 'e1d25', 'e1d25', 'e1d25', , , , , , , 'f1e17', 'f1e17', , 'b2c27', 'f1e15', 'f1e15',
-        'f1e15', 'f1e15', 'f1e15', 'f1e15', , 'f1e17', 'f1e16', 'f1e16', 'f1e16', 'f1e16', 'f1e16', 'f1e16', , 'f1e16', 'c4c27', 'd4d27', 'e4e27',
-        'f1e17', 'f1e17', 'f1e17', , 'f1e16', 'c5c27', 'd5d27', 'e5e27', 'f1e17', 'f1e17', 'f1e17', , 'f1e26', 'c6c27', 'd6d27', 'e6e27', 'f1e17',
-        'f1e17', 'f1e17', , 'f1e26', 'c7c27', 'd7d27', 'e7e27', 'f1e17', 'f1e17', 'f1e17', , 'f1e26', 'c8c27', 'd8d27', 'e8e27', 'f1e17', 'f1e17',
-        'f1e17', , , , , , , , 'h1h27', , 'b2d27', 'c2d27', 'd2e27', 'g1f26', 'f2g27', 'g1f17', 'g1f17', , 'b3d39', 'c3c28', 'd3d27', 'e3e27', 'f3f27',
-        'g3g27', 'h3h27', , 'b4b39', 'c4c28', 'd4d27', 'e4e27', 'f4f27', 'g4g27', 'h4h27', , 'g1f18', 'c5c28', 'd5d27', 'e5e27', 'f5f27', 'g5g27',
-        'h5h27', , 'g1f18', 'c6c28', 'd6d27', 'e6e27', 'f6f27', 'g6g27', 'h6h27', , 'g1f28', 'c7c28', 'd7d27', 'e7e27', 'f7f27', 'g7g27', 'h7h27',
-        ,
-        'g1f28', 'c8c28', 'd8d27', 'e8e27', 'f8f27', 'g8g27', 'h8h27', , , , , , , , , , 'b2e28', 'c2e28', 'h1g17', 'h1g17', 'h1g17', 'h1g17', 'h1g17',
-        ,
-        'h1g19', 'c3c29', 'd3d29', 'e3e28', 'f3f28', 'g3g29', 'h1g19', , 'b4b810', 'c4c29', 'd4d29', 'e4e28', 'f4f28', 'g4g29', 'h4h29', , 'b5b810',
-        'c5c29', 'd5d29', 'e5e28', 'f5f28', 'g5g29', 'h5h29', , 'b6b810', 'c6c29', 'd6d29', 'e6e28', 'f6f28', 'g6g29', 'h6h29', , 'b7b810', 'c7c29',
-        'd7d29', 'e7e28', 'f7f28', 'g7g29', 'h7h29', , 'h1h210', 'c8c29', 'd8d29', 'e8e28', 'f8f28', 'g8g29', 'h8h29', , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b2b42',
-        ,
-        'c2b32', 'c2b32', 'c2b32', 'c2b32', 'c2b32', , 'b3a31', 'c3a31', 'd3a31', 'e3a31', 'f3a31', 'g3a31', 'h3a31', , 'b4a41', 'c4a41', 'd4a41',
-        'e4a41', 'f4a41', 'g4a41', 'h4a41', , 'b5a51', 'c5a51', 'd5a51', 'e5a51', 'f5a51', 'g5a51', 'h5a51', , 'b6a61', 'c6a61', 'd6a61', 'e6a61',
-        'f6a61', 'g6a61', 'h6a61', , 'b7a71', 'c7a71', 'd7a71', 'e7a71', 'f7a71', 'g7a71', 'h7a71', , 'b8a81', 'c8a81', 'd8a81', 'e8a81', 'f8a81',
-        'g8a81', 'h8a81', , , , , , , , , , 'b2b33', 'd2c33', , 'd2c23', 'd2c23', 'd2c23', 'd2c23', , 'd2d33', 'c3b33', 'd2c13', 'd2c13', 'd2c13', 'd2c13',
-        'd2c13', , 'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22', , 'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22',
-        ,
-        'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22', , 'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22', , 'd2c22',
-        'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22', 'd2c22', , , , , , , , , , 'b2c25', 'c2d25', 'd2c25', , 'e2d34', 'e2d34', 'e2d34', , 'e2d13', 'c3c25',
-        'd3d25', 'e2d15', 'e2d15', 'e2d15', 'e2d15', , 'e2d14', 'c4c25', 'd4d25', 'e2d25', 'e2d25', 'e2d25', 'e2d25', , 'e2d24', 'c5c25', 'd5d25',
-        'e2d25', 'e2d25', 'e2d25', 'e2d25', , 'e2d24', 'c6c25', 'd6d25', 'e2d25', 'e2d25', 'e2d25', 'e2d25', , 'e2d24', 'c7c25', 'd7d25', 'e2d25',
-        'e2d25', 'e2d25', 'e2d25', , 'e2d24', 'c8c25', 'd8d25', 'e2d25', 'e2d25', 'e2d25', 'e2d25', , , , , , , , , , 'b2e26', 'f2e15', 'f2e15', 'f2e15',
-        ,
-        'f2e15', 'f2e15', , 'f2e17', 'f2e16', 'f2e16', 'e3e26', 'f2e16', 'f2e16', 'f2e16', , 'f2e16', 'c4c27', 'd4d27', 'e4e26', 'f2e17', 'f2e17',
-        'f2e17', , 'f2e16', 'c5c27', 'd5d27', 'e5e26', 'f2e17', 'f2e17', 'f2e17', , 'f2e26', 'c6c27', 'd6d27', 'e6e26', 'f2e17', 'f2e17', 'f2e17',
-        ,
-        'f2e26', 'c7c27', 'd7d27', 'e7e26', 'f2e17', 'f2e17', 'f2e17', , 'f2e26', 'c8c27', 'd8d27', 'e8e26', 'f2e17', 'f2e17', 'f2e17', , , , , , , ,
-        ,
-        , 'b2d27', 'c2d27', 'd2e27', 'g2f26', 'g2f36', , 'g2f36', , 'b3d39', 'c3c28', 'd3d27', 'e3e27', 'f3f27', 'g2f18', 'g2f18', , 'b4b39', 'c4c28',
-        'd4d27', 'e4e27', 'f4f27', 'g2f19', 'g2f19', , 'g2f18', 'c5c28', 'd5d27', 'e5e27', 'f5f27', 'g2f19', 'g2f19', , 'g2f18', 'c6c28', 'd6d27',
-        'e6e27', 'f6f27', 'g2f19', 'g2f19', , 'g2f28', 'c7c28', 'd7d27', 'e7e27', 'f7f27', 'g2f19', 'g2f19', , 'g2f28', 'c8c28', 'd8d27', 'e8e27',
-        'f8f27', 'g2f19', 'g2f19', , , , , , , , , , 'b2e28', 'c2e28', 'h2g17', 'h2g17', 'h2g17', 'h2g17', , , 'h2g19', 'c3c29', 'd3d29', 'e3e28', 'f3f28',
-        'g3g28', 'h2g19', , 'b4b810', 'c4c29', 'd4d29', 'e4e28', 'f4f28', 'g4g28', 'h2g110', , 'b5b810', 'c5c29', 'd5d29', 'e5e28', 'f5f28', 'g5g28',
-        'h2g110', , 'b6b810', 'c6c29', 'd6d29', 'e6e28', 'f6f28', 'g6g28', 'h2g110', , 'b7b810', 'c7c29', 'd7d29', 'e7e28', 'f7f28', 'g7g28', 'h2g110',
-        ,
-        'h2h310', 'c8c29', 'd8d29', 'e8e28', 'f8f28', 'g8g28', 'h2g110', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b2b33', 'c2c13', 'c3b32', 'c3b32', 'c3b32', 'c3b32',
-        'c3b32', , , , 'c3b32', 'c3b32', 'c3b32', 'c3b32', 'c3b32', , , , 'c3c22', 'c3c22', 'c3c22', 'c3c22', 'c3c22', , , , , 'c3c22', 'c3c22', 'c3c22',
-        'c3c22', , , , , , 'c3c22', 'c3c22', 'c3c22', , , , , , , 'c3c22', 'c3c22', , , , , , , , 'c3c22', , , , , , , , , , 'b2b33', 'd3c33', 'd3c23', 'd3c23', 'd3c23',
-        'd3c23', 'd3c23', , 'd3d23', 'c3b33', , 'd3c23', 'd3c23', 'd3c23', 'd3c23', , 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22',
-        ,
-        'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', , 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', , 'd3c22',
-        'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', , 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', 'd3c22', , , , , , , , , , 'b2c25',
-        'e3e45', 'd2c25', 'e3d34', 'e3d34', 'e3d34', 'e3d34', , 'e3d23', 'c3c25', 'e3d25', , 'e3d25', 'e3d25', 'e3d25', , 'e3d24', 'c4c25', 'e3d25',
-        'e3d25', 'e3d25', 'e3d25', 'e3d25', , 'e3d24', 'c5c25', 'e3d25', 'e3d25', 'e3d25', 'e3d25', 'e3d25', , 'e3d24', 'c6c25', 'e3d25', 'e3d25',
-        'e3d25', 'e3d25', 'e3d25', , 'e3d24', 'c7c25', 'e3d25', 'e3d25', 'e3d25', 'e3d25', 'e3d25', , 'e3d24', 'c8c25', 'e3d25', 'e3d25', 'e3d25',
-        'e3d25', 'e3d25', , , , , , , , , , 'b2e26', 'f3e25', 'f3e25', 'e2f26', 'f2g26', 'f3f46', 'f3f46', , 'f3e27', 'f3e26', 'f3e26', 'e3e26', , 'f3e26',
-        'f3e26', , 'f3e26', 'c4c27', 'd4d27', 'e4e26', 'f3e27', 'g4g26', 'h4h26', , 'f3e26', 'c5c27', 'd5d27', 'e5e26', 'f3e27', 'g5g26', 'h5h26',
-        ,
-        'f3e26', 'c6c27', 'd6d27', 'e6e26', 'f3e27', 'g6g26', 'h6h26', , 'f3e26', 'c7c27', 'd7d27', 'e7e26', 'f3e27', 'g7g26', 'h7h26', , 'f3e26',
-        'c8c27', 'd8d27', 'e8e26', 'f3e27', 'g8g26', 'h8h26', , , , , , , , , , 'b2d27', 'c2d27', 'd2e27', 'g3f26', 'g3f36', 'g3f36', 'g3f36', , 'b3d39',
-        'c3c28', 'd3d27', 'e3e27', 'f3f28', , 'g3f28', , 'b4b39', 'c4c28', 'd4d27', 'e4e27', 'f4f28', 'g3f29', 'h4h28', , 'g3f28', 'c5c28', 'd5d27',
-        'e5e27', 'f5f28', 'g3f29', 'h5h28', , 'g3f28', 'c6c28', 'd6d27', 'e6e27', 'f6f28', 'g3f29', 'h6h28', , 'g3f28', 'c7c28', 'd7d27', 'e7e27',
-        'f7f28', 'g3f29', 'h7h28', , 'g3f28', 'c8c28', 'd8d27', 'e8e27', 'f8f28', 'g3f29', 'h8h28', , , , , , , , , , 'b2e28', 'c2e28', 'h3g27', 'h3g27',
-        'h3g27', 'g2h28', 'h2g28', , 'h3g29', 'c3c29', 'd3d29', 'e3e28', 'f3f28', 'g3g28', , , 'b4b810', 'c4c29', 'd4d29', 'e4e28', 'f4f28', 'g4g28',
-        'h3g210', , 'b5b810', 'c5c29', 'd5d29', 'e5e28', 'f5f28', 'g5g28', 'h3g210', , 'b6b810', 'c6c29', 'd6d29', 'e6e28', 'f6f28', 'g6g28', 'h3g210',
-        ,
-        'b7b810', 'c7c29', 'd7d29', 'e7e28', 'f7f28', 'g7g28', 'h3g210', , 'h3h410', 'c8c29', 'd8d29', 'e8e28', 'f8f28', 'g8g28', 'h3g210', , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b2b54', 'd4c33', 'd2e24', 'd4d34', 'd4d34', 'd4d34',
-        'd4d34', , , 'c3c25', 'd4c34', 'd4c34', 'd4c34', 'd4c34', 'd4c34', , , , , 'd4c33', 'd4c33', 'd4c33', 'd4c33', , , , , 'd4c33', 'd4c33', 'd4c33',
-        'd4c33', , , , , , 'd4c33', 'd4c33', 'd4c33', , , , , , , 'd4c33', 'd4c33', , , , , , , , 'd4c33', , , , , , , , , , 'b2c25', 'e4e35', 'd2c25', 'e4d34', 'e4d34',
-        'e4d34', 'e4d34', , 'e4d33', 'c3c25', 'd3d26', 'e4d35', 'e4d35', 'e4d35', 'e4d35', , 'e4d34', 'c4c25', 'd4d26', , 'e4d36', 'e4d36', 'e4d36',
-        ,
-        'e4d34', 'c5c25', 'd5d26', 'e4d36', 'e4d36', 'e4d36', 'e4d36', , 'e4d34', 'c6c25', 'd6d26', 'e4d36', 'e4d36', 'e4d36', 'e4d36', , 'e4d34',
-        'c7c25', 'd7d26', 'e4d36', 'e4d36', 'e4d36', 'e4d36', , 'e4d34', 'c8c25', 'd8d26', 'e4d36', 'e4d36', 'e4d36', 'e4d36', , , , , , , , , , 'b2e26',
-        'f4e35', 'd2e26', 'e2f26', 'f2g26', 'f4f56', 'f4f56', , 'f4e37', 'f4e36', 'f4e36', 'e3e26', 'f3f26', 'f4e36', 'f4e36', , 'f4e36', 'f4e37',
-        'd4d27', 'e4e26', , 'g4g26', 'h4h26', , 'f4e36', 'c5c48', 'd5d27', 'e5e26', 'f4e37', 'g5g26', 'h5h26', , 'f4e36', 'c6c48', 'd6d27', 'e6e26',
-        'f4e37', 'g6g26', 'h6h26', , 'f4e36', 'c7c48', 'd7d27', 'e7e26', 'f4e37', 'g7g26', 'h7h26', , 'f4e36', 'c8c48', 'd8d27', 'e8e26', 'f4e37',
-        'g8g26', 'h8h26', , , , , , , , , , 'b2d27', 'c2d27', 'g4g37', 'g4f36', 'g4f36', 'g4f36', 'g4f36', , 'b3d39', 'c3c28', 'd3d27', 'e3e28', 'f3f28',
-        'g3g28', 'g4f38', , 'g4f39', 'c4c28', 'd4d27', 'e4e28', 'f4f28', , 'h4h28', , 'g4f38', 'c5c28', 'd5d27', 'e5e28', 'f5f28', 'g4f310', 'h5h28',
-        ,
-        'g4f38', 'c6c28', 'd6d27', 'e6e28', 'f6f28', 'g4f310', 'h6h28', , 'g4f38', 'c7c28', 'd7d27', 'e7e28', 'f7f28', 'g4f310', 'h7h28', , 'g4f38',
-        'c8c28', 'd8d27', 'e8e28', 'f8f28', 'g4f310', 'h8h28', , , , , , , , , , 'b2e28', 'c2e28', 'h4g37', 'h4g37', 'f2g28', 'g2h28', 'h2g28', , 'h4g39',
-        'c3c29', 'd3d29', 'e3e28', 'f3f28', 'g3g28', 'h3h28', , 'b4b810', 'c4c29', 'd4d29', 'e4e28', 'f4f28', 'g4g28', , , 'b5b810', 'c5c29', 'd5d29',
-        'e5e28', 'f5f28', 'g5g28', 'h4g411', , 'b6b810', 'c6c29', 'd6d29', 'e6e28', 'f6f28', 'g6g28', 'h4g411', , 'b7b810', 'c7c29', 'd7d29', 'e7e28',
-        'f7f28', 'g7g28', 'h4g411', , 'h4h510', 'c8c29', 'd8d29', 'e8e28', 'f8f28', 'g8g28', 'h8b810', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b2b46', 'e5e45',
-        'e5d45', 'e5d44', 'e5d44', 'e5d44', 'e5d44', , , 'e5e47', 'd3d26', 'e3e26', 'f3f26', 'g3g26', 'h3h26', , , , 'd4d26', 'e4e26', 'f4f26', 'g4g26',
-        'h4h26', , , , , , 'f5f26', 'g5g26', 'h5h26', , , , , , 'f6f26', 'g6g26', 'h6h26', , , , , , , 'g7g26', 'h7h26', , , , , , , , 'h8h26', , , , , , , , , , 'b2e26', 'f5e45',
-        'd2e26', 'e2f26', 'f2g26', 'f5f46', 'f5f46', , 'b3b58', 'f5e47', 'd3d27', 'e3e26', 'f3f26', 'g3g26', 'h3h26', , 'f5e46', 'c4c28', 'd4d27',
-        'e4e26', 'f4f26', 'g4g26', 'h4h26', , 'f5e46', 'c5c28', 'd5d27', 'e5e26', , 'g5g26', 'h5h26', , 'f5e46', 'c6c28', 'd6d27', 'e6e26', 'f5e48',
-        'g6g26', 'h6h26', , 'f5e46', 'c7c28', 'd7d27', 'e7e26', 'f5e48', 'g7g26', 'h7h26', , 'f5e46', 'c8c28', 'd8d27', 'e8e26', 'f5e48', 'g8g26',
-        'h8h26', , , , , , , , , , 'b2c28', 'c2d28', 'g5g47', 'g5f46', 'g5f46', 'g5f46', 'g5f46', , 'b3d39', 'c3c28', 'd3d28', 'e3e28', 'f3f28', 'g3g28',
-        'h3h28', , 'g5f49', 'c4c28', 'd4d28', 'e4e28', 'f4f28', 'g4g28', 'h4h28', , 'g5f48', 'c5c28', 'd5d28', 'e5e28', 'f5f28', , 'h5h28', , 'g5f48',
-        'c6c28', 'd6d28', 'e6e28', 'f6f28', 'g5f410', 'h6h28', , 'g5f48', 'c7c28', 'd7d28', 'e7e28', 'f7f28', 'g5f410', 'h7h28', , 'g5f48', 'c8c28',
-        'd8d28', 'e8e28', 'f8f28', 'g5f410', 'h8h28', , , , , , , , , , 'b2e28', 'c2e28', 'h5g47', 'e2f28', 'f2g28', 'g2h28', 'h2g28', , 'b3b810', 'c3e310',
-        'h5g49', 'e3e28', 'f3f28', 'g3g28', 'h3h28', , 'b4b810', 'c4c210', 'd4d210', 'e4e28', 'f4f28', 'g4g28', 'h4h28', , 'b5b810', 'c5c210', 'd5d210',
-        'e5e28', 'f5f28', 'g5g28', , , 'b6b810', 'c6c210', 'd6d210', 'e6e28', 'f6f28', 'g6g28', 'h5g411', , 'b7b810', 'c7c210', 'd7d210', 'e7e28',
-        'f7f28', 'g7g28', 'h5g411', , 'h5h610', 'c8c210', 'd8d210', 'e8e28', 'f8f28', 'g8g28', 'h8b810', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b2b58', 'c2e28', 'f6e56', 'f6f56', 'f6f56', 'f6f56', 'f6f56', , , 'f6e58', 'f6g59',
-        'e3e28', 'f3f28', 'g3g28', 'h3h28', , , , 'd4d310', 'e4e28', 'f4f28', 'g4g28', 'h4h28', , , , , 'e5e28', 'f5f28', 'g5g28', 'h5h28', , , , , , , 'g6g28',
-        'h6h28', , , , , , , 'g7g28', 'h7h28', , , , , , , , 'h8h28', , , , , , , , , , 'b2e28', 'c2e28', 'g6f57', 'g6f56', 'g6f56', 'g6f56', 'g6f56', , 'b3b410', 'c3d310',
-        'g6g59', 'e3e28', 'f3f28', 'g3g28', 'h3h28', , 'g6f59', 'g6f59', 'd4d310', 'e4e28', 'f4f28', 'g4g28', 'h4h28', , 'g6f58', 'c5c210', 'd5d310',
-        'e5e28', 'f5f28', 'g5g28', 'h5h28', , 'g6f58', 'c6c210', 'd6d310', 'e6e28', 'f6f28', , 'h6h28', , 'g6f58', 'c7c210', 'd7d310', 'e7e28', 'f7f28',
-        'g7b710', 'h7h28', , 'g6f58', 'c8c210', 'd8d310', 'e8e28', 'f8f28', 'g8b810', 'h8h28', , , , , , , , , , 'b2e28', 'c2e28', 'd2e28', 'e2f28', 'f2g28',
-        'g2h28', 'h2g28', , 'b3b810', 'c3c210', 'h6g59', 'e3e28', 'f3f28', 'g3g28', 'h3h28', , 'b4b810', 'c4c210', 'd4d210', 'e4e28', 'f4f28', 'g4g28',
-        'h4h28', , 'b5b810', 'c5c210', 'd5d210', 'e5e28', 'f5f28', 'g5g28', 'h5h28', , 'b6b810', 'c6c210', 'd6d210', 'e6e28', 'f6f28', 'g6g28', ,
-        ,
-        'b7b810', 'c7c210', 'd7d210', 'e7e28', 'f7f28', 'g7g28', 'h7b711', , 'h6h710', 'c8c210', 'd8d210', 'e8e28', 'f8f28', 'g8g28', 'h8b810',
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b2b310', 'c2d210', 'd2e210', 'g7h68', 'g7h68', 'g7h68', 'g7h68', , , 'c3c210', 'd3d210', 'e3e210', 'f3f210',
-        'g3g210', 'h3h210', , , , 'd4d210', 'e4e210', 'f4f210', 'g4g210', 'h4h210', , , , , 'e5e210', 'f5f210', 'g5g210', 'h5h210', , , , , , 'f6f210', 'g6g210',
-        'h6h210', , , , , , , , 'h7h210', , , , , , , , 'h8h210', , , , , , , , , , 'b2b810', 'c2d210', 'd2e210', 'h7h68', 'h7h68', 'h7h68', 'h7h68', , 'b3b810', 'c3c210',
-        'd3d210', 'e3e210', 'f3f210', 'g3g210', 'h3h210', , 'b4b810', 'c4c210', 'd4d210', 'e4e210', 'f4f210', 'g4g210', 'h4h210', , 'b5b810', 'c5c210',
-        'd5d210', 'e5e210', 'f5f210', 'g5g210', 'h5h210', , 'b6b810', 'c6c210', 'd6d210', 'e6e210', 'f6f210', 'g6g210', 'h6h210', , 'b7b810', 'c7c210',
-        'd7d210', 'e7e210', 'f7f210', 'g7g210', , , 'h7h810', 'c8c210', 'd8d210', 'e8e210', 'f8f210', 'g8g210', 'h8b810', , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'b2b810', 'c2h210', 'd2h210', 'e2h210', 'f2h210', 'g2h210',
-        'h8h710', , , 'c3c212', 'd3d212', 'e3e212', 'f3f211', 'g3g211', 'h3h210', , , , 'd4d212', 'e4e212', 'f4f211', 'g4g211', 'h4h210', , , , , 'e5e212',
-        'f5f211', 'g5g211', 'h5h210', , , , , , 'f6f211', 'g6g211', 'h6h210', , , , , , , 'g7g211', 'h7h210', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'e1e24', 'f1f24', 'g1g24', 'h1h24', 'a2d24', , 'c2d24', 'd2e24', 'e2f24', 'f2g24', 'g2h24',
-        'h2g24', 'a3b34', , 'c3b34', 'd3d24', 'e3e24', 'f3f24', 'g3g24', 'h3h24', 'a4b44', , 'c4b44', 'd4d24', 'e4e24', 'f4f24', 'g4g24', 'h4h24',
-        'a5b56', , 'c5d56', 'd5d24', 'e5e24', 'f5f24', 'g5g24', 'h5h24', 'a6d66', , 'c6d66', 'd6d24', 'e6e24', 'f6f24', 'g6g24', 'h6h24', 'a7d76',
-        ,
-        'c7d76', 'd7d24', 'e7e24', 'f7f24', 'g7g24', 'h7h24', 'a8d86', , 'c8d86', 'd8d24', 'e8e24', 'f8f24', 'g8g24', 'h8h24', , , , , , 'e1d25', 'e1d25',
-        'e1d25', 'a2d26', , 'e1d24', 'e1d14', 'e1d14', 'e1d14', 'e1d14', 'e1d14', 'e1d25', , 'e1d25', 'e1d15', 'e1d15', 'e1d15', 'e1d15', 'e1d15',
-        'e1d26', , 'c4c36', 'e1d25', 'e1d25', 'e1d25', 'e1d25', 'e1d25', 'e1d26', , 'c5c36', 'e1d25', 'e1d25', 'e1d25', 'e1d25', 'e1d25', 'a6e67',
-        ,
-        'c6c36', 'e1d25', 'e1d25', 'e1d25', 'e1d25', 'e1d25', 'a7e77', , 'c7c36', 'e1d25', 'e1d25', 'e1d25', 'e1d25', 'e1d25', 'a8e87', , 'c8c36',
-        'e1d25', 'e1d25', 'e1d25', 'e1d25', 'e1d25', , , , , , , 'g1g26', 'h1h26', 'a2d26', , 'c2d26', 'd2e26', 'e2f26', 'f1e16', 'f1e16', 'f1e16', 'a3d38',
-        ,
-        'f1e16', 'd3d26', 'e3e26', 'f3f26', 'g3g26', 'h3h26', 'a4c48', , 'f1e17', 'd4d26', 'e4e26', 'f4f26', 'g4g26', 'h4h26', 'a5e59', , 'c5c48',
-        'd5d26', 'e5e26', 'f5f26', 'g5g26', 'h5h26', 'a6e69', , 'c6c48', 'd6d26', 'e6e26', 'f6f26', 'g6g26', 'h6h26', 'a7e79', , 'c7c48', 'd7d26',
-        'e7e26', 'f7f26', 'g7g26', 'h7h26', 'a8e89', , 'c8c48', 'd8d26', 'e8e26', 'f8f26', 'g8g26', 'h8h26', , , , , , , , 'h1h28', 'a2e27', , 'c2e27',
-        'g1f16', 'g1f16', 'g1f16', 'g1f16', 'g1f16', 'a3e39', , 'g1f28', 'd3d28', 'e3e27', 'f3f28', 'g1f18', 'g1f18', 'a4d410', , 'g1f18', 'd4d28',
-        'e4e27', 'f4f28', 'g4g28', 'h4h28', 'a5e510', , 'c5e510', 'd5d28', 'e5e27', 'f5f28', 'g5g28', 'h5h28', 'a6e610', , 'c6e610', 'd6d28', 'e6e27',
-        'f6f28', 'g6g28', 'h6h28', 'a7e710', , 'c7e710', 'd7d28', 'e7e27', 'f7f28', 'g7g28', 'h7h28', 'a8e810', , 'c8e810', 'd8d28', 'e8e27', 'f8f28',
-        'g8g28', 'h8h28', , , , , , , , , 'a2e28', , 'c2e28', 'd2e28', 'h1g17', 'h1g27', 'g2h28', 'h1g18', 'a3e310', , 'c3e310', 'd3d29', 'e3e28', 'f3f28',
-        'g3g28', 'h3h28', 'a4a311', , 'c4c311', 'd4d29', 'e4e28', 'f4f28', 'g4g28', 'h4h28', 'a5a311', , 'c5c311', 'd5d29', 'e5e28', 'f5f28', 'g5g28',
-        'h5h28', 'a6a311', , 'c6c311', 'd6d29', 'e6e28', 'f6f28', 'g6g28', 'h6h28', 'a7a311', , 'c7c311', 'd7d29', 'e7e28', 'f7f28', 'g7g28', 'h7h28',
-        'a8a311', , 'c8c311', 'd8d29', 'e8e28', 'f8f28', 'g8g28', 'h8h28', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , 'a2c24', , 'd2d34', , 'd2c33', 'd2c33', 'd2c33', 'd2c33', 'd2c32', , 'c3c24', 'd2c33', 'd2c33', 'd2c33', 'd2c33', 'd2c33',
-        'd2c32', , 'c4c24', 'd2c33', 'd2c33', 'd2c33', 'd2c33', 'd2c33', 'd2c32', , 'c5c24', 'd2c33', 'd2c33', 'd2c33', 'd2c33', 'd2c33', 'd2c32',
-        ,
-        'c6c24', 'd2c33', 'd2c33', 'd2c33', 'd2c33', 'd2c33', 'd2c32', , 'c7c24', 'd2c33', 'd2c33', 'd2c33', 'd2c33', 'd2c33', 'd2c32', , 'c8c24',
-        'd2c33', 'd2c33', 'd2c33', 'd2c33', 'd2c33', , , , , , , , , 'a2d26', , 'e2d24', 'e2d14', , 'e2d14', 'e2d14', 'e2d14', 'e2d25', , 'e2d25', 'e2d15',
-        'e2d15', 'e2d15', 'e2d15', 'e2d15', 'e2d26', , 'c4c36', 'e2d25', 'e2d25', 'e2d25', 'e2d25', 'e2d25', 'e2d26', , 'c5c36', 'e2d25', 'e2d25',
-        'e2d25', 'e2d25', 'e2d25', 'e2d36', , 'c6c36', 'e2d25', 'e2d25', 'e2d25', 'e2d25', 'e2d25', 'e2d36', , 'c7c36', 'e2d25', 'e2d25', 'e2d25',
-        'e2d25', 'e2d25', 'e2d36', , 'c8c36', 'e2d25', 'e2d25', 'e2d25', 'e2d25', 'e2d25', , , , , , , , , 'a2d26', , 'c2d26', 'd2e26', 'f2e35', , 'f2e35',
-        'f2e35', 'a3c38', , 'f2e16', 'd3d26', 'e3e26', 'f2e17', 'f2e17', 'f2e17', 'a4c48', , 'f2e17', 'd4d26', 'e4e26', 'f2e17', 'f2e17', 'f2e17',
-        'a5f59', , 'c5c48', 'd5d26', 'e5e26', 'f2e17', 'f2e17', 'f2e17', 'a6f69', , 'c6c48', 'd6d26', 'e6e26', 'f2e17', 'f2e17', 'f2e17', 'a7f79',
-        ,
-        'c7c48', 'd7d26', 'e7e26', 'f2e17', 'f2e17', 'f2e17', 'a8f89', , 'c8c48', 'd8d26', 'e8e26', 'f2e17', 'f2e17', 'f2e17', , , , , , , , , 'a2e27',
-        ,
-        'c2e27', 'g2f16', 'g2f16', 'g2f16', , 'g2f16', 'a3e39', , 'g2f28', 'd3d28', 'e3e27', 'f3f27', 'g2f18', 'g2f18', 'a4d410', , 'g2f18', 'd4d28',
-        'e4e27', 'f4f27', 'g2f19', 'g2f19', 'a5e510', , 'c5e510', 'd5d28', 'e5e27', 'f5f27', 'g2f29', 'g2f29', 'a6e610', , 'c6e610', 'd6d28', 'e6e27',
-        'f6f27', 'g2f29', 'g2f29', 'a7e710', , 'c7e710', 'd7d28', 'e7e27', 'f7f27', 'g2f29', 'g2f29', 'a8e810', , 'c8e810', 'd8d28', 'e8e27', 'f8f27',
-        'g2f29', 'g2f29', , , , , , , , , 'a2e28', , 'c2e28', 'd2e28', 'h2g17', 'h2g27', 'h2g37', , 'a3e310', , 'c3e310', 'd3d29', 'e3e28', 'f3f28', 'g3g28',
-        'h2g19', 'a4a311', , 'c4c311', 'd4d29', 'e4e28', 'f4f28', 'g4g28', 'h2g110', 'a5a311', , 'c5c311', 'd5d29', 'e5e28', 'f5f28', 'g5g28', 'h2g110',
-        'a6a311', , 'c6c311', 'd6d29', 'e6e28', 'f6f28', 'g6g28', 'h2g110', 'a7a311', , 'c7c311', 'd7d29', 'e7e28', 'f7f28', 'g7g28', 'h2g110', 'a8a311',
-        ,
-        'c8c311', 'd8d29', 'e8e28', 'f8f28', 'g8g28', 'h2g110', , , , , , , , , 'a2d27', , 'a3b32', 'a3b33', 'a3b45', 'a3b47', 'g2d27', 'h2d27', , , 'a3b32',
-        'd3c32', 'e3c32', 'f3c32', 'g3c32', 'h3c32', 'a4c42', , 'a3b32', 'd4c42', 'e4c42', 'f4c42', 'g4c42', 'h4c42', 'a5c52', , 'a3b32', 'd5c52',
-        'e5c52', 'f5c52', 'g5c52', 'h5c52', 'a6c62', , 'a3b32', 'd6c62', 'e6c62', 'f6c62', 'g6c62', 'h6c62', 'a7c72', , 'a3b32', 'd7c72', 'e7c72',
-        'f7c72', 'g7c72', 'h7c72', 'a8c82', , 'a3b32', 'd8c82', 'e8c82', 'f8c82', 'g8c82', 'h8c82', , , , , , , , , 'a2c22', , 'c2c32', 'd2d11', 'e2e11',
-        'f2f11', 'g2g11', 'h2h11', 'b3c32', , 'b3a32', 'd3d11', 'e3e11', 'f3f11', 'g3g11', 'h3h11', 'a4c42', 'b4c42', 'b3a32', 'd4d11', 'e4e11',
-        'f4f11', 'g4g11', 'h4h11', 'a5c52', 'b5c52', 'b3a32', 'd5d11', 'e5e11', 'f5f11', 'g5g11', 'h5h11', 'a6c62', 'b6c62', 'b3a32', 'd6d11', 'e6e11',
-        'f6f11', 'g6g11', 'h6h11', 'a7c72', 'b7c72', 'b3a32', 'd7d11', 'e7e11', 'f7f11', 'g7g11', 'h7h11', 'a8c82', 'b8c82', 'b3a32', 'd8d11', 'e8e11',
-        'f8f11', 'g8g11', 'h8h11', , , , , , , , , 'a2a32', , 'c3b32', 'c3b33', 'e2e33', 'f2f33', 'g2g33', 'h2h33', 'a3a42', , , 'c3b33', 'c3b33', 'c3b33',
-        'c3b33', 'c3b33', 'a4a52', , 'c3b32', 'd4a42', 'e4a42', 'f4a42', 'g4a42', 'h4a42', 'a5a62', , 'c3b32', 'd5a52', 'e5a52', 'f5a52', 'g5a52',
-        'h5a52', 'a6a72', , 'c3b32', 'd6a62', 'e6a62', 'f6a62', 'g6a62', 'h6a62', 'a7a82', , 'c3b32', 'd7a72', 'e7a72', 'f7a72', 'g7a72', 'h7a72',
-        'a8a72', , 'c3b32', 'd8a82', 'e8a82', 'f8a82', 'g8a82', 'h8a82', , , , , , , , , 'a2c24', , 'd3d24', 'd2c24', 'd3c33', 'd3c33', 'd3c33', 'd3c33',
-        'd3c32', , 'c3c24', , 'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c32', , 'c4c24', 'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c32', , 'c5c24',
-        'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c32', , 'c6c24', 'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c32', , 'c7c24', 'd3c33',
-        'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c32', , 'c8c24', 'd3c33', 'd3c33', 'd3c33', 'd3c33', 'd3c33', , , , , , , , , 'a2e25', , 'e3d24', 'd2e25',
-        'e2f25', 'e3e45', 'e3e45', 'e3e45', 'e3d25', , 'e3d25', 'e3d25', , 'e3d25', 'e3d25', 'e3d25', 'e3d26', , 'c4c36', 'e3d25', 'e3d25', 'e3d25',
-        'e3d25', 'e3d25', 'e3d26', , 'c5c36', 'e3d25', 'e3d25', 'e3d25', 'e3d25', 'e3d25', 'e3d36', , 'c6c36', 'e3d25', 'e3d25', 'e3d25', 'e3d25',
-        'e3d25', 'e3d36', , 'c7c36', 'e3d25', 'e3d25', 'e3d25', 'e3d25', 'e3d25', 'e3d36', , 'c8c36', 'e3d25', 'e3d25', 'e3d25', 'e3d25', 'e3d25',
-        ,
-        , , , , , , , 'a2d26', , 'c2d26', 'f3f26', 'f3e35', 'f3e35', 'f3e35', 'f3e35', 'a3d38', , 'f3e26', 'd3d26', 'e3e27', , 'f3e27', 'f3e27', 'a4c48',
-        ,
-        'f3e27', 'd4d26', 'e4e27', 'f3e27', 'f3e27', 'f3e27', 'a5e59', , 'c5c48', 'd5d26', 'e5e27', 'f3e27', 'f3e27', 'f3e27', 'a6e69', , 'c6c48',
-        'd6d26', 'e6e27', 'f3e27', 'f3e27', 'f3e27', 'a7e79', , 'c7c48', 'd7d26', 'e7e27', 'f3e27', 'f3e27', 'f3e27', 'a8e89', , 'c8c48', 'd8d26',
-        'e8e27', 'f3e27', 'f3e27', 'f3e27', , , , , , , , , 'a2e27', , 'c2e27', 'g3f26', 'g3f26', 'f2g27', 'g2h27', 'g3g47', 'a3e39', , 'g3f28', 'd3d28',
-        'e3e27', 'f3f27', , 'h3h27', 'a4d410', , 'g3f28', 'd4d28', 'e4e27', 'f4f27', 'g3f29', 'h4h27', 'a5e510', , 'c5e510', 'd5d28', 'e5e27', 'f5f27',
-        'g3f29', 'h5h27', 'a6e610', , 'c6e610', 'd6d28', 'e6e27', 'f6f27', 'g3f29', 'h6h27', 'a7e710', , 'c7e710', 'd7d28', 'e7e27', 'f7f27', 'g3f29',
-        'h7h27', 'a8e810', , 'c8e810', 'd8d28', 'e8e27', 'f8f27', 'g3f29', 'h8h27', , , , , , , , , 'a2e28', , 'c2e28', 'd2e28', 'h3g27', 'h3g27', 'h3g37',
-        'h3g37', 'a3e310', , 'c3e310', 'd3d29', 'e3e28', 'f3f28', 'g3g29', , 'a4a311', , 'c4c311', 'd4d29', 'e4e28', 'f4f28', 'g4g29', 'h3g210', 'a5a311',
-        ,
-        'c5c311', 'd5d29', 'e5e28', 'f5f28', 'g5g29', 'h3g210', 'a6a311', , 'c6c311', 'd6d29', 'e6e28', 'f6f28', 'g6g29', 'h3g210', 'a7a311', ,
-        'c7c311', 'd7d29', 'e7e28', 'f7f28', 'g7g29', 'h3g210', 'a8a311', , 'c8c311', 'd8d29', 'e8e28', 'f8f28', 'g8g29', 'h3g210', , , , , , , , , 'a2d27',
-        ,
-        'a4b32', 'a4b33', 'a4b45', 'a4b57', 'g2d27', 'h2d27', 'a3c36', , 'a4b32', 'a4b33', 'a4b33', 'a4b33', 'a4b33', 'a4b33', , , 'a4b32', 'a4b33',
-        'a4b33', 'a4b33', 'a4b33', 'a4b33', 'a4b33', , 'a4b32', 'a4b33', 'a4b33', 'a4b33', 'a4b33', 'a4b33', 'a4b33', , 'a4b32', 'a4b33', 'a4b33',
-        'a4b33', 'a4b33', 'a4b33', 'a4b33', , 'a4b32', 'a4b33', 'a4b33', 'a4b33', 'a4b33', 'a4b33', 'a4b33', , 'a4b32', 'a4b33', 'a4b33', 'a4b33',
-        'a4b33', 'a4b33', , , , , , , , , 'a2d25', , 'b4b32', 'b4b33', 'b4c33', 'b4c33', 'b4c33', 'b4c33', 'b4c32', , 'b4b32', 'b4c33', 'b4c33', 'b4c33',
-        'b4c33', 'b4c33', 'b4c32', , 'b4b32', 'b4c33', 'b4c33', 'b4c33', 'b4c33', 'b4c33', 'b4c32', 'b4b33', 'b4b32', 'b4c33', 'b4c33', 'b4c33',
-        'b4c33', 'b4c33', 'b4c32', 'b4b33', 'b4b32', 'b4c33', 'b4c33', 'b4c33', 'b4c33', 'b4c33', 'b4c32', 'b4b33', 'b4b32', 'b4c33', 'b4c33', 'b4c33',
-        'b4c33', 'b4c33', 'b4c32', 'b4b33', 'b4b32', 'b4c33', 'b4c33', 'b4c33', 'b4c33', 'b4c33', , , , , , , , , 'a2d25', , 'c4b32', 'c4b33', 'c4c33',
-        'c4c33', 'c4c33', 'c4c33', 'c4c32', , 'c4b32', 'c4c33', 'c4c33', 'c4c33', 'c4c33', 'c4c33', 'c4c32', , , 'c4c33', 'c4c33', 'c4c33', 'c4c33',
-        'c4c33', 'c4c32', , 'c4b32', 'c4c33', 'c4c33', 'c4c33', 'c4c33', 'c4c33', 'c4c32', , 'c4b32', 'c4c33', 'c4c33', 'c4c33', 'c4c33', 'c4c33',
-        'c4c32', , 'c4b32', 'c4c33', 'c4c33', 'c4c33', 'c4c33', 'c4c33', 'c4c32', , 'c4b32', 'c4c33', 'c4c33', 'c4c33', 'c4c33', 'c4c33', , , , , , , ,
-        ,
-        'a2d25', , 'd4d34', 'd4c34', 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c32', , 'd4e36', 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c32',
-        ,
-        'd4c34', , 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c32', , 'd4c34', 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c32', , 'd4c34', 'd4c33',
-        'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c32', , 'd4c34', 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c32', , 'd4c34', 'd4c33', 'd4c33',
-        'd4c33', 'd4c33', 'd4c33', , , , , , , , , 'a2e25', , 'e4d34', 'd2e25', 'e2f25', 'e4e35', 'e4e35', 'e4e35', 'e4d36', , 'e4e36', 'd3d26', 'e3e25',
-        'e4d35', 'e4d35', 'e4d35', 'e4d36', , 'e4d36', 'd4d26', , 'f4f25', 'g4g25', 'h4h25', 'e4d36', , 'e4d36', 'd5d26', 'e4d36', 'f5f25', 'g5g25',
-        'h5h25', 'e4d36', , 'e4d36', 'd6d26', 'e4d36', 'f6f25', 'g6g25', 'h6h25', 'e4d36', , 'e4d36', 'd7d26', 'e4d36', 'f7f25', 'g7g25', 'h7h25',
-        'e4d36', , 'e4d36', 'd8d26', 'e4d36', 'f8f25', 'g8g25', 'h8h25', , , , , , , , , 'a2d27', , 'c2d27', 'f4f36', 'f4e35', 'f4e35', 'f4e35', 'f4e35',
-        'a3d38', , 'f4e36', 'd3d27', 'e3e27', 'f3f27', 'f4e37', 'f4e37', 'a4c48', , 'f4e37', 'd4d27', 'e4e27', , 'g4g27', 'h4h27', 'a5a39', , 'c5c48',
-        'd5d27', 'e5e27', 'f4e39', 'g5g27', 'h5h27', 'a6a39', , 'c6c48', 'd6d27', 'e6e27', 'f4e39', 'g6g27', 'h6h27', 'a7a39', , 'c7c48', 'd7d27',
-        'e7e27', 'f4e39', 'g7g27', 'h7h27', 'a8a39', , 'c8c48', 'd8d27', 'e8e27', 'f4e39', 'g8g27', 'h8h27', , , , , , , , , 'a2e27', , 'c2e27', 'g4f36',
-        'e2f27', 'f2g27', 'g2h27', 'g4g57', 'a3e39', , 'c3e39', 'g4f38', 'e3e27', 'f3f27', 'g3g27', 'h3h27', 'a4d410', , 'g4f38', 'd4d29', 'e4e27',
-        'f4f27', , 'h4h27', 'a5e510', , 'c5e510', 'd5d29', 'e5e27', 'f5f27', 'g4f310', 'h5h27', 'a6e610', , 'c6e610', 'd6d29', 'e6e27', 'f6f27', 'g4f310',
-        'h6h27', 'a7e710', , 'c7e710', 'd7d29', 'e7e27', 'f7f27', 'g4f310', 'h7h27', 'a8e810', , 'c8e810', 'd8d29', 'e8e27', 'f8f27', 'g4f310', 'h8h27',
-        ,
-        , , , , , , , 'a2e28', , 'c2e28', 'd2e28', 'h4g37', 'h4g37', 'h4g37', 'h4g37', 'a3e310', , 'c3e310', 'd3d29', 'e3e28', 'f3f29', 'g3g29', 'h3h29',
-        'a4a311', , 'c4c311', 'd4d29', 'e4e28', 'f4f29', 'g4g29', , 'a5a311', , 'c5c311', 'd5d29', 'e5e28', 'f5f29', 'g5g29', 'h4g312', 'a6a311',
-        ,
-        'c6c311', 'd6d29', 'e6e28', 'f6f29', 'g6g29', 'h4g312', 'a7a311', , 'c7c311', 'd7d29', 'e7e28', 'f7f29', 'g7g29', 'h4g312', 'a8a311', ,
-        'c8c311', 'd8d29', 'e8e28', 'f8f29', 'g8g29', 'h4g312', , , , , , , , , 'a2d28', , 'c2c36', 'a5b45', 'a5b45', 'a5b57', 'a5b58', 'a5b58', 'a3c36',
-        ,
-        'a5b45', 'a5b46', 'e3c36', 'f3c36', 'g3c36', 'h3c36', 'a4c46', , 'a5b45', 'a5b46', 'a5b46', 'a5b46', 'a5b46', 'a5b46', , , 'a5b45', 'a5b46',
-        'a5b46', 'a5b46', 'a5b46', 'a5b46', 'a5b46', , 'a5b45', 'a5b46', 'a5b46', 'a5b46', 'a5b46', 'a5b46', 'a5b46', , 'a5b45', 'a5b46', 'a5b46',
-        'a5b46', 'a5b46', 'a5b46', 'a5b46', , 'a5b45', 'a5b46', 'a5b46', 'a5b46', 'a5b46', 'a5b46', , , , , , , , , 'a2e27', , 'c2c36', 'b5c45', 'b5c45',
-        'b5c45', 'b5c45', 'b5c45', 'a3c36', , 'b5b45', 'b5b46', 'e3c36', 'f3c36', 'g3c36', 'h3c36', 'a4c46', , 'b5b45', 'b5c46', 'b5b46', 'b5b46',
-        'b5b46', 'b5b46', 'b5b46', , 'b5b45', 'b5c46', 'b5b46', 'b5b46', 'b5b46', 'b5b46', 'a6c66', 'b5b46', 'b5b45', 'b5c46', 'b5b46', 'b5b46',
-        'b5b46', 'b5b46', 'a7c76', 'b5b46', 'b5b45', 'b5c46', 'b5b46', 'b5b46', 'b5b46', 'b5b46', 'a8c86', 'b5b46', 'b5b45', 'b5c46', 'b5b46', 'b5b46',
-        'b5b46', 'b5b46', , , , , , , , , 'a2e27', , 'c2c36', 'c5d45', 'c5d45', 'c5d45', 'c5d45', 'c5d45', 'a3c36', , 'c5b45', 'c5b46', 'e3c36', 'f3c36',
-        'g3c36', 'h3c36', 'a4c46', , 'c5b45', 'c5c46', 'c5b46', 'c5b46', 'c5b46', 'c5b46', 'c5b46', , , 'c5c46', 'c5b46', 'c5b46', 'c5b46', 'c5b46',
-        'c5b46', , 'c5b45', 'c5c46', 'c5b46', 'c5b46', 'c5b46', 'c5b46', 'c5b46', , 'c5b45', 'c5c46', 'c5b46', 'c5b46', 'c5b46', 'c5b46', 'c5b46',
-        ,
-        'c5b45', 'c5c46', 'c5b46', 'c5b46', 'c5b46', 'c5b46', , , , , , , , , 'a2e27', , 'c2c37', 'd5d45', 'd5e45', 'd5e45', 'd5e45', 'd5e45', 'a3c37',
-        ,
-        'd5c46', 'd3d47', 'd5c47', 'd5c47', 'd5c47', 'd5c47', 'a4d47', , 'd5c56', 'd5c46', 'd5c47', 'd5c47', 'd5c47', 'd5c47', 'd5c47', , 'c5c37',
-        ,
-        'd5c47', 'd5c47', 'd5c47', 'd5c47', 'a6d67', , 'c6d67', 'd5c46', 'd5c47', 'd5c47', 'd5c47', 'd5c47', 'a7d77', , 'c7d77', 'd5c46', 'd5c47',
-        'd5c47', 'd5c47', 'd5c47', 'a8d87', , 'c8d87', 'd5c46', 'd5c47', 'd5c47', 'd5c47', 'd5c47', , , , , , , , , 'a2e27', , 'c2e27', 'e5d45', 'e5e45',
-        'e5e45', 'e5e45', 'e5e45', 'a3c38', , 'e5e47', 'd3c38', 'e3e27', 'f3f27', 'g3g27', 'h3h27', 'a4c49', , 'c4c38', 'e5d57', 'e4e27', 'f4f27',
-        'g4g27', 'h4h27', 'e5d49', , 'c5c38', 'e5d47', , 'f5f27', 'g5g27', 'h5h27', 'e5d49', , 'c6c38', 'e5d47', 'e5d49', 'f6f27', 'g6g27', 'h6h27',
-        'e5d49', , 'c7c38', 'e5d47', 'e5d49', 'f7f27', 'g7g27', 'h7h27', 'e5d49', , 'c8c38', 'e5d47', 'e5d49', 'f8f27', 'g8g27', 'h8h27', , , , , , , ,
-        ,
-        'a2e27', , 'c2e27', 'f5e46', 'f5e45', 'f5e45', 'f5e45', 'f5e45', 'a3d39', , 'f5e47', 'f5f48', 'e3e27', 'f3f27', 'g3g27', 'h3h27', 'a4c49',
-        ,
-        'f5f48', 'd4d39', 'e4e27', 'f4f27', 'g4g27', 'h4h27', 'a5c510', , 'f5e48', 'd5d39', 'e5e27', , 'g5g27', 'h5h27', 'a6c610', , 'f5e48', 'd6d39',
-        'e6e27', 'f5f410', 'g6g27', 'h6h27', 'a7c710', , 'f5e48', 'd7d39', 'e7e27', 'f5f410', 'g7g27', 'h7h27', 'a8c810', , 'f5e48', 'd8d39', 'e8e27',
-        'f5f410', 'g8g27', 'h8h27', , , , , , , , , 'a2e27', , 'c2e27', 'd2e27', 'e2f27', 'f2g27', 'g2h27', 'g5g47', 'g5f49', , 'g5f49', 'g5f48', 'e3e27',
-        'f3f27', 'g3g27', 'h3h27', 'g5f410', , 'g5f48', 'd4d29', 'e4e27', 'f4f27', 'g4g27', 'h4h27', 'a5e511', , 'g5f410', 'd5d29', 'e5e27', 'f5f27',
-        ,
-        'h5h27', 'a6e611', , 'g5f410', 'd6d29', 'e6e27', 'f6f27', 'g5f410', 'h6h27', 'a7e711', , 'g5f410', 'd7d29', 'e7e27', 'f7f27', 'g5f410',
-        'h7h27', 'a8e811', , 'g5f410', 'd8d29', 'e8e27', 'f8f27', 'g5f410', 'h8h27', , , , , , , , , 'a2d29', , 'c2d29', 'd2e29', 'h5g47', 'h5g47', 'h5g47',
-        'h5g47', 'a3e310', , 'c3e310', 'd3d29', 'e3e29', 'f3f29', 'g3g29', 'h3h29', 'a4a311', , 'c4c311', 'd4d29', 'e4e29', 'f4f29', 'g4g29', 'h4h29',
-        'a5a311', , 'c5c311', 'd5d29', 'e5e29', 'f5f29', 'g5g29', , 'a6a311', , 'c6c311', 'd6d29', 'e6e29', 'f6f29', 'g6g29', 'h5g412', 'a7a311',
-        ,
-        'c7c311', 'd7d29', 'e7e29', 'f7f29', 'g7g29', 'h5g412', 'a8a311', , 'c8c311', 'd8d29', 'e8e29', 'f8f29', 'g8g29', 'h5g412', , , , , , , , , 'a2h29',
-        ,
-        'c2c48', 'a6b58', 'a6b57', 'a6b57', 'a6b58', 'a6b58', 'a3c39', , 'a6b56', 'a6b57', 'a6b59', 'f3c39', 'g3c39', 'h3h29', 'a4c48', , 'a6b56',
-        'a6b57', 'e4c48', 'f4c48', 'g4c48', 'h4c48', 'a5c58', , 'a6b56', 'a6b57', 'e5c58', 'f5c58', 'g5c58', 'h5c58', , , 'a6b56', 'a6b57', 'e6c68',
-        'f6c68', 'g6c68', 'h6c68', 'a7c78', , 'a6b56', 'a6b57', 'e7c78', 'f7c78', 'g7c78', 'h7c78', 'a8c88', , 'a6b56', 'a6b57', 'e8c88', 'f8c88',
-        'g8c88', 'h8c88', , , , , , , , , 'a2d29', , 'c2c38', 'b6c58', 'b6c57', 'b6c57', 'b6c57', 'b6c57', 'a3c38', , 'b6c56', 'b6c57', 'e3c38', 'f3c38',
-        'g3c38', 'h3c38', 'a4c48', , 'b6c56', 'b6c57', 'e4c48', 'f4c48', 'g4c48', 'h4c48', 'a5c58', , 'b6b56', 'b6c57', 'e5c58', 'f5c58', 'g5c58',
-        'h5c58', 'b6c59', , 'b6b56', 'b6c57', 'e6c68', 'f6c68', 'g6c68', 'h6c68', 'a7c78', 'b7c78', 'b6b56', 'b6c57', 'e7c78', 'f7c78', 'g7c78',
-        'h7c78', 'a8c88', 'b8c88', 'b6b56', 'b6c57', 'e8c88', 'f8c88', 'g8c88', 'h8c88', , , , , , , , , 'a2d29', , 'c2c48', 'c6d58', 'c6d57', 'c6d57',
-        'c6d57', 'c6d57', 'a3c39', , 'c6c56', 'c6c57', 'c6d59', 'c6d59', 'c6d59', 'c6d59', 'a4c48', , 'c6c56', 'c6d57', 'e4c48', 'f4c48', 'g4c48',
-        'h4c48', 'a5c58', , 'c6b56', 'c6c57', 'e5c58', 'f5c58', 'g5c58', 'h5c58', 'c6d59', , , 'c6d57', 'c6d59', 'c6d59', 'c6d59', 'c6d59', 'a7d79',
-        ,
-        'c6b56', 'c6d57', 'c6d59', 'c6d59', 'c6d59', 'c6d59', 'a8d89', , 'c6b56', 'c6d57', 'c6d59', 'c6d59', 'c6d59', 'c6d59', , , , , , , , , 'a2d29',
-        ,
-        'c2c48', 'd6d58', 'd6e57', 'd6e57', 'd6e57', 'd6e57', 'a3c39', , 'd6c56', 'd6c57', 'd6d59', 'd6d59', 'd6d59', 'd6d59', 'a4c48', , 'd6c56',
-        'd6d57', 'e4c48', 'f4c48', 'g4c48', 'h4c48', 'a5c59', , 'c5c48', 'd6c57', 'd6d59', 'd6d59', 'd6d59', 'd6d59', 'a6c69', , 'c6c48', , 'd6d59',
-        'd6d59', 'd6d59', 'd6d59', 'a7c79', , 'c7c48', 'd6d57', 'd6d59', 'd6d59', 'd6d59', 'd6d59', 'a8c89', , 'c8c48', 'd6d57', 'd6d59', 'd6d59',
-        'd6d59', 'd6d59', , , , , , , , , 'a2d29', , 'c2c49', 'e6d58', 'e6f57', 'e6f57', 'e6f57', 'e6f57', 'e6d59', , 'e6d57', 'e6d58', 'e3e29', 'e6d59',
-        'e6d59', 'e6d59', 'a4c49', , 'e6d58', 'e6d57', 'e4e29', 'e6d59', 'e6d59', 'e6d59', 'e6d59', , 'e6d58', 'd5d29', 'e5e29', 'e6d59', 'e6d59',
-        'e6d59', 'e6d59', , 'e6d58', 'e6d57', , 'e6d59', 'e6d59', 'e6d59', 'e6d59', , 'e6d58', 'e6d57', 'e6d59', 'e6d59', 'e6d59', 'e6d59', 'e6d59',
-        ,
-        'e6d58', 'e6d57', 'e6d59', 'e6d59', 'e6d59', 'e6d59', , , , , , , , , 'a2d29', , 'c2d29', 'd2e29', 'f6g57', 'f6g57', 'f6g57', 'f6g57', 'f6e510',
-        ,
-        'f6e58', 'd3d29', 'e3e29', 'f3f29', 'g3g29', 'h3h29', 'a4c410', , 'f6f59', 'd4d29', 'e4e29', 'f4f29', 'g4g29', 'h4h29', 'f6e510', , 'c5c610',
-        'd5d29', 'e5e29', 'f5f29', 'g5g29', 'h5h29', 'a6c610', , 'c6c710', 'd6d29', 'e6e29', , 'g6g29', 'h6h29', 'a7c710', , 'c7c810', 'd7d29', 'e7e29',
-        'f6e510', 'g7g29', 'h7h29', 'a8c810', , 'c8c710', 'd8d29', 'e8e29', 'f6e510', 'g8g29', 'h8h29', , , , , , , , , 'a2d29', , 'c2d29', 'd2e29', 'g6g57',
-        'g6g57', 'g6g57', 'g6g57', 'a3e311', , 'g6f510', 'd3d29', 'e3e29', 'f3f29', 'g3g29', 'h3h29', 'a4d411', , 'g6f59', 'd4d29', 'e4e29', 'f4f29',
-        'g4g29', 'h4h29', 'a5c512', , 'g6f510', 'd5d29', 'e5e29', 'f5f29', 'g5g29', 'h5h29', 'a6c612', , 'g6f510', 'd6d29', 'e6e29', 'f6f29', , 'h6h29',
-        'a7c712', , 'g6f510', 'd7d29', 'e7e29', 'f7f29', 'g6f512', 'h7h29', 'a8c812', , 'g6f510', 'd8d29', 'e8e29', 'f8f29', 'g6f512', 'h8h29', ,
-        ,
-        , , , , , , 'a2d29', , 'c2d29', 'd2e29', 'h6g57', 'h6g57', 'h6g57', 'h6g57', 'a3e311', , 'c3e311', 'd3d29', 'e3e29', 'f3f29', 'g3g29', 'h3h29',
-        'a4e412', , 'h6g511', 'd4d29', 'e4e29', 'f4f29', 'g4g29', 'h4h29', 'a5a312', , 'c5c312', 'd5d29', 'e5e29', 'f5f29', 'g5g29', 'h5h29', 'a6a312',
-        ,
-        'c6c312', 'd6d29', 'e6e29', 'f6f29', 'g6g29', , 'a7a312', , 'c7c312', 'd7d29', 'e7e29', 'f7f29', 'g7g29', 'h6g512', 'a8a312', , 'c8c312',
-        'd8d29', 'e8e29', 'f8f29', 'g8g29', 'h6g512', , , , , , , , , 'a2h29', , 'c2c58', 'a7b69', 'a7b69', 'a7b69', 'a7b69', 'a7b79', 'a3c310', , 'a7b68',
-        'a7b610', 'e3c310', 'f3f210', 'g3g210', 'h3h29', 'a4c49', , 'a7b68', 'a7b69', 'e4c49', 'f4c49', 'g4c49', 'h4h29', 'a5c58', , 'a7b78', 'd5c58',
-        'e5c58', 'f5c58', 'g5c58', 'h5c58', 'a6c69', , 'a7b68', 'a7b69', 'e6c69', 'f6c69', 'g6c69', 'h6h29', , , 'a7b68', 'a7b69', 'e7c79', 'f7c79',
-        'g7c79', 'h7h29', 'a8c89', , 'a7b68', 'a7b69', 'e8c89', 'f8c89', 'g8c89', 'h8h29', , , , , , , , , 'a2h29', , 'c2c58', 'b7c69', 'b7c69', 'b7c69',
-        'b7c69', 'b7c79', 'a3c310', , 'b7b68', 'b7c610', 'e3c310', 'f3f210', 'g3g210', 'h3h29', 'a4c49', , 'b7c68', 'b7c69', 'e4c49', 'f4c49', 'g4c49',
-        'h4h29', 'a5c58', , 'b7c78', 'd5c58', 'e5c58', 'f5c58', 'g5c58', 'h5c58', 'a6c69', , 'b7b68', 'b7c69', 'e6c69', 'f6c69', 'g6c69', 'h6h29',
-        'b7c610', , 'b7b68', 'b7c69', 'e7c79', 'f7c79', 'g7c79', 'h7h29', 'a8c89', 'b8c89', 'b7b68', 'b7c69', 'e8c89', 'f8c89', 'g8c89', 'h8h29',
-        ,
-        , , , , , , , 'a2h29', , 'c2c58', 'c7d69', 'c7d69', 'c7d69', 'c7d69', 'c7d79', 'a3c310', , 'c3c58', 'c7d610', 'e3c310', 'f3f210', 'g3g210', 'h3h29',
-        'a4c49', , 'c4c58', 'c7c69', 'e4c49', 'f4c49', 'g4c49', 'h4h29', 'a5c58', , 'c7c68', 'd5c58', 'e5c58', 'f5c58', 'g5c58', 'h5c58', 'a6c69',
-        ,
-        'c6c58', 'c7c69', 'e6c69', 'f6c69', 'g6c69', 'h6h29', 'c7c610', , , 'c7d69', 'c7c610', 'c7c610', 'c7c610', 'h7h29', 'a8d810', , 'c7b68',
-        'c7d69', 'c7c610', 'c7c610', 'c7c610', 'h8h29', , , , , , , , , 'a2h29', , 'c2c49', 'd2h29', 'd7e69', 'd7e69', 'd7e69', 'd7e79', 'a3c310', , 'c3c49',
-        'd3d410', 'e3c310', 'f3f210', 'g3g210', 'h3h29', 'a4c49', , 'd7d68', 'd4c49', 'e4c49', 'f4c49', 'g4c49', 'h4h29', 'a5c59', , 'd7c68', 'd5c59',
-        'e5c59', 'f5c59', 'g5c59', 'h5h29', 'a6c610', , 'c6c59', 'd7c69', 'd7c610', 'd7c610', 'd7c610', 'h6h29', 'a7c710', , 'c7c59', , 'd7c610',
-        'd7c610', 'd7c610', 'h7h29', 'a8c810', , 'c8c59', 'd7d69', 'd7c610', 'd7c610', 'd7c610', 'h8h29', , , , , , , , , 'a2h29', , 'c2c49', 'd2h29', 'e2h29',
-        'e7f69', 'e7f69', 'e7f79', 'a3c311', , 'c3c49', 'd3d510', 'e3e211', 'f3f210', 'g3g210', 'h3h29', 'a4c49', , 'e7d68', 'd4c49', 'e4c49', 'f4c49',
-        'g4c49', 'h4h29', 'a5c510', , 'c5c49', 'e7d69', 'e5d510', 'e7d610', 'e7d610', 'h5h29', 'a6c611', , 'c6c49', 'd6d510', 'e6e211', 'f6f210',
-        'g6g210', 'h6h29', 'a7c711', , 'c7c49', 'e7d69', , 'f7f210', 'g7g210', 'h7h29', 'a8c811', , 'c8c49', 'e7d69', 'e7d611', 'f8f210', 'g8g210',
-        'h8h29', , , , , , , , , 'a2h29', , 'c2h29', 'd2h29', 'e2h29', 'f2h29', 'f7g69', 'f7g79', 'a3c312', , 'c3c410', 'd3d411', 'e3e211', 'f3f210', 'g3g210',
-        'h3h29', 'a4c410', , 'f7e69', 'd4c410', 'e4c410', 'f4f210', 'g4g210', 'h4h29', 'a5c511', , 'c5c410', 'f7e610', 'e5e211', 'f5f210', 'g5g210',
-        'h5h29', 'a6c612', , 'c6c410', 'd6d411', 'e6e211', 'f6f210', 'g6g210', 'h6h29', 'a7c712', , 'c7c410', 'd7d411', 'e7e211', , 'g7g210', 'h7h29',
-        'a8c812', , 'c8c410', 'd8d411', 'e8e211', 'f8c812', 'g8g210', 'h8h29', , , , , , , , , 'a2h29', , 'c2h29', 'd2h29', 'e2h29', 'f2h29', 'g2h29', 'g7h79',
-        'a3g312', , 'c3c512', 'd3d211', 'e3e211', 'f3f210', 'g3g210', 'h3h29', 'a4d412', , 'g7f610', 'd4d211', 'e4e211', 'f4f210', 'g4g210', 'h4h29',
-        'a5c512', , 'g7f611', 'd5d211', 'e5e211', 'f5f210', 'g5g210', 'h5h29', 'a6c612', , 'g7f610', 'd6d211', 'e6e211', 'f6f210', 'g6g210', 'h6h29',
-        'a7c712', , 'g7f610', 'd7d211', 'e7e211', 'f7f210', , 'h7h29', 'a8c812', , 'g7f610', 'd8d211', 'e8e211', 'f8f210', 'g7f612', 'h8h29', , , ,
-        ,
-        , , , , 'a2h29', , 'c2h29', 'd2h29', 'e2h29', 'f2h29', 'g2h29', 'h7h69', 'h7h612', , 'h7h612', 'd3d211', 'e3e211', 'f3f210', 'g3g210', 'h3h29',
-        'a4e413', , 'h7g612', 'd4d211', 'e4e211', 'f4f210', 'g4g210', 'h4h29', 'a5c514', , 'h7g612', 'd5d211', 'e5e211', 'f5f210', 'g5g210', 'h5h29',
-        'a6c614', , 'h7g612', 'd6d211', 'e6e211', 'f6f210', 'g6g210', 'h6h29', 'a7c713', , 'h7g612', 'd7d211', 'e7e211', 'f7f210', 'g7g210', , 'a8c813',
-        ,
-        'h7g612', 'd8d211', 'e8e211', 'f8f210', 'g8g210', 'h7g613', , , , , , , , , 'a2h211', , 'c2c510', 'a8b711', 'a8b711', 'a8b710', 'a8b710', 'a8b79',
-        'a3c311', , 'a8b710', 'd3c311', 'e3c311', 'f3c311', 'g3c311', 'h3h211', 'a4c411', , 'a8b79', 'a8b710', 'e4c411', 'f4c411', 'g4c411', 'h4h211',
-        'a5c510', , 'a8b78', 'a8b710', 'e5c510', 'f5c510', 'g5c510', 'h5c510', 'a6c610', , 'a8b79', 'a8b710', 'e6c610', 'f6c610', 'g6c610', 'h6c610',
-        'a7c710', , 'a8b79', 'a8b710', 'e7c710', 'f7c710', 'g7c710', 'h7c710', , , 'a8b79', 'a8b710', 'e8c810', 'f8c810', 'g8c810', 'h8c810', , , ,
-        ,
-        , , , , 'a2h211', , 'c2c510', 'b8c711', 'b8c711', 'b8c710', 'b8c710', 'b8c79', 'a3c311', , 'b8c710', 'd3c311', 'e3c311', 'f3c311', 'g3c311',
-        'h3h211', 'a4c411', , 'b8c79', 'b8c710', 'e4c411', 'f4c411', 'g4c411', 'h4h211', 'a5c510', , 'b8c78', 'b8c710', 'e5c510', 'f5c510', 'g5c510',
-        'h5c510', 'a6c610', , 'b8c79', 'b8c710', 'e6c610', 'f6c610', 'g6c610', 'h6c610', 'a7c710', , 'b8b79', 'b8c710', 'e7c710', 'f7c710', 'g7c710',
-        'h7c710', 'b8c712', , 'b8b79', 'b8c710', 'e8c810', 'f8c810', 'g8c810', 'h8c810', , , , , , , , , 'a2h211', , 'c2c510', 'c8d711', 'c8d711', 'c8d710',
-        'c8d710', 'c8d79', 'a3c311', , 'c3c510', 'd3c311', 'e3c311', 'f3c311', 'g3c311', 'h3h211', 'a4c411', , 'c8d79', 'c8d710', 'e4c411', 'f4c411',
-        'g4c411', 'h4h211', 'a5c510', , 'c8c78', 'c8d710', 'e5c510', 'f5c510', 'g5c510', 'h5c510', 'a6c610', , 'c8c79', 'c8d710', 'e6c610', 'f6c610',
-        'g6c610', 'h6c610', 'a7c710', , 'c8b79', 'c8c710', 'e7c710', 'f7c710', 'g7c710', 'h7c710', 'c8c712', , , 'c8d710', 'c8d712', 'c8c712', 'c8c712',
-        'h8h211', , , , , , , , , 'a2h211', , 'c2c510', 'd2h211', 'd8e711', 'd8e710', 'd8e710', 'd8e79', 'a3c311', , 'c3c510', 'd3c311', 'e3c311', 'f3c311',
-        'g3c311', 'h3h211', 'a4c411', , 'd8e79', 'd8d710', 'e4c411', 'f4c411', 'g4c411', 'h4h211', 'a5c510', , 'd8c78', 'd5c510', 'e5c510', 'f5c510',
-        'g5c510', 'h5c510', 'a6c610', , 'd8c79', 'd6c610', 'e6c610', 'f6c610', 'g6c610', 'h6c610', 'a7c711', , 'c7c610', 'd8c710', 'e7c711', 'f7c711',
-        'g7c711', 'h7h211', 'a8c811', , 'c8c610', , 'd8e712', 'd8c712', 'd8c712', 'h8h211', , , , , , , , , 'a2h211', , 'c2c510', 'd2h211', 'e2h211', 'e8f710',
-        'e8f710', 'e8f79', 'a3c311', , 'c3c510', 'd3c311', 'e3c311', 'f3c311', 'g3c311', 'h3h211', 'a4c411', , 'e8e79', 'e8d710', 'e4c411', 'f4c411',
-        'g4c411', 'h4h211', 'a5c510', , 'e8d79', 'd5c510', 'e5c510', 'f5c510', 'g5c510', 'h5c510', 'a6c611', , 'c6c510', 'e8d710', 'e6c611', 'f6c611',
-        'g6c611', 'h6h211', 'a7c711', , 'c7c510', 'd7c711', 'e7c711', 'f7c711', 'g7c711', 'h7h211', 'a8c811', , 'c8c510', 'e8d710', , 'f8f212', 'g8g212',
-        'h8h211', , , , , , , , , 'a2h211', , 'c2c511', 'd2h211', 'e2h211', 'f8g710', 'f8g710', 'f8g79', 'a3c312', , 'c3c511', 'd3d512', 'e3e212', 'f3f212',
-        'f8g712', 'h3h211', 'a4c412', , 'f8e79', 'f8f711', 'e4e212', 'f4f212', 'g4g212', 'h4h211', 'a5c511', , 'f8e710', 'f8e710', 'e5c511', 'f5c511',
-        'g5c511', 'h5h211', 'a6c612', , 'c6c511', 'd6d512', 'e6e212', 'f6f212', 'g6g212', 'h6h211', 'a7c712', , 'c7c511', 'd7d512', 'e7e212', 'f7f212',
-        'g7g212', 'h7h211', 'a8c812', , 'c8c511', 'd8d512', 'e8e212', , 'g8g212', 'h8h211', , , , , , , , , 'a2h211', , 'c2h211', 'd2h211', 'e2h211', 'g8h710',
-        'g8h710', 'g8h79', 'a3h313', , 'c3c512', 'd3d212', 'e3e212', 'f3f212', 'g3g212', 'h3h211', 'g8f713', , 'g8f710', 'g8f711', 'e4e212', 'f4f212',
-        'g4g212', 'h4h211', 'a5c512', , 'g8f711', 'd5d212', 'e5e212', 'f5f212', 'g5g212', 'h5h211', 'a6c613', , 'c6c712', 'd6d212', 'e6e212', 'f6f212',
-        'g6g212', 'h6h211', 'a7c712', , 'c7c812', 'd7d212', 'e7e212', 'f7f212', 'g7g212', 'h7h211', 'a8c812', , 'c8c712', 'd8d212', 'e8e212', 'f8f212',
-        ,
-        'h8h211', , , , , , , , , 'a2h211', , 'c2h211', 'd2h211', 'e2h211', 'h8h710', 'h8h710', 'h8h79', 'a3h313', , 'c3c713', 'd3d212', 'e3e212', 'f3f212',
-        'g3g212', 'h3h211', 'a4c414', , 'c4c713', 'd4d212', 'e4e212', 'f4f212', 'g4g212', 'h4h211', 'a5c514', , 'h8g712', 'd5d212', 'e5e212', 'f5f212',
-        'g5g212', 'h5h211', 'a6c614', , 'h8g712', 'd6d212', 'e6e212', 'f6f212', 'g6g212', 'h6h211', 'a7c713', , 'h8g712', 'd7d212', 'e7e212', 'f7f212',
-        'g7g212', 'h7h211', 'a8c813', , 'h8g712', 'd8d212', 'e8e212', 'f8f212', 'g8g212', , , , , , , , , , 'a2b28', 'a1a28', , 'd2b28', 'e2b28', 'f2b28',
-        'g2b28', 'h2b28', 'a3a28', 'b3b28', , 'a1a211', 'e3e210', 'f3f29', 'g3g29', 'h3h29', 'a4a28', 'b4b28', , 'd4d311', 'e4e210', 'f4f29', 'g4g29',
-        'h4h29', 'a5a28', 'b5b28', , 'd5d311', 'e5e210', 'f5f29', 'g5g29', 'h5h29', 'a6a28', 'b6b28', , 'd6d311', 'e6e210', 'f6f29', 'g6g29', 'h6h29',
-        'a7a28', 'b7b28', , 'd7d311', 'e7e210', 'f7f29', 'g7g29', 'h7h29', 'a8a28', 'b8b28', , 'd8d311', 'e8e210', 'f8f29', 'g8g29', 'h8h29', , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'f1f25', 'g1g25', 'h1h25', 'a2d25', 'b2d25', , 'd2e25',
-        'e2f25', 'f2g25', 'g2h25', 'h2g25', 'a3c36', 'b3c36', , 'd3d25', 'e3e25', 'f3f25', 'g3g25', 'h3h25', 'a4c47', 'b4c47', , 'd4d25', 'e4e25',
-        'f4f25', 'g4g25', 'h4h25', 'a5e57', 'b5e57', , 'd5d25', 'e5e25', 'f5f25', 'g5g25', 'h5h25', 'a6e67', 'b6e67', , 'd6d25', 'e6e25', 'f6f25',
-        'g6g25', 'h6h25', 'a7e77', 'b7e77', , 'd7d25', 'e7e25', 'f7f25', 'g7g25', 'h7h25', 'a8e87', 'b8e87', , 'd8d25', 'e8e25', 'f8f25', 'g8g25',
-        'h8h25', , , , , , , 'f1e17', 'f1e17', 'a2e27', 'b2e27', , 'f1e15', 'f1e15', 'f1e15', 'f1e15', 'f1e15', 'a3a27', 'f1e17', , 'f1e17', 'e3e27', 'f1e17',
-        'f1e17', 'f1e17', 'a4a27', 'f1e28', , 'f1e27', 'e4e27', 'f1e17', 'f1e17', 'f1e17', 'a5a27', 'b5b39', , 'f1e27', 'e5e27', 'f1e17', 'f1e17',
-        'f1e17', 'a6a27', 'b6b39', , 'f1e27', 'e6e27', 'f1e17', 'f1e17', 'f1e17', 'a7a27', 'b7b39', , 'f1e27', 'e7e27', 'f1e17', 'f1e17', 'f1e17',
-        'a8a27', 'b8b39', , 'f1e27', 'e8e27', 'f1e17', 'f1e17', 'f1e17', , , , , , , , 'h1h27', 'a2e27', 'b2e27', , 'd2e27', 'g1f26', 'f2g27', 'g1f17',
-        'g1f17', 'a3a28', 'b3e39', , 'g1f18', 'e3e27', 'f3f27', 'g3g27', 'h3h27', 'a4a28', 'b4d410', , 'g1f19', 'e4e27', 'f4f27', 'g4g27', 'h4h27',
-        'a5a28', 'b5b310', , 'd5d410', 'e5e27', 'f5f27', 'g5g27', 'h5h27', 'a6a28', 'b6b310', , 'd6d410', 'e6e27', 'f6f27', 'g6g27', 'h6h27', 'a7a28',
-        'b7b310', , 'd7d410', 'e7e27', 'f7f27', 'g7g27', 'h7h27', 'a8a28', 'b8b310', , 'd8d410', 'e8e27', 'f8f27', 'g8g27', 'h8h27', , , , , , , , , 'a2f28',
-        'b2f28', , 'd2f28', 'h1g17', 'h1g17', 'h1g17', 'h1g17', 'a3a29', 'h1g110', , 'h1g110', 'e3e29', 'f3f28', 'g3g29', 'h1g19', 'a4a29', 'b4e412',
-        ,
-        'h1g110', 'e4e29', 'f4f28', 'g4g29', 'h4h29', 'a5a29', 'b5f512', , 'd5f512', 'e5e29', 'f5f28', 'g5g29', 'h5h29', 'a6a29', 'b6f612', , 'd6f612',
-        'e6e29', 'f6f28', 'g6g29', 'h6h29', 'a7a29', 'b7f712', , 'd7f712', 'e7e29', 'f7f28', 'g7g29', 'h7h29', 'a8a29', 'b8f812', , 'd8f812', 'e8e29',
-        'f8f28', 'g8g29', 'h8h29', , , , , , , , , , 'a2b37', , 'd2b28', 'e2b28', 'f2b28', 'g2b28', 'a2b38', 'a2b311', 'b3b28', , 'a2b32', 'e3e29', 'f3f29',
-        'g3g29', 'h3h29', 'a4a311', 'b4b28', , 'a2b32', 'a2b38', 'f4f29', 'g4g29', 'h4h29', 'a5a311', 'b5b28', , 'a2b32', 'a2b38', 'f5f29', 'g5g29',
-        'h5h29', 'a6a311', 'b6b28', , 'a2b32', 'a2b38', 'f6f29', 'g6g29', 'h6h29', 'a7a311', 'b7b28', , 'a2b32', 'a2b38', 'f7f29', 'g7g29', 'h7h29',
-        'a8a311', 'b8b28', , 'a2b32', 'a2b38', 'f8f29', 'g8g29', 'h8h29', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , 'a2d25', 'b2d25', , 'e2e15', , 'e2d34', 'e2d34', 'e2d34', 'a3c36', 'e2d32', , 'd3d25', 'e2d35', 'e2d35', 'e2d35', 'e2d35',
-        'e2d36', 'e2d32', , 'd4d25', 'e2d36', 'e2d36', 'e2d36', 'e2d36', 'e2d36', 'e2d32', , 'd5d25', 'e2d36', 'e2d36', 'e2d36', 'e2d36', 'e2d36',
-        'e2d32', , 'd6d25', 'e2d36', 'e2d36', 'e2d36', 'e2d36', 'e2d36', 'e2d32', , 'd7d25', 'e2d36', 'e2d36', 'e2d36', 'e2d36', 'e2d36', 'e2d32',
-        ,
-        'd8d25', 'e2d36', 'e2d36', 'e2d36', 'e2d36', , , , , , , , , 'a2e26', 'b2e26', , 'f2e15', 'f2e15', , 'f2e15', 'f2e15', 'a3a27', 'f2e17', , 'f2e17',
-        'e3e26', 'f2e17', 'f2e17', 'f2e17', 'a4a27', 'f2e28', , 'f2e27', 'e4e26', 'f2e17', 'f2e17', 'f2e17', 'a5a27', 'b5f59', , 'f2e27', 'e5e26',
-        'f2e17', 'f2e17', 'f2e17', 'a6a27', 'b6f69', , 'f2e27', 'e6e26', 'f2e17', 'f2e17', 'f2e17', 'a7a27', 'b7f79', , 'f2e27', 'e7e26', 'f2e17',
-        'f2e17', 'f2e17', 'a8a27', 'b8f89', , 'f2e27', 'e8e26', 'f2e17', 'f2e17', 'f2e17', , , , , , , , , 'a2e27', 'b2e27', , 'd2e27', 'g2f26', 'g2f36',
-        ,
-        'g2f36', 'a3a28', 'b3e39', , 'g2f18', 'e3e27', 'f3f27', 'g2f28', 'g2f28', 'a4a28', 'b4d410', , 'g2f19', 'e4e27', 'f4f27', 'g2f19', 'g2f19',
-        'a5a28', 'b5b310', , 'd5d410', 'e5e27', 'f5f27', 'g2f29', 'g2f29', 'a6a28', 'b6b310', , 'd6d410', 'e6e27', 'f6f27', 'g2f29', 'g2f29', 'a7a28',
-        'b7b310', , 'd7d410', 'e7e27', 'f7f27', 'g2f29', 'g2f29', 'a8a28', 'b8b310', , 'd8d410', 'e8e27', 'f8f27', 'g2f29', 'g2f29', , , , , , , , , 'a2f28',
-        'b2f28', , 'd2f28', 'h2g17', 'h2g17', 'h2g17', , 'a3a29', 'h2g110', , 'h2g110', 'e3e29', 'f3f28', 'g3g28', 'h2g19', 'a4a29', 'b4e412', , 'h2g110',
-        'e4e29', 'f4f28', 'g4g28', 'h2g111', 'a5a29', 'b5f512', , 'd5f512', 'e5e29', 'f5f28', 'g5g28', 'h2g111', 'a6a29', 'b6f612', , 'd6f612', 'e6e29',
-        'f6f28', 'g6g28', 'h2g111', 'a7a29', 'b7f712', , 'd7f712', 'e7e29', 'f7f28', 'g7g28', 'h2g111', 'a8a29', 'b8f812', , 'd8f812', 'e8e29', 'f8f28',
-        'g8g28', 'h2g111', , , , , , , , , 'a3b47', 'a3b37', , 'd2d46', 'a3a49', 'a3a49', 'a3a49', 'a3b48', , 'b3b29', , 'a3b32', 'e3e29', 'f3f29', 'g3g29',
-        'h3h29', 'a4d46', 'b4d46', , 'a3b32', 'e4d46', 'f4d46', 'g4d46', 'h4d46', 'a5d56', 'b5d56', , 'a3b32', 'e5d56', 'f5d56', 'g5d56', 'h5d56',
-        'a6d66', 'b6d66', , 'a3b32', 'e6d66', 'f6d66', 'g6d66', 'h6d66', 'a7d76', 'b7d76', , 'a3b32', 'e7d76', 'f7d76', 'g7d76', 'h7d76', 'a8d86',
-        'b8d86', , 'a3b32', 'e8d86', 'f8d86', 'g8d86', 'h8d86', , , , , , , , , 'a2b27', 'b2c27', , 'd2d32', 'b3c34', 'b3c46', 'b3c47', 'b3c47', 'a3a27',
-        ,
-        , 'd3d42', 'e3d32', 'f3d32', 'g3d32', 'h3d32', 'a4d42', 'b4d42', , 'd4d52', 'e4d42', 'f4d42', 'g4d42', 'h4d42', 'a5d52', 'b5d52', , 'd5d62',
-        'e5d52', 'f5d52', 'g5d52', 'h5d52', 'a6d62', 'b6d62', , 'd6d72', 'e6d62', 'f6d62', 'g6d62', 'h6d62', 'a7d72', 'b7d72', , 'd7d82', 'e7d72',
-        'f7d72', 'g7d72', 'h7d72', 'a8d82', 'b8d82', , 'd8d72', 'e8d82', 'f8d82', 'g8d82', 'h8d82', , , , , , , , , 'a2a11', 'b2b43', , 'd2d43', 'e2e11',
-        'f2f11', 'g2g11', 'h2h11', 'a3a11', 'c3d32', , 'c3b32', 'e3e11', 'f3f11', 'g3g11', 'h3h11', 'a4a11', 'c3d32', 'c4c53', 'c3b32', 'e4e11',
-        'f4f11', 'g4g11', 'h4h11', 'a5a11', 'c3d32', 'c5c63', 'c3b32', 'e5e11', 'f5f11', 'g5g11', 'h5h11', 'a6a11', 'c3d32', 'c6c73', 'c3b32', 'e6e11',
-        'f6f11', 'g6g11', 'h6h11', 'a7a11', 'c3d32', 'c7c83', 'c3b32', 'e7e11', 'f7f11', 'g7g11', 'h7h11', 'a8a11', 'c3d32', 'c8d83', 'c3b32', 'e8e11',
-        'f8f11', 'g8g11', 'h8h11', , , , , , , , , 'a2e24', 'b2b32', , 'd2e24', 'd3c34', 'f2g24', 'g2h24', 'h2g24', 'a3b32', 'b3b42', , , 'd3c34', 'd3c34',
-        'd3c34', 'd3c34', 'a4b42', 'b4b52', , 'd4b42', 'e4b42', 'f4b42', 'g4b42', 'h4b42', 'a5b52', 'b5b62', , 'd5b52', 'e5b52', 'f5b52', 'g5b52',
-        'h5b52', 'a6b62', 'b6b72', , 'd6b62', 'e6b62', 'f6b62', 'g6b62', 'h6b62', 'a7b72', 'b7b82', , 'd7b72', 'e7b72', 'f7b72', 'g7b72', 'h7b72',
-        'a8b82', 'b8b72', , 'd8b82', 'e8b82', 'f8b82', 'g8b82', 'h8b82', , , , , , , , , 'e3d35', 'b2d26', , 'e3e25', 'e3d34', 'e3d34', 'e3d34', 'e3d34',
-        'a3c36', 'e3d32', , 'd3d26', , 'e3d35', 'e3d35', 'e3d35', 'a4a26', 'e3d32', , 'd4d26', 'e3d36', 'e3d36', 'e3d36', 'e3d36', 'a5a26', 'e3d32',
-        ,
-        'd5d26', 'e3d36', 'e3d36', 'e3d36', 'e3d36', 'a6a26', 'e3d32', , 'd6d26', 'e3d36', 'e3d36', 'e3d36', 'e3d36', 'a7a26', 'e3d32', , 'd7d26',
-        'e3d36', 'e3d36', 'e3d36', 'e3d36', 'a8a26', 'e3d32', , 'd8d26', 'e3d36', 'e3d36', 'e3d36', 'e3d36', , , , , , , , , 'a2e26', 'b2e26', , 'f3e25',
-        'e2f26', 'f2g26', 'f3f46', 'f3f46', 'a3a27', 'f3e27', , 'f3e27', 'e3e26', , 'g3g26', 'h3h26', 'a4a27', 'f3e28', , 'f3e27', 'e4e26', 'f3e27',
-        'g4g26', 'h4h26', 'a5a27', 'b5e59', , 'f3e27', 'e5e26', 'f3e27', 'g5g26', 'h5h26', 'a6a27', 'b6e69', , 'f3e27', 'e6e26', 'f3e27', 'g6g26',
-        'h6h26', 'a7a27', 'b7e79', , 'f3e27', 'e7e26', 'f3e27', 'g7g26', 'h7h26', 'a8a27', 'b8e89', , 'f3e27', 'e8e26', 'f3e27', 'g8g26', 'h8h26',
-        ,
-        , , , , , , , 'a2e27', 'b2e27', , 'd2e27', 'g3f26', 'g3f36', 'g3f36', 'g3f36', 'a3a28', 'b3e39', , 'g3f28', 'e3e27', 'f3f28', , 'g3f28', 'a4a28',
-        'b4d410', , 'g3f29', 'e4e27', 'f4f28', 'g3f29', 'h4h28', 'a5a28', 'b5b310', , 'd5d410', 'e5e27', 'f5f28', 'g3f29', 'h5h28', 'a6a28', 'b6b310',
-        ,
-        'd6d410', 'e6e27', 'f6f28', 'g3f29', 'h6h28', 'a7a28', 'b7b310', , 'd7d410', 'e7e27', 'f7f28', 'g3f29', 'h7h28', 'a8a28', 'b8b310', , 'd8d410',
-        'e8e27', 'f8f28', 'g3f29', 'h8h28', , , , , , , , , 'a2f28', 'b2f28', , 'd2f28', 'h3g27', 'h3g27', 'g2h28', 'h2g28', 'a3a29', 'h3g210', , 'h3g210',
-        'e3e29', 'f3f28', 'g3g28', , 'a4a29', 'b4e412', , 'h3g210', 'e4e29', 'f4f28', 'g4g28', 'h3g211', 'a5a29', 'b5f512', , 'd5f512', 'e5e29', 'f5f28',
-        'g5g28', 'h3g211', 'a6a29', 'b6f612', , 'd6f612', 'e6e29', 'f6f28', 'g6g28', 'h3g211', 'a7a29', 'b7f712', , 'd7f712', 'e7e29', 'f7f28', 'g7g28',
-        'h3g211', 'a8a29', 'b8f812', , 'd8f812', 'e8e29', 'f8f28', 'g8g28', 'h3g211', , , , , , , , , 'a4b47', 'a4b37', , 'd2d46', 'a4a59', 'a4a59', 'a4a59',
-        'a4b58', 'a3d39', 'b3d39', , 'a4b32', 'e3e29', 'f3f29', 'g3g29', 'h3h29', , 'b4d46', , 'a4b32', 'e4d46', 'f4d46', 'g4d46', 'h4d46', 'a5d56',
-        'b5d56', , 'a4b32', 'e5d56', 'f5d56', 'g5d56', 'h5d56', 'a6d66', 'b6d66', , 'a4b32', 'e6d66', 'f6d66', 'g6d66', 'h6d66', 'a7d76', 'b7d76',
-        ,
-        'a4b32', 'e7d76', 'f7d76', 'g7d76', 'h7d76', 'a8d86', 'b8d86', , 'a4b32', 'e8d86', 'f8d86', 'g8d86', 'h8d86', , , , , , , , , 'b4c47', 'b2a27',
-        ,
-        'b4c34', 'b4c34', 'b4c46', 'b4c47', 'b4c47', 'a3d36', 'b3d36', , 'b4b32', 'b4c34', 'b4c34', 'b4c34', 'b4c34', 'b4c33', , , 'b4b32', 'b4c33',
-        'b4c33', 'b4c33', 'b4c33', 'b4c33', 'b4c33', , 'b4b32', 'b4c33', 'b4c33', 'b4c33', 'b4c33', 'b4c33', 'b4c33', , 'b4b32', 'b4c33', 'b4c33',
-        'b4c33', 'b4c33', 'b4c33', 'b4c33', , 'b4b32', 'b4c33', 'b4c33', 'b4c33', 'b4c33', 'b4c33', 'b4c33', , 'b4b32', 'b4c33', 'b4c33', 'b4c33',
-        'b4c33', , , , , , , , , 'c4d35', 'b2e26', , 'c4c34', 'c4d34', 'c4d34', 'c4d34', 'c4d34', 'c4d36', 'c4d32', , 'c4b32', 'c4c34', 'c4c34', 'c4c34',
-        'c4c34', 'c4c33', 'c4d32', , 'c4b32', 'c4c33', 'c4c33', 'c4c33', 'c4c33', 'c4c33', 'c4d32', 'c4c33', 'c4b32', 'c4c33', 'c4c33', 'c4c33',
-        'c4c33', 'c4c33', 'c4d32', 'c4c33', 'c4b32', 'c4c33', 'c4c33', 'c4c33', 'c4c33', 'c4c33', 'c4d32', 'c4c33', 'c4b32', 'c4c33', 'c4c33', 'c4c33',
-        'c4c33', 'c4c33', 'c4d32', 'c4c33', 'c4b32', 'c4c33', 'c4c33', 'c4c33', 'c4c33', , , , , , , , , 'd4d35', 'b2e26', , 'd4c34', 'd4d34', 'd4d34',
-        'd4d34', 'd4d34', 'd4d36', 'd4d32', , 'd4c34', 'd4c34', 'd4c34', 'd4c34', 'd4c34', 'd4c33', 'd4d32', , , 'd4c33', 'd4c33', 'd4c33', 'd4c33',
-        'd4c33', 'd4d32', , 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4d32', , 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c33',
-        'd4d32', , 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4d32', , 'd4c33', 'd4c33', 'd4c33', 'd4c33', 'd4c33', , , , , , , , , 'e4d35',
-        'b2e26', , 'e4d35', 'e4d34', 'e4d34', 'e4d34', 'e4d34', 'e4d36', 'e4d32', , 'e4e37', 'e4d35', 'e4d35', 'e4d35', 'e4d35', 'e4d36', 'e4d32',
-        ,
-        'e4d36', , 'e4d36', 'e4d36', 'e4d36', 'e4d36', 'e4d32', , 'e4d36', 'e4d36', 'e4d36', 'e4d36', 'e4d36', 'e4d36', 'e4d32', , 'e4d36', 'e4d36',
-        'e4d36', 'e4d36', 'e4d36', 'e4d36', 'e4d32', , 'e4d36', 'e4d36', 'e4d36', 'e4d36', 'e4d36', 'e4d36', 'e4d32', , 'e4d36', 'e4d36', 'e4d36',
-        'e4d36', 'e4d36', , , , , , , , , 'a2e26', 'b2e26', , 'd2e26', 'e2f26', 'f2g26', 'f4f36', 'f4f36', 'a3d38', 'b3d38', , 'f4e37', 'e3e26', 'f3f26',
-        'g3g26', 'h3h26', 'a4a28', 'f4e38', , 'd4d38', 'e4e26', , 'g4g26', 'h4h26', 'a5a28', 'f4e39', , 'd5d38', 'e5e26', 'f4e39', 'g5g26', 'h5h26',
-        'a6a28', 'f4e39', , 'd6d38', 'e6e26', 'f4e39', 'g6g26', 'h6h26', 'a7a28', 'f4e39', , 'd7d38', 'e7e26', 'f4e39', 'g7g26', 'h7h26', 'a8a28',
-        'f4e39', , 'd8d38', 'e8e26', 'f4e39', 'g8g26', 'h8h26', , , , , , , , , 'g4f37', 'b2e28', , 'd2e28', 'g4f36', 'g4f36', 'g4f36', 'g4f36', 'a3a28',
-        'b3e39', , 'g4f38', 'e3e28', 'f3f28', 'g3g28', 'h3h28', 'a4a28', 'b4d410', , 'g4f39', 'e4e28', 'f4f28', , 'h4h28', 'a5a28', 'b5b310', , 'd5d410',
-        'e5e28', 'f5f28', 'g4f311', 'h5h28', 'a6a28', 'b6b310', , 'd6d410', 'e6e28', 'f6f28', 'g4f311', 'h6h28', 'a7a28', 'b7b310', , 'd7d410', 'e7e28',
-        'f7f28', 'g4f311', 'h7h28', 'a8a28', 'b8b310', , 'd8d410', 'e8e28', 'f8f28', 'g4f311', 'h8h28', , , , , , , , , 'a2f28', 'b2f28', , 'd2f28', 'h4g37',
-        'f2g28', 'g2h28', 'h2g28', 'a3a29', 'h4g310', , 'h4g310', 'h4g39', 'f3f28', 'g3g28', 'h3h28', 'a4a29', 'b4e412', , 'h4g310', 'e4e210', 'f4f28',
-        'g4g28', , 'a5a29', 'b5f512', , 'd5f512', 'e5e210', 'f5f28', 'g5g28', 'h4g312', 'a6a29', 'b6f612', , 'd6f612', 'e6e210', 'f6f28', 'g6g28',
-        'h4g312', 'a7a29', 'b7f712', , 'd7f712', 'e7e210', 'f7f28', 'g7g28', 'h4g312', 'a8a29', 'b8f812', , 'd8f812', 'e8e210', 'f8f28', 'g8g28',
-        'h4g312', , , , , , , , , 'a5b47', 'b2e29', , 'd2d47', 'a5b59', 'a5a69', 'a5a69', 'a5b68', 'a3d39', 'b3d39', , 'a5b46', 'e3e29', 'f3f29', 'g3g29',
-        'h3h29', 'a4d47', 'b4d47', , 'a5b46', 'e4d47', 'f4d47', 'g4d47', 'h4d47', , 'b5d57', , 'a5b46', 'e5d57', 'f5d57', 'g5d57', 'h5d57', 'a6d67',
-        'b6d67', , 'a5b46', 'e6d67', 'f6d67', 'g6d67', 'h6d67', 'a7d77', 'b7d77', , 'a5b46', 'e7d77', 'f7d77', 'g7d77', 'h7d77', 'a8d87', 'b8d87',
-        ,
-        'a5b46', 'e8d87', 'f8d87', 'g8d87', 'h8d87', , , , , , , , , 'b5c47', 'b2h28', , 'd2d37', 'b5c46', 'b5c46', 'b5c47', 'b5c47', 'a3d37', 'b3d37',
-        ,
-        'b5b46', 'e3d37', 'f3d37', 'g3d37', 'h3d37', 'a4d47', 'b4d47', , 'b5c46', 'e4d47', 'f4d47', 'g4d47', 'h4d47', 'a5a28', , , 'b5c46', 'e5d57',
-        'f5d57', 'g5d57', 'h5d57', 'a6d67', 'b6d67', , 'b5c46', 'e6d67', 'f6d67', 'g6d67', 'h6d67', 'a7d77', 'b7d77', , 'b5c46', 'e7d77', 'f7d77',
-        'g7d77', 'h7d77', 'a8d87', 'b8d87', , 'b5c46', 'e8d87', 'f8d87', 'g8d87', 'h8d87', , , , , , , , , 'c5d47', 'b2e28', , 'd2d37', 'c5d46', 'c5d46',
-        'c5d46', 'c5d46', 'a3d37', 'b3d37', , 'c5b46', 'e3d37', 'f3d37', 'g3d37', 'h3d37', 'a4d47', 'b4d47', , 'c5c46', 'e4d47', 'f4d47', 'g4d47',
-        'h4d47', 'a5a28', 'c5c48', , 'c5c46', 'e5d57', 'f5d57', 'g5d57', 'h5d57', 'a6d67', 'b6d67', 'c6d67', 'c5c46', 'e6d67', 'f6d67', 'g6d67',
-        'h6d67', 'a7d77', 'b7d77', 'c7d77', 'c5c46', 'e7d77', 'f7d77', 'g7d77', 'h7d77', 'a8d87', 'b8d87', 'c8d87', 'c5c46', 'e8d87', 'f8d87', 'g8d87',
-        'h8d87', , , , , , , , , 'd5e47', 'b2e28', , 'd2d47', 'd5e46', 'd5e46', 'd5e46', 'd5e46', 'a3d38', 'b3d38', , 'd3d47', 'd5c48', 'f3f28', 'g3g28',
-        'h3h28', 'a4d47', 'b4d47', , 'd5c46', 'e4d47', 'f4d47', 'g4d47', 'h4d47', 'a5a28', 'd5c48', , , 'd5c48', 'd5c48', 'd5c48', 'd5c48', 'a6a28',
-        'd5c48', , 'd5c46', 'd5c48', 'd5c48', 'd5c48', 'd5c48', 'a7a28', 'd5c48', , 'd5c46', 'd5c48', 'd5c48', 'd5c48', 'd5c48', 'a8a28', 'd5c48',
-        ,
-        'd5c46', 'd5c48', 'd5c48', 'd5c48', 'd5c48', , , , , , , , , 'e5e47', 'b2e28', , 'd2e28', 'e5f46', 'e5f46', 'e5f46', 'e5f46', 'a3a28', 'b3d39',
-        ,
-        'e5f48', 'e3e28', 'f3f28', 'g3g28', 'h3h28', 'a4a28', 'e5e49', , 'e5d57', 'e4e28', 'f4f28', 'g4g28', 'h4h28', 'a5a28', 'e5e49', , 'd5d39',
-        ,
-        'f5f28', 'g5g28', 'h5h28', 'a6a28', 'e5e49', , 'd6d39', 'e5d49', 'f6f28', 'g6g28', 'h6h28', 'a7a28', 'e5e49', , 'd7d39', 'e5d49', 'f7f28',
-        'g7g28', 'h7h28', 'a8a28', 'e5e49', , 'd8d39', 'e5d49', 'f8f28', 'g8g28', 'h8h28', , , , , , , , , 'f5e47', 'b2e28', , 'd2e28', 'f5f46', 'f5f46',
-        'f5f46', 'f5f46', 'a3a28', 'b3d39', , 'f5f48', 'e3e28', 'f3f28', 'g3g28', 'h3h28', 'a4a28', 'f5e49', , 'd4d39', 'e4e28', 'f4f28', 'g4g28',
-        'h4h28', 'a5a28', 'f5e49', , 'd5d39', 'e5e28', , 'g5g28', 'h5h28', 'a6a28', 'f5e49', , 'd6d39', 'e6e28', 'f5e410', 'g6g28', 'h6h28', 'a7a28',
-        'f5e49', , 'd7d39', 'e7e28', 'f5e410', 'g7g28', 'h7h28', 'a8a28', 'f5e49', , 'd8d39', 'e8e28', 'f5e410', 'g8g28', 'h8h28', , , , , , , , , 'a2e28',
-        'b2e28', , 'd2e28', 'g5f46', 'g5f46', 'g5f46', 'g5f46', 'a3a28', 'b3e310', , 'g5f48', 'e3e28', 'f3f28', 'g3g28', 'h3h28', 'a4a28', 'b4d411',
-        ,
-        'g5g410', 'e4e28', 'f4f28', 'g4g28', 'h4h28', 'a5a28', 'b5b311', , 'g5f410', 'e5e28', 'f5f28', , 'h5h28', 'a6a28', 'b6b311', , 'g5f410',
-        'e6e28', 'f6f28', 'g5f411', 'h6h28', 'a7a28', 'b7b311', , 'g5f410', 'e7e28', 'f7f28', 'g5f411', 'h7h28', 'a8a28', 'b8b311', , 'g5f410', 'e8e28',
-        'f8f28', 'g5f411', 'h8h28', , , , , , , , , 'a2f28', 'b2f28', , 'd2f28', 'e2f28', 'f2g28', 'g2h28', 'h2g28', 'a3a210', 'h5g410', , 'h5g410', 'h5g49',
-        'f3f28', 'g3g28', 'h3h28', 'a4a210', 'b4e412', , 'h5g410', 'e4e210', 'f4f28', 'g4g28', 'h4h28', 'a5a210', 'b5b312', , 'd5d312', 'e5e210',
-        'f5f28', 'g5g28', , 'a6a210', 'b6b312', , 'd6d312', 'e6e210', 'f6f28', 'g6g28', 'h5g412', 'a7a210', 'b7b312', , 'd7d312', 'e7e210', 'f7f28',
-        'g7g28', 'h5g412', 'a8a210', 'b8b312', , 'd8d312', 'e8e210', 'f8f28', 'g8g28', 'h5g412', , , , , , , , , 'a6b58', 'b2f29', , 'd2d49', 'a6b59', 'a6b69',
-        'a6b69', 'a6b68', 'a3d310', 'b3d310', , 'a6b57', 'e3e210', 'f3f29', 'g3g29', 'h3h29', 'a4d49', 'b4d49', , 'a6b57', 'a6b59', 'f4f29', 'g4g29',
-        'h4h29', 'a5d59', 'b5d59', , 'a6b57', 'a6b59', 'f5f29', 'g5g29', 'h5h29', , 'b6d69', , 'a6b57', 'a6b59', 'f6f29', 'g6g29', 'h6h29', 'a7d79',
-        'b7d79', , 'a6b57', 'a6b59', 'f7f29', 'g7g29', 'h7h29', 'a8d89', 'b8d89', , 'a6b57', 'a6b59', 'f8f29', 'g8g29', 'h8h29', , , , , , , , , 'a2h28',
-        'b2h28', , 'd2h28', 'b6c58', 'b6c58', 'b6c58', 'b6c68', 'a3d310', 'b3d310', , 'b6c57', 'b6c510', 'f3f29', 'g3g29', 'h3h28', 'a4d49', 'b4d49',
-        ,
-        'b6c57', 'b6c59', 'f4f29', 'g4g29', 'h4h28', 'a5d59', 'b5d59', , 'b6c57', 'b6c59', 'f5f29', 'g5g29', 'h5h28', 'a6a210', , , 'b6c57', 'b6c59',
-        'f6f29', 'g6g29', 'h6h28', 'a7d79', 'b7d79', , 'b6c57', 'b6c59', 'f7f29', 'g7g29', 'h7h28', 'a8d89', 'b8d89', , 'b6c57', 'b6c59', 'f8f29',
-        'g8g29', 'h8h28', , , , , , , , , 'a2h28', 'b2h28', , 'd2h28', 'c6d58', 'c6d58', 'c6d58', 'c6d68', 'a3d310', 'b3d310', , 'c6c57', 'c6d510', 'f3f29',
-        'g3g29', 'h3h28', 'a4d49', 'b4d49', , 'c6d57', 'c6d59', 'f4f29', 'g4g29', 'h4h28', 'a5d59', 'b5d59', , 'c6c57', 'c6d59', 'f5f29', 'g5g29',
-        'h5h28', 'a6a210', 'c6d510', , 'c6c57', 'c6d59', 'f6f29', 'g6g29', 'h6h28', 'a7d79', 'b7d79', 'c7d79', 'c6c57', 'c6d59', 'f7f29', 'g7g29',
-        'h7h28', 'a8d89', 'b8d89', 'c8d89', 'c6c57', 'c6d59', 'f8f29', 'g8g29', 'h8h28', , , , , , , , , 'a2h28', 'b2h28', , 'd2h28', 'd6e58', 'd6e58',
-        'd6e58', 'd6e68', 'a3d310', 'b3d310', , 'd6c57', 'd6e510', 'f3f29', 'g3g29', 'h3h28', 'a4d410', 'b4d410', , 'd6d57', 'd6d59', 'f4f29', 'g4g29',
-        'h4h28', 'a5d59', 'b5d59', , 'd6c57', 'd6d59', 'f5f29', 'g5g29', 'h5h28', 'a6a210', 'd6e510', , , 'd6d59', 'f6f29', 'g6g29', 'h6h28', 'a7a210',
-        'd6e510', , 'd6c57', 'd6d59', 'f7f29', 'g7g29', 'h7h28', 'a8a210', 'd6e510', , 'd6c57', 'd6d59', 'f8f29', 'g8g29', 'h8h28', , , , , , , , , 'a2h28',
-        'b2h28', , 'd2h28', 'e2h28', 'e6f58', 'e6f58', 'e6f68', 'a3a210', 'b3d311', , 'e6d58', 'e3e210', 'f3f29', 'g3g29', 'h3h28', 'a4d410', 'b4d410',
-        ,
-        'e6d57', 'e6d59', 'f4f29', 'g4g29', 'h4h28', 'a5d510', 'b5d510', , 'e6d69', 'e6d59', 'f5f29', 'g5g29', 'h5h28', 'a6a210', 'e6e510', , 'd6d510',
-        ,
-        'f6f29', 'g6g29', 'h6h28', 'a7a210', 'e6e510', , 'd7d510', 'e6d59', 'f7f29', 'g7g29', 'h7h28', 'a8a210', 'e6e510', , 'd8d510', 'e6d59',
-        'f8f29', 'g8g29', 'h8h28', , , , , , , , , 'a2h28', 'b2h28', , 'd2h28', 'e2h28', 'f2h28', 'f6g58', 'f6g68', 'a3a210', 'b3g311', , 'f6f59', 'e3e210',
-        'f3f29', 'g3g29', 'h3h28', 'a4a210', 'b4d411', , 'f6f510', 'e4e210', 'f4f29', 'g4g29', 'h4h28', 'a5a210', 'f6e510', , 'f6e510', 'e5e210',
-        'f5f29', 'g5g29', 'h5h28', 'a6a210', 'f6e510', , 'd6d411', 'e6e210', , 'g6g29', 'h6h28', 'a7a210', 'f6e510', , 'd7d411', 'e7e210', 'f6e510',
-        'g7g29', 'h7h28', 'a8a210', 'f6e510', , 'd8d411', 'e8e210', 'f6e510', 'g8g29', 'h8h28', , , , , , , , , 'a2h28', 'b2h28', , 'd2h28', 'e2h28', 'f2h28',
-        'g2h28', 'g6h68', 'a3a210', 'g6g511', , 'g6f59', 'e3e210', 'f3f29', 'g3g29', 'h3h28', 'a4a210', 'b4d411', , 'g6f510', 'e4e210', 'f4f29',
-        'g4g29', 'h4h28', 'a5a210', 'g6f512', , 'd5d411', 'e5e210', 'f5f29', 'g5g29', 'h5h28', 'a6a210', 'g6f512', , 'd6d411', 'e6e210', 'f6f29',
-        ,
-        'h6h28', 'a7a210', 'g6f512', , 'd7d411', 'e7e210', 'f7f29', 'g6f512', 'h7h28', 'a8a210', 'g6f512', , 'd8d411', 'e8e210', 'f8f29', 'g6f512',
-        'h8h28', , , , , , , , , 'a2h28', 'b2h28', , 'd2h28', 'e2h28', 'f2h28', 'g2h28', 'h6h58', 'a3a210', 'h6g511', , 'h6g511', 'e3e210', 'f3f210', 'g3g29',
-        'h3h28', 'a4a210', 'b4e412', , 'h6g511', 'e4e210', 'f4f210', 'g4g29', 'h4h28', 'a5a210', 'b5d513', , 'h6g512', 'e5e210', 'f5f210', 'g5g29',
-        'h5h28', 'a6a210', 'b6g613', , 'd6g613', 'e6e210', 'f6f210', 'g6g29', , 'a7a210', 'b7g713', , 'd7g713', 'e7e210', 'f7f210', 'g7g29', 'h6g512',
-        'a8a210', 'b8g813', , 'd8g813', 'e8e210', 'f8f210', 'g8g29', 'h6g512', , , , , , , , , 'a2h210', 'b2h210', , 'd2d410', 'a7b610', 'a7b69', 'a7b69',
-        'a7b68', 'a3a210', 'a7b612', , 'a7b610', 'e3e211', 'f3f211', 'g3g211', 'h3h210', 'a4d410', 'b4d410', , 'a7b69', 'e4d410', 'f4d410', 'g4d410',
-        'h4h210', 'a5d510', 'b5d510', , 'a7b69', 'e5d510', 'f5d510', 'g5d510', 'h5h210', 'a6d610', 'b6d610', , 'a7b69', 'e6d610', 'f6d610', 'g6d610',
-        'h6h210', , 'b7d710', , 'a7b69', 'e7d710', 'f7d710', 'g7d710', 'h7h210', 'a8d810', 'b8d810', , 'a7b69', 'e8d810', 'f8d810', 'g8d810', 'h8h210',
-        ,
-        , , , , , , , 'a2h210', 'b2h210', , 'd2d410', 'b7c610', 'b7c69', 'b7c69', 'b7c68', 'a3a210', 'b3d312', , 'b7c610', 'e3e211', 'f3f211', 'b7c611',
-        'h3h210', 'a4d410', 'b4d410', , 'b7c69', 'e4d410', 'f4d410', 'g4d410', 'h4h210', 'a5d510', 'b5d510', , 'b7c69', 'e5d510', 'f5d510', 'g5d510',
-        'h5h210', 'a6d610', 'b6d610', , 'b7c69', 'e6d610', 'f6d610', 'g6d610', 'h6h210', 'a7a210', , , 'b7c69', 'e7d710', 'f7d710', 'g7d710', 'h7h210',
-        'a8d810', 'b8d810', , 'b7c69', 'e8d810', 'f8d810', 'g8d810', 'h8h210', , , , , , , , , 'a2h210', 'b2h210', , 'd2d410', 'c7d610', 'c7d69', 'c7d69',
-        'c7d68', 'a3a210', 'b3d312', , 'c7d610', 'e3e211', 'f3f211', 'c7d611', 'h3h210', 'a4d410', 'b4d410', , 'c7c69', 'e4d410', 'f4d410', 'g4d410',
-        'h4h210', 'a5d510', 'b5d510', , 'c7d69', 'e5d510', 'f5d510', 'g5d510', 'h5h210', 'a6d610', 'b6d610', , 'c7c69', 'e6d610', 'f6d610', 'g6d610',
-        'h6h210', 'a7a210', 'c7d612', , 'c7c69', 'e7d710', 'f7d710', 'g7d710', 'h7h210', 'a8d810', 'b8d810', 'c8d810', 'c7c69', 'e8d810', 'f8d810',
-        'g8d810', 'h8h210', , , , , , , , , 'a2h210', 'b2h210', , 'd2d410', 'd7e610', 'd7e69', 'd7e69', 'd7e68', 'a3a210', 'b3d312', , 'd3d410', 'e3e211',
-        'f3f211', 'd7e611', 'h3h210', 'a4d410', 'b4d410', , 'd7c69', 'e4d410', 'f4d410', 'g4d410', 'h4h210', 'a5d510', 'b5d510', , 'd7d69', 'e5d510',
-        'f5d510', 'g5d510', 'h5h210', 'a6d610', 'b6d610', , 'd7c69', 'e6d610', 'f6d610', 'g6d610', 'h6h210', 'a7a210', 'd7d612', , , 'd7d611', 'f7f211',
-        'g7g211', 'h7h210', 'a8a210', 'b8e812', , 'd7c69', 'd7d611', 'f8f211', 'g8g211', 'h8h210', , , , , , , , , 'a2h210', 'b2h210', , 'd2d510', 'e2h210',
-        'e7f69', 'e7f69', 'e7f68', 'a3a210', 'b3d312', , 'd3d510', 'e3e211', 'f3f211', 'e7f611', 'h3h210', 'a4a210', 'b4d411', , 'd4d510', 'e4e211',
-        'f4f211', 'g4g211', 'h4h210', 'a5d510', 'b5d510', , 'e7d69', 'e5d510', 'f5d510', 'g5d510', 'h5h210', 'a6a210', 'b6d612', , 'd6d510', 'e6e211',
-        'f6f211', 'g6g211', 'h6h210', 'a7a210', 'b7d712', , 'd7d510', , 'f7f211', 'g7g211', 'h7h210', 'a8a210', 'b8d812', , 'd8d510', 'e7d611', 'f8f211',
-        'g8g211', 'h8h210', , , , , , , , , 'a2h210', 'b2h210', , 'd2h210', 'e2h210', 'f7g69', 'f7g69', 'f7g68', 'a3a210', 'b3h312', , 'd3d411', 'e3e211',
-        'f3f211', 'f7f611', 'h3h210', 'a4a210', 'b4d411', , 'f7e610', 'e4e211', 'f4f211', 'g4g211', 'h4h210', 'a5a210', 'b5d512', , 'f7e610', 'e5e211',
-        'f5f211', 'g5g211', 'h5h210', 'a6a210', 'b6d613', , 'd6d411', 'e6e211', 'f6f211', 'g6g211', 'h6h210', 'a7a210', 'b7d713', , 'd7d411', 'e7e211',
-        ,
-        'g7g211', 'h7h210', 'a8a210', 'b8d813', , 'd8d411', 'e8e211', 'f7f613', 'g8g211', 'h8h210', , , , , , , , , 'a2h210', 'b2h210', , 'd2h210', 'e2h210',
-        'g7g69', 'g7h69', 'g7h68', 'a3a210', 'b3h312', , 'd3d412', 'e3e211', 'f3f211', 'g3g211', 'h3h210', 'a4a210', 'b4d412', , 'g7g611', 'e4e211',
-        'f4f211', 'g4g211', 'h4h210', 'a5a210', 'b5d513', , 'd5d412', 'e5e211', 'f5f211', 'g5g211', 'h5h210', 'a6a210', 'b6h613', , 'd6d412', 'e6e211',
-        'f6f211', 'g6g211', 'h6h210', 'a7a210', 'b7b313', , 'd7d412', 'e7e211', 'f7f211', , 'h7h210', 'a8a210', 'b8h813', , 'd8d412', 'e8e211', 'f8f211',
-        'g7h613', 'h8h210', , , , , , , , , 'a2h210', 'b2h210', , 'd2h210', 'e2h210', 'h7g69', 'h7h69', 'h7h68', 'a3a210', 'b3g313', , 'd3g313', 'e3e211',
-        'f3f211', 'g3g211', 'h3h210', 'a4a210', 'b4e413', , 'h7g611', 'e4e211', 'f4f211', 'g4g211', 'h4h210', 'a5a210', 'b5d514', , 'h7h613', 'e5e211',
-        'f5f211', 'g5g211', 'h5h210', 'a6a210', 'b6d614', , 'h7g613', 'e6e211', 'f6f211', 'g6g211', 'h6h210', 'a7a210', 'b7d714', , 'h7g613', 'e7e211',
-        'f7f211', 'g7g211', , 'a8a210', 'b8d814', , 'h7g613', 'e8e211', 'f8f211', 'g8g211', 'h7g613', , , , , , , , , 'a8b710', 'b2g211', , 'd2g211', 'a8b711',
-        'a8b711', 'a8b811', 'a8b710', 'a3a212', 'a8b713', , 'a8b712', 'e3e212', 'f3f212', 'g3g211', 'h3h211', 'a4a212', 'b4d413', , 'a8b710', 'a8b712',
-        'f4f212', 'g4g211', 'h4h211', 'a5d512', 'b5d512', , 'a8b710', 'a8b712', 'f5f212', 'g5g211', 'h5h211', 'a6d612', 'b6d612', , 'a8b710', 'a8b712',
-        'f6f212', 'g6g211', 'h6h211', 'a7d712', 'b7d712', , 'a8b710', 'a8b712', 'f7f212', 'g7g211', 'h7h211', , 'b8d812', , 'a8b710', 'a8b712', 'f8f212',
-        'g8g211', 'h8h211', , , , , , , , , 'b8c710', 'b2g211', , 'd2g211', 'b8c711', 'b8c711', 'b8c811', 'b8c710', 'a3a212', 'b3d313', , 'b8c712', 'e3e212',
-        'f3f212', 'g3g211', 'h3h211', 'a4a212', 'b4d413', , 'b8c710', 'b8c712', 'f4f212', 'g4g211', 'h4h211', 'a5d512', 'b5d512', , 'b8c710', 'b8c712',
-        'f5f212', 'g5g211', 'h5h211', 'a6d612', 'b6d612', , 'b8c710', 'b8c712', 'f6f212', 'g6g211', 'h6h211', 'a7d712', 'b7d712', , 'b8c710', 'b8c712',
-        'f7f212', 'g7g211', 'h7h211', 'a8a212', , , 'b8c710', 'b8c712', 'f8f212', 'g8g211', 'h8h211', , , , , , , , , 'c8d710', 'b2g211', , 'd2g211', 'c8d711',
-        'c8d711', 'c8d811', 'c8d710', 'a3a212', 'b3d313', , 'c8d712', 'e3e212', 'f3f212', 'g3g211', 'h3h211', 'a4a212', 'b4d413', , 'c8d710', 'c8d712',
-        'f4f212', 'g4g211', 'h4h211', 'a5d512', 'b5d512', , 'c8d710', 'c8d712', 'f5f212', 'g5g211', 'h5h211', 'a6d612', 'b6d612', , 'c8d710', 'c8d712',
-        'f6f212', 'g6g211', 'h6h211', 'a7d712', 'b7d712', , 'c8c710', 'c8d712', 'f7f212', 'g7g211', 'h7h211', 'a8a212', 'b8b314', , 'c8c710', 'c8d712',
-        'f8f212', 'g8g211', 'h8h211', , , , , , , , , 'd8e710', 'b2g211', , 'd2g211', 'd8e711', 'd8e711', 'd8e811', 'd8e710', 'a3a212', 'b3d313', , 'd3d512',
-        'e3e212', 'f3f212', 'g3g211', 'h3h211', 'a4a212', 'b4d413', , 'd8d710', 'd8e712', 'f4f212', 'g4g211', 'h4h211', 'a5d512', 'b5d512', , 'd8e710',
-        'd8e712', 'f5f212', 'g5g211', 'h5h211', 'a6d612', 'b6d612', , 'd8d710', 'd8e712', 'f6f212', 'g6g211', 'h6h211', 'a7d712', 'b7d712', , 'd8c710',
-        'd8d712', 'f7f212', 'g7g211', 'h7h211', 'a8a212', 'b8b314', , , 'd8e712', 'f8f212', 'g8g211', 'h8h211', , , , , , , , , 'e8f710', 'b2g211', , 'd2g211',
-        'e2g211', 'e8f711', 'e8f811', 'e8f710', 'a3a212', 'b3d313', , 'd3d512', 'e3e212', 'f3f212', 'g3g211', 'h3h211', 'a4a212', 'b4d413', , 'e8d710',
-        'e4e212', 'f4f212', 'g4g211', 'h4h211', 'a5d512', 'b5d512', , 'e8e710', 'e5e212', 'f5f212', 'g5g211', 'h5h211', 'a6d612', 'b6d612', , 'e8d710',
-        'e6e212', 'f6f212', 'g6g211', 'h6h211', 'a7a212', 'b7d713', , 'd7d612', 'e7e212', 'f7f212', 'g7g211', 'h7h211', 'a8a212', 'b8d813', , 'd8d612',
-        ,
-        'f8f212', 'g8g211', 'h8h211', , , , , , , , , 'f8g710', 'b2g211', , 'd2g211', 'e2g211', 'f2g211', 'f8g811', 'f8g710', 'a3a212', 'b3d313', , 'd3d512',
-        'e3e212', 'f3f212', 'g3g211', 'h3h211', 'a4a212', 'b4d413', , 'f8f711', 'e4e212', 'f4f212', 'g4g211', 'h4h211', 'a5d512', 'b5d512', , 'f8e710',
-        'e5e212', 'f5f212', 'g5g211', 'h5h211', 'a6a212', 'b6d613', , 'd6d512', 'e6e212', 'f6f212', 'g6g211', 'h6h211', 'a7a212', 'b7d713', , 'd7d512',
-        'e7e212', 'f7f212', 'g7g211', 'h7h211', 'a8a212', 'b8d813', , 'd8d512', 'e8e212', , 'g8g211', 'h8h211', , , , , , , , , 'g8h710', 'b2g211', , 'd2g211',
-        'e2g211', 'f2g211', 'g2h211', 'g8h710', 'a3a212', 'b3h313', , 'd3d513', 'e3e212', 'f3f212', 'g3g211', 'h3h211', 'a4a212', 'b4d414', , 'g8f711',
-        'e4e212', 'f4f212', 'g4g211', 'h4h211', 'a5a212', 'b5d513', , 'g8f712', 'e5e212', 'f5f212', 'g5g211', 'h5h211', 'a6a212', 'b6d614', , 'd6d513',
-        'e6e212', 'f6f212', 'g6g211', 'h6h211', 'a7a212', 'b7d714', , 'd7d513', 'e7e212', 'f7f212', 'g7g211', 'h7h211', 'a8a212', 'b8d814', , 'd8d513',
-        'e8e212', 'f8f212', , 'h8h211', , , , , , , , , 'h8h710', 'b2g211', , 'd2g211', 'e2g211', 'f2g211', 'g2h211', 'h8h710', 'a3a212', 'b3h313', , 'd3h313',
-        'e3e212', 'f3f212', 'g3g211', 'h3h211', 'a4a212', 'b4h414', , 'h8g712', 'e4e212', 'f4f212', 'g4g211', 'h4h211', 'a5a212', 'b5d514', , 'h8g713',
-        'e5e212', 'f5f212', 'g5g211', 'h5h211', 'a6a212', 'b6h614', , 'd6d814', 'e6e212', 'f6f212', 'g6g211', 'h6h211', 'a7a212', 'b7h714', , 'd7d814',
-        'e7e212', 'f7f212', 'g7g211', 'h7h211', 'a8a212', 'b8d814', , 'd8d514', 'e8e212', 'f8f212', 'g8g211', , , , , , , , , , 'a1b17', 'a1b17', 'a1b27',
-        ,
-        'e2f29', 'a1b28', 'a1b28', 'a1b28', 'a3a29', 'b3b29', 'a1b210', , 'a1b210', 'f3f29', 'g3g29', 'h3h29', 'a4a29', 'b4b29', 'a1b211', , 'a1b212',
-        'f4f29', 'g4g29', 'h4h29', 'a5a29', 'b5b29', 'a1b211', , 'e5h512', 'f5f29', 'g5g29', 'h5h29', 'a6a29', 'b6b29', 'a1b211', , 'e6h612', 'f6f29',
-        'g6g29', 'h6h29', 'a7a29', 'b7b29', 'a1b211', , 'e7h712', 'f7f29', 'g7g29', 'h7h29', 'a8a29', 'b8b29', 'a1b211', , 'e8h812', 'f8f29', 'g8g29',
-        'h8h29', 'a1a27', , , , , , , , 'a2b27', 'b2c27', 'b1b27', , 'e2c27', 'f2c27', 'g2c27', 'h2c27', 'a3a27', 'b3b27', 'c3c27', , 'e3d39', 'f3f29',
-        'g3g28', 'h3h28', 'a4a27', 'b4b27', 'c4c27', , 'e4e310', 'f4f29', 'g4g28', 'h4h28', 'a5a27', 'b5b27', 'c5c27', , 'e5e310', 'f5f29', 'g5g28',
-        'h5h28', 'a6a27', 'b6b27', 'c6c27', , 'e6e310', 'f6f29', 'g6g28', 'h6h28', 'a7a27', 'b7b27', 'c7c27', , 'e7e310', 'f7f29', 'g7g28', 'h7h28',
-        'a8a27', 'b8b27', 'c8c27', , 'e8e310', 'f8f29', 'g8g28', 'h8h28', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , 'g1g26', 'h1h26', 'a2e26', 'b2e26', 'c2e26', , 'e2f26', 'f2g26', 'g2h26', 'h2g26', 'a3d38', 'b3d38', 'c3d38', , 'e3e26', 'f3f26',
-        'g3g26', 'h3h26', 'a4a28', 'b4b28', 'c4d49', , 'e4e26', 'f4f26', 'g4g26', 'h4h26', 'a5a28', 'b5b28', 'c5c39', , 'e5e26', 'f5f26', 'g5g26',
-        'h5h26', 'a6a28', 'b6b28', 'c6c39', , 'e6e26', 'f6f26', 'g6g26', 'h6h26', 'a7a28', 'b7b28', 'c7c39', , 'e7e26', 'f7f26', 'g7g26', 'h7h26',
-        'a8a28', 'b8b28', 'c8c39', , 'e8e26', 'f8f26', 'g8g26', 'h8h26', , , , , , , , 'h1h28', 'g1f27', 'g1f27', 'c2f28', , 'g1f16', 'g1f16', 'g1f16',
-        'g1f16', 'a3a28', 'b3b28', 'g1f28', , 'g1f18', 'f3f28', 'g1f28', 'g1f28', 'a4a28', 'b4b28', 'g1f210', , 'e4e39', 'f4f28', 'g4g28', 'h4h28',
-        'a5a28', 'b5b28', 'c5g511', , 'e5e39', 'f5f28', 'g5g28', 'h5h28', 'a6a28', 'b6b28', 'c6g611', , 'e6e39', 'f6f28', 'g6g28', 'h6h28', 'a7a28',
-        'b7b28', 'c7g711', , 'e7e39', 'f7f28', 'g7g28', 'h7h28', 'a8a28', 'b8b28', 'c8g811', , 'e8e39', 'f8f28', 'g8g28', 'h8h28', , , , , , , , , 'a2f28',
-        'b2f28', 'c2f28', , 'e2f28', 'h1g27', 'g2h28', 'h1g18', 'a3a29', 'b3b29', 'c3e311', , 'h1g19', 'f3f28', 'g3g28', 'h3h28', 'a4a29', 'b4b29',
-        'c4e412', , 'e4e311', 'f4f28', 'g4g28', 'h4h28', 'a5a29', 'b5b29', 'c5g512', , 'e5e311', 'f5f28', 'g5g28', 'h5h28', 'a6a29', 'b6b29', 'c6g612',
-        ,
-        'e6e311', 'f6f28', 'g6g28', 'h6h28', 'a7a29', 'b7b29', 'c7g712', , 'e7e311', 'f7f28', 'g7g28', 'h7h28', 'a8a29', 'b8b29', 'c8g812', , 'e8e311',
-        'f8f28', 'g8g28', 'h8h28', , , , , , , , , , 'a2b17', 'a2b27', , 'e2b28', 'a2b38', 'a2b38', 'a2b38', 'a2b210', 'b3b28', 'a2b310', , 'a2b310', 'f3f29',
-        'g3g29', 'h3h29', 'a2b211', 'b4b28', 'a2b311', , 'a2b38', 'f4f29', 'g4g29', 'h4h29', 'a2b211', 'b5b28', 'a2b311', , 'a2b38', 'f5f29', 'g5g29',
-        'h5h29', 'a2b211', 'b6b28', 'a2b311', , 'a2b38', 'f6f29', 'g6g29', 'h6h29', 'a2b211', 'b7b28', 'a2b311', , 'a2b38', 'f7f29', 'g7g29', 'h7h29',
-        'a2b211', 'b8b28', 'a2b311', , 'a2b38', 'f8f29', 'g8g29', 'h8h29', , , , , , , , , 'b2c36', , 'b2c36', , 'e2c27', 'f2c27', 'g2c27', 'b2c37', 'a3d39',
-        'b2c39', 'c3c27', , 'b2c32', 'f3f28', 'g3g28', 'h3h28', 'a4a310', 'b2c310', 'c4c27', , 'b2c32', 'f4f28', 'g4g28', 'h4h28', 'a5a310', 'b5b310',
-        'c5c27', , 'b2c32', 'f5f28', 'g5g28', 'h5h28', 'a6a310', 'b6b310', 'c6c27', , 'b2c32', 'f6f28', 'g6g28', 'h6h28', 'a7a310', 'b7b310', 'c7c27',
-        ,
-        'b2c32', 'f7f28', 'g7g28', 'h7h28', 'a8a310', 'b8b310', 'c8c27', , 'b2c32', 'f8f28', 'g8g28', 'h8h28', , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a2e26', 'b2e26', 'c2e26', , 'f2e35', , 'f2e35', 'f2e35', 'a3a27', 'b3b27', 'f2e32',
-        ,
-        'e3e26', 'f2e37', 'f2e37', 'f2e37', 'a4a27', 'b4b27', 'f2e32', , 'e4e26', 'f2e38', 'f2e38', 'f2e38', 'a5a27', 'b5b27', 'f2e32', , 'e5e26',
-        'f5f38', 'g5g38', 'h5h38', 'a6a27', 'b6b27', 'f2e32', , 'e6e26', 'f6f38', 'g6g38', 'h6h38', 'a7a27', 'b7b27', 'f2e32', , 'e7e26', 'f7f38',
-        'g7g38', 'h7h38', 'a8a27', 'b8b27', 'f2e32', , 'e8e26', 'f8f38', 'g8g38', 'h8h38', , , , , , , , , 'a2f27', 'b2f27', 'c2f27', , 'g2f16', 'g2f16',
-        ,
-        'g2f16', 'a3a28', 'b3b28', 'g2f28', , 'g2f18', 'f3f27', 'g2f28', 'g2f28', 'a4a28', 'b4b28', 'g2f39', , 'e4e39', 'f4f27', 'g2f19', 'g2f19',
-        'a5a28', 'b5b28', 'g2f39', , 'e5e39', 'f5f27', 'g2f29', 'g2f29', 'a6a28', 'b6b28', 'g2f39', , 'e6e39', 'f6f27', 'g2f29', 'g2f29', 'a7a28',
-        'b7b28', 'g2f39', , 'e7e39', 'f7f27', 'g2f29', 'g2f29', 'a8a28', 'b8b28', 'g2f39', , 'e8e39', 'f8f27', 'g2f29', 'g2f29', , , , , , , , , 'a2f28',
-        'b2f28', 'c2f28', , 'e2f28', 'h2g27', 'h2g37', , 'a3a29', 'b3b29', 'c3e311', , 'h2g19', 'f3f28', 'g3g28', 'h2g110', 'a4a29', 'b4b29', 'c4e412',
-        ,
-        'e4e311', 'f4f28', 'g4g28', 'h2g111', 'a5a29', 'b5b29', 'c5c312', , 'e5e311', 'f5f28', 'g5g28', 'h2g111', 'a6a29', 'b6b29', 'c6c312', ,
-        'e6e311', 'f6f28', 'g6g28', 'h2g111', 'a7a29', 'b7b29', 'c7c312', , 'e7e311', 'f7f28', 'g7g28', 'h2g111', 'a8a29', 'b8b29', 'c8c312', , 'e8e311',
-        'f8f28', 'g8g28', 'h2g111', , , , , , , , , 'a2b28', 'a3a48', 'a3b27', , 'e2b28', 'a3b48', 'a3b48', 'a3b48', , 'b3b28', 'a3b310', , 'a3b310', 'f3f210',
-        'a3b310', 'h3h29', 'a3b211', 'b4b28', 'a3b311', , 'a3b48', 'f4f210', 'g4g210', 'h4h29', 'a3b211', 'b5b28', 'a3b411', , 'a3b48', 'f5f210',
-        'g5g210', 'h5h29', 'a3b211', 'b6b28', 'a3b411', , 'a3b48', 'f6f210', 'g6g210', 'h6h29', 'a3b211', 'b7b28', 'a3b411', , 'a3b48', 'f7f210',
-        'g7g210', 'h7h29', 'a3b211', 'b8b28', 'a3b411', , 'a3b48', 'f8f210', 'g8g210', 'h8h29', , , , , , , , , 'b3c46', 'b3c36', 'b3c36', , 'e2e48', 'b3b48',
-        'b3b48', 'b3c47', 'a3a28', , 'c3c28', , 'b3c32', 'f3f28', 'g3g28', 'h3h28', 'a4e48', 'b4e48', 'c4e48', , 'b3c32', 'f4f28', 'g4g28', 'h4h28',
-        'a5e58', 'b5e58', 'c5e58', , 'b3c32', 'f5f28', 'g5g28', 'h5h28', 'a6e68', 'b6e68', 'c6e68', , 'b3c32', 'f6f28', 'g6g28', 'h6h28', 'a7e78',
-        'b7e78', 'c7e78', , 'b3c32', 'f7f28', 'g7g28', 'h7h28', 'a8e88', 'b8e88', 'c8e88', , 'b3c32', 'f8f28', 'g8g28', 'h8h28', , , , , , , , , 'a2b26',
-        'b2c26', 'c2d26', , 'e2e32', 'c3d35', 'c3d36', 'c3d36', 'a3a26', 'b3b26', , , 'e3e42', 'f3e32', 'g3e32', 'h3e32', 'a4e42', 'b4e42', 'c4e42',
-        ,
-        'e4e52', 'f4e42', 'g4e42', 'h4e42', 'a5e52', 'b5e52', 'c5e52', , 'e5e62', 'f5e52', 'g5e52', 'h5e52', 'a6e62', 'b6e62', 'c6e62', , 'e6e72',
-        'f6e62', 'g6e62', 'h6e62', 'a7e72', 'b7e72', 'c7e72', , 'e7e82', 'f7e72', 'g7e72', 'h7e72', 'a8e82', 'b8e82', 'c8e82', , 'e8e72', 'f8e82',
-        'g8e82', 'h8e82', , , , , , , , , 'a2a11', 'b2b11', 'c2c43', , 'e2e43', 'f2f11', 'g2g11', 'h2h11', 'a3a11', 'b3b11', 'd3e32', , 'd3c32', 'f3f11',
-        'g3g11', 'h3h11', 'a4a11', 'b4b11', 'd3e32', 'd4d53', 'd3c32', 'f4f11', 'g4g11', 'h4h11', 'a5a11', 'b5b11', 'd3e32', 'd5d63', 'd3c32', 'f5f11',
-        'g5g11', 'h5h11', 'a6a11', 'b6b11', 'd3e32', 'd6d73', 'd3c32', 'f6f11', 'g6g11', 'h6h11', 'a7a11', 'b7b11', 'd3e32', 'd7d83', 'd3c32', 'f7f11',
-        'g7g11', 'h7h11', 'a8a11', 'b8b11', 'd3e32', 'd8e83', 'd3c32', 'f8f11', 'g8g11', 'h8h11', , , , , , , , , 'a2e25', 'b2e25', 'c2c32', , 'e2f25',
-        'e3d35', 'g2h25', 'h2g25', 'a3c32', 'b3c32', 'c3c42', , , 'e3d35', 'e3d35', 'e3d35', 'a4c42', 'b4c42', 'c4c52', , 'e4c42', 'f4c42', 'g4c42',
-        'h4c42', 'a5c52', 'b5c52', 'c5c62', , 'e5c52', 'f5c52', 'g5c52', 'h5c52', 'a6c62', 'b6c62', 'c6c72', , 'e6c62', 'f6c62', 'g6c62', 'h6c62',
-        'a7c72', 'b7c72', 'c7c82', , 'e7c72', 'f7c72', 'g7c72', 'h7c72', 'a8c82', 'b8c82', 'c8c72', , 'e8c82', 'f8c82', 'g8c82', 'h8c82', , , , , , , ,
-        ,
-        'f3e36', 'b2e27', 'c2e27', , 'f3e35', 'f3e35', 'f3e35', 'f3e35', 'a3a27', 'b3b27', 'f3e32', , 'e3e27', , 'f3e37', 'f3e37', 'a4a27', 'b4b27',
-        'f3e32', , 'e4e27', 'f3e38', 'g4g27', 'h4h27', 'a5a27', 'b5b27', 'f3e32', , 'e5e27', 'f3f29', 'g5g27', 'h5h27', 'a6a27', 'b6b27', 'f3e32',
-        ,
-        'e6e27', 'f3f29', 'g6g27', 'h6h27', 'a7a27', 'b7b27', 'f3e32', , 'e7e27', 'f3f29', 'g7g27', 'h7h27', 'a8a27', 'b8b27', 'f3e32', , 'e8e27',
-        'f3f29', 'g8g27', 'h8h27', , , , , , , , , 'a2f27', 'b2f27', 'c2f27', , 'g3f26', 'f2g27', 'g2h27', 'g3g47', 'a3a28', 'b3e39', 'g3f28', , 'g3f38',
-        'f3f27', , 'h3h27', 'a4a28', 'b4b29', 'g3f39', , 'e4e39', 'f4f27', 'g3f29', 'h4h27', 'a5a28', 'b5b29', 'g3f39', , 'e5e39', 'f5f27', 'g3f29',
-        'h5h27', 'a6a28', 'b6b29', 'g3f39', , 'e6e39', 'f6f27', 'g3f29', 'h6h27', 'a7a28', 'b7b29', 'g3f39', , 'e7e39', 'f7f27', 'g3f29', 'h7h27',
-        'a8a28', 'b8b29', 'g3f39', , 'e8e39', 'f8f27', 'g3f29', 'h8h27', , , , , , , , , 'a2f28', 'b2f28', 'c2f28', , 'e2f28', 'h3g27', 'h3g37', 'h3g37',
-        'a3a29', 'b3b29', 'c3f311', , 'h3g29', 'f3f28', 'g3g29', , 'a4a29', 'b4b29', 'c4e412', , 'h3g211', 'f4f28', 'g4g29', 'h3g211', 'a5a29', 'b5b29',
-        'c5g512', , 'e5g512', 'f5f28', 'g5g29', 'h3g211', 'a6a29', 'b6b29', 'c6g612', , 'e6g612', 'f6f28', 'g6g29', 'h3g211', 'a7a29', 'b7b29', 'c7g712',
-        ,
-        'e7g712', 'f7f28', 'g7g29', 'h3g211', 'a8a29', 'b8b29', 'c8g812', , 'e8g812', 'f8f28', 'g8g29', 'h3g211', , , , , , , , , 'a2b28', 'a4b48', 'a4b38',
-        ,
-        'e2b28', 'a4b58', 'a4b58', 'a4b58', 'a3a28', 'b3b28', 'a4b310', , 'a4b310', 'f3f210', 'a4b310', 'h3h29', , 'b4b28', 'a4b311', , 'a4b48',
-        'f4f210', 'g4g210', 'h4h29', 'a5e511', 'b5b28', 'a4b411', , 'a4b48', 'f5f210', 'g5g210', 'h5h29', 'a6e611', 'b6b28', 'a4b411', , 'a4b48',
-        'f6f210', 'g6g210', 'h6h29', 'a7e711', 'b7b28', 'a4b411', , 'a4b48', 'f7f210', 'g7g210', 'h7h29', 'a8e811', 'b8b28', 'a4b411', , 'a4b48',
-        'f8f210', 'g8g210', 'h8h29', , , , , , , , , 'b4c46', 'b4c36', 'b4c36', , 'e2e48', 'b4b58', 'b4b58', 'b4c57', 'a3a28', 'b3b28', 'c3d39', , 'b4c32',
-        'f3f28', 'g3g28', 'h3h28', 'a4a28', , 'c4e48', , 'b4c32', 'f4f28', 'g4g28', 'h4h28', 'a5e58', 'b5e58', 'c5e58', , 'b4c32', 'f5f28', 'g5g28',
-        'h5h28', 'a6e68', 'b6e68', 'c6e68', , 'b4c32', 'f6f28', 'g6g28', 'h6h28', 'a7e78', 'b7e78', 'c7e78', , 'b4c32', 'f7f28', 'g7g28', 'h7h28',
-        'a8e88', 'b8e88', 'c8e88', , 'b4c32', 'f8f28', 'g8g28', 'h8h28', , , , , , , , , 'c4d46', 'b2a26', 'c2a26', , 'c4d35', 'c4d35', 'c4d36', 'c4d36',
-        'a3a26', 'c4d36', 'c4d36', , 'c4c32', 'c4d35', 'c4d35', 'c4d35', 'c4d33', 'c4d33', , , 'c4c32', 'c4d33', 'c4d33', 'c4d33', 'c4d33', 'c4d33',
-        'c4d33', , 'c4c32', 'c4d33', 'c4d33', 'c4d33', 'c4d33', 'c4d33', 'c4d33', , 'c4c32', 'c4d33', 'c4d33', 'c4d33', 'c4d33', 'c4d33', 'c4d33',
-        ,
-        'c4c32', 'c4d33', 'c4d33', 'c4d33', 'c4d33', 'c4d33', 'c4d33', , 'c4c32', 'c4d33', 'c4d33', 'c4d33', , , , , , , , , 'd4e46', 'b2a26', 'c2a26',
-        ,
-        'd4e35', 'd4e35', 'd4e35', 'd4e35', 'a3a26', 'd4d36', 'd4e32', , 'd4c32', 'd4d35', 'd4d35', 'd4d35', 'd4d33', 'd4d33', 'd4e32', , 'd4c32',
-        'd4d33', 'd4d33', 'd4d33', 'd4d33', 'd4d33', 'd4e32', 'd4d33', 'd4c32', 'd4d33', 'd4d33', 'd4d33', 'd4d33', 'd4d33', 'd4e32', 'd4d33', 'd4c32',
-        'd4d33', 'd4d33', 'd4d33', 'd4d33', 'd4d33', 'd4e32', 'd4d33', 'd4c32', 'd4d33', 'd4d33', 'd4d33', 'd4d33', 'd4d33', 'd4e32', 'd4d33', 'd4c32',
-        'd4d33', 'd4d33', 'd4d33', , , , , , , , , 'e4e36', 'b2a26', 'c2a26', , 'e4e35', 'e4e35', 'e4e35', 'e4e35', 'a3a26', 'e4d36', 'e4e32', , 'e4d35',
-        'e4d35', 'e4d35', 'e4d35', 'e4d33', 'e4d33', 'e4e32', , , 'e4d33', 'e4d33', 'e4d33', 'e4d33', 'e4d33', 'e4e32', , 'e4d33', 'e4d33', 'e4d33',
-        'e4d33', 'e4d33', 'e4d33', 'e4e32', , 'e4d33', 'e4d33', 'e4d33', 'e4d33', 'e4d33', 'e4d33', 'e4e32', , 'e4d33', 'e4d33', 'e4d33', 'e4d33',
-        'e4d33', 'e4d33', 'e4e32', , 'e4d33', 'e4d33', 'e4d33', 'e4d33', , , , , , , , , 'f4e36', 'b2f27', 'c2f27', , 'f4e35', 'f4e35', 'f4e35', 'f4e35',
-        'a3a27', 'b3b27', 'f4e32', , 'e3d38', 'f3f27', 'f4e37', 'f4e37', 'a4a27', 'b4b27', 'f4e32', , 'f4e38', , 'g4g27', 'h4h27', 'a5a27', 'b5b27',
-        'f4e32', , 'e5e39', 'f4e39', 'g5g27', 'h5h27', 'a6a27', 'b6b27', 'f4e32', , 'e6e39', 'f4e39', 'g6g27', 'h6h27', 'a7a27', 'b7b27', 'f4e32',
-        ,
-        'e7e39', 'f4e39', 'g7g27', 'h7h27', 'a8a27', 'b8b27', 'f4e32', , 'e8e39', 'f4e39', 'g8g27', 'h8h27', , , , , , , , , 'a2f27', 'b2f27', 'c2f27',
-        ,
-        'e2f27', 'f2g27', 'g2h27', 'g4g57', 'a3a28', 'b3e39', 'c3e39', , 'g4f38', 'f3f27', 'g3g27', 'h3h27', 'a4a28', 'b4b29', 'g4f39', , 'e4e39',
-        'f4f27', , 'h4h27', 'a5a28', 'b5b29', 'g4f39', , 'e5e39', 'f5f27', 'g4f311', 'h5h27', 'a6a28', 'b6b29', 'g4f39', , 'e6e39', 'f6f27', 'g4f311',
-        'h6h27', 'a7a28', 'b7b29', 'g4f39', , 'e7e39', 'f7f27', 'g4f311', 'h7h27', 'a8a28', 'b8b29', 'g4f39', , 'e8e39', 'f8f27', 'g4f311', 'h8h27',
-        ,
-        , , , , , , , 'h4g38', 'b2f29', 'c2f29', , 'e2f29', 'h4g37', 'h4g37', 'h4g37', 'a3a29', 'b3b29', 'c3f311', , 'h4g39', 'f3f29', 'g3g29', 'h3h29',
-        'a4a29', 'b4b29', 'c4e412', , 'h4g311', 'f4f29', 'g4g29', , 'a5a29', 'b5b29', 'c5c312', , 'e5e412', 'f5f29', 'g5g29', 'h4g412', 'a6a29', 'b6b29',
-        'c6c312', , 'e6e412', 'f6f29', 'g6g29', 'h4g412', 'a7a29', 'b7b29', 'c7c312', , 'e7e412', 'f7f29', 'g7g29', 'h4g412', 'a8a29', 'b8b29', 'c8c312',
-        ,
-        'e8e412', 'f8f29', 'g8g29', 'h4g412', , , , , , , , , 'a5b58', 'a5b48', 'c2a28', , 'e2a28', 'a5b58', 'a5b58', 'a5b58', 'a3a28', 'b3b210', 'a5b511',
-        ,
-        'a5b511', 'f3f210', 'g3g210', 'h3h29', 'a4a28', 'b4b210', 'a5b512', , 'a5b48', 'f4f210', 'g4g210', 'h4h29', , 'b5b210', 'a5b411', , 'a5b48',
-        'f5f210', 'g5g210', 'h5h29', 'a6e611', 'b6b210', 'a5b411', , 'a5b48', 'f6f210', 'g6g210', 'h6h29', 'a7e711', 'b7b210', 'a5b411', , 'a5b48',
-        'f7f210', 'g7g210', 'h7h29', 'a8e811', 'b8b210', 'a5b411', , 'a5b48', 'f8f210', 'g8g210', 'h8h29', , , , , , , , , 'b5c46', 'b5c47', 'c2f28', ,
-        'e2f28', 'b5c58', 'b5c58', 'b5c57', 'a3a28', 'b3b29', 'b5c410', , 'b5c48', 'f3f28', 'g3g28', 'h3h28', 'a4a28', 'b4e49', 'c4e49', , 'b5c48',
-        'f4f28', 'g4g28', 'h4h28', 'a5a28', , 'c5e59', , 'b5c48', 'f5f28', 'g5g28', 'h5h28', 'a6a28', 'b6e69', 'c6e69', , 'b5c48', 'f6f28', 'g6g28',
-        'h6h28', 'a7a28', 'b7e79', 'c7e79', , 'b5c48', 'f7f28', 'g7g28', 'h7h28', 'a8a28', 'b8e89', 'c8e89', , 'b5c48', 'f8f28', 'g8g28', 'h8h28',
-        ,
-        , , , , , , , 'c5d46', 'b2h27', 'c2h27', , 'e2h27', 'c5d47', 'c5d47', 'c5d57', 'a3a28', 'b3b29', 'c3d310', , 'c5c48', 'f3f28', 'g3g28', 'h3h27',
-        'a4a28', 'b4e49', 'c4e49', , 'c5c48', 'f4f28', 'g4g28', 'h4h27', 'a5a28', 'b5b29', , , 'c5c48', 'f5f28', 'g5g28', 'h5h27', 'a6a28', 'b6e69',
-        'c5d49', , 'c5c48', 'f6f28', 'g6g28', 'h6h27', 'a7a28', 'b7e79', 'c5d49', , 'c5c48', 'f7f28', 'g7g28', 'h7h27', 'a8a28', 'b8e89', 'c5d49',
-        ,
-        'c5c48', 'f8f28', 'g8g28', 'h8h27', , , , , , , , , 'd5e46', 'b2h27', 'c2h27', , 'e2h27', 'd5e47', 'd5e47', 'd5e57', 'a3a28', 'b3b29', 'd5e49',
-        ,
-        'd5c48', 'f3f28', 'g3g28', 'h3h27', 'a4a28', 'b4e49', 'c4e49', , 'd5c48', 'f4f28', 'g4g28', 'h4h27', 'a5a28', 'b5b29', 'd5e49', , 'd5c48',
-        'f5f28', 'g5g28', 'h5h27', 'a6a28', 'b6e69', 'c6e69', 'd5e49', 'd5c48', 'f6f28', 'g6g28', 'h6h27', 'a7a28', 'b7e79', 'c7e79', 'd5e49', 'd5c48',
-        'f7f28', 'g7g28', 'h7h27', 'a8a28', 'b8e89', 'c8e89', 'd5e49', 'd5c48', 'f8f28', 'g8g28', 'h8h27', , , , , , , , , 'e5e46', 'b2h27', 'c2h27', ,
-        'e2h27', 'e5f47', 'e5f47', 'e5f57', 'a3a28', 'b3b29', 'e5e49', , 'e5f49', 'f3f28', 'g3g28', 'h3h27', 'a4a28', 'b4b29', 'e5f49', , 'e5d49',
-        'f4f28', 'g4g28', 'h4h27', 'a5a28', 'b5b29', 'e5f49', , , 'f5f28', 'g5g28', 'h5h27', 'a6a28', 'b6b29', 'e5f49', , 'e5d49', 'f6f28', 'g6g28',
-        'h6h27', 'a7a28', 'b7b29', 'e5f49', , 'e5d49', 'f7f28', 'g7g28', 'h7h27', 'a8a28', 'b8b29', 'e5f49', , 'e5d49', 'f8f28', 'g8g28', 'h8h27',
-        ,
-        , , , , , , , 'f5e46', 'b2h27', 'c2h27', , 'e2h27', 'f2h27', 'f5g47', 'f5g57', 'a3a28', 'b3b29', 'f5e49', , 'f5g49', 'f3f28', 'g3g28', 'h3h27',
-        'a4a28', 'b4b29', 'f5f49', , 'e4e310', 'f4f28', 'g4g28', 'h4h27', 'a5a28', 'b5b29', 'f5f49', , 'e5e310', , 'g5g28', 'h5h27', 'a6a28', 'b6b29',
-        'f5f49', , 'e6e310', 'f5e410', 'g6g28', 'h6h27', 'a7a28', 'b7b29', 'f5f49', , 'e7e310', 'f5e410', 'g7g28', 'h7h27', 'a8a28', 'b8b29', 'f5f49',
-        ,
-        'e8e310', 'f5e410', 'g8g28', 'h8h27', , , , , , , , , 'a2h27', 'b2h27', 'c2h27', , 'e2h27', 'f2h27', 'g2h27', 'g5g47', 'a3a29', 'b3b29', 'c3e310',
-        ,
-        'g5g49', 'f3f29', 'g3g28', 'h3h27', 'a4a29', 'b4b29', 'g5f49', , 'e4e310', 'f4f29', 'g4g28', 'h4h27', 'a5a29', 'b5b29', 'g5f49', , 'e5e310',
-        'f5f29', , 'h5h27', 'a6a29', 'b6b29', 'g5f49', , 'e6e310', 'f6f29', 'g5f411', 'h6h27', 'a7a29', 'b7b29', 'g5f49', , 'e7e310', 'f7f29', 'g5f411',
-        'h7h27', 'a8a29', 'b8b29', 'g5f49', , 'e8e310', 'f8f29', 'g5f411', 'h8h27', , , , , , , , , 'h5g48', 'b2f29', 'c2f29', , 'e2f29', 'h5g47', 'h5g47',
-        'h5g47', 'a3a29', 'b3b29', 'h5g411', , 'h5g49', 'f3f29', 'g3g29', 'h3h29', 'a4a29', 'b4b29', 'c4e412', , 'h5g411', 'f4f29', 'g4g29', 'h4h29',
-        'a5a29', 'b5b29', 'c5d513', , 'e5e412', 'f5f29', 'g5g29', , 'a6a29', 'b6b29', 'c6g613', , 'e6e412', 'f6f29', 'g6g29', 'h5g412', 'a7a29', 'b7b29',
-        'c7g713', , 'e7e412', 'f7f29', 'g7g29', 'h5g412', 'a8a29', 'b8b29', 'c8g813', , 'e8e412', 'f8f29', 'g8g29', 'h5g412', , , , , , , , , 'a6b58', 'a6b69',
-        'c2a29', , 'e2a29', 'a6b58', 'a6b58', 'a6b58', 'a3a29', 'b3b210', 'a6b511', , 'a6b511', 'f3f210', 'g3g210', 'h3h210', 'a4a29', 'b4b210',
-        'a6b512', , 'a6b59', 'f4f210', 'g4g210', 'h4h210', 'a5a29', 'b5b210', 'c5e511', , 'a6b59', 'f5f210', 'g5g210', 'h5h210', , 'b6b210', 'c6e611',
-        ,
-        'a6b59', 'f6f210', 'g6g210', 'h6h210', 'a7e711', 'b7b210', 'c7e711', , 'a6b59', 'f7f210', 'g7g210', 'h7h210', 'a8e811', 'b8b210', 'c8e811',
-        ,
-        'a6b59', 'f8f210', 'g8g210', 'h8h210', , , , , , , , , 'b6c58', 'b2h29', 'c2h29', , 'e2h29', 'b6c58', 'b6c58', 'b6c57', 'a3a29', 'b3b29', 'b6c511',
-        ,
-        'b6c510', 'f3f210', 'g3g210', 'h3h29', 'a4a29', 'b4b29', 'b6c511', , 'b6c59', 'b6c510', 'g4g210', 'h4h29', 'a5a29', 'b5b29', 'c5e511',
-        ,
-        'b6c59', 'b6c510', 'g5g210', 'h5h29', 'a6a29', , 'c6e611', , 'b6c59', 'b6c510', 'g6g210', 'h6h29', 'a7a29', 'b7e711', 'c7e711', , 'b6c59',
-        'b6c510', 'g7g210', 'h7h29', 'a8a29', 'b8e811', 'c8e811', , 'b6c59', 'b6c510', 'g8g210', 'h8h29', , , , , , , , , 'c6d58', 'b2h29', 'c2h29', , 'e2h29',
-        'c6d58', 'c6d58', 'c6d57', 'a3a29', 'b3b29', 'c3h311', , 'c6d510', 'f3f210', 'c6d510', 'h3h29', 'a4a29', 'b4b29', 'c6d510', , 'c6d59', 'c6d510',
-        'g4g210', 'h4h29', 'a5a29', 'b5b29', 'c6d510', , 'c6d59', 'c6d510', 'c6d510', 'h5h29', 'a6a29', 'b6b29', , , 'c6d59', 'c6d510', 'c6d510',
-        'h6h29', 'a7a29', 'b7b29', 'c6d510', , 'c6d59', 'c6d510', 'c6d510', 'h7h29', 'a8a29', 'b8b29', 'c6d510', , 'c6d59', 'c6d510', 'c6d510', 'h8h29',
-        ,
-        , , , , , , , 'd6e58', 'b2h29', 'c2h29', , 'e2h29', 'd6e58', 'd6e58', 'd6e57', 'a3a29', 'b3b29', 'c3h311', , 'd6e510', 'f3f210', 'd6e510', 'h3h29',
-        'a4a29', 'b4b29', 'd6e510', , 'd6d59', 'd6e510', 'g4g210', 'h4h29', 'a5a29', 'b5b29', 'd6e510', , 'd6d59', 'd6e510', 'd6e510', 'h5h29', 'a6a29',
-        'b6b29', 'd6e510', , 'd6d59', 'd6e510', 'd6e510', 'h6h29', 'a7a29', 'b7b29', 'd6e510', 'd6d510', 'd6d59', 'd6e510', 'd6e510', 'h7h29', 'a8a29',
-        'b8b29', 'd6e510', 'd6d510', 'd6d59', 'd6e510', 'd6e510', 'h8h29', , , , , , , , , 'e6f58', 'b2h29', 'c2h29', , 'e2h29', 'e6f58', 'e6f58', 'e6f57',
-        'a3a29', 'b3b29', 'c3h311', , 'e6f510', 'f3f210', 'e6e510', 'h3h29', 'a4a29', 'b4b29', 'e6f510', , 'e6d59', 'e6e510', 'g4g210', 'h4h29',
-        'a5a29', 'b5b29', 'e6f510', , 'e6d59', 'e6e510', 'e6e510', 'h5h29', 'a6a29', 'b6b29', 'e6f510', , , 'e6e510', 'e6e510', 'h6h29', 'a7a29',
-        'b7b29', 'e6f510', , 'e6d59', 'e6e510', 'e6e510', 'h7h29', 'a8a29', 'b8b29', 'e6f510', , 'e6d59', 'e6e510', 'e6e510', 'h8h29', , , , , , , , , 'f6f58',
-        'b2h29', 'c2h29', , 'e2h29', 'f6f58', 'f6g58', 'f6g57', 'a3a29', 'b3b29', 'c3h311', , 'f6g510', 'f3f210', 'f6e510', 'h3h29', 'a4a29', 'b4b29',
-        'f6f510', , 'f6e510', 'f4f210', 'g4g210', 'h4h29', 'a5a29', 'b5b29', 'f6f510', , 'e5h512', 'f5f210', 'f6e510', 'h5h29', 'a6a29', 'b6b29',
-        'f6f510', , 'f6e510', , 'f6e510', 'h6h29', 'a7a29', 'b7b29', 'f6f510', , 'f6e510', 'f6e510', 'f6e510', 'h7h29', 'a8a29', 'b8b29', 'f6f510',
-        ,
-        'f6e510', 'f6e510', 'f6e510', 'h8h29', , , , , , , , , 'g6f58', 'b2h29', 'c2h29', , 'e2h29', 'g6f58', 'g6g58', 'g6g57', 'a3a29', 'b3b29', 'c3e312',
-        ,
-        'g6g510', 'f3f210', 'g3g210', 'h3h29', 'a4a29', 'b4b29', 'g6f510', , 'e4d411', 'f4f210', 'g4g210', 'h4h29', 'a5a29', 'b5b29', 'g6f510',
-        ,
-        'e5e412', 'f5f210', 'g5g210', 'h5h29', 'a6a29', 'b6b29', 'g6f510', , 'e6e412', 'f6f210', , 'h6h29', 'a7a29', 'b7b29', 'g6f510', , 'e7e412',
-        'f7f210', 'g6f512', 'h7h29', 'a8a29', 'b8b29', 'g6f510', , 'e8e412', 'f8f210', 'g6f512', 'h8h29', , , , , , , , , 'a2b29', 'b2h29', 'c2h29', , 'e2h29',
-        'f2h29', 'h6g58', 'h6g57', 'a3a29', 'b3b29', 'c3g312', , 'h6g510', 'f3f210', 'g3g210', 'h3h29', 'a4a29', 'b4b29', 'c4e412', , 'h6g511', 'f4f210',
-        'g4g210', 'h4h29', 'a5a29', 'b5b29', 'c5d513', , 'e5e412', 'f5f210', 'g5g210', 'h5h29', 'a6a29', 'b6b29', 'c6c313', , 'e6e412', 'f6f210',
-        'g6g210', , 'a7a29', 'b7b29', 'c7c313', , 'e7e412', 'f7f210', 'g7g210', 'h6g512', 'a8a29', 'b8b29', 'c8c313', , 'e8e412', 'f8f210', 'g8g210',
-        'h6g512', , , , , , , , , 'a7b69', 'a7b69', 'c2g210', , 'e2g210', 'a7b610', 'a7b710', 'a7b69', 'a3a211', 'b3b211', 'a7b713', , 'a7b612', 'f3f211',
-        'g3g210', 'h3h210', 'a4a211', 'b4b211', 'a7b613', , 'a7b611', 'f4f211', 'g4g210', 'h4h210', 'a5a211', 'b5b211', 'c5e512', , 'a7b611', 'f5f211',
-        'g5g210', 'h5h210', 'a6a211', 'b6b211', 'c6e612', , 'a7b611', 'f6f211', 'g6g210', 'h6h210', , 'b7b211', 'c7e712', , 'a7b611', 'f7f211', 'g7g210',
-        'h7h210', 'a7b612', 'b8b211', 'c8e812', , 'a7b611', 'f8f211', 'g8g210', 'h8h210', , , , , , , , , 'b7c69', 'b7c69', 'c2g210', , 'e2g210', 'b7c610',
-        'b7c710', 'b7c69', 'a3a211', 'b3b211', 'b7c612', , 'b7c612', 'f3f211', 'g3g210', 'h3h210', 'a4a211', 'b4b211', 'b7c612', , 'b7c611', 'f4f211',
-        'g4g210', 'h4h210', 'a5a211', 'b5b211', 'c5e512', , 'b7c611', 'f5f211', 'g5g210', 'h5h210', 'a6a211', 'b6b211', 'c6e612', , 'b7c611', 'f6f211',
-        'g6g210', 'h6h210', 'a7a211', , 'c7e712', , 'b7c611', 'f7f211', 'g7g210', 'h7h210', 'a8a211', 'b8e812', 'c8e812', , 'b7c611', 'f8f211', 'g8g210',
-        'h8h210', , , , , , , , , 'c7d69', 'c7d69', 'c2g210', , 'e2g210', 'c7d610', 'c7d710', 'c7d69', 'a3a211', 'b3b211', 'c3h312', , 'c7d612', 'f3f211',
-        'g3g210', 'h3h210', 'a4a211', 'b4b211', 'c4e412', , 'c7d611', 'f4f211', 'g4g210', 'h4h210', 'a5a211', 'b5b211', 'c5e512', , 'c7d611', 'f5f211',
-        'g5g210', 'h5h210', 'a6a211', 'b6b211', 'c6e612', , 'c7d611', 'f6f211', 'g6g210', 'h6h210', 'a7a211', 'b7b211', , , 'c7d611', 'f7f211', 'g7g210',
-        'h7h210', 'a8a211', 'b8b211', 'c8e812', , 'c7d611', 'f8f211', 'g8g210', 'h8h210', , , , , , , , , 'd7e69', 'd7e69', 'c2g210', , 'e2g210', 'd7e610',
-        'd7e710', 'd7e69', 'a3a211', 'b3b211', 'c3h312', , 'd7e612', 'f3f211', 'g3g210', 'h3h210', 'a4a211', 'b4b211', 'c4d412', , 'd7d611', 'f4f211',
-        'g4g210', 'h4h210', 'a5a211', 'b5b211', 'c5d512', , 'd7d611', 'f5f211', 'g5g210', 'h5h210', 'a6a211', 'b6b211', 'c6d612', , 'd7d611', 'f6f211',
-        'g6g210', 'h6h210', 'a7a211', 'b7b211', 'c7c313', , 'd7d611', 'f7f211', 'g7g210', 'h7h210', 'a8a211', 'b8b211', 'c8e812', 'd7e611', 'd7d611',
-        'f8f211', 'g8g210', 'h8h210', , , , , , , , , 'e7f69', 'e7f69', 'c2g210', , 'e2g210', 'e7f610', 'e7f710', 'e7f69', 'a3a211', 'b3b211', 'c3h312',
-        ,
-        'e3e412', 'f3f211', 'g3g210', 'h3h210', 'a4a211', 'b4b211', 'c4d412', , 'e7d611', 'f4f211', 'g4g210', 'h4h210', 'a5a211', 'b5b211', 'c5d512',
-        ,
-        'e7d611', 'f5f211', 'g5g210', 'h5h210', 'a6a211', 'b6b211', 'c6d612', , 'e7d611', 'f6f211', 'g6g210', 'h6h210', 'a7a211', 'b7b211', 'c7d712',
-        ,
-        , 'f7f211', 'g7g210', 'h7h210', 'a8a211', 'b8b211', 'c8d812', , 'e7d611', 'f8f211', 'g8g210', 'h8h210', , , , , , , , , 'f7g69', 'f7g69', 'c2g210',
-        ,
-        'e2g210', 'f2g210', 'f7g710', 'f7g69', 'a3a211', 'b3b211', 'c3h312', , 'e3h312', 'f3f211', 'g3g210', 'h3h210', 'a4a211', 'b4b211', 'c4d412',
-        ,
-        'e4d412', 'f4f211', 'g4g210', 'h4h210', 'a5a211', 'b5b211', 'c5d512', , 'e5d512', 'f5f211', 'g5g210', 'h5h210', 'a6a211', 'b6b211', 'c6d613',
-        ,
-        'f7e712', 'f6f211', 'g6g210', 'h6h210', 'a7a211', 'b7b211', 'c7d713', , 'f7e612', , 'g7g210', 'h7h210', 'a8a211', 'b8b211', 'c8d813', ,
-        'f7e612', 'f7f613', 'g8g210', 'h8h210', , , , , , , , , 'g7h69', 'g7h69', 'c2g210', , 'e2g210', 'f2g210', 'g2h210', 'g7h69', 'a3a211', 'b3b211',
-        'c3h312', , 'e3h312', 'f3f211', 'g3g210', 'h3h210', 'a4a211', 'b4b211', 'c4d412', , 'e4d412', 'f4f211', 'g4g210', 'h4h210', 'a5a211', 'b5b211',
-        'c5d513', , 'e5h513', 'f5f211', 'g5g210', 'h5h210', 'a6a211', 'b6b211', 'c6h613', , 'e6h613', 'f6f211', 'g6g210', 'h6h210', 'a7a211', 'b7b211',
-        'c7c313', , 'e7e413', 'f7f211', , 'h7h210', 'a8a211', 'b8b211', 'c8h813', , 'e8h813', 'f8f211', 'g7f613', 'h8h210', , , , , , , , , 'h7h69', 'h7h69',
-        'c2g210', , 'e2g210', 'f2g210', 'g2h210', 'h7h69', 'a3a211', 'b3b211', 'c3g313', , 'h7g612', 'f3f211', 'g3g210', 'h3h210', 'a4a211', 'b4b211',
-        'c4e413', , 'h7h612', 'f4f211', 'g4g210', 'h4h210', 'a5a211', 'b5b211', 'c5d514', , 'e5e413', 'f5f211', 'g5g210', 'h5h210', 'a6a211', 'b6b211',
-        'c6d614', , 'e6e413', 'f6f211', 'g6g210', 'h6h210', 'a7a211', 'b7b211', 'c7d714', , 'e7e413', 'f7f211', 'g7g210', , 'a8a211', 'b8b211', 'c8d814',
-        ,
-        'e8e413', 'f8f211', 'g8g210', 'h7g613', , , , , , , , , 'a8b811', 'a8b711', 'c2a211', , 'e2a211', 'a8b711', 'a8b710', 'a8b710', 'a3a211', 'b3b212',
-        'a8b713', , 'a8b713', 'f3f212', 'g3g212', 'a8b712', 'a4a211', 'b4b212', 'a8b714', , 'a8b712', 'f4f212', 'g4g212', 'h4h212', 'a5a211', 'b5b212',
-        'a8b714', , 'a8b712', 'f5f212', 'g5g212', 'h5h212', 'a6a211', 'b6b212', 'a8b714', , 'a8b712', 'f6f212', 'g6g212', 'h6h212', 'a7a211', 'b7b212',
-        'a8b714', , 'a8b712', 'f7f212', 'g7g212', 'h7h212', , 'b8b212', 'a8b714', , 'a8b712', 'f8f212', 'g8g212', 'h8h212', , , , , , , , , 'b8c811', 'b2a211',
-        'c2a211', , 'e2a211', 'b8c711', 'b8c710', 'b8c710', 'a3a211', 'b3b212', 'b8c713', , 'b8c713', 'f3f212', 'g3g212', 'b8c712', 'a4a211', 'b4b212',
-        'b8c714', , 'b8c712', 'f4f212', 'g4g212', 'h4h212', 'a5a211', 'b5b212', 'b8c714', , 'b8c712', 'f5f212', 'g5g212', 'h5h212', 'a6a211', 'b6b212',
-        'b8c714', , 'b8c712', 'f6f212', 'g6g212', 'h6h212', 'a7a211', 'b7b212', 'b8b714', , 'b8c712', 'f7f212', 'g7g212', 'h7h212', 'a8a211', , 'b8c714',
-        ,
-        'b8c712', 'f8f212', 'g8g212', 'h8h212', , , , , , , , , 'c8d811', 'b2a211', 'c2a211', , 'e2a211', 'c8d711', 'c8d710', 'c8d710', 'a3a211', 'b3b212',
-        'c3h313', , 'c8d713', 'f3f212', 'g3g212', 'c8d712', 'a4a211', 'b4b212', 'c4h414', , 'c8d712', 'f4f212', 'g4g212', 'h4h212', 'a5a211', 'b5b212',
-        'c5d514', , 'c8d712', 'f5f212', 'g5g212', 'h5h212', 'a6a211', 'b6b212', 'c6d614', , 'c8d712', 'f6f212', 'g6g212', 'h6h212', 'a7a211', 'b7b212',
-        'c7e714', , 'c8d712', 'f7f212', 'g7g212', 'h7h212', 'a8a211', 'b8b212', , , 'c8d712', 'f8f212', 'g8g212', 'h8h212', , , , , , , , , 'd8e811', 'b2a211',
-        'c2a211', , 'e2a211', 'd8e711', 'd8e710', 'd8e710', 'a3a211', 'b3b212', 'c3h313', , 'd8e713', 'f3f212', 'g3g212', 'd8e712', 'a4a211', 'b4b212',
-        'c4h414', , 'd8e712', 'f4f212', 'g4g212', 'h4h212', 'a5a211', 'b5b212', 'c5d514', , 'd8e712', 'f5f212', 'g5g212', 'h5h212', 'a6a211', 'b6b212',
-        'c6d614', , 'd8e712', 'f6f212', 'g6g212', 'h6h212', 'a7a211', 'b7b212', 'c7d714', , 'd8d712', 'f7f212', 'g7g212', 'h7h212', 'a8a211', 'b8b212',
-        'c8c314', , 'd8d712', 'f8f212', 'g8g212', 'h8h212', , , , , , , , , 'e8f811', 'b2a211', 'c2a211', , 'e2a211', 'e8f711', 'e8f710', 'e8f710', 'a3a211',
-        'b3b212', 'c3h313', , 'e3h313', 'f3f212', 'g3g212', 'e8f712', 'a4a211', 'b4b212', 'c4h414', , 'e8e712', 'f4f212', 'g4g212', 'h4h212', 'a5a211',
-        'b5b212', 'c5d514', , 'e8e712', 'f5f212', 'g5g212', 'h5h212', 'a6a211', 'b6b212', 'c6d614', , 'e8e712', 'f6f212', 'g6g212', 'h6h212', 'a7a211',
-        'b7b212', 'c7d714', , 'e8d712', 'f7f212', 'g7g212', 'h7h212', 'a8a211', 'b8b212', 'c8d814', , , 'f8f212', 'g8g212', 'h8h212', , , , , , , , , 'f8g811',
-        'b2a211', 'c2a211', , 'e2a211', 'f2a211', 'f8g710', 'f8g710', 'a3a211', 'b3b212', 'c3h313', , 'e3h313', 'f3f212', 'g3g212', 'f8g712', 'a4a211',
-        'b4b212', 'c4h414', , 'f8e712', 'f4f212', 'g4g212', 'h4h212', 'a5a211', 'b5b212', 'c5d514', , 'f8e712', 'f5f212', 'g5g212', 'h5h212', 'a6a211',
-        'b6b212', 'c6d614', , 'f8e712', 'f6f212', 'g6g212', 'h6h212', 'a7a211', 'b7b212', 'c7d714', , 'e7e814', 'f7f212', 'g7g212', 'h7h212', 'a8a211',
-        'b8b212', 'c8d814', , 'f8e713', , 'g8g212', 'h8h212', , , , , , , , , 'g8h811', 'b2a211', 'c2a211', , 'e2a211', 'f2a211', 'g8h710', 'g8h710', 'a3a211',
-        'b3b212', 'c3h313', , 'e3h313', 'f3f212', 'g3g212', 'g8g712', 'a4a211', 'b4b212', 'c4h414', , 'g8h713', 'f4f212', 'g4g212', 'h4h212', 'a5a211',
-        'b5b212', 'c5d514', , 'g8f713', 'f5f212', 'g5g212', 'h5h212', 'a6a211', 'b6b212', 'c6d614', , 'e6e514', 'f6f212', 'g6g212', 'h6h212', 'a7a211',
-        'b7b212', 'c7d714', , 'e7e514', 'f7f212', 'g7g212', 'h7h212', 'a8a211', 'b8b212', 'c8d814', , 'e8e514', 'f8f212', , 'h8h212', , , , , , , , , 'h8h711',
-        'b2a211', 'c2a211', , 'e2a211', 'f2a211', 'h8h710', 'h8h710', 'a3a211', 'b3b212', 'c3h313', , 'e3h313', 'f3f212', 'g3g212', 'h3h212', 'a4a211',
-        'b4b212', 'c4c314', , 'h8h713', 'f4f212', 'g4g212', 'h4h212', 'a5a211', 'b5b212', 'c5d514', , 'e5e314', 'f5f212', 'g5g212', 'h5h212', 'a6a211',
-        'b6b212', 'c6c314', , 'e6e314', 'f6f212', 'g6g212', 'h6h212', 'a7a211', 'b7b212', 'c7c314', , 'e7e314', 'f7f212', 'g7g212', 'h7h212', 'a8a211',
-        'b8b212', 'c8c314', , 'e8e314', 'f8f212', 'g8g212', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a410',
-        ,
-        'c1c49', , 'e1e35', 'f1f35', 'g1g35', 'h1h35', , , , , , , , , 'a3d35', , 'c3d35', 'd1d24', 'd1d24', 'd1d24', 'd1d24', 'd1d24', 'd1d26', , 'd1d26',
-        'd4d35', 'e4e35', 'f4f35', 'g4g35', 'h4h35', 'd1d29', , 'c5c49', 'd5d35', 'e5e35', 'f5f35', 'g5g35', 'h5h35', 'a6a410', , 'c6c49', 'd6d35',
-        'e6e35', 'f6f35', 'g6g35', 'h6h35', 'a7a410', , 'c7c49', 'd7d35', 'e7e35', 'f7f35', 'g7g35', 'h7h35', 'a8a410', , 'c8c49', 'd8d35', 'e8e35',
-        'f8f35', 'g8g35', 'h8h35', 'a1a410', , 'c1c49', 'd1d37', , 'e1d26', 'e1d26', 'e1d26', , , , , , , , , 'a3d37', , 'e1d25', 'e1d24', 'e1d24', 'e1d24',
-        'e1d24', 'e1d24', 'e1d26', , 'e1d26', 'e1d26', 'e1d26', 'e1d26', 'e1d26', 'e1d26', 'e1d29', , 'c5c49', 'e1d26', 'e1d26', 'e1d26', 'e1d26',
-        'e1d26', 'a6a410', , 'c6c49', 'e1d26', 'e1d26', 'e1d26', 'e1d26', 'e1d26', 'a7a410', , 'c7c49', 'e1d26', 'e1d26', 'e1d26', 'e1d26', 'e1d26',
-        'a8a410', , 'c8c49', 'e1d26', 'e1d26', 'e1d26', 'e1d26', 'e1d26', 'a1a410', , 'c1c410', 'd1d38', 'e1e38', , 'g1g38', 'h1h38', , , , , , , , , 'a3d38',
-        ,
-        'c3d38', 'f1e17', 'f1f27', 'f1e17', 'f1e17', 'f1e17', 'a4e49', , 'f1e27', 'd4d38', 'e4e38', 'f1e18', 'f1e18', 'f1e18', 'a5a410', , 'f1e29',
-        'd5d38', 'e5e38', 'f5f38', 'g5g38', 'h5h38', 'a6a410', , 'c6c410', 'd6d38', 'e6e38', 'f6f38', 'g6g38', 'h6h38', 'a7a410', , 'c7c410', 'd7d38',
-        'e7e38', 'f7f38', 'g7g38', 'h7h38', 'a8a410', , 'c8c410', 'd8d38', 'e8e38', 'f8f38', 'g8g38', 'h8h38', 'a1a412', , 'c1c412', 'd1d310', 'e1e39',
-        'f1f39', , 'h1h39', , , , , , , , , 'a3e39', , 'c3e39', 'g1f18', 'g1f27', 'g1f18', 'g1f18', 'g1f18', 'g1f110', , 'g1f110', 'g1f29', 'e4e39', 'f4f39',
-        'g1f19', 'g1f19', 'a5f512', , 'g1f211', 'd5d310', 'e5e39', 'f5f39', 'g5g39', 'h5h39', 'a6f612', , 'g1f211', 'd6d310', 'e6e39', 'f6f39', 'g6g39',
-        'h6h39', 'a7c712', , 'c7c812', 'd7d310', 'e7e39', 'f7f39', 'g7g39', 'h7h39', 'a8c812', , 'c8f812', 'd8d310', 'e8e39', 'f8f39', 'g8g39', 'h8h39',
-        'a1a413', , 'c1c413', 'd1d312', 'e1e310', 'f1f310', 'g1g310', , , , , , , , , , 'a3e310', , 'c3e310', 'd3e310', 'h1g19', 'h1g19', 'h1g19', 'h1g19',
-        'a4e412', , 'c4e412', 'd4e412', 'e4e310', 'f4f310', 'g4g310', 'h4h310', 'a5a413', , 'c5c813', 'd5d312', 'e5e310', 'f5f310', 'g5g310', 'h5h310',
-        'a6a413', , 'c6c813', 'd6d312', 'e6e310', 'f6f310', 'g6g310', 'h6h310', 'a7a413', , 'h1g112', 'd7d312', 'e7e310', 'f7f310', 'g7g310', 'h7h310',
-        'a8c813', , 'h1g112', 'd8d312', 'e8e310', 'f8f310', 'g8g310', 'h8h310', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , 'a1a46', , 'c1c35', 'd1e16', 'e1e34', 'f1f34', 'g1g34', 'h1h34', , , , , 'e2e34', 'f2f34', 'g2g34', 'h2h34', 'a3d34', , 'c3d34',
-        'd3e34', 'e3f34', 'f3g34', 'g3h34', 'h3g34', 'a4b45', , 'c4c35', 'd4d34', 'e4e34', 'f4f34', 'g4g34', 'h4h34', 'a5b55', , 'c5c35', 'd5d34',
-        'e5e34', 'f5f34', 'g5g34', 'h5h34', 'a6d66', , 'c6c35', 'd6d34', 'e6e34', 'f6f34', 'g6g34', 'h6h34', 'a7d76', , 'c7c35', 'd7d34', 'e7e34',
-        'f7f34', 'g7g34', 'h7h34', 'a8d86', , 'c8c35', 'd8d34', 'e8e34', 'f8f34', 'g8g34', 'h8h34', 'a1a49', , 'c1c47', 'd1d37', 'e2d26', 'e2d26',
-        'e2d26', 'e2d26', , , , , , 'e2d26', 'e2d26', 'e2d26', 'a3d37', , 'e2d25', 'e2d24', 'e2d24', 'e2d24', 'e2d24', 'e2d24', 'e2d26', , 'e2d26', 'e2d26',
-        'e2d26', 'e2d26', 'e2d26', 'e2d26', 'e2d37', , 'c5c47', 'e2d26', 'e2d26', 'e2d26', 'e2d26', 'e2d26', 'e2d37', , 'c6c47', 'e2d26', 'e2d26',
-        'e2d26', 'e2d26', 'e2d26', 'e2d38', , 'c7c47', 'e2d26', 'e2d26', 'e2d26', 'e2d26', 'e2d26', 'e2d38', , 'c8c47', 'e2d26', 'e2d26', 'e2d26',
-        'e2d26', 'e2d26', 'a1a410', , 'c1c410', 'd1d38', 'e1e37', 'f2e29', 'g1g38', 'h1h38', , , , , , , 'g2g38', 'h2h38', 'a3e37', , 'c3e37', 'd3e37',
-        'f2e17', 'f2e17', 'f2e17', 'f2e17', 'a4d49', , 'f2e27', 'd4d38', 'e4e37', 'f2e18', 'f2e18', 'f2e18', 'a5a410', , 'f2e29', 'd5d38', 'e5e37',
-        'f5f38', 'g5g38', 'h5h38', 'a6a410', , 'f2e39', 'd6d38', 'e6e37', 'f6f38', 'g6g38', 'h6h38', 'a7a410', , 'f2e39', 'd7d38', 'e7e37', 'f7f38',
-        'g7g38', 'h7h38', 'a8a410', , 'f2e39', 'd8d38', 'e8e37', 'f8f38', 'g8g38', 'h8h38', 'a1a412', , 'c1c412', 'd1d310', 'e1e39', 'f1f39', 'g2f111',
-        'h1h39', , , , , , , , 'h2h39', 'a3e39', , 'c3e39', 'g2f18', 'g2f27', 'g2f18', 'g2f18', 'g2f18', 'g2f110', , 'g2f110', 'g2f29', 'e4e39', 'f4f39',
-        'g2f19', 'g2f19', 'a5d512', , 'g2f211', 'd5d310', 'e5e39', 'f5f39', 'g5g39', 'h5h39', 'a6e612', , 'g2f211', 'd6d310', 'e6e39', 'f6f39', 'g6g39',
-        'h6h39', 'a7c712', , 'g2f311', 'd7d310', 'e7e39', 'f7f39', 'g7g39', 'h7h39', 'a8c812', , 'g2f311', 'd8d310', 'e8e39', 'f8f39', 'g8g39', 'h8h39',
-        'a1a413', , 'c1c413', 'd1d312', 'e1e310', 'f1f310', 'g1g310', 'h2g112', , , , , , , , , 'a3e310', , 'c3e310', 'd3e310', 'h2g19', 'h2g19', 'h2g19',
-        'h2g19', 'a4e412', , 'c4e412', 'd4e412', 'e4e310', 'f4f310', 'g4g310', 'h4h310', 'a5a413', , 'c5c813', 'd5d312', 'e5e310', 'f5f310', 'g5g310',
-        'h5h310', 'a6a413', , 'c6c813', 'd6d312', 'e6e310', 'f6f310', 'g6g310', 'h6h310', 'a7a413', , 'h2g112', 'd7d312', 'e7e310', 'f7f310', 'g7g310',
-        'h7h310', 'a8c813', , 'h2g112', 'd8d312', 'e8e310', 'f8f310', 'g8g310', 'h8h310', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , 'a1a47', , 'c1c35', 'd1e17', 'd3d26', 'd3d26', 'd3d26', 'd3d26', , , , , , , , , 'a3c35', , 'd3d25', , 'd3d24', 'd3d24',
-        'd3d24', 'd3d24', 'a4b45', , 'c4c35', 'd4b45', 'e4b45', 'f4b45', 'g4b45', 'h4b45', 'a5b55', , 'c5c35', 'd5b55', 'e5b55', 'f5b55', 'g5b55',
-        'h5b55', 'a6b65', , 'c6c35', 'd6b65', 'e6b65', 'f6b65', 'g6b65', 'h6b65', 'a7b75', , 'c7c35', 'd7b75', 'e7b75', 'f7b75', 'g7b75', 'h7b75',
-        'a8b85', , 'c8c35', 'd8b85', 'e8b85', 'f8b85', 'g8b85', 'h8b85', 'a1a49', , 'c1c47', 'd1d37', 'e3d26', 'e3d26', 'e3d26', 'e3d26', , , , , , , ,
-        ,
-        'a3d37', , 'e3d25', 'e3d24', , 'e3d24', 'e3d24', 'e3d24', 'e3d26', , 'e3d26', 'e3d26', 'e3d26', 'e3d26', 'e3d26', 'e3d26', 'e3d37', , 'c5c47',
-        'e3d26', 'e3d26', 'e3d26', 'e3d26', 'e3d26', 'e3d37', , 'c6c47', 'e3d26', 'e3d26', 'e3d26', 'e3d26', 'e3d26', 'e3d38', , 'c7c47', 'e3d26',
-        'e3d26', 'e3d26', 'e3d26', 'e3d26', 'e3d38', , 'c8c47', 'e3d26', 'e3d26', 'e3d26', 'e3d26', 'e3d26', 'a1a410', , 'c1c410', 'd1d38', 'e1e38',
-        'f3e29', 'f3e29', 'f3e29', , , , , , , , , 'a3d38', , 'c3d38', 'f3e27', 'f3f27', , 'f3e27', 'f3e27', 'a4d49', , 'f3e27', 'd4d38', 'e4e38', 'f3e28',
-        'f3e28', 'f3e28', 'a5a410', , 'f3e29', 'd5d38', 'e5e38', 'f3e29', 'f3e29', 'f3e29', 'a6a410', , 'f3e39', 'd6d38', 'e6e38', 'f3e29', 'f3e29',
-        'f3e29', 'a7a410', , 'f3e39', 'd7d38', 'e7e38', 'f3e29', 'f3e29', 'f3e29', 'a8a410', , 'f3e39', 'd8d38', 'e8e38', 'f3e29', 'f3e29', 'f3e29',
-        'a1a412', , 'c1c412', 'd1d310', 'e1e39', 'f1f39', 'g3f211', 'g3f211', , , , , , , , , 'a3e39', , 'c3e39', 'g3f28', 'g3f27', 'g3f28', , 'g3f28', 'g3f210',
-        ,
-        'g3f210', 'g3f29', 'e4e39', 'f4f39', 'g3f29', 'g3f29', 'a5d512', , 'g3f211', 'd5d310', 'e5e39', 'f5f39', 'g3f211', 'g3f211', 'a6e612',
-        ,
-        'g3f211', 'd6d310', 'e6e39', 'f6f39', 'g3f211', 'g3f211', 'a7c712', , 'g3f311', 'd7d310', 'e7e39', 'f7f39', 'g3f211', 'g3f211', 'a8c812',
-        ,
-        'g3f311', 'd8d310', 'e8e39', 'f8f39', 'g3f211', 'g3f211', 'a1a413', , 'c1c413', 'd1d312', 'e1e310', 'f1f310', 'g1g310', 'h3g212', , , , ,
-        ,
-        , , , 'a3e310', , 'c3e310', 'd3e310', 'h3g29', 'h3g29', 'h3g29', , 'a4e412', , 'c4e412', 'd4e412', 'e4e310', 'f4f310', 'g4g310', 'h3g211',
-        'a5a413', , 'c5c813', 'd5d312', 'e5e310', 'f5f310', 'g5g310', 'h3g212', 'a6a413', , 'c6c813', 'd6d312', 'e6e310', 'f6f310', 'g6g310', 'h3g212',
-        'a7a413', , 'h3g212', 'd7d312', 'e7e310', 'f7f310', 'g7g310', 'h3g212', 'a8c813', , 'h3g212', 'd8d312', 'e8e310', 'f8f310', 'g8g310', 'h3g212',
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a49', , 'c1c37', 'd1d37', 'd4d37', 'd4d37', 'd4d37', 'd4d37',
-        ,
-        , , , , , , , , , 'd4d35', 'd3c37', 'd4d37', 'd4d37', 'd4d37', 'd4d37', , , , , 'd4d36', 'd4d36', 'd4d36', 'd4d36', , , , , 'd4d37', 'd4d37', 'd4d37',
-        'd4d37', , , , , , 'd4d37', 'd4d37', 'd4d37', , , , , , , 'd4d37', 'd4d37', , , , , , , , 'd4d37', 'a1a410', , 'c1c48', 'd1d38', 'e4d37', 'e4d37', 'e4d37',
-        'e4d37', , , , , , , , , 'a3d38', , 'e4d35', 'e4e37', 'e4d37', 'e4d37', 'e4d37', 'e4d37', 'e4d37', , 'e4e37', 'e4d36', , 'e4d36', 'e4d36', 'e4d36',
-        'e4d37', , 'e4d37', 'e4d37', 'e4d37', 'e4d37', 'e4d37', 'e4d37', 'e4d37', , 'e4d37', 'e4d37', 'e4d37', 'e4d37', 'e4d37', 'e4d37', 'e4d38',
-        ,
-        'e4d37', 'e4d37', 'e4d37', 'e4d37', 'e4d37', 'e4d37', 'e4d38', , 'e4d37', 'e4d37', 'e4d37', 'e4d37', 'e4d37', 'e4d37', 'a1a410', , 'c1c410',
-        'd1d38', 'e1e39', 'f4e39', 'f4e39', 'f4e39', , , , , , , , , 'a3d38', , 'c3d38', 'f4e37', 'e3d38', 'f3d38', 'g3d38', 'h3d38', 'a4e49', , 'f4e37',
-        'd4d38', 'f4e38', , 'f4e38', 'f4e38', 'a5a410', , 'f4e39', 'd5d38', 'e5e49', 'f4e39', 'f4e39', 'f4e39', 'a6a410', , 'f4e39', 'd6d38', 'e6e49',
-        'f4e39', 'f4e39', 'f4e39', 'a7a410', , 'f4e39', 'd7d38', 'e7e49', 'f4e39', 'f4e39', 'f4e39', 'a8a410', , 'f4e39', 'd8d38', 'e8e49', 'f4e39',
-        'f4e39', 'f4e39', 'a1a412', , 'c1c412', 'd1d310', 'e1e39', 'f1f310', 'g1g310', 'h1h310', , , , , , , , , 'a3e39', , 'c3e39', 'g4f38', 'g4f38', 'f3e39',
-        'g3e39', 'h3e39', 'g4f310', , 'g4f310', 'g4f39', 'e4e39', 'g4f39', , 'g4f39', 'a5d512', , 'g4f311', 'd5d310', 'e5e39', 'f5f310', 'g4f311',
-        'h5h310', 'a6e612', , 'g4f311', 'd6d310', 'e6e39', 'f6f310', 'g4f311', 'h6h310', 'a7c712', , 'g4f311', 'd7d310', 'e7e39', 'f7f310', 'g4f311',
-        'h7h310', 'a8c812', , 'g4f311', 'd8d310', 'e8e39', 'f8f310', 'g4f311', 'h8h310', 'a1a413', , 'c1c413', 'd1d312', 'e1e310', 'f1f310', 'g1g312',
-        'h1h312', , , , , , , , , 'a3e310', , 'c3e310', 'd3e310', 'h4g39', 'h4g39', 'g3f310', 'h3f310', 'a4e412', , 'c4e412', 'd4e412', 'e4e310', 'f4f310',
-        'h4g311', , 'a5a413', , 'c5c813', 'd5d312', 'e5e310', 'f5f310', 'g5g412', 'h4g312', 'a6a413', , 'c6c813', 'd6d312', 'e6e310', 'f6f310', 'g6g412',
-        'h4g312', 'a7a413', , 'h4g312', 'd7d312', 'e7e310', 'f7f310', 'g7g412', 'h4g312', 'a8c813', , 'h4g312', 'd8d312', 'e8e310', 'f8f310', 'g8g412',
-        'h4g312', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , 'a1a411', , 'c1c49', 'd1d39', 'e5d49', 'e5d49', 'e5d49', 'e5d49', , , , , , , , , , , 'e5d47', 'e5d47', 'e3f39', 'e5e49',
-        'e5e49', 'e5e49', , , , 'd4d39', 'e4c49', 'e5e49', 'e5f49', 'e5f49', , , , , , 'e5d49', 'e5d49', 'e5d49', , , , , , 'e5d49', 'e5d49', 'e5d49', , , , ,
-        ,
-        , 'e5d49', 'e5d49', , , , , , , , 'e5d49', 'a1a411', , 'c1c411', 'd1d39', 'e1e310', 'f1f311', 'f5f411', 'f5f411', , , , , , , , , 'a3d39', , 'c3d39',
-        'f5f48', 'e3d39', 'f3d39', 'f5e49', 'f5e49', 'a4d410', , 'f5e48', 'd4d39', 'f5f49', 'f5e49', 'f5f49', 'f5f49', 'a5c511', , 'f5e49', 'd5d39',
-        'e5e310', , 'f5f411', 'f5f411', 'a6c611', , 'f5e49', 'd6d39', 'e6e310', 'f5f411', 'f5f411', 'f5f411', 'a7c711', , 'f5e49', 'd7d39', 'e7e310',
-        'f5f411', 'f5f411', 'f5f411', 'a8c811', , 'f5e49', 'd8d39', 'e8e310', 'f5f411', 'f5f411', 'f5f411', 'a1a412', , 'c1c412', 'd1d311', 'e1e310',
-        'f1f311', 'g1g311', 'g5f411', , , , , , , , , 'a3e310', , 'c3e310', 'g5f48', 'g5g49', 'f3e310', 'g3e310', 'g5g410', 'g5f410', , 'g5f410', 'g5f410',
-        'g5f49', 'f4f311', 'g5f49', 'g5f49', 'a5d512', , 'g5f411', 'd5d311', 'e5e310', 'f5f311', , 'g5f411', 'a6e612', , 'g5f411', 'd6d311', 'e6e310',
-        'f6f311', 'g5f411', 'g5f411', 'a7c712', , 'g5f411', 'd7d311', 'e7e310', 'f7f311', 'g5f411', 'g5f411', 'a8c812', , 'g5f411', 'd8d311', 'e8e310',
-        'f8f311', 'g5f411', 'g5f411', 'a1a413', , 'c1c413', 'd1d312', 'e1e310', 'f1f312', 'g1g312', 'h1h312', , , , , , , , , 'a3e310', , 'c3e310', 'd3e310',
-        'h5g49', 'f3e310', 'g3e310', 'h3e310', 'a4e412', , 'c4e412', 'd4e412', 'e4e310', 'h5g411', 'g4g312', 'h5g411', 'a5a413', , 'c5c813', 'd5d312',
-        'e5e310', 'f5f412', 'g5g312', , 'a6a413', , 'c6c813', 'd6d312', 'e6e310', 'f6f412', 'g6g312', 'h5g414', 'a7a413', , 'h5g412', 'd7d312', 'e7e310',
-        'f7f412', 'g7g312', 'h5g414', 'a8c813', , 'h5g412', 'd8d312', 'e8e310', 'f8f412', 'g8g312', 'h8c813', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a413', , 'c1c511', 'd1d411', 'e1e311', 'f1f311', 'g1g311', 'h1h311', , , , , , , , , ,
-        ,
-        'c3c511', 'f6f59', 'f6g510', 'f6e59', 'f6e59', 'f6e59', , , , 'f6f510', 'e4e311', 'f4f311', 'f6e511', 'f6e511', , , , , 'e5e311', 'f5f311',
-        'f6e511', 'f6e511', , , , , , , 'g6g311', 'h6h311', , , , , , , 'g7g311', 'h7h311', , , , , , , , 'h8h311', 'a1a413', , 'c1c712', 'g6f512', 'e1e311', 'f1f312',
-        'g1g311', 'h1h311', , , , , , , , , 'a3e311', , 'c3e311', 'g6f59', 'g6h510', 'f3g311', 'g3h311', 'g6g511', 'g6f511', , 'g6f511', 'g6f510', 'e4e311',
-        'f4f312', 'g4g311', 'h4h311', 'a5c513', , 'g6f511', 'g6g512', 'e5e311', 'f5f312', 'g5g311', 'h5h311', 'a6c613', , 'g6f511', 'g6f512', 'e6e311',
-        'f6f312', , 'h6h311', 'a7c712', , 'g6f511', 'd7c712', 'e7e311', 'f7f312', 'g6f512', 'h7h311', 'a8c812', , 'g6f511', 'd8c812', 'e8e311', 'f8f312',
-        'g6f512', 'h8h311', 'a1a413', , 'c1c413', 'd1d313', 'e1e311', 'f1f312', 'g1g312', 'h1h312', , , , , , , , , 'a3e311', , 'c3e311', 'd3e311', 'h6h510',
-        'f3e311', 'g3e311', 'h3e311', 'a4e412', , 'c4e412', 'd4e412', 'e4e311', 'f4f312', 'g4g312', 'h4h312', 'a5a413', , 'c5c813', 'h6g512', 'e5e311',
-        'f5f312', 'g5g312', 'h5h312', 'a6a413', , 'c6c813', 'd6d313', 'e6e311', 'f6f312', 'g6g312', , 'a7a413', , 'h6g512', 'd7d313', 'e7e311', 'f7f312',
-        'g7g312', 'h6g514', 'a8c813', , 'h6g512', 'd8d313', 'e8e311', 'f8f312', 'g8g312', 'h8c813', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a414', , 'c1c712',
-        'd1d313', 'e1e313', 'f1f313', 'g1g312', 'h1h312', , , , , , , , , , , 'c3c712', 'd3g312', 'g7h611', 'g7f611', 'g7g611', 'g7g611', , , , 'g7f611',
-        'g7h612', 'f4f313', 'g4g312', 'h4h312', , , , , 'e5e413', 'f5f313', 'g5g312', 'h5h312', , , , , , 'f6f313', 'g6g312', 'h6h312', , , , , , , , 'h7h312',
-        ,
-        , , , , , , 'h8h312', 'a1a414', , 'c1c813', 'd1d314', 'e1e313', 'f1f313', 'g1g313', 'h1h313', , , , , , , , , 'a3e313', , 'c3c813', 'd3e313', 'h7h611',
-        'h7h612', 'h7g611', 'h7g611', 'a4e413', , 'c4c813', 'd4e413', 'h7h612', 'f4f313', 'g4g313', 'h4h313', 'a5c514', , 'c5c813', 'h7g613', 'e5e413',
-        'f5f313', 'g5g313', 'h5h313', 'a6c614', , 'c6c813', 'h7g613', 'e6e413', 'f6f313', 'g6g313', 'h6h313', 'a7c714', , 'h7g612', 'h7g613', 'e7e413',
-        'f7f313', 'g7g313', , 'a8c813', , 'h7g612', 'd8c813', 'e8e413', 'f8f313', 'g8g313', 'h8c813', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a815', , 'c1c813', 'd1d314', 'e1e314', 'f1f314', 'g1g314', 'h1h313', , , , , , , , , , ,
-        'c3c813', 'd3h313', 'e3h313', 'f3h313', 'h8g712', 'h8g712', , , , 'd4d314', 'h8h713', 'f4f314', 'g4g314', 'h4h313', , , , , 'e5e314', 'f5f314',
-        'g5g314', 'h5h313', , , , , , 'f6f314', 'g6g314', 'h6h313', , , , , , , 'g7g314', 'h7h313', , , , , , , , , , 'a1a215', , 'd1d813', 'e1e312', 'f1f312', 'g1g311',
-        'h1h311', , , , , , , , , 'a3g311', 'a1a210', , 'd3a310', 'e3a310', 'f3a310', 'g3a310', 'h3a310', 'a4a310', 'a1a213', , 'a1a213', 'e4e312', 'f4f312',
-        'g4g311', 'h4h311', 'a5a310', 'a1a215', , 'd5d813', 'e5e312', 'f5f312', 'g5g311', 'h5h311', 'a6a310', 'a1a214', , 'd6d813', 'e6e312', 'f6f312',
-        'g6g311', 'h6h311', 'a7a310', 'a1a214', , 'd7d813', 'e7e312', 'f7f312', 'g7g311', 'h7h311', 'a8a310', 'b8d813', , 'a1a213', 'e8e312', 'f8f312',
-        'g8g311', 'h8h311', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a38', 'b1b412', , 'd1d411', , 'f1f36',
-        'g1g36', 'h1h36', , , , , , , , , 'a3e36', 'b3e36', , 'd3e36', 'e1e26', 'e1e26', 'e1e26', 'e1e26', 'a4a38', 'e1e28', , 'e1e28', 'e4e36', 'f4f36',
-        'g4g36', 'h4h36', 'a5a38', 'e1e211', , 'd5d411', 'e5e36', 'f5f36', 'g5g36', 'h5h36', 'a6a38', 'b6f612', , 'd6d411', 'e6e36', 'f6f36', 'g6g36',
-        'h6h36', 'a7a38', 'b7f712', , 'd7d411', 'e7e36', 'f7f36', 'g7g36', 'h7h36', 'a8a38', 'b8f812', , 'd8d411', 'e8e36', 'f8f36', 'g8g36', 'h8h36',
-        'a1a39', 'b1b412', , 'd1d411', 'e1e38', , 'f1e29', 'f1e29', , , , , , , , , 'a3e38', 'b3e38', , 'f1e26', 'f1e16', 'f1e16', 'f1e16', 'f1e16', 'a4a39',
-        'f1e28', , 'f1e28', 'e4e38', 'f1e28', 'f1e28', 'f1e28', 'a5a39', 'f1e211', , 'd5d411', 'e5e38', 'f1e29', 'f1e29', 'f1e29', 'a6a39', 'b6h612',
-        ,
-        'd6d411', 'e6e38', 'f1e29', 'f1e29', 'f1e29', 'a7a39', 'b7h712', , 'd7d411', 'e7e38', 'f1e29', 'f1e29', 'f1e29', 'a8a39', 'b8h812', , 'd8d411',
-        'e8e38', 'f1e29', 'f1e29', 'f1e29', 'a1a310', 'b1b412', , 'd1d412', 'e1e39', 'f1f39', , 'h1h39', , , , , , , , , 'a3e39', 'b3e39', , 'd3e39', 'g1f18',
-        'g1f28', 'g1f28', 'g1f28', 'a4a310', 'b4f411', , 'g1f29', 'e4e39', 'f4f39', 'g4g39', 'h4h39', 'a5a310', 'b5b412', , 'g1f211', 'e5e39', 'f5f39',
-        'g5g39', 'h5h39', 'a6a310', 'b6b412', , 'd6d412', 'e6e39', 'f6f39', 'g6g39', 'h6h39', 'a7a310', 'b7b412', , 'd7d412', 'e7e39', 'f7f39', 'g7g39',
-        'h7h39', 'a8a310', 'b8b412', , 'd8d412', 'e8e39', 'f8f39', 'g8g39', 'h8h39', 'a1a311', 'b1b414', , 'd1d414', 'e1e311', 'f1f311', 'g1g311',
-        ,
-        , , , , , , , , 'h1g110', 'b3e311', , 'd3e311', 'h1g19', 'h1g19', 'h1g19', 'h1g19', 'a4a311', 'h1g112', , 'h1g112', 'e4e311', 'f4f311', 'g4g311',
-        'h1g111', 'a5a311', 'b5g514', , 'h1g212', 'e5e311', 'f5f311', 'g5g311', 'h5h311', 'a6a311', 'b6g614', , 'd6d814', 'e6e311', 'f6f311', 'g6g311',
-        'h6h311', 'a7a311', 'b7g714', , 'd7d814', 'e7e311', 'f7f311', 'g7g311', 'h7h311', 'a8a311', 'b8d814', , 'd8g814', 'e8e311', 'f8f311', 'g8g311',
-        'h8h311', 'a1g114', 'b1b310', , 'd1d413', 'e1e312', 'f1f312', 'g1g311', 'h1h311', , , , , , , , , 'a2a110', 'a2a311', , 'd3b310', 'e3b310', 'f3b310',
-        'g3b310', 'h3b310', 'a4a312', 'b4b310', , 'a2a313', 'e4e312', 'f4f312', 'g4g311', 'h4h311', 'a5a312', 'b5b310', , 'a2a312', 'e5e312', 'f5f312',
-        'g5g311', 'h5h311', 'a6a312', 'b6b310', , 'a2a312', 'e6e312', 'f6f312', 'g6g311', 'h6h311', 'a7a312', 'b7b310', , 'a2a312', 'e7e312', 'f7f312',
-        'g7g311', 'h7h311', 'a8a312', 'b8b310', , 'a2a312', 'e8e312', 'f8f312', 'g8g311', 'h8h311', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a38', 'b1b48', , 'd1d36', 'e1f19', 'f1f36', 'g1g36', 'h1h36', , , , , , 'f2f36', 'g2g36', 'h2h36', 'a3d36',
-        'b3d36', , 'd3e36', 'e2e16', 'e2e16', 'e2e16', 'e2e16', 'a4c47', 'b4c47', , 'd4d36', 'e4e36', 'f4f36', 'g4g36', 'h4h36', 'a5a38', 'b5b48',
-        ,
-        'd5d36', 'e5e36', 'f5f36', 'g5g36', 'h5h36', 'a6a38', 'b6b48', , 'd6d36', 'e6e36', 'f6f36', 'g6g36', 'h6h36', 'a7a38', 'b7b48', , 'd7d36',
-        'e7e36', 'f7f36', 'g7g36', 'h7h36', 'a8a38', 'b8b48', , 'd8d36', 'e8e36', 'f8f36', 'g8g36', 'h8h36', 'a1a39', 'b1b411', , 'd1d49', 'e1e39',
-        'f2e29', 'g1g38', 'h1h38', , , , , , , 'g2g38', 'h2h38', 'a3f38', 'b3f38', , 'f2e26', 'f2e16', 'f2e16', 'f2e16', 'f2e16', 'a4d49', 'f2e28', , 'f2e28',
-        'f2e28', 'f2e28', 'f2e28', 'f2e28', 'a5a39', 'b5d511', , 'd5d49', 'e5e39', 'f5f38', 'g5g38', 'h5h38', 'a6a39', 'b6f611', , 'd6d49', 'e6e39',
-        'f6f38', 'g6g38', 'h6h38', 'a7a39', 'b7f711', , 'd7d49', 'e7e39', 'f7f38', 'g7g38', 'h7h38', 'a8a39', 'b8f811', , 'd8d49', 'e8e39', 'f8f38',
-        'g8g38', 'h8h38', 'a1a310', 'b1b412', , 'd1d412', 'e1e39', 'f1f39', 'g2f211', 'h1h39', , , , , , , , 'h2h39', 'a3e39', 'b3e39', , 'd3e39', 'g2f18',
-        'g2f28', 'g2f28', 'g2f28', 'a4a310', 'b4e411', , 'g2f29', 'e4e39', 'f4f39', 'g4g39', 'h4h39', 'a5a310', 'b5d512', , 'g2f211', 'e5e39', 'f5f39',
-        'g5g39', 'h5h39', 'a6a310', 'b6b412', , 'd6d512', 'e6e39', 'f6f39', 'g6g39', 'h6h39', 'a7a310', 'b7b412', , 'd7d512', 'e7e39', 'f7f39', 'g7g39',
-        'h7h39', 'a8a310', 'b8b412', , 'd8d512', 'e8e39', 'f8f39', 'g8g39', 'h8h39', 'a1a311', 'b1b414', , 'd1d414', 'e1e311', 'f1f311', 'g1g311',
-        'h2g113', , , , , , , , , 'h2g110', 'b3e311', , 'd3e311', 'h2g19', 'h2g19', 'h2g19', 'h2g19', 'a4a311', 'h2g112', , 'h2g112', 'e4e311', 'f4f311',
-        'g4g311', 'h2g111', 'a5a311', 'b5e514', , 'h2g212', 'e5e311', 'f5f311', 'g5g311', 'h5h311', 'a6a311', 'b6f614', , 'h2g313', 'e6e311', 'f6f311',
-        'g6g311', 'h6h311', 'a7a311', 'b7d714', , 'h2g313', 'e7e311', 'f7f311', 'g7g311', 'h7h311', 'a8a311', 'b8d814', , 'h2g313', 'e8e311', 'f8f311',
-        'g8g311', 'h8h311', 'a1g114', 'b1b311', , 'd1d512', 'a3b412', 'f1f312', 'g1g311', 'h1h311', , , , , , , , , , 'a3a210', , 'd3g311', 'a3b411', 'a3b411',
-        'a3a411', 'a3a411', 'a3b413', 'b4b311', , 'a3b45', 'e4e312', 'f4f312', 'g4g311', 'h4h311', 'a5d512', 'b5b311', , 'a3b45', 'a3b410', 'f5f312',
-        'g5g311', 'h5h311', 'a6d612', 'b6b311', , 'a3b45', 'a3b410', 'f6f312', 'g6g311', 'h6h311', 'a7d712', 'b7b311', , 'a3b45', 'a3b410', 'f7f312',
-        'g7g311', 'h7h311', 'a8d812', 'b8b311', , 'a3b45', 'a3b410', 'f8f312', 'g8g311', 'h8h311', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a38', 'b1b49', , 'd1d37', 'e1f19', 'f1f48', 'g1g48', 'h1h48', , , , , , , , , 'a3d37', 'b3d37', , 'e3e26',
-        ,
-        'e3e26', 'e3e26', 'e3e26', 'a4c47', 'b4c47', , 'd4d37', 'e4c47', 'f4c47', 'g4c47', 'h4c47', 'a5a38', 'e3d48', , 'd5d37', 'e5e48', 'f5f48',
-        'g5g48', 'h5h48', 'a6a38', 'e3d48', , 'd6d37', 'e6e48', 'f6f48', 'g6g48', 'h6h48', 'a7a38', 'e3d48', , 'd7d37', 'e7e48', 'f7f48', 'g7g48',
-        'h7h48', 'a8a38', 'e3d48', , 'd8d37', 'e8e48', 'f8f48', 'g8g48', 'h8h48', 'a1a39', 'b1b411', , 'd1d49', 'e1e38', 'f3e29', 'f3e29', 'f3e29',
-        ,
-        , , , , , , , 'a3e38', 'b3e38', , 'f3e26', 'f3e26', , 'f3e26', 'f3e26', 'a4d49', 'f3e28', , 'f3e28', 'e4e38', 'f3e28', 'f3e28', 'f3e28', 'a5a39',
-        'b5d511', , 'd5d49', 'e5e38', 'f3e29', 'f3e29', 'f3e29', 'a6a39', 'b6e611', , 'd6d49', 'e6e38', 'f3e29', 'f3e29', 'f3e29', 'a7a39', 'b7e711',
-        ,
-        'd7d49', 'e7e38', 'f3e29', 'f3e29', 'f3e29', 'a8a39', 'b8e811', , 'd8d49', 'e8e38', 'f3e29', 'f3e29', 'f3e29', 'a1a310', 'b1b412', , 'd1d412',
-        'e1e39', 'f1f39', 'g3f211', 'g3f211', , , , , , , , , 'a3e39', 'b3e39', , 'd3e39', 'g3f38', 'g3f28', , 'g3f28', 'a4a310', 'b4e411', , 'g3f29', 'e4e39',
-        'f4f39', 'g3f210', 'g3f210', 'a5a310', 'b5d512', , 'g3f211', 'e5e39', 'f5f39', 'g3f211', 'g3f211', 'a6a310', 'b6b412', , 'd6d512', 'e6e39',
-        'f6f39', 'g3f211', 'g3f211', 'a7a310', 'b7b412', , 'd7d512', 'e7e39', 'f7f39', 'g3f211', 'g3f211', 'a8a310', 'b8b412', , 'd8d512', 'e8e39',
-        'f8f39', 'g3f211', 'g3f211', 'a1a311', 'b1b414', , 'd1d414', 'e1e312', 'f1f311', 'g1g311', 'h3g213', , , , , , , , , 'h3g210', 'b3f311', , 'd3f311',
-        'h3g29', 'h3g29', 'h3g29', , 'a4a311', 'h3g212', , 'h3g212', 'h3g211', 'f4f311', 'g4g311', 'h3g211', 'a5a311', 'b5e514', , 'h3g212', 'e5e312',
-        'f5f311', 'g5g311', 'h3g213', 'a6a311', 'b6f614', , 'h3g313', 'e6e312', 'f6f311', 'g6g311', 'h3g213', 'a7a311', 'b7d714', , 'h3g313', 'e7e312',
-        'f7f311', 'g7g311', 'h3g213', 'a8a311', 'b8d814', , 'h3g313', 'e8e312', 'f8f311', 'g8g311', 'h3g213', 'a1a312', 'b1b312', , 'd1d58', 'a4b512',
-        'f1f312', 'g1g311', 'h1h311', , , , , , , , , 'a3g311', 'a4b411', , 'd3d58', 'a4b511', 'a4b511', 'a4b511', 'a4b511', , 'b4d412', , 'a4b45', 'e4d412',
-        'f4f312', 'g4g311', 'h4h311', 'a5d58', 'b5d58', , 'a4b45', 'e5d58', 'f5d58', 'g5d58', 'h5d58', 'a6d68', 'b6d68', , 'a4b45', 'e6d68', 'f6d68',
-        'g6d68', 'h6d68', 'a7d78', 'b7d78', , 'a4b45', 'e7d78', 'f7d78', 'g7d78', 'h7d78', 'a8d88', 'b8d88', , 'a4b45', 'e8d88', 'f8d88', 'g8d88',
-        'h8d88', 'a1a311', 'b1b311', , 'd1d45', 'b4c48', 'b4c410', 'b4c411', 'b4c411', , , , , , , , , 'a3c310', 'b3c310', , 'd3d45', 'b4c48', 'b4c510',
-        'b4c410', 'b4c410', 'a4a311', , , 'd4d55', 'e4d45', 'f4d45', 'g4d45', 'h4d45', 'a5d55', 'b5d55', , 'd5d65', 'e5d55', 'f5d55', 'g5d55', 'h5d55',
-        'a6d65', 'b6d65', , 'd6d75', 'e6d65', 'f6d65', 'g6d65', 'h6d65', 'a7d75', 'b7d75', , 'd7d85', 'e7d75', 'f7d75', 'g7d75', 'h7d75', 'a8d85',
-        'b8d85', , 'd8d75', 'e8d85', 'f8d85', 'g8d85', 'h8d85', 'a1a27', 'b1b58', , 'd1d36', 'e1e26', 'f1f26', 'g1g27', 'h1h27', , , , , , , , , 'a3d36',
-        'b3d36', , 'd3d46', 'e3e26', 'f3f26', 'g3d36', 'h3d36', 'a4a27', 'b4b58', , 'c4b45', 'e4e26', 'f4f26', 'g4d46', 'h4d46', 'a5d56', 'b5d56',
-        'c5d56', 'c4b45', 'e5e26', 'f5f26', 'g5d56', 'h5d56', 'a6d66', 'b6d66', 'c6d66', 'c4b45', 'e6e26', 'f6f26', 'g6d66', 'h6d66', 'a7d76', 'b7d76',
-        'c7d76', 'c4b45', 'e7e26', 'f7f26', 'g7d76', 'h7d76', 'a8d86', 'b8d86', 'c8d86', 'c4b45', 'e8e26', 'f8f26', 'g8d86', 'h8d86', 'a1a38', 'b1b48',
-        ,
-        'd1d38', 'd4c48', 'f1f38', 'g1g38', 'h1h38', , , , , , , , , 'a3d38', 'b3b48', , 'd4c46', 'd4c48', 'f3f48', 'g3g48', 'h3h48', 'a4b48', 'b4b58',
-        ,
-        , 'd4e38', 'd4e38', 'd4e38', 'd4e38', 'a5b58', 'b5b68', , 'd4c46', 'd4c48', 'd4c48', 'd4c48', 'd4c48', 'a6b68', 'b6b78', , 'd4c46', 'd4c48',
-        'd4c48', 'd4c48', 'd4c48', 'a7b78', 'b7b88', , 'd4c46', 'd4c48', 'd4c48', 'd4c48', 'd4c48', 'a8b88', 'b8b78', , 'd4c46', 'd4c48', 'd4c48',
-        'd4c48', 'd4c48', 'a1a310', 'b1b410', , 'd1d38', 'e1e39', 'e4e39', 'e4e39', 'e4e39', , , , , , , , , 'a3d38', 'b3d38', , 'e4e37', 'e3d38', 'e4d48',
-        'e4d48', 'e4d48', 'a4c49', 'e4d48', , 'd4d38', , 'e4e38', 'e4e38', 'e4e38', 'a5c59', 'e4d48', , 'd5d38', 'e4e39', 'e4e39', 'e4e39', 'e4e39',
-        'a6c69', 'e4d48', , 'd6d38', 'e4e39', 'e4e39', 'e4e39', 'e4e39', 'a7c79', 'e4d48', , 'd7d38', 'e4e39', 'e4e39', 'e4e39', 'e4e39', 'a8c89',
-        'e4d48', , 'd8d38', 'e4e39', 'e4e39', 'e4e39', 'e4e39', 'a1a310', 'b1b411', , 'd1d410', 'e1e39', 'f4e39', 'f4e39', 'f4e39', , , , , , , , , 'f4e38',
-        'b3e39', , 'f4e37', 'f4f38', 'f3e39', 'f4e39', 'f4e39', 'f4e39', 'f4e39', , 'f4f39', 'f4e38', , 'f4e38', 'f4e38', 'a5a310', 'b5d511', , 'f4e39',
-        'e5e39', 'f4e39', 'f4e39', 'f4e39', 'a6a310', 'b6e611', , 'f4e39', 'e6e39', 'f4e39', 'f4e39', 'f4e39', 'a7a310', 'b7e711', , 'f4e39', 'e7e39',
-        'f4e39', 'f4e39', 'f4e39', 'a8a310', 'b8e811', , 'f4e39', 'e8e39', 'f4e39', 'f4e39', 'f4e39', 'a1a310', 'b1b412', , 'd1d412', 'e1e39', 'f1f311',
-        'g1g311', 'g4f311', , , , , , , , , 'a3e39', 'b3e39', , 'd3e39', 'g4f38', 'f3e39', 'g3e39', 'h3e39', 'a4a310', 'b4e411', , 'g4f39', 'e4e39', 'g4f310',
-        ,
-        'g4f310', 'a5a310', 'b5d512', , 'g4f311', 'e5e39', 'f5f411', 'g4f311', 'g4f311', 'a6a310', 'b6b412', , 'd6d512', 'e6e39', 'f6f411', 'g4f311',
-        'g4f311', 'a7a310', 'b7b412', , 'd7d512', 'e7e39', 'f7f411', 'g4f311', 'g4f311', 'a8a310', 'b8b412', , 'd8d512', 'e8e39', 'f8f411', 'g4f311',
-        'g4f311', 'a1a311', 'b1b414', , 'd1d414', 'e1e312', 'f1f311', 'g1g312', 'h1h312', , , , , , , , , 'h4g310', 'b3f311', , 'd3f311', 'h4g39', 'h4g39',
-        'g3f311', 'h3f311', 'a4a311', 'h4g312', , 'h4g312', 'h4g311', 'f4f311', 'h4g311', , 'a5a311', 'b5e514', , 'h4g312', 'e5e312', 'f5f311', 'g5g312',
-        'h4g313', 'a6a311', 'b6f614', , 'h4g313', 'e6e312', 'f6f311', 'g6g312', 'h4g313', 'a7a311', 'b7d714', , 'h4g313', 'e7e312', 'f7f311', 'g7g312',
-        'h4g313', 'a8a311', 'b8d814', , 'h4g313', 'e8e312', 'f8f311', 'g8g312', 'h4g313', 'a1a312', 'b1b414', , 'd1d58', 'a5b612', 'f1f312', 'g1g312',
-        'h1h312', , , , , , , , , 'a5b611', 'a5b411', , 'd3d58', 'a5b511', 'a5b511', 'a5b611', 'a5b611', 'a4d411', 'b4d411', , 'a5b45', 'e4d411', 'f4d411',
-        'g4d411', 'h4d411', , 'b5d58', , 'a5b45', 'e5d58', 'f5d58', 'g5d58', 'h5d58', 'a6d68', 'b6d68', , 'a5b45', 'e6d68', 'f6d68', 'g6d68', 'h6d68',
-        'a7d78', 'b7d78', , 'a5b45', 'e7d78', 'f7d78', 'g7d78', 'h7d78', 'a8d88', 'b8d88', , 'a5b45', 'e8d88', 'f8d88', 'g8d88', 'h8d88', 'a1a311',
-        'b1e112', , 'd1d48', 'b5c48', 'b5c410', 'b5c411', 'b5c411', , , , , , , , , 'b5c410', 'b5c410', , 'b5c46', 'b5c48', 'b5c510', 'b5c410', 'b5c410',
-        'a4d48', 'b4d48', , 'b5b45', 'b5c48', 'b5c48', 'b5c48', 'b5c48', 'b5c48', , , 'b5b45', 'b5c48', 'b5c48', 'b5c48', 'b5c48', 'a6d68', 'b5c48',
-        ,
-        'b5b45', 'b5c48', 'b5c48', 'b5c48', 'b5c48', 'a7d78', 'b5c48', , 'b5b45', 'b5c48', 'b5c48', 'b5c48', 'b5c48', 'a8d88', 'b5c48', , 'b5b45',
-        'b5c48', 'b5c48', 'b5c48', 'b5c48', 'a1a610', 'b1b610', , 'd1d58', 'c5c48', 'c5d49', 'c5d49', 'c5d49', , , , , , , , , 'c5d48', 'b3b610', , 'c5c46',
-        'c5c48', 'c5d48', 'c5d48', 'c5d48', 'a4d49', 'c5d48', , 'c5b45', 'c5d48', 'c5d48', 'c5d48', 'c5d48', 'c5c48', 'c5d48', , 'c5b45', 'c5c48',
-        'c5c48', 'c5c48', 'c5c48', 'a6d68', 'b6d68', 'c5c48', 'c5b45', 'c5c48', 'c5c48', 'c5c48', 'c5c48', 'a7d78', 'b7d78', 'c5c48', 'c5b45', 'c5c48',
-        'c5c48', 'c5c48', 'c5c48', 'a8d88', 'b8d88', 'c5c48', 'c5b45', 'c5c48', 'c5c48', 'c5c48', 'c5c48', 'a1a310', 'b1b411', , 'd1d49', 'd5c48',
-        'd5d49', 'd5d49', 'd5d49', , , , , , , , , 'd5d48', 'b3e310', , 'd5c46', 'd5c48', 'd5d48', 'd5d48', 'd5d48', 'a4d49', 'd5d48', , 'd5c46', 'd5d48',
-        'd5d48', 'd5d48', 'd5d48', 'd5c48', 'd5d48', , , 'd5c48', 'd5c48', 'd5c48', 'd5c48', 'd5c48', 'd5d48', , 'd5c46', 'd5c48', 'd5c48', 'd5c48',
-        'd5c48', 'd5c48', 'd5d48', , 'd5c46', 'd5c48', 'd5c48', 'd5c48', 'd5c48', 'd5c48', 'd5d48', , 'd5c46', 'd5c48', 'd5c48', 'd5c48', 'd5c48',
-        'a1a310', 'b1b412', , 'd1d410', 'e1e310', 'e5d49', 'e5d49', 'e5d49', , , , , , , , , 'e5d48', 'b3e310', , 'e5e48', 'e5f49', 'e5d48', 'e5d48', 'e5d48',
-        'e5d49', 'e5d48', , 'e5e49', 'e5d48', 'e5d48', 'e5d48', 'e5d48', 'e5d49', 'e5d48', , 'e5d69', , 'e5d49', 'e5d49', 'e5d49', 'e5d49', 'e5d48',
-        ,
-        'd6d410', 'e5d49', 'e5d49', 'e5d49', 'e5d49', 'e5d49', 'e5d48', , 'd7d410', 'e5d49', 'e5d49', 'e5d49', 'e5d49', 'e5d49', 'e5d48', , 'd8d410',
-        'e5d49', 'e5d49', 'e5d49', 'e5d49', 'a1a310', 'b1b412', , 'd1d410', 'e1e310', 'f1f311', 'g1g310', 'h1h310', , , , , , , , , 'a3e310', 'b3e310',
-        ,
-        'f5e48', 'f5g49', 'f3g310', 'f5f410', 'f5f410', 'a4d410', 'b4d410', , 'f5e49', 'e4e310', 'f4d410', 'f5e410', 'f5e410', 'a5a310', 'f5e411',
-        ,
-        'd5d410', 'e5e310', , 'g5g310', 'h5h310', 'a6a310', 'f5e411', , 'd6d410', 'e6e310', 'f5e411', 'g6g310', 'h6h310', 'a7a310', 'f5e411', ,
-        'd7d410', 'e7e310', 'f5e411', 'g7g310', 'h7h310', 'a8a310', 'f5e411', , 'd8d410', 'e8e310', 'f5e411', 'g8g310', 'h8h310', 'a1a311', 'b1b412',
-        ,
-        'd1d412', 'e1e310', 'f1f311', 'g1g311', 'h1h311', , , , , , , , , 'a3e310', 'b3e310', , 'd3e310', 'g5g49', 'f3e310', 'g3e310', 'g5f410', 'a4e411',
-        'b4e411', , 'g5f410', 'e4e310', 'f4f311', 'g4g311', 'g5g411', 'a5a311', 'b5d512', , 'g5f411', 'e5e310', 'f5f311', , 'h5h311', 'a6a311', 'b6b412',
-        ,
-        'd6d512', 'e6e310', 'f6f311', 'g5f413', 'h6h311', 'a7a311', 'b7b412', , 'd7d512', 'e7e310', 'f7f311', 'g5f413', 'h7h311', 'a8a311', 'b8b412',
-        ,
-        'd8d512', 'e8e310', 'f8f311', 'g5f413', 'h8h311', 'a1a312', 'b1b414', , 'd1d414', 'e1e313', 'f1f311', 'g1g312', 'h1h312', , , , , , , , , 'h5g410',
-        'b3f311', , 'd3f311', 'h5g49', 'h5h411', 'g3f311', 'h3f311', 'a4a312', 'h5g412', , 'h5g412', 'h5g411', 'f4f311', 'g4g312', 'h5g411', 'a5a312',
-        'b5e514', , 'h5g412', 'e5e313', 'f5f311', 'g5g312', , 'a6a312', 'b6f614', , 'h5g413', 'e6e313', 'f6f311', 'g6g312', 'h5g414', 'a7a312', 'b7d714',
-        ,
-        'h5g413', 'e7e313', 'f7f311', 'g7g312', 'h5g414', 'a8a312', 'b8d814', , 'h5g413', 'e8e313', 'f8f311', 'g8g312', 'h5g414', 'a1a312', 'b1b414',
-        ,
-        'd1d59', 'a6b612', 'f1f313', 'g1g312', 'h1h312', , , , , , , , , 'a6b611', 'b3g312', , 'd3d59', 'a6b511', 'a6b511', 'a6b611', 'a6b611', 'a4d411',
-        'b4d411', , 'a6b58', 'e4d411', 'f4d411', 'g4d411', 'h4d411', 'a5d59', 'b5d59', , 'a6b58', 'e5d59', 'f5d59', 'g5d59', 'h5d59', , 'b6d69', ,
-        'a6b58', 'e6d69', 'f6d69', 'g6d69', 'h6d69', 'a7d79', 'b7d79', , 'a6b58', 'e7d79', 'f7d79', 'g7d79', 'h7d79', 'a8d89', 'b8d89', , 'a6b58',
-        'e8d89', 'f8d89', 'g8d89', 'h8d89', 'a1a311', 'b1e112', , 'd1d49', 'b6c511', 'b6c512', 'g1g311', 'h1h311', , , , , , , , , 'a3g311', 'b3g311',
-        ,
-        'd3d49', 'b6c510', 'b6c510', 'b6c611', 'b6c611', 'a4d49', 'b4d49', , 'b6b58', 'e4d49', 'f4d49', 'g4d49', 'h4d49', 'a5d59', 'b5d59', , 'b6c58',
-        'e5d59', 'f5d59', 'g5d59', 'h5d59', 'b6c510', , , 'b6c58', 'e6d69', 'f6d69', 'g6d69', 'h6d69', 'a7d79', 'b7d79', , 'b6c58', 'e7d79', 'f7d79',
-        'g7d79', 'h7d79', 'a8d89', 'b8d89', , 'b6c58', 'e8d89', 'f8d89', 'g8d89', 'h8d89', 'a1a311', 'b1e112', , 'd1d49', 'c6c511', 'c6d512', 'c6d511',
-        'c6d511', , , , , , , , , 'c6d510', 'b3g311', , 'd3d49', 'c6d510', 'c6d510', 'c6d510', 'c6d510', 'a4d49', 'b4d49', , 'c6b58', 'e4d49', 'f4d49',
-        'g4d49', 'h4d49', 'a5d59', 'b5d59', , 'c6c58', 'e5d59', 'f5d59', 'g5d59', 'h5d59', 'c6c510', 'c6c510', , 'c6c58', 'e6d69', 'f6d69', 'g6d69',
-        'h6d69', 'a7d79', 'b7d79', 'c7d79', 'c6c58', 'e7d79', 'f7d79', 'g7d79', 'h7d79', 'a8d89', 'b8d89', 'c8d89', 'c6c58', 'e8d89', 'f8d89', 'g8d89',
-        'h8d89', 'a1a311', 'b1b412', , 'd1d59', 'd6c511', 'd6e512', 'd6d511', 'd6d511', , , , , , , , , 'd6e510', 'b3g311', , 'd3d59', 'd6e510', 'd6e510',
-        'd6e510', 'd6e510', 'a4d410', 'b4d410', , 'd4d59', 'd6c510', 'f4d410', 'g4d410', 'h4d410', 'a5d59', 'b5d59', , 'd6c58', 'e5d59', 'f5d59',
-        'g5d59', 'h5d59', 'd6c510', 'd6c510', , , 'd6c510', 'd6c510', 'd6c510', 'd6c510', 'd6c510', 'd6c510', , 'd6c58', 'd6c510', 'd6c510', 'd6c510',
-        'd6c510', 'd6c510', 'd6c510', , 'd6c58', 'd6c510', 'd6c510', 'd6c510', 'd6c510', 'e6d511', 'b1b413', , 'd1d410', 'e1e312', 'e6e512', 'e6d511',
-        'e6d511', , , , , , , , , 'e6f510', 'b3g311', , 'd3d410', 'e6f510', 'e6e510', 'e6f510', 'e6f510', 'a4d410', 'b4d410', , 'e6d59', 'e4d410', 'f4d410',
-        'g4d410', 'h4d410', 'a5d511', 'b5d511', , 'e6d69', 'e5d511', 'f5d511', 'e6d511', 'e6d511', 'e6d511', 'b6d612', , 'd6d410', , 'e6d512', 'e6d511',
-        'e6d511', 'e6d511', 'b7d712', , 'd7d410', 'e6d511', 'e6e512', 'e6d511', 'e6d511', 'e6d511', 'b8d812', , 'd8d410', 'e6d511', 'e6e512', 'e6d511',
-        'e6d511', 'a1a312', 'b1b413', , 'd1d411', 'e1e312', 'f1f312', 'g1g311', 'h1h311', , , , , , , , , 'f6f510', 'b3g311', , 'd3d411', 'f6g510', 'f6e510',
-        'f6f510', 'f6f510', 'a4d411', 'b4d411', , 'f6f510', 'e4d411', 'f4d411', 'g4g311', 'h4h311', 'a5d512', 'b5d512', , 'd5d411', 'e5e412', 'f5f312',
-        'g5g311', 'h5h311', 'a6a312', 'b6b713', , 'd6d411', 'e6e412', , 'g6g311', 'h6h311', 'a7a312', 'f6e512', , 'd7d411', 'e7e412', 'f6e512', 'g7g311',
-        'h7h311', 'a8a312', 'f6e512', , 'd8d411', 'e8e412', 'f6e512', 'g8g311', 'h8h311', 'a1a312', 'b1b413', , 'd1d413', 'e1e312', 'f1f312', 'g1g312',
-        'h1h312', , , , , , , , , 'g6f510', 'b3e312', , 'd3e312', 'g6g510', 'g6h511', 'g6f510', 'g6f510', 'a4e412', 'b4e412', , 'g6f510', 'g6g511', 'f4f312',
-        'g4g312', 'g6f512', 'a5a312', 'b5d513', , 'g6g512', 'e5e412', 'f5f312', 'g5g312', 'h5h312', 'a6a312', 'b6d613', , 'g6f512', 'e6e412', 'f6f312',
-        ,
-        'h6h312', 'a7a312', 'b7d713', , 'g6f512', 'e7e412', 'f7f312', 'g6f513', 'h7h312', 'a8a312', 'b8d813', , 'g6f512', 'e8e412', 'f8f312', 'g6f513',
-        'h8h312', 'a1a312', 'b1b415', , 'd1d714', 'e1e313', 'f1f312', 'g1g312', 'h1h312', , , , , , , , , 'h6g511', 'b3f312', , 'd3f312', 'h6g510', 'h6h511',
-        'h6g511', 'h6g511', 'a4a312', 'h6g512', , 'h6g512', 'h6g511', 'f4f312', 'g4g312', 'h4h312', 'a5a312', 'b5e514', , 'h6g512', 'e5e313', 'f5f312',
-        'g5g312', 'h5h312', 'a6a312', 'b6b715', , 'h6g513', 'e6e313', 'f6f312', 'g6g312', , 'a7a312', 'b7d714', , 'h6g513', 'e7e313', 'f7f312', 'g7g312',
-        'h6g514', 'a8a312', 'b8d814', , 'h6g513', 'e8e313', 'f8f312', 'g8g312', 'h6g514', 'a1a313', 'b1e114', , 'd1d511', 'a7b612', 'f1f313', 'g1g313',
-        'h1h313', , , , , , , , , 'a7b611', 'b3e313', , 'd3d511', 'a7b612', 'a7b713', 'a7b611', 'a7b611', 'a4d412', 'b4d412', , 'a7b69', 'e4d412', 'f4d412',
-        'g4d412', 'h4d412', 'a5d511', 'b5d511', , 'a7b69', 'a7b611', 'f5d511', 'g5d511', 'h5d511', 'a6d611', 'b6d611', , 'a7b69', 'a7b611', 'f6d611',
-        'g6d611', 'h6d611', , 'b7d711', , 'a7b69', 'a7b611', 'f7d711', 'g7d711', 'h7d711', 'a8d811', 'b8d811', , 'a7b69', 'a7b611', 'f8d811', 'g8d811',
-        'h8d811', 'a1a313', 'b1b414', , 'd1d511', 'b7c612', 'b7c613', 'b7c613', 'h1h312', , , , , , , , , 'b7c611', 'b3h312', , 'd3d511', 'b7c612', 'b7c612',
-        'b7c611', 'b7c611', 'a4d412', 'b4d412', , 'b7c69', 'b7c611', 'f4d412', 'g4d412', 'h4h312', 'a5d511', 'b5d511', , 'b7c69', 'b7c611', 'f5d511',
-        'g5d511', 'h5d511', 'a6d611', 'b6d611', , 'b7c69', 'b7c611', 'f6d611', 'g6d611', 'h6d611', 'a7a313', , , 'b7c69', 'b7c611', 'f7d711', 'g7d711',
-        'h7d711', 'a8d811', 'b8d811', , 'b7c69', 'b7c611', 'f8d811', 'g8d811', 'h8d811', 'a1a313', 'b1b414', , 'd1d511', 'c7d612', 'c7d613', 'c7d613',
-        'h1h312', , , , , , , , , 'c7d611', 'b3h312', , 'd3d511', 'c7d612', 'c7d612', 'c7d611', 'c7d611', 'a4d412', 'b4d412', , 'c7c69', 'c7d611', 'c7d612',
-        'c7d612', 'c7d612', 'a5d511', 'b5d511', , 'c7d69', 'c7d611', 'f5d511', 'g5d511', 'h5d511', 'a6d611', 'b6d611', , 'c7c69', 'c7d611', 'f6d611',
-        'g6d611', 'h6d611', 'a7a413', 'c7d613', , 'c7c69', 'c7d611', 'f7d711', 'g7d711', 'h7d711', 'a8d811', 'b8d811', 'c8d811', 'c7c69', 'c7d611',
-        'f8d811', 'g8d811', 'h8d811', 'a1a313', 'b1b414', , 'd1d511', 'd7d612', 'd7e613', 'd7e613', 'h1h312', , , , , , , , , 'd7d611', 'b3h312', , 'd3d511',
-        'd7e612', 'd7e612', 'd7e611', 'd7e611', 'a4d412', 'b4d412', , 'd7c69', 'd7d611', 'd7e612', 'd7e612', 'd7e612', 'a5d511', 'b5d511', , 'd7d69',
-        'd7d611', 'f5d511', 'g5d511', 'h5d511', 'a6d611', 'b6d611', , 'd7c69', 'd7d611', 'f6d611', 'g6d611', 'h6d611', 'a7a413', 'd7e613', , , 'd7d611',
-        'd7e613', 'd7e613', 'h7h312', 'a8d813', 'b8d813', , 'd7c69', 'd7d611', 'd7e613', 'd7e613', 'h8h312', 'a1a313', 'b1b414', , 'd1d511', 'e7d612',
-        'e7e613', 'e7f613', 'h1h312', , , , , , , , , 'e7d611', 'b3h312', , 'd3d511', 'e3h312', 'e7f612', 'e7f611', 'e7f611', 'a4d412', 'b4d412', , 'e7e610',
-        'e7d611', 'e7e612', 'e7e612', 'e7e612', 'a5d511', 'b5d511', , 'e7d69', 'e5d511', 'f5d511', 'g5d511', 'h5d511', 'a6d612', 'b6d612', , 'd6d511',
-        'e7d611', 'f6d612', 'g6d612', 'h6h312', 'a7d712', 'b7d712', , 'd7d511', , 'e7f613', 'e7f613', 'h7h312', 'a8d812', 'b8d812', , 'd8d511', 'e7d611',
-        'f8d812', 'g8d812', 'h8h312', 'a1a313', 'b1b414', , 'd1d512', 'e1e313', 'f1f313', 'f7f613', 'h1h312', , , , , , , , , 'a3h312', 'b3h312', , 'd3d512',
-        'e3h312', 'f3h312', 'f7f611', 'f7f611', 'f7e612', 'b4d413', , 'f7e610', 'f7g612', 'f7e612', 'f7e612', 'f7e612', 'a5d512', 'b5d512', , 'f7e611',
-        'e5d512', 'f5d512', 'g5d512', 'h5h312', 'a6d613', 'b6d613', , 'd6d512', 'e6e513', 'f6f313', 'f7f613', 'h6h312', 'a7d713', 'b7d713', , 'd7d512',
-        'f7e612', , 'f7f613', 'h7h312', 'a8d813', 'b8d813', , 'd8d512', 'f7e612', 'f7f613', 'f7f613', 'h8h312', 'a1a313', 'b1b415', , 'd1d513', 'e1e313',
-        'f1f313', 'g1g313', 'h1h312', , , , , , , , , 'a3h312', 'b3h312', , 'd3h312', 'e3h312', 'f3h312', 'g7f611', 'g7f611', 'a4a313', 'g7g613', , 'g7f611',
-        'g7g612', 'f4f313', 'g4g313', 'h4h312', 'a5d513', 'b5d513', , 'g7f612', 'e5e313', 'f5f313', 'g5g313', 'h5h312', 'a6a313', 'b6d614', , 'd6d813',
-        'e6e313', 'f6f313', 'g6g313', 'h6h312', 'a7a313', 'g7f613', , 'd7d813', 'e7e313', 'f7f313', , 'h7h312', 'a8d813', 'b8d813', , 'd8d513', 'e8e313',
-        'f8f313', 'g7f613', 'h8h312', 'a1a314', 'b1b415', , 'd1d714', 'e1e314', 'f1f314', 'g1g313', 'h1h312', , , , , , , , , 'a3h312', 'b3h312', , 'd3h312',
-        'e3h312', 'f3h312', 'g3h312', 'h7h612', 'h7g613', 'h7g613', , 'h7g613', 'h7g612', 'h7g613', 'g4g313', 'h4h312', 'a5e514', 'b5e514', , 'h7g613',
-        'h7g613', 'f5f414', 'g5g313', 'h5h312', 'a6a414', 'b6b815', , 'h7g613', 'e6e514', 'f6f414', 'g6g313', 'h6h312', 'a7d714', 'b7d714', , 'h7g613',
-        'e7e514', 'f7f414', 'g7g313', , 'a8d814', 'b8d814', , 'h7g613', 'e8e514', 'f8f414', 'g8g313', 'h7g614', 'a1a314', 'b1e115', , 'd1d512', 'a8b714',
-        'f1f314', 'g1g314', 'h1h313', , , , , , , , , 'a3h313', 'b3h313', , 'd3d512', 'a8b713', 'a8b713', 'a8b713', 'a8b712', 'a4d414', 'a8b714', , 'a8b712',
-        'a8b714', 'f4f314', 'a8b714', 'h4h313', 'a5d512', 'b5d512', , 'a8b711', 'e5d512', 'f5d512', 'g5d512', 'h5d512', 'a6d612', 'b6d612', , 'a8b711',
-        'e6d612', 'f6d612', 'g6d612', 'h6d612', 'a7d712', 'b7d712', , 'a8b711', 'e7d712', 'f7d712', 'g7d712', 'h7d712', , 'b8d812', , 'a8b711', 'e8d812',
-        'f8d812', 'g8d812', 'h8d812', 'a1a314', 'b1b415', , 'd1d512', 'b8c714', 'f1f314', 'b8c714', 'h1h313', , , , , , , , , 'a3h313', 'b3h313', , 'd3d512',
-        'b8c713', 'b8c713', 'b8c713', 'b8c712', 'b8c713', 'b4d414', , 'b8c712', 'b8c714', 'b8c714', 'b8c713', 'b8c713', 'a5d512', 'b5d512', , 'b8c711',
-        'e5d512', 'f5d512', 'g5d512', 'h5d512', 'a6d612', 'b6d612', , 'b8c711', 'e6d612', 'f6d612', 'g6d612', 'h6d612', 'a7d712', 'b7d712', , 'b8c711',
-        'e7d712', 'f7d712', 'g7d712', 'h7d712', 'a8a314', , , 'b8c711', 'e8d812', 'f8d812', 'g8d812', 'h8d812', 'a1a314', 'b1b415', , 'd1d512', 'c8d714',
-        'f1f314', 'c8d714', 'h1h313', , , , , , , , , 'a3h313', 'b3h313', , 'd3d512', 'c8d713', 'c8d713', 'c8d713', 'c8d712', 'c8d713', 'b4d414', , 'c8d712',
-        'c8d714', 'c8d714', 'c8d713', 'c8d713', 'a5d512', 'b5d512', , 'c8d711', 'e5d512', 'f5d512', 'g5d512', 'h5d512', 'a6d612', 'b6d612', , 'c8d711',
-        'e6d612', 'f6d612', 'g6d612', 'h6d612', 'a7d712', 'b7d712', , 'c8c711', 'e7d712', 'f7d712', 'g7d712', 'h7d712', 'a8a314', 'c8d714', , 'c8c711',
-        'e8d812', 'f8d812', 'g8d812', 'h8d812', 'a1a314', 'b1b415', , 'd1d512', 'd8e714', 'f1f314', 'd8e714', 'h1h313', , , , , , , , , 'a3h313', 'b3h313',
-        ,
-        'd3d512', 'd8e713', 'd8e713', 'd8e713', 'd8e712', 'd8e713', 'b4d414', , 'd4d512', 'd8e714', 'd8e714', 'd8e713', 'd8e713', 'a5d512', 'b5d512',
-        ,
-        'd8e711', 'e5d512', 'f5d512', 'g5d512', 'h5d512', 'a6d612', 'b6d612', , 'd8d711', 'e6d612', 'f6d612', 'g6d612', 'h6d612', 'a7d712', 'b7d712',
-        ,
-        'd8c711', 'e7d712', 'f7d712', 'g7d712', 'h7d712', 'a8a314', 'd8e714', , , 'd8e713', 'd8e714', 'd8e714', 'h8h313', 'a1a314', 'b1b415', ,
-        'd1d512', 'e1e314', 'f1f314', 'e8f714', 'h1h313', , , , , , , , , 'a3h313', 'b3h313', , 'd3d512', 'e3h313', 'e8f713', 'e8f713', 'e8f712', 'e8e713',
-        'b4d414', , 'd4d512', 'e4e514', 'e8f714', 'e8f713', 'e8f713', 'a5d512', 'b5d512', , 'e8e711', 'e5d512', 'f5d512', 'g5d512', 'h5d512', 'a6d612',
-        'b6d612', , 'e8d711', 'e6d612', 'f6d612', 'g6d612', 'h6d612', 'a7d714', 'b7d714', , 'd7d612', 'e8d713', 'e8e714', 'e8f714', 'h7h313', 'a8d814',
-        'b8d814', , 'd8d612', , 'e8f714', 'e8f714', 'h8h313', 'a1a314', 'b1b415', , 'd1d512', 'e1e314', 'f1f314', 'f8f714', 'h1h313', , , , , , , , , 'a3h313',
-        'b3h313', , 'd3d512', 'e3h313', 'f3h313', 'f8g713', 'f8g712', 'f8e713', 'b4g414', , 'd4d512', 'e4e514', 'f4g414', 'f8f713', 'f8f713', 'a5d512',
-        'b5d512', , 'f8e711', 'e5d512', 'f5d512', 'g5d512', 'h5d512', 'a6d614', 'b6d614', , 'd6d512', 'f8e713', 'f6f314', 'f8f714', 'h6h313', 'a7d714',
-        'b7d714', , 'd7d512', 'e7e814', 'f7f314', 'f8f714', 'h7h313', 'a8d814', 'b8d814', , 'd8d512', 'f8e713', , 'f8f714', 'h8h313', 'a1a314', 'b1b415',
-        ,
-        'd1d513', 'e1e314', 'f1f314', 'g1g314', 'h1h313', , , , , , , , , 'a3h313', 'b3h313', , 'd3d513', 'e3h313', 'f3h313', 'g3h313', 'g8h712', 'a4g414',
-        'b4g414', , 'd4d513', 'e4e514', 'f4g414', 'g8f713', 'g8f713', 'a5d513', 'b5d513', , 'g8f712', 'e5d513', 'f5d513', 'g5d513', 'h5h313', 'a6d614',
-        'b6d614', , 'd6d513', 'e6e514', 'f6f314', 'g6g414', 'h6h313', 'a7d714', 'b7d714', , 'd7d513', 'e7e514', 'f7f314', 'g7g414', 'h7h313', 'a8d814',
-        'b8d814', , 'd8d513', 'e8e514', 'f8f314', , 'h8h313', 'a1a314', 'b1b416', , 'd1d515', 'e1e314', 'f1f314', 'g1g314', 'h1h313', , , , , , , , , 'a3h313',
-        'b3h313', , 'd3h313', 'e3h313', 'f3h313', 'g3h313', 'h8h712', 'a4a314', 'b4g415', , 'd4d515', 'e4e314', 'f4f314', 'g4g314', 'h4h313', 'a5a314',
-        'b5d515', , 'h8g713', 'e5e314', 'f5f314', 'g5g314', 'h5h313', 'a6a314', 'b6d615', , 'h8g714', 'e6e314', 'f6f314', 'g6g314', 'h6h313', 'a7a314',
-        'b7d715', , 'h8h714', 'e7e314', 'f7f314', 'g7g314', 'h7h313', 'a8a314', 'b8d815', , 'h8g713', 'e8e314', 'f8f314', 'g8g314', , , 'b1b311',
-        'c1c414', , 'e1e415', 'f1f312', 'g1g311', 'h1h311', , , , , , , , , 'a1b19', 'a1b19', 'a1b29', , 'e3g311', 'a1b211', 'a1b210', 'a1b210', 'a1b212',
-        'b4b311', 'a1b212', , 'a1b212', 'f4f312', 'g4g311', 'h4h311', 'a5a312', 'b5b311', 'c5c414', , 'a1a215', 'f5f312', 'g5g311', 'h5h311', 'a6a312',
-        'b6b311', 'c6c414', , 'a1b215', 'f6f312', 'g6g311', 'h6h311', 'a7a312', 'b7b311', 'c7c414', , 'a1b215', 'f7f312', 'g7g311', 'h7h311', 'a8a312',
-        'b8b311', 'c8c414', , 'a1a215', 'f8f312', 'g8g311', 'h8h311', 'a1a39', , 'c1c414', , 'e1e414', 'f1f311', 'g1g310', 'h1h310', , , , , , , , , 'a3b39',
-        'b3a39', 'b1b29', , 'e3b39', 'f3b39', 'g3b39', 'h3b39', 'a4a39', 'b4b39', 'b1b212', , 'b1b212', 'f4f311', 'g4g310', 'h4h310', 'a5a39', 'b5b39',
-        'c5h514', , 'e5h514', 'f5f311', 'g5g310', 'h5h310', 'a6a39', 'b6b39', 'c6h614', , 'e6h614', 'f6f311', 'g6g310', 'h6h310', 'a7a39', 'b7b39',
-        'c7h714', , 'e7h714', 'f7f311', 'g7g310', 'h7h310', 'a8a39', 'b8b39', 'c8h814', , 'e8h814', 'f8f311', 'g8g310', 'h8h310', , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a39', 'b1b39', 'c1c413', , 'e1e412', , 'g1g38', 'h1h38', , , , , , , , , 'a3f38',
-        'b3f38', 'c3f38', , 'f1f27', 'f1f28', 'f1f28', 'f1f28', 'a4a39', 'b4b39', 'f1f210', , 'f1f210', 'f4f38', 'g4g38', 'h4h38', 'a5a39', 'b5b39',
-        'c5c413', , 'e5e412', 'f5f38', 'g5g38', 'h5h38', 'a6a39', 'b6b39', 'c6c413', , 'e6e412', 'f6f38', 'g6g38', 'h6h38', 'a7a39', 'b7b39', 'c7c413',
-        ,
-        'e7e412', 'f7f38', 'g7g38', 'h7h38', 'a8a39', 'b8b39', 'c8c413', , 'e8e412', 'f8f38', 'g8g38', 'h8h38', 'a1a310', 'b1b310', 'c1c413', ,
-        'e1e413', 'f1f310', , 'h1h310', , , , , , , , , 'g1f19', 'g1f19', 'c3f310', , 'g1f27', 'g1f18', 'g1f18', 'g1f18', 'a4a310', 'b4b310', 'g1f210',
-        ,
-        'g1f210', 'f4f310', 'g1f210', 'g1f210', 'a5a310', 'b5b310', 'c5c413', , 'e5e413', 'f5f310', 'g5g310', 'h5h310', 'a6a310', 'b6b310', 'c6c413',
-        ,
-        'e6e413', 'f6f310', 'g6g310', 'h6h310', 'a7a310', 'b7b310', 'c7c413', , 'e7e413', 'f7f310', 'g7g310', 'h7h310', 'a8a310', 'b8b310', 'c8c413',
-        ,
-        'e8e413', 'f8f310', 'g8g310', 'h8h310', 'a1a311', 'b1b312', 'c1c414', , 'e1e413', 'f1f311', 'g1g310', , , , , , , , , , 'a3g310', 'b3g310', 'c3g310',
-        ,
-        'e3g310', 'f3g310', 'g3h310', 'h1g110', 'a4a311', 'b4b312', 'c4e413', , 'h1g211', 'f4f311', 'g4g310', 'h4h310', 'a5a311', 'b5b312', 'c5c414',
-        ,
-        'e5e413', 'f5f311', 'g5g310', 'h5h310', 'a6a311', 'b6b312', 'c6c414', , 'e6e413', 'f6f311', 'g6g310', 'h6h310', 'a7a311', 'b7b312', 'c7c414',
-        ,
-        'e7e413', 'f7f311', 'g7g310', 'h7h310', 'a8a311', 'b8b312', 'c8c414', , 'e8e413', 'f8f311', 'g8g310', 'h8h310', 'a2b313', 'b1b312', 'c1c413',
-        ,
-        'e1e414', 'f1f312', 'g1g311', 'h1h311', , , , , , , , , 'a2b19', 'a2b19', 'a2b39', , 'e3g311', 'a2b311', 'a2b310', 'a2b310', 'a2b312', 'a2b312',
-        'a2b312', , 'a2b312', 'f4f312', 'g4g311', 'h4h311', 'a5a312', 'b5b312', 'a2b313', , 'a2a314', 'f5f312', 'g5g311', 'h5h311', 'a6a312', 'b6b312',
-        'a2b313', , 'a2a314', 'f6f312', 'g6g311', 'h6h311', 'a7a312', 'b7b312', 'a2b313', , 'a2a314', 'f7f312', 'g7g311', 'h7h311', 'a8a312', 'b8b312',
-        'a2b313', , 'a2a314', 'f8f312', 'g8g311', 'h8h311', 'a1a310', 'b1g113', 'c1c39', , 'e1e412', 'f1f311', 'g1g310', 'h1h310', 'a2a310', , , ,
-        ,
-        , , , 'a3c39', 'b2b19', 'b2b39', , 'e3c39', 'f3c39', 'g3c39', 'h3c39', 'a4a310', 'b4b310', 'c4c39', , 'e4d411', 'f4f311', 'g4g310', 'h4h310',
-        'a5a310', 'b5b310', 'c5c39', , 'e5e412', 'f5f311', 'g5g310', 'h5h310', 'a6a310', 'b6b310', 'c6c39', , 'e6e412', 'f6f311', 'g6g310', 'h6h310',
-        'a7a310', 'b7b310', 'c7c39', , 'e7e412', 'f7f311', 'g7g310', 'h7h310', 'a8a310', 'b8b310', 'c8c39', , 'e8e412', 'f8f311', 'g8g310', 'h8h310',
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a39', 'b1b39', 'c1c410', , 'e1e37', 'f1g111', 'g1g38',
-        'h1h38', , , , , , , 'g2g38', 'h2h38', 'a3e37', 'b3e37', 'c3e37', , 'e3f38', 'f3e37', 'g3e37', 'h3e37', 'a4d49', 'b4d49', 'c4d49', , 'e4e37', 'f4f38',
-        'g4g38', 'h4h38', 'a5a39', 'b5b39', 'c5c410', , 'e5e37', 'f5f38', 'g5g38', 'h5h38', 'a6a39', 'b6b39', 'c6c410', , 'e6e37', 'f6f38', 'g6g38',
-        'h6h38', 'a7a39', 'b7b39', 'c7c410', , 'e7e37', 'f7f38', 'g7g38', 'h7h38', 'a8a39', 'b8b39', 'c8c410', , 'e8e37', 'f8f38', 'g8g38', 'h8h38',
-        'a1a310', 'b1b310', 'c1c413', , 'e1e411', 'f1f310', 'g2f211', 'h1h310', , , , , , , , 'h2h310', 'g2f19', 'g2f19', 'c3f310', , 'g2f27', 'g2f18',
-        'g2f18', 'g2f18', 'a4a310', 'b4b310', 'g2f210', , 'g2f210', 'f4f310', 'g2f210', 'g2f210', 'a5a310', 'b5b310', 'g2f312', , 'e5e411', 'f5f310',
-        'g5g310', 'h5h310', 'a6a310', 'b6b310', 'c6g613', , 'e6e411', 'f6f310', 'g6g310', 'h6h310', 'a7a310', 'b7b310', 'c7g713', , 'e7e411', 'f7f310',
-        'g7g310', 'h7h310', 'a8a310', 'b8b310', 'c8g813', , 'e8e411', 'f8f310', 'g8g310', 'h8h310', 'a1a311', 'b1b312', 'c1c414', , 'e1e414', 'f1f311',
-        'g1g310', 'h2g213', , , , , , , , , 'a3g310', 'b3g310', 'c3g310', , 'e3g310', 'f3g310', 'h2h110', 'h2h110', 'a4a311', 'b4b312', 'c4f413', , 'h2g211',
-        'f4f311', 'g4g310', 'h4h311', 'a5a311', 'b5b312', 'c5e514', , 'h2g213', 'f5f311', 'g5g310', 'h5h311', 'a6a311', 'b6b312', 'c6g614', , 'e6g614',
-        'f6f311', 'g6g310', 'h6h311', 'a7a311', 'b7b312', 'c7g714', , 'e7g714', 'f7f311', 'g7g310', 'h7h311', 'a8a311', 'b8b312', 'c8g814', , 'e8g814',
-        'f8f311', 'g8g310', 'h8h311', 'a3b313', 'b1b311', 'c1c413', , 'e1e414', 'f1f312', 'g1g312', 'h1h312', , , , , , , , , , 'a3b210', 'a3b39', , 'e3b311',
-        'a3b411', 'a3b310', 'a3b310', 'a3b312', 'b4b311', 'a3b412', , 'a3b312', 'f4f312', 'a3b312', 'a3b412', 'a3b313', 'b5b311', 'a3b413', , 'a3b410',
-        'f5f312', 'g5g312', 'h5h312', 'a3b313', 'b6b311', 'a3b413', , 'a3b410', 'f6f312', 'g6g312', 'h6h312', 'a3b313', 'b7b311', 'a3b413', , 'a3b410',
-        'f7f312', 'g7g312', 'h7h312', 'a3b313', 'b8b311', 'a3b413', , 'a3b410', 'f8f312', 'g8g312', 'h8h312', 'a1a412', 'b1g113', 'c1c39', , 'e1e412',
-        'f1f311', 'g1g310', 'h1h310', , , , , , , , , 'b3c410', , 'b3b29', , 'e3c39', 'f3c39', 'g3c39', 'h3c39', 'a4d411', 'b3c411', 'c4c39', , 'b3c47',
-        'b3c411', 'g4g310', 'h4h310', 'a5a412', 'b3c412', 'c5c39', , 'b3c47', 'f5f311', 'g5g310', 'h5h310', 'a6a412', 'b6b412', 'c6c39', , 'b3c47',
-        'f6f311', 'g6g310', 'h6h310', 'a7a412', 'b7b412', 'c7c39', , 'b3c47', 'f7f311', 'g7g310', 'h7h310', 'a8a412', 'b8b412', 'c8c39', , 'b3c47',
-        'f8f311', 'g8g310', 'h8h310', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a39', 'b1b39', 'c1c410',
-        ,
-        'e1e38', 'f1g111', 'g1g410', 'h1h410', , , , , , , , , 'a3e38', 'b3e38', 'c3e38', , 'f3f27', , 'f3f28', 'f3f28', 'a4d49', 'b4d49', 'f3e48', , 'e4e38',
-        'f3e49', 'f3e49', 'f3e49', 'a5a39', 'b5b39', 'f3e48', , 'e5e38', 'f5f410', 'g5g410', 'h5h410', 'a6a39', 'b6b39', 'f3e48', , 'e6e38', 'f6f410',
-        'g6g410', 'h6h410', 'a7a39', 'b7b39', 'f3e48', , 'e7e38', 'f7f410', 'g7g410', 'h7h410', 'a8a39', 'b8b39', 'f3e48', , 'e8e38', 'f8f410', 'g8g410',
-        'h8h410', 'a1a310', 'b1b310', 'c1c413', , 'e1e411', 'f1f310', 'g3f211', 'g3f211', , , , , , , , , 'g3f29', 'g3f29', 'c3f310', , 'g3f27', 'g3f28',
-        ,
-        'g3f28', 'a4a310', 'b4b310', 'g3f210', , 'g3f210', 'f4f310', 'g3f210', 'g3f210', 'a5a310', 'b5b310', 'g3f312', , 'e5e411', 'f5f310', 'g3f211',
-        'g3f211', 'a6a310', 'b6b310', 'c6f613', , 'e6e411', 'f6f310', 'g3f211', 'g3f211', 'a7a310', 'b7b310', 'c7f713', , 'e7e411', 'f7f310', 'g3f211',
-        'g3f211', 'a8a310', 'b8b310', 'c8f813', , 'e8e411', 'f8f310', 'g3f211', 'g3f211', 'a1a311', 'b1b312', 'c1c414', , 'e1e413', 'f1f311', 'g1g311',
-        'h3g213', , , , , , , , , 'h3g210', 'h3g210', 'c3f311', , 'e3f311', 'h3g210', 'h3h210', , 'a4a311', 'b4b312', 'c4e413', , 'h3g211', 'f4f311', 'g4g311',
-        'h3g212', 'a5a311', 'b5b312', 'c5e514', , 'e5e413', 'f5f311', 'g5g311', 'h3g213', 'a6a311', 'b6b312', 'c6c414', , 'e6e413', 'f6f311', 'g6g311',
-        'h3g213', 'a7a311', 'b7b312', 'c7d714', , 'e7e413', 'f7f311', 'g7g311', 'h3g213', 'a8a311', 'b8b312', 'c8d814', , 'e8e413', 'f8f311', 'g8g311',
-        'h3g213', 'a1a312', 'b1b312', 'c1c413', , 'e1e613', 'f1f312', 'g1g312', 'h1h312', , , , , , , , , 'a4b511', 'a4b511', 'a4b39', , 'e3f312', 'a4b411',
-        'a4b310', 'a4b310', , 'a4b312', 'a4b412', , 'a4b312', 'f4f312', 'a4b312', 'a4b412', 'a4b313', 'b5b312', 'a4b413', , 'a4b510', 'f5f312', 'g5g312',
-        'h5h312', 'a4b313', 'b6b312', 'a4b413', , 'a4b510', 'f6f312', 'g6g312', 'h6h312', 'a4b313', 'b7b312', 'a4b413', , 'a4b510', 'f7f312', 'g7g312',
-        'h7h312', 'a4b313', 'b8b312', 'a4b413', , 'a4b510', 'f8f312', 'g8g312', 'h8h312', 'a1a311', 'b1b311', 'c1c311', , 'e1e510', 'f1f311', 'g1g311',
-        'h1h311', , , , , , , , , 'b4c510', 'b4c410', 'b4b39', , 'e3e510', 'b4c410', 'b4c510', 'b4c510', 'a4a311', , 'c4d411', , 'b4c47', 'b4c411', 'b4c411',
-        'b4c411', 'a5e510', 'b5e510', 'c5e510', , 'b4c47', 'f5e510', 'g5e510', 'h5e510', 'a6e610', 'b6e610', 'c6e610', , 'b4c47', 'f6e610', 'g6e610',
-        'h6e610', 'a7e710', 'b7e710', 'c7e710', , 'b4c47', 'f7e710', 'g7e710', 'h7e710', 'a8e810', 'b8e810', 'c8e810', , 'b4c47', 'f8e810', 'g8e810',
-        'h8e810', 'a1a310', 'b1b310', 'c1c310', , 'e1e47', 'c4d49', 'c4d410', 'c4d410', , , , , , , , , 'a3d39', 'b3d39', 'c3d39', , 'e3e47', 'c4d49', 'g3d39',
-        'h3d39', 'a4a310', 'b4b310', , , 'e4e57', 'f4e47', 'g4e47', 'h4e47', 'a5e57', 'b5e57', 'c5e57', , 'e5e67', 'f5e57', 'g5e57', 'h5e57', 'a6e67',
-        'b6e67', 'c6e67', , 'e6e77', 'f6e67', 'g6e67', 'h6e67', 'a7e77', 'b7e77', 'c7e77', , 'e7e87', 'f7e77', 'g7e77', 'h7e77', 'a8e87', 'b8e87',
-        'c8e87', , 'e8e77', 'f8e87', 'g8e87', 'h8e87', 'a1a27', 'b1b27', 'c1c59', , 'e1e39', 'f1f27', 'g1g27', 'h1h27', , , , , , , , , 'a3a27', 'b3b27',
-        'c3c59', , 'd4e49', 'f3f27', 'g3g27', 'h3h27', 'a4a27', 'b4b27', 'd4e48', , 'd4c47', 'f4f27', 'g4g27', 'h4h27', 'a5a27', 'b5b27', 'd4e48',
-        'd5d69', 'd4c47', 'f5f27', 'g5g27', 'h5h27', 'a6a27', 'b6b27', 'd4e48', 'd6d79', 'd4c47', 'f6f27', 'g6g27', 'h6h27', 'a7a27', 'b7b27', 'd4e48',
-        'd7d89', 'd4c47', 'f7f27', 'g7g27', 'h7h27', 'a8a27', 'b8b27', 'd4e48', 'd8e89', 'd4c47', 'f8f27', 'g8g27', 'h8h27', 'a1a39', 'b1b39', 'c1c48',
-        ,
-        'e1e39', 'e4d49', 'g1g39', 'h1h39', , , , , , , , , 'a3b39', 'b3e39', 'c3c48', , 'e4f38', 'e4d49', 'g3g49', 'h3h49', 'a4c48', 'b4c48', 'c4c58',
-        ,
-        , 'e4d49', 'e4d49', 'e4d49', 'a5c58', 'b5c58', 'c5c68', , 'e5c58', 'f5c58', 'g5c58', 'h5c58', 'a6c68', 'b6c68', 'c6c78', , 'e6c68', 'f6c68',
-        'g6c68', 'h6c68', 'a7c78', 'b7c78', 'c7c88', , 'e7c78', 'f7c78', 'g7c78', 'h7c78', 'a8c88', 'b8c88', 'c8c78', , 'e8c88', 'f8c88', 'g8c88',
-        'h8c88', 'a1a310', 'b1b310', 'c1c411', , 'e1e39', 'f1f310', 'g1g310', 'h1h310', , , , , , , , , 'a3e39', 'b3e39', 'c3e39', , 'f4f38', 'f3e39', 'f4e49',
-        'f4e49', 'a4d410', 'b4d410', 'f4e48', , 'e4e39', , 'f4e49', 'f4e49', 'a5a310', 'b5b310', 'f4e48', , 'e5e39', 'f4f311', 'g5g310', 'h5h310',
-        'a6a310', 'b6b310', 'f4e48', , 'e6e39', 'f4f311', 'g6g310', 'h6h310', 'a7a310', 'b7b310', 'f4e48', , 'e7e39', 'f4f311', 'g7g310', 'h7h310',
-        'a8a310', 'b8b310', 'f4e48', , 'e8e39', 'f4f311', 'g8g310', 'h8h310', 'a1a311', 'b1b311', 'c1c413', , 'e1e411', 'f1f310', 'g1g311', 'g4f311',
-        ,
-        , , , , , , , 'g4f39', 'g4f39', 'c3f310', , 'g4f38', 'g4g310', 'g3f310', 'g4f410', 'g4f310', 'b4e411', 'g4f310', , 'g4f410', 'f4f310', , 'g4f310',
-        'a5a311', 'b5b311', 'c5d512', , 'e5e411', 'f5f310', 'g4f311', 'g4f311', 'a6a311', 'b6b311', 'c6d613', , 'e6e411', 'f6f310', 'g4f311', 'g4f311',
-        'a7a311', 'b7b311', 'c7d713', , 'e7e411', 'f7f310', 'g4f311', 'g4f311', 'a8a311', 'b8b311', 'c8d813', , 'e8e411', 'f8f310', 'g4f311', 'g4f311',
-        'a1a311', 'b1b312', 'c1c414', , 'e1e414', 'f1f311', 'g1g312', 'h1h312', , , , , , , , , 'h4g310', 'h4g310', 'c3f311', , 'e3f311', 'h4g310', 'g3f311',
-        'h3f311', 'a4a311', 'b4b312', 'c4f413', , 'h4g311', 'f4f311', 'g4g312', , 'a5a311', 'b5b312', 'c5e514', , 'h4g313', 'f5f311', 'g5g312', 'h4g313',
-        'a6a311', 'b6b312', 'c6g614', , 'e6g614', 'f6f311', 'g6g312', 'h4g313', 'a7a311', 'b7b312', 'c7d714', , 'e7g714', 'f7f311', 'g7g312', 'h4g313',
-        'a8a311', 'b8b312', 'c8d814', , 'e8g814', 'f8f311', 'g8g312', 'h4g313', 'a1a312', 'b1b312', 'c1c413', , 'e1e613', 'f1f313', 'g1g312', 'h1h312',
-        ,
-        , , , , , , , 'a5b511', 'a5b511', 'a5b411', , 'e3g312', 'a5b411', 'a5b511', 'a5b511', 'a4a312', 'b4b312', 'a5b412', , 'a5b613', 'a5b413', 'g4g312',
-        'a5b412', , 'b5b312', 'a5b413', , 'a5b510', 'f5f313', 'g5g312', 'h5h312', 'a6e613', 'b6b312', 'a5b413', , 'a5b510', 'f6f313', 'g6g312', 'h6h312',
-        'a7e713', 'b7b312', 'a5b413', , 'a5b510', 'f7f313', 'g7g312', 'h7h312', 'a8e813', 'b8b312', 'a5b413', , 'a5b510', 'f8f313', 'g8g312', 'h8h312',
-        'a1a311', 'b1b311', 'c1c413', , 'e1e510', 'f1f312', 'g1g311', 'h1h311', , , , , , , , , 'b5c510', 'b5c410', 'b5c410', , 'e3e510', 'b5c410', 'b5c510',
-        'b5c510', 'a4d411', 'b4d411', 'c4d411', , 'b5c47', 'b5c411', 'b5c411', 'b5c411', 'a5a311', , 'c5e510', , 'b5c47', 'f5e510', 'g5e510', 'h5e510',
-        'a6e610', 'b6e610', 'c6e610', , 'b5c47', 'f6e610', 'g6e610', 'h6e610', 'a7e710', 'b7e710', 'c7e710', , 'b5c47', 'f7e710', 'g7e710', 'h7e710',
-        'a8e810', 'b8e810', 'c8e810', , 'b5c47', 'f8e810', 'g8e810', 'h8e810', 'a1a310', 'c5d410', 'c1c412', , 'e1e410', 'c5d49', 'c5d410', 'c5d410',
-        ,
-        , , , , , , , 'a3g310', 'b3g310', 'c3g310', , 'c5d49', 'c5d49', 'c5d510', 'c5d510', 'a4e410', 'b4e410', 'c4e410', , 'c5c47', 'c5d49', 'c5d49',
-        'c5d49', 'c5d49', 'c5d49', , , 'c5c47', 'c5d49', 'c5d49', 'c5d49', 'c5d49', 'c5d49', 'c5d49', , 'c5c47', 'c5d49', 'c5d49', 'c5d49', 'c5d49',
-        'c5d49', 'c5d49', , 'c5c47', 'c5d49', 'c5d49', 'c5d49', 'c5d49', 'c5d49', 'c5d49', , 'c5c47', 'c5d49', 'c5d49', 'c5d49', 'a1a310', 'd5d410',
-        'c1c412', , 'e1e511', 'd5d49', 'd5d410', 'd5d410', , , , , , , , , 'd5e49', 'd5e49', 'c3g310', , 'd5e49', 'd5d49', 'd5e49', 'd5e49', 'a4a310', 'd5e410',
-        'd5e48', , 'd5c47', 'd5e49', 'd5e49', 'd5e49', 'd5d49', 'd5d49', 'd5e48', , 'd5c47', 'd5d49', 'd5d49', 'd5d49', 'd5d49', 'd5d49', 'd5e48',
-        'd5d49', 'd5c47', 'd5d49', 'd5d49', 'd5d49', 'd5d49', 'd5d49', 'd5e48', 'd5d49', 'd5c47', 'd5d49', 'd5d49', 'd5d49', 'd5d49', 'd5d49', 'd5e48',
-        'd5d49', 'd5c47', 'd5d49', 'd5d49', 'd5d49', 'a1a310', 'e5d410', 'c1c412', , 'e1e411', 'e5d49', 'e5d410', 'e5d410', , , , , , , , , 'e5e49', 'e5e49',
-        'c3g310', , 'e5f49', 'e5d49', 'e5e49', 'e5e49', 'a4a310', 'e5e410', 'e5e48', , 'e5d49', 'e5e49', 'e5e49', 'e5e49', 'e5d49', 'e5d49', 'e5e48',
-        ,
-        , 'e5d49', 'e5d49', 'e5d49', 'e5d49', 'e5d49', 'e5e48', , 'e5d49', 'e5d49', 'e5d49', 'e5d49', 'e5d49', 'e5d49', 'e5e48', , 'e5d49', 'e5d49',
-        'e5d49', 'e5d49', 'e5d49', 'e5d49', 'e5e48', , 'e5d49', 'e5d49', 'e5d49', 'e5d49', 'a1a311', 'b1b311', 'c1c412', , 'e1e411', 'f1f311', 'f5e411',
-        'f5e411', , , , , , , , , 'f5e49', 'f5e49', 'c3f311', , 'f5f49', 'f5g410', 'f5e49', 'f5e49', 'a4d410', 'b4d410', 'f5e48', , 'e4d410', 'f5e49', 'f5e49',
-        'f5e49', 'a5a311', 'b5b311', 'f5e48', , 'e5e411', , 'f5e411', 'f5e411', 'a6a311', 'b6b311', 'f5e48', , 'e6e411', 'f5e411', 'f5e411', 'f5e411',
-        'a7a311', 'b7b311', 'f5e48', , 'e7e411', 'f5e411', 'f5e411', 'f5e411', 'a8a311', 'b8b311', 'f5e48', , 'e8e411', 'f5e411', 'f5e411', 'f5e411',
-        'a1a311', 'b1b311', 'c1c414', , 'e1e411', 'f1f311', 'g1g311', 'h1h311', , , , , , , , , 'g5f410', 'g5f410', 'c3f311', , 'g5f49', 'g5g410', 'g5f410',
-        'g5f410', 'a4e411', 'b4e411', 'c4e411', , 'g5f410', 'f4f311', 'g4g311', 'g5f411', 'a5a311', 'b5b311', 'c5d512', , 'e5e411', 'f5f311', , 'h5h311',
-        'a6a311', 'b6b311', 'c6d613', , 'e6e411', 'f6f311', 'g5f413', 'h6h311', 'a7a311', 'b7b311', 'c7d713', , 'e7e411', 'f7f311', 'g5f413', 'h7h311',
-        'a8a311', 'b8b311', 'c8d813', , 'e8e411', 'f8f311', 'g5f413', 'h8h311', 'a1a312', 'b1b312', 'c1c414', , 'e1e414', 'f1f312', 'g1g312', 'h1h312',
-        ,
-        , , , , , , , 'h5h411', 'h5g411', 'c3f312', , 'e3f312', 'h5g410', 'h5g411', 'h5g411', 'a4a312', 'b4b312', 'c4f413', , 'h5g411', 'f4f312', 'g4g312',
-        'h4h312', 'a5a312', 'b5b312', 'c5e514', , 'h5g413', 'f5f312', 'g5g312', , 'a6a312', 'b6b312', 'c6c414', , 'e6e514', 'f6f312', 'g6g312', 'h5g414',
-        'a7a312', 'b7b312', 'c7d714', , 'e7e514', 'f7f312', 'g7g312', 'h5g414', 'a8a312', 'b8b312', 'c8d814', , 'e8e514', 'f8f312', 'g8g312', 'h5g414',
-        'a1a312', 'b1b313', 'c1c414', , 'e1e613', 'f1f313', 'g1g312', 'h1h312', , , , , , , , , 'a6b511', 'a6b511', 'c3g312', , 'e3g312', 'a6b512', 'a6b511',
-        'a6b511', 'a4a312', 'a6b613', 'a6b613', , 'a6b613', 'f4f313', 'g4g312', 'h4h312', 'a5a312', 'b5b313', 'a6b614', , 'a6b510', 'f5f313', 'g5g312',
-        'h5h312', , 'b6e613', 'c6e613', , 'a6b510', 'f6f313', 'g6g312', 'h6h312', 'a7e713', 'b7e713', 'c7e713', , 'a6b510', 'f7f313', 'g7g312', 'h7h312',
-        'a8e813', 'b8e813', 'c8e813', , 'a6b510', 'f8f313', 'g8g312', 'h8h312', 'a1a312', 'b1b312', 'c1c413', , 'e1e511', 'b6c513', 'g1g312', 'h1h312',
-        ,
-        , , , , , , , 'b6c510', 'b6c511', 'c3g312', , 'e3e511', 'b6c612', 'b6c510', 'b6c510', 'a4d412', 'b4d412', 'b6c512', , 'b6c510', 'b6c512', 'b6c512',
-        'b6c512', 'a5e511', 'b5e511', 'c5e511', , 'b6c510', 'f5e511', 'g5e511', 'h5e511', 'a6a312', , 'c6e611', , 'b6c510', 'f6e611', 'g6e611', 'h6e611',
-        'a7e711', 'b7e711', 'c7e711', , 'b6c510', 'f7e711', 'g7e711', 'h7e711', 'a8e811', 'b8e811', 'c8e811', , 'b6c510', 'f8e811', 'g8e811', 'h8e811',
-        'a1a311', 'b1b312', 'c1c413', , 'e1e411', 'f1f312', 'c6d512', 'h1h311', , , , , , , , , 'c6d510', 'b3h311', 'c3h311', , 'e3e411', 'c6d511', 'c6d510',
-        'c6d510', 'a4e411', 'b4e411', 'c4e411', , 'c6c510', 'f4e411', 'g4e411', 'h4h311', 'a5e511', 'b5e511', 'c5e511', , 'c6c510', 'f5e511', 'g5e511',
-        'h5h311', 'a6a311', 'b6b312', , , 'c6c510', 'f6e611', 'g6e611', 'h6h311', 'a7e711', 'b7e711', 'c7e711', , 'c6c510', 'f7e711', 'g7e711', 'h7h311',
-        'a8e811', 'b8e811', 'c8e811', , 'c6c510', 'f8e811', 'g8e811', 'h8h311', 'a1a311', 'b1b312', 'c1c413', , 'e1e411', 'f1f312', 'd6e512', 'h1h311',
-        ,
-        , , , , , , , 'd6e510', 'b3h311', 'c3h311', , 'e3e411', 'd6e511', 'd6e510', 'd6e510', 'a4e411', 'b4e411', 'c4e411', , 'd6c510', 'f4e411', 'g4e411',
-        'h4h311', 'a5e511', 'b5e511', 'c5e511', , 'd6c510', 'f5e511', 'g5e511', 'h5h311', 'a6a311', 'b6b412', 'd6d512', , 'd6c510', 'f6e611', 'g6e611',
-        'h6h311', 'a7e711', 'b7e711', 'c7e711', 'd6e511', 'd6c510', 'f7e711', 'g7e711', 'h7h311', 'a8e811', 'b8e811', 'c8e811', 'd6e511', 'd6c510',
-        'f8e811', 'g8e811', 'h8h311', 'a1a311', 'b1b312', 'c1c413', , 'e1e412', 'f1f312', 'e6e512', 'h1h311', , , , , , , , , 'e6e510', 'b3h311', 'c3h311',
-        ,
-        'e3h311', 'e6f511', 'e6e510', 'e6e510', 'a4d411', 'b4d411', 'c4d411', , 'e4d411', 'f4d411', 'g4d411', 'h4h311', 'a5d511', 'b5d511', 'c5d511',
-        ,
-        'e5d511', 'f5d511', 'g5d511', 'h5h311', 'a6a311', 'b6d612', 'c6d612', , , 'f6f312', 'e6e512', 'h6h311', 'a7a311', 'b7d712', 'c7d712', ,
-        'e6d511', 'e6e512', 'e6e512', 'h7h311', 'a8a311', 'b8d812', 'c8d812', , 'e6d511', 'e6e512', 'e6e512', 'h8h311', 'a1a311', 'b1b312', 'c1c513',
-        ,
-        'e1e412', 'f1f312', 'f6e512', 'h1h311', , , , , , , , , 'f6e510', 'b3h311', 'c3h311', , 'e3h311', 'f3h311', 'f6e510', 'f6e510', 'a4d411', 'b4d411',
-        'c4d411', , 'e4d411', 'f4d411', 'g4d411', 'h4h311', 'a5a311', 'b5d512', 'c5d512', , 'e5e412', 'f5f312', 'f6e512', 'h5h311', 'a6a311', 'b6b312',
-        'c6c713', , 'e6e412', , 'f6e512', 'h6h311', 'a7a311', 'b7b312', 'c7c813', , 'e7e412', 'f6e512', 'f6e512', 'h7h311', 'a8a311', 'b8b312', 'c8d813',
-        ,
-        'e8e412', 'f6e512', 'f6e512', 'h8h311', 'a1a311', 'b1b313', 'c1c414', , 'e1e412', 'f1f313', 'g1g312', 'h1h311', , , , , , , , , 'a3h311', 'b3h311',
-        'c3h311', , 'e3h311', 'f3h311', 'g3h311', 'g6g511', 'a4a311', 'b4e412', 'c4e412', , 'g6g511', 'f4e412', 'g4g312', 'h4h311', 'a5a311', 'b5d513',
-        'c5d513', , 'e5e412', 'f5f413', 'g5g312', 'h5h311', 'a6a311', 'b6d613', 'c6d613', , 'e6e412', 'f6f413', , 'h6h311', 'a7a311', 'b7d713', 'c7d713',
-        ,
-        'e7e412', 'f7f413', 'g6f513', 'h7h311', 'a8a311', 'b8d813', 'c8d813', , 'e8e412', 'f8f413', 'g6f513', 'h8h311', 'a1a312', 'b1b313', 'c1c415',
-        ,
-        'e1e514', 'f1f313', 'g1g312', 'h1h312', , , , , , , , , 'h6g511', 'h6g511', 'c3g312', , 'e3g312', 'h6g511', 'h6g511', 'h6g511', 'a4a312', 'b4b313',
-        'c4f414', , 'h6g511', 'f4f313', 'g4g312', 'h4h312', 'a5a312', 'b5b313', 'c5e514', , 'h6g513', 'f5f313', 'g5g312', 'h5h312', 'a6a312', 'b6b313',
-        'c6c715', , 'e6e514', 'f6f313', 'g6g312', , 'a7a312', 'b7b313', 'c7d714', , 'e7e514', 'f7f313', 'g7g312', 'h6g514', 'a8a312', 'b8b313', 'c8d814',
-        ,
-        'e8e514', 'f8f313', 'g8g312', 'h6g514', 'a1a312', 'a7b614', 'c1c415', , 'e1e613', 'f1f314', 'a7b614', 'h1h312', , , , , , , , , 'a3h312', 'a7b612',
-        'c3h312', , 'e3h312', 'f3h312', 'a7b612', 'a7b712', 'a4a312', 'a7b613', 'a7b613', , 'a7b613', 'a7b614', 'a7b613', 'h4h312', 'a5a312', 'a7b614',
-        'a7b614', , 'a7b611', 'a7b614', 'a7b614', 'h5h312', 'a6a312', 'b6e613', 'c6e613', , 'a7b611', 'f6e613', 'g6e613', 'h6h312', , 'b7e713', 'c7e713',
-        ,
-        'a7b611', 'f7e713', 'g7e713', 'h7h312', 'a8e813', 'b8e813', 'c8e813', , 'a7b611', 'f8e813', 'g8e813', 'h8h312', 'a1a312', 'b1b313', 'c1c415',
-        ,
-        'e1e513', 'f1f313', 'g1g313', 'h1h312', , , , , , , , , 'b7c611', 'b3h312', 'c3h312', , 'e3h312', 'b7c612', 'b7c612', 'b7c611', 'a4a312', 'b4b313',
-        'b7c613', , 'b7c611', 'f4f313', 'b7c613', 'h4h312', 'a5a312', 'b5e513', 'b7c613', , 'b7c611', 'b7c613', 'b7c613', 'h5h312', 'a6a312', 'b6e613',
-        'c6e613', , 'b7c611', 'f6f313', 'g6g313', 'h6h312', 'a7a312', , 'b7c613', , 'b7c611', 'f7f313', 'b7c613', 'h7h312', 'a8a312', 'b7c613', 'b7c613',
-        ,
-        'b7c611', 'f8f313', 'b7c613', 'h8h312', 'a1a312', 'b1b313', 'c1c414', , 'e1e513', 'f1f313', 'c7d613', 'h1h312', , , , , , , , , 'c7d611', 'b3h312',
-        'c3h312', , 'e3h312', 'c7d612', 'c7d612', 'c7d611', 'a4a312', 'c7d612', 'c4h413', , 'c7d611', 'c7d613', 'c7d612', 'c7d612', 'a5a312', 'b5d513',
-        'c5d513', , 'c7d611', 'c7d613', 'c7d613', 'h5h312', 'a6a312', 'b6e613', 'c6e613', , 'c7d611', 'c7d613', 'c7d613', 'h6h312', 'a7a312', 'b7b313',
-        ,
-        , 'c7d611', 'c7d613', 'c7d613', 'h7h312', 'a8a312', 'b8e813', 'c7d613', , 'c7d611', 'c7d613', 'c7d613', 'h8h312', 'a1a312', 'b1b313', 'c1c414',
-        ,
-        'e1e513', 'f1f313', 'd7e613', 'h1h312', , , , , , , , , 'd7e611', 'b3h312', 'c3h312', , 'e3h312', 'd7e612', 'd7e612', 'd7e611', 'a4a312', 'd7d612',
-        'c4g413', , 'd7d611', 'd7e613', 'd7e612', 'd7e612', 'a5a312', 'b5d513', 'c5d513', , 'd7d611', 'd7e613', 'd7e613', 'h5h312', 'a6a312', 'b6d613',
-        'c6d613', , 'd7d611', 'd7d613', 'd7e613', 'h6h312', 'a7a312', 'b7b313', 'd7e613', , 'd7d611', 'd7e613', 'd7e613', 'h7h312', 'a8a312', 'b8d813',
-        'c8d813', 'd7e612', 'd7d611', 'd7e613', 'd7e613', 'h8h312', 'a1a312', 'b1b313', 'c1c414', , 'e1e513', 'f1f313', 'e7f613', 'h1h312', , , ,
-        ,
-        , , , , 'e7f611', 'b3h312', 'c3h312', , 'e3h312', 'e7f612', 'e7f612', 'e7f611', 'a4a312', 'e7d612', 'c4g413', , 'e7d611', 'e7f613', 'e7e612',
-        'e7e612', 'a5a312', 'b5d513', 'c5d513', , 'e7d611', 'e7f613', 'e7f613', 'h5h312', 'a6a312', 'b6d613', 'c6d613', , 'e7d611', 'e7d613', 'e7f613',
-        'h6h312', 'a7a312', 'b7d713', 'c7d713', , , 'e7f613', 'e7f613', 'h7h312', 'a8a312', 'b8d813', 'c8d813', , 'e7d611', 'e7f613', 'e7f613', 'h8h312',
-        'a1a313', 'b1b313', 'c1c414', , 'e1e513', 'f1f313', 'f7f613', 'h1h312', , , , , , , , , 'f7g611', 'b3h312', 'c3h312', , 'e3h312', 'f3h312', 'f7g612',
-        'f7g611', 'f7e612', 'b4g413', 'c4g413', , 'f7g612', 'f4g413', 'f7e612', 'f7e612', 'a5d513', 'b5d513', 'c5d513', , 'f7e612', 'f5f313', 'f7f613',
-        'h5h312', 'a6d613', 'b6d613', 'c6d613', , 'e6e513', 'f6f313', 'f7f613', 'h6h312', 'a7d713', 'b7d713', 'c7d713', , 'e7e513', , 'f7f613', 'h7h312',
-        'a8d813', 'b8d813', 'c8d813', , 'e8e513', 'f7f613', 'f7f613', 'h8h312', 'a1a313', 'b1b313', 'c1c415', , 'e1e414', 'f1f313', 'g1g313', 'h1h312',
-        ,
-        , , , , , , , 'g7g611', 'b3h312', 'c3h312', , 'e3h312', 'f3h312', 'g3h312', 'g7g611', 'a4a313', 'b4b313', 'c4e414', , 'g7g612', 'f4f313', 'g4g313',
-        'h4h312', 'a5d513', 'b5d513', 'c5d513', , 'e5d513', 'f5f313', 'g5g313', 'h5h312', 'a6a313', 'b6b313', 'g7f613', , 'g7f613', 'f6f313', 'g6g313',
-        'h6h312', 'a7a313', 'b7b313', 'g7f613', , 'g7f613', 'f7f313', , 'h7h312', 'a8a313', 'b8b313', 'g7f613', , 'g7f613', 'f8f313', 'g7f613', 'h8h312',
-        'a1a313', 'b1b314', 'c1c415', , 'e1e514', 'f1f314', 'g1g313', 'h1h313', , , , , , , , , 'h7g611', 'b3g313', 'c3g313', , 'e3g313', 'f3g313', 'h7h612',
-        'h7g611', 'a4a313', 'h7g613', 'c4g414', , 'h7g612', 'h7g613', 'g4g313', 'h4h313', 'a5a313', 'b5e514', 'c5e514', , 'h7g613', 'f5f314', 'g5g313',
-        'h5h313', 'a6a313', 'b6b314', 'c6c815', , 'e6e514', 'f6f314', 'g6g313', 'h6h313', 'a7a313', 'b7d714', 'c7d714', , 'e7e514', 'f7f314', 'g7g313',
-        ,
-        'a8a313', 'b8d814', 'c8d814', , 'e8e514', 'f8f314', 'g8g313', 'h7g614', 'a1a314', 'b1b314', 'c1c416', , 'e1e614', 'f1f314', 'g1g314', 'h1h314',
-        ,
-        , , , , , , , 'a8b712', 'a8b713', 'c3f314', , 'e3e614', 'a8b713', 'a8b713', 'a8b712', 'a4a314', 'a8b714', 'a8b815', , 'a8b714', 'f4f314', 'a8b714',
-        'a8b814', 'a5a314', 'b5b314', 'a8b815', , 'a8b713', 'f5f314', 'g5g314', 'h5h314', 'a6e614', 'b6e614', 'c6e614', , 'a8b713', 'f6f314', 'g6g314',
-        'h6h314', 'a7e714', 'b7e714', 'c7e714', , 'a8b713', 'f7f314', 'g7g314', 'h7h314', , 'b8e814', 'c8e814', , 'a8b713', 'f8f314', 'g8g314', 'h8h314',
-        'a1a314', 'b1b314', 'c1c415', , 'e1e514', 'f1f314', 'g1g314', 'b8c714', , , , , , , , , 'b8c712', 'b8c713', 'c3f314', , 'e3e514', 'b8c713', 'b8c713',
-        'b8c712', 'b8c713', 'b4h414', 'b8c714', , 'b8c714', 'b8c714', 'b8c714', 'b8c713', 'a5d514', 'b5d514', 'b8c714', , 'b8c713', 'b8c714', 'b8c714',
-        'b8c714', 'a6e614', 'b6e614', 'b8c714', , 'b8c713', 'b8c714', 'b8c714', 'b8c714', 'a7e714', 'b7e714', 'c7e714', , 'b8c713', 'b8c714', 'b8c714',
-        'b8c714', 'a8a414', , 'b8c714', , 'b8c713', 'b8c714', 'b8c714', 'b8c714', 'a1a314', 'b1b314', 'c1c415', , 'e1e514', 'f1f314', 'c8d714', 'h1h313',
-        ,
-        , , , , , , , 'c8d712', 'b3h313', 'c3h313', , 'e3h313', 'c8d713', 'c8d713', 'c8d712', 'c8d713', 'b4h414', 'c4h414', , 'c8d714', 'c8d714', 'c8d713',
-        'c8d713', 'a5d514', 'b5d514', 'c5d514', , 'c8d713', 'c8d714', 'c8d714', 'h5h313', 'a6d614', 'b6d614', 'c6d614', , 'c8d713', 'c8d714', 'c8d714',
-        'h6h313', 'a7e714', 'b7e714', 'c7e714', , 'c8d713', 'c8d714', 'c8d714', 'h7h313', 'a8a414', 'b8b314', , , 'c8d713', 'c8d714', 'c8d714', 'h8h313',
-        'a1a314', 'b1b314', 'c1c415', , 'e1e514', 'f1f314', 'd8e714', 'h1h313', , , , , , , , , 'd8e712', 'b3h313', 'c3h313', , 'e3h313', 'd8e713', 'd8e713',
-        'd8e712', 'd8e713', 'b4h414', 'c4h414', , 'd8e714', 'd8e714', 'd8e713', 'd8e713', 'a5d514', 'b5d514', 'c5d514', , 'd8e713', 'd8e714', 'd8e714',
-        'h5h313', 'a6d614', 'b6d614', 'c6d614', , 'd8e713', 'd8e714', 'd8e714', 'h6h313', 'a7d714', 'b7d714', 'c7d714', , 'd8d713', 'd8e714', 'd8e714',
-        'h7h313', 'a8a414', 'b8b314', 'd8e714', , 'd8e713', 'd8e714', 'd8e714', 'h8h313', 'a1a314', 'b1b314', 'c1c415', , 'e1e514', 'f1f314', 'e8f714',
-        'h1h313', , , , , , , , , 'e8e712', 'b3h313', 'c3h313', , 'e3h313', 'e8f713', 'e8f713', 'e8f712', 'e8f713', 'b4h414', 'c4h414', , 'e4e514', 'e8f714',
-        'e8f713', 'e8f713', 'a5d514', 'b5d514', 'c5d514', , 'e8f713', 'e8f714', 'e8f714', 'h5h313', 'a6d614', 'b6d614', 'c6d614', , 'e8e713', 'e8f714',
-        'e8f714', 'h6h313', 'a7d714', 'b7d714', 'c7d714', , 'e8d713', 'e8e714', 'e8f714', 'h7h313', 'a8d814', 'b8d814', 'c8d814', , , 'e8f714', 'e8f714',
-        'h8h313', 'a1a314', 'b1b314', 'c1c415', , 'e1e514', 'f1f314', 'f8f714', 'h1h313', , , , , , , , , 'f8e712', 'b3h313', 'c3h313', , 'e3h313', 'f3h313',
-        'f8g713', 'f8g712', 'f8f713', 'b4h414', 'c4h414', , 'e4e514', 'f4h414', 'f8f713', 'f8f713', 'a5d514', 'b5d514', 'c5d514', , 'f8f713', 'f5f314',
-        'f8f714', 'h5h313', 'a6d614', 'b6d614', 'c6d614', , 'f8e713', 'f6f314', 'f8f714', 'h6h313', 'a7d714', 'b7d714', 'c7d714', , 'e7e814', 'f7f314',
-        'f8f714', 'h7h313', 'a8d814', 'b8d814', 'c8d814', , 'f8e713', , 'f8f714', 'h8h313', 'a1a314', 'b1b314', 'c1c415', , 'e1e514', 'f1f315', 'g1g314',
-        'h1h313', , , , , , , , , 'a3h313', 'b3h313', 'c3h313', , 'e3h313', 'f3h313', 'g3h313', 'g8g712', 'g8f713', 'b4h414', 'c4h414', , 'e4e514', 'f4h414',
-        'g8f713', 'g8f713', 'a5d514', 'b5d514', 'c5d514', , 'g8f713', 'f5e514', 'g5g314', 'h5h313', 'a6d614', 'b6d614', 'c6d614', , 'e6e514', 'f6d614',
-        'g6g314', 'h6h313', 'a7d714', 'b7d714', 'c7d714', , 'e7e514', 'f7d714', 'g7g314', 'h7h313', 'a8d814', 'b8d814', 'c8d814', , 'e8e514', 'f8d814',
-        ,
-        'h8h313', 'a1a314', 'b1b314', 'c1c416', , 'e1e515', 'f1f315', 'g1g314', 'h1h313', , , , , , , , , 'a3h313', 'b3h313', 'c3h313', , 'e3h313', 'f3h313',
-        'g3h313', 'h8g712', 'a4a314', 'b4b314', 'c4g415', , 'h8g714', 'f4g415', 'g4g314', 'h4h313', 'a5a314', 'b5b314', 'c5e515', , 'h8h714', 'f5f315',
-        'g5g314', 'h5h313', 'a6a314', 'b6b314', 'c6d615', , 'e6e515', 'f6f315', 'g6g314', 'h6h313', 'a7a314', 'b7b314', 'c7d715', , 'e7e515', 'f7f315',
-        'g7g314', 'h7h313', 'a8a314', 'b8b314', 'c8d815', , 'e8e515', 'f8f315', 'g8g314', , , 'b1d114', , 'a1b113', 'e1e414', 'f1f414', 'g1g414',
-        'h1h414', , 'a1a216', , 'd2d514', 'e2e414', 'f2f414', 'g2g414', 'h2h414', , , , , , , , , , , , 'd4d514', 'a1a214', 'a1b113', 'a1a213', 'a1a212',
-        ,
-        , , , 'e5e414', 'f5f414', 'g5g414', 'h5h414', , , , , , 'f6f414', 'g6g414', 'h6h414', , , , , , , 'g7g414', 'h7h414', , , , , , , , 'h8h414', 'a1a414',
-        ,
-        , 'd1d812', 'e1d113', 'f1f413', 'g1g413', 'h1h413', 'a2a414', 'b1c115', , 'b1c112', 'e2e414', 'f2f413', 'g2g413', 'h2h413', , , , , , , , , 'a4f413',
-        'b4f413', , 'd4d812', 'b1c113', 'b1c113', 'b1c113', 'b1c112', 'a5d514', 'b5d514', , 'd5d812', 'e5e414', 'f5f413', 'g5g413', 'h5h413', 'a6d614',
-        'b6d614', , 'd6d812', 'e6e414', 'f6f413', 'g6g413', 'h6h413', 'a7d713', 'b7d713', , 'd7d812', 'e7d713', 'f7f413', 'g7g413', 'h7h413', 'a8d812',
-        'b8d812', , 'b1c113', 'e8d812', 'f8d812', 'g8d812', 'h8d812', 'a1a413', 'b1b215', , 'd1d212', 'e1e413', 'f1f413', 'g1g413', 'h1h412', 'a2d212',
-        'b2d212', , 'c1d113', 'e2d212', 'f2d212', 'g2d212', 'h2h412', , , , , , , , , 'a4h412', 'b4h412', , 'd4h412', 'c1d111', 'c1d111', 'c1d111', 'c1d111',
-        'a5a413', 'b5d514', , 'd5d212', 'e5e413', 'f5f413', 'g5g413', 'h5h412', 'a6a413', 'b6d614', , 'd6d212', 'e6e413', 'f6f413', 'g6g413', 'h6h412',
-        'a7d713', 'b7d713', , 'd7d212', 'e7e413', 'f7f413', 'g7g413', 'h7h412', 'a8d813', 'b8d813', , 'c1b112', 'e8e413', 'f8f413', 'g8g413', 'h8h412',
-        'a1a412', 'd1e214', , , 'e1e411', 'f1f411', 'g1g411', 'h1h411', 'a2a412', 'b2d213', , 'd1c112', 'e2e411', 'f2f411', 'g2g411', 'h2h411', ,
-        ,
-        , , , , , , 'd1e29', 'b4e411', , 'd4e411', 'd1e27', 'd1e27', 'd1e27', 'd1e27', 'a5a412', 'b5d514', , 'd1e213', 'e5e411', 'f5f411', 'g5g411',
-        'h5h411', 'a6a412', 'b6d614', , 'd1e213', 'e6e411', 'f6f411', 'g6g411', 'h6h411', 'a7a412', 'b7d713', , 'd1e213', 'e7e411', 'f7f411', 'g7g411',
-        'h7h411', 'a8a412', 'b8d813', , 'd1e213', 'e8e411', 'f8f411', 'g8g411', 'h8h411', 'a1a411', 'b1d114', , 'd1d713', , 'f1f410', 'g1g410', 'h1h410',
-        'a2a411', 'b2d214', , 'd2d713', 'e2e412', 'f2f410', 'g2g410', 'h2h410', , , , , , , , , 'e1e29', 'b4f410', , 'd4f410', 'e1e27', 'e1e27', 'e1e27',
-        'e1e27', 'a5a411', 'b5f514', , 'd5d713', 'e5e412', 'f5f410', 'g5g410', 'h5h410', 'a6a411', 'b6d614', , 'd6d713', 'e6e412', 'f6f410', 'g6g410',
-        'h6h410', 'a7a411', 'b7d713', , 'd7d813', 'e7e412', 'f7f410', 'g7g410', 'h7h410', 'a8a411', 'b8d813', , 'd8d713', 'e8e412', 'f8f410', 'g8g410',
-        'h8h410', 'a1a411', 'b1d114', , 'f1f213', 'e1e412', , 'g1g410', 'h1h410', 'a2a411', 'b2b515', , 'f1e213', 'e2e412', 'f2f410', 'g2g410', 'h2h410',
-        ,
-        , , , , , , , 'f1e29', 'b4f410', , 'd4f410', 'f1e27', 'f1e27', 'f1e27', 'f1e27', 'a5a411', 'b5f514', , 'f1f213', 'e5e412', 'f5f410', 'g5g410',
-        'h5h410', 'a6a411', 'b6b815', , 'f1f213', 'e6e412', 'f6f410', 'g6g410', 'h6h410', 'a7a411', 'b7d714', , 'f1f213', 'e7e412', 'f7f410', 'g7g410',
-        'h7h410', 'a8a411', 'b8d814', , 'f1f213', 'e8e412', 'f8f410', 'g8g410', 'h8h410', 'a1a412', 'b1d114', , 'g1g213', 'e1e413', 'f1f411', , 'h1h411',
-        'a2a412', 'b2b815', , 'd2d714', 'e2e413', 'f2f411', 'g2g411', 'h2h411', , , , , , , , , 'g1f210', 'b4f411', , 'd4f411', 'g1f210', 'g1f110', 'g1f110',
-        'g1f110', 'a5a412', 'b5h514', , 'g1f213', 'e5e413', 'f5f411', 'g5g411', 'h5h411', 'a6a412', 'b6b815', , 'g1f213', 'e6e413', 'f6f411', 'g6g411',
-        'h6h411', 'a7a412', 'b7d714', , 'g1f213', 'e7e413', 'f7f411', 'g7g411', 'h7h411', 'a8a412', 'b8d814', , 'g1g213', 'e8e413', 'f8f411', 'g8g411',
-        'h8h411', 'a1a413', 'b1d115', , 'h1g213', 'e1e413', 'f1f413', 'g1g413', , 'a2a413', 'b2b516', , 'd2d715', 'e2e413', 'f2f413', 'g2g413', 'h2h413',
-        ,
-        , , , , , , , 'h1g112', 'b4e413', , 'd4e413', 'h1g211', 'h1g111', 'h1g111', 'h1g111', 'a5a413', 'h1g214', , 'h1g214', 'e5e413', 'f5f413', 'g5g413',
-        'h1g213', 'a6a413', 'b6d616', , 'd6d715', 'e6e413', 'f6f413', 'g6g413', 'h6h413', 'a7a413', 'b7d715', , 'h1g114', 'e7e413', 'f7f413', 'g7g413',
-        'h7h413', 'a8a413', 'b8d815', , 'h1g213', 'e8e413', 'f8f413', 'g8g413', 'h8h413', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a49', 'b1d113', , 'e2e312', 'e1d113',
-        'f1f47', 'g1g47', 'h1h47', 'a2a49', 'b2d213', , 'e2e312', , 'f2f47', 'g2g47', 'h2h47', , , , , , , , , 'a4e47', 'b4e47', , 'd4e47', 'e4f47', 'f4g47',
-        'g4h47', 'h4g47', 'a5a49', 'e2e310', , 'e2e310', 'e5e47', 'f5f47', 'g5g47', 'h5h47', 'a6a49', 'b6d613', , 'e2e312', 'e6e47', 'f6f47', 'g6g47',
-        'h6h47', 'a7a49', 'b7d713', , 'e2e312', 'e7e47', 'f7f47', 'g7g47', 'h7h47', 'a8a49', 'b8d813', , 'e2e312', 'e8e47', 'f8f47', 'g8g47', 'h8h47',
-        'a1a410', 'b1d113', , 'f2e312', 'e1e410', 'f2e310', 'f2e310', 'f2e310', 'a2a410', 'b2b514', , 'f2e312', 'e2e410', , 'f2e310', 'f2e310', ,
-        ,
-        , , , , , , 'f2e29', 'b4e410', , 'f2e38', 'f2e27', 'f2e27', 'f2e27', 'f2e27', 'a5a410', 'f2e310', , 'f2e310', 'e5e410', 'f2e310', 'f2e310', 'f2e310',
-        'a6a410', 'b6d613', , 'f2e312', 'e6e410', 'f2e310', 'f2e310', 'f2e310', 'a7a410', 'b7d713', , 'f2e312', 'e7e410', 'f2e310', 'f2e310', 'f2e310',
-        'a8a410', 'b8d813', , 'f2e312', 'e8e410', 'f2e310', 'f2e310', 'f2e310', 'a1a412', 'b1d113', , 'd1d813', 'e1e411', 'f1f411', 'g1d113', 'h1h411',
-        'a2a412', 'b2b514', , 'd2d813', 'e2e411', 'f2f411', , 'h2h411', , , , , , , , , 'g2f210', 'b4e411', , 'd4e411', 'g2f210', 'g2f110', 'g2f110', 'g2f110',
-        'a5a412', 'b5f513', , 'g2f311', 'e5e411', 'f5f411', 'g5g411', 'h5h411', 'a6a412', 'b6b514', , 'd6d813', 'e6e411', 'f6f411', 'g6g411', 'h6h411',
-        'a7a412', 'b7d714', , 'd7d813', 'e7e411', 'f7f411', 'g7g411', 'h7h411', 'a8a412', 'b8d813', , 'd8d113', 'e8e411', 'f8f411', 'g8g411', 'h8h411',
-        'a1a413', 'h2g314', , 'h2g213', 'e1e414', 'f1f413', 'g1g413', 'h2g314', 'a2a413', 'b2g215', , 'd2d814', 'e2e414', 'f2f413', 'g2g413', , ,
-        ,
-        , , , , , , 'h2g112', 'b4f413', , 'd4f413', 'h2g211', 'h2g111', 'h2g111', 'h2g111', 'a5a413', 'h2g214', , 'd5d814', 'h2g313', 'f5f413', 'g5g413',
-        'h2g213', 'a6a413', 'b6d615', , 'd6d814', 'e6e414', 'f6f413', 'g6g413', 'h6h413', 'a7a413', 'b7d715', , 'h2g313', 'e7e414', 'f7f413', 'g7g413',
-        'h7h413', 'a8a413', 'b8d814', , 'h2g213', 'e8e414', 'f8f413', 'g8g413', 'h8h413', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a49', 'b1b510', , 'd1d48', 'e1f110',
-        'f1f48', 'g1g48', 'h1h48', 'a2a49', 'b2b510', , 'd2d48', 'e2f210', 'f2f48', 'g2g48', 'h2h48', , , , , , 'f3f48', 'g3g48', 'h3h48', 'a4d48', 'b4d48',
-        ,
-        'd4e48', 'e3e27', 'e3e27', 'e3e27', 'e3e27', 'a5a49', 'b5c510', , 'd5d48', 'e5e48', 'f5f48', 'g5g48', 'h5h48', 'a6a49', 'b6c610', , 'd6d48',
-        'e6e48', 'f6f48', 'g6g48', 'h6h48', 'a7a49', 'b7e710', , 'd7d48', 'e7e48', 'f7f48', 'g7g48', 'h7h48', 'a8a49', 'b8e810', , 'd8d48', 'e8e48',
-        'f8f48', 'g8g48', 'h8h48', 'a1a410', 'f3e411', , 'd1d511', 'e1e411', 'f3e310', 'f3e310', 'f3e310', 'a2a410', 'b2b513', , 'd2d511', 'e2e411',
-        'f3e310', 'f3e310', 'f3e310', , , , , , , 'f3e310', 'f3e310', 'f3e29', 'b4f410', , 'f3e38', 'f3e27', 'f3e27', 'f3e27', 'f3e27', 'a5a410', 'f3e310',
-        ,
-        'f3e310', 'f3e310', 'f3e310', 'f3e310', 'f3e310', 'a6a410', 'f3e412', , 'd6d511', 'f3e310', 'f3e310', 'f3e310', 'f3e310', 'a7a410', 'f3e411',
-        ,
-        'd7d511', 'f3e310', 'f3e310', 'f3e310', 'f3e310', 'a8a410', 'f3e411', , 'd8d511', 'f3e310', 'f3e310', 'f3e310', 'f3e310', 'a1a412', 'b1d113',
-        ,
-        'g3f412', 'e1e411', 'f1f411', 'g1d113', 'h1h411', 'a2a412', 'b2b514', , 'd2d713', 'e2e411', 'f2f411', 'g3f313', 'h2h411', , , , , , , , 'h3h411',
-        'g3f210', 'b4e411', , 'd4e411', 'g3f210', 'g3f210', 'g3f210', 'g3f210', 'a5a412', 'b5e513', , 'g3f311', 'e5e411', 'f5f411', 'g5g411', 'h5h411',
-        'a6a412', 'b6b814', , 'g3f412', 'e6e411', 'f6f411', 'g6g411', 'h6h411', 'a7a412', 'b7d713', , 'g3f412', 'e7e411', 'f7f411', 'g7g411', 'h7h411',
-        'a8a412', 'b8d813', , 'g3f412', 'e8e411', 'f8f411', 'g8g411', 'h8h411', 'a1a413', 'h3g314', , 'h3g213', 'e1e413', 'f1f413', 'g1g413', 'h3g314',
-        'a2a413', 'b2b815', , 'd2d714', 'e2e413', 'f2f413', 'g2g413', 'h3g314', , , , , , , , , 'h3g212', 'b4e413', , 'd4e413', 'h3g211', 'h3g211', 'h3g211',
-        'h3g211', 'a5a413', 'h3g214', , 'd5d714', 'e5e413', 'f5f413', 'g5g413', 'h3g213', 'a6a413', 'b6b815', , 'd6d714', 'e6e413', 'f6f413', 'g6g413',
-        'h6h413', 'a7a413', 'b7d714', , 'h3g313', 'e7e413', 'f7f413', 'g7g413', 'h7h413', 'a8a413', 'b8d814', , 'h3g213', 'e8e413', 'f8f413', 'g8g413',
-        'h8h413', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , 'a1a410', 'b1c110', , 'd1d49', 'e1c110', 'e4e310', 'e4e310', 'e4e310', 'a2a410', 'b2b511', , 'd2d49', 'e2e111',
-        'e4e310', 'e4e310', 'e4e310', , , , , , , , , 'a4d49', 'b4d49', , 'e4e38', , 'e4e38', 'e4e38', 'e4e38', 'a5c510', 'b5c510', , 'd5d49', 'e4e310',
-        'e4e310', 'e4e310', 'e4e310', 'a6c610', 'b6c610', , 'd6d49', 'e4e310', 'e4e310', 'e4e310', 'e4e310', 'a7c710', 'b7c710', , 'd7d49', 'e4e310',
-        'e4e310', 'e4e310', 'e4e310', 'a8c810', 'b8c810', , 'd8d49', 'e4e310', 'e4e310', 'e4e310', 'e4e310', 'a1a411', 'f4e411', , 'd1d511', 'e1e410',
-        'f4e310', 'f4e310', 'f4e310', 'a2a411', 'b2b513', , 'd2d511', 'e2e410', 'f4e310', 'f4e310', 'f4e310', , , , , , , , , 'f4e39', 'b4e410', , 'f4e38',
-        'f4e38', , 'f4e38', 'f4e38', 'a5d511', 'f4e310', , 'f4e310', 'e5e410', 'f4e310', 'f4e310', 'f4e310', 'a6a411', 'b6d612', , 'd6d511', 'e6e410',
-        'f4e310', 'f4e310', 'f4e310', 'a7a411', 'f4e411', , 'd7d511', 'e7e410', 'f4e310', 'f4e310', 'f4e310', 'a8a411', 'f4e411', , 'd8d511', 'e8e410',
-        'f4e310', 'f4e310', 'f4e310', 'a1a412', 'b1d113', , 'g4f412', 'e1e411', 'f1f411', 'g1d113', 'g4f313', 'a2a412', 'b2b514', , 'd2d713', 'e2e411',
-        'f2f411', 'g4f313', 'g4f313', , , , , , , , , 'g4f310', 'b4e411', , 'd4e411', 'g4f410', 'g4f310', , 'g4f310', 'a5a412', 'b5e513', , 'g4f311', 'e5e411',
-        'f5f411', 'g4f312', 'g4f312', 'a6a412', 'b6b714', , 'g4f412', 'e6e411', 'f6f411', 'g4f313', 'g4f313', 'a7a412', 'b7d713', , 'g4f412', 'e7e411',
-        'f7f411', 'g4f313', 'g4f313', 'a8a412', 'b8d813', , 'g4f412', 'e8e411', 'f8f411', 'g4f313', 'g4f313', 'a1a413', 'h4g314', , 'h4g313', 'e1e414',
-        'f1f413', 'g1g413', 'h4g314', 'a2a413', 'b2b815', , 'd2d714', 'e2e414', 'f2f413', 'g2g413', 'h4g314', , , , , , , , , 'h4g312', 'b4f413', , 'd4f413',
-        'h4g311', 'h4g311', 'h4g311', , 'a5a413', 'h4g314', , 'd5d714', 'h4g313', 'f5f413', 'g5g413', 'h4g313', 'a6a413', 'b6b815', , 'd6d714', 'e6e414',
-        'f6f413', 'g6g413', 'h4g314', 'a7a413', 'b7d714', , 'h4g313', 'e7e414', 'f7f413', 'g7g413', 'h4g314', 'a8a413', 'b8d814', , 'h4g313', 'e8e414',
-        'f8f413', 'g8g413', 'h4g314', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'e5e411', 'e5e411', , 'd1d410', 'e1e411', 'e5e411', 'e5e411', 'e5e411', , 'b2b512', , 'd2d410',
-        'e2e411', 'e5e412', 'e5d511', 'e5d511', , , , , , , , , , , , 'e5e49', 'e4d410', 'f4d410', 'g4d410', 'h4d410', , , , , , 'e5e410', 'e5e410', 'e5e410',
-        ,
-        , , , , 'e5e412', 'e5d511', 'e5d511', , , , , , , 'e5e411', 'e5e411', , , , , , , , 'e5e411', 'f5e411', 'f5e411', , 'f5e411', 'e1e411', 'f5e411', 'f5e411',
-        'f5e411', 'a2a412', 'b2b513', , 'd2d512', 'e2e411', 'f2f412', 'f5e412', 'f5e412', , , , , , , , , 'f5e410', 'b4e411', , 'f5e49', 'f5f410', 'f4e411',
-        'g4e411', 'h4e411', 'a5d512', 'f5e411', , 'f5f411', 'f5e410', , 'f5e410', 'f5e410', 'a6d612', 'b6d612', , 'f5e411', 'e6e411', 'f5e412', 'f5e412',
-        'f5e412', 'f5e411', 'f5e411', , 'f5e411', 'e7e411', 'f5e411', 'f5e411', 'f5e411', 'f5e411', 'f5e411', , 'f5e411', 'e8e411', 'f5e411', 'f5e411',
-        'f5e411', 'a1a412', 'b1d113', , 'g5f412', 'e1e411', 'f1f413', 'g1g413', 'g5f413', 'a2a412', 'b2b514', , 'd2d713', 'e2e411', 'f2f413', 'g2g413',
-        'g5f413', , , , , , , , , 'a4e411', 'b4e411', , 'd4e411', 'g5f410', 'f4e411', 'g4e411', 'h4e411', 'a5a412', 'b5e513', , 'g5f411', 'e5e411', 'g5f412',
-        ,
-        'g5f412', 'a6a412', 'b6b714', , 'g5f412', 'e6e411', 'f6f513', 'g5f413', 'g5f413', 'a7a412', 'b7d713', , 'g5f412', 'e7e411', 'f7f513', 'g5f413',
-        'g5f413', 'a8a412', 'b8d813', , 'g5f412', 'e8e411', 'f8f513', 'g5f413', 'g5f413', 'a1a413', 'h5g414', , 'h5g413', 'e1e414', 'f1f413', 'g1g414',
-        'h1h414', 'a2a413', 'b2b815', , 'd2d714', 'e2e414', 'f2f413', 'g2g414', 'h2h414', , , , , , , , , 'h5g412', 'b4f413', , 'd4f413', 'h5g411', 'h5g411',
-        'g4f413', 'h4f413', 'a5a413', 'h5g414', , 'd5d714', 'h5g413', 'f5f413', 'h5g413', , 'a6a413', 'b6b815', , 'd6d714', 'e6e414', 'f6f413', 'g6g414',
-        'h5g414', 'a7a413', 'b7d714', , 'h5g413', 'e7e414', 'f7f413', 'g7g414', 'h5g414', 'a8a413', 'b8d814', , 'h5g413', 'e8e414', 'f8f413', 'g8g414',
-        'h5g414', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a412', 'b1d112', , 'd1d512', 'e1e412',
-        'f1f412', 'f6e512', 'f6e512', , 'b2b514', , 'd2d512', 'e2e412', 'f2f412', 'f6e512', 'f6e512', , , , , , , , , , , , 'f6e510', 'f6g511', 'f4g412',
-        'f6f512', 'f6f512', , , , , 'e5e412', 'f5f412', 'f6e512', 'f6e512', , , , , , , 'f6e512', 'f6e512', , , , , , , 'f6e512', 'f6e512', , , , , , , , 'f6e512',
-        'a1a413', 'g6f513', , 'g6f512', 'e1e412', 'f1f413', 'g1g413', 'g6f513', 'a2a413', 'b2b514', , 'd2d713', 'e2e412', 'f2f413', 'g2g413', 'g6f513',
-        ,
-        , , , , , , , 'a4e412', 'b4e412', , 'd4e412', 'g6g511', 'f4e412', 'g4e412', 'g6f512', 'a5e513', 'b5e513', , 'g6f512', 'e5e412', 'f5f413', 'g5g413',
-        'g6g513', 'a6a413', 'b6b714', , 'g6f512', 'e6e412', 'f6f413', , 'g6f513', 'a7d713', 'b7d713', , 'g6f512', 'e7e412', 'f7f413', 'g6f513', 'g6f513',
-        'a8d813', 'b8d813', , 'g6f512', 'e8e412', 'f8f413', 'g6f513', 'g6f513', 'a1a414', 'h6g514', , 'h6g513', 'h6g514', 'f1f414', 'g1g414', 'h1h414',
-        'a2a414', 'b2b815', , 'd2d714', 'h6g514', 'f2f414', 'g2g414', 'h2h414', , , , , , , , , 'h6g512', 'b4f414', , 'd4d714', 'h6g511', 'h6h513', 'h6g513',
-        'h6g513', 'a5a414', 'h6g514', , 'd5d714', 'h6g513', 'h6g513', 'g5g414', 'h6g513', 'a6a414', 'b6b815', , 'd6d714', 'h6g514', 'f6f414', 'g6g414',
-        ,
-        'a7d714', 'b7d714', , 'h6g513', 'e7d714', 'f7f414', 'g7g414', 'h6g514', 'a8d814', 'b8d814', , 'h6g513', 'e8d814', 'f8f414', 'g8g414', 'h6g514',
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , 'a1a414', 'b1d114', , 'g7f612', 'e1e414', 'f1f414', 'g1g414', 'g7g614', , 'b2b515', , 'd2d514', 'e2e414', 'f2f414',
-        'g2g414', 'g7g614', , , , , , , , , , , , 'd4d514', 'g7g612', 'g7f612', 'g7f612', 'g7f612', , , , , 'g7g613', 'f5f414', 'g5g414', 'g7g614', , , , , , 'f6f414',
-        'g6g414', 'g7g614', , , , , , , , 'g7g614', , , , , , , , 'g7g614', 'a1a414', 'h7g614', , 'd1d714', 'h7g614', 'f1f414', 'g1g414', 'h1h414', 'a2a414',
-        'b2b616', , 'd2d714', 'h7g614', 'f2f414', 'g2g414', 'h2h414', , , , , , , , , 'h7g613', 'b4f414', , 'd4d714', 'h7g612', 'h7g613', 'h7g613', 'h7g613',
-        'a5a414', 'h7g614', , 'd5d714', 'h7g613', 'f5f414', 'g5g414', 'h5h414', 'a6a414', 'b6d615', , 'd6d714', 'h7g614', 'f6f414', 'g6g414', 'h6h414',
-        'a7d714', 'b7d714', , 'h7g613', 'e7d714', 'f7f414', 'g7g414', , 'a8d814', 'b8d814', , 'h7g613', 'e8d814', 'f8f414', 'g8g414', 'h7g614', ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'h8g715', 'b1b816', , 'd1d814', 'h8h715',
-        'h8g715', 'g1g415', 'h1h414', , 'b2b816', , 'd2d814', 'h8g715', 'f2f416', 'g2g415', 'h2h414', , , , , , , , , , , , 'd4d814', 'e4h414', 'f4h414',
-        'g4h414', 'h8h714', , , , , 'h8g714', 'h8g715', 'g5g415', 'h5h414', , , , , , 'f6f816', 'g6g415', 'h6h414', , , , , , , 'g7g415', 'h7h414', , , , , , , ,
-        ,
-        , 'a1a215', 'a1b215', , 'a1b214', 'f1f414', 'g1g414', 'h1h413', 'a2a414', 'b2b415', 'a1b216', , 'e2e516', 'f2f414', 'g2g414', 'h2h413',
-        ,
-        , , , , , , , 'a1b211', 'a1b211', 'c4h413', , 'e4h413', 'a1b213', 'a1b212', 'a1b211', 'a1b214', 'a1b215', 'a1b215', , 'a1b215', 'f5f414', 'g5g414',
-        'h5h413', 'a6a414', 'b6b415', 'a1b216', , 'a1a215', 'f6f414', 'g6g414', 'h6h413', 'a7a414', 'b7b415', 'a1a216', , 'a1a215', 'f7f414', 'g7g414',
-        'h7h413', 'a8a414', 'b8b415', 'a1a216', , 'a1b214', 'f8f414', 'g8g414', 'h8h413', 'a1a414', , 'b1b215', , 'b1b214', 'f1f414', 'g1g414', 'h1h413',
-        'a2a414', 'b2b414', 'b1b216', , 'e2e715', 'f2f414', 'g2g414', 'h2h413', , , , , , , , , 'b1b211', 'b1b211', 'c4h413', , 'e4h413', 'b1c112', 'b1b212',
-        'b1b211', 'a5a414', 'b5b414', 'b1b215', , 'b1b215', 'f5f414', 'g5g414', 'h5h413', 'a6a414', 'b6b414', 'b1b216', , 'b1b215', 'f6f414', 'g6g414',
-        'h6h413', 'a7a414', 'b7b414', 'c7e715', , 'b1b215', 'f7f414', 'g7g414', 'h7h413', 'a8a414', 'b8b414', 'b1c115', , 'b1b214', 'f8f414', 'g8g414',
-        'h8h413', 'a1a413', 'b1b413', , , 'c1b214', 'f1f412', 'g1g412', 'h1h412', 'a2a413', 'b2b413', 'c2c515', , 'c1d114', 'f2f412', 'g2g412', 'h2h412',
-        ,
-        , , , , , , , 'c1d110', 'c1b211', 'c4f412', , 'e4f412', 'c1d112', 'c1d112', 'c1d111', 'a5a413', 'b5b413', 'c1d114', , 'c1d114', 'f5f412', 'g5g412',
-        'h5h412', 'a6a413', 'b6b413', 'c6c815', , 'e6e814', 'f6f412', 'g6g412', 'h6h412', 'a7a413', 'b7b413', 'c7c815', , 'e7e814', 'f7f412', 'g7g412',
-        'h7h412', 'a8a413', 'b8b413', 'c8e814', , 'c1b214', 'f8f412', 'g8g412', 'h8h412', 'a1a410', 'b1b412', 'c1c514', , 'e1e214', 'f1f412', 'g1g412',
-        'h1h411', 'a2a410', 'b2b412', 'c2c514', , 'e2e514', 'f2f412', 'g2g412', 'h2h411', , , , , , , , , 'a4h411', 'b4a410', 'c4a410', , 'e4a410', 'f4a410',
-        'g4a410', 'h4a410', 'a5a410', 'b5b412', 'c5e514', , 'd1e114', 'f5f412', 'g5g412', 'h5h411', 'a6a410', 'b6b412', 'c6c514', , 'e6e514', 'f6f412',
-        'g6g412', 'h6h411', 'a7a410', 'b7b412', 'c7c514', , 'e7e514', 'f7f412', 'g7g412', 'h7h411', 'a8a410', 'b8b412', 'c8c514', , 'd1c114', 'f8f412',
-        'g8g412', 'h8h411', 'a1a411', 'b1b411', 'c1c514', , , 'f1f411', 'g1g411', 'h1h412', 'a2a411', 'b2b411', 'c2c514', , 'e1d114', 'f2f411', 'g2g411',
-        'h2h412', , , , , , , , , 'e1f210', 'b4f411', 'c4f411', , 'e4f411', 'e1f29', 'e1f29', 'e1f29', 'a5a411', 'b5b411', 'c5e514', , 'e1f214', 'f5f411',
-        'g5g411', 'h5h412', 'a6a411', 'b6b411', 'c6c514', , 'e6e514', 'f6f411', 'g6g411', 'h6h412', 'a7a411', 'b7b411', 'c7c514', , 'e7e514', 'f7f411',
-        'g7g411', 'h7h412', 'a8a411', 'b8b411', 'c8c514', , 'e8e514', 'f8f411', 'g8g411', 'h8h412', 'a1a412', 'b1b413', 'c1c515', , 'e1e515', , 'g1g412',
-        'h1h411', 'a2a412', 'b2b413', 'c2c515', , 'e2e515', 'f2f413', 'g2g412', 'h2h411', , , , , , , , , 'f1f210', 'b4h411', 'c4h411', , 'e4h411', 'f1f29',
-        'f1f29', 'f1f29', 'a5a412', 'b5b413', 'c5h514', , 'e5h514', 'f5f413', 'g5g412', 'h5h411', 'a6a412', 'b6b413', 'c6h615', , 'e6e715', 'f6f413',
-        'g6g412', 'h6h411', 'a7a412', 'b7b413', 'c7d715', , 'e7e815', 'f7f413', 'g7g412', 'h7h411', 'a8a412', 'b8b413', 'c8d815', , 'e8f815', 'f8f413',
-        'g8g412', 'h8h411', 'a1a412', 'b1b413', 'c1d115', , 'e1d115', 'f1f414', , 'h1h412', 'a2a412', 'b2b413', 'c2c516', , 'g1f215', 'f2f414', 'g2g412',
-        'h2h412', , , , , , , , , 'g1f210', 'g1f211', 'c4g412', , 'e4g412', 'g1f29', 'g1f29', 'g1f29', 'a5a412', 'b5b413', 'c5g515', , 'g1f214', 'f5f414',
-        'g5g412', 'h5h412', 'a6a412', 'b6b413', 'c6c716', , 'g1g215', 'f6f414', 'g6g412', 'h6h412', 'a7a412', 'b7b413', 'g1f215', , 'g1g215', 'f7f414',
-        'g7g412', 'h7h412', 'a8a412', 'b8b413', 'c8d815', , 'e8h815', 'f8f414', 'g8g412', 'h8h412', 'a1a413', 'b1b414', 'h1g215', , 'h1h215', 'f1f414',
-        'g1g412', , 'a2a413', 'b2b414', 'c2c516', , 'e2e516', 'f2f414', 'g2g412', 'h2h413', , , , , , , , , 'a4g412', 'b4g412', 'c4g412', , 'e4g412', 'f4g412',
-        'h1g112', 'h1g112', 'a5a413', 'b5b414', 'c5h515', , 'e5h515', 'f5f414', 'g5g412', 'h5h413', 'a6a413', 'b6b414', 'c6d616', , 'h1g215', 'f6f414',
-        'g6g412', 'h6h413', 'a7a413', 'b7b414', 'c7d716', , 'h1h215', 'f7f414', 'g7g412', 'h7h413', 'a8a413', 'b8b414', 'c8d816', , 'h1h215', 'f8f414',
-        'g8g412', 'h8h413', 'a2b314', 'b1b413', 'a2a315', , 'a2b313', 'f1f414', 'g1g413', 'a2b314', , 'b2b413', 'a2b315', , 'e2e615', 'f2f414', 'g2g413',
-        'a2b314', , , , , , , , , 'a2b211', 'a2b211', 'a2b311', , 'e4g413', 'a2b313', 'a2b312', 'a2b311', 'a5a413', 'b5b413', 'a2b314', , 'a2b314', 'f5f414',
-        'g5g413', 'a2b314', 'a6a413', 'b6b413', 'a2b315', , 'a2a315', 'f6f414', 'g6g413', 'a2b314', 'a7a413', 'b7b413', 'a2a315', , 'a2a315', 'f7f414',
-        'g7g413', 'a2b314', 'a8a413', 'b8b413', 'a2a315', , 'a2a314', 'f8f414', 'g8g413', 'a2b314', 'a1a411', 'b1e114', 'c1e114', , 'b2b313', 'f1f413',
-        'g1g412', 'h1h411', 'a2a411', , 'b2b315', , 'e2e814', 'f2f413', 'g2g412', 'h2h411', , , , , , , , , 'a4b411', 'b4h411', 'b2b311', , 'e4h411', 'f4h411',
-        'g4h411', 'b2b311', 'a5a411', 'b5b411', 'b2b314', , 'b2b314', 'f5f413', 'g5g412', 'h5h411', 'a6a411', 'b6b411', 'b2b315', , 'e6e814', 'f6f413',
-        'g6g412', 'h6h411', 'a7a411', 'b7b411', 'b2b315', , 'e7e814', 'f7f413', 'g7g412', 'h7h411', 'a8a411', 'b8b411', 'c8e814', , 'b2b314', 'f8f413',
-        'g8g412', 'h8h411', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a410', 'b1b411', 'c1d114', , 'e1e514',
-        'f1h114', 'g1g49', 'h1h49', 'a2a410', 'b2b411', 'c2c515', , 'e2e514', , 'g2g49', 'h2h49', , , , , , , , , 'a4f49', 'b4f49', 'c4f49', , 'e4f49', 'f4g49',
-        'g4h49', 'h4g49', 'a5a410', 'b5b411', 'f2f312', , 'f2f312', 'f5f49', 'g5g49', 'h5h49', 'a6a410', 'b6b411', 'c6d614', , 'e6e514', 'f6f49',
-        'g6g49', 'h6h49', 'a7a410', 'b7b411', 'c7d714', , 'e7e514', 'f7f49', 'g7g49', 'h7h49', 'a8a410', 'b8b411', 'c8d814', , 'e8h814', 'f8f49',
-        'g8g49', 'h8h49', 'a1a412', 'b1b412', 'c1d114', , 'e1d114', 'f1f412', 'g2f313', 'h1h412', 'a2a412', 'b2b412', 'c2c515', , 'g2f314', 'f2f412',
-        ,
-        'h2h412', , , , , , , , , 'g2f210', 'g2f211', 'c4f412', , 'g2f39', 'g2f29', 'g2f29', 'g2f29', 'a5a412', 'b5b412', 'g2f312', , 'g2f312', 'f5f412',
-        'g2f312', 'g2f312', 'a6a412', 'b6b412', 'c6d615', , 'g2g314', 'f6f412', 'g6g412', 'h6h412', 'a7a412', 'b7b412', 'g2f314', , 'g2g314', 'f7f412',
-        'g7g412', 'h7h412', 'a8a412', 'b8b412', 'g2f314', , 'g2g314', 'f8f412', 'g8g412', 'h8h412', 'a1a413', 'b1b414', 'c1d115', , 'h2g314', 'f1f413',
-        'g1g413', 'h2g314', 'a2a413', 'b2b414', 'c2c516', , 'e2e515', 'f2f413', 'g2g413', , , , , , , , , , 'h2g112', 'h2g212', 'c4f413', , 'e4f413', 'h2g212',
-        'h2h312', 'h2g112', 'a5a413', 'b5b414', 'c5e515', , 'h2g313', 'f5f413', 'g5g413', 'h5h413', 'a6a413', 'b6b414', 'h2g315', , 'h2g314', 'f6f413',
-        'g6g413', 'h6h413', 'a7a413', 'b7b414', 'c7e715', , 'h2g314', 'f7f413', 'g7g413', 'h7h413', 'a8a413', 'b8b414', 'c8d815', , 'h2g314', 'f8f413',
-        'g8g413', 'h8h413', 'a3b414', 'a3b414', 'a3b414', , 'a3b313', 'a3b414', 'g1g413', 'h1h413', 'a3b314', 'b2b414', 'a3b315', , 'e2e814', 'f2f414',
-        'g2g413', 'h2h413', , , , , , , , , 'a3b211', 'a3b211', 'a3b311', , 'e4g413', 'a3b413', 'a3b412', 'a3b311', 'a3b414', 'a3b414', 'a3b414', , 'a3b413',
-        'f5f414', 'g5g413', 'h5h413', 'a3b314', 'a3b314', 'a3b414', , 'a3b413', 'f6f414', 'g6g413', 'h6h413', 'a3b314', 'a3b314', 'a3b414', , 'a3b413',
-        'f7f414', 'g7g413', 'h7h413', 'a3b414', 'a3b414', 'a3b414', , 'a3b413', 'a3b414', 'g8g413', 'h8h413', 'a1a412', 'b1e113', 'c1c411', , 'b3b414',
-        'f1f413', 'g1g412', 'h1h411', 'a2a412', 'b2h214', 'c2c411', , 'e2e113', 'f2f413', 'g2g412', 'h2h411', 'a3a412', , , , , , , , 'a4c411', 'b3b211',
-        'c4h411', , 'e4h411', 'f4h411', 'g4h411', 'b3b211', 'a5a412', 'b5b412', 'c5c411', , 'b3b413', 'f5f413', 'g5g412', 'h5h411', 'a6a412', 'b6b412',
-        'c6c411', , 'b3b413', 'f6f413', 'g6g412', 'h6h411', 'a7a412', 'b7b412', 'c7c411', , 'b3b413', 'f7f413', 'g7g412', 'h7h411', 'a8a412', 'b8b412',
-        'c8c411', , 'b3b413', 'f8f413', 'g8g412', 'h8h411', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a410',
-        'b1b411', 'c1c512', , 'e1e49', 'f1g113', 'g1g410', 'h1h410', 'a2a410', 'b2b411', 'c2c512', , 'e2e49', 'f2g213', 'g2g410', 'h2h410', , , , ,
-        ,
-        , 'g3g410', 'h3h410', 'a4e49', 'b4e49', 'c4e49', , 'e4f410', 'f3f29', 'f3f29', 'f3f29', 'a5a410', 'b5d511', 'c5d511', , 'e5e49', 'f5f410',
-        'g5g410', 'h5h410', 'a6a410', 'b6b411', 'c6c512', , 'e6e49', 'f6f410', 'g6g410', 'h6h410', 'a7a410', 'b7b411', 'c7c512', , 'e7e49', 'f7f410',
-        'g7g410', 'h7h410', 'a8a410', 'b8b411', 'c8c512', , 'e8e49', 'f8f410', 'g8g410', 'h8h410', 'a1a412', 'b1b412', 'g3f413', , 'e1e513', 'f1f412',
-        'g3f313', 'h1h412', 'a2a412', 'b2b412', 'c2h214', , 'e2e513', 'f2f412', 'g3f313', 'h2h412', , , , , , , , 'h3h412', 'g3f210', 'g3f211', 'c4f412',
-        ,
-        'g3f39', 'g3f29', 'g3f29', 'g3f29', 'a5a412', 'b5b412', 'g3f312', , 'g3f312', 'f5f412', 'g3f312', 'g3f312', 'a6a412', 'b6b412', 'c6e614',
-        ,
-        'e6e513', 'f6f412', 'g6g412', 'h6h412', 'a7a412', 'b7b412', 'g3f413', , 'e7e513', 'f7f412', 'g7g412', 'h7h412', 'a8a412', 'b8b412', 'g3f413',
-        ,
-        'e8e513', 'f8f412', 'g8g412', 'h8h412', 'a1a413', 'b1b414', 'h3g414', , 'h3g314', 'f1f413', 'g1g412', 'h3g314', 'a2a413', 'b2b414', 'c2c815',
-        ,
-        'e2e615', 'f2f413', 'g2g412', 'h3g314', , , , , , , , , 'a4g412', 'b4g412', 'c4g412', , 'e4g412', 'f4g412', 'h3g212', 'h3g212', 'a5a413', 'b5b414',
-        'c5c815', , 'h3g313', 'f5f413', 'g5g412', 'h5h413', 'a6a413', 'b6b414', 'c6c815', , 'h3g314', 'f6f413', 'g6g412', 'h6h413', 'a7a413', 'b7b414',
-        'c7c815', , 'h3g314', 'f7f413', 'g7g412', 'h7h413', 'a8a413', 'b8d814', 'c8d814', , 'e8d814', 'f8f413', 'g8g412', 'h8h413', 'a1e114', 'b1b413',
-        'a4b514', , 'a4b513', 'a4b414', 'a4b514', 'a4b514', 'a4b514', 'b2b413', 'a4b315', , 'e2e614', 'f2f414', 'g2g414', 'a4b514', , , , , , , , , , 'a4b312',
-        'a4b311', , 'e4b413', 'a4b413', 'a4b412', 'a4b311', 'a4b414', 'b5b413', 'a4b514', , 'a4b413', 'f5f414', 'a4b414', 'a4b514', 'a4b514', 'b6b413',
-        'a4b514', , 'a4b512', 'f6f414', 'g6g414', 'a4b514', 'a4b514', 'b7b413', 'a4b514', , 'a4b512', 'a4b514', 'a4b514', 'a4b514', 'a4b414', 'b8b413',
-        'a4b414', , 'a4b512', 'a4b414', 'a4b414', 'a4b414', 'b4c513', 'b4c513', 'c1c412', , 'b4c511', 'b4c513', 'g1g412', 'h1h412', 'b4c513', 'b4c513',
-        'c2c412', , 'e2e513', 'f2f413', 'g2g412', 'h2h412', , , , , , , , , 'b4c512', , 'b4b311', , 'e4g412', 'b4c512', 'b4c512', 'b4b311', 'a5d513', 'b4c513',
-        'c5c412', , 'b4c59', 'b4c513', 'g5g412', 'h5h412', 'a6e613', 'b4c513', 'c6c412', , 'b4c59', 'f6f413', 'g6g412', 'h6h412', 'a7e713', 'b4c513',
-        'c7c412', , 'b4c59', 'b4c513', 'g7g412', 'h7h412', 'a8e813', 'b4c513', 'c8c412', , 'b4c59', 'b4c513', 'g8g412', 'h8h412', , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a411', 'b1b411', 'c1c512', , 'e1e410', 'f1d112', 'f4e512', 'f4e512',
-        'a2a411', 'b2b411', 'c2c512', , 'e2e410', 'f2g213', 'f4e512', 'f4e512', , , , , , , , , 'a4e410', 'b4e410', 'c4e410', , 'f4f39', , 'f4f310', 'f4f310',
-        'a5d511', 'b5d511', 'c5d511', , 'e5e410', 'f5d511', 'g5d511', 'h5d511', 'a6a411', 'b6b411', 'c6d612', , 'e6e410', 'f6f512', 'f4e512', 'f4e512',
-        'a7a411', 'b7b411', 'c7d712', , 'e7e410', 'f4e512', 'f4e512', 'f4e512', 'a8a411', 'b8b411', 'c8d812', , 'e8e410', 'f4e512', 'f4e512', 'f4e512',
-        'a1a412', 'b1b413', 'g4f413', , 'e1e513', 'f1f412', 'g4f313', 'g4f313', 'a2a412', 'b2b413', 'c2c814', , 'e2e513', 'f2f412', 'g4f313', 'g4f313',
-        ,
-        , , , , , , , 'g4f310', 'g4f311', 'c4f412', , 'g4f39', 'g4f310', , 'g4f310', 'a5a412', 'b5e513', 'g4f312', , 'g4f312', 'f5f412', 'g4f312', 'g4f312',
-        'a6a412', 'b6b413', 'c6c814', , 'e6e513', 'f6f412', 'g4f313', 'g4f313', 'a7a412', 'b7d713', 'c7d713', , 'e7e513', 'f7f412', 'g4f313', 'g4f313',
-        'a8a412', 'b8d813', 'c8d813', , 'e8e513', 'f8f412', 'g4f313', 'g4f313', 'a1a413', 'b1b414', 'h4g414', , 'h4g314', 'f1f413', 'g1g413', 'h4g314',
-        'a2a413', 'b2b414', 'c2c815', , 'e2e515', 'f2f413', 'g2g413', 'h4g314', , , , , , , , , 'h4g312', 'h4g312', 'c4f413', , 'e4f413', 'h4g312', 'h4h312',
-        ,
-        'a5a413', 'b5b414', 'c5c815', , 'h4g313', 'f5f413', 'g5g413', 'h4g314', 'a6a413', 'b6b414', 'c6c815', , 'h4g314', 'f6f413', 'g6g413', 'h4g314',
-        'a7a413', 'b7d714', 'c7d714', , 'e7d714', 'f7f413', 'g7g413', 'h4g314', 'a8a413', 'b8d814', 'c8d814', , 'e8d814', 'f8f413', 'g8g413', 'h4g314',
-        'a1a414', 'a5b514', 'a5b514', , 'a5b613', 'a5b414', 'a5b514', 'a5b514', 'a2a414', 'a5b514', 'c2c515', , 'e2e614', 'f2f414', 'g2g414', 'a5b514',
-        ,
-        , , , , , , , 'a5b613', 'a5b613', 'a5b412', , 'e4e614', 'a5b413', 'a5b412', 'a5b412', , 'a5b414', 'a5b514', , 'a5b413', 'f5f414', 'a5b414', 'a5b514',
-        'a5b514', 'a5b514', 'a5b514', , 'a5b612', 'f6f414', 'g6g414', 'a5b514', 'a5b514', 'a5b514', 'a5b514', , 'a5b612', 'a5b514', 'a5b514', 'a5b514',
-        'a5b614', 'a5b614', 'a5b614', , 'a5b612', 'a5b614', 'a5b614', 'a5b614', 'a1a413', 'b1b413', 'b5c513', , 'b5c511', 'b5c513', 'b5c513', 'b5c513',
-        'a2a413', 'b2b413', 'c2c413', , 'e2e612', 'b5c514', 'g2g413', 'b5c513', , , , , , , , , 'b5c612', 'b5c612', 'b5c512', , 'e4e612', 'b5c512', 'b5c612',
-        'b5c612', 'a5a413', , 'c5d513', , 'b5c59', 'b5c513', 'b5c513', 'b5c513', 'a6e612', 'b6e612', 'c6e612', , 'b5c59', 'f6e612', 'g6e612', 'h6e612',
-        'a7e712', 'b7e712', 'c7e712', , 'b5c59', 'f7e712', 'g7e712', 'h7e712', 'a8e812', 'b8e812', 'c8e812', , 'b5c59', 'f8e812', 'g8e812', 'h8e812',
-        'a1e111', 'b1e111', 'c1e111', , 'e1e59', 'f1e111', 'g1e111', 'h1e111', 'a2a412', 'b2b412', 'c2c412', , 'e2e59', 'f2f412', 'c5d512', 'c5d512',
-        ,
-        , , , , , , , 'a4d411', 'b4d411', 'c4d411', , 'e4e59', 'f4d411', 'g4d411', 'h4d411', 'a5a412', 'b5b412', , , 'e5e69', 'f5e59', 'g5e59', 'h5e59',
-        'a6e69', 'b6e69', 'c6e69', , 'e6e79', 'f6e69', 'g6e69', 'h6e69', 'a7e79', 'b7e79', 'c7e79', , 'e7e89', 'f7e79', 'g7e79', 'h7e79', 'a8e89',
-        'b8e89', 'c8e89', , 'e8e79', 'f8e89', 'g8e89', 'h8e89', 'a1a310', 'b1b311', 'c1c412', , 'e1e410', 'f1f311', 'g1g310', 'h1h310', 'a2a310',
-        'b2b311', 'c2c412', , 'e2e410', 'f2f311', 'g2g310', 'h2h310', , , , , , , , , 'a4e410', 'b4e410', 'c4e410', , 'd5e511', 'f4e410', 'g4g310', 'h4h310',
-        'a5a310', 'b5b311', 'c5c612', , 'd5c59', 'f5f311', 'g5g310', 'h5h310', 'a6a310', 'b6e611', 'c6e611', 'd6e611', 'd5c59', 'f6f311', 'g6g310',
-        'h6h310', 'a7a310', 'b7e711', 'c7e711', 'd7e711', 'd5c59', 'f7f311', 'g7g310', 'h7h310', 'a8a310', 'b8e811', 'c8e811', 'd8e811', 'd5c59',
-        'f8f311', 'g8g310', 'h8h310', 'a1a411', 'b1b411', 'c1c512', , 'e1e411', 'f1f411', 'g1g411', 'h1h411', 'a2a411', 'b2b411', 'c2c512', , 'e2e411',
-        'f2f411', 'g2g411', 'h2h411', , , , , , , , , 'a4b411', 'b4e411', 'c4e411', , 'e5f410', 'f4g411', 'g4h411', 'h4g411', 'a5d511', 'b5d511', 'c5d511',
-        ,
-        , 'f5f411', 'g5g411', 'h5h411', 'a6a411', 'b6b411', 'c6c712', , 'e5d511', 'f6f411', 'g6g411', 'h6h411', 'a7a411', 'b7b411', 'c7c812', ,
-        'e5d511', 'f7f411', 'g7g411', 'h7h411', 'a8a411', 'b8b411', 'c8d812', , 'e5d511', 'f8f411', 'g8g411', 'h8h411', 'a1a412', 'b1b412', 'c1d112',
-        ,
-        'e1e411', 'f1f412', 'f5e512', 'f5e512', 'a2a412', 'b2b412', 'c2c513', , 'e2e411', 'f2f412', 'f5e512', 'f5e512', , , , , , , , , 'a4e411', 'b4e411',
-        'c4e411', , 'f5f410', 'f4e411', 'f5e511', 'f5e511', 'a5d512', 'b5d512', 'c5d512', , 'e5e411', , 'f5f412', 'f5f412', 'a6d612', 'b6d612', 'c6d612',
-        ,
-        'e6e411', 'f6d612', 'f5e512', 'f5e512', 'a7d712', 'b7d712', 'c7d712', , 'e7e411', 'f5e512', 'f5e512', 'f5e512', 'a8d812', 'b8d812', 'c8d812',
-        ,
-        'e8e411', 'f5e512', 'f5e512', 'f5e512', 'a1a413', 'b1b413', 'c1d113', , 'e1e513', 'f1f413', 'g1g413', 'g5f413', 'a2a413', 'b2b413', 'c2c714',
-        ,
-        'e2e513', 'f2f413', 'g2g413', 'g5f413', , , , , , , , , 'g5f411', 'g5f411', 'c4f413', , 'g5f410', 'g5g412', 'g5f512', 'g5f512', 'g5f412', 'b5e513',
-        'g5f412', , 'g5f512', 'g5f412', , 'g5f412', 'a6a413', 'b6b413', 'c6c714', , 'e6e513', 'f6f413', 'g5f413', 'g5f413', 'a7d713', 'b7d713', 'c7d713',
-        ,
-        'e7e513', 'f7f413', 'g5f413', 'g5f413', 'a8d813', 'b8d813', 'c8d813', , 'e8e513', 'f8f413', 'g5f413', 'g5f413', 'a1a413', 'b1b414', 'h5g414',
-        ,
-        'h5g414', 'f1f413', 'g1g414', 'h1h414', 'a2a413', 'b2b414', 'c2c815', , 'e2e615', 'f2f413', 'g2g414', 'h2h414', , , , , , , , , 'h5g412', 'b4f413',
-        'c4f413', , 'e4f413', 'h5g412', 'g4f413', 'h4f413', 'a5a413', 'b5b414', 'c5c815', , 'h5g413', 'f5f413', 'g5g414', , 'a6a413', 'b6b414', 'c6c815',
-        ,
-        'h5g414', 'f6f413', 'g6g414', 'h5g514', 'a7a413', 'b7d714', 'c7d714', , 'e7d714', 'f7f413', 'g7g414', 'h5g514', 'a8a413', 'b8d814', 'c8d814',
-        ,
-        'e8d814', 'f8f413', 'g8g414', 'h5g414', 'a1a414', 'a6b514', 'a6b514', , 'a6b613', 'f1e114', 'a6b514', 'a6b514', 'a2a414', 'a6b514', 'c2c515',
-        ,
-        'e2e614', 'a6b615', 'g2g414', 'a6b514', , , , , , , , , 'a6b613', 'a6b613', 'a6b513', , 'e4e614', 'a6b614', 'a6b613', 'a6b613', 'a5a414', 'b5b414',
-        'a6b514', , 'a6b614', 'a6b515', 'g5g414', 'a6b514', , 'a6b514', 'a6b514', , 'a6b612', 'f6e614', 'g6g414', 'a6b514', 'a6b514', 'a6b514', 'a6b514',
-        ,
-        'a6b612', 'a6b514', 'a6b514', 'a6b514', 'a6b614', 'a6b614', 'a6b614', , 'a6b612', 'a6b614', 'a6b614', 'a6b614', 'a1a413', 'b1b413', 'b6c513',
-        ,
-        'b6c511', 'b6c513', 'b6c513', 'b6c513', 'a2a413', 'b2b413', 'c2c814', , 'e2e612', 'b6c514', 'g2g413', 'b6c513', , , , , , , , , 'b6c612', 'b6c612',
-        'b6c512', , 'e4e612', 'b6c512', 'b6c612', 'b6c612', 'a5d513', 'b5d513', 'c5d513', , 'b6c59', 'b6c513', 'b6c513', 'b6c513', 'a6a413', , 'c6e612',
-        ,
-        'b6c59', 'f6e612', 'g6e612', 'h6e612', 'a7e712', 'b7e712', 'c7e712', , 'b6c59', 'f7e712', 'g7e712', 'h7e712', 'a8e812', 'b8e812', 'c8e812',
-        ,
-        'b6c59', 'f8e812', 'g8e812', 'h8e812', 'a1a412', 'b1b412', 'c1e112', , 'c6c511', 'f1e112', 'c6d512', 'c6d512', 'a2a412', 'b2b412', 'c2c514',
-        ,
-        'e2e512', 'c6d513', 'c6d512', 'c6d512', , , , , , , , , 'a4b412', 'b4g412', 'c4g412', , 'c6d510', 'c6d512', 'c6d612', 'c6d612', 'a5e512', 'b5e512',
-        'c5e512', , 'c6c59', 'c6d512', 'c6d512', 'c6d512', 'a6a412', 'b6b412', , , 'c6c59', 'f6e612', 'c6d512', 'c6d512', 'a7e712', 'b7e712', 'c6d512',
-        ,
-        'c6c59', 'f7e712', 'c6d512', 'c6d512', 'a8e812', 'b8e812', 'c6d512', , 'c6c59', 'f8e812', 'c6d512', 'c6d512', 'a1a412', 'b1b412', 'c1e112',
-        ,
-        'd6c511', 'f1e112', 'd6e512', 'd6e512', 'a2a412', 'b2b412', 'c2c513', , 'e2e612', 'd6e513', 'd6e512', 'd6e512', , , , , , , , , 'd6e511', 'd6e511',
-        'c4g412', , 'd6d510', 'd6e511', 'd6e511', 'd6e511', 'a5d512', 'b5d512', 'c5d512', , 'd6c59', 'd6d512', 'd6e512', 'd6e512', 'a6a412', 'b6b412',
-        'd6e512', , 'd6c59', 'f6e612', 'd6e512', 'd6e512', 'a7e712', 'b7e712', 'c7e712', 'd6e612', 'd6c59', 'd6e512', 'd6e512', 'd6e512', 'a8e812',
-        'b8e812', 'c8e812', 'd6e612', 'd6c59', 'd6e512', 'd6e512', 'd6e512', 'a1a412', 'b1d112', 'c1d112', , 'e1e512', 'f1d112', 'e6e512', 'e6e512',
-        'a2a412', 'e6d512', 'c2c513', , 'e2e512', 'e6f513', 'e6e512', 'e6e512', , , , , , , , , 'e6e511', 'e6e511', 'c4g412', , 'e6d510', 'e6e511', 'e6e511',
-        'e6e511', 'a5e512', 'b5e512', 'c5e512', , 'e6d511', 'e6d512', 'e6e512', 'e6e512', 'a6d612', 'b6d612', 'c6d612', , , 'e6e513', 'e6e512', 'e6e512',
-        'a7d712', 'b7d712', 'c7d712', , 'e6d511', 'e6e512', 'e6e512', 'e6e512', 'a8d812', 'b8d812', 'c8d812', , 'e6d511', 'e6e512', 'e6e512', 'e6e512',
-        'f6e512', 'b1b413', 'c1d113', , 'f6e512', 'f1f413', 'f6e512', 'f6e512', 'f6e512', 'b2b413', 'c2c514', , 'e2e513', 'f2f413', 'f6e512', 'f6e512',
-        ,
-        , , , , , , , 'f6e511', 'f6e511', 'c4f413', , 'f6f511', 'f6e511', 'f6e511', 'f6e511', 'a5d512', 'b5d512', 'c5d512', , 'e5d512', 'f5d512', 'f6e512',
-        'f6e512', 'f6e512', 'b6d613', 'f6e512', , 'f6e512', , 'f6e512', 'f6e512', 'f6e512', 'f6e512', 'f6e512', , 'f6e512', 'f6e512', 'f6e512', 'f6e512',
-        'f6e512', 'f6e512', 'f6e512', , 'f6e512', 'f6e512', 'f6e512', 'f6e512', 'a1a413', 'b1b413', 'g6f513', , 'e1e513', 'f1f413', 'g1g413', 'g6f513',
-        'a2a413', 'b2b413', 'c2c814', , 'e2e513', 'f2f413', 'g2g413', 'g6f513', , , , , , , , , 'g6f512', 'g6f512', 'c4f413', , 'g6f511', 'g6f512', 'g6f512',
-        'g6f512', 'a5e513', 'b5e513', 'c5e513', , 'g6f512', 'f5f413', 'g5g413', 'g6f513', 'a6a413', 'b6b413', 'c6c814', , 'e6e513', 'f6f413', , 'g6f513',
-        'a7d713', 'b7d713', 'c7d713', , 'e7e513', 'f7f413', 'g6f513', 'g6f513', 'a8d813', 'b8d813', 'c8d813', , 'e8e513', 'f8f413', 'g6f513', 'g6f513',
-        'a1a414', 'h6g514', 'c1c815', , 'h6g514', 'f1f414', 'g1g414', 'h1h414', 'a2a414', 'b2b415', 'c2c815', , 'e2e615', 'f2f414', 'g2g414', 'h2h414',
-        ,
-        , , , , , , , 'h6h513', 'h6g513', 'c4f414', , 'e4f414', 'h6h513', 'h6g513', 'h6g513', 'a5a414', 'b5b815', 'c5c815', , 'h6g513', 'f5f414', 'g5g414',
-        'h5h414', 'a6a414', 'b6b815', 'c6c815', , 'h6g514', 'f6f414', 'g6g414', , 'a7d714', 'b7d714', 'c7d714', , 'e7d714', 'f7f414', 'g7g414', 'h6g514',
-        'a8d814', 'b8d814', 'c8d814', , 'e8d814', 'f8f414', 'g8g414', 'h6g614', 'a1a414', 'a7b715', 'a7b615', , 'a7b613', 'a7b615', 'g1g414', 'h1h414',
-        'a2a414', 'a7b715', 'c2c516', , 'e2e814', 'a7b615', 'g2g414', 'h2h414', , , , , , , , , 'a7b613', 'a7b613', 'c4g414', , 'e4e814', 'a7b614', 'a7b613',
-        'a7b613', 'a5a414', 'a7b715', 'a7b715', , 'a7b614', 'f5f415', 'g5g414', 'h5h414', 'a6a414', 'a7b715', 'a7b615', , 'a7b612', 'a7b615', 'g6g414',
-        'h6h414', , 'a7b615', 'a7b715', , 'a7b612', 'a7b715', 'g7g414', 'h7h414', 'a7b614', 'a7b614', 'a7b614', , 'a7b612', 'a7b614', 'a7b614', 'a7b614',
-        'a1a414', 'b1b414', 'b7c614', , 'b7c612', 'b7c614', 'b7c614', 'b7c714', 'a2a414', 'b2b414', 'c2c515', , 'e2e613', 'b7c715', 'b7c614', 'b7c714',
-        ,
-        , , , , , , , 'b7c612', 'b7c612', 'c4g414', , 'e4e613', 'b7c714', 'b7c612', 'b7c612', 'a5d514', 'b5d514', 'b7c714', , 'b7c612', 'b7c614', 'b7c714',
-        'b7c714', 'a6e613', 'b6e613', 'c6e613', , 'b7c612', 'f6e613', 'g6e613', 'h6e613', 'a7a414', , 'c7e713', , 'b7c612', 'f7e713', 'g7e713', 'h7e713',
-        'a8e813', 'b8e813', 'c8e813', , 'b7c612', 'f8e813', 'g8e813', 'h8e813', 'a1a413', 'c7d613', 'c1c514', , 'c7d612', 'c7d614', 'c7d613', 'c7d613',
-        'a2a413', 'b2b414', 'c2c514', , 'e2e513', 'c7d614', 'c7d614', 'c7d613', , , , , , , , , 'c7d612', 'c7d612', 'c4h413', , 'e4e513', 'c7d613', 'c7d612',
-        'c7d612', 'a5d513', 'b5d513', 'c5d513', , 'c7c612', 'c7d613', 'c7d613', 'c7d613', 'a6e613', 'b6e613', 'c6e613', , 'c7d612', 'c7d613', 'c7d613',
-        'c7d613', 'a7a413', 'c7d613', , , 'c7d612', 'c7d613', 'c7d613', 'c7d613', 'a8e813', 'b8e813', 'c7d613', , 'c7d612', 'c7d613', 'c7d613', 'c7d613',
-        'a1a413', 'd7d613', 'c1c514', , 'd7d612', 'd7e614', 'd7e613', 'd7e613', 'a2a413', 'b2b414', 'c2c514', , 'e2e513', 'd7e614', 'd7e613', 'd7e613',
-        ,
-        , , , , , , , 'd7e612', 'd7d612', 'c4g413', , 'e4e513', 'd7e613', 'd7e612', 'd7e612', 'a5d513', 'b5d513', 'c5d513', , 'd7e612', 'd7e613', 'd7e613',
-        'd7e613', 'a6d613', 'b6d613', 'c6d613', , 'd7d612', 'd7d613', 'd7e613', 'd7e613', 'a7a413', 'd7e613', 'd7e613', , 'd7d612', 'd7e613', 'd7e613',
-        'd7e613', 'a8d813', 'b8d813', 'c8d813', 'd7e612', 'd7d612', 'd7e613', 'd7e613', 'd7e613', 'a1a413', 'e7d613', 'c1c514', , 'e7d612', 'e7f614',
-        'e7e613', 'e7e613', 'a2a413', 'b2b414', 'c2c514', , 'e2e513', 'e7e614', 'e7e613', 'e7e613', , , , , , , , , 'e7e612', 'e7d612', 'c4g413', , 'e4e513',
-        'e7f613', 'e7e612', 'e7e612', 'a5d513', 'b5d513', 'c5d513', , 'e7e612', 'e7e613', 'e7e613', 'e7e613', 'a6d613', 'b6d613', 'c6d613', , 'e7d612',
-        'e7d613', 'e7e613', 'e7e613', 'a7d713', 'b7d713', 'c7d713', , , 'e7e613', 'e7e613', 'e7e613', 'a8d813', 'b8d813', 'c8d813', , 'e7d612', 'e7e613',
-        'e7e613', 'e7e613', 'a1a413', 'b1b414', 'c1c614', , 'e1e513', 'f1f414', 'f7e613', 'f7e613', 'a2a413', 'b2b414', 'c2c614', , 'e2e513', 'f2f414',
-        'f7e613', 'f7e613', , , , , , , , , 'f7e612', 'b4g413', 'c4g413', , 'e4e513', 'f4g413', 'f7e612', 'f7e612', 'a5d513', 'b5d513', 'c5d513', , 'f7e612',
-        'f5e513', 'f7e613', 'f7e613', 'a6d613', 'b6d613', 'c6d613', , 'e6e513', 'f6d613', 'f7e613', 'f7e613', 'a7d713', 'b7d713', 'c7d713', , 'e7e513',
-        ,
-        'f7e613', 'f7e613', 'a8d813', 'b8d813', 'c8d813', , 'e8e513', 'f7e613', 'f7e613', 'f7e613', 'a1a414', 'b1d114', 'c1d114', , 'e1e514', 'f1d114',
-        'g1g414', 'h1h413', 'a2a414', 'b2b415', 'c2c715', , 'e2e514', 'f2f415', 'g2g414', 'h2h413', , , , , , , , , 'a4h413', 'b4h413', 'c4h413', , 'e4h413',
-        'f4h413', 'g4h413', 'g7g613', 'a5e514', 'b5e514', 'c5e514', , 'g7g613', 'f5e514', 'g5g414', 'h5h413', 'a6d614', 'b6d614', 'c6d614', , 'e6e514',
-        'f6d614', 'g6g414', 'h6h413', 'a7d714', 'b7d714', 'c7d714', , 'e7e514', 'f7d714', , 'h7h413', 'a8d814', 'b8d814', 'c8d814', , 'e8e514', 'f8d814',
-        'g7g614', 'h8h413', 'a1a414', 'b1b415', 'c1d115', , 'h7g614', 'f1f415', 'g1g414', 'h1h414', 'a2a414', 'b2b415', 'c2c716', , 'e2e615', 'f2f415',
-        'g2g414', 'h2h414', , , , , , , , , 'h7g613', 'h7g613', 'c4g414', , 'e4g414', 'h7g613', 'h7g613', 'h7g613', 'a5a414', 'b5b415', 'c5c716', , 'h7g613',
-        'f5f415', 'g5g414', 'h5h414', 'a6a414', 'b6e615', 'c6e615', , 'h7g614', 'f6f415', 'g6g414', 'h6h414', 'a7a414', 'b7d715', 'c7d715', , 'h7g614',
-        'f7f415', 'g7g414', , 'a8d814', 'b8d814', 'c8d814', , 'e8d814', 'f8d814', 'g8g414', 'h7g614', 'a1a415', 'a8b715', 'c1e115', , 'a8b714', 'f1e115',
-        'a8b715', 'a8b715', 'a2a415', 'a8b715', 'c2c816', , 'e2e715', 'a8b716', 'a8b816', 'a8b715', , , , , , , , , 'a8b814', 'a8b714', 'c4h415', , 'e4e715',
-        'a8b815', 'a8b714', 'a8b814', 'a5a415', 'a8b715', 'a8b715', , 'a8b815', 'a8b816', 'a8b815', 'a8b815', 'a6a415', 'a8b715', 'a8b816', , 'a8b713',
-        'a8b716', 'a8b816', 'a8b715', 'a7e715', 'b7e715', 'a8b715', , 'a8b713', 'a8b715', 'a8b715', 'a8b715', , 'a8b715', 'a8b715', , 'a8b713', 'a8b715',
-        'a8b715', 'a8b715', 'a1a414', 'b1b415', 'b8c715', , 'b8c714', 'b8c715', 'b8c715', 'b8c714', 'a2a414', 'b2b415', 'c2c516', , 'e2e515', 'b8c715',
-        'b8c715', 'b8c714', , , , , , , , , 'b8c713', 'b4h414', 'c4h414', , 'e4h414', 'b8c714', 'b8c714', 'b8c713', 'a5a414', 'b8c714', 'b8c714', , 'b8c713',
-        'b8c715', 'b8c714', 'b8c714', 'a6a414', 'b6e615', 'b8c815', , 'b8c713', 'b8c714', 'b8c714', 'b8c714', 'a7a414', 'b8c714', 'b8b715', , 'b8c713',
-        'b8c714', 'b8c714', 'b8c714', 'a8a414', , 'b8c714', , 'b8c713', 'b8c714', 'b8c714', 'b8c714', 'a1a414', 'b1b415', 'c1c615', , 'c8d714', 'c8d715',
-        'c8d714', 'c8d714', 'a2a414', 'b2b415', 'c2c615', , 'e2e615', 'c8d715', 'c8d715', 'c8d714', , , , , , , , , 'c8d713', 'b4h414', 'c4h414', , 'e4h414',
-        'c8d714', 'c8d713', 'c8d713', 'a5a414', 'c8d714', 'c8d714', , 'c8d713', 'c8d714', 'c8d714', 'c8d714', 'a6a414', 'c8d714', 'c8d714', , 'c8d713',
-        'c8d714', 'c8d714', 'c8d714', 'a7a414', 'c8d714', 'c8d714', , 'c8d713', 'c8d714', 'c8d714', 'c8d714', 'a8a414', 'c8d714', , , 'c8d713', 'c8d714',
-        'c8d714', 'c8d714', 'a1a414', 'b1b415', 'c1c615', , 'd8e714', 'd8e715', 'd8e714', 'd8e714', 'a2a414', 'b2b415', 'c2c615', , 'e2e515', 'd8e715',
-        'd8e715', 'd8e714', , , , , , , , , 'd8e713', 'b4h414', 'c4h414', , 'e4h414', 'd8e714', 'd8e713', 'd8e713', 'a5a414', 'd8e714', 'd8e714', , 'd8e713',
-        'd8e714', 'd8e714', 'd8e714', 'a6a414', 'd8e714', 'd8e714', , 'd8e713', 'd8e714', 'd8e714', 'd8e714', 'a7a414', 'd8e714', 'd8e714', , 'd8d713',
-        'd8e714', 'd8e714', 'd8e714', 'a8a414', 'd8e714', 'd8e714', , 'd8e713', 'd8e714', 'd8e714', 'd8e714', 'a1a414', 'b1b415', 'c1c615', , 'e8f714',
-        'e8f715', 'e8f714', 'e8f714', 'a2a414', 'b2b415', 'c2c615', , 'e2e615', 'e8f715', 'e8f715', 'e8f714', , , , , , , , , 'e8f713', 'b4h414', 'c4h414',
-        ,
-        'e4h414', 'e8f714', 'e8f713', 'e8f713', 'a5a414', 'e8f714', 'e8e714', , 'e8f713', 'e8f714', 'e8f714', 'e8f714', 'a6a414', 'e8f714', 'e8f714',
-        ,
-        'e8e713', 'e8e714', 'e8e714', 'e8f714', 'a7a414', 'e8f714', 'e8f714', , 'e8d713', 'e8e714', 'e8f714', 'e8f714', 'a8a414', 'e8f714', 'e8f714',
-        ,
-        , 'e8f714', 'e8f714', 'e8f714', 'a1a414', 'b1b415', 'c1d115', , 'f8f714', 'f1f415', 'f8f714', 'f8f714', 'a2a414', 'b2b415', 'c2h215', ,
-        'e2e615', 'f2f415', 'f8g715', 'f8f714', , , , , , , , , 'f8f713', 'b4h414', 'c4h414', , 'e4h414', 'f4h414', 'f8f713', 'f8g713', 'a5a414', 'f8f714',
-        'f8e714', , 'f8f713', 'f8f714', 'f8f714', 'f8f714', 'a6a414', 'f8f714', 'f8f714', , 'f8e713', 'f8e714', 'f8e714', 'f8f714', 'a7a414', 'f8f714',
-        'f8f714', , 'f8f714', 'f8e714', 'f8f714', 'f8f714', 'a8a414', 'f8f714', 'f8f714', , 'f8e713', , 'f8f714', 'f8f714', 'g8f714', 'b1b415', 'c1d115',
-        ,
-        'g8f714', 'f1f415', 'g8f714', 'g8f714', 'g8f714', 'b2b415', 'c2c516', , 'e2e516', 'f2f415', 'g2g415', 'g8f714', , , , , , , , , 'g8f713', 'b4h414',
-        'c4h414', , 'e4h414', 'f4h414', 'g8f713', 'g8g713', 'g8f714', 'g8f714', 'c5d515', , 'g8f713', 'g8f714', 'g8f714', 'g8f714', 'g8f714', 'g8f714',
-        'g8f714', , 'e6d615', 'f6f415', 'g6g515', 'g8f714', 'g8f714', 'g8f714', 'g8f714', , 'g8f714', 'f7f415', 'g8f714', 'g8f714', 'g8f714', 'g8f714',
-        'g8f714', , 'g8f714', 'g8f714', , 'g8f714', 'a1a415', 'b1b416', 'c1c816', , 'h8h715', 'f1f416', 'g1g415', 'h1h415', 'a2a415', 'b2b416', 'c2c816',
-        ,
-        'e2e616', 'f2f416', 'g2g415', 'h2h415', , , , , , , , , 'h8h714', 'b4g415', 'c4g415', , 'e4g415', 'f4g415', 'h8h714', 'h8g713', 'a5a415', 'h8g715',
-        'c5c816', , 'h8g714', 'h8g715', 'g5g415', 'h5h415', 'a6a415', 'b6b816', 'c6c816', , 'h8h715', 'f6f816', 'g6g415', 'h6h415', 'a7d715', 'b7d715',
-        'c7d715', , 'e7d715', 'f7d715', 'g7g415', 'h7h415', 'a8d815', 'b8d815', 'c8d815', , 'e8d815', 'f8d815', 'g8g415', , , 'a1b215', 'a1b215',
-        ,
-        'a1b214', 'a1b215', 'a1b215', 'a1a215', , 'a1a216', 'a1a216', , 'a1b215', 'a1b216', 'a1b215', 'a1b215', , , 'a1b216', , 'e3e815', 'a1b216',
-        'a1a216', 'a1b215', , , , , , , , , , , , , 'e5e815', 'a1b215', 'a1b215', 'a1a215', , , , , , 'a1b216', 'a1a216', 'a1b215', , , , , , , 'a1a216', 'a1b215',
-        ,
-        , , , , , , 'a1b215', 'b1c214', , 'b1b215', , 'b1c213', 'b1b215', 'b1b215', 'b1b215', 'b1c214', 'b1c215', 'b1b216', , 'b1c213', 'b1b216', 'b1b215',
-        'b1b215', 'b1c214', 'b1c215', 'b1c215', , 'e3e815', 'b1b216', 'b1c215', 'b1b215', , , , , , , , , 'b1b214', 'b1c214', 'c5h515', , 'e5e815', 'b1c214',
-        'b1c214', 'b1c214', 'b1c214', 'b1c215', 'b1b216', , 'b1b215', 'b1b216', 'b1c215', 'b1b215', 'b1c214', 'b1b215', 'b1c215', , 'b1c214', 'b1c215',
-        'b1c215', 'b1b215', 'b1c214', 'b1b215', 'b1b215', , 'b1c213', 'b1b215', 'b1b215', 'b1b215', 'a1a514', 'c1d214', , , 'c1c213', 'c1c215', 'c1d214',
-        'c1d214', 'a2a514', 'c1d214', 'c1d214', , 'c1c213', 'c1d215', 'c1d214', 'c1d214', 'a3a514', 'c1d214', 'c1d214', , 'c1d213', 'c1d215', 'c1d214',
-        'c1d214', , , , , , , , , 'c1d212', 'b5g514', 'c5g514', , 'e5g514', 'c1c214', 'c1c214', 'c1d213', 'a6a514', 'b6b815', 'c1d215', , 'c1c215', 'c1d215',
-        'c1d214', 'c1d214', 'a7a514', 'b7b815', 'c1c215', , 'c1c214', 'c1c215', 'g7g514', 'c1d214', 'a8a514', 'c1d214', 'c1d214', , 'c1c213', 'c1c215',
-        'c1d214', 'c1d214', 'a1a514', 'd1d214', 'd1d214', , 'd1c213', 'd1d215', 'd1d214', 'h1h513', 'a2a514', 'd1d214', 'd1d214', , 'd1c213', 'd1d215',
-        'd1d214', 'h2h513', 'a3a514', 'd1d214', 'd1d214', , 'd1d213', 'd1e214', 'd1d214', 'h3h513', , , , , , , , , 'd1d212', 'b5h513', 'c5h513', , 'e5h513',
-        'd1e213', 'd1e213', 'd1d213', 'a6a514', 'b6b815', 'c6h615', , 'd1d215', 'd1d215', 'd1d214', 'h6h513', 'a7a514', 'b7b815', 'c7d715', , 'd1d214',
-        'd1d215', 'g7g514', 'h7h513', 'a8a514', 'd1d214', 'd1d214', , 'd1d213', 'd1e214', 'd1d214', 'h8h513', 'a1a514', 'e1f214', 'e1d214', , , 'e1e215',
-        'e1f214', 'h1h513', 'a2a514', 'e1d214', 'e1d214', , 'e1d214', 'e1e215', 'e1d214', 'h2h513', 'a3a514', 'e1e214', 'e1d214', , 'e1d213', 'e1e214',
-        'e1e214', 'h3h513', , , , , , , , , 'e1d212', 'b5h513', 'c5h513', , 'e5h513', 'e1e213', 'e1e213', 'e1f213', 'a6a514', 'b6b815', 'c6h615', , 'e1e215',
-        'e1e215', 'e1d214', 'h6h513', 'a7a514', 'b7b815', 'c7d715', , 'e1e214', 'e1e215', 'g7g514', 'h7h513', 'a8a514', 'e1e214', 'e1e214', , 'e1d213',
-        'e1e214', 'e1e214', 'h8h513', 'a1a514', 'f1f214', 'c1d115', , 'e1d115', , 'f1f214', 'f1f214', 'a2a514', 'b2b515', 'c2d215', , 'e2h215', 'f1e215',
-        'f1f215', 'f1e214', 'a3a514', 'f1e214', 'c3f315', , 'f1e214', 'f1e214', 'f1e214', 'f1e214', , , , , , , , , 'f1e213', 'f1e213', 'c5h514', , 'e5h514',
-        'f1e213', 'f1e213', 'f1f213', 'a6a514', 'b6b815', 'c6h615', , 'e6h615', 'f1e215', 'f1f215', 'f1e214', 'a7a514', 'b7b815', 'c7d715', , 'f1e214',
-        'f1f215', 'f1f215', 'f1e214', 'a8a514', 'f1f214', 'f1e214', , 'f1e214', 'f1f214', 'f1f214', 'f1f214', 'g1f214', 'g1f214', 'c1d115', , 'e1d115',
-        'f1d115', , 'g1f214', 'g1f214', 'b2b515', 'c2c716', , 'g1g215', 'f2f316', 'g1f215', 'g1g215', 'a3a415', 'b3b515', 'c3c716', , 'g1f215', 'g1f115',
-        'g1f115', 'g1g215', , , , , , , , , 'g1g214', 'b5g515', 'c5g515', , 'e5g515', 'f5g515', 'g1g214', 'g1f213', 'a6a515', 'b6b515', 'c6c716', , 'e6e716',
-        'f6f716', 'g1f215', 'g1g215', 'a7a515', 'b7b515', 'g1f215', , 'g1g215', 'g1f215', 'g1f215', 'g1g215', 'g1f214', 'g1f214', 'c8d815', , 'e8h815',
-        'g1f214', 'g1f214', 'g1f214', 'a1d115', 'b1d115', 'c1d115', , 'e1d115', 'f1d115', 'g1d115', , 'a2a416', 'b2b516', 'c2h216', , 'h1g215', 'f2f516',
-        'g2g416', 'h1g215', 'a3a416', 'b3b516', 'c3h316', , 'e3e716', 'f3f516', 'g3g416', 'h1g215', , , , , , , , , 'h1g214', 'b5h515', 'c5h515', , 'e5h515',
-        'f5h515', 'h1h214', 'h1h214', 'a6d616', 'b6d616', 'c6d616', , 'e6e716', 'f6h616', 'g6h616', 'h1g215', 'a7d716', 'b7d716', 'c7d716', , 'h1h215',
-        'f7h716', 'g7h716', 'h1g215', 'a8d816', 'b8d816', 'c8d816', , 'h1h215', 'f8h816', 'g8h816', 'h1g115', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a514', 'b1e114', 'b2b314', , 'b2c213', 'b2b314', 'b2b314', 'b2b314', , , 'b2b315', , 'b2c213', 'b2b315',
-        'b2b315', 'b2b315', , , 'b2b315', , 'e3e114', 'f3f515', 'b2b315', 'b2b315', , , , , , , , , , , , , 'e5e114', 'b2c214', 'b2b314', 'b2b313', , , , , , 'f6f815',
-        'b2b315', 'b2b315', , , , , , , 'b2b315', 'b2b315', , , , , , , , 'b2b315', 'a1e113', 'b1e113', 'c1e113', , 'e1e213', 'f1e113', 'g1e113', 'h1e113',
-        'a2a314', 'b2b414', , , 'e2e813', 'f2e213', 'g2e213', 'h2e213', 'a3a414', 'b3b414', 'c2d214', , 'c2d213', 'f3f514', 'c2d214', 'c2d214', ,
-        ,
-        , , , , , , 'c2d212', 'c2b313', 'c5f514', , 'e5e813', 'c2d214', 'c2d214', 'c2d213', 'a6a714', 'b6b514', 'c6a614', , 'e6e813', 'f6f514', 'c2d214',
-        'c2d214', 'a7a814', 'b7e714', 'c7e714', , 'e7e813', 'f7f514', 'g7g514', 'c2d214', 'a8e813', 'b8e813', 'c8e813', , 'c2d213', 'f8e813', 'g8e813',
-        'h8e813', 'a1a512', 'b1b214', 'c1c214', 'd1e114', 'd2c213', 'f1f414', 'g1g214', 'h1h513', 'a2a512', 'b2b314', 'c2c314', , 'd2c213', 'f2f414',
-        'g2g314', 'h2h513', 'a3a512', 'b3e313', 'c3e313', , 'e3e813', 'f3e313', 'g3e313', 'h3h513', , , , , , , , , 'a5h513', 'b5a512', 'c5a512', , 'e5a512',
-        'f5a512', 'g5a512', 'h5a512', 'a6a512', 'b6b814', 'c6c814', , 'e6e813', 'f6g614', 'g6g814', 'h6h513', 'a7a512', 'b7b814', 'c7c814', , 'e7e813',
-        'f7h714', 'g7g814', 'h7h513', 'a8a512', 'b8e813', 'c8e813', , 'd2c213', 'f8e813', 'g8e813', 'h8h513', 'a1a513', 'b1b513', 'c1c814', , 'e1h114',
-        'f1f513', 'g1g513', 'e2f314', 'a2a513', 'b2b513', 'c2c814', , , 'f2f513', 'g2g513', 'e2f314', 'a3a513', 'b3b513', 'c3c814', , 'e2d213', 'f3f513',
-        'g3g513', 'e2f314', , , , , , , , , 'e2f312', 'b5f513', 'c5f513', , 'e5f513', 'e2f311', 'e2f311', 'e2f311', 'a6a513', 'b6b513', 'c6c814', , 'e2f314',
-        'f6f513', 'g6g513', 'e2f314', 'a7a513', 'b7b513', 'c7c814', , 'e2f314', 'f7f513', 'g7g513', 'e2f314', 'a8a513', 'b8b513', 'c8d814', , 'e2d213',
-        'f8f513', 'g8g513', 'e2f314', 'a1a214', 'b1b414', 'c1d114', , 'e1g114', 'f1g114', 'f2f314', 'h1h513', 'a2a414', 'b2b414', 'c2d214', , 'e2d214',
-        ,
-        'f2f314', 'h2h513', 'a3a414', 'b3b414', 'c3c715', , 'f2f314', 'f2e214', 'f2f314', 'h3h513', , , , , , , , , 'f2f312', 'b5h513', 'c5h513', , 'e5h513',
-        'f2f311', 'f2f311', 'f2f311', 'a6a814', 'b6b814', 'c6c715', , 'f2f314', 'f6f814', 'f2f314', 'h6h513', 'a7a814', 'b7b814', 'c7d714', , 'e7d714',
-        'f2f314', 'f2f314', 'h7h513', 'a8b814', 'b8d814', 'c8d814', , 'e8f814', 'f2f314', 'f2f314', 'h8h513', 'a1a514', 'b1d114', 'c1d114', , 'e1d114',
-        'f1d114', 'g1d114', 'g2g314', 'a2a514', 'g2f314', 'g2f314', , 'g2g314', 'g2f314', , 'g2f314', 'a3a514', 'b3b415', 'c3h315', , 'g2f314', 'f3f415',
-        'g2f314', 'g2f314', , , , , , , , , 'g2f312', 'g2f313', 'c5g514', , 'e5g514', 'g2f311', 'g2f311', 'g2f311', 'a6a514', 'b6d615', 'c6d615', , 'g2f314',
-        'f6h615', 'g2f314', 'g2f314', 'a7a514', 'g2f314', 'g2f314', , 'g2g314', 'g2f314', 'g2f314', 'g2f314', 'a8a514', 'g2f214', 'g2f314', , 'g2g314',
-        'g2f214', 'g2f214', 'g2f214', 'h2g314', 'b1d115', 'c1d115', , 'h2g314', 'f1h115', 'g1g514', 'h2g314', 'a2a515', 'h2g315', 'h2g315', , 'h2g314',
-        'h2g315', 'g2g514', , 'a3a515', 'h2g315', 'c3c716', , 'e3e715', 'h2h315', 'g3g514', 'h3h514', , , , , , , , , 'a5g514', 'b5g514', 'c5g514', , 'e5g514',
-        'f5g514', 'g5h514', 'h2g214', 'a6a515', 'h2g315', 'c6c716', , 'e6e715', 'f6f716', 'g6g514', 'h6h514', 'a7e715', 'b7e715', 'c7e715', , 'h2g314',
-        'f7e715', 'g7g514', 'h7h514', 'a8d815', 'b8d815', 'c8d815', , 'h2g314', 'f8e815', 'g8g514', 'h8h514', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a512', 'b1b513', 'c1d113', , 'e1e413', 'f1d113', 'g1g511', 'h1h511', 'a2a512',
-        'b2b513', 'c2d213', , 'e2e413', 'f2d213', 'g2g511', 'h2h511', 'a3a512', 'b3b513', 'c3c714', , 'e3e413', , 'g3g511', 'h3h511', , , , , , , , , 'a5f511',
-        'b5f511', 'c5f511', , 'e5f511', 'f5g511', 'g5h511', 'h5g511', 'a6a512', 'b6b513', 'c6c714', , 'e6e413', 'f6f511', 'g6g511', 'h6h511', 'a7a512',
-        'b7d713', 'c7d713', , 'e7e413', 'f7f511', 'g7g511', 'h7h511', 'a8a512', 'b8d813', 'c8d813', , 'e8e413', 'f8f511', 'g8g511', 'h8h511', 'g3f413',
-        'g3f413', 'g3f413', , 'g3f413', 'g3f413', 'g3f413', 'g3f413', 'g3f413', 'b2b514', 'g3f413', , 'g3f413', 'f2f514', 'g3f413', 'g3f413', 'g3f413',
-        'b3b514', 'c3c715', , 'g3f413', 'f3f514', , 'g3f413', , , , , , , , , 'g3f312', 'g3f313', 'c5f514', , 'g3f411', 'g3f311', 'g3f311', 'g3f311', 'g3f413',
-        'b6b514', 'g3f414', , 'g3f413', 'g3f413', 'g3f413', 'g3f413', 'g3f413', 'b7e714', 'c7e714', , 'g3f413', 'g3f413', 'g3f413', 'g3f413', 'g3f413',
-        'g3f413', 'g3f413', , 'g3f413', 'g3f413', 'g3f413', 'g3f413', 'a1d114', 'b1d114', 'c1d114', , 'e1d114', 'f1d114', 'g1d114', 'h1d114', 'h3g414',
-        'b2b815', 'c2c815', , 'h3g314', 'h3g414', 'g2g515', 'h2h115', 'a3a415', 'b3b815', 'c3c815', , 'e3e715', 'h3g414', 'g3g515', , , , , , , , , , 'h3g214',
-        'h3g314', 'c5c815', , 'e5e715', 'h3g314', 'h3h414', 'h3h214', 'a6a815', 'b6b815', 'c6c815', , 'h3g414', 'f6f715', 'g6g815', 'h3g215', 'h3g414',
-        'b7b815', 'c7c815', , 'h3g314', 'h3g414', 'g7g815', 'h3g215', 'a8d814', 'b8d814', 'c8d814', , 'e8d814', 'f8d814', 'g8d814', 'h3g414', , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a512', 'b1d112', 'c1d112', , 'e1e511', 'f1d112',
-        'g1g512', 'h1h512', 'a2a512', 'b2d212', 'c2d212', , 'e2e511', 'f2d212', 'g2g512', 'h2h512', 'a3a512', 'b3b413', 'c3c813', , 'e3e511', 'f3g313',
-        'g3g512', 'h3h512', , , , , , , 'f4f512', 'f4f512', 'a5e511', 'b5e511', 'c5e511', , 'e5f512', 'f4f311', 'f4f311', 'f4f311', 'a6a512', 'b6b813',
-        'c6c813', , 'e6e511', 'f6f512', 'g6g512', 'h6h512', 'a7d712', 'b7d712', 'c7d712', , 'e7e511', 'f7f512', 'g7g512', 'h7h512', 'a8d812', 'b8d812',
-        'c8d812', , 'e8e511', 'f8f512', 'g8g512', 'h8h512', 'g4f413', 'g4f413', 'g4f413', , 'g4f413', 'g4f413', 'g4f413', 'g4f413', 'g4f413', 'b2b514',
-        'g4f413', , 'g4f413', 'g4f513', 'g4f413', 'g4f413', 'g4f413', 'b3b514', 'c3c814', , 'g4f413', 'g4f513', 'g4f413', 'g4f413', , , , , , , , 'g4f512',
-        'g4f312', 'g4f313', 'c5c814', , 'g4f411', 'g4f311', 'g4f311', 'g4f311', 'g4f413', 'b6b814', 'c6c814', , 'g4f413', 'g4f413', 'g4f413', 'g4f413',
-        'g4f413', 'g4f513', 'g4f513', , 'g4f413', 'g4f413', 'g4f413', 'g4f413', 'a8d813', 'b8d813', 'c8d813', , 'e8d813', 'f8d813', 'g4f413', 'g4f413',
-        'a1d114', 'b1d114', 'c1d114', , 'e1d114', 'f1d114', 'g1g514', 'h1d114', 'h4g414', 'b2b815', 'c2c815', , 'h4g314', 'h4g414', 'g2g514', 'h2h115',
-        'a3a415', 'b3b815', 'c3c815', , 'e3e715', 'h4g414', 'g3g514', 'h3h115', , , , , , , , , 'a5g514', 'b5g514', 'c5g514', , 'e5g514', 'f5g514', 'h4g314',
-        'h4g314', 'a6a815', 'b6b815', 'c6c815', , 'h4g414', 'h4g514', 'g6g514', 'h4g315', 'h4g414', 'b7b815', 'c7c815', , 'h4g314', 'h4g414', 'g7g514',
-        'h4g315', 'a8d814', 'b8d814', 'c8d814', , 'e8d814', 'f8d814', 'g8g514', 'h4g414', , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a412', 'b1d112', 'c1d112', , 'e1e512', 'f1f412', 'g1g412', 'h1h412', 'a2a412', 'b2b413', 'c2c713',
-        ,
-        'e2e512', 'f2f412', 'g2g412', 'h2h412', 'a3a412', 'b3b413', 'c3c713', , 'e3e512', 'f3f412', 'g3g412', 'h3h412', , , , , , , , , 'a5e512', 'b5e512',
-        'c5e512', , 'f5f411', , 'f5f412', 'f5f412', 'a6a412', 'b6b713', 'c6c713', , 'e6e512', 'f5f413', 'g6g412', 'h6h412', 'a7d712', 'b7d712', 'c7d712',
-        ,
-        'e7e512', 'f7d712', 'g7g412', 'h7h412', 'a8d812', 'b8d812', 'c8d812', , 'e8e512', 'f8d812', 'g8g412', 'h8h412', 'a1d113', 'b1d113', 'c1d113',
-        ,
-        'e1d113', 'f1d113', 'g1d113', 'g5f413', 'g5f413', 'b2b414', 'g5f413', , 'g5f413', 'g5f513', 'g5f413', 'g5f413', 'g5f413', 'b3b414', 'c3c114',
-        ,
-        'g5f413', 'g5f513', 'g5f413', 'g5f413', , , , , , , , , 'g5f412', 'g5f413', 'c5f514', , 'g5f411', 'g5f412', , 'g5f412', 'g5f413', 'b6d614', 'c6d614',
-        ,
-        'g5f413', 'g5f413', 'g5f413', 'g5f413', 'a7d713', 'b7d713', 'c7d713', , 'e7d713', 'f7d713', 'g5f413', 'g5f413', 'g5f413', 'g5f413', 'g5f413',
-        ,
-        'g5f413', 'g5f413', 'g5f413', 'g5f413', 'a1d114', 'b1d114', 'c1d114', , 'e1d114', 'f1d114', 'g1d114', 'h1d114', 'h5g414', 'b2b815', 'c2c815',
-        ,
-        'h5g414', 'h5g414', 'g2g415', 'h2h415', 'a3a415', 'b3b815', 'c3c815', , 'e3e715', 'h5g414', 'g3g415', 'h3h415', , , , , , , , , 'h5g414', 'h5g414',
-        'c5c815', , 'e5e715', 'h5g414', 'h5h414', , 'a6a815', 'b6b815', 'c6c815', , 'h5g414', 'h5g514', 'g6g715', 'h5g415', 'h5g414', 'b7b815', 'c7c815',
-        ,
-        'h5g414', 'h5g414', 'g7g815', 'h5g415', 'a8d814', 'b8d814', 'c8d814', , 'e8d814', 'f8d814', 'g8d814', 'h5g414', , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a413', 'b1b413', 'c1d113', , 'e1e513', 'f1f413', 'f6f513', 'f6f513',
-        ,
-        'b2b413', 'c2d213', , 'e2e513', 'f2f413', 'f6f513', 'f6f513', , , 'c3c714', , 'e3e513', 'f3f413', 'f6f513', 'f6f513', , , , , , , , , , , , , 'f6f512',
-        'f5f413', 'f6f513', 'f6f513', , , , , , , 'f6f513', 'f6f513', , , , , , , 'f6f513', 'f6f513', , , , , , , , 'f6f513', 'g6f513', 'g6f513', 'g6f513', , 'g6f513',
-        'g6f513', 'g6f513', 'g6f513', 'g6f513', 'b2b414', 'c2e214', , 'g6f513', 'g6f513', 'g6f513', 'g6f513', 'g6f513', 'b3b414', 'c3c715', , 'e3e614',
-        'g6f513', 'g6f513', 'g6f513', , , , , , , , , 'g6f513', 'g6f513', 'c5c715', , 'g6f512', 'f5f414', 'g6f513', 'g6f513', 'g6f513', 'b6e614', 'c6e614',
-        ,
-        'g6f513', 'f6f414', , 'g6f513', 'g6f513', 'g6f513', 'g6f513', , 'g6f513', 'g6f513', 'g6f513', 'g6f513', 'a8d813', 'b8d813', 'c8d813', ,
-        'e8d813', 'f8d813', 'g6f513', 'g6f513', 'a1d114', 'b1d114', 'c1d114', , 'e1d114', 'f1d114', 'g1d114', 'h1d114', 'h6g514', 'b2b815', 'c2c815',
-        ,
-        'h6g514', 'h6g514', 'g2g415', 'h2h415', 'a3a415', 'b3b815', 'c3c815', , 'e3e715', 'f3f415', 'g3g415', 'h3h415', , , , , , , , , 'h6g514', 'b5b815',
-        'c5c815', , 'e5e715', 'h6g514', 'g5g815', 'h5h415', 'a6a815', 'b6b815', 'c6c815', , 'h6g514', 'h6g514', 'g6g815', , 'h6g514', 'b7b815', 'c7c815',
-        ,
-        'h6g514', 'h6g514', 'g7g815', 'h6g515', 'a8d814', 'b8d814', 'c8d814', , 'e8d814', 'f8d814', 'g8d814', 'h6g614', , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        'g7f613', 'b1d114', 'c1d114', , 'e1d114', 'f1d114', 'g7f613', 'g7f613', , 'b2b415', 'c2c815', , 'g7g614', 'f2f415', 'g2g414', 'g7f614',
-        ,
-        , 'c3c815', , 'e3e615', 'f3f415', 'g3g414', 'g7f614', , , , , , , , , , , , , 'g7f613', 'g7f614', 'g5g414', 'g7f614', , , , , , 'f6f815', 'g6g414', 'g7f614',
-        ,
-        , , , , , , 'g7f613', , , , , , , , 'g7f613', 'a1a415', 'b1d115', 'c1d115', , 'h7g614', 'f1e115', 'g1g415', 'h1h415', 'a2a415', 'h7g615', 'h7g615',
-        ,
-        'h7g614', 'h7g615', 'g2g415', 'h2h415', 'a3a415', 'h7g615', 'c3c716', , 'e3e715', 'f3f416', 'g3g415', 'h3h415', , , , , , , , , 'a5a815', 'h7g615',
-        'c5c716', , 'e5e715', 'h7h615', 'g5g415', 'h5h415', 'a6a815', 'h7g615', 'c6c716', , 'h7g614', 'h7h615', 'g6g415', 'h6h415', 'a7a815', 'b7d715',
-        'c7d715', , 'h7g614', 'f7e715', 'g7g415', , 'h7g614', 'b8d815', 'c8d815', , 'h7g614', 'f8h815', 'g8h815', 'h7g614', , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , ,
-        ,
-        , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , , 'a1a416', 'b1b416', 'c1c816', , 'h8h715', 'f1f416', 'g1g416',
-        'h1h415', , 'b2b416', 'c2c816', , 'h8g715', 'f2f416', 'g2g416', 'h2h415', , , 'c3c816', , 'e3e716', 'f3f416', 'g3g416', 'h3h415', , , , , , , , ,
-        ,
-        , , , 'e5e716', 'h8g715', 'h8g715', 'h5h415', , , , , , 'f6f816', 'g6g816', 'h6h415', , , , , , , 'g7g816', 'h7h415', , , , , , , ,
-    ];
-})(Endgame_r || (Endgame_r = {}));
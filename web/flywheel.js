@@ -1963,10 +1963,51 @@ var Flywheel;
     }());
     Flywheel.EndgameLookup = EndgameLookup;
     var Endgame = /** @class */ (function () {
-        function Endgame(data, pieceList) {
-            this.data = data;
+        // The table is split into one binary file per Black King square: tableName_0.bin .. tableName_9.bin.
+        // Each file is downloaded the first time a position needs it.
+        function Endgame(tableName, pieceList) {
+            this.slices = [];
+            this.waiting = [];
+            this.tableName = tableName;
             this.pieceList = pieceList;
         }
+        Endgame.prototype.LoadSlice = function (slice, callback) {
+            var _this = this;
+            if (this.slices[slice]) {
+                callback(this.slices[slice]);
+                return;
+            }
+            if (this.waiting[slice]) {
+                this.waiting[slice].push(callback);
+                return;
+            }
+            this.waiting[slice] = [callback];
+            var request = new XMLHttpRequest();
+            request.open('GET', this.tableName + "_" + slice + ".bin");
+            request.responseType = 'arraybuffer';
+            request.onloadend = function () {
+                var data = null;
+                if (request.status === 200 && request.response) {
+                    data = new Uint8Array(request.response);
+                    if (data.length !== Endgame.HeaderBytes + 2 * Math.pow(64, _this.pieceList.length - 1) ||
+                        String.fromCharCode(data[0], data[1], data[2], data[3]) !== 'EGWB' ||
+                        data[5] !== _this.pieceList.length ||
+                        data[6] !== slice) {
+                        data = null;
+                    }
+                    else {
+                        _this.slices[slice] = data;
+                    }
+                }
+                var callbacks = _this.waiting[slice];
+                _this.waiting[slice] = null;
+                for (var _i = 0, callbacks_1 = callbacks; _i < callbacks_1.length; _i++) {
+                    var cb = callbacks_1[_i];
+                    cb(data);
+                }
+            };
+            request.send();
+        };
         Endgame.Config = function (board) {
             var config = [];
             var dict = {};
@@ -2009,15 +2050,18 @@ var Flywheel;
             }
             return new Position(index, symmetry);
         };
-        Endgame.prototype.GetMove = function (board) {
+        // Returns false if this table does not match the pieces on the board.
+        // Otherwise the answer is passed to the callback, once the slice holding it has been loaded;
+        // the callback receives null if there is no forced mate or the slice could not be loaded.
+        Endgame.prototype.GetMove = function (board, callback) {
             // See if the board contents match the pieceList.
             var config = Endgame.Config(board);
             if (config.length !== this.pieceList.length) {
-                return null; // this endgame table does not match the board configuration
+                return false; // this endgame table does not match the board configuration
             }
             for (var i = 0; i < config.length; ++i) {
                 if (config[i].piece !== this.pieceList[i]) {
-                    return null; // this endgame table does not match the board configuration
+                    return false; // this endgame table does not match the board configuration
                 }
             }
             // Try all 8 symmetries to find the smallest valid table index.
@@ -2029,25 +2073,38 @@ var Flywheel;
                 }
             }
             if (!bestPos) {
-                return null;
-            }
-            var result = this.data[bestPos.index];
-            if (!result) {
-                return null;
+                callback(null);
+                return true;
             }
-            // The first 4 characters of result are the algebraic move string.
-            // Any remaining characters encode the number of moves (including this one) for forced mate.
-            var source = Board.Offset(result.substr(0, 2));
-            var dest = Board.Offset(result.substr(2, 2));
-            var mateInMoves = parseInt(result.substr(4));
-            // Unrotate the move back to the orientation needed by the caller.
-            var algebraicMove = (Board.Algebraic(Endgame.Rotate(bestPos.symmetry, source)) +
-                Board.Algebraic(Endgame.Rotate(bestPos.symmetry, dest)));
-            return new EndgameLookup(algebraicMove, mateInMoves);
+            var sliceLength = Math.pow(64, config.length - 1);
+            var slice = Math.floor(bestPos.index / sliceLength);
+            this.LoadSlice(slice, function (data) {
+                if (!data) {
+                    callback(null);
+                    return;
+                }
+                // Each slot is 2 bytes: the number of moves (including this one) for forced mate,
+                // then the index of the piece to move in the high 2 bits and its target square below.
+                var entry = Endgame.HeaderBytes + 2 * (bestPos.index - slice * sliceLength);
+                var mateInMoves = data[entry];
+                if (mateInMoves === 0) {
+                    callback(null);
+                    return;
+                }
+                var piece = 1 + (data[entry + 1] >> 6);
+                var source = Endgame.PieceOffsets[Endgame.SymmetryTable[bestPos.symmetry][Endgame.Displacements[config[piece].offset]]];
+                var dest = Endgame.PieceOffsets[data[entry + 1] & 63];
+                // Unrotate the move back to the orientation needed by the caller.
+                var algebraicMove = (Board.Algebraic(Endgame.Rotate(bestPos.symmetry, source)) +
+                    Board.Algebraic(Endgame.Rotate(bestPos.symmetry, dest)));
+                callback(new EndgameLookup(algebraicMove, mateInMoves));
+            });
+            return true;
         };
         Endgame.Rotate = function (symmetry, offset) {
             return Endgame.PieceOffsets[Endgame.SymmetryTable[Endgame.InverseSymmetry[symmetry]][Endgame.Displacements[offset]]];
         };
+        Endgame.HeaderBytes = 8;
         Endgame.InverseSymmetry = [
             0, 1, 2, 3, 4, 6, 5, 7
         ];
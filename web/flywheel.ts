@@ -2055,14 +2055,55 @@ module Flywheel {
     }
 
     export class Endgame {
-        private readonly data: string[];
+        private readonly tableName: string;
         private readonly pieceList: Square[];
+        private readonly slices: Uint8Array[] = [];
+        private readonly waiting: ((data:Uint8Array) => void)[][] = [];
 
-        public constructor(data:string[], pieceList:Square[]) {
-            this.data = data;
+        // The table is split into one binary file per Black King square: tableName_0.bin .. tableName_9.bin.
+        // Each file is downloaded the first time a position needs it.
+        public constructor(tableName:string, pieceList:Square[]) {
+            this.tableName = tableName;
             this.pieceList = pieceList;
         }
 
+        private LoadSlice(slice:number, callback:(data:Uint8Array) => void):void {
+            if (this.slices[slice]) {
+                callback(this.slices[slice]);
+                return;
+            }
+
+            if (this.waiting[slice]) {
+                this.waiting[slice].push(callback);
+                return;
+            }
+
+            this.waiting[slice] = [callback];
+            const request = new XMLHttpRequest();
+            request.open('GET', `${this.tableName}_${slice}.bin`);
+            request.responseType = 'arraybuffer';
+            request.onloadend = () => {
+                let data:Uint8Array = null;
+                if (request.status === 200 && request.response) {
+                    data = new Uint8Array(request.response);
+                    if (data.length !== Endgame.HeaderBytes + 2*Math.pow(64, this.pieceList.length-1) ||
+                        String.fromCharCode(data[0], data[1], data[2], data[3]) !== 'EGWB' ||
+                        data[5] !== this.pieceList.length ||
+                        data[6] !== slice) {
+                        data = null;
+                    } else {
+                        this.slices[slice] = data;
+                    }
+                }
+                const callbacks = this.waiting[slice];
+                this.waiting[slice] = null;
+                for (let cb of callbacks) {
+                    cb(data);
+                }
+            };
+            request.send();
+        }
+
         private static Config(board:Board): EndgamePieceInfo[] {
             const config:EndgamePieceInfo[] = [];
             const dict = {};
@@ -2111,16 +2152,19 @@ module Flywheel {
             return new Position(index, symmetry);
         }
 
-        public GetMove(board:Board):EndgameLookup {
+        // Returns false if this table does not match the pieces on the board.
+        // Otherwise the answer is passed to the callback, once the slice holding it has been loaded;
+        // the callback receives null if there is no forced mate or the slice could not be loaded.
+        public GetMove(board:Board, callback:(lookup:EndgameLookup) => void):boolean {
             // See if the board contents match the pieceList.
             const config:EndgamePieceInfo[] = Endgame.Config(board);
             if (config.length !== this.pieceList.length) {
-                return null;    // this endgame table does not match the board configuration
+                return false;   // this endgame table does not match the board configuration
             }
 
             for (let i=0; i < config.length; ++i) {
                 if (config[i].piece !== this.pieceList[i]) {
-                    return null;    // this endgame table does not match the board configuration
+                    return false;   // this endgame table does not match the board configuration
                 }
             }
 
@@ -2134,33 +2178,48 @@ module Flywheel {
             }
 
             if (!bestPos) {
-                return null;
+                callback(null);
+                return true;
             }
 
-            let result:string = this.data[bestPos.index];
-            if (!result) {
-                return null;
-            }
+            const sliceLength:number = Math.pow(64, config.length-1);
+            const slice:number = Math.floor(bestPos.index / sliceLength);
+            this.LoadSlice(slice, (data:Uint8Array) => {
+                if (!data) {
+                    callback(null);
+                    return;
+                }
 
-            // The first 4 characters of result are the algebraic move string.
-            // Any remaining characters encode the number of moves (including this one) for forced mate.
-            let source:number = Board.Offset(result.substr(0, 2));
-            let dest:number = Board.Offset(result.substr(2, 2));
-            let mateInMoves:number = parseInt(result.substr(4));
+                // Each slot is 2 bytes: the number of moves (including this one) for forced mate,
+                // then the index of the piece to move in the high 2 bits and its target square below.
+                const entry:number = Endgame.HeaderBytes + 2*(bestPos.index - slice*sliceLength);
+                const mateInMoves:number = data[entry];
+                if (mateInMoves === 0) {
+                    callback(null);
+                    return;
+                }
+
+                const piece:number = 1 + (data[entry+1] >> 6);
+                const source:number = Endgame.PieceOffsets[Endgame.SymmetryTable[bestPos.symmetry][Endgame.Displacements[config[piece].offset]]];
+                const dest:number = Endgame.PieceOffsets[data[entry+1] & 63];
 
-            // Unrotate the move back to the orientation needed by the caller.
-            let algebraicMove:string = (
-                Board.Algebraic(Endgame.Rotate(bestPos.symmetry, source)) +
-                Board.Algebraic(Endgame.Rotate(bestPos.symmetry, dest))
-            );
+                // Unrotate the move back to the orientation needed by the caller.
+                let algebraicMove:string = (
+                    Board.Algebraic(Endgame.Rotate(bestPos.symmetry, source)) +
+                    Board.Algebraic(Endgame.Rotate(bestPos.symmetry, dest))
+                );
 
-            return new EndgameLookup(algebraicMove, mateInMoves);
+                callback(new EndgameLookup(algebraicMove, mateInMoves));
+            });
+            return true;
         }
 
         private static Rotate(symmetry:number, offset:number): number {
             return Endgame.PieceOffsets[Endgame.SymmetryTable[Endgame.InverseSymmetry[symmetry]][Endgame.Displacements[offset]]];
         }
 
+        private static readonly HeaderBytes = 8;
+
         private static readonly InverseSymmetry = [
             0, 1, 2, 3, 4, 6, 5, 7
         ];
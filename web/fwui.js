@@ -368,8 +368,8 @@ var FwDemo;
             }
         }
     }
-    var endgame_q = new Flywheel.Endgame(Endgame_q.GetTable(), [Flywheel.Square.BlackKing, Flywheel.Square.WhiteKing, Flywheel.Square.WhiteQueen]);
-    var endgame_r = new Flywheel.Endgame(Endgame_r.GetTable(), [Flywheel.Square.BlackKing, Flywheel.Square.WhiteKing, Flywheel.Square.WhiteRook]);
+    var endgame_q = new Flywheel.Endgame('endgame_q', [Flywheel.Square.BlackKing, Flywheel.Square.WhiteKing, Flywheel.Square.WhiteQueen]);
+    var endgame_r = new Flywheel.Endgame('endgame_r', [Flywheel.Square.BlackKing, Flywheel.Square.WhiteKing, Flywheel.Square.WhiteRook]);
     var KnownEndgames = [endgame_q, endgame_r];
     function DrawBoard(board) {
         for (var y = 0; y < 8; ++y) {
@@ -391,9 +391,15 @@ var FwDemo;
                     SetMoveState(MoveStateType.OpponentTurn);
                     for (var _i = 0, KnownEndgames_1 = KnownEndgames; _i < KnownEndgames_1.length; _i++) {
                         var endgame = KnownEndgames_1[_i];
-                        var response = endgame.GetMove(TheBoard);
-                        if (response) {
-                            AnimateMove(response);
+                        var found = endgame.GetMove(TheBoard, function (response) {
+                            if (response) {
+                                AnimateMove(response);
+                            }
+                            else {
+                                alert('Could not find endgame response.');
+                            }
+                        });
+                        if (found) {
                             return;
                         }
                     }
@@ -380,12 +380,12 @@ module FwDemo {
     }
 
     const endgame_q = new Flywheel.Endgame(
-        Endgame_q.GetTable(),
+        'endgame_q',
         [Flywheel.Square.BlackKing, Flywheel.Square.WhiteKing, Flywheel.Square.WhiteQueen]
     );
 
     const endgame_r = new Flywheel.Endgame(
-        Endgame_r.GetTable(),
+        'endgame_r',
         [Flywheel.Square.BlackKing, Flywheel.Square.WhiteKing, Flywheel.Square.WhiteRook]
     );
 
@@ -412,9 +412,14 @@ module FwDemo {
                 if (MoveState !== MoveStateType.OpponentTurn) {
                     SetMoveState(MoveStateType.OpponentTurn);
                     for (let endgame of KnownEndgames) {
-                        const response:Flywheel.EndgameLookup = endgame.GetMove(TheBoard);
-                        if (response) {
-                            AnimateMove(response);
+                        const found:boolean = endgame.GetMove(TheBoard, (response:Flywheel.EndgameLookup) => {
+                            if (response) {
+                                AnimateMove(response);
+                            } else {
+                                alert('Could not find endgame response.');
+                            }
+                        });
+                        if (found) {
                             return;
                         }
                     }